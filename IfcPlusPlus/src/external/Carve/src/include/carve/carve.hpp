@@ -265,6 +265,8 @@ namespace carve {
                                        << #x;                                 \
   MACRO_END
 
+#include <carve/trace.hpp>
+
 void printToDebugLogOn(bool on);
 bool IsPrintToDebugLogOn();
 void printToDebugLog(const char* funcName, std::string details);
@@ -299,7 +299,8 @@ namespace carve {
 			double d3 = carve::geom::dotcross(direction, b, base);
 #endif
 
-			if (isnan(d1) || isnan(d2) || isnan(d3))
+			// printToDebugLog only records a trace event, so the message is not built while tracing is off
+			if ((isnan(d1) || isnan(d2) || isnan(d3)) && carve::trace::isEnabled())
 			{
 				printToDebugLog( __FUNCTION__, " d1=" +std::to_string( d1) + ", d2=" + std::to_string(d2) +
 					", d3=" + std::to_string(d3 ) );
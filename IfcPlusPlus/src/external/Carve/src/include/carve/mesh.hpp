@@ -30,9 +30,11 @@
 #include <carve/djset.hpp>
 #include <carve/geom.hpp>
 #include <carve/geom3d.hpp>
+#include <carve/pool_alloc.hpp>
 #include <carve/rtree.hpp>
 #include <carve/tag.hpp>
 
+#include <functional>
 #include <iostream>
 
 #if defined _DEBUG || defined _DEBUG_RELEASE
@@ -136,7 +138,7 @@ namespace carve {
 		// structure defines a simple mesh (either one or two faces
 		// incident on each edge).
 		template <unsigned int ndim>
-		class Edge : public tagable {
+		class Edge : public tagable, public PoolAllocated {
 		public:
 			typedef Vertex<ndim> vertex_t;
 			typedef Face<ndim> face_t;
@@ -245,7 +247,7 @@ namespace carve {
 		// A Face contains a pointer to the beginning of the half-edge
 		// circular list that defines its boundary.
 		template <unsigned int ndim>
-		class Face : public tagable {
+		class Face : public tagable, public PoolAllocated {
 		public:
 			typedef Vertex<ndim> vertex_t;
 			typedef Edge<ndim> edge_t;
@@ -424,7 +426,8 @@ namespace carve {
 			template <typename iter_t>
 			Face* create(iter_t beg, iter_t end, bool reversed) const;
 
-			Face* clone(const vertex_t* old_base, vertex_t* new_base, std::unordered_map<const edge_t*, edge_t*>& edge_map) const;
+			// clone the face with its edge loop. The new edges are appended to r_edges in loop order, rev pointers are not set
+			Face* clone(const vertex_t* old_base, vertex_t* new_base, std::vector<edge_t*>& r_edges) const;
 
 			void remove() {
 				edge_t* e = edge;
@@ -500,9 +503,25 @@ namespace carve {
 				typedef std::unordered_map<vpair_t, edgelist_t, carve::mesh::hash_vertex_pair> edge_map_t;
 				typedef std::unordered_map<const vertex_t*, std::set<const vertex_t*> > edge_graph_t;
 
+				// A half-edge, keyed by its vertices in address order, so that an edge and its reverse get the same key
+				struct EdgeRecord {
+					const vertex_t* v_min;
+					const vertex_t* v_max;
+					edge_t* edge;
+					bool is_reversed;  // edge goes from v_max to v_min
+
+					EdgeRecord(edge_t* _edge) : edge(_edge) {
+						const vertex_t* v1 = _edge->v1();
+						const vertex_t* v2 = _edge->v2();
+						is_reversed = std::less<const vertex_t*>()(v2, v1);
+						v_min = is_reversed ? v2 : v1;
+						v_max = is_reversed ? v1 : v2;
+					}
+				};
+
 				MeshOptions opts;
 
-				edge_map_t edges;
+				std::vector<EdgeRecord> edge_records;
 				edge_map_t complex_edges;
 
 				carve::djset::djset face_groups;
@@ -580,6 +599,9 @@ namespace carve {
 					const vpair_t& e, const edge_map_t& all_edges,
 					std::pair<std::set<size_t>, std::set<size_t> >& groups);
 
+				template <typename key_func_t>
+				static void radixSortEdgeRecords(std::vector<EdgeRecord>& records, std::vector<EdgeRecord>& temp, key_func_t key);
+
 				void buildEdgeGraph(const edge_map_t& all_edges);
 				void extractPath(std::vector<const vertex_t*>& path);
 				void removePath(const std::vector<const vertex_t*>& path);
@@ -703,6 +725,7 @@ namespace carve {
 					faces[i]->recalc(CARVE_EPSILON);
 				}
 				calcOrientation();
+				resetVolume();
 			}
 
 			void invert()
@@ -715,6 +738,7 @@ namespace carve {
 				{
 					is_negative = !is_negative;
 				}
+				resetVolume();
 			}
 
 			Mesh* clone(const vertex_t* old_base, vertex_t* new_base) const;
@@ -697,7 +697,7 @@ Face<ndim>* Face<ndim>::create(iter_t beg, iter_t end, bool reversed) const
 }
 
 template <unsigned int ndim>
-Face<ndim>* Face<ndim>::clone(const vertex_t* old_base, vertex_t* new_base, std::unordered_map<const edge_t*, edge_t*>& edge_map) const
+Face<ndim>* Face<ndim>::clone(const vertex_t* old_base, vertex_t* new_base, std::vector<edge_t*>& r_edges) const
 {
     Face* r = new Face(*this);
 
@@ -706,7 +706,7 @@ Face<ndim>* Face<ndim>::clone(const vertex_t* old_base, vertex_t* new_base, std:
     edge_t* r_e;
     do {
         r_e = new edge_t(e->vert - old_base + new_base, r);
-        edge_map[e] = r_e;
+        r_edges.push_back(r_e);
         if (r_p) {
             r_p->next = r_e;
             r_e->prev = r_p;
@@ -716,15 +716,6 @@ Face<ndim>* Face<ndim>::clone(const vertex_t* old_base, vertex_t* new_base, std:
         }
         r_p = r_e;
 
-        if (e->rev) {
-            typename std::unordered_map<const edge_t*, edge_t*>::iterator rev_i =
-                edge_map.find(e->rev);
-            if (rev_i != edge_map.end()) {
-                r_e->rev = (*rev_i).second;
-                (*rev_i).second->rev = r_e;
-            }
-        }
-
         e = e->next;
     } while (e != edge);
     r_e->next = r->edge;
@@ -753,6 +744,7 @@ namespace detail {
     void FaceStitcher::initEdges(iter_t begin, iter_t end)
     {
         size_t c = 0;
+        edge_records.clear();
         for (iter_t it = begin; it != end; ++it)
         {
             face_t* face = *it;
@@ -761,7 +753,7 @@ namespace detail {
             face->id = c++;
             edge_t* e = face->edge;
             do {
-                edges[vpair_t(e->v1(), e->v2())].push_back(e);
+                edge_records.push_back(EdgeRecord(e));
                 e = e->next;
                 if (e->rev) {
                     e->rev->rev = nullptr;
@@ -967,17 +959,61 @@ Mesh<ndim>* Mesh<ndim>::clone(const vertex_t* old_base, vertex_t* new_base) cons
     std::vector<face_t*> r_faces;
     std::vector<edge_t*> r_open_edges;
     std::vector<edge_t*> r_closed_edges;
-    std::unordered_map<const edge_t*, edge_t*> edge_map;
+
+    // old_edges[i] is cloned to r_edges[i]
+    std::vector<const edge_t*> old_edges;
+    std::vector<edge_t*> r_edges;
+
+    size_t num_edges = 0;
+    for (size_t i = 0; i < faces.size(); ++i)
+    {
+        num_edges += faces[i]->n_edges;
+    }
 
     r_faces.reserve(faces.size());
-    r_open_edges.reserve(r_open_edges.size());
-    r_closed_edges.reserve(r_closed_edges.size());
+    r_open_edges.reserve(open_edges.size());
+    r_closed_edges.reserve(closed_edges.size());
+    old_edges.reserve(num_edges);
+    r_edges.reserve(num_edges);
 
     for (size_t i = 0; i < faces.size(); ++i)
     {
-        r_faces.push_back(faces[i]->clone(old_base, new_base, edge_map));
+        const face_t* face = faces[i];
+        const edge_t* e = face->edge;
+        do {
+            old_edges.push_back(e);
+            e = e->next;
+        } while (e != face->edge);
+
+        r_faces.push_back(face->clone(old_base, new_base, r_edges));
+    }
+
+    // Edges and faces are allocated from a pool, so edges of neighbouring faces are mostly close in memory, and the
+    // sorted array is nearly in order already. Looking up in it is faster than building a hash map with an allocation per edge
+    std::vector<std::pair<const edge_t*, edge_t*> > edge_map(old_edges.size());
+    for (size_t i = 0; i < old_edges.size(); ++i)
+    {
+        edge_map[i] = std::make_pair(old_edges[i], r_edges[i]);
+    }
+    std::sort(edge_map.begin(), edge_map.end());
+
+    auto findClonedEdge = [&edge_map](const edge_t* old_edge) -> edge_t* {
+        typename std::vector<std::pair<const edge_t*, edge_t*> >::const_iterator it =
+            std::lower_bound(edge_map.begin(), edge_map.end(), std::make_pair(old_edge, (edge_t*)nullptr));
+        if (it == edge_map.end() || it->first != old_edge) {
+            return nullptr;
+        }
+        return it->second;
+    };
+
+    for (size_t i = 0; i < old_edges.size(); ++i)
+    {
+        if (old_edges[i]->rev)
+        {
+            r_edges[i]->rev = findClonedEdge(old_edges[i]->rev);
+        }
     }
-    
+
     for (size_t i = 0; i < closed_edges.size(); ++i)
     {
         edge_t* closedEdge = closed_edges[i];
@@ -986,19 +1022,12 @@ Mesh<ndim>* Mesh<ndim>::clone(const vertex_t* old_base, vertex_t* new_base) cons
             continue;
         }
 
-        r_closed_edges.push_back(edge_map[closedEdge]);
-
-        edge_t* r1 = r_closed_edges.back();
-        if (r1 == nullptr)
-        {
-            continue;
-        }
-        r1->rev = edge_map[closedEdge->rev];
+        r_closed_edges.push_back(findClonedEdge(closedEdge));
     }
-    
+
     for (size_t i = 0; i < open_edges.size(); ++i)
     {
-        r_open_edges.push_back(edge_map[open_edges[i]]);
+        r_open_edges.push_back(findClonedEdge(open_edges[i]));
     }
 
     Mesh<ndim>* m = new Mesh(r_faces, r_open_edges, r_closed_edges, is_negative, is_inner_mesh);
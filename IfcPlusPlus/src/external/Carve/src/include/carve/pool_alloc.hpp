@@ -0,0 +1,73 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <new>
+
+// Pooled allocation of small, fixed size objects.
+//
+// Mesh edges and faces are allocated and freed one by one, in very large
+// numbers. Instead of going through malloc for each of them, blocks of the
+// same size class are cut from 64 KB chunks and kept in a free list per
+// thread. Consecutively created edges and faces are then adjacent in memory.
+//
+// A block may be freed by any thread. A thread keeps at most two chunks worth
+// of free blocks per size class, further blocks go to a shared list, from
+// which the other threads take blocks before they cut a new chunk. When a
+// thread exits, its free blocks are handed over to the shared list.
+//
+// Each thread counts the blocks it allocates and frees, there is no shared
+// counter. When no block is in use any more, for example after a model has
+// been unloaded, all chunks except one per size class are given back. This is
+// checked when a thread returns blocks to the shared list, when it exits, and
+// by poolRelease. The threads are held at the entry of poolAllocate and
+// poolFree meanwhile, and free lists that point into released chunks are
+// dropped.
+//
+// Define CARVE_NO_POOL_ALLOCATION to allocate each object with operator new,
+// for example when checking with ASan or valgrind.
+
+namespace carve {
+
+void* poolAllocate(size_t size);
+void poolFree(void* ptr, size_t size);
+
+// gives all chunks except one per size class back if no block is in use
+void poolRelease();
+
+struct PoolStatistics {
+  size_t num_chunks = 0;
+  size_t chunk_bytes = 0;
+  size_t num_blocks_in_use = 0;
+};
+
+PoolStatistics poolStatistics();
+
+// Base class for objects that are allocated from the pool. Classes that
+// derive from it must not be deleted through a pointer to a base class
+// without virtual destructor, since the size is needed to free the block.
+class PoolAllocated {
+ public:
+#if !defined(CARVE_NO_POOL_ALLOCATION)
+  static void* operator new(size_t size) { return poolAllocate(size); }
+  static void operator delete(void* ptr, size_t size) { poolFree(ptr, size); }
+#endif
+};
+
+}  // namespace carve
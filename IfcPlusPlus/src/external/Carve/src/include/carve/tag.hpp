@@ -25,79 +25,82 @@
 #pragma once
 
 #include <carve/carve.hpp>
-#ifdef _OPENMP
-#include <omp.h>
-#include <iostream>
-#endif
+
+#include <atomic>
+#include <cstdint>
 
 namespace carve {
+	// Marks objects as visited during one pass of an algorithm. tag_begin() starts a new pass on the current thread, objects
+	// are then tagged with the epoch of that pass. Epochs are unique over all threads, so objects that were tagged by another
+	// thread, or by an earlier pass, never appear tagged. There is no limit on the number of threads, and no mapping of threads
+	// to slots. Objects must not be tagged by several threads at the same time, CSG operations running in parallel need their
+	// own copies of shared meshes.
 	class tagable {
 	private:
-		static int s_count[48];
+		static std::atomic<uint64_t> s_next_epoch;
 
-	protected:
-		mutable int __tag;
+		// epoch of the current pass of this thread. 0 marks untagged objects, it is replaced by a unique epoch on first use
+		static uint64_t currentEpoch()
+		{
+			uint64_t& epoch = threadEpoch();
+			if( epoch == 0 )
+			{
+				epoch = s_next_epoch.fetch_add(1, std::memory_order_relaxed);
+			}
+			return epoch;
+		}
 
-		static inline int getCurrentThreadNum()
+		static uint64_t& threadEpoch()
 		{
-			int threadNr = 0;
-#ifdef _OPENMP
-			threadNr = omp_get_thread_num();
-#endif
-			return threadNr;
+			thread_local uint64_t epoch = 0;
+			return epoch;
 		}
 
+	protected:
+		mutable uint64_t __tag;
+
 	public:
-		tagable(const tagable&)
+		tagable(const tagable&) : __tag(0)
 		{
-			int threadNr = getCurrentThreadNum();
-			__tag = s_count[threadNr] - 1;
 		}
 		tagable& operator=(const tagable&)
 		{
 			return *this;
 		}
 
-		tagable()
+		tagable() : __tag(0)
 		{
-			int threadNr = getCurrentThreadNum();
-			__tag = s_count[threadNr] - 1;
 		}
 
 		void tag() const
 		{
-			int threadNr = getCurrentThreadNum();
-			__tag = s_count[threadNr];
+			__tag = currentEpoch();
 		}
 
 		void untag() const
 		{
-			int threadNr = getCurrentThreadNum();
-			__tag = s_count[threadNr] - 1;
+			__tag = 0;
 		}
 
 		bool is_tagged() const
 		{
-			int threadNr = getCurrentThreadNum();
-			return __tag == s_count[threadNr];
+			return __tag == currentEpoch();
 		}
 
 		bool tag_once() const
 		{
-			int threadNr = getCurrentThreadNum();
-
-			if( __tag == s_count[threadNr] )
+			const uint64_t epoch = currentEpoch();
+			if( __tag == epoch )
 			{
 				return false;
 			}
-			__tag = s_count[threadNr];
+			__tag = epoch;
 			return true;
 		}
 
 		static void tag_begin()
 		{
-			int threadNr = getCurrentThreadNum();
-			s_count[threadNr]++;
+			threadEpoch() = s_next_epoch.fetch_add(1, std::memory_order_relaxed);
 		}
 	};
 }  // namespace carve
@@ -0,0 +1,123 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+// Lightweight event tracing.
+//
+// While tracing is disabled, a trace point costs one branch on a relaxed
+// atomic flag. Nothing is formatted or allocated. While it is enabled,
+// events are stored in binary form in a ring buffer per thread. They are
+// only formatted by writeChromeTrace, which produces a JSON file that can
+// be opened in chrome://tracing or ui.perfetto.dev.
+//
+// Event names are copied into the event, so they may also come from
+// temporary strings. Names longer than MAX_NAME_LENGTH are truncated.
+
+namespace carve {
+namespace trace {
+
+enum EventType : uint8_t {
+  EVENT_BEGIN,
+  EVENT_END,
+  EVENT_INSTANT,
+  EVENT_COUNTER
+};
+
+static const size_t MAX_NAME_LENGTH = 46;
+
+// 64 bytes, one cache line
+struct Event {
+  uint64_t time_ns;
+  int64_t value;
+  EventType type;
+  char name[MAX_NAME_LENGTH + 1];
+};
+
+extern std::atomic<bool> g_trace_enabled;
+
+inline bool isEnabled() {
+  return g_trace_enabled.load(std::memory_order_relaxed);
+}
+
+void setEnabled(bool enabled);
+
+// Number of events kept per thread. Applies to threads that record their
+// first event after the call.
+void setRingBufferSize(size_t num_events);
+
+void record(EventType type, const char* name, int64_t value);
+
+// Discards all recorded events. Should not be called while other threads are
+// recording.
+void clear();
+
+// Writes the recorded events in Chrome trace event format. Should be called
+// while no conversion is running, otherwise the newest events may be torn.
+void writeChromeTrace(std::ostream& out);
+bool writeChromeTrace(const std::string& file_name);
+
+// The end event has no name, it closes the last open begin event of the thread
+class Scope {
+ public:
+  Scope(const char* name, int64_t value) : m_recorded(false) {
+    if (isEnabled()) {
+      m_recorded = true;
+      record(EVENT_BEGIN, name, value);
+    }
+  }
+  ~Scope() {
+    if (m_recorded) {
+      record(EVENT_END, nullptr, 0);
+    }
+  }
+  Scope(const Scope&) = delete;
+  Scope& operator=(const Scope&) = delete;
+
+ private:
+  bool m_recorded;
+};
+
+}  // namespace trace
+}  // namespace carve
+
+#define CARVE_TRACE_CONCAT_INNER(a, b) a##b
+#define CARVE_TRACE_CONCAT(a, b) CARVE_TRACE_CONCAT_INNER(a, b)
+
+// Records the duration of the enclosing block. value is shown as argument of the event.
+#define CARVE_TRACE_SCOPE(name, value) \
+  carve::trace::Scope CARVE_TRACE_CONCAT(carve_trace_scope_, __LINE__)(name, carve::trace::isEnabled() ? (int64_t)(value) : 0)
+
+// Records a single point in time. value is only evaluated if tracing is enabled.
+#define CARVE_TRACE_EVENT(name, value)                                           \
+  do {                                                                           \
+    if (carve::trace::isEnabled()) {                                             \
+      carve::trace::record(carve::trace::EVENT_INSTANT, name, (int64_t)(value)); \
+    }                                                                            \
+  } while (0)
+
+#define CARVE_TRACE_COUNTER(name, value)                                         \
+  do {                                                                           \
+    if (carve::trace::isEnabled()) {                                             \
+      carve::trace::record(carve::trace::EVENT_COUNTER, name, (int64_t)(value)); \
+    }                                                                            \
+  } while (0)
@@ -44,6 +44,7 @@ bool IsPrintToDebugLogOn() { return LinuxDebugOn; }
 void printToDebugLogOn(bool on) { LinuxDebugOn = on; }
 void printToDebugLog(const char* funcName, std::string details)
 {
+	CARVE_TRACE_EVENT(funcName, 0);
 	return;
 	if (LinuxDebugOn)
 	{
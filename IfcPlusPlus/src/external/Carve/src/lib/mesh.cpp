@@ -25,6 +25,7 @@
 #if defined(HAVE_CONFIG_H)
 #include <carve_config.h>
 #endif
+#include <cstdint>
 #include <cstdio>
 #include <iostream>
 #include <carve/mesh.hpp>
@@ -313,36 +314,119 @@ namespace carve {
 				return false;
 			}
 
+			// Stable LSD radix sort of the edge records by the address of a vertex. Passes where all records have the same byte are skipped,
+			// which is the case for the upper bytes if the vertices come from one vertex storage.
+			template <typename key_func_t>
+			void FaceStitcher::radixSortEdgeRecords(std::vector<EdgeRecord>& records, std::vector<EdgeRecord>& temp, key_func_t key)
+			{
+				const size_t num_records = records.size();
+				temp.resize(num_records, records[0]);
+				for( size_t shift = 0; shift < sizeof(uintptr_t) * 8; shift += 8 )
+				{
+					size_t offsets[256] = { 0 };
+					for( size_t i = 0; i < num_records; ++i )
+					{
+						++offsets[(key(records[i]) >> shift) & 0xff];
+					}
+					if( offsets[(key(records[0]) >> shift) & 0xff] == num_records )
+					{
+						continue;
+					}
+
+					size_t sum = 0;
+					for( size_t b = 0; b < 256; ++b )
+					{
+						const size_t count = offsets[b];
+						offsets[b] = sum;
+						sum += count;
+					}
+					for( size_t i = 0; i < num_records; ++i )
+					{
+						temp[offsets[(key(records[i]) >> shift) & 0xff]++] = records[i];
+					}
+					records.swap(temp);
+				}
+			}
+
 			void FaceStitcher::matchSimpleEdges()
 			{
 				// join faces that share an edge, where no other faces are incident.
-				for( edge_map_t::iterator i = edges.begin(); i != edges.end(); ++i )
+				if( edge_records.empty() )
+				{
+					return;
+				}
+
+				// sort by (v_min, v_max). Since the sort is stable, edges with the same vertices stay in the order of the faces
+				std::vector<EdgeRecord> temp;
+				radixSortEdgeRecords(edge_records, temp, [](const EdgeRecord& r) { return reinterpret_cast<uintptr_t>(r.v_max); });
+				radixSortEdgeRecords(edge_records, temp, [](const EdgeRecord& r) { return reinterpret_cast<uintptr_t>(r.v_min); });
+				std::vector<EdgeRecord>().swap(temp);
+
+				const size_t num_records = edge_records.size();
+				size_t run_begin = 0;
+				while( run_begin < num_records )
 				{
-					const vpair_t& ev = (*i).first;
-					edge_map_t::iterator j = edges.find(vpair_t(ev.second, ev.first));
-					if( j == edges.end() )
+					const EdgeRecord& first = edge_records[run_begin];
+					size_t run_end = run_begin + 1;
+					size_t num_reversed = first.is_reversed ? 1 : 0;
+					while( run_end < num_records && edge_records[run_end].v_min == first.v_min && edge_records[run_end].v_max == first.v_max )
+					{
+						if( edge_records[run_end].is_reversed )
+						{
+							++num_reversed;
+						}
+						++run_end;
+					}
+					const size_t num_forward = run_end - run_begin - num_reversed;
+
+					if( first.v_min == first.v_max )
 					{
-						for( edgelist_t::iterator k = (*i).second.begin(); k != (*i).second.end(); ++k )
+						// degenerate edge, its own reverse
+						if( num_forward > 1 )
 						{
-							is_open[(*k)->face->id] = true;
+							edgelist_t& complex_list = complex_edges[vpair_t(first.v_min, first.v_max)];
+							for( size_t k = run_begin; k < run_end; ++k )
+							{
+								complex_list.push_back(edge_records[k].edge);
+							}
 						}
 					}
-					else if( (*i).second.size() != 1 || (*j).second.size() != 1 )
+					else if( num_forward == 0 || num_reversed == 0 )
 					{
-						std::swap(complex_edges[(*i).first], (*i).second);
+						for( size_t k = run_begin; k < run_end; ++k )
+						{
+							is_open[edge_records[k].edge->face->id] = true;
+						}
 					}
-					else {
+					else if( num_forward == 1 && num_reversed == 1 )
+					{
 						// simple edge.
-						edge_t* a = (*i).second.front();
-						edge_t* b = (*j).second.front();
-						if( a < b ) {
-							// every simple edge pair is encountered twice. only merge once.
-							a->rev = b;
-							b->rev = a;
-							face_groups.merge_sets(a->face->id, b->face->id);
+						edge_t* a = edge_records[run_begin].edge;
+						edge_t* b = edge_records[run_begin + 1].edge;
+						a->rev = b;
+						b->rev = a;
+						face_groups.merge_sets(a->face->id, b->face->id);
+					}
+					else
+					{
+						edgelist_t& complex_fwd = complex_edges[vpair_t(first.v_min, first.v_max)];
+						edgelist_t& complex_rev = complex_edges[vpair_t(first.v_max, first.v_min)];
+						for( size_t k = run_begin; k < run_end; ++k )
+						{
+							if( edge_records[k].is_reversed )
+							{
+								complex_rev.push_back(edge_records[k].edge);
+							}
+							else
+							{
+								complex_fwd.push_back(edge_records[k].edge);
+							}
 						}
 					}
+					run_begin = run_end;
 				}
+
+				std::vector<EdgeRecord>().swap(edge_records);
 			}
 
 			size_t FaceStitcher::faceGroupID(const Face<3>* face) {
@@ -0,0 +1,398 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <carve/pool_alloc.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace carve {
+
+namespace {
+
+const size_t GRANULARITY = 16;
+const size_t MAX_BLOCK_SIZE = 256;
+const size_t NUM_SIZE_CLASSES = MAX_BLOCK_SIZE / GRANULARITY;
+const size_t CHUNK_SIZE = 64 * 1024;
+// number of chunks per size class that are kept when the pool drains
+const size_t NUM_RETAINED_CHUNKS = 1;
+
+inline size_t sizeClass(size_t size) {
+  return size == 0 ? 0 : (size - 1) / GRANULARITY;
+}
+
+inline size_t blockSize(size_t size_class) {
+  return (size_class + 1) * GRANULARITY;
+}
+
+inline size_t blocksPerChunk(size_t size_class) {
+  return CHUNK_SIZE / blockSize(size_class);
+}
+
+struct FreeBlock {
+  FreeBlock* next;
+};
+
+struct FreeList {
+  FreeBlock* head = nullptr;
+  FreeBlock* tail = nullptr;
+  size_t count = 0;
+
+  bool empty() const { return head == nullptr; }
+
+  void push(FreeBlock* block) {
+    block->next = head;
+    head = block;
+    if (!tail) {
+      tail = block;
+    }
+    ++count;
+  }
+
+  FreeBlock* pop() {
+    FreeBlock* block = head;
+    head = block->next;
+    if (!head) {
+      tail = nullptr;
+    }
+    --count;
+    return block;
+  }
+
+  void append(FreeList& other) {
+    if (other.empty()) {
+      return;
+    }
+    if (tail) {
+      tail->next = other.head;
+    } else {
+      head = other.head;
+    }
+    tail = other.tail;
+    count += other.count;
+    other = FreeList();
+  }
+
+  // keeps the first num_keep blocks, num_keep > 0, and returns the others
+  FreeList splitAfter(size_t num_keep) {
+    FreeList rest;
+    if (num_keep >= count) {
+      return rest;
+    }
+    FreeBlock* last_kept = head;
+    for (size_t ii = 1; ii < num_keep; ++ii) {
+      last_kept = last_kept->next;
+    }
+    rest.head = last_kept->next;
+    rest.tail = tail;
+    rest.count = count - num_keep;
+    last_kept->next = nullptr;
+    tail = last_kept;
+    count = num_keep;
+    return rest;
+  }
+};
+
+// links all blocks of a chunk, in address order, so that they are handed out in that order
+FreeList linkChunk(char* chunk, size_t size_class) {
+  const size_t block_size = blockSize(size_class);
+  const size_t num_blocks = blocksPerChunk(size_class);
+  for (size_t ii = 0; ii + 1 < num_blocks; ++ii) {
+    reinterpret_cast<FreeBlock*>(chunk + ii * block_size)->next = reinterpret_cast<FreeBlock*>(chunk + (ii + 1) * block_size);
+  }
+  FreeList list;
+  list.head = reinterpret_cast<FreeBlock*>(chunk);
+  list.tail = reinterpret_cast<FreeBlock*>(chunk + (num_blocks - 1) * block_size);
+  list.tail->next = nullptr;
+  list.count = num_blocks;
+  return list;
+}
+
+struct ThreadPool;
+
+struct SharedPool {
+  std::mutex mutex;
+  std::vector<char*> chunks[NUM_SIZE_CLASSES];
+  FreeList free_lists[NUM_SIZE_CLASSES];
+  // pools of the running threads, for counting the blocks in use
+  std::vector<ThreadPool*> thread_pools;
+  // blocks counted by threads that have exited, and by allocations and frees after the pool of a thread was destroyed
+  ptrdiff_t num_live_blocks_of_exited_threads = 0;
+
+  // mutex must be locked
+  void addChunk(size_t size_class) {
+    char* chunk = static_cast<char*>(::operator new(CHUNK_SIZE));
+    chunks[size_class].push_back(chunk);
+    FreeList blocks = linkChunk(chunk, size_class);
+    free_lists[size_class].append(blocks);
+  }
+};
+
+SharedPool& sharedPool() {
+  // intentionally not destroyed: edges and faces of static objects may still be freed during shutdown.
+  // The chunks stay reachable through this object, so leak checkers do not report them
+  static SharedPool* pool = new SharedPool();
+  return *pool;
+}
+
+// Set by releaseIfDrained while it holds the mutex of the shared pool. Threads do not enter poolAllocate or
+// poolFree while it is set, so the chunks can be released without any thread holding a block of them
+std::atomic<bool> g_draining(false);
+
+// incremented when chunks have been released. Free lists of threads that were filled in an earlier epoch may point
+// into released chunks, so they are dropped instead of being used. Only changed while the shared mutex is locked
+std::atomic<size_t> g_epoch(0);
+
+void releaseIfDrained(SharedPool& shared);
+
+// set when the pool of this thread has been destroyed. Objects that are freed later, for example by
+// destructors of static objects, go directly to the shared pool
+thread_local bool t_thread_pool_destroyed = false;
+
+struct ThreadPool {
+  FreeList free_lists[NUM_SIZE_CLASSES];
+  size_t epoch = 0;
+  // blocks allocated minus blocks freed by this thread. Negative if it frees blocks of other threads. Written only by
+  // this thread, so that allocations do not contend on a shared counter, and read by releaseIfDrained
+  std::atomic<ptrdiff_t> num_live_blocks{0};
+  // set while the thread is inside poolAllocate or poolFree and uses its free lists
+  std::atomic<bool> active{false};
+
+  ThreadPool() {
+    SharedPool& shared = sharedPool();
+    std::lock_guard<std::mutex> lock(shared.mutex);
+    shared.thread_pools.push_back(this);
+    epoch = g_epoch.load();
+  }
+
+  ~ThreadPool() {
+    t_thread_pool_destroyed = true;
+    // hand the count and the free blocks over, so that the blocks can be reused by other threads
+    SharedPool& shared = sharedPool();
+    std::lock_guard<std::mutex> lock(shared.mutex);
+    shared.thread_pools.erase(std::find(shared.thread_pools.begin(), shared.thread_pools.end(), this));
+    shared.num_live_blocks_of_exited_threads += num_live_blocks.load();
+    if (epoch == g_epoch.load()) {
+      for (size_t ii = 0; ii < NUM_SIZE_CLASSES; ++ii) {
+        shared.free_lists[ii].append(free_lists[ii]);
+      }
+    }
+    releaseIfDrained(shared);
+  }
+
+  // marks the thread as active, waits while the pool drains, and drops the free lists if chunks were released
+  // since they were filled. Must not be called with the shared mutex locked
+  void enter() {
+    active.store(true);
+    while (g_draining.load()) {
+      // releaseIfDrained holds the mutex as long as g_draining is set
+      active.store(false);
+      { std::lock_guard<std::mutex> lock(sharedPool().mutex); }
+      active.store(true);
+    }
+    const size_t current_epoch = g_epoch.load(std::memory_order_relaxed);
+    if (current_epoch != epoch) {
+      for (size_t ii = 0; ii < NUM_SIZE_CLASSES; ++ii) {
+        free_lists[ii] = FreeList();
+      }
+      epoch = current_epoch;
+    }
+  }
+
+  void leave() {
+    active.store(false, std::memory_order_release);
+  }
+
+  void count(ptrdiff_t delta) {
+    num_live_blocks.store(num_live_blocks.load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);
+  }
+};
+
+ThreadPool& threadPool() {
+  thread_local ThreadPool pool;
+  return pool;
+}
+
+// mutex must be locked. Exact only while no thread is inside poolAllocate or poolFree
+ptrdiff_t countLiveBlocks(SharedPool& shared) {
+  ptrdiff_t num_live_blocks = shared.num_live_blocks_of_exited_threads;
+  for (ThreadPool* pool : shared.thread_pools) {
+    num_live_blocks += pool->num_live_blocks.load(std::memory_order_relaxed);
+  }
+  return num_live_blocks;
+}
+
+// Mutex must be locked. If no block is in use, all chunks except a few are given back, and the free lists are
+// rebuilt from the remaining chunks
+void releaseIfDrained(SharedPool& shared) {
+  if (countLiveBlocks(shared) != 0) {
+    return;
+  }
+
+  // Threads that enter poolAllocate or poolFree from now on wait for the mutex. Once the threads that are inside
+  // have left, the counts do not change any more and are exact
+  g_draining.store(true);
+  for (ThreadPool* pool : shared.thread_pools) {
+    while (pool->active.load()) {
+      std::this_thread::yield();
+    }
+  }
+
+  if (countLiveBlocks(shared) == 0) {
+    for (size_t ii = 0; ii < NUM_SIZE_CLASSES; ++ii) {
+      std::vector<char*>& chunks = shared.chunks[ii];
+      for (size_t jj = NUM_RETAINED_CHUNKS; jj < chunks.size(); ++jj) {
+        ::operator delete(chunks[jj]);
+      }
+      if (chunks.size() > NUM_RETAINED_CHUNKS) {
+        chunks.resize(NUM_RETAINED_CHUNKS);
+      }
+      shared.free_lists[ii] = FreeList();
+      for (char* chunk : chunks) {
+        FreeList blocks = linkChunk(chunk, ii);
+        shared.free_lists[ii].append(blocks);
+      }
+    }
+    g_epoch.fetch_add(1);
+  }
+  g_draining.store(false);
+}
+
+// takes up to max_count free blocks from the shared pool, or from a new chunk if there are none. Returns the epoch
+// in which they were taken
+size_t takeBlocks(size_t size_class, size_t max_count, FreeList& taken) {
+  SharedPool& shared = sharedPool();
+  std::lock_guard<std::mutex> lock(shared.mutex);
+  FreeList& shared_list = shared.free_lists[size_class];
+  if (shared_list.empty()) {
+    shared.addChunk(size_class);
+  }
+  taken = shared_list;
+  shared_list = taken.splitAfter(max_count);
+  return g_epoch.load();
+}
+
+// puts a list of free blocks from the given epoch back into the shared pool, so that other threads can reuse them
+void returnBlocks(size_t size_class, FreeList& list, size_t epoch) {
+  SharedPool& shared = sharedPool();
+  std::lock_guard<std::mutex> lock(shared.mutex);
+  if (epoch == g_epoch.load()) {
+    shared.free_lists[size_class].append(list);
+  }
+  releaseIfDrained(shared);
+}
+
+}  // namespace
+
+void* poolAllocate(size_t size) {
+  if (size > MAX_BLOCK_SIZE) {
+    return ::operator new(size);
+  }
+
+  const size_t size_class = sizeClass(size);
+  if (t_thread_pool_destroyed) {
+    SharedPool& shared = sharedPool();
+    std::lock_guard<std::mutex> lock(shared.mutex);
+    if (shared.free_lists[size_class].empty()) {
+      shared.addChunk(size_class);
+    }
+    ++shared.num_live_blocks_of_exited_threads;
+    return shared.free_lists[size_class].pop();
+  }
+
+  ThreadPool& pool = threadPool();
+  pool.enter();
+  FreeList& list = pool.free_lists[size_class];
+  while (list.empty()) {
+    // the mutex is not locked while the thread is active, so the blocks are taken outside
+    pool.leave();
+    FreeList taken;
+    const size_t epoch = takeBlocks(size_class, blocksPerChunk(size_class), taken);
+    pool.enter();
+    if (epoch == pool.epoch) {
+      list.append(taken);
+    }
+  }
+  void* block = list.pop();
+  pool.count(1);
+  pool.leave();
+  return block;
+}
+
+void poolFree(void* ptr, size_t size) {
+  if (!ptr) {
+    return;
+  }
+  if (size > MAX_BLOCK_SIZE) {
+    ::operator delete(ptr);
+    return;
+  }
+
+  const size_t size_class = sizeClass(size);
+  FreeBlock* block = static_cast<FreeBlock*>(ptr);
+  if (t_thread_pool_destroyed) {
+    SharedPool& shared = sharedPool();
+    std::lock_guard<std::mutex> lock(shared.mutex);
+    shared.free_lists[size_class].push(block);
+    --shared.num_live_blocks_of_exited_threads;
+    return;
+  }
+
+  ThreadPool& pool = threadPool();
+  pool.enter();
+  FreeList& list = pool.free_lists[size_class];
+  list.push(block);
+  pool.count(-1);
+
+  // Meshes are often freed by another thread than the one that created them. A thread keeps at most two
+  // chunks worth of free blocks, the others go to the shared pool, where the creating threads find them
+  const size_t max_blocks = 2 * blocksPerChunk(size_class);
+  FreeList surplus;
+  if (list.count > max_blocks) {
+    surplus = list.splitAfter(max_blocks / 2);
+  }
+  const size_t epoch = pool.epoch;
+  pool.leave();
+
+  if (!surplus.empty()) {
+    // also checks whether the pool has drained, which is the case after a model has been unloaded
+    returnBlocks(size_class, surplus, epoch);
+  }
+}
+
+void poolRelease() {
+  SharedPool& shared = sharedPool();
+  std::lock_guard<std::mutex> lock(shared.mutex);
+  releaseIfDrained(shared);
+}
+
+PoolStatistics poolStatistics() {
+  SharedPool& shared = sharedPool();
+  std::lock_guard<std::mutex> lock(shared.mutex);
+  PoolStatistics stats;
+  for (size_t ii = 0; ii < NUM_SIZE_CLASSES; ++ii) {
+    stats.num_chunks += shared.chunks[ii].size();
+  }
+  stats.chunk_bytes = stats.num_chunks * CHUNK_SIZE;
+  stats.num_blocks_in_use = size_t(countLiveBlocks(shared));
+  return stats;
+}
+
+}  // namespace carve
@@ -28,4 +28,4 @@
 
 #include <carve/tag.hpp>
 
-int carve::tagable::s_count[48] = { 0,0,0,0,0,  0,0,0,0,0,  0,0,0,0,0,  0,0,0,0,0,  0,0,0,0,0,  0,0,0,0,0,  0,0,0,0,0, 0,0,0,0,0,  0,0,0,0,0,  0,0,0 };
+std::atomic<uint64_t> carve::tagable::s_next_epoch(1);
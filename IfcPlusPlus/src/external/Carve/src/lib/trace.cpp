@@ -0,0 +1,164 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <carve/trace.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace carve {
+namespace trace {
+
+std::atomic<bool> g_trace_enabled(false);
+
+namespace {
+
+struct ThreadBuffer {
+  std::vector<Event> events;
+  std::atomic<size_t> num_recorded{ 0 };  // total number of events, the ring keeps the last events.size()
+  uint32_t thread_id = 0;
+};
+
+std::mutex g_registry_mutex;
+std::vector<std::shared_ptr<ThreadBuffer> > g_buffers;
+size_t g_ring_buffer_size = 1 << 16;
+uint32_t g_next_thread_id = 1;
+const std::chrono::steady_clock::time_point g_epoch = std::chrono::steady_clock::now();
+
+ThreadBuffer& threadBuffer() {
+  // the registry keeps the buffer alive after the thread exits, so its events can still be written out
+  thread_local std::shared_ptr<ThreadBuffer> buffer;
+  if (!buffer) {
+    std::shared_ptr<ThreadBuffer> new_buffer = std::make_shared<ThreadBuffer>();
+    std::lock_guard<std::mutex> lock(g_registry_mutex);
+    new_buffer->events.resize(g_ring_buffer_size > 0 ? g_ring_buffer_size : 1);
+    new_buffer->thread_id = g_next_thread_id++;
+    g_buffers.push_back(new_buffer);
+    buffer = new_buffer;
+  }
+  return *buffer;
+}
+
+void writeJsonString(std::ostream& out, const char* str) {
+  out << '"';
+  for (const char* c = str; *c; ++c) {
+    if (*c == '"' || *c == '\\') {
+      out << '\\' << *c;
+    } else if ((unsigned char)*c < 0x20) {
+      char escaped[8];
+      std::snprintf(escaped, sizeof(escaped), "\\u%04x", (unsigned char)*c);
+      out << escaped;
+    } else {
+      out << *c;
+    }
+  }
+  out << '"';
+}
+
+}  // namespace
+
+void setEnabled(bool enabled) {
+  g_trace_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+void setRingBufferSize(size_t num_events) {
+  std::lock_guard<std::mutex> lock(g_registry_mutex);
+  g_ring_buffer_size = num_events;
+}
+
+void record(EventType type, const char* name, int64_t value) {
+  ThreadBuffer& buffer = threadBuffer();
+  size_t index = buffer.num_recorded.load(std::memory_order_relaxed);
+  Event& event = buffer.events[index % buffer.events.size()];
+  event.time_ns = (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+                      std::chrono::steady_clock::now() - g_epoch)
+                      .count();
+  event.value = value;
+  event.type = type;
+  size_t length = 0;
+  if (name) {
+    for (; length < MAX_NAME_LENGTH && name[length]; ++length) {
+      event.name[length] = name[length];
+    }
+  }
+  event.name[length] = '\0';
+  buffer.num_recorded.store(index + 1, std::memory_order_release);
+}
+
+void clear() {
+  std::lock_guard<std::mutex> lock(g_registry_mutex);
+  for (auto& buffer : g_buffers) {
+    buffer->num_recorded.store(0, std::memory_order_release);
+  }
+}
+
+void writeChromeTrace(std::ostream& out) {
+  std::lock_guard<std::mutex> lock(g_registry_mutex);
+  out << "{\"traceEvents\":[";
+  bool first = true;
+  for (auto& buffer : g_buffers) {
+    const size_t capacity = buffer->events.size();
+    const size_t num_recorded = buffer->num_recorded.load(std::memory_order_acquire);
+    const size_t begin = num_recorded > capacity ? num_recorded - capacity : 0;
+    for (size_t ii = begin; ii < num_recorded; ++ii) {
+      const Event& event = buffer->events[ii % capacity];
+      char timestamp[32];
+      std::snprintf(timestamp, sizeof(timestamp), "%.3f", (double)event.time_ns / 1000.0);
+
+      out << (first ? "\n" : ",\n") << "{";
+      if (event.type != EVENT_END) {
+        out << "\"name\":";
+        writeJsonString(out, event.name);
+        out << ",";
+      }
+      out << "\"pid\":1,\"tid\":" << buffer->thread_id << ",\"ts\":" << timestamp;
+      switch (event.type) {
+        case EVENT_BEGIN:
+          out << ",\"ph\":\"B\",\"args\":{\"value\":" << event.value << "}";
+          break;
+        case EVENT_END:
+          out << ",\"ph\":\"E\"";
+          break;
+        case EVENT_INSTANT:
+          out << ",\"ph\":\"i\",\"s\":\"t\",\"args\":{\"value\":" << event.value << "}";
+          break;
+        case EVENT_COUNTER:
+          out << ",\"ph\":\"C\",\"args\":{\"value\":" << event.value << "}";
+          break;
+      }
+      out << "}";
+      first = false;
+    }
+  }
+  out << "\n]}\n";
+}
+
+bool writeChromeTrace(const std::string& file_name) {
+  std::ofstream out(file_name, std::ios::trunc);
+  if (!out) {
+    return false;
+  }
+  writeChromeTrace(out);
+  return (bool)out;
+}
+
+}  // namespace trace
+}  // namespace carve
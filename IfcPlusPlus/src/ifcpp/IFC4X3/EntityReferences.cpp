@@ -0,0 +1,4959 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ifcpp/IFC4X3/EntityFactory.h"
+#include "ifcpp/IFC4X3/EntityReferences.h"
+#include "ifcpp/IFC4X3/TypeFactory.h"
+#include "ifcpp/IFC4X3/include/IfcActor.h"
+#include "ifcpp/IFC4X3/include/IfcActorRole.h"
+#include "ifcpp/IFC4X3/include/IfcActorSelect.h"
+#include "ifcpp/IFC4X3/include/IfcAddress.h"
+#include "ifcpp/IFC4X3/include/IfcAdvancedBrepWithVoids.h"
+#include "ifcpp/IFC4X3/include/IfcAlignmentHorizontalSegment.h"
+#include "ifcpp/IFC4X3/include/IfcAlignmentParameterSegment.h"
+#include "ifcpp/IFC4X3/include/IfcAlignmentSegment.h"
+#include "ifcpp/IFC4X3/include/IfcAnnotation.h"
+#include "ifcpp/IFC4X3/include/IfcAnnotationFillArea.h"
+#include "ifcpp/IFC4X3/include/IfcApplication.h"
+#include "ifcpp/IFC4X3/include/IfcAppliedValue.h"
+#include "ifcpp/IFC4X3/include/IfcAppliedValueSelect.h"
+#include "ifcpp/IFC4X3/include/IfcApproval.h"
+#include "ifcpp/IFC4X3/include/IfcApprovalRelationship.h"
+#include "ifcpp/IFC4X3/include/IfcArbitraryClosedProfileDef.h"
+#include "ifcpp/IFC4X3/include/IfcArbitraryOpenProfileDef.h"
+#include "ifcpp/IFC4X3/include/IfcArbitraryProfileDefWithVoids.h"
+#include "ifcpp/IFC4X3/include/IfcAsset.h"
+#include "ifcpp/IFC4X3/include/IfcAxis1Placement.h"
+#include "ifcpp/IFC4X3/include/IfcAxis2Placement.h"
+#include "ifcpp/IFC4X3/include/IfcAxis2Placement2D.h"
+#include "ifcpp/IFC4X3/include/IfcAxis2Placement3D.h"
+#include "ifcpp/IFC4X3/include/IfcAxis2PlacementLinear.h"
+#include "ifcpp/IFC4X3/include/IfcBSplineCurve.h"
+#include "ifcpp/IFC4X3/include/IfcBSplineSurface.h"
+#include "ifcpp/IFC4X3/include/IfcBooleanOperand.h"
+#include "ifcpp/IFC4X3/include/IfcBooleanResult.h"
+#include "ifcpp/IFC4X3/include/IfcBoundaryCondition.h"
+#include "ifcpp/IFC4X3/include/IfcBoundaryCurve.h"
+#include "ifcpp/IFC4X3/include/IfcBoundedCurve.h"
+#include "ifcpp/IFC4X3/include/IfcBoundingBox.h"
+#include "ifcpp/IFC4X3/include/IfcBoxedHalfSpace.h"
+#include "ifcpp/IFC4X3/include/IfcBuilding.h"
+#include "ifcpp/IFC4X3/include/IfcCartesianPoint.h"
+#include "ifcpp/IFC4X3/include/IfcCartesianPointList.h"
+#include "ifcpp/IFC4X3/include/IfcCartesianPointList3D.h"
+#include "ifcpp/IFC4X3/include/IfcCartesianTransformationOperator.h"
+#include "ifcpp/IFC4X3/include/IfcCartesianTransformationOperator2D.h"
+#include "ifcpp/IFC4X3/include/IfcCartesianTransformationOperator3D.h"
+#include "ifcpp/IFC4X3/include/IfcClassification.h"
+#include "ifcpp/IFC4X3/include/IfcClassificationReference.h"
+#include "ifcpp/IFC4X3/include/IfcClassificationReferenceSelect.h"
+#include "ifcpp/IFC4X3/include/IfcClassificationSelect.h"
+#include "ifcpp/IFC4X3/include/IfcClosedShell.h"
+#include "ifcpp/IFC4X3/include/IfcColour.h"
+#include "ifcpp/IFC4X3/include/IfcColourOrFactor.h"
+#include "ifcpp/IFC4X3/include/IfcColourRgb.h"
+#include "ifcpp/IFC4X3/include/IfcColourRgbList.h"
+#include "ifcpp/IFC4X3/include/IfcComplexProperty.h"
+#include "ifcpp/IFC4X3/include/IfcComplexPropertyTemplate.h"
+#include "ifcpp/IFC4X3/include/IfcCompositeCurve.h"
+#include "ifcpp/IFC4X3/include/IfcCompositeCurveSegment.h"
+#include "ifcpp/IFC4X3/include/IfcCompositeProfileDef.h"
+#include "ifcpp/IFC4X3/include/IfcConic.h"
+#include "ifcpp/IFC4X3/include/IfcConnectedFaceSet.h"
+#include "ifcpp/IFC4X3/include/IfcConnectionCurveGeometry.h"
+#include "ifcpp/IFC4X3/include/IfcConnectionGeometry.h"
+#include "ifcpp/IFC4X3/include/IfcConnectionPointGeometry.h"
+#include "ifcpp/IFC4X3/include/IfcConnectionSurfaceGeometry.h"
+#include "ifcpp/IFC4X3/include/IfcConnectionVolumeGeometry.h"
+#include "ifcpp/IFC4X3/include/IfcConstraint.h"
+#include "ifcpp/IFC4X3/include/IfcConstructionResource.h"
+#include "ifcpp/IFC4X3/include/IfcConstructionResourceType.h"
+#include "ifcpp/IFC4X3/include/IfcContext.h"
+#include "ifcpp/IFC4X3/include/IfcContextDependentUnit.h"
+#include "ifcpp/IFC4X3/include/IfcControl.h"
+#include "ifcpp/IFC4X3/include/IfcConversionBasedUnit.h"
+#include "ifcpp/IFC4X3/include/IfcCoordinateOperation.h"
+#include "ifcpp/IFC4X3/include/IfcCoordinateReferenceSystem.h"
+#include "ifcpp/IFC4X3/include/IfcCoordinateReferenceSystemSelect.h"
+#include "ifcpp/IFC4X3/include/IfcCostItem.h"
+#include "ifcpp/IFC4X3/include/IfcCostValue.h"
+#include "ifcpp/IFC4X3/include/IfcCovering.h"
+#include "ifcpp/IFC4X3/include/IfcCsgPrimitive3D.h"
+#include "ifcpp/IFC4X3/include/IfcCsgSelect.h"
+#include "ifcpp/IFC4X3/include/IfcCsgSolid.h"
+#include "ifcpp/IFC4X3/include/IfcCurrencyRelationship.h"
+#include "ifcpp/IFC4X3/include/IfcCurve.h"
+#include "ifcpp/IFC4X3/include/IfcCurveBoundedPlane.h"
+#include "ifcpp/IFC4X3/include/IfcCurveBoundedSurface.h"
+#include "ifcpp/IFC4X3/include/IfcCurveFontOrScaledCurveFontSelect.h"
+#include "ifcpp/IFC4X3/include/IfcCurveOrEdgeCurve.h"
+#include "ifcpp/IFC4X3/include/IfcCurveSegment.h"
+#include "ifcpp/IFC4X3/include/IfcCurveStyle.h"
+#include "ifcpp/IFC4X3/include/IfcCurveStyleFont.h"
+#include "ifcpp/IFC4X3/include/IfcCurveStyleFontAndScaling.h"
+#include "ifcpp/IFC4X3/include/IfcCurveStyleFontPattern.h"
+#include "ifcpp/IFC4X3/include/IfcCurveStyleFontSelect.h"
+#include "ifcpp/IFC4X3/include/IfcDefinitionSelect.h"
+#include "ifcpp/IFC4X3/include/IfcDerivedProfileDef.h"
+#include "ifcpp/IFC4X3/include/IfcDerivedUnit.h"
+#include "ifcpp/IFC4X3/include/IfcDerivedUnitElement.h"
+#include "ifcpp/IFC4X3/include/IfcDimensionalExponents.h"
+#include "ifcpp/IFC4X3/include/IfcDirection.h"
+#include "ifcpp/IFC4X3/include/IfcDirectrixCurveSweptAreaSolid.h"
+#include "ifcpp/IFC4X3/include/IfcDistributionControlElement.h"
+#include "ifcpp/IFC4X3/include/IfcDistributionElement.h"
+#include "ifcpp/IFC4X3/include/IfcDistributionFlowElement.h"
+#include "ifcpp/IFC4X3/include/IfcDocumentInformation.h"
+#include "ifcpp/IFC4X3/include/IfcDocumentInformationRelationship.h"
+#include "ifcpp/IFC4X3/include/IfcDocumentReference.h"
+#include "ifcpp/IFC4X3/include/IfcDocumentSelect.h"
+#include "ifcpp/IFC4X3/include/IfcDoorLiningProperties.h"
+#include "ifcpp/IFC4X3/include/IfcDoorPanelProperties.h"
+#include "ifcpp/IFC4X3/include/IfcEdge.h"
+#include "ifcpp/IFC4X3/include/IfcEdgeCurve.h"
+#include "ifcpp/IFC4X3/include/IfcEdgeLoop.h"
+#include "ifcpp/IFC4X3/include/IfcElement.h"
+#include "ifcpp/IFC4X3/include/IfcElementQuantity.h"
+#include "ifcpp/IFC4X3/include/IfcElementarySurface.h"
+#include "ifcpp/IFC4X3/include/IfcEvent.h"
+#include "ifcpp/IFC4X3/include/IfcEventTime.h"
+#include "ifcpp/IFC4X3/include/IfcExtendedProperties.h"
+#include "ifcpp/IFC4X3/include/IfcExternalReference.h"
+#include "ifcpp/IFC4X3/include/IfcExternalReferenceRelationship.h"
+#include "ifcpp/IFC4X3/include/IfcExternalSpatialElement.h"
+#include "ifcpp/IFC4X3/include/IfcExtrudedAreaSolid.h"
+#include "ifcpp/IFC4X3/include/IfcExtrudedAreaSolidTapered.h"
+#include "ifcpp/IFC4X3/include/IfcFace.h"
+#include "ifcpp/IFC4X3/include/IfcFaceBasedSurfaceModel.h"
+#include "ifcpp/IFC4X3/include/IfcFaceBound.h"
+#include "ifcpp/IFC4X3/include/IfcFaceSurface.h"
+#include "ifcpp/IFC4X3/include/IfcFacetedBrepWithVoids.h"
+#include "ifcpp/IFC4X3/include/IfcFeatureElementAddition.h"
+#include "ifcpp/IFC4X3/include/IfcFeatureElementSubtraction.h"
+#include "ifcpp/IFC4X3/include/IfcFillAreaStyle.h"
+#include "ifcpp/IFC4X3/include/IfcFillAreaStyleHatching.h"
+#include "ifcpp/IFC4X3/include/IfcFillAreaStyleTiles.h"
+#include "ifcpp/IFC4X3/include/IfcFillStyleSelect.h"
+#include "ifcpp/IFC4X3/include/IfcFixedReferenceSweptAreaSolid.h"
+#include "ifcpp/IFC4X3/include/IfcGeographicCRS.h"
+#include "ifcpp/IFC4X3/include/IfcGeometricRepresentationContext.h"
+#include "ifcpp/IFC4X3/include/IfcGeometricRepresentationSubContext.h"
+#include "ifcpp/IFC4X3/include/IfcGeometricSet.h"
+#include "ifcpp/IFC4X3/include/IfcGeometricSetSelect.h"
+#include "ifcpp/IFC4X3/include/IfcGradientCurve.h"
+#include "ifcpp/IFC4X3/include/IfcGrid.h"
+#include "ifcpp/IFC4X3/include/IfcGridAxis.h"
+#include "ifcpp/IFC4X3/include/IfcGridPlacement.h"
+#include "ifcpp/IFC4X3/include/IfcGridPlacementDirectionSelect.h"
+#include "ifcpp/IFC4X3/include/IfcGroup.h"
+#include "ifcpp/IFC4X3/include/IfcHalfSpaceSolid.h"
+#include "ifcpp/IFC4X3/include/IfcHatchLineDistanceSelect.h"
+#include "ifcpp/IFC4X3/include/IfcIndexedColourMap.h"
+#include "ifcpp/IFC4X3/include/IfcIndexedPolyCurve.h"
+#include "ifcpp/IFC4X3/include/IfcIndexedPolygonalFace.h"
+#include "ifcpp/IFC4X3/include/IfcIndexedPolygonalTextureMap.h"
+#include "ifcpp/IFC4X3/include/IfcIndexedTextureMap.h"
+#include "ifcpp/IFC4X3/include/IfcInterferenceSelect.h"
+#include "ifcpp/IFC4X3/include/IfcInventory.h"
+#include "ifcpp/IFC4X3/include/IfcIrregularTimeSeries.h"
+#include "ifcpp/IFC4X3/include/IfcIrregularTimeSeriesValue.h"
+#include "ifcpp/IFC4X3/include/IfcLagTime.h"
+#include "ifcpp/IFC4X3/include/IfcLayeredItem.h"
+#include "ifcpp/IFC4X3/include/IfcLibraryInformation.h"
+#include "ifcpp/IFC4X3/include/IfcLibraryReference.h"
+#include "ifcpp/IFC4X3/include/IfcLibrarySelect.h"
+#include "ifcpp/IFC4X3/include/IfcLightDistributionData.h"
+#include "ifcpp/IFC4X3/include/IfcLightDistributionDataSourceSelect.h"
+#include "ifcpp/IFC4X3/include/IfcLightIntensityDistribution.h"
+#include "ifcpp/IFC4X3/include/IfcLightSource.h"
+#include "ifcpp/IFC4X3/include/IfcLightSourceDirectional.h"
+#include "ifcpp/IFC4X3/include/IfcLightSourceGoniometric.h"
+#include "ifcpp/IFC4X3/include/IfcLightSourcePositional.h"
+#include "ifcpp/IFC4X3/include/IfcLightSourceSpot.h"
+#include "ifcpp/IFC4X3/include/IfcLine.h"
+#include "ifcpp/IFC4X3/include/IfcLinearPlacement.h"
+#include "ifcpp/IFC4X3/include/IfcLocalPlacement.h"
+#include "ifcpp/IFC4X3/include/IfcLoop.h"
+#include "ifcpp/IFC4X3/include/IfcManifoldSolidBrep.h"
+#include "ifcpp/IFC4X3/include/IfcMappedItem.h"
+#include "ifcpp/IFC4X3/include/IfcMaterial.h"
+#include "ifcpp/IFC4X3/include/IfcMaterialClassificationRelationship.h"
+#include "ifcpp/IFC4X3/include/IfcMaterialConstituent.h"
+#include "ifcpp/IFC4X3/include/IfcMaterialConstituentSet.h"
+#include "ifcpp/IFC4X3/include/IfcMaterialDefinition.h"
+#include "ifcpp/IFC4X3/include/IfcMaterialDefinitionRepresentation.h"
+#include "ifcpp/IFC4X3/include/IfcMaterialLayer.h"
+#include "ifcpp/IFC4X3/include/IfcMaterialLayerSet.h"
+#include "ifcpp/IFC4X3/include/IfcMaterialLayerSetUsage.h"
+#include "ifcpp/IFC4X3/include/IfcMaterialList.h"
+#include "ifcpp/IFC4X3/include/IfcMaterialProfile.h"
+#include "ifcpp/IFC4X3/include/IfcMaterialProfileSet.h"
+#include "ifcpp/IFC4X3/include/IfcMaterialProfileSetUsage.h"
+#include "ifcpp/IFC4X3/include/IfcMaterialProfileSetUsageTapering.h"
+#include "ifcpp/IFC4X3/include/IfcMaterialProperties.h"
+#include "ifcpp/IFC4X3/include/IfcMaterialRelationship.h"
+#include "ifcpp/IFC4X3/include/IfcMaterialSelect.h"
+#include "ifcpp/IFC4X3/include/IfcMaterialUsageDefinition.h"
+#include "ifcpp/IFC4X3/include/IfcMeasureWithUnit.h"
+#include "ifcpp/IFC4X3/include/IfcMetric.h"
+#include "ifcpp/IFC4X3/include/IfcMetricValueSelect.h"
+#include "ifcpp/IFC4X3/include/IfcMonetaryUnit.h"
+#include "ifcpp/IFC4X3/include/IfcNamedUnit.h"
+#include "ifcpp/IFC4X3/include/IfcObject.h"
+#include "ifcpp/IFC4X3/include/IfcObjectDefinition.h"
+#include "ifcpp/IFC4X3/include/IfcObjectPlacement.h"
+#include "ifcpp/IFC4X3/include/IfcObjectReferenceSelect.h"
+#include "ifcpp/IFC4X3/include/IfcObjective.h"
+#include "ifcpp/IFC4X3/include/IfcOffsetCurve.h"
+#include "ifcpp/IFC4X3/include/IfcOffsetCurve3D.h"
+#include "ifcpp/IFC4X3/include/IfcOffsetCurveByDistances.h"
+#include "ifcpp/IFC4X3/include/IfcOpenCrossProfileDef.h"
+#include "ifcpp/IFC4X3/include/IfcOpeningElement.h"
+#include "ifcpp/IFC4X3/include/IfcOrganization.h"
+#include "ifcpp/IFC4X3/include/IfcOrganizationRelationship.h"
+#include "ifcpp/IFC4X3/include/IfcOrientedEdge.h"
+#include "ifcpp/IFC4X3/include/IfcOwnerHistory.h"
+#include "ifcpp/IFC4X3/include/IfcParameterizedProfileDef.h"
+#include "ifcpp/IFC4X3/include/IfcPath.h"
+#include "ifcpp/IFC4X3/include/IfcPcurve.h"
+#include "ifcpp/IFC4X3/include/IfcPermeableCoveringProperties.h"
+#include "ifcpp/IFC4X3/include/IfcPerson.h"
+#include "ifcpp/IFC4X3/include/IfcPersonAndOrganization.h"
+#include "ifcpp/IFC4X3/include/IfcPhysicalComplexQuantity.h"
+#include "ifcpp/IFC4X3/include/IfcPhysicalQuantity.h"
+#include "ifcpp/IFC4X3/include/IfcPhysicalSimpleQuantity.h"
+#include "ifcpp/IFC4X3/include/IfcPlacement.h"
+#include "ifcpp/IFC4X3/include/IfcPlanarBox.h"
+#include "ifcpp/IFC4X3/include/IfcPlanarExtent.h"
+#include "ifcpp/IFC4X3/include/IfcPlane.h"
+#include "ifcpp/IFC4X3/include/IfcPoint.h"
+#include "ifcpp/IFC4X3/include/IfcPointByDistanceExpression.h"
+#include "ifcpp/IFC4X3/include/IfcPointOnCurve.h"
+#include "ifcpp/IFC4X3/include/IfcPointOnSurface.h"
+#include "ifcpp/IFC4X3/include/IfcPointOrVertexPoint.h"
+#include "ifcpp/IFC4X3/include/IfcPolyLoop.h"
+#include "ifcpp/IFC4X3/include/IfcPolygonalBoundedHalfSpace.h"
+#include "ifcpp/IFC4X3/include/IfcPolygonalFaceSet.h"
+#include "ifcpp/IFC4X3/include/IfcPolyline.h"
+#include "ifcpp/IFC4X3/include/IfcPolynomialCurve.h"
+#include "ifcpp/IFC4X3/include/IfcPort.h"
+#include "ifcpp/IFC4X3/include/IfcPositioningElement.h"
+#include "ifcpp/IFC4X3/include/IfcPostalAddress.h"
+#include "ifcpp/IFC4X3/include/IfcPresentationLayerAssignment.h"
+#include "ifcpp/IFC4X3/include/IfcPresentationLayerWithStyle.h"
+#include "ifcpp/IFC4X3/include/IfcPresentationStyle.h"
+#include "ifcpp/IFC4X3/include/IfcPresentationStyleAssignment.h"
+#include "ifcpp/IFC4X3/include/IfcProcess.h"
+#include "ifcpp/IFC4X3/include/IfcProcessSelect.h"
+#include "ifcpp/IFC4X3/include/IfcProduct.h"
+#include "ifcpp/IFC4X3/include/IfcProductDefinitionShape.h"
+#include "ifcpp/IFC4X3/include/IfcProductRepresentation.h"
+#include "ifcpp/IFC4X3/include/IfcProductRepresentationSelect.h"
+#include "ifcpp/IFC4X3/include/IfcProductSelect.h"
+#include "ifcpp/IFC4X3/include/IfcProfileDef.h"
+#include "ifcpp/IFC4X3/include/IfcProfileProperties.h"
+#include "ifcpp/IFC4X3/include/IfcProjectedCRS.h"
+#include "ifcpp/IFC4X3/include/IfcProperty.h"
+#include "ifcpp/IFC4X3/include/IfcPropertyAbstraction.h"
+#include "ifcpp/IFC4X3/include/IfcPropertyBoundedValue.h"
+#include "ifcpp/IFC4X3/include/IfcPropertyDefinition.h"
+#include "ifcpp/IFC4X3/include/IfcPropertyDependencyRelationship.h"
+#include "ifcpp/IFC4X3/include/IfcPropertyEnumeratedValue.h"
+#include "ifcpp/IFC4X3/include/IfcPropertyEnumeration.h"
+#include "ifcpp/IFC4X3/include/IfcPropertyListValue.h"
+#include "ifcpp/IFC4X3/include/IfcPropertyReferenceValue.h"
+#include "ifcpp/IFC4X3/include/IfcPropertySet.h"
+#include "ifcpp/IFC4X3/include/IfcPropertySetDefinition.h"
+#include "ifcpp/IFC4X3/include/IfcPropertySetDefinitionSelect.h"
+#include "ifcpp/IFC4X3/include/IfcPropertySetDefinitionSet.h"
+#include "ifcpp/IFC4X3/include/IfcPropertySetTemplate.h"
+#include "ifcpp/IFC4X3/include/IfcPropertySingleValue.h"
+#include "ifcpp/IFC4X3/include/IfcPropertyTableValue.h"
+#include "ifcpp/IFC4X3/include/IfcPropertyTemplate.h"
+#include "ifcpp/IFC4X3/include/IfcRectangularTrimmedSurface.h"
+#include "ifcpp/IFC4X3/include/IfcRecurrencePattern.h"
+#include "ifcpp/IFC4X3/include/IfcReference.h"
+#include "ifcpp/IFC4X3/include/IfcRegularTimeSeries.h"
+#include "ifcpp/IFC4X3/include/IfcReinforcementBarProperties.h"
+#include "ifcpp/IFC4X3/include/IfcReinforcementDefinitionProperties.h"
+#include "ifcpp/IFC4X3/include/IfcRelAdheresToElement.h"
+#include "ifcpp/IFC4X3/include/IfcRelAggregates.h"
+#include "ifcpp/IFC4X3/include/IfcRelAssigns.h"
+#include "ifcpp/IFC4X3/include/IfcRelAssignsToActor.h"
+#include "ifcpp/IFC4X3/include/IfcRelAssignsToControl.h"
+#include "ifcpp/IFC4X3/include/IfcRelAssignsToGroup.h"
+#include "ifcpp/IFC4X3/include/IfcRelAssignsToProcess.h"
+#include "ifcpp/IFC4X3/include/IfcRelAssignsToProduct.h"
+#include "ifcpp/IFC4X3/include/IfcRelAssignsToResource.h"
+#include "ifcpp/IFC4X3/include/IfcRelAssociates.h"
+#include "ifcpp/IFC4X3/include/IfcRelAssociatesApproval.h"
+#include "ifcpp/IFC4X3/include/IfcRelAssociatesClassification.h"
+#include "ifcpp/IFC4X3/include/IfcRelAssociatesConstraint.h"
+#include "ifcpp/IFC4X3/include/IfcRelAssociatesDocument.h"
+#include "ifcpp/IFC4X3/include/IfcRelAssociatesLibrary.h"
+#include "ifcpp/IFC4X3/include/IfcRelAssociatesMaterial.h"
+#include "ifcpp/IFC4X3/include/IfcRelAssociatesProfileDef.h"
+#include "ifcpp/IFC4X3/include/IfcRelConnectsElements.h"
+#include "ifcpp/IFC4X3/include/IfcRelConnectsPortToElement.h"
+#include "ifcpp/IFC4X3/include/IfcRelConnectsPorts.h"
+#include "ifcpp/IFC4X3/include/IfcRelConnectsStructuralActivity.h"
+#include "ifcpp/IFC4X3/include/IfcRelConnectsStructuralMember.h"
+#include "ifcpp/IFC4X3/include/IfcRelConnectsWithEccentricity.h"
+#include "ifcpp/IFC4X3/include/IfcRelConnectsWithRealizingElements.h"
+#include "ifcpp/IFC4X3/include/IfcRelContainedInSpatialStructure.h"
+#include "ifcpp/IFC4X3/include/IfcRelCoversBldgElements.h"
+#include "ifcpp/IFC4X3/include/IfcRelCoversSpaces.h"
+#include "ifcpp/IFC4X3/include/IfcRelDeclares.h"
+#include "ifcpp/IFC4X3/include/IfcRelDefinesByObject.h"
+#include "ifcpp/IFC4X3/include/IfcRelDefinesByProperties.h"
+#include "ifcpp/IFC4X3/include/IfcRelDefinesByTemplate.h"
+#include "ifcpp/IFC4X3/include/IfcRelDefinesByType.h"
+#include "ifcpp/IFC4X3/include/IfcRelFillsElement.h"
+#include "ifcpp/IFC4X3/include/IfcRelFlowControlElements.h"
+#include "ifcpp/IFC4X3/include/IfcRelInterferesElements.h"
+#include "ifcpp/IFC4X3/include/IfcRelNests.h"
+#include "ifcpp/IFC4X3/include/IfcRelPositions.h"
+#include "ifcpp/IFC4X3/include/IfcRelProjectsElement.h"
+#include "ifcpp/IFC4X3/include/IfcRelReferencedInSpatialStructure.h"
+#include "ifcpp/IFC4X3/include/IfcRelSequence.h"
+#include "ifcpp/IFC4X3/include/IfcRelServicesBuildings.h"
+#include "ifcpp/IFC4X3/include/IfcRelSpaceBoundary.h"
+#include "ifcpp/IFC4X3/include/IfcRelSpaceBoundary1stLevel.h"
+#include "ifcpp/IFC4X3/include/IfcRelSpaceBoundary2ndLevel.h"
+#include "ifcpp/IFC4X3/include/IfcRelVoidsElement.h"
+#include "ifcpp/IFC4X3/include/IfcRepresentation.h"
+#include "ifcpp/IFC4X3/include/IfcRepresentationContext.h"
+#include "ifcpp/IFC4X3/include/IfcRepresentationItem.h"
+#include "ifcpp/IFC4X3/include/IfcRepresentationMap.h"
+#include "ifcpp/IFC4X3/include/IfcResource.h"
+#include "ifcpp/IFC4X3/include/IfcResourceApprovalRelationship.h"
+#include "ifcpp/IFC4X3/include/IfcResourceConstraintRelationship.h"
+#include "ifcpp/IFC4X3/include/IfcResourceObjectSelect.h"
+#include "ifcpp/IFC4X3/include/IfcResourceSelect.h"
+#include "ifcpp/IFC4X3/include/IfcResourceTime.h"
+#include "ifcpp/IFC4X3/include/IfcRevolvedAreaSolid.h"
+#include "ifcpp/IFC4X3/include/IfcRevolvedAreaSolidTapered.h"
+#include "ifcpp/IFC4X3/include/IfcRoot.h"
+#include "ifcpp/IFC4X3/include/IfcSectionProperties.h"
+#include "ifcpp/IFC4X3/include/IfcSectionReinforcementProperties.h"
+#include "ifcpp/IFC4X3/include/IfcSectionedSolid.h"
+#include "ifcpp/IFC4X3/include/IfcSectionedSolidHorizontal.h"
+#include "ifcpp/IFC4X3/include/IfcSectionedSpine.h"
+#include "ifcpp/IFC4X3/include/IfcSectionedSurface.h"
+#include "ifcpp/IFC4X3/include/IfcSegment.h"
+#include "ifcpp/IFC4X3/include/IfcSegmentedReferenceCurve.h"
+#include "ifcpp/IFC4X3/include/IfcShapeAspect.h"
+#include "ifcpp/IFC4X3/include/IfcShapeModel.h"
+#include "ifcpp/IFC4X3/include/IfcShell.h"
+#include "ifcpp/IFC4X3/include/IfcShellBasedSurfaceModel.h"
+#include "ifcpp/IFC4X3/include/IfcSimplePropertyTemplate.h"
+#include "ifcpp/IFC4X3/include/IfcSite.h"
+#include "ifcpp/IFC4X3/include/IfcSolidOrShell.h"
+#include "ifcpp/IFC4X3/include/IfcSpace.h"
+#include "ifcpp/IFC4X3/include/IfcSpaceBoundarySelect.h"
+#include "ifcpp/IFC4X3/include/IfcSpatialElement.h"
+#include "ifcpp/IFC4X3/include/IfcSpatialReferenceSelect.h"
+#include "ifcpp/IFC4X3/include/IfcSpatialZone.h"
+#include "ifcpp/IFC4X3/include/IfcSpiral.h"
+#include "ifcpp/IFC4X3/include/IfcStructuralActivity.h"
+#include "ifcpp/IFC4X3/include/IfcStructuralActivityAssignmentSelect.h"
+#include "ifcpp/IFC4X3/include/IfcStructuralAnalysisModel.h"
+#include "ifcpp/IFC4X3/include/IfcStructuralConnection.h"
+#include "ifcpp/IFC4X3/include/IfcStructuralConnectionCondition.h"
+#include "ifcpp/IFC4X3/include/IfcStructuralCurveConnection.h"
+#include "ifcpp/IFC4X3/include/IfcStructuralCurveMember.h"
+#include "ifcpp/IFC4X3/include/IfcStructuralItem.h"
+#include "ifcpp/IFC4X3/include/IfcStructuralLoad.h"
+#include "ifcpp/IFC4X3/include/IfcStructuralLoadConfiguration.h"
+#include "ifcpp/IFC4X3/include/IfcStructuralLoadGroup.h"
+#include "ifcpp/IFC4X3/include/IfcStructuralLoadOrResult.h"
+#include "ifcpp/IFC4X3/include/IfcStructuralMember.h"
+#include "ifcpp/IFC4X3/include/IfcStructuralPointConnection.h"
+#include "ifcpp/IFC4X3/include/IfcStructuralResultGroup.h"
+#include "ifcpp/IFC4X3/include/IfcStyledItem.h"
+#include "ifcpp/IFC4X3/include/IfcSubedge.h"
+#include "ifcpp/IFC4X3/include/IfcSurface.h"
+#include "ifcpp/IFC4X3/include/IfcSurfaceCurve.h"
+#include "ifcpp/IFC4X3/include/IfcSurfaceCurveSweptAreaSolid.h"
+#include "ifcpp/IFC4X3/include/IfcSurfaceFeature.h"
+#include "ifcpp/IFC4X3/include/IfcSurfaceOfLinearExtrusion.h"
+#include "ifcpp/IFC4X3/include/IfcSurfaceOfRevolution.h"
+#include "ifcpp/IFC4X3/include/IfcSurfaceOrFaceSurface.h"
+#include "ifcpp/IFC4X3/include/IfcSurfaceStyle.h"
+#include "ifcpp/IFC4X3/include/IfcSurfaceStyleElementSelect.h"
+#include "ifcpp/IFC4X3/include/IfcSurfaceStyleLighting.h"
+#include "ifcpp/IFC4X3/include/IfcSurfaceStyleRendering.h"
+#include "ifcpp/IFC4X3/include/IfcSurfaceStyleShading.h"
+#include "ifcpp/IFC4X3/include/IfcSurfaceStyleWithTextures.h"
+#include "ifcpp/IFC4X3/include/IfcSurfaceTexture.h"
+#include "ifcpp/IFC4X3/include/IfcSweptAreaSolid.h"
+#include "ifcpp/IFC4X3/include/IfcSweptDiskSolid.h"
+#include "ifcpp/IFC4X3/include/IfcSweptSurface.h"
+#include "ifcpp/IFC4X3/include/IfcSystem.h"
+#include "ifcpp/IFC4X3/include/IfcTable.h"
+#include "ifcpp/IFC4X3/include/IfcTableColumn.h"
+#include "ifcpp/IFC4X3/include/IfcTableRow.h"
+#include "ifcpp/IFC4X3/include/IfcTask.h"
+#include "ifcpp/IFC4X3/include/IfcTaskTime.h"
+#include "ifcpp/IFC4X3/include/IfcTaskTimeRecurring.h"
+#include "ifcpp/IFC4X3/include/IfcTessellatedFaceSet.h"
+#include "ifcpp/IFC4X3/include/IfcTextFontSelect.h"
+#include "ifcpp/IFC4X3/include/IfcTextLiteral.h"
+#include "ifcpp/IFC4X3/include/IfcTextLiteralWithExtent.h"
+#include "ifcpp/IFC4X3/include/IfcTextStyle.h"
+#include "ifcpp/IFC4X3/include/IfcTextStyleForDefinedFont.h"
+#include "ifcpp/IFC4X3/include/IfcTextStyleTextModel.h"
+#include "ifcpp/IFC4X3/include/IfcTextureCoordinate.h"
+#include "ifcpp/IFC4X3/include/IfcTextureCoordinateIndices.h"
+#include "ifcpp/IFC4X3/include/IfcTextureMap.h"
+#include "ifcpp/IFC4X3/include/IfcTextureVertex.h"
+#include "ifcpp/IFC4X3/include/IfcTextureVertexList.h"
+#include "ifcpp/IFC4X3/include/IfcTimePeriod.h"
+#include "ifcpp/IFC4X3/include/IfcTimeSeries.h"
+#include "ifcpp/IFC4X3/include/IfcTimeSeriesValue.h"
+#include "ifcpp/IFC4X3/include/IfcTrimmedCurve.h"
+#include "ifcpp/IFC4X3/include/IfcTrimmingSelect.h"
+#include "ifcpp/IFC4X3/include/IfcTypeObject.h"
+#include "ifcpp/IFC4X3/include/IfcTypeProcess.h"
+#include "ifcpp/IFC4X3/include/IfcTypeProduct.h"
+#include "ifcpp/IFC4X3/include/IfcTypeResource.h"
+#include "ifcpp/IFC4X3/include/IfcUnit.h"
+#include "ifcpp/IFC4X3/include/IfcUnitAssignment.h"
+#include "ifcpp/IFC4X3/include/IfcVector.h"
+#include "ifcpp/IFC4X3/include/IfcVertex.h"
+#include "ifcpp/IFC4X3/include/IfcVertexLoop.h"
+#include "ifcpp/IFC4X3/include/IfcVertexPoint.h"
+#include "ifcpp/IFC4X3/include/IfcVirtualGridIntersection.h"
+#include "ifcpp/IFC4X3/include/IfcWellKnownText.h"
+#include "ifcpp/IFC4X3/include/IfcWindowLiningProperties.h"
+#include "ifcpp/IFC4X3/include/IfcWindowPanelProperties.h"
+#include "ifcpp/IFC4X3/include/IfcWorkCalendar.h"
+#include "ifcpp/IFC4X3/include/IfcWorkControl.h"
+#include "ifcpp/IFC4X3/include/IfcWorkTime.h"
+
+using namespace IFC4X3;
+
+namespace
+{
+	template<typename T>
+	void visitEntity( const shared_ptr<T>& entity, EntityReferenceVisitor& visitor )
+	{
+		if( entity && visitor.visitReference( entity.get() ) )
+		{
+			visitor.keepReference( entity );
+		}
+	}
+
+	template<typename T>
+	void visitEntity( const weak_ptr<T>& entity_weak, EntityReferenceVisitor& visitor )
+	{
+		if( !entity_weak.expired() )
+		{
+			visitEntity( entity_weak.lock(), visitor );
+		}
+	}
+
+	template<typename T>
+	void visitEntity( const std::vector<T>& vec, EntityReferenceVisitor& visitor )
+	{
+		for( const T& item : vec )
+		{
+			visitEntity( item, visitor );
+		}
+	}
+
+	// only select types that contain entities. Their values are entities, or types, of which only IfcPropertySetDefinitionSet holds entities
+	template<typename T>
+	void visitSelect( const shared_ptr<T>& value, EntityReferenceVisitor& visitor )
+	{
+		if( !value )
+		{
+			return;
+		}
+		BuildingEntity* entity = dynamic_cast<BuildingEntity*>( value.get() );
+		if( entity )
+		{
+			if( visitor.visitReference( entity ) )
+			{
+				visitor.keepReference( shared_ptr<BuildingEntity>( value, entity ) );
+			}
+		}
+		else if( value->classID() == IFCPROPERTYSETDEFINITIONSET )
+		{
+			const IfcPropertySetDefinitionSet* definition_set = dynamic_cast<const IfcPropertySetDefinitionSet*>( value.get() );
+			if( definition_set )
+			{
+				visitEntity( definition_set->m_vec, visitor );
+			}
+		}
+	}
+
+	template<typename T>
+	void visitSelect( const std::vector<T>& vec, EntityReferenceVisitor& visitor )
+	{
+		for( const T& item : vec )
+		{
+			visitSelect( item, visitor );
+		}
+	}
+
+	void visitIfcApplication( const IfcApplication* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_ApplicationDeveloper, visitor );
+	}
+	void visitIfcAppliedValue( const IfcAppliedValue* entity, EntityReferenceVisitor& visitor )
+	{
+		visitSelect( entity->m_AppliedValue, visitor );
+		visitEntity( entity->m_UnitBasis, visitor );
+		visitEntity( entity->m_Components, visitor );
+	}
+	void visitIfcApproval( const IfcApproval* entity, EntityReferenceVisitor& visitor )
+	{
+		visitSelect( entity->m_RequestingApproval, visitor );
+		visitSelect( entity->m_GivingApproval, visitor );
+	}
+	void visitIfcConstraint( const IfcConstraint* entity, EntityReferenceVisitor& visitor )
+	{
+		visitSelect( entity->m_CreatingActor, visitor );
+	}
+	void visitIfcCoordinateOperation( const IfcCoordinateOperation* entity, EntityReferenceVisitor& visitor )
+	{
+		visitSelect( entity->m_SourceCRS, visitor );
+		visitEntity( entity->m_TargetCRS, visitor );
+	}
+	void visitIfcDerivedUnit( const IfcDerivedUnit* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_Elements, visitor );
+	}
+	void visitIfcDerivedUnitElement( const IfcDerivedUnitElement* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_Unit, visitor );
+	}
+	void visitIfcGridAxis( const IfcGridAxis* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_AxisCurve, visitor );
+	}
+	void visitIfcLightIntensityDistribution( const IfcLightIntensityDistribution* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_DistributionData, visitor );
+	}
+	void visitIfcMaterialClassificationRelationship( const IfcMaterialClassificationRelationship* entity, EntityReferenceVisitor& visitor )
+	{
+		visitSelect( entity->m_MaterialClassifications, visitor );
+		visitEntity( entity->m_ClassifiedMaterial, visitor );
+	}
+	void visitIfcMaterialList( const IfcMaterialList* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_Materials, visitor );
+	}
+	void visitIfcMeasureWithUnit( const IfcMeasureWithUnit* entity, EntityReferenceVisitor& visitor )
+	{
+		visitSelect( entity->m_UnitComponent, visitor );
+	}
+	void visitIfcNamedUnit( const IfcNamedUnit* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_Dimensions, visitor );
+	}
+	void visitIfcObjectPlacement( const IfcObjectPlacement* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_PlacementRelTo, visitor );
+	}
+	void visitIfcOrganization( const IfcOrganization* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_Roles, visitor );
+		visitEntity( entity->m_Addresses, visitor );
+	}
+	void visitIfcOwnerHistory( const IfcOwnerHistory* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_OwningUser, visitor );
+		visitEntity( entity->m_OwningApplication, visitor );
+		visitEntity( entity->m_LastModifyingUser, visitor );
+		visitEntity( entity->m_LastModifyingApplication, visitor );
+	}
+	void visitIfcPerson( const IfcPerson* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_Roles, visitor );
+		visitEntity( entity->m_Addresses, visitor );
+	}
+	void visitIfcPersonAndOrganization( const IfcPersonAndOrganization* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_ThePerson, visitor );
+		visitEntity( entity->m_TheOrganization, visitor );
+		visitEntity( entity->m_Roles, visitor );
+	}
+	void visitIfcPresentationLayerAssignment( const IfcPresentationLayerAssignment* entity, EntityReferenceVisitor& visitor )
+	{
+		visitSelect( entity->m_AssignedItems, visitor );
+	}
+	void visitIfcProductRepresentation( const IfcProductRepresentation* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_Representations, visitor );
+	}
+	void visitIfcRecurrencePattern( const IfcRecurrencePattern* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_TimePeriods, visitor );
+	}
+	void visitIfcReference( const IfcReference* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_InnerReference, visitor );
+	}
+	void visitIfcRepresentation( const IfcRepresentation* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_ContextOfItems, visitor );
+		visitEntity( entity->m_Items, visitor );
+	}
+	void visitIfcRepresentationMap( const IfcRepresentationMap* entity, EntityReferenceVisitor& visitor )
+	{
+		visitSelect( entity->m_MappingOrigin, visitor );
+		visitEntity( entity->m_MappedRepresentation, visitor );
+	}
+	void visitIfcRoot( const IfcRoot* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_OwnerHistory, visitor );
+	}
+	void visitIfcShapeAspect( const IfcShapeAspect* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_ShapeRepresentations, visitor );
+		visitSelect( entity->m_PartOfProductDefinitionShape, visitor );
+	}
+	void visitIfcTable( const IfcTable* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_Rows, visitor );
+		visitEntity( entity->m_Columns, visitor );
+	}
+	void visitIfcTableColumn( const IfcTableColumn* entity, EntityReferenceVisitor& visitor )
+	{
+		visitSelect( entity->m_Unit, visitor );
+		visitEntity( entity->m_ReferencePath, visitor );
+	}
+	void visitIfcTextureCoordinateIndices( const IfcTextureCoordinateIndices* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_TexCoordsOf, visitor );
+	}
+	void visitIfcTimeSeries( const IfcTimeSeries* entity, EntityReferenceVisitor& visitor )
+	{
+		visitSelect( entity->m_Unit, visitor );
+	}
+	void visitIfcUnitAssignment( const IfcUnitAssignment* entity, EntityReferenceVisitor& visitor )
+	{
+		visitSelect( entity->m_Units, visitor );
+	}
+	void visitIfcVirtualGridIntersection( const IfcVirtualGridIntersection* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_IntersectingAxes, visitor );
+	}
+	void visitIfcWellKnownText( const IfcWellKnownText* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_CoordinateReferenceSystem, visitor );
+	}
+	void visitIfcAlignmentHorizontalSegment( const IfcAlignmentHorizontalSegment* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_StartPoint, visitor );
+	}
+	void visitIfcApprovalRelationship( const IfcApprovalRelationship* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_RelatingApproval, visitor );
+		visitEntity( entity->m_RelatedApprovals, visitor );
+	}
+	void visitIfcArbitraryClosedProfileDef( const IfcArbitraryClosedProfileDef* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_OuterCurve, visitor );
+	}
+	void visitIfcArbitraryOpenProfileDef( const IfcArbitraryOpenProfileDef* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_Curve, visitor );
+	}
+	void visitIfcClassificationReference( const IfcClassificationReference* entity, EntityReferenceVisitor& visitor )
+	{
+		visitSelect( entity->m_ReferencedSource, visitor );
+	}
+	void visitIfcCompositeProfileDef( const IfcCompositeProfileDef* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_Profiles, visitor );
+	}
+	void visitIfcConnectionCurveGeometry( const IfcConnectionCurveGeometry* entity, EntityReferenceVisitor& visitor )
+	{
+		visitSelect( entity->m_CurveOnRelatingElement, visitor );
+		visitSelect( entity->m_CurveOnRelatedElement, visitor );
+	}
+	void visitIfcConnectionPointGeometry( const IfcConnectionPointGeometry* entity, EntityReferenceVisitor& visitor )
+	{
+		visitSelect( entity->m_PointOnRelatingElement, visitor );
+		visitSelect( entity->m_PointOnRelatedElement, visitor );
+	}
+	void visitIfcConnectionSurfaceGeometry( const IfcConnectionSurfaceGeometry* entity, EntityReferenceVisitor& visitor )
+	{
+		visitSelect( entity->m_SurfaceOnRelatingElement, visitor );
+		visitSelect( entity->m_SurfaceOnRelatedElement, visitor );
+	}
+	void visitIfcConnectionVolumeGeometry( const IfcConnectionVolumeGeometry* entity, EntityReferenceVisitor& visitor )
+	{
+		visitSelect( entity->m_VolumeOnRelatingElement, visitor );
+		visitSelect( entity->m_VolumeOnRelatedElement, visitor );
+	}
+	void visitIfcConversionBasedUnit( const IfcConversionBasedUnit* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcNamedUnit( entity, visitor );
+		visitEntity( entity->m_ConversionFactor, visitor );
+	}
+	void visitIfcCurrencyRelationship( const IfcCurrencyRelationship* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_RelatingMonetaryUnit, visitor );
+		visitEntity( entity->m_RelatedMonetaryUnit, visitor );
+		visitEntity( entity->m_RateSource, visitor );
+	}
+	void visitIfcCurveStyle( const IfcCurveStyle* entity, EntityReferenceVisitor& visitor )
+	{
+		visitSelect( entity->m_CurveFont, visitor );
+		visitSelect( entity->m_CurveColour, visitor );
+	}
+	void visitIfcCurveStyleFont( const IfcCurveStyleFont* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_PatternList, visitor );
+	}
+	void visitIfcCurveStyleFontAndScaling( const IfcCurveStyleFontAndScaling* entity, EntityReferenceVisitor& visitor )
+	{
+		visitSelect( entity->m_CurveStyleFont, visitor );
+	}
+	void visitIfcDerivedProfileDef( const IfcDerivedProfileDef* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_ParentProfile, visitor );
+		visitEntity( entity->m_Operator, visitor );
+	}
+	void visitIfcDocumentInformation( const IfcDocumentInformation* entity, EntityReferenceVisitor& visitor )
+	{
+		visitSelect( entity->m_DocumentOwner, visitor );
+		visitSelect( entity->m_Editors, visitor );
+	}
+	void visitIfcDocumentInformationRelationship( const IfcDocumentInformationRelationship* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_RelatingDocument, visitor );
+		visitEntity( entity->m_RelatedDocuments, visitor );
+	}
+	void visitIfcDocumentReference( const IfcDocumentReference* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_ReferencedDocument, visitor );
+	}
+	void visitIfcExtendedProperties( const IfcExtendedProperties* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_Properties, visitor );
+	}
+	void visitIfcExternalReferenceRelationship( const IfcExternalReferenceRelationship* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_RelatingReference, visitor );
+		visitSelect( entity->m_RelatedResourceObjects, visitor );
+	}
+	void visitIfcFillAreaStyle( const IfcFillAreaStyle* entity, EntityReferenceVisitor& visitor )
+	{
+		visitSelect( entity->m_FillStyles, visitor );
+	}
+	void visitIfcGeographicCRS( const IfcGeographicCRS* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_AngleUnit, visitor );
+		visitEntity( entity->m_HeightUnit, visitor );
+	}
+	void visitIfcGeometricRepresentationContext( const IfcGeometricRepresentationContext* entity, EntityReferenceVisitor& visitor )
+	{
+		visitSelect( entity->m_WorldCoordinateSystem, visitor );
+		visitEntity( entity->m_TrueNorth, visitor );
+	}
+	void visitIfcGridPlacement( const IfcGridPlacement* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcObjectPlacement( entity, visitor );
+		visitEntity( entity->m_PlacementLocation, visitor );
+		visitSelect( entity->m_PlacementRefDirection, visitor );
+	}
+	void visitIfcIndexedColourMap( const IfcIndexedColourMap* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_MappedTo, visitor );
+		visitEntity( entity->m_Colours, visitor );
+	}
+	void visitIfcIrregularTimeSeries( const IfcIrregularTimeSeries* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcTimeSeries( entity, visitor );
+		visitEntity( entity->m_Values, visitor );
+	}
+	void visitIfcLibraryInformation( const IfcLibraryInformation* entity, EntityReferenceVisitor& visitor )
+	{
+		visitSelect( entity->m_Publisher, visitor );
+	}
+	void visitIfcLibraryReference( const IfcLibraryReference* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_ReferencedLibrary, visitor );
+	}
+	void visitIfcLinearPlacement( const IfcLinearPlacement* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcObjectPlacement( entity, visitor );
+		visitEntity( entity->m_RelativePlacement, visitor );
+		visitEntity( entity->m_CartesianPosition, visitor );
+	}
+	void visitIfcLocalPlacement( const IfcLocalPlacement* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcObjectPlacement( entity, visitor );
+		visitSelect( entity->m_RelativePlacement, visitor );
+	}
+	void visitIfcMappedItem( const IfcMappedItem* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_MappingSource, visitor );
+		visitEntity( entity->m_MappingTarget, visitor );
+	}
+	void visitIfcMaterialConstituent( const IfcMaterialConstituent* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_Material, visitor );
+	}
+	void visitIfcMaterialConstituentSet( const IfcMaterialConstituentSet* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_MaterialConstituents, visitor );
+	}
+	void visitIfcMaterialDefinitionRepresentation( const IfcMaterialDefinitionRepresentation* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcProductRepresentation( entity, visitor );
+		visitEntity( entity->m_RepresentedMaterial, visitor );
+	}
+	void visitIfcMaterialLayer( const IfcMaterialLayer* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_Material, visitor );
+	}
+	void visitIfcMaterialLayerSet( const IfcMaterialLayerSet* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_MaterialLayers, visitor );
+	}
+	void visitIfcMaterialLayerSetUsage( const IfcMaterialLayerSetUsage* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_ForLayerSet, visitor );
+	}
+	void visitIfcMaterialProfile( const IfcMaterialProfile* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_Material, visitor );
+		visitEntity( entity->m_Profile, visitor );
+	}
+	void visitIfcMaterialProfileSet( const IfcMaterialProfileSet* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_MaterialProfiles, visitor );
+		visitEntity( entity->m_CompositeProfile, visitor );
+	}
+	void visitIfcMaterialProfileSetUsage( const IfcMaterialProfileSetUsage* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_ForProfileSet, visitor );
+	}
+	void visitIfcMaterialRelationship( const IfcMaterialRelationship* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_RelatingMaterial, visitor );
+		visitEntity( entity->m_RelatedMaterials, visitor );
+	}
+	void visitIfcMetric( const IfcMetric* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcConstraint( entity, visitor );
+		visitSelect( entity->m_DataValue, visitor );
+		visitEntity( entity->m_ReferencePath, visitor );
+	}
+	void visitIfcObjective( const IfcObjective* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcConstraint( entity, visitor );
+		visitEntity( entity->m_BenchmarkValues, visitor );
+	}
+	void visitIfcOpenCrossProfileDef( const IfcOpenCrossProfileDef* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_OffsetPoint, visitor );
+	}
+	void visitIfcOrganizationRelationship( const IfcOrganizationRelationship* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_RelatingOrganization, visitor );
+		visitEntity( entity->m_RelatedOrganizations, visitor );
+	}
+	void visitIfcParameterizedProfileDef( const IfcParameterizedProfileDef* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_Position, visitor );
+	}
+	void visitIfcPhysicalComplexQuantity( const IfcPhysicalComplexQuantity* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_HasQuantities, visitor );
+	}
+	void visitIfcPhysicalSimpleQuantity( const IfcPhysicalSimpleQuantity* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_Unit, visitor );
+	}
+	void visitIfcPresentationLayerWithStyle( const IfcPresentationLayerWithStyle* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcPresentationLayerAssignment( entity, visitor );
+		visitEntity( entity->m_LayerStyles, visitor );
+	}
+	void visitIfcPresentationStyleAssignment( const IfcPresentationStyleAssignment* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_Styles, visitor );
+	}
+	void visitIfcProjectedCRS( const IfcProjectedCRS* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_MapUnit, visitor );
+	}
+	void visitIfcPropertyDependencyRelationship( const IfcPropertyDependencyRelationship* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_DependingProperty, visitor );
+		visitEntity( entity->m_DependantProperty, visitor );
+	}
+	void visitIfcPropertyEnumeration( const IfcPropertyEnumeration* entity, EntityReferenceVisitor& visitor )
+	{
+		visitSelect( entity->m_Unit, visitor );
+	}
+	void visitIfcRegularTimeSeries( const IfcRegularTimeSeries* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcTimeSeries( entity, visitor );
+		visitEntity( entity->m_Values, visitor );
+	}
+	void visitIfcResourceApprovalRelationship( const IfcResourceApprovalRelationship* entity, EntityReferenceVisitor& visitor )
+	{
+		visitSelect( entity->m_RelatedResourceObjects, visitor );
+		visitEntity( entity->m_RelatingApproval, visitor );
+	}
+	void visitIfcResourceConstraintRelationship( const IfcResourceConstraintRelationship* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_RelatingConstraint, visitor );
+		visitSelect( entity->m_RelatedResourceObjects, visitor );
+	}
+	void visitIfcStructuralLoadConfiguration( const IfcStructuralLoadConfiguration* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_Values, visitor );
+	}
+	void visitIfcStyledItem( const IfcStyledItem* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_Item, visitor );
+		visitEntity( entity->m_Styles, visitor );
+	}
+	void visitIfcSurfaceStyle( const IfcSurfaceStyle* entity, EntityReferenceVisitor& visitor )
+	{
+		visitSelect( entity->m_Styles, visitor );
+	}
+	void visitIfcSurfaceStyleLighting( const IfcSurfaceStyleLighting* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_DiffuseTransmissionColour, visitor );
+		visitEntity( entity->m_DiffuseReflectionColour, visitor );
+		visitEntity( entity->m_TransmissionColour, visitor );
+		visitEntity( entity->m_ReflectanceColour, visitor );
+	}
+	void visitIfcSurfaceStyleShading( const IfcSurfaceStyleShading* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_SurfaceColour, visitor );
+	}
+	void visitIfcSurfaceStyleWithTextures( const IfcSurfaceStyleWithTextures* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_Textures, visitor );
+	}
+	void visitIfcSurfaceTexture( const IfcSurfaceTexture* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_TextureTransform, visitor );
+	}
+	void visitIfcTextStyle( const IfcTextStyle* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_TextCharacterAppearance, visitor );
+		visitEntity( entity->m_TextStyle, visitor );
+		visitSelect( entity->m_TextFontStyle, visitor );
+	}
+	void visitIfcTextStyleForDefinedFont( const IfcTextStyleForDefinedFont* entity, EntityReferenceVisitor& visitor )
+	{
+		visitSelect( entity->m_Colour, visitor );
+		visitSelect( entity->m_BackgroundColour, visitor );
+	}
+	void visitIfcTextureCoordinate( const IfcTextureCoordinate* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_Maps, visitor );
+	}
+	void visitIfcWorkTime( const IfcWorkTime* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_RecurrencePattern, visitor );
+	}
+	void visitIfcAnnotationFillArea( const IfcAnnotationFillArea* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_OuterBoundary, visitor );
+		visitEntity( entity->m_InnerBoundaries, visitor );
+	}
+	void visitIfcArbitraryProfileDefWithVoids( const IfcArbitraryProfileDefWithVoids* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcArbitraryClosedProfileDef( entity, visitor );
+		visitEntity( entity->m_InnerCurves, visitor );
+	}
+	void visitIfcBooleanResult( const IfcBooleanResult* entity, EntityReferenceVisitor& visitor )
+	{
+		visitSelect( entity->m_FirstOperand, visitor );
+		visitSelect( entity->m_SecondOperand, visitor );
+	}
+	void visitIfcBoundingBox( const IfcBoundingBox* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_Corner, visitor );
+	}
+	void visitIfcCartesianTransformationOperator( const IfcCartesianTransformationOperator* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_Axis1, visitor );
+		visitEntity( entity->m_Axis2, visitor );
+		visitEntity( entity->m_LocalOrigin, visitor );
+	}
+	void visitIfcComplexProperty( const IfcComplexProperty* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_HasProperties, visitor );
+	}
+	void visitIfcConnectedFaceSet( const IfcConnectedFaceSet* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_CfsFaces, visitor );
+	}
+	void visitIfcContext( const IfcContext* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRoot( entity, visitor );
+		visitEntity( entity->m_RepresentationContexts, visitor );
+		visitEntity( entity->m_UnitsInContext, visitor );
+	}
+	void visitIfcCsgPrimitive3D( const IfcCsgPrimitive3D* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_Position, visitor );
+	}
+	void visitIfcEdge( const IfcEdge* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_EdgeStart, visitor );
+		visitEntity( entity->m_EdgeEnd, visitor );
+	}
+	void visitIfcFace( const IfcFace* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_Bounds, visitor );
+	}
+	void visitIfcFaceBasedSurfaceModel( const IfcFaceBasedSurfaceModel* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_FbsmFaces, visitor );
+	}
+	void visitIfcFaceBound( const IfcFaceBound* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_Bound, visitor );
+	}
+	void visitIfcFillAreaStyleHatching( const IfcFillAreaStyleHatching* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_HatchLineAppearance, visitor );
+		visitSelect( entity->m_StartOfNextHatchLine, visitor );
+		visitEntity( entity->m_PointOfReferenceHatchLine, visitor );
+		visitEntity( entity->m_PatternStart, visitor );
+	}
+	void visitIfcFillAreaStyleTiles( const IfcFillAreaStyleTiles* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_TilingPattern, visitor );
+		visitEntity( entity->m_Tiles, visitor );
+	}
+	void visitIfcGeometricRepresentationSubContext( const IfcGeometricRepresentationSubContext* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcGeometricRepresentationContext( entity, visitor );
+		visitEntity( entity->m_ParentContext, visitor );
+	}
+	void visitIfcGeometricSet( const IfcGeometricSet* entity, EntityReferenceVisitor& visitor )
+	{
+		visitSelect( entity->m_Elements, visitor );
+	}
+	void visitIfcHalfSpaceSolid( const IfcHalfSpaceSolid* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_BaseSurface, visitor );
+	}
+	void visitIfcIndexedTextureMap( const IfcIndexedTextureMap* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcTextureCoordinate( entity, visitor );
+		visitEntity( entity->m_MappedTo, visitor );
+		visitEntity( entity->m_TexCoords, visitor );
+	}
+	void visitIfcLightSource( const IfcLightSource* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_LightColour, visitor );
+	}
+	void visitIfcMaterialProfileSetUsageTapering( const IfcMaterialProfileSetUsageTapering* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcMaterialProfileSetUsage( entity, visitor );
+		visitEntity( entity->m_ForProfileEndSet, visitor );
+	}
+	void visitIfcMaterialProperties( const IfcMaterialProperties* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcExtendedProperties( entity, visitor );
+		visitEntity( entity->m_Material, visitor );
+	}
+	void visitIfcPath( const IfcPath* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_EdgeList, visitor );
+	}
+	void visitIfcPlacement( const IfcPlacement* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_Location, visitor );
+	}
+	void visitIfcProfileProperties( const IfcProfileProperties* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcExtendedProperties( entity, visitor );
+		visitEntity( entity->m_ProfileDefinition, visitor );
+	}
+	void visitIfcRelAssigns( const IfcRelAssigns* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRoot( entity, visitor );
+		visitEntity( entity->m_RelatedObjects, visitor );
+	}
+	void visitIfcRelAssociates( const IfcRelAssociates* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRoot( entity, visitor );
+		visitSelect( entity->m_RelatedObjects, visitor );
+	}
+	void visitIfcRelDeclares( const IfcRelDeclares* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRoot( entity, visitor );
+		visitEntity( entity->m_RelatingContext, visitor );
+		visitSelect( entity->m_RelatedDefinitions, visitor );
+	}
+	void visitIfcSectionProperties( const IfcSectionProperties* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_StartProfile, visitor );
+		visitEntity( entity->m_EndProfile, visitor );
+	}
+	void visitIfcSectionReinforcementProperties( const IfcSectionReinforcementProperties* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_SectionDefinition, visitor );
+		visitEntity( entity->m_CrossSectionReinforcementDefinitions, visitor );
+	}
+	void visitIfcSectionedSpine( const IfcSectionedSpine* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_SpineCurve, visitor );
+		visitEntity( entity->m_CrossSections, visitor );
+		visitEntity( entity->m_CrossSectionPositions, visitor );
+	}
+	void visitIfcShellBasedSurfaceModel( const IfcShellBasedSurfaceModel* entity, EntityReferenceVisitor& visitor )
+	{
+		visitSelect( entity->m_SbsmBoundary, visitor );
+	}
+	void visitIfcSurfaceStyleRendering( const IfcSurfaceStyleRendering* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcSurfaceStyleShading( entity, visitor );
+		visitSelect( entity->m_DiffuseColour, visitor );
+		visitSelect( entity->m_TransmissionColour, visitor );
+		visitSelect( entity->m_DiffuseTransmissionColour, visitor );
+		visitSelect( entity->m_ReflectionColour, visitor );
+		visitSelect( entity->m_SpecularColour, visitor );
+	}
+	void visitIfcTaskTimeRecurring( const IfcTaskTimeRecurring* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_Recurrence, visitor );
+	}
+	void visitIfcTextLiteral( const IfcTextLiteral* entity, EntityReferenceVisitor& visitor )
+	{
+		visitSelect( entity->m_Placement, visitor );
+	}
+	void visitIfcTextureMap( const IfcTextureMap* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcTextureCoordinate( entity, visitor );
+		visitEntity( entity->m_Vertices, visitor );
+		visitEntity( entity->m_MappedTo, visitor );
+	}
+	void visitIfcTypeObject( const IfcTypeObject* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRoot( entity, visitor );
+		visitEntity( entity->m_HasPropertySets, visitor );
+	}
+	void visitIfcVector( const IfcVector* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_Orientation, visitor );
+	}
+	void visitIfcActor( const IfcActor* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRoot( entity, visitor );
+		visitSelect( entity->m_TheActor, visitor );
+	}
+	void visitIfcAxis1Placement( const IfcAxis1Placement* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcPlacement( entity, visitor );
+		visitEntity( entity->m_Axis, visitor );
+	}
+	void visitIfcAxis2Placement2D( const IfcAxis2Placement2D* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcPlacement( entity, visitor );
+		visitEntity( entity->m_RefDirection, visitor );
+	}
+	void visitIfcAxis2Placement3D( const IfcAxis2Placement3D* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcPlacement( entity, visitor );
+		visitEntity( entity->m_Axis, visitor );
+		visitEntity( entity->m_RefDirection, visitor );
+	}
+	void visitIfcAxis2PlacementLinear( const IfcAxis2PlacementLinear* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcPlacement( entity, visitor );
+		visitEntity( entity->m_Axis, visitor );
+		visitEntity( entity->m_RefDirection, visitor );
+	}
+	void visitIfcBoxedHalfSpace( const IfcBoxedHalfSpace* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcHalfSpaceSolid( entity, visitor );
+		visitEntity( entity->m_Enclosure, visitor );
+	}
+	void visitIfcCartesianTransformationOperator3D( const IfcCartesianTransformationOperator3D* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcCartesianTransformationOperator( entity, visitor );
+		visitEntity( entity->m_Axis3, visitor );
+	}
+	void visitIfcCompositeCurveSegment( const IfcCompositeCurveSegment* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_ParentCurve, visitor );
+	}
+	void visitIfcConic( const IfcConic* entity, EntityReferenceVisitor& visitor )
+	{
+		visitSelect( entity->m_Position, visitor );
+	}
+	void visitIfcCsgSolid( const IfcCsgSolid* entity, EntityReferenceVisitor& visitor )
+	{
+		visitSelect( entity->m_TreeRootExpression, visitor );
+	}
+	void visitIfcCurveSegment( const IfcCurveSegment* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_Placement, visitor );
+		visitEntity( entity->m_ParentCurve, visitor );
+	}
+	void visitIfcEdgeCurve( const IfcEdgeCurve* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcEdge( entity, visitor );
+		visitEntity( entity->m_EdgeGeometry, visitor );
+	}
+	void visitIfcEdgeLoop( const IfcEdgeLoop* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_EdgeList, visitor );
+	}
+	void visitIfcElementarySurface( const IfcElementarySurface* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_Position, visitor );
+	}
+	void visitIfcFaceSurface( const IfcFaceSurface* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcFace( entity, visitor );
+		visitEntity( entity->m_FaceSurface, visitor );
+	}
+	void visitIfcIndexedPolygonalTextureMap( const IfcIndexedPolygonalTextureMap* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcIndexedTextureMap( entity, visitor );
+		visitEntity( entity->m_TexCoordIndices, visitor );
+	}
+	void visitIfcLightSourceDirectional( const IfcLightSourceDirectional* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcLightSource( entity, visitor );
+		visitEntity( entity->m_Orientation, visitor );
+	}
+	void visitIfcLightSourceGoniometric( const IfcLightSourceGoniometric* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcLightSource( entity, visitor );
+		visitEntity( entity->m_Position, visitor );
+		visitEntity( entity->m_ColourAppearance, visitor );
+		visitSelect( entity->m_LightDistributionDataSource, visitor );
+	}
+	void visitIfcLightSourcePositional( const IfcLightSourcePositional* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcLightSource( entity, visitor );
+		visitEntity( entity->m_Position, visitor );
+	}
+	void visitIfcLine( const IfcLine* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_Pnt, visitor );
+		visitEntity( entity->m_Dir, visitor );
+	}
+	void visitIfcManifoldSolidBrep( const IfcManifoldSolidBrep* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_Outer, visitor );
+	}
+	void visitIfcOffsetCurve( const IfcOffsetCurve* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_BasisCurve, visitor );
+	}
+	void visitIfcOrientedEdge( const IfcOrientedEdge* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcEdge( entity, visitor );
+		visitEntity( entity->m_EdgeElement, visitor );
+	}
+	void visitIfcPcurve( const IfcPcurve* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_BasisSurface, visitor );
+		visitEntity( entity->m_ReferenceCurve, visitor );
+	}
+	void visitIfcPlanarBox( const IfcPlanarBox* entity, EntityReferenceVisitor& visitor )
+	{
+		visitSelect( entity->m_Placement, visitor );
+	}
+	void visitIfcPointByDistanceExpression( const IfcPointByDistanceExpression* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_BasisCurve, visitor );
+	}
+	void visitIfcPointOnCurve( const IfcPointOnCurve* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_BasisCurve, visitor );
+	}
+	void visitIfcPointOnSurface( const IfcPointOnSurface* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_BasisSurface, visitor );
+	}
+	void visitIfcPolyLoop( const IfcPolyLoop* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_Polygon, visitor );
+	}
+	void visitIfcPolygonalBoundedHalfSpace( const IfcPolygonalBoundedHalfSpace* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcHalfSpaceSolid( entity, visitor );
+		visitEntity( entity->m_Position, visitor );
+		visitEntity( entity->m_PolygonalBoundary, visitor );
+	}
+	void visitIfcPolynomialCurve( const IfcPolynomialCurve* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_Position, visitor );
+	}
+	void visitIfcProduct( const IfcProduct* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRoot( entity, visitor );
+		visitEntity( entity->m_ObjectPlacement, visitor );
+		visitEntity( entity->m_Representation, visitor );
+	}
+	void visitIfcPropertyBoundedValue( const IfcPropertyBoundedValue* entity, EntityReferenceVisitor& visitor )
+	{
+		visitSelect( entity->m_Unit, visitor );
+	}
+	void visitIfcPropertyEnumeratedValue( const IfcPropertyEnumeratedValue* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_EnumerationReference, visitor );
+	}
+	void visitIfcPropertyListValue( const IfcPropertyListValue* entity, EntityReferenceVisitor& visitor )
+	{
+		visitSelect( entity->m_Unit, visitor );
+	}
+	void visitIfcPropertyReferenceValue( const IfcPropertyReferenceValue* entity, EntityReferenceVisitor& visitor )
+	{
+		visitSelect( entity->m_PropertyReference, visitor );
+	}
+	void visitIfcPropertySet( const IfcPropertySet* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRoot( entity, visitor );
+		visitEntity( entity->m_HasProperties, visitor );
+	}
+	void visitIfcPropertySetTemplate( const IfcPropertySetTemplate* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRoot( entity, visitor );
+		visitEntity( entity->m_HasPropertyTemplates, visitor );
+	}
+	void visitIfcPropertySingleValue( const IfcPropertySingleValue* entity, EntityReferenceVisitor& visitor )
+	{
+		visitSelect( entity->m_Unit, visitor );
+	}
+	void visitIfcPropertyTableValue( const IfcPropertyTableValue* entity, EntityReferenceVisitor& visitor )
+	{
+		visitSelect( entity->m_DefiningUnit, visitor );
+		visitSelect( entity->m_DefinedUnit, visitor );
+	}
+	void visitIfcRelAdheresToElement( const IfcRelAdheresToElement* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRoot( entity, visitor );
+		visitEntity( entity->m_RelatingElement, visitor );
+		visitEntity( entity->m_RelatedSurfaceFeatures, visitor );
+	}
+	void visitIfcRelAggregates( const IfcRelAggregates* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRoot( entity, visitor );
+		visitEntity( entity->m_RelatingObject, visitor );
+		visitEntity( entity->m_RelatedObjects, visitor );
+	}
+	void visitIfcRelAssignsToActor( const IfcRelAssignsToActor* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRelAssigns( entity, visitor );
+		visitEntity( entity->m_RelatingActor, visitor );
+		visitEntity( entity->m_ActingRole, visitor );
+	}
+	void visitIfcRelAssignsToControl( const IfcRelAssignsToControl* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRelAssigns( entity, visitor );
+		visitEntity( entity->m_RelatingControl, visitor );
+	}
+	void visitIfcRelAssignsToGroup( const IfcRelAssignsToGroup* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRelAssigns( entity, visitor );
+		visitEntity( entity->m_RelatingGroup, visitor );
+	}
+	void visitIfcRelAssignsToProcess( const IfcRelAssignsToProcess* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRelAssigns( entity, visitor );
+		visitSelect( entity->m_RelatingProcess, visitor );
+		visitEntity( entity->m_QuantityInProcess, visitor );
+	}
+	void visitIfcRelAssignsToProduct( const IfcRelAssignsToProduct* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRelAssigns( entity, visitor );
+		visitSelect( entity->m_RelatingProduct, visitor );
+	}
+	void visitIfcRelAssignsToResource( const IfcRelAssignsToResource* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRelAssigns( entity, visitor );
+		visitSelect( entity->m_RelatingResource, visitor );
+	}
+	void visitIfcRelAssociatesApproval( const IfcRelAssociatesApproval* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRelAssociates( entity, visitor );
+		visitEntity( entity->m_RelatingApproval, visitor );
+	}
+	void visitIfcRelAssociatesClassification( const IfcRelAssociatesClassification* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRelAssociates( entity, visitor );
+		visitSelect( entity->m_RelatingClassification, visitor );
+	}
+	void visitIfcRelAssociatesConstraint( const IfcRelAssociatesConstraint* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRelAssociates( entity, visitor );
+		visitEntity( entity->m_RelatingConstraint, visitor );
+	}
+	void visitIfcRelAssociatesDocument( const IfcRelAssociatesDocument* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRelAssociates( entity, visitor );
+		visitSelect( entity->m_RelatingDocument, visitor );
+	}
+	void visitIfcRelAssociatesLibrary( const IfcRelAssociatesLibrary* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRelAssociates( entity, visitor );
+		visitSelect( entity->m_RelatingLibrary, visitor );
+	}
+	void visitIfcRelAssociatesMaterial( const IfcRelAssociatesMaterial* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRelAssociates( entity, visitor );
+		visitSelect( entity->m_RelatingMaterial, visitor );
+	}
+	void visitIfcRelAssociatesProfileDef( const IfcRelAssociatesProfileDef* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRelAssociates( entity, visitor );
+		visitEntity( entity->m_RelatingProfileDef, visitor );
+	}
+	void visitIfcRelConnectsElements( const IfcRelConnectsElements* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRoot( entity, visitor );
+		visitEntity( entity->m_ConnectionGeometry, visitor );
+		visitEntity( entity->m_RelatingElement, visitor );
+		visitEntity( entity->m_RelatedElement, visitor );
+	}
+	void visitIfcRelConnectsPortToElement( const IfcRelConnectsPortToElement* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRoot( entity, visitor );
+		visitEntity( entity->m_RelatingPort, visitor );
+		visitEntity( entity->m_RelatedElement, visitor );
+	}
+	void visitIfcRelConnectsPorts( const IfcRelConnectsPorts* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRoot( entity, visitor );
+		visitEntity( entity->m_RelatingPort, visitor );
+		visitEntity( entity->m_RelatedPort, visitor );
+		visitEntity( entity->m_RealizingElement, visitor );
+	}
+	void visitIfcRelConnectsStructuralActivity( const IfcRelConnectsStructuralActivity* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRoot( entity, visitor );
+		visitSelect( entity->m_RelatingElement, visitor );
+		visitEntity( entity->m_RelatedStructuralActivity, visitor );
+	}
+	void visitIfcRelConnectsStructuralMember( const IfcRelConnectsStructuralMember* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRoot( entity, visitor );
+		visitEntity( entity->m_RelatingStructuralMember, visitor );
+		visitEntity( entity->m_RelatedStructuralConnection, visitor );
+		visitEntity( entity->m_AppliedCondition, visitor );
+		visitEntity( entity->m_AdditionalConditions, visitor );
+		visitEntity( entity->m_ConditionCoordinateSystem, visitor );
+	}
+	void visitIfcRelContainedInSpatialStructure( const IfcRelContainedInSpatialStructure* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRoot( entity, visitor );
+		visitEntity( entity->m_RelatedElements, visitor );
+		visitEntity( entity->m_RelatingStructure, visitor );
+	}
+	void visitIfcRelCoversBldgElements( const IfcRelCoversBldgElements* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRoot( entity, visitor );
+		visitEntity( entity->m_RelatingBuildingElement, visitor );
+		visitEntity( entity->m_RelatedCoverings, visitor );
+	}
+	void visitIfcRelCoversSpaces( const IfcRelCoversSpaces* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRoot( entity, visitor );
+		visitEntity( entity->m_RelatingSpace, visitor );
+		visitEntity( entity->m_RelatedCoverings, visitor );
+	}
+	void visitIfcRelDefinesByObject( const IfcRelDefinesByObject* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRoot( entity, visitor );
+		visitEntity( entity->m_RelatedObjects, visitor );
+		visitEntity( entity->m_RelatingObject, visitor );
+	}
+	void visitIfcRelDefinesByProperties( const IfcRelDefinesByProperties* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRoot( entity, visitor );
+		visitEntity( entity->m_RelatedObjects, visitor );
+		visitSelect( entity->m_RelatingPropertyDefinition, visitor );
+	}
+	void visitIfcRelDefinesByTemplate( const IfcRelDefinesByTemplate* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRoot( entity, visitor );
+		visitEntity( entity->m_RelatedPropertySets, visitor );
+		visitEntity( entity->m_RelatingTemplate, visitor );
+	}
+	void visitIfcRelDefinesByType( const IfcRelDefinesByType* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRoot( entity, visitor );
+		visitEntity( entity->m_RelatedObjects, visitor );
+		visitEntity( entity->m_RelatingType, visitor );
+	}
+	void visitIfcRelFillsElement( const IfcRelFillsElement* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRoot( entity, visitor );
+		visitEntity( entity->m_RelatingOpeningElement, visitor );
+		visitEntity( entity->m_RelatedBuildingElement, visitor );
+	}
+	void visitIfcRelFlowControlElements( const IfcRelFlowControlElements* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRoot( entity, visitor );
+		visitEntity( entity->m_RelatedControlElements, visitor );
+		visitEntity( entity->m_RelatingFlowElement, visitor );
+	}
+	void visitIfcRelInterferesElements( const IfcRelInterferesElements* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRoot( entity, visitor );
+		visitSelect( entity->m_RelatingElement, visitor );
+		visitSelect( entity->m_RelatedElement, visitor );
+		visitEntity( entity->m_InterferenceGeometry, visitor );
+		visitEntity( entity->m_InterferenceSpace, visitor );
+	}
+	void visitIfcRelNests( const IfcRelNests* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRoot( entity, visitor );
+		visitEntity( entity->m_RelatingObject, visitor );
+		visitEntity( entity->m_RelatedObjects, visitor );
+	}
+	void visitIfcRelPositions( const IfcRelPositions* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRoot( entity, visitor );
+		visitEntity( entity->m_RelatingPositioningElement, visitor );
+		visitEntity( entity->m_RelatedProducts, visitor );
+	}
+	void visitIfcRelProjectsElement( const IfcRelProjectsElement* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRoot( entity, visitor );
+		visitEntity( entity->m_RelatingElement, visitor );
+		visitEntity( entity->m_RelatedFeatureElement, visitor );
+	}
+	void visitIfcRelReferencedInSpatialStructure( const IfcRelReferencedInSpatialStructure* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRoot( entity, visitor );
+		visitSelect( entity->m_RelatedElements, visitor );
+		visitEntity( entity->m_RelatingStructure, visitor );
+	}
+	void visitIfcRelSequence( const IfcRelSequence* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRoot( entity, visitor );
+		visitEntity( entity->m_RelatingProcess, visitor );
+		visitEntity( entity->m_RelatedProcess, visitor );
+		visitEntity( entity->m_TimeLag, visitor );
+	}
+	void visitIfcRelServicesBuildings( const IfcRelServicesBuildings* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRoot( entity, visitor );
+		visitEntity( entity->m_RelatingSystem, visitor );
+		visitEntity( entity->m_RelatedBuildings, visitor );
+	}
+	void visitIfcRelSpaceBoundary( const IfcRelSpaceBoundary* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRoot( entity, visitor );
+		visitSelect( entity->m_RelatingSpace, visitor );
+		visitEntity( entity->m_RelatedBuildingElement, visitor );
+		visitEntity( entity->m_ConnectionGeometry, visitor );
+	}
+	void visitIfcRelVoidsElement( const IfcRelVoidsElement* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRoot( entity, visitor );
+		visitEntity( entity->m_RelatingBuildingElement, visitor );
+		visitEntity( entity->m_RelatedOpeningElement, visitor );
+	}
+	void visitIfcSectionedSolid( const IfcSectionedSolid* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_Directrix, visitor );
+		visitEntity( entity->m_CrossSections, visitor );
+	}
+	void visitIfcSectionedSurface( const IfcSectionedSurface* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_Directrix, visitor );
+		visitEntity( entity->m_CrossSectionPositions, visitor );
+		visitEntity( entity->m_CrossSections, visitor );
+	}
+	void visitIfcSpiral( const IfcSpiral* entity, EntityReferenceVisitor& visitor )
+	{
+		visitSelect( entity->m_Position, visitor );
+	}
+	void visitIfcSubedge( const IfcSubedge* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcEdge( entity, visitor );
+		visitEntity( entity->m_ParentEdge, visitor );
+	}
+	void visitIfcSurfaceCurve( const IfcSurfaceCurve* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_Curve3D, visitor );
+		visitEntity( entity->m_AssociatedGeometry, visitor );
+	}
+	void visitIfcSweptAreaSolid( const IfcSweptAreaSolid* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_SweptArea, visitor );
+		visitEntity( entity->m_Position, visitor );
+	}
+	void visitIfcSweptDiskSolid( const IfcSweptDiskSolid* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_Directrix, visitor );
+	}
+	void visitIfcSweptSurface( const IfcSweptSurface* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_SweptCurve, visitor );
+		visitEntity( entity->m_Position, visitor );
+	}
+	void visitIfcTessellatedFaceSet( const IfcTessellatedFaceSet* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_Coordinates, visitor );
+	}
+	void visitIfcTextLiteralWithExtent( const IfcTextLiteralWithExtent* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcTextLiteral( entity, visitor );
+		visitEntity( entity->m_Extent, visitor );
+	}
+	void visitIfcTypeProduct( const IfcTypeProduct* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcTypeObject( entity, visitor );
+		visitEntity( entity->m_RepresentationMaps, visitor );
+	}
+	void visitIfcVertexLoop( const IfcVertexLoop* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_LoopVertex, visitor );
+	}
+	void visitIfcVertexPoint( const IfcVertexPoint* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_VertexGeometry, visitor );
+	}
+	void visitIfcAsset( const IfcAsset* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRoot( entity, visitor );
+		visitEntity( entity->m_OriginalValue, visitor );
+		visitEntity( entity->m_CurrentValue, visitor );
+		visitEntity( entity->m_TotalReplacementCost, visitor );
+		visitSelect( entity->m_Owner, visitor );
+		visitSelect( entity->m_User, visitor );
+		visitEntity( entity->m_ResponsiblePerson, visitor );
+		visitEntity( entity->m_DepreciatedValue, visitor );
+	}
+	void visitIfcBSplineCurve( const IfcBSplineCurve* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_ControlPointsList, visitor );
+	}
+	void visitIfcBSplineSurface( const IfcBSplineSurface* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_ControlPointsList, visitor );
+	}
+	void visitIfcComplexPropertyTemplate( const IfcComplexPropertyTemplate* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRoot( entity, visitor );
+		visitEntity( entity->m_HasPropertyTemplates, visitor );
+	}
+	void visitIfcCompositeCurve( const IfcCompositeCurve* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_Segments, visitor );
+	}
+	void visitIfcConstructionResource( const IfcConstructionResource* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRoot( entity, visitor );
+		visitEntity( entity->m_Usage, visitor );
+		visitEntity( entity->m_BaseCosts, visitor );
+		visitEntity( entity->m_BaseQuantity, visitor );
+	}
+	void visitIfcConstructionResourceType( const IfcConstructionResourceType* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcTypeObject( entity, visitor );
+		visitEntity( entity->m_BaseCosts, visitor );
+		visitEntity( entity->m_BaseQuantity, visitor );
+	}
+	void visitIfcCostItem( const IfcCostItem* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRoot( entity, visitor );
+		visitEntity( entity->m_CostValues, visitor );
+		visitEntity( entity->m_CostQuantities, visitor );
+	}
+	void visitIfcCurveBoundedPlane( const IfcCurveBoundedPlane* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_BasisSurface, visitor );
+		visitEntity( entity->m_OuterBoundary, visitor );
+		visitEntity( entity->m_InnerBoundaries, visitor );
+	}
+	void visitIfcCurveBoundedSurface( const IfcCurveBoundedSurface* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_BasisSurface, visitor );
+		visitEntity( entity->m_Boundaries, visitor );
+	}
+	void visitIfcDirectrixCurveSweptAreaSolid( const IfcDirectrixCurveSweptAreaSolid* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcSweptAreaSolid( entity, visitor );
+		visitEntity( entity->m_Directrix, visitor );
+	}
+	void visitIfcDoorLiningProperties( const IfcDoorLiningProperties* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRoot( entity, visitor );
+		visitEntity( entity->m_ShapeAspectStyle, visitor );
+	}
+	void visitIfcDoorPanelProperties( const IfcDoorPanelProperties* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRoot( entity, visitor );
+		visitEntity( entity->m_ShapeAspectStyle, visitor );
+	}
+	void visitIfcElementQuantity( const IfcElementQuantity* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRoot( entity, visitor );
+		visitEntity( entity->m_Quantities, visitor );
+	}
+	void visitIfcEvent( const IfcEvent* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRoot( entity, visitor );
+		visitEntity( entity->m_EventOccurenceTime, visitor );
+	}
+	void visitIfcExtrudedAreaSolid( const IfcExtrudedAreaSolid* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcSweptAreaSolid( entity, visitor );
+		visitEntity( entity->m_ExtrudedDirection, visitor );
+	}
+	void visitIfcIndexedPolyCurve( const IfcIndexedPolyCurve* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_Points, visitor );
+	}
+	void visitIfcInventory( const IfcInventory* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRoot( entity, visitor );
+		visitSelect( entity->m_Jurisdiction, visitor );
+		visitEntity( entity->m_ResponsiblePersons, visitor );
+		visitEntity( entity->m_CurrentValue, visitor );
+		visitEntity( entity->m_OriginalValue, visitor );
+	}
+	void visitIfcLightSourceSpot( const IfcLightSourceSpot* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcLightSourcePositional( entity, visitor );
+		visitEntity( entity->m_Orientation, visitor );
+	}
+	void visitIfcOffsetCurve3D( const IfcOffsetCurve3D* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcOffsetCurve( entity, visitor );
+		visitEntity( entity->m_RefDirection, visitor );
+	}
+	void visitIfcOffsetCurveByDistances( const IfcOffsetCurveByDistances* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcOffsetCurve( entity, visitor );
+		visitEntity( entity->m_OffsetValues, visitor );
+	}
+	void visitIfcPermeableCoveringProperties( const IfcPermeableCoveringProperties* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRoot( entity, visitor );
+		visitEntity( entity->m_ShapeAspectStyle, visitor );
+	}
+	void visitIfcPolygonalFaceSet( const IfcPolygonalFaceSet* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcTessellatedFaceSet( entity, visitor );
+		visitEntity( entity->m_Faces, visitor );
+	}
+	void visitIfcPolyline( const IfcPolyline* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_Points, visitor );
+	}
+	void visitIfcRectangularTrimmedSurface( const IfcRectangularTrimmedSurface* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_BasisSurface, visitor );
+	}
+	void visitIfcReinforcementDefinitionProperties( const IfcReinforcementDefinitionProperties* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRoot( entity, visitor );
+		visitEntity( entity->m_ReinforcementSectionDefinitions, visitor );
+	}
+	void visitIfcRelConnectsWithEccentricity( const IfcRelConnectsWithEccentricity* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRelConnectsStructuralMember( entity, visitor );
+		visitEntity( entity->m_ConnectionConstraint, visitor );
+	}
+	void visitIfcRelConnectsWithRealizingElements( const IfcRelConnectsWithRealizingElements* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRelConnectsElements( entity, visitor );
+		visitEntity( entity->m_RealizingElements, visitor );
+	}
+	void visitIfcRelSpaceBoundary1stLevel( const IfcRelSpaceBoundary1stLevel* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRelSpaceBoundary( entity, visitor );
+		visitEntity( entity->m_ParentBoundary, visitor );
+	}
+	void visitIfcRevolvedAreaSolid( const IfcRevolvedAreaSolid* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcSweptAreaSolid( entity, visitor );
+		visitEntity( entity->m_Axis, visitor );
+	}
+	void visitIfcSectionedSolidHorizontal( const IfcSectionedSolidHorizontal* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcSectionedSolid( entity, visitor );
+		visitEntity( entity->m_CrossSectionPositions, visitor );
+	}
+	void visitIfcSimplePropertyTemplate( const IfcSimplePropertyTemplate* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRoot( entity, visitor );
+		visitEntity( entity->m_Enumerators, visitor );
+		visitSelect( entity->m_PrimaryUnit, visitor );
+		visitSelect( entity->m_SecondaryUnit, visitor );
+	}
+	void visitIfcStructuralActivity( const IfcStructuralActivity* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcProduct( entity, visitor );
+		visitEntity( entity->m_AppliedLoad, visitor );
+	}
+	void visitIfcStructuralResultGroup( const IfcStructuralResultGroup* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRoot( entity, visitor );
+		visitEntity( entity->m_ResultForLoadGroup, visitor );
+	}
+	void visitIfcSurfaceOfLinearExtrusion( const IfcSurfaceOfLinearExtrusion* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcSweptSurface( entity, visitor );
+		visitEntity( entity->m_ExtrudedDirection, visitor );
+	}
+	void visitIfcSurfaceOfRevolution( const IfcSurfaceOfRevolution* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcSweptSurface( entity, visitor );
+		visitEntity( entity->m_AxisPosition, visitor );
+	}
+	void visitIfcTask( const IfcTask* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRoot( entity, visitor );
+		visitEntity( entity->m_TaskTime, visitor );
+	}
+	void visitIfcTrimmedCurve( const IfcTrimmedCurve* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_BasisCurve, visitor );
+		visitSelect( entity->m_Trim1, visitor );
+		visitSelect( entity->m_Trim2, visitor );
+	}
+	void visitIfcWindowLiningProperties( const IfcWindowLiningProperties* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRoot( entity, visitor );
+		visitEntity( entity->m_ShapeAspectStyle, visitor );
+	}
+	void visitIfcWindowPanelProperties( const IfcWindowPanelProperties* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRoot( entity, visitor );
+		visitEntity( entity->m_ShapeAspectStyle, visitor );
+	}
+	void visitIfcWorkCalendar( const IfcWorkCalendar* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRoot( entity, visitor );
+		visitEntity( entity->m_WorkingTimes, visitor );
+		visitEntity( entity->m_ExceptionTimes, visitor );
+	}
+	void visitIfcWorkControl( const IfcWorkControl* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRoot( entity, visitor );
+		visitEntity( entity->m_Creators, visitor );
+	}
+	void visitIfcAdvancedBrepWithVoids( const IfcAdvancedBrepWithVoids* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcManifoldSolidBrep( entity, visitor );
+		visitEntity( entity->m_Voids, visitor );
+	}
+	void visitIfcAlignmentSegment( const IfcAlignmentSegment* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcProduct( entity, visitor );
+		visitEntity( entity->m_DesignParameters, visitor );
+	}
+	void visitIfcExtrudedAreaSolidTapered( const IfcExtrudedAreaSolidTapered* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcExtrudedAreaSolid( entity, visitor );
+		visitEntity( entity->m_EndSweptArea, visitor );
+	}
+	void visitIfcFacetedBrepWithVoids( const IfcFacetedBrepWithVoids* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcManifoldSolidBrep( entity, visitor );
+		visitEntity( entity->m_Voids, visitor );
+	}
+	void visitIfcFixedReferenceSweptAreaSolid( const IfcFixedReferenceSweptAreaSolid* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcDirectrixCurveSweptAreaSolid( entity, visitor );
+		visitEntity( entity->m_FixedReference, visitor );
+	}
+	void visitIfcGradientCurve( const IfcGradientCurve* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcCompositeCurve( entity, visitor );
+		visitEntity( entity->m_BaseCurve, visitor );
+		visitEntity( entity->m_EndPoint, visitor );
+	}
+	void visitIfcGrid( const IfcGrid* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcProduct( entity, visitor );
+		visitEntity( entity->m_UAxes, visitor );
+		visitEntity( entity->m_VAxes, visitor );
+		visitEntity( entity->m_WAxes, visitor );
+	}
+	void visitIfcRelSpaceBoundary2ndLevel( const IfcRelSpaceBoundary2ndLevel* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRelSpaceBoundary1stLevel( entity, visitor );
+		visitEntity( entity->m_CorrespondingBoundary, visitor );
+	}
+	void visitIfcRevolvedAreaSolidTapered( const IfcRevolvedAreaSolidTapered* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRevolvedAreaSolid( entity, visitor );
+		visitEntity( entity->m_EndSweptArea, visitor );
+	}
+	void visitIfcSegmentedReferenceCurve( const IfcSegmentedReferenceCurve* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcCompositeCurve( entity, visitor );
+		visitEntity( entity->m_BaseCurve, visitor );
+		visitEntity( entity->m_EndPoint, visitor );
+	}
+	void visitIfcStructuralAnalysisModel( const IfcStructuralAnalysisModel* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcRoot( entity, visitor );
+		visitEntity( entity->m_OrientationOf2DPlane, visitor );
+		visitEntity( entity->m_LoadedBy, visitor );
+		visitEntity( entity->m_HasResults, visitor );
+		visitEntity( entity->m_SharedPlacement, visitor );
+	}
+	void visitIfcStructuralConnection( const IfcStructuralConnection* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcProduct( entity, visitor );
+		visitEntity( entity->m_AppliedCondition, visitor );
+	}
+	void visitIfcSurfaceCurveSweptAreaSolid( const IfcSurfaceCurveSweptAreaSolid* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcDirectrixCurveSweptAreaSolid( entity, visitor );
+		visitEntity( entity->m_ReferenceSurface, visitor );
+	}
+	void visitIfcSite( const IfcSite* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcProduct( entity, visitor );
+		visitEntity( entity->m_SiteAddress, visitor );
+	}
+	void visitIfcStructuralCurveConnection( const IfcStructuralCurveConnection* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcStructuralConnection( entity, visitor );
+		visitEntity( entity->m_AxisDirection, visitor );
+	}
+	void visitIfcStructuralCurveMember( const IfcStructuralCurveMember* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcProduct( entity, visitor );
+		visitEntity( entity->m_Axis, visitor );
+	}
+	void visitIfcStructuralPointConnection( const IfcStructuralPointConnection* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcStructuralConnection( entity, visitor );
+		visitEntity( entity->m_ConditionCoordinateSystem, visitor );
+	}
+	void visitIfcBuilding( const IfcBuilding* entity, EntityReferenceVisitor& visitor )
+	{
+		visitIfcProduct( entity, visitor );
+		visitEntity( entity->m_BuildingAddress, visitor );
+	}
+
+	void visitInverseIfcActorRole( const IfcActorRole* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_HasExternalReference_inverse, visitor );
+	}
+	void visitInverseIfcAddress( const IfcAddress* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_OfPerson_inverse, visitor );
+		visitEntity( entity->m_OfOrganization_inverse, visitor );
+	}
+	void visitInverseIfcAppliedValue( const IfcAppliedValue* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_HasExternalReference_inverse, visitor );
+	}
+	void visitInverseIfcApproval( const IfcApproval* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_HasExternalReferences_inverse, visitor );
+		visitEntity( entity->m_ApprovedObjects_inverse, visitor );
+		visitEntity( entity->m_ApprovedResources_inverse, visitor );
+		visitEntity( entity->m_IsRelatedWith_inverse, visitor );
+		visitEntity( entity->m_Relates_inverse, visitor );
+	}
+	void visitInverseIfcConstraint( const IfcConstraint* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_HasExternalReferences_inverse, visitor );
+		visitEntity( entity->m_PropertiesForConstraint_inverse, visitor );
+	}
+	void visitInverseIfcCoordinateReferenceSystem( const IfcCoordinateReferenceSystem* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_HasCoordinateOperation_inverse, visitor );
+		visitEntity( entity->m_WellKnownText_inverse, visitor );
+	}
+	void visitInverseIfcExternalReference( const IfcExternalReference* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_ExternalReferenceForResources_inverse, visitor );
+	}
+	void visitInverseIfcGridAxis( const IfcGridAxis* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_PartOfW_inverse, visitor );
+		visitEntity( entity->m_PartOfV_inverse, visitor );
+		visitEntity( entity->m_PartOfU_inverse, visitor );
+		visitEntity( entity->m_HasIntersections_inverse, visitor );
+	}
+	void visitInverseIfcMaterialDefinition( const IfcMaterialDefinition* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_AssociatedTo_inverse, visitor );
+		visitEntity( entity->m_HasExternalReferences_inverse, visitor );
+		visitEntity( entity->m_HasProperties_inverse, visitor );
+	}
+	void visitInverseIfcMaterialUsageDefinition( const IfcMaterialUsageDefinition* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_AssociatedTo_inverse, visitor );
+	}
+	void visitInverseIfcObjectPlacement( const IfcObjectPlacement* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_PlacesObject_inverse, visitor );
+		visitEntity( entity->m_ReferencedByPlacements_inverse, visitor );
+	}
+	void visitInverseIfcOrganization( const IfcOrganization* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_IsRelatedBy_inverse, visitor );
+		visitEntity( entity->m_Relates_inverse, visitor );
+		visitEntity( entity->m_Engages_inverse, visitor );
+	}
+	void visitInverseIfcPerson( const IfcPerson* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_EngagedIn_inverse, visitor );
+	}
+	void visitInverseIfcPhysicalQuantity( const IfcPhysicalQuantity* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_HasExternalReferences_inverse, visitor );
+		visitEntity( entity->m_PartOfComplex_inverse, visitor );
+	}
+	void visitInverseIfcProfileDef( const IfcProfileDef* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_HasExternalReference_inverse, visitor );
+		visitEntity( entity->m_HasProperties_inverse, visitor );
+	}
+	void visitInverseIfcPropertyAbstraction( const IfcPropertyAbstraction* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_HasExternalReferences_inverse, visitor );
+	}
+	void visitInverseIfcRepresentation( const IfcRepresentation* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_RepresentationMap_inverse, visitor );
+		visitEntity( entity->m_LayerAssignments_inverse, visitor );
+		visitEntity( entity->m_OfProductRepresentation_inverse, visitor );
+	}
+	void visitInverseIfcRepresentationContext( const IfcRepresentationContext* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_RepresentationsInContext_inverse, visitor );
+	}
+	void visitInverseIfcRepresentationItem( const IfcRepresentationItem* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_LayerAssignment_inverse, visitor );
+		visitEntity( entity->m_StyledByItem_inverse, visitor );
+	}
+	void visitInverseIfcRepresentationMap( const IfcRepresentationMap* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_HasShapeAspects_inverse, visitor );
+		visitEntity( entity->m_MapUsage_inverse, visitor );
+	}
+	void visitInverseIfcShapeAspect( const IfcShapeAspect* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_HasExternalReferences_inverse, visitor );
+	}
+	void visitInverseIfcTextureCoordinateIndices( const IfcTextureCoordinateIndices* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_ToTexMap_inverse, visitor );
+	}
+	void visitInverseIfcTimeSeries( const IfcTimeSeries* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_HasExternalReference_inverse, visitor );
+	}
+	void visitInverseIfcClassification( const IfcClassification* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_ClassificationForObjects_inverse, visitor );
+		visitEntity( entity->m_HasReferences_inverse, visitor );
+	}
+	void visitInverseIfcClassificationReference( const IfcClassificationReference* entity, EntityReferenceVisitor& visitor )
+	{
+		visitInverseIfcExternalReference( entity, visitor );
+		visitEntity( entity->m_ClassificationRefForObjects_inverse, visitor );
+		visitEntity( entity->m_HasReferences_inverse, visitor );
+	}
+	void visitInverseIfcContextDependentUnit( const IfcContextDependentUnit* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_HasExternalReference_inverse, visitor );
+	}
+	void visitInverseIfcConversionBasedUnit( const IfcConversionBasedUnit* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_HasExternalReference_inverse, visitor );
+	}
+	void visitInverseIfcDocumentInformation( const IfcDocumentInformation* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_DocumentInfoForObjects_inverse, visitor );
+		visitEntity( entity->m_HasDocumentReferences_inverse, visitor );
+		visitEntity( entity->m_IsPointedTo_inverse, visitor );
+		visitEntity( entity->m_IsPointer_inverse, visitor );
+	}
+	void visitInverseIfcDocumentReference( const IfcDocumentReference* entity, EntityReferenceVisitor& visitor )
+	{
+		visitInverseIfcExternalReference( entity, visitor );
+		visitEntity( entity->m_DocumentRefForObjects_inverse, visitor );
+	}
+	void visitInverseIfcGeometricRepresentationContext( const IfcGeometricRepresentationContext* entity, EntityReferenceVisitor& visitor )
+	{
+		visitInverseIfcRepresentationContext( entity, visitor );
+		visitEntity( entity->m_HasSubContexts_inverse, visitor );
+		visitEntity( entity->m_HasCoordinateOperation_inverse, visitor );
+	}
+	void visitInverseIfcLibraryInformation( const IfcLibraryInformation* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_LibraryInfoForObjects_inverse, visitor );
+		visitEntity( entity->m_HasLibraryReferences_inverse, visitor );
+	}
+	void visitInverseIfcLibraryReference( const IfcLibraryReference* entity, EntityReferenceVisitor& visitor )
+	{
+		visitInverseIfcExternalReference( entity, visitor );
+		visitEntity( entity->m_LibraryRefForObjects_inverse, visitor );
+	}
+	void visitInverseIfcMaterial( const IfcMaterial* entity, EntityReferenceVisitor& visitor )
+	{
+		visitInverseIfcMaterialDefinition( entity, visitor );
+		visitEntity( entity->m_HasRepresentation_inverse, visitor );
+		visitEntity( entity->m_IsRelatedWith_inverse, visitor );
+		visitEntity( entity->m_RelatesTo_inverse, visitor );
+	}
+	void visitInverseIfcMaterialConstituent( const IfcMaterialConstituent* entity, EntityReferenceVisitor& visitor )
+	{
+		visitInverseIfcMaterialDefinition( entity, visitor );
+		visitEntity( entity->m_ToMaterialConstituentSet_inverse, visitor );
+	}
+	void visitInverseIfcMaterialLayer( const IfcMaterialLayer* entity, EntityReferenceVisitor& visitor )
+	{
+		visitInverseIfcMaterialDefinition( entity, visitor );
+		visitEntity( entity->m_ToMaterialLayerSet_inverse, visitor );
+	}
+	void visitInverseIfcMaterialProfile( const IfcMaterialProfile* entity, EntityReferenceVisitor& visitor )
+	{
+		visitInverseIfcMaterialDefinition( entity, visitor );
+		visitEntity( entity->m_ToMaterialProfileSet_inverse, visitor );
+	}
+	void visitInverseIfcObjectDefinition( const IfcObjectDefinition* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_HasAssignments_inverse, visitor );
+		visitEntity( entity->m_Nests_inverse, visitor );
+		visitEntity( entity->m_IsNestedBy_inverse, visitor );
+		visitEntity( entity->m_HasContext_inverse, visitor );
+		visitEntity( entity->m_IsDecomposedBy_inverse, visitor );
+		visitEntity( entity->m_Decomposes_inverse, visitor );
+		visitEntity( entity->m_HasAssociations_inverse, visitor );
+	}
+	void visitInverseIfcProductDefinitionShape( const IfcProductDefinitionShape* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_ShapeOfProduct_inverse, visitor );
+		visitEntity( entity->m_HasShapeAspects_inverse, visitor );
+	}
+	void visitInverseIfcProperty( const IfcProperty* entity, EntityReferenceVisitor& visitor )
+	{
+		visitInverseIfcPropertyAbstraction( entity, visitor );
+		visitEntity( entity->m_PartOfPset_inverse, visitor );
+		visitEntity( entity->m_PropertyForDependance_inverse, visitor );
+		visitEntity( entity->m_PropertyDependsOn_inverse, visitor );
+		visitEntity( entity->m_PartOfComplex_inverse, visitor );
+		visitEntity( entity->m_HasConstraints_inverse, visitor );
+		visitEntity( entity->m_HasApprovals_inverse, visitor );
+	}
+	void visitInverseIfcPropertyDefinition( const IfcPropertyDefinition* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_HasContext_inverse, visitor );
+		visitEntity( entity->m_HasAssociations_inverse, visitor );
+	}
+	void visitInverseIfcShapeModel( const IfcShapeModel* entity, EntityReferenceVisitor& visitor )
+	{
+		visitInverseIfcRepresentation( entity, visitor );
+		visitEntity( entity->m_OfShapeAspect_inverse, visitor );
+	}
+	void visitInverseIfcSurfaceTexture( const IfcSurfaceTexture* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_IsMappedBy_inverse, visitor );
+		visitEntity( entity->m_UsedInStyles_inverse, visitor );
+	}
+	void visitInverseIfcContext( const IfcContext* entity, EntityReferenceVisitor& visitor )
+	{
+		visitInverseIfcObjectDefinition( entity, visitor );
+		visitEntity( entity->m_IsDefinedBy_inverse, visitor );
+		visitEntity( entity->m_Declares_inverse, visitor );
+	}
+	void visitInverseIfcFace( const IfcFace* entity, EntityReferenceVisitor& visitor )
+	{
+		visitInverseIfcRepresentationItem( entity, visitor );
+		visitEntity( entity->m_HasTextureMaps_inverse, visitor );
+	}
+	void visitInverseIfcObject( const IfcObject* entity, EntityReferenceVisitor& visitor )
+	{
+		visitInverseIfcObjectDefinition( entity, visitor );
+		visitEntity( entity->m_IsDeclaredBy_inverse, visitor );
+		visitEntity( entity->m_Declares_inverse, visitor );
+		visitEntity( entity->m_IsTypedBy_inverse, visitor );
+		visitEntity( entity->m_IsDefinedBy_inverse, visitor );
+	}
+	void visitInverseIfcPropertySetDefinition( const IfcPropertySetDefinition* entity, EntityReferenceVisitor& visitor )
+	{
+		visitInverseIfcPropertyDefinition( entity, visitor );
+		visitEntity( entity->m_DefinesType_inverse, visitor );
+		visitEntity( entity->m_IsDefinedBy_inverse, visitor );
+		visitEntity( entity->m_DefinesOccurrence_inverse, visitor );
+	}
+	void visitInverseIfcSegment( const IfcSegment* entity, EntityReferenceVisitor& visitor )
+	{
+		visitInverseIfcRepresentationItem( entity, visitor );
+		visitEntity( entity->m_UsingCurves_inverse, visitor );
+	}
+	void visitInverseIfcTypeObject( const IfcTypeObject* entity, EntityReferenceVisitor& visitor )
+	{
+		visitInverseIfcObjectDefinition( entity, visitor );
+		visitEntity( entity->m_Types_inverse, visitor );
+	}
+	void visitInverseIfcActor( const IfcActor* entity, EntityReferenceVisitor& visitor )
+	{
+		visitInverseIfcObject( entity, visitor );
+		visitEntity( entity->m_IsActingUpon_inverse, visitor );
+	}
+	void visitInverseIfcControl( const IfcControl* entity, EntityReferenceVisitor& visitor )
+	{
+		visitInverseIfcObject( entity, visitor );
+		visitEntity( entity->m_Controls_inverse, visitor );
+	}
+	void visitInverseIfcGroup( const IfcGroup* entity, EntityReferenceVisitor& visitor )
+	{
+		visitInverseIfcObject( entity, visitor );
+		visitEntity( entity->m_IsGroupedBy_inverse, visitor );
+		visitEntity( entity->m_ReferencedInStructures_inverse, visitor );
+	}
+	void visitInverseIfcIndexedPolygonalFace( const IfcIndexedPolygonalFace* entity, EntityReferenceVisitor& visitor )
+	{
+		visitInverseIfcRepresentationItem( entity, visitor );
+		visitEntity( entity->m_ToFaceSet_inverse, visitor );
+		visitEntity( entity->m_HasTexCoords_inverse, visitor );
+	}
+	void visitInverseIfcProcess( const IfcProcess* entity, EntityReferenceVisitor& visitor )
+	{
+		visitInverseIfcObject( entity, visitor );
+		visitEntity( entity->m_IsPredecessorTo_inverse, visitor );
+		visitEntity( entity->m_IsSuccessorFrom_inverse, visitor );
+		visitEntity( entity->m_OperatesOn_inverse, visitor );
+	}
+	void visitInverseIfcProduct( const IfcProduct* entity, EntityReferenceVisitor& visitor )
+	{
+		visitInverseIfcObject( entity, visitor );
+		visitEntity( entity->m_ReferencedBy_inverse, visitor );
+		visitEntity( entity->m_PositionedRelativeTo_inverse, visitor );
+		visitEntity( entity->m_ReferencedInStructures_inverse, visitor );
+	}
+	void visitInverseIfcPropertySetTemplate( const IfcPropertySetTemplate* entity, EntityReferenceVisitor& visitor )
+	{
+		visitInverseIfcPropertyDefinition( entity, visitor );
+		visitEntity( entity->m_Defines_inverse, visitor );
+	}
+	void visitInverseIfcPropertyTemplate( const IfcPropertyTemplate* entity, EntityReferenceVisitor& visitor )
+	{
+		visitInverseIfcPropertyDefinition( entity, visitor );
+		visitEntity( entity->m_PartOfComplexTemplate_inverse, visitor );
+		visitEntity( entity->m_PartOfPsetTemplate_inverse, visitor );
+	}
+	void visitInverseIfcResource( const IfcResource* entity, EntityReferenceVisitor& visitor )
+	{
+		visitInverseIfcObject( entity, visitor );
+		visitEntity( entity->m_ResourceOf_inverse, visitor );
+	}
+	void visitInverseIfcTessellatedFaceSet( const IfcTessellatedFaceSet* entity, EntityReferenceVisitor& visitor )
+	{
+		visitInverseIfcRepresentationItem( entity, visitor );
+		visitEntity( entity->m_HasColours_inverse, visitor );
+		visitEntity( entity->m_HasTextures_inverse, visitor );
+	}
+	void visitInverseIfcTypeProcess( const IfcTypeProcess* entity, EntityReferenceVisitor& visitor )
+	{
+		visitInverseIfcTypeObject( entity, visitor );
+		visitEntity( entity->m_OperatesOn_inverse, visitor );
+	}
+	void visitInverseIfcTypeProduct( const IfcTypeProduct* entity, EntityReferenceVisitor& visitor )
+	{
+		visitInverseIfcTypeObject( entity, visitor );
+		visitEntity( entity->m_ReferencedBy_inverse, visitor );
+	}
+	void visitInverseIfcTypeResource( const IfcTypeResource* entity, EntityReferenceVisitor& visitor )
+	{
+		visitInverseIfcTypeObject( entity, visitor );
+		visitEntity( entity->m_ResourceOf_inverse, visitor );
+	}
+	void visitInverseIfcAnnotation( const IfcAnnotation* entity, EntityReferenceVisitor& visitor )
+	{
+		visitInverseIfcProduct( entity, visitor );
+		visitEntity( entity->m_ContainedInStructure_inverse, visitor );
+	}
+	void visitInverseIfcElement( const IfcElement* entity, EntityReferenceVisitor& visitor )
+	{
+		visitInverseIfcProduct( entity, visitor );
+		visitEntity( entity->m_FillsVoids_inverse, visitor );
+		visitEntity( entity->m_ConnectedTo_inverse, visitor );
+		visitEntity( entity->m_IsInterferedByElements_inverse, visitor );
+		visitEntity( entity->m_InterferesElements_inverse, visitor );
+		visitEntity( entity->m_HasProjections_inverse, visitor );
+		visitEntity( entity->m_HasOpenings_inverse, visitor );
+		visitEntity( entity->m_IsConnectionRealization_inverse, visitor );
+		visitEntity( entity->m_ProvidesBoundaries_inverse, visitor );
+		visitEntity( entity->m_ConnectedFrom_inverse, visitor );
+		visitEntity( entity->m_ContainedInStructure_inverse, visitor );
+		visitEntity( entity->m_HasCoverings_inverse, visitor );
+		visitEntity( entity->m_HasSurfaceFeatures_inverse, visitor );
+	}
+	void visitInverseIfcPort( const IfcPort* entity, EntityReferenceVisitor& visitor )
+	{
+		visitInverseIfcProduct( entity, visitor );
+		visitEntity( entity->m_ContainedIn_inverse, visitor );
+		visitEntity( entity->m_ConnectedFrom_inverse, visitor );
+		visitEntity( entity->m_ConnectedTo_inverse, visitor );
+	}
+	void visitInverseIfcPositioningElement( const IfcPositioningElement* entity, EntityReferenceVisitor& visitor )
+	{
+		visitInverseIfcProduct( entity, visitor );
+		visitEntity( entity->m_ContainedInStructure_inverse, visitor );
+		visitEntity( entity->m_Positions_inverse, visitor );
+	}
+	void visitInverseIfcRelSpaceBoundary1stLevel( const IfcRelSpaceBoundary1stLevel* entity, EntityReferenceVisitor& visitor )
+	{
+		visitEntity( entity->m_InnerBoundaries_inverse, visitor );
+	}
+	void visitInverseIfcSpatialElement( const IfcSpatialElement* entity, EntityReferenceVisitor& visitor )
+	{
+		visitInverseIfcProduct( entity, visitor );
+		visitEntity( entity->m_ContainsElements_inverse, visitor );
+		visitEntity( entity->m_ServicedBySystems_inverse, visitor );
+		visitEntity( entity->m_ReferencesElements_inverse, visitor );
+		visitEntity( entity->m_IsInterferedByElements_inverse, visitor );
+		visitEntity( entity->m_InterferesElements_inverse, visitor );
+	}
+	void visitInverseIfcStructuralActivity( const IfcStructuralActivity* entity, EntityReferenceVisitor& visitor )
+	{
+		visitInverseIfcProduct( entity, visitor );
+		visitEntity( entity->m_AssignedToStructuralItem_inverse, visitor );
+	}
+	void visitInverseIfcStructuralItem( const IfcStructuralItem* entity, EntityReferenceVisitor& visitor )
+	{
+		visitInverseIfcProduct( entity, visitor );
+		visitEntity( entity->m_AssignedStructuralActivity_inverse, visitor );
+	}
+	void visitInverseIfcStructuralLoadGroup( const IfcStructuralLoadGroup* entity, EntityReferenceVisitor& visitor )
+	{
+		visitInverseIfcGroup( entity, visitor );
+		visitEntity( entity->m_SourceOfResultGroup_inverse, visitor );
+		visitEntity( entity->m_LoadGroupFor_inverse, visitor );
+	}
+	void visitInverseIfcStructuralResultGroup( const IfcStructuralResultGroup* entity, EntityReferenceVisitor& visitor )
+	{
+		visitInverseIfcGroup( entity, visitor );
+		visitEntity( entity->m_ResultGroupFor_inverse, visitor );
+	}
+	void visitInverseIfcSystem( const IfcSystem* entity, EntityReferenceVisitor& visitor )
+	{
+		visitInverseIfcGroup( entity, visitor );
+		visitEntity( entity->m_ServicesBuildings_inverse, visitor );
+		visitEntity( entity->m_ServicesFacilities_inverse, visitor );
+	}
+	void visitInverseIfcDistributionElement( const IfcDistributionElement* entity, EntityReferenceVisitor& visitor )
+	{
+		visitInverseIfcElement( entity, visitor );
+		visitEntity( entity->m_HasPorts_inverse, visitor );
+	}
+	void visitInverseIfcRelSpaceBoundary2ndLevel( const IfcRelSpaceBoundary2ndLevel* entity, EntityReferenceVisitor& visitor )
+	{
+		visitInverseIfcRelSpaceBoundary1stLevel( entity, visitor );
+		visitEntity( entity->m_Corresponds_inverse, visitor );
+	}
+	void visitInverseIfcStructuralConnection( const IfcStructuralConnection* entity, EntityReferenceVisitor& visitor )
+	{
+		visitInverseIfcStructuralItem( entity, visitor );
+		visitEntity( entity->m_ConnectsStructuralMembers_inverse, visitor );
+	}
+	void visitInverseIfcStructuralMember( const IfcStructuralMember* entity, EntityReferenceVisitor& visitor )
+	{
+		visitInverseIfcStructuralItem( entity, visitor );
+		visitEntity( entity->m_ConnectedBy_inverse, visitor );
+	}
+	void visitInverseIfcCovering( const IfcCovering* entity, EntityReferenceVisitor& visitor )
+	{
+		visitInverseIfcElement( entity, visitor );
+		visitEntity( entity->m_CoversSpaces_inverse, visitor );
+		visitEntity( entity->m_CoversElements_inverse, visitor );
+	}
+	void visitInverseIfcDistributionControlElement( const IfcDistributionControlElement* entity, EntityReferenceVisitor& visitor )
+	{
+		visitInverseIfcDistributionElement( entity, visitor );
+		visitEntity( entity->m_AssignedToFlowElement_inverse, visitor );
+	}
+	void visitInverseIfcDistributionFlowElement( const IfcDistributionFlowElement* entity, EntityReferenceVisitor& visitor )
+	{
+		visitInverseIfcDistributionElement( entity, visitor );
+		visitEntity( entity->m_HasControlElements_inverse, visitor );
+	}
+	void visitInverseIfcExternalSpatialElement( const IfcExternalSpatialElement* entity, EntityReferenceVisitor& visitor )
+	{
+		visitInverseIfcSpatialElement( entity, visitor );
+		visitEntity( entity->m_BoundedBy_inverse, visitor );
+	}
+	void visitInverseIfcFeatureElementAddition( const IfcFeatureElementAddition* entity, EntityReferenceVisitor& visitor )
+	{
+		visitInverseIfcElement( entity, visitor );
+		visitEntity( entity->m_ProjectsElements_inverse, visitor );
+	}
+	void visitInverseIfcFeatureElementSubtraction( const IfcFeatureElementSubtraction* entity, EntityReferenceVisitor& visitor )
+	{
+		visitInverseIfcElement( entity, visitor );
+		visitEntity( entity->m_VoidsElements_inverse, visitor );
+	}
+	void visitInverseIfcSpace( const IfcSpace* entity, EntityReferenceVisitor& visitor )
+	{
+		visitInverseIfcSpatialElement( entity, visitor );
+		visitEntity( entity->m_HasCoverings_inverse, visitor );
+		visitEntity( entity->m_BoundedBy_inverse, visitor );
+	}
+	void visitInverseIfcSurfaceFeature( const IfcSurfaceFeature* entity, EntityReferenceVisitor& visitor )
+	{
+		visitInverseIfcElement( entity, visitor );
+		visitEntity( entity->m_AdheresToElement_inverse, visitor );
+	}
+	void visitInverseIfcOpeningElement( const IfcOpeningElement* entity, EntityReferenceVisitor& visitor )
+	{
+		visitInverseIfcFeatureElementSubtraction( entity, visitor );
+		visitEntity( entity->m_HasFillings_inverse, visitor );
+	}
+}
+
+bool EntityReferences::forEachReference( const BuildingEntity* entity, EntityReferenceVisitor& visitor )
+{
+	switch( entity->classID() )
+	{
+	case IFCACTORROLE:
+	case IFCADDRESS:
+	case IFCALIGNMENTCANTSEGMENT:
+	case IFCALIGNMENTPARAMETERSEGMENT:
+	case IFCALIGNMENTVERTICALSEGMENT:
+	case IFCBOUNDARYCONDITION:
+	case IFCBOUNDARYEDGECONDITION:
+	case IFCBOUNDARYFACECONDITION:
+	case IFCBOUNDARYNODECONDITION:
+	case IFCBOUNDARYNODECONDITIONWARPING:
+	case IFCBOUNDEDCURVE:
+	case IFCBOUNDEDSURFACE:
+	case IFCCARTESIANPOINT:
+	case IFCCARTESIANPOINTLIST:
+	case IFCCARTESIANPOINTLIST2D:
+	case IFCCARTESIANPOINTLIST3D:
+	case IFCCLASSIFICATION:
+	case IFCCOLOURRGB:
+	case IFCCOLOURRGBLIST:
+	case IFCCOLOURSPECIFICATION:
+	case IFCCONNECTIONGEOMETRY:
+	case IFCCOORDINATEREFERENCESYSTEM:
+	case IFCCURVE:
+	case IFCCURVESTYLEFONTPATTERN:
+	case IFCDIMENSIONALEXPONENTS:
+	case IFCDIRECTION:
+	case IFCDRAUGHTINGPREDEFINEDCOLOUR:
+	case IFCDRAUGHTINGPREDEFINEDCURVEFONT:
+	case IFCEVENTTIME:
+	case IFCEXTERNALINFORMATION:
+	case IFCEXTERNALREFERENCE:
+	case IFCEXTERNALLYDEFINEDHATCHSTYLE:
+	case IFCEXTERNALLYDEFINEDSURFACESTYLE:
+	case IFCEXTERNALLYDEFINEDTEXTFONT:
+	case IFCFAILURECONNECTIONCONDITION:
+	case IFCGEOMETRICREPRESENTATIONITEM:
+	case IFCINDEXEDPOLYGONALFACE:
+	case IFCINDEXEDPOLYGONALFACEWITHVOIDS:
+	case IFCIRREGULARTIMESERIESVALUE:
+	case IFCLAGTIME:
+	case IFCLIGHTDISTRIBUTIONDATA:
+	case IFCLOOP:
+	case IFCMATERIAL:
+	case IFCMATERIALDEFINITION:
+	case IFCMATERIALUSAGEDEFINITION:
+	case IFCMONETARYUNIT:
+	case IFCPHYSICALQUANTITY:
+	case IFCPLANAREXTENT:
+	case IFCPOINT:
+	case IFCPOSTALADDRESS:
+	case IFCPREDEFINEDCOLOUR:
+	case IFCPREDEFINEDCURVEFONT:
+	case IFCPREDEFINEDITEM:
+	case IFCPREDEFINEDPROPERTIES:
+	case IFCPREDEFINEDTEXTFONT:
+	case IFCPRESENTATIONITEM:
+	case IFCPRESENTATIONSTYLE:
+	case IFCPROFILEDEF:
+	case IFCPROPERTY:
+	case IFCPROPERTYABSTRACTION:
+	case IFCREINFORCEMENTBARPROPERTIES:
+	case IFCREPRESENTATIONCONTEXT:
+	case IFCREPRESENTATIONITEM:
+	case IFCRESOURCELEVELRELATIONSHIP:
+	case IFCRESOURCETIME:
+	case IFCSCHEDULINGTIME:
+	case IFCSEGMENT:
+	case IFCSIMPLEPROPERTY:
+	case IFCSLIPPAGECONNECTIONCONDITION:
+	case IFCSOLIDMODEL:
+	case IFCSTRUCTURALCONNECTIONCONDITION:
+	case IFCSTRUCTURALLOAD:
+	case IFCSTRUCTURALLOADLINEARFORCE:
+	case IFCSTRUCTURALLOADORRESULT:
+	case IFCSTRUCTURALLOADPLANARFORCE:
+	case IFCSTRUCTURALLOADSINGLEDISPLACEMENT:
+	case IFCSTRUCTURALLOADSINGLEDISPLACEMENTDISTORTION:
+	case IFCSTRUCTURALLOADSINGLEFORCE:
+	case IFCSTRUCTURALLOADSINGLEFORCEWARPING:
+	case IFCSTRUCTURALLOADSTATIC:
+	case IFCSTRUCTURALLOADTEMPERATURE:
+	case IFCSURFACE:
+	case IFCSURFACEREINFORCEMENTAREA:
+	case IFCSURFACESTYLEREFRACTION:
+	case IFCTABLEROW:
+	case IFCTASKTIME:
+	case IFCTELECOMADDRESS:
+	case IFCTESSELLATEDITEM:
+	case IFCTEXTSTYLEFONTMODEL:
+	case IFCTEXTSTYLETEXTMODEL:
+	case IFCTEXTUREVERTEX:
+	case IFCTEXTUREVERTEXLIST:
+	case IFCTIMEPERIOD:
+	case IFCTIMESERIESVALUE:
+	case IFCTOPOLOGICALREPRESENTATIONITEM:
+	case IFCVERTEX:
+		return true;
+	case IFCACTOR:
+	case IFCOCCUPANT:
+		visitIfcActor( static_cast<const IfcActor*>( entity ), visitor );
+		return true;
+	case IFCADVANCEDBREPWITHVOIDS:
+		visitIfcAdvancedBrepWithVoids( static_cast<const IfcAdvancedBrepWithVoids*>( entity ), visitor );
+		return true;
+	case IFCALIGNMENTHORIZONTALSEGMENT:
+		visitIfcAlignmentHorizontalSegment( static_cast<const IfcAlignmentHorizontalSegment*>( entity ), visitor );
+		return true;
+	case IFCALIGNMENTSEGMENT:
+		visitIfcAlignmentSegment( static_cast<const IfcAlignmentSegment*>( entity ), visitor );
+		return true;
+	case IFCANNOTATIONFILLAREA:
+		visitIfcAnnotationFillArea( static_cast<const IfcAnnotationFillArea*>( entity ), visitor );
+		return true;
+	case IFCAPPLICATION:
+		visitIfcApplication( static_cast<const IfcApplication*>( entity ), visitor );
+		return true;
+	case IFCAPPLIEDVALUE:
+	case IFCCOSTVALUE:
+		visitIfcAppliedValue( static_cast<const IfcAppliedValue*>( entity ), visitor );
+		return true;
+	case IFCAPPROVAL:
+		visitIfcApproval( static_cast<const IfcApproval*>( entity ), visitor );
+		return true;
+	case IFCAPPROVALRELATIONSHIP:
+		visitIfcApprovalRelationship( static_cast<const IfcApprovalRelationship*>( entity ), visitor );
+		return true;
+	case IFCARBITRARYCLOSEDPROFILEDEF:
+		visitIfcArbitraryClosedProfileDef( static_cast<const IfcArbitraryClosedProfileDef*>( entity ), visitor );
+		return true;
+	case IFCARBITRARYOPENPROFILEDEF:
+	case IFCCENTERLINEPROFILEDEF:
+		visitIfcArbitraryOpenProfileDef( static_cast<const IfcArbitraryOpenProfileDef*>( entity ), visitor );
+		return true;
+	case IFCARBITRARYPROFILEDEFWITHVOIDS:
+		visitIfcArbitraryProfileDefWithVoids( static_cast<const IfcArbitraryProfileDefWithVoids*>( entity ), visitor );
+		return true;
+	case IFCASSET:
+		visitIfcAsset( static_cast<const IfcAsset*>( entity ), visitor );
+		return true;
+	case IFCAXIS1PLACEMENT:
+		visitIfcAxis1Placement( static_cast<const IfcAxis1Placement*>( entity ), visitor );
+		return true;
+	case IFCAXIS2PLACEMENT2D:
+		visitIfcAxis2Placement2D( static_cast<const IfcAxis2Placement2D*>( entity ), visitor );
+		return true;
+	case IFCAXIS2PLACEMENT3D:
+		visitIfcAxis2Placement3D( static_cast<const IfcAxis2Placement3D*>( entity ), visitor );
+		return true;
+	case IFCAXIS2PLACEMENTLINEAR:
+		visitIfcAxis2PlacementLinear( static_cast<const IfcAxis2PlacementLinear*>( entity ), visitor );
+		return true;
+	case IFCBSPLINECURVE:
+	case IFCBSPLINECURVEWITHKNOTS:
+	case IFCRATIONALBSPLINECURVEWITHKNOTS:
+		visitIfcBSplineCurve( static_cast<const IfcBSplineCurve*>( entity ), visitor );
+		return true;
+	case IFCBSPLINESURFACE:
+	case IFCBSPLINESURFACEWITHKNOTS:
+	case IFCRATIONALBSPLINESURFACEWITHKNOTS:
+		visitIfcBSplineSurface( static_cast<const IfcBSplineSurface*>( entity ), visitor );
+		return true;
+	case IFCBOOLEANCLIPPINGRESULT:
+	case IFCBOOLEANRESULT:
+		visitIfcBooleanResult( static_cast<const IfcBooleanResult*>( entity ), visitor );
+		return true;
+	case IFCBOUNDINGBOX:
+		visitIfcBoundingBox( static_cast<const IfcBoundingBox*>( entity ), visitor );
+		return true;
+	case IFCBOXEDHALFSPACE:
+		visitIfcBoxedHalfSpace( static_cast<const IfcBoxedHalfSpace*>( entity ), visitor );
+		return true;
+	case IFCBUILDING:
+		visitIfcBuilding( static_cast<const IfcBuilding*>( entity ), visitor );
+		return true;
+	case IFCCARTESIANTRANSFORMATIONOPERATOR:
+	case IFCCARTESIANTRANSFORMATIONOPERATOR2D:
+	case IFCCARTESIANTRANSFORMATIONOPERATOR2DNONUNIFORM:
+		visitIfcCartesianTransformationOperator( static_cast<const IfcCartesianTransformationOperator*>( entity ), visitor );
+		return true;
+	case IFCCARTESIANTRANSFORMATIONOPERATOR3D:
+	case IFCCARTESIANTRANSFORMATIONOPERATOR3DNONUNIFORM:
+		visitIfcCartesianTransformationOperator3D( static_cast<const IfcCartesianTransformationOperator3D*>( entity ), visitor );
+		return true;
+	case IFCCLASSIFICATIONREFERENCE:
+		visitIfcClassificationReference( static_cast<const IfcClassificationReference*>( entity ), visitor );
+		return true;
+	case IFCCOMPLEXPROPERTY:
+		visitIfcComplexProperty( static_cast<const IfcComplexProperty*>( entity ), visitor );
+		return true;
+	case IFCCOMPLEXPROPERTYTEMPLATE:
+		visitIfcComplexPropertyTemplate( static_cast<const IfcComplexPropertyTemplate*>( entity ), visitor );
+		return true;
+	case IFCBOUNDARYCURVE:
+	case IFCCOMPOSITECURVE:
+	case IFCCOMPOSITECURVEONSURFACE:
+	case IFCOUTERBOUNDARYCURVE:
+		visitIfcCompositeCurve( static_cast<const IfcCompositeCurve*>( entity ), visitor );
+		return true;
+	case IFCCOMPOSITECURVESEGMENT:
+	case IFCREPARAMETRISEDCOMPOSITECURVESEGMENT:
+		visitIfcCompositeCurveSegment( static_cast<const IfcCompositeCurveSegment*>( entity ), visitor );
+		return true;
+	case IFCCOMPOSITEPROFILEDEF:
+		visitIfcCompositeProfileDef( static_cast<const IfcCompositeProfileDef*>( entity ), visitor );
+		return true;
+	case IFCCIRCLE:
+	case IFCCONIC:
+	case IFCELLIPSE:
+		visitIfcConic( static_cast<const IfcConic*>( entity ), visitor );
+		return true;
+	case IFCCLOSEDSHELL:
+	case IFCCONNECTEDFACESET:
+	case IFCOPENSHELL:
+		visitIfcConnectedFaceSet( static_cast<const IfcConnectedFaceSet*>( entity ), visitor );
+		return true;
+	case IFCCONNECTIONCURVEGEOMETRY:
+		visitIfcConnectionCurveGeometry( static_cast<const IfcConnectionCurveGeometry*>( entity ), visitor );
+		return true;
+	case IFCCONNECTIONPOINTECCENTRICITY:
+	case IFCCONNECTIONPOINTGEOMETRY:
+		visitIfcConnectionPointGeometry( static_cast<const IfcConnectionPointGeometry*>( entity ), visitor );
+		return true;
+	case IFCCONNECTIONSURFACEGEOMETRY:
+		visitIfcConnectionSurfaceGeometry( static_cast<const IfcConnectionSurfaceGeometry*>( entity ), visitor );
+		return true;
+	case IFCCONNECTIONVOLUMEGEOMETRY:
+		visitIfcConnectionVolumeGeometry( static_cast<const IfcConnectionVolumeGeometry*>( entity ), visitor );
+		return true;
+	case IFCCONSTRAINT:
+		visitIfcConstraint( static_cast<const IfcConstraint*>( entity ), visitor );
+		return true;
+	case IFCCONSTRUCTIONEQUIPMENTRESOURCE:
+	case IFCCONSTRUCTIONMATERIALRESOURCE:
+	case IFCCONSTRUCTIONPRODUCTRESOURCE:
+	case IFCCONSTRUCTIONRESOURCE:
+	case IFCCREWRESOURCE:
+	case IFCLABORRESOURCE:
+	case IFCSUBCONTRACTRESOURCE:
+		visitIfcConstructionResource( static_cast<const IfcConstructionResource*>( entity ), visitor );
+		return true;
+	case IFCCONSTRUCTIONEQUIPMENTRESOURCETYPE:
+	case IFCCONSTRUCTIONMATERIALRESOURCETYPE:
+	case IFCCONSTRUCTIONPRODUCTRESOURCETYPE:
+	case IFCCONSTRUCTIONRESOURCETYPE:
+	case IFCCREWRESOURCETYPE:
+	case IFCLABORRESOURCETYPE:
+	case IFCSUBCONTRACTRESOURCETYPE:
+		visitIfcConstructionResourceType( static_cast<const IfcConstructionResourceType*>( entity ), visitor );
+		return true;
+	case IFCCONTEXT:
+	case IFCPROJECT:
+	case IFCPROJECTLIBRARY:
+		visitIfcContext( static_cast<const IfcContext*>( entity ), visitor );
+		return true;
+	case IFCCONVERSIONBASEDUNIT:
+	case IFCCONVERSIONBASEDUNITWITHOFFSET:
+		visitIfcConversionBasedUnit( static_cast<const IfcConversionBasedUnit*>( entity ), visitor );
+		return true;
+	case IFCCOORDINATEOPERATION:
+	case IFCMAPCONVERSION:
+	case IFCMAPCONVERSIONSCALED:
+	case IFCRIGIDOPERATION:
+		visitIfcCoordinateOperation( static_cast<const IfcCoordinateOperation*>( entity ), visitor );
+		return true;
+	case IFCCOSTITEM:
+		visitIfcCostItem( static_cast<const IfcCostItem*>( entity ), visitor );
+		return true;
+	case IFCBLOCK:
+	case IFCCSGPRIMITIVE3D:
+	case IFCRECTANGULARPYRAMID:
+	case IFCRIGHTCIRCULARCONE:
+	case IFCRIGHTCIRCULARCYLINDER:
+	case IFCSPHERE:
+		visitIfcCsgPrimitive3D( static_cast<const IfcCsgPrimitive3D*>( entity ), visitor );
+		return true;
+	case IFCCSGSOLID:
+		visitIfcCsgSolid( static_cast<const IfcCsgSolid*>( entity ), visitor );
+		return true;
+	case IFCCURRENCYRELATIONSHIP:
+		visitIfcCurrencyRelationship( static_cast<const IfcCurrencyRelationship*>( entity ), visitor );
+		return true;
+	case IFCCURVEBOUNDEDPLANE:
+		visitIfcCurveBoundedPlane( static_cast<const IfcCurveBoundedPlane*>( entity ), visitor );
+		return true;
+	case IFCCURVEBOUNDEDSURFACE:
+		visitIfcCurveBoundedSurface( static_cast<const IfcCurveBoundedSurface*>( entity ), visitor );
+		return true;
+	case IFCCURVESEGMENT:
+		visitIfcCurveSegment( static_cast<const IfcCurveSegment*>( entity ), visitor );
+		return true;
+	case IFCCURVESTYLE:
+		visitIfcCurveStyle( static_cast<const IfcCurveStyle*>( entity ), visitor );
+		return true;
+	case IFCCURVESTYLEFONT:
+		visitIfcCurveStyleFont( static_cast<const IfcCurveStyleFont*>( entity ), visitor );
+		return true;
+	case IFCCURVESTYLEFONTANDSCALING:
+		visitIfcCurveStyleFontAndScaling( static_cast<const IfcCurveStyleFontAndScaling*>( entity ), visitor );
+		return true;
+	case IFCDERIVEDPROFILEDEF:
+	case IFCMIRROREDPROFILEDEF:
+		visitIfcDerivedProfileDef( static_cast<const IfcDerivedProfileDef*>( entity ), visitor );
+		return true;
+	case IFCDERIVEDUNIT:
+		visitIfcDerivedUnit( static_cast<const IfcDerivedUnit*>( entity ), visitor );
+		return true;
+	case IFCDERIVEDUNITELEMENT:
+		visitIfcDerivedUnitElement( static_cast<const IfcDerivedUnitElement*>( entity ), visitor );
+		return true;
+	case IFCDIRECTRIXCURVESWEPTAREASOLID:
+		visitIfcDirectrixCurveSweptAreaSolid( static_cast<const IfcDirectrixCurveSweptAreaSolid*>( entity ), visitor );
+		return true;
+	case IFCDOCUMENTINFORMATION:
+		visitIfcDocumentInformation( static_cast<const IfcDocumentInformation*>( entity ), visitor );
+		return true;
+	case IFCDOCUMENTINFORMATIONRELATIONSHIP:
+		visitIfcDocumentInformationRelationship( static_cast<const IfcDocumentInformationRelationship*>( entity ), visitor );
+		return true;
+	case IFCDOCUMENTREFERENCE:
+		visitIfcDocumentReference( static_cast<const IfcDocumentReference*>( entity ), visitor );
+		return true;
+	case IFCDOORLININGPROPERTIES:
+		visitIfcDoorLiningProperties( static_cast<const IfcDoorLiningProperties*>( entity ), visitor );
+		return true;
+	case IFCDOORPANELPROPERTIES:
+		visitIfcDoorPanelProperties( static_cast<const IfcDoorPanelProperties*>( entity ), visitor );
+		return true;
+	case IFCEDGE:
+		visitIfcEdge( static_cast<const IfcEdge*>( entity ), visitor );
+		return true;
+	case IFCEDGECURVE:
+		visitIfcEdgeCurve( static_cast<const IfcEdgeCurve*>( entity ), visitor );
+		return true;
+	case IFCEDGELOOP:
+		visitIfcEdgeLoop( static_cast<const IfcEdgeLoop*>( entity ), visitor );
+		return true;
+	case IFCELEMENTQUANTITY:
+		visitIfcElementQuantity( static_cast<const IfcElementQuantity*>( entity ), visitor );
+		return true;
+	case IFCCYLINDRICALSURFACE:
+	case IFCELEMENTARYSURFACE:
+	case IFCPLANE:
+	case IFCSPHERICALSURFACE:
+	case IFCTOROIDALSURFACE:
+		visitIfcElementarySurface( static_cast<const IfcElementarySurface*>( entity ), visitor );
+		return true;
+	case IFCEVENT:
+		visitIfcEvent( static_cast<const IfcEvent*>( entity ), visitor );
+		return true;
+	case IFCEXTENDEDPROPERTIES:
+		visitIfcExtendedProperties( static_cast<const IfcExtendedProperties*>( entity ), visitor );
+		return true;
+	case IFCEXTERNALREFERENCERELATIONSHIP:
+		visitIfcExternalReferenceRelationship( static_cast<const IfcExternalReferenceRelationship*>( entity ), visitor );
+		return true;
+	case IFCEXTRUDEDAREASOLID:
+		visitIfcExtrudedAreaSolid( static_cast<const IfcExtrudedAreaSolid*>( entity ), visitor );
+		return true;
+	case IFCEXTRUDEDAREASOLIDTAPERED:
+		visitIfcExtrudedAreaSolidTapered( static_cast<const IfcExtrudedAreaSolidTapered*>( entity ), visitor );
+		return true;
+	case IFCFACE:
+		visitIfcFace( static_cast<const IfcFace*>( entity ), visitor );
+		return true;
+	case IFCFACEBASEDSURFACEMODEL:
+		visitIfcFaceBasedSurfaceModel( static_cast<const IfcFaceBasedSurfaceModel*>( entity ), visitor );
+		return true;
+	case IFCFACEBOUND:
+	case IFCFACEOUTERBOUND:
+		visitIfcFaceBound( static_cast<const IfcFaceBound*>( entity ), visitor );
+		return true;
+	case IFCADVANCEDFACE:
+	case IFCFACESURFACE:
+		visitIfcFaceSurface( static_cast<const IfcFaceSurface*>( entity ), visitor );
+		return true;
+	case IFCFACETEDBREPWITHVOIDS:
+		visitIfcFacetedBrepWithVoids( static_cast<const IfcFacetedBrepWithVoids*>( entity ), visitor );
+		return true;
+	case IFCFILLAREASTYLE:
+		visitIfcFillAreaStyle( static_cast<const IfcFillAreaStyle*>( entity ), visitor );
+		return true;
+	case IFCFILLAREASTYLEHATCHING:
+		visitIfcFillAreaStyleHatching( static_cast<const IfcFillAreaStyleHatching*>( entity ), visitor );
+		return true;
+	case IFCFILLAREASTYLETILES:
+		visitIfcFillAreaStyleTiles( static_cast<const IfcFillAreaStyleTiles*>( entity ), visitor );
+		return true;
+	case IFCDIRECTRIXDERIVEDREFERENCESWEPTAREASOLID:
+	case IFCFIXEDREFERENCESWEPTAREASOLID:
+		visitIfcFixedReferenceSweptAreaSolid( static_cast<const IfcFixedReferenceSweptAreaSolid*>( entity ), visitor );
+		return true;
+	case IFCGEOGRAPHICCRS:
+		visitIfcGeographicCRS( static_cast<const IfcGeographicCRS*>( entity ), visitor );
+		return true;
+	case IFCGEOMETRICREPRESENTATIONCONTEXT:
+		visitIfcGeometricRepresentationContext( static_cast<const IfcGeometricRepresentationContext*>( entity ), visitor );
+		return true;
+	case IFCGEOMETRICREPRESENTATIONSUBCONTEXT:
+		visitIfcGeometricRepresentationSubContext( static_cast<const IfcGeometricRepresentationSubContext*>( entity ), visitor );
+		return true;
+	case IFCGEOMETRICCURVESET:
+	case IFCGEOMETRICSET:
+		visitIfcGeometricSet( static_cast<const IfcGeometricSet*>( entity ), visitor );
+		return true;
+	case IFCGRADIENTCURVE:
+		visitIfcGradientCurve( static_cast<const IfcGradientCurve*>( entity ), visitor );
+		return true;
+	case IFCGRID:
+		visitIfcGrid( static_cast<const IfcGrid*>( entity ), visitor );
+		return true;
+	case IFCGRIDAXIS:
+		visitIfcGridAxis( static_cast<const IfcGridAxis*>( entity ), visitor );
+		return true;
+	case IFCGRIDPLACEMENT:
+		visitIfcGridPlacement( static_cast<const IfcGridPlacement*>( entity ), visitor );
+		return true;
+	case IFCHALFSPACESOLID:
+		visitIfcHalfSpaceSolid( static_cast<const IfcHalfSpaceSolid*>( entity ), visitor );
+		return true;
+	case IFCINDEXEDCOLOURMAP:
+		visitIfcIndexedColourMap( static_cast<const IfcIndexedColourMap*>( entity ), visitor );
+		return true;
+	case IFCINDEXEDPOLYCURVE:
+		visitIfcIndexedPolyCurve( static_cast<const IfcIndexedPolyCurve*>( entity ), visitor );
+		return true;
+	case IFCINDEXEDPOLYGONALTEXTUREMAP:
+		visitIfcIndexedPolygonalTextureMap( static_cast<const IfcIndexedPolygonalTextureMap*>( entity ), visitor );
+		return true;
+	case IFCINDEXEDTEXTUREMAP:
+	case IFCINDEXEDTRIANGLETEXTUREMAP:
+		visitIfcIndexedTextureMap( static_cast<const IfcIndexedTextureMap*>( entity ), visitor );
+		return true;
+	case IFCINVENTORY:
+		visitIfcInventory( static_cast<const IfcInventory*>( entity ), visitor );
+		return true;
+	case IFCIRREGULARTIMESERIES:
+		visitIfcIrregularTimeSeries( static_cast<const IfcIrregularTimeSeries*>( entity ), visitor );
+		return true;
+	case IFCLIBRARYINFORMATION:
+		visitIfcLibraryInformation( static_cast<const IfcLibraryInformation*>( entity ), visitor );
+		return true;
+	case IFCLIBRARYREFERENCE:
+		visitIfcLibraryReference( static_cast<const IfcLibraryReference*>( entity ), visitor );
+		return true;
+	case IFCLIGHTINTENSITYDISTRIBUTION:
+		visitIfcLightIntensityDistribution( static_cast<const IfcLightIntensityDistribution*>( entity ), visitor );
+		return true;
+	case IFCLIGHTSOURCE:
+	case IFCLIGHTSOURCEAMBIENT:
+		visitIfcLightSource( static_cast<const IfcLightSource*>( entity ), visitor );
+		return true;
+	case IFCLIGHTSOURCEDIRECTIONAL:
+		visitIfcLightSourceDirectional( static_cast<const IfcLightSourceDirectional*>( entity ), visitor );
+		return true;
+	case IFCLIGHTSOURCEGONIOMETRIC:
+		visitIfcLightSourceGoniometric( static_cast<const IfcLightSourceGoniometric*>( entity ), visitor );
+		return true;
+	case IFCLIGHTSOURCEPOSITIONAL:
+		visitIfcLightSourcePositional( static_cast<const IfcLightSourcePositional*>( entity ), visitor );
+		return true;
+	case IFCLIGHTSOURCESPOT:
+		visitIfcLightSourceSpot( static_cast<const IfcLightSourceSpot*>( entity ), visitor );
+		return true;
+	case IFCLINE:
+		visitIfcLine( static_cast<const IfcLine*>( entity ), visitor );
+		return true;
+	case IFCLINEARPLACEMENT:
+		visitIfcLinearPlacement( static_cast<const IfcLinearPlacement*>( entity ), visitor );
+		return true;
+	case IFCLOCALPLACEMENT:
+		visitIfcLocalPlacement( static_cast<const IfcLocalPlacement*>( entity ), visitor );
+		return true;
+	case IFCADVANCEDBREP:
+	case IFCFACETEDBREP:
+	case IFCMANIFOLDSOLIDBREP:
+		visitIfcManifoldSolidBrep( static_cast<const IfcManifoldSolidBrep*>( entity ), visitor );
+		return true;
+	case IFCMAPPEDITEM:
+		visitIfcMappedItem( static_cast<const IfcMappedItem*>( entity ), visitor );
+		return true;
+	case IFCMATERIALCLASSIFICATIONRELATIONSHIP:
+		visitIfcMaterialClassificationRelationship( static_cast<const IfcMaterialClassificationRelationship*>( entity ), visitor );
+		return true;
+	case IFCMATERIALCONSTITUENT:
+		visitIfcMaterialConstituent( static_cast<const IfcMaterialConstituent*>( entity ), visitor );
+		return true;
+	case IFCMATERIALCONSTITUENTSET:
+		visitIfcMaterialConstituentSet( static_cast<const IfcMaterialConstituentSet*>( entity ), visitor );
+		return true;
+	case IFCMATERIALDEFINITIONREPRESENTATION:
+		visitIfcMaterialDefinitionRepresentation( static_cast<const IfcMaterialDefinitionRepresentation*>( entity ), visitor );
+		return true;
+	case IFCMATERIALLAYER:
+	case IFCMATERIALLAYERWITHOFFSETS:
+		visitIfcMaterialLayer( static_cast<const IfcMaterialLayer*>( entity ), visitor );
+		return true;
+	case IFCMATERIALLAYERSET:
+		visitIfcMaterialLayerSet( static_cast<const IfcMaterialLayerSet*>( entity ), visitor );
+		return true;
+	case IFCMATERIALLAYERSETUSAGE:
+		visitIfcMaterialLayerSetUsage( static_cast<const IfcMaterialLayerSetUsage*>( entity ), visitor );
+		return true;
+	case IFCMATERIALLIST:
+		visitIfcMaterialList( static_cast<const IfcMaterialList*>( entity ), visitor );
+		return true;
+	case IFCMATERIALPROFILE:
+	case IFCMATERIALPROFILEWITHOFFSETS:
+		visitIfcMaterialProfile( static_cast<const IfcMaterialProfile*>( entity ), visitor );
+		return true;
+	case IFCMATERIALPROFILESET:
+		visitIfcMaterialProfileSet( static_cast<const IfcMaterialProfileSet*>( entity ), visitor );
+		return true;
+	case IFCMATERIALPROFILESETUSAGE:
+		visitIfcMaterialProfileSetUsage( static_cast<const IfcMaterialProfileSetUsage*>( entity ), visitor );
+		return true;
+	case IFCMATERIALPROFILESETUSAGETAPERING:
+		visitIfcMaterialProfileSetUsageTapering( static_cast<const IfcMaterialProfileSetUsageTapering*>( entity ), visitor );
+		return true;
+	case IFCMATERIALPROPERTIES:
+		visitIfcMaterialProperties( static_cast<const IfcMaterialProperties*>( entity ), visitor );
+		return true;
+	case IFCMATERIALRELATIONSHIP:
+		visitIfcMaterialRelationship( static_cast<const IfcMaterialRelationship*>( entity ), visitor );
+		return true;
+	case IFCMEASUREWITHUNIT:
+		visitIfcMeasureWithUnit( static_cast<const IfcMeasureWithUnit*>( entity ), visitor );
+		return true;
+	case IFCMETRIC:
+		visitIfcMetric( static_cast<const IfcMetric*>( entity ), visitor );
+		return true;
+	case IFCCONTEXTDEPENDENTUNIT:
+	case IFCNAMEDUNIT:
+	case IFCSIUNIT:
+		visitIfcNamedUnit( static_cast<const IfcNamedUnit*>( entity ), visitor );
+		return true;
+	case IFCOBJECTPLACEMENT:
+		visitIfcObjectPlacement( static_cast<const IfcObjectPlacement*>( entity ), visitor );
+		return true;
+	case IFCOBJECTIVE:
+		visitIfcObjective( static_cast<const IfcObjective*>( entity ), visitor );
+		return true;
+	case IFCOFFSETCURVE:
+	case IFCOFFSETCURVE2D:
+		visitIfcOffsetCurve( static_cast<const IfcOffsetCurve*>( entity ), visitor );
+		return true;
+	case IFCOFFSETCURVE3D:
+		visitIfcOffsetCurve3D( static_cast<const IfcOffsetCurve3D*>( entity ), visitor );
+		return true;
+	case IFCOFFSETCURVEBYDISTANCES:
+		visitIfcOffsetCurveByDistances( static_cast<const IfcOffsetCurveByDistances*>( entity ), visitor );
+		return true;
+	case IFCOPENCROSSPROFILEDEF:
+		visitIfcOpenCrossProfileDef( static_cast<const IfcOpenCrossProfileDef*>( entity ), visitor );
+		return true;
+	case IFCORGANIZATION:
+		visitIfcOrganization( static_cast<const IfcOrganization*>( entity ), visitor );
+		return true;
+	case IFCORGANIZATIONRELATIONSHIP:
+		visitIfcOrganizationRelationship( static_cast<const IfcOrganizationRelationship*>( entity ), visitor );
+		return true;
+	case IFCORIENTEDEDGE:
+		visitIfcOrientedEdge( static_cast<const IfcOrientedEdge*>( entity ), visitor );
+		return true;
+	case IFCOWNERHISTORY:
+		visitIfcOwnerHistory( static_cast<const IfcOwnerHistory*>( entity ), visitor );
+		return true;
+	case IFCASYMMETRICISHAPEPROFILEDEF:
+	case IFCCSHAPEPROFILEDEF:
+	case IFCCIRCLEHOLLOWPROFILEDEF:
+	case IFCCIRCLEPROFILEDEF:
+	case IFCELLIPSEPROFILEDEF:
+	case IFCISHAPEPROFILEDEF:
+	case IFCLSHAPEPROFILEDEF:
+	case IFCPARAMETERIZEDPROFILEDEF:
+	case IFCRECTANGLEHOLLOWPROFILEDEF:
+	case IFCRECTANGLEPROFILEDEF:
+	case IFCROUNDEDRECTANGLEPROFILEDEF:
+	case IFCTSHAPEPROFILEDEF:
+	case IFCTRAPEZIUMPROFILEDEF:
+	case IFCUSHAPEPROFILEDEF:
+	case IFCZSHAPEPROFILEDEF:
+		visitIfcParameterizedProfileDef( static_cast<const IfcParameterizedProfileDef*>( entity ), visitor );
+		return true;
+	case IFCPATH:
+		visitIfcPath( static_cast<const IfcPath*>( entity ), visitor );
+		return true;
+	case IFCPCURVE:
+		visitIfcPcurve( static_cast<const IfcPcurve*>( entity ), visitor );
+		return true;
+	case IFCPERMEABLECOVERINGPROPERTIES:
+		visitIfcPermeableCoveringProperties( static_cast<const IfcPermeableCoveringProperties*>( entity ), visitor );
+		return true;
+	case IFCPERSON:
+		visitIfcPerson( static_cast<const IfcPerson*>( entity ), visitor );
+		return true;
+	case IFCPERSONANDORGANIZATION:
+		visitIfcPersonAndOrganization( static_cast<const IfcPersonAndOrganization*>( entity ), visitor );
+		return true;
+	case IFCPHYSICALCOMPLEXQUANTITY:
+		visitIfcPhysicalComplexQuantity( static_cast<const IfcPhysicalComplexQuantity*>( entity ), visitor );
+		return true;
+	case IFCPHYSICALSIMPLEQUANTITY:
+	case IFCQUANTITYAREA:
+	case IFCQUANTITYCOUNT:
+	case IFCQUANTITYLENGTH:
+	case IFCQUANTITYNUMBER:
+	case IFCQUANTITYTIME:
+	case IFCQUANTITYVOLUME:
+	case IFCQUANTITYWEIGHT:
+		visitIfcPhysicalSimpleQuantity( static_cast<const IfcPhysicalSimpleQuantity*>( entity ), visitor );
+		return true;
+	case IFCPLACEMENT:
+		visitIfcPlacement( static_cast<const IfcPlacement*>( entity ), visitor );
+		return true;
+	case IFCPLANARBOX:
+		visitIfcPlanarBox( static_cast<const IfcPlanarBox*>( entity ), visitor );
+		return true;
+	case IFCPOINTBYDISTANCEEXPRESSION:
+		visitIfcPointByDistanceExpression( static_cast<const IfcPointByDistanceExpression*>( entity ), visitor );
+		return true;
+	case IFCPOINTONCURVE:
+		visitIfcPointOnCurve( static_cast<const IfcPointOnCurve*>( entity ), visitor );
+		return true;
+	case IFCPOINTONSURFACE:
+		visitIfcPointOnSurface( static_cast<const IfcPointOnSurface*>( entity ), visitor );
+		return true;
+	case IFCPOLYLOOP:
+		visitIfcPolyLoop( static_cast<const IfcPolyLoop*>( entity ), visitor );
+		return true;
+	case IFCPOLYGONALBOUNDEDHALFSPACE:
+		visitIfcPolygonalBoundedHalfSpace( static_cast<const IfcPolygonalBoundedHalfSpace*>( entity ), visitor );
+		return true;
+	case IFCPOLYGONALFACESET:
+		visitIfcPolygonalFaceSet( static_cast<const IfcPolygonalFaceSet*>( entity ), visitor );
+		return true;
+	case IFCPOLYLINE:
+		visitIfcPolyline( static_cast<const IfcPolyline*>( entity ), visitor );
+		return true;
+	case IFCPOLYNOMIALCURVE:
+		visitIfcPolynomialCurve( static_cast<const IfcPolynomialCurve*>( entity ), visitor );
+		return true;
+	case IFCPRESENTATIONLAYERASSIGNMENT:
+		visitIfcPresentationLayerAssignment( static_cast<const IfcPresentationLayerAssignment*>( entity ), visitor );
+		return true;
+	case IFCPRESENTATIONLAYERWITHSTYLE:
+		visitIfcPresentationLayerWithStyle( static_cast<const IfcPresentationLayerWithStyle*>( entity ), visitor );
+		return true;
+	case IFCPRESENTATIONSTYLEASSIGNMENT:
+		visitIfcPresentationStyleAssignment( static_cast<const IfcPresentationStyleAssignment*>( entity ), visitor );
+		return true;
+	case IFCACTUATOR:
+	case IFCAIRTERMINAL:
+	case IFCAIRTERMINALBOX:
+	case IFCAIRTOAIRHEATRECOVERY:
+	case IFCALARM:
+	case IFCALIGNMENT:
+	case IFCALIGNMENTCANT:
+	case IFCALIGNMENTHORIZONTAL:
+	case IFCALIGNMENTVERTICAL:
+	case IFCANNOTATION:
+	case IFCAUDIOVISUALAPPLIANCE:
+	case IFCBEAM:
+	case IFCBEARING:
+	case IFCBOILER:
+	case IFCBOREHOLE:
+	case IFCBRIDGE:
+	case IFCBRIDGEPART:
+	case IFCBUILDINGELEMENTPART:
+	case IFCBUILDINGELEMENTPROXY:
+	case IFCBUILDINGSTOREY:
+	case IFCBUILTELEMENT:
+	case IFCBURNER:
+	case IFCCABLECARRIERFITTING:
+	case IFCCABLECARRIERSEGMENT:
+	case IFCCABLEFITTING:
+	case IFCCABLESEGMENT:
+	case IFCCAISSONFOUNDATION:
+	case IFCCHILLER:
+	case IFCCHIMNEY:
+	case IFCCIVILELEMENT:
+	case IFCCOIL:
+	case IFCCOLUMN:
+	case IFCCOMMUNICATIONSAPPLIANCE:
+	case IFCCOMPRESSOR:
+	case IFCCONDENSER:
+	case IFCCONTROLLER:
+	case IFCCONVEYORSEGMENT:
+	case IFCCOOLEDBEAM:
+	case IFCCOOLINGTOWER:
+	case IFCCOURSE:
+	case IFCCOVERING:
+	case IFCCURTAINWALL:
+	case IFCDAMPER:
+	case IFCDEEPFOUNDATION:
+	case IFCDISCRETEACCESSORY:
+	case IFCDISTRIBUTIONBOARD:
+	case IFCDISTRIBUTIONCHAMBERELEMENT:
+	case IFCDISTRIBUTIONCONTROLELEMENT:
+	case IFCDISTRIBUTIONELEMENT:
+	case IFCDISTRIBUTIONFLOWELEMENT:
+	case IFCDISTRIBUTIONPORT:
+	case IFCDOOR:
+	case IFCDUCTFITTING:
+	case IFCDUCTSEGMENT:
+	case IFCDUCTSILENCER:
+	case IFCEARTHWORKSCUT:
+	case IFCEARTHWORKSELEMENT:
+	case IFCEARTHWORKSFILL:
+	case IFCELECTRICAPPLIANCE:
+	case IFCELECTRICDISTRIBUTIONBOARD:
+	case IFCELECTRICFLOWSTORAGEDEVICE:
+	case IFCELECTRICFLOWTREATMENTDEVICE:
+	case IFCELECTRICGENERATOR:
+	case IFCELECTRICMOTOR:
+	case IFCELECTRICTIMECONTROL:
+	case IFCELEMENT:
+	case IFCELEMENTASSEMBLY:
+	case IFCELEMENTCOMPONENT:
+	case IFCENERGYCONVERSIONDEVICE:
+	case IFCENGINE:
+	case IFCEVAPORATIVECOOLER:
+	case IFCEVAPORATOR:
+	case IFCEXTERNALSPATIALELEMENT:
+	case IFCEXTERNALSPATIALSTRUCTUREELEMENT:
+	case IFCFACILITY:
+	case IFCFACILITYPART:
+	case IFCFACILITYPARTCOMMON:
+	case IFCFAN:
+	case IFCFASTENER:
+	case IFCFEATUREELEMENT:
+	case IFCFEATUREELEMENTADDITION:
+	case IFCFEATUREELEMENTSUBTRACTION:
+	case IFCFILTER:
+	case IFCFIRESUPPRESSIONTERMINAL:
+	case IFCFLOWCONTROLLER:
+	case IFCFLOWFITTING:
+	case IFCFLOWINSTRUMENT:
+	case IFCFLOWMETER:
+	case IFCFLOWMOVINGDEVICE:
+	case IFCFLOWSEGMENT:
+	case IFCFLOWSTORAGEDEVICE:
+	case IFCFLOWTERMINAL:
+	case IFCFLOWTREATMENTDEVICE:
+	case IFCFOOTING:
+	case IFCFURNISHINGELEMENT:
+	case IFCFURNITURE:
+	case IFCGEOGRAPHICELEMENT:
+	case IFCGEOMODEL:
+	case IFCGEOSLICE:
+	case IFCGEOTECHNICALASSEMBLY:
+	case IFCGEOTECHNICALELEMENT:
+	case IFCGEOTECHNICALSTRATUM:
+	case IFCHEATEXCHANGER:
+	case IFCHUMIDIFIER:
+	case IFCIMPACTPROTECTIONDEVICE:
+	case IFCINTERCEPTOR:
+	case IFCJUNCTIONBOX:
+	case IFCKERB:
+	case IFCLAMP:
+	case IFCLIGHTFIXTURE:
+	case IFCLINEARELEMENT:
+	case IFCLINEARPOSITIONINGELEMENT:
+	case IFCLIQUIDTERMINAL:
+	case IFCMARINEFACILITY:
+	case IFCMARINEPART:
+	case IFCMECHANICALFASTENER:
+	case IFCMEDICALDEVICE:
+	case IFCMEMBER:
+	case IFCMOBILETELECOMMUNICATIONSAPPLIANCE:
+	case IFCMOORINGDEVICE:
+	case IFCMOTORCONNECTION:
+	case IFCNAVIGATIONELEMENT:
+	case IFCOPENINGELEMENT:
+	case IFCOUTLET:
+	case IFCPAVEMENT:
+	case IFCPILE:
+	case IFCPIPEFITTING:
+	case IFCPIPESEGMENT:
+	case IFCPLATE:
+	case IFCPORT:
+	case IFCPOSITIONINGELEMENT:
+	case IFCPRODUCT:
+	case IFCPROJECTIONELEMENT:
+	case IFCPROTECTIVEDEVICE:
+	case IFCPROTECTIVEDEVICETRIPPINGUNIT:
+	case IFCPUMP:
+	case IFCRAIL:
+	case IFCRAILING:
+	case IFCRAILWAY:
+	case IFCRAILWAYPART:
+	case IFCRAMP:
+	case IFCRAMPFLIGHT:
+	case IFCREFERENT:
+	case IFCREINFORCEDSOIL:
+	case IFCREINFORCINGBAR:
+	case IFCREINFORCINGELEMENT:
+	case IFCREINFORCINGMESH:
+	case IFCROAD:
+	case IFCROADPART:
+	case IFCROOF:
+	case IFCSANITARYTERMINAL:
+	case IFCSENSOR:
+	case IFCSHADINGDEVICE:
+	case IFCSIGN:
+	case IFCSIGNAL:
+	case IFCSLAB:
+	case IFCSOLARDEVICE:
+	case IFCSPACE:
+	case IFCSPACEHEATER:
+	case IFCSPATIALELEMENT:
+	case IFCSPATIALSTRUCTUREELEMENT:
+	case IFCSPATIALZONE:
+	case IFCSTACKTERMINAL:
+	case IFCSTAIR:
+	case IFCSTAIRFLIGHT:
+	case IFCSTRUCTURALITEM:
+	case IFCSTRUCTURALMEMBER:
+	case IFCSTRUCTURALSURFACEMEMBER:
+	case IFCSTRUCTURALSURFACEMEMBERVARYING:
+	case IFCSURFACEFEATURE:
+	case IFCSWITCHINGDEVICE:
+	case IFCSYSTEMFURNITUREELEMENT:
+	case IFCTANK:
+	case IFCTENDON:
+	case IFCTENDONANCHOR:
+	case IFCTENDONCONDUIT:
+	case IFCTRACKELEMENT:
+	case IFCTRANSFORMER:
+	case IFCTRANSPORTELEMENT:
+	case IFCTRANSPORTATIONDEVICE:
+	case IFCTUBEBUNDLE:
+	case IFCUNITARYCONTROLELEMENT:
+	case IFCUNITARYEQUIPMENT:
+	case IFCVALVE:
+	case IFCVEHICLE:
+	case IFCVIBRATIONDAMPER:
+	case IFCVIBRATIONISOLATOR:
+	case IFCVIRTUALELEMENT:
+	case IFCVOIDINGFEATURE:
+	case IFCWALL:
+	case IFCWALLSTANDARDCASE:
+	case IFCWASTETERMINAL:
+	case IFCWINDOW:
+		visitIfcProduct( static_cast<const IfcProduct*>( entity ), visitor );
+		return true;
+	case IFCPRODUCTDEFINITIONSHAPE:
+	case IFCPRODUCTREPRESENTATION:
+		visitIfcProductRepresentation( static_cast<const IfcProductRepresentation*>( entity ), visitor );
+		return true;
+	case IFCPROFILEPROPERTIES:
+		visitIfcProfileProperties( static_cast<const IfcProfileProperties*>( entity ), visitor );
+		return true;
+	case IFCPROJECTEDCRS:
+		visitIfcProjectedCRS( static_cast<const IfcProjectedCRS*>( entity ), visitor );
+		return true;
+	case IFCPROPERTYBOUNDEDVALUE:
+		visitIfcPropertyBoundedValue( static_cast<const IfcPropertyBoundedValue*>( entity ), visitor );
+		return true;
+	case IFCPROPERTYDEPENDENCYRELATIONSHIP:
+		visitIfcPropertyDependencyRelationship( static_cast<const IfcPropertyDependencyRelationship*>( entity ), visitor );
+		return true;
+	case IFCPROPERTYENUMERATEDVALUE:
+		visitIfcPropertyEnumeratedValue( static_cast<const IfcPropertyEnumeratedValue*>( entity ), visitor );
+		return true;
+	case IFCPROPERTYENUMERATION:
+		visitIfcPropertyEnumeration( static_cast<const IfcPropertyEnumeration*>( entity ), visitor );
+		return true;
+	case IFCPROPERTYLISTVALUE:
+		visitIfcPropertyListValue( static_cast<const IfcPropertyListValue*>( entity ), visitor );
+		return true;
+	case IFCPROPERTYREFERENCEVALUE:
+		visitIfcPropertyReferenceValue( static_cast<const IfcPropertyReferenceValue*>( entity ), visitor );
+		return true;
+	case IFCPROPERTYSET:
+		visitIfcPropertySet( static_cast<const IfcPropertySet*>( entity ), visitor );
+		return true;
+	case IFCPROPERTYSETTEMPLATE:
+		visitIfcPropertySetTemplate( static_cast<const IfcPropertySetTemplate*>( entity ), visitor );
+		return true;
+	case IFCPROPERTYSINGLEVALUE:
+		visitIfcPropertySingleValue( static_cast<const IfcPropertySingleValue*>( entity ), visitor );
+		return true;
+	case IFCPROPERTYTABLEVALUE:
+		visitIfcPropertyTableValue( static_cast<const IfcPropertyTableValue*>( entity ), visitor );
+		return true;
+	case IFCRECTANGULARTRIMMEDSURFACE:
+		visitIfcRectangularTrimmedSurface( static_cast<const IfcRectangularTrimmedSurface*>( entity ), visitor );
+		return true;
+	case IFCRECURRENCEPATTERN:
+		visitIfcRecurrencePattern( static_cast<const IfcRecurrencePattern*>( entity ), visitor );
+		return true;
+	case IFCREFERENCE:
+		visitIfcReference( static_cast<const IfcReference*>( entity ), visitor );
+		return true;
+	case IFCREGULARTIMESERIES:
+		visitIfcRegularTimeSeries( static_cast<const IfcRegularTimeSeries*>( entity ), visitor );
+		return true;
+	case IFCREINFORCEMENTDEFINITIONPROPERTIES:
+		visitIfcReinforcementDefinitionProperties( static_cast<const IfcReinforcementDefinitionProperties*>( entity ), visitor );
+		return true;
+	case IFCRELADHERESTOELEMENT:
+		visitIfcRelAdheresToElement( static_cast<const IfcRelAdheresToElement*>( entity ), visitor );
+		return true;
+	case IFCRELAGGREGATES:
+		visitIfcRelAggregates( static_cast<const IfcRelAggregates*>( entity ), visitor );
+		return true;
+	case IFCRELASSIGNS:
+		visitIfcRelAssigns( static_cast<const IfcRelAssigns*>( entity ), visitor );
+		return true;
+	case IFCRELASSIGNSTOACTOR:
+		visitIfcRelAssignsToActor( static_cast<const IfcRelAssignsToActor*>( entity ), visitor );
+		return true;
+	case IFCRELASSIGNSTOCONTROL:
+		visitIfcRelAssignsToControl( static_cast<const IfcRelAssignsToControl*>( entity ), visitor );
+		return true;
+	case IFCRELASSIGNSTOGROUP:
+	case IFCRELASSIGNSTOGROUPBYFACTOR:
+		visitIfcRelAssignsToGroup( static_cast<const IfcRelAssignsToGroup*>( entity ), visitor );
+		return true;
+	case IFCRELASSIGNSTOPROCESS:
+		visitIfcRelAssignsToProcess( static_cast<const IfcRelAssignsToProcess*>( entity ), visitor );
+		return true;
+	case IFCRELASSIGNSTOPRODUCT:
+		visitIfcRelAssignsToProduct( static_cast<const IfcRelAssignsToProduct*>( entity ), visitor );
+		return true;
+	case IFCRELASSIGNSTORESOURCE:
+		visitIfcRelAssignsToResource( static_cast<const IfcRelAssignsToResource*>( entity ), visitor );
+		return true;
+	case IFCRELASSOCIATES:
+		visitIfcRelAssociates( static_cast<const IfcRelAssociates*>( entity ), visitor );
+		return true;
+	case IFCRELASSOCIATESAPPROVAL:
+		visitIfcRelAssociatesApproval( static_cast<const IfcRelAssociatesApproval*>( entity ), visitor );
+		return true;
+	case IFCRELASSOCIATESCLASSIFICATION:
+		visitIfcRelAssociatesClassification( static_cast<const IfcRelAssociatesClassification*>( entity ), visitor );
+		return true;
+	case IFCRELASSOCIATESCONSTRAINT:
+		visitIfcRelAssociatesConstraint( static_cast<const IfcRelAssociatesConstraint*>( entity ), visitor );
+		return true;
+	case IFCRELASSOCIATESDOCUMENT:
+		visitIfcRelAssociatesDocument( static_cast<const IfcRelAssociatesDocument*>( entity ), visitor );
+		return true;
+	case IFCRELASSOCIATESLIBRARY:
+		visitIfcRelAssociatesLibrary( static_cast<const IfcRelAssociatesLibrary*>( entity ), visitor );
+		return true;
+	case IFCRELASSOCIATESMATERIAL:
+		visitIfcRelAssociatesMaterial( static_cast<const IfcRelAssociatesMaterial*>( entity ), visitor );
+		return true;
+	case IFCRELASSOCIATESPROFILEDEF:
+		visitIfcRelAssociatesProfileDef( static_cast<const IfcRelAssociatesProfileDef*>( entity ), visitor );
+		return true;
+	case IFCRELCONNECTSELEMENTS:
+	case IFCRELCONNECTSPATHELEMENTS:
+		visitIfcRelConnectsElements( static_cast<const IfcRelConnectsElements*>( entity ), visitor );
+		return true;
+	case IFCRELCONNECTSPORTTOELEMENT:
+		visitIfcRelConnectsPortToElement( static_cast<const IfcRelConnectsPortToElement*>( entity ), visitor );
+		return true;
+	case IFCRELCONNECTSPORTS:
+		visitIfcRelConnectsPorts( static_cast<const IfcRelConnectsPorts*>( entity ), visitor );
+		return true;
+	case IFCRELCONNECTSSTRUCTURALACTIVITY:
+		visitIfcRelConnectsStructuralActivity( static_cast<const IfcRelConnectsStructuralActivity*>( entity ), visitor );
+		return true;
+	case IFCRELCONNECTSSTRUCTURALMEMBER:
+		visitIfcRelConnectsStructuralMember( static_cast<const IfcRelConnectsStructuralMember*>( entity ), visitor );
+		return true;
+	case IFCRELCONNECTSWITHECCENTRICITY:
+		visitIfcRelConnectsWithEccentricity( static_cast<const IfcRelConnectsWithEccentricity*>( entity ), visitor );
+		return true;
+	case IFCRELCONNECTSWITHREALIZINGELEMENTS:
+		visitIfcRelConnectsWithRealizingElements( static_cast<const IfcRelConnectsWithRealizingElements*>( entity ), visitor );
+		return true;
+	case IFCRELCONTAINEDINSPATIALSTRUCTURE:
+		visitIfcRelContainedInSpatialStructure( static_cast<const IfcRelContainedInSpatialStructure*>( entity ), visitor );
+		return true;
+	case IFCRELCOVERSBLDGELEMENTS:
+		visitIfcRelCoversBldgElements( static_cast<const IfcRelCoversBldgElements*>( entity ), visitor );
+		return true;
+	case IFCRELCOVERSSPACES:
+		visitIfcRelCoversSpaces( static_cast<const IfcRelCoversSpaces*>( entity ), visitor );
+		return true;
+	case IFCRELDECLARES:
+		visitIfcRelDeclares( static_cast<const IfcRelDeclares*>( entity ), visitor );
+		return true;
+	case IFCRELDEFINESBYOBJECT:
+		visitIfcRelDefinesByObject( static_cast<const IfcRelDefinesByObject*>( entity ), visitor );
+		return true;
+	case IFCRELDEFINESBYPROPERTIES:
+		visitIfcRelDefinesByProperties( static_cast<const IfcRelDefinesByProperties*>( entity ), visitor );
+		return true;
+	case IFCRELDEFINESBYTEMPLATE:
+		visitIfcRelDefinesByTemplate( static_cast<const IfcRelDefinesByTemplate*>( entity ), visitor );
+		return true;
+	case IFCRELDEFINESBYTYPE:
+		visitIfcRelDefinesByType( static_cast<const IfcRelDefinesByType*>( entity ), visitor );
+		return true;
+	case IFCRELFILLSELEMENT:
+		visitIfcRelFillsElement( static_cast<const IfcRelFillsElement*>( entity ), visitor );
+		return true;
+	case IFCRELFLOWCONTROLELEMENTS:
+		visitIfcRelFlowControlElements( static_cast<const IfcRelFlowControlElements*>( entity ), visitor );
+		return true;
+	case IFCRELINTERFERESELEMENTS:
+		visitIfcRelInterferesElements( static_cast<const IfcRelInterferesElements*>( entity ), visitor );
+		return true;
+	case IFCRELNESTS:
+		visitIfcRelNests( static_cast<const IfcRelNests*>( entity ), visitor );
+		return true;
+	case IFCRELPOSITIONS:
+		visitIfcRelPositions( static_cast<const IfcRelPositions*>( entity ), visitor );
+		return true;
+	case IFCRELPROJECTSELEMENT:
+		visitIfcRelProjectsElement( static_cast<const IfcRelProjectsElement*>( entity ), visitor );
+		return true;
+	case IFCRELREFERENCEDINSPATIALSTRUCTURE:
+		visitIfcRelReferencedInSpatialStructure( static_cast<const IfcRelReferencedInSpatialStructure*>( entity ), visitor );
+		return true;
+	case IFCRELSEQUENCE:
+		visitIfcRelSequence( static_cast<const IfcRelSequence*>( entity ), visitor );
+		return true;
+	case IFCRELSERVICESBUILDINGS:
+		visitIfcRelServicesBuildings( static_cast<const IfcRelServicesBuildings*>( entity ), visitor );
+		return true;
+	case IFCRELSPACEBOUNDARY:
+		visitIfcRelSpaceBoundary( static_cast<const IfcRelSpaceBoundary*>( entity ), visitor );
+		return true;
+	case IFCRELSPACEBOUNDARY1STLEVEL:
+		visitIfcRelSpaceBoundary1stLevel( static_cast<const IfcRelSpaceBoundary1stLevel*>( entity ), visitor );
+		return true;
+	case IFCRELSPACEBOUNDARY2NDLEVEL:
+		visitIfcRelSpaceBoundary2ndLevel( static_cast<const IfcRelSpaceBoundary2ndLevel*>( entity ), visitor );
+		return true;
+	case IFCRELVOIDSELEMENT:
+		visitIfcRelVoidsElement( static_cast<const IfcRelVoidsElement*>( entity ), visitor );
+		return true;
+	case IFCREPRESENTATION:
+	case IFCSHAPEMODEL:
+	case IFCSHAPEREPRESENTATION:
+	case IFCSTYLEMODEL:
+	case IFCSTYLEDREPRESENTATION:
+	case IFCTOPOLOGYREPRESENTATION:
+		visitIfcRepresentation( static_cast<const IfcRepresentation*>( entity ), visitor );
+		return true;
+	case IFCREPRESENTATIONMAP:
+		visitIfcRepresentationMap( static_cast<const IfcRepresentationMap*>( entity ), visitor );
+		return true;
+	case IFCRESOURCEAPPROVALRELATIONSHIP:
+		visitIfcResourceApprovalRelationship( static_cast<const IfcResourceApprovalRelationship*>( entity ), visitor );
+		return true;
+	case IFCRESOURCECONSTRAINTRELATIONSHIP:
+		visitIfcResourceConstraintRelationship( static_cast<const IfcResourceConstraintRelationship*>( entity ), visitor );
+		return true;
+	case IFCREVOLVEDAREASOLID:
+		visitIfcRevolvedAreaSolid( static_cast<const IfcRevolvedAreaSolid*>( entity ), visitor );
+		return true;
+	case IFCREVOLVEDAREASOLIDTAPERED:
+		visitIfcRevolvedAreaSolidTapered( static_cast<const IfcRevolvedAreaSolidTapered*>( entity ), visitor );
+		return true;
+	case IFCACTIONREQUEST:
+	case IFCBUILDINGSYSTEM:
+	case IFCBUILTSYSTEM:
+	case IFCCONTROL:
+	case IFCCOSTSCHEDULE:
+	case IFCDISTRIBUTIONCIRCUIT:
+	case IFCDISTRIBUTIONSYSTEM:
+	case IFCGROUP:
+	case IFCOBJECT:
+	case IFCOBJECTDEFINITION:
+	case IFCPERFORMANCEHISTORY:
+	case IFCPERMIT:
+	case IFCPREDEFINEDPROPERTYSET:
+	case IFCPROCEDURE:
+	case IFCPROCESS:
+	case IFCPROJECTORDER:
+	case IFCPROPERTYDEFINITION:
+	case IFCPROPERTYSETDEFINITION:
+	case IFCPROPERTYTEMPLATE:
+	case IFCPROPERTYTEMPLATEDEFINITION:
+	case IFCQUANTITYSET:
+	case IFCRELCONNECTS:
+	case IFCRELDECOMPOSES:
+	case IFCRELDEFINES:
+	case IFCRELATIONSHIP:
+	case IFCRESOURCE:
+	case IFCROOT:
+	case IFCSTRUCTURALLOADCASE:
+	case IFCSTRUCTURALLOADGROUP:
+	case IFCSYSTEM:
+	case IFCZONE:
+		visitIfcRoot( static_cast<const IfcRoot*>( entity ), visitor );
+		return true;
+	case IFCSECTIONPROPERTIES:
+		visitIfcSectionProperties( static_cast<const IfcSectionProperties*>( entity ), visitor );
+		return true;
+	case IFCSECTIONREINFORCEMENTPROPERTIES:
+		visitIfcSectionReinforcementProperties( static_cast<const IfcSectionReinforcementProperties*>( entity ), visitor );
+		return true;
+	case IFCSECTIONEDSOLID:
+		visitIfcSectionedSolid( static_cast<const IfcSectionedSolid*>( entity ), visitor );
+		return true;
+	case IFCSECTIONEDSOLIDHORIZONTAL:
+		visitIfcSectionedSolidHorizontal( static_cast<const IfcSectionedSolidHorizontal*>( entity ), visitor );
+		return true;
+	case IFCSECTIONEDSPINE:
+		visitIfcSectionedSpine( static_cast<const IfcSectionedSpine*>( entity ), visitor );
+		return true;
+	case IFCSECTIONEDSURFACE:
+		visitIfcSectionedSurface( static_cast<const IfcSectionedSurface*>( entity ), visitor );
+		return true;
+	case IFCSEGMENTEDREFERENCECURVE:
+		visitIfcSegmentedReferenceCurve( static_cast<const IfcSegmentedReferenceCurve*>( entity ), visitor );
+		return true;
+	case IFCSHAPEASPECT:
+		visitIfcShapeAspect( static_cast<const IfcShapeAspect*>( entity ), visitor );
+		return true;
+	case IFCSHELLBASEDSURFACEMODEL:
+		visitIfcShellBasedSurfaceModel( static_cast<const IfcShellBasedSurfaceModel*>( entity ), visitor );
+		return true;
+	case IFCSIMPLEPROPERTYTEMPLATE:
+		visitIfcSimplePropertyTemplate( static_cast<const IfcSimplePropertyTemplate*>( entity ), visitor );
+		return true;
+	case IFCSITE:
+		visitIfcSite( static_cast<const IfcSite*>( entity ), visitor );
+		return true;
+	case IFCCLOTHOID:
+	case IFCCOSINESPIRAL:
+	case IFCSECONDORDERPOLYNOMIALSPIRAL:
+	case IFCSEVENTHORDERPOLYNOMIALSPIRAL:
+	case IFCSINESPIRAL:
+	case IFCSPIRAL:
+	case IFCTHIRDORDERPOLYNOMIALSPIRAL:
+		visitIfcSpiral( static_cast<const IfcSpiral*>( entity ), visitor );
+		return true;
+	case IFCSTRUCTURALACTION:
+	case IFCSTRUCTURALACTIVITY:
+	case IFCSTRUCTURALCURVEACTION:
+	case IFCSTRUCTURALCURVEREACTION:
+	case IFCSTRUCTURALLINEARACTION:
+	case IFCSTRUCTURALPLANARACTION:
+	case IFCSTRUCTURALPOINTACTION:
+	case IFCSTRUCTURALPOINTREACTION:
+	case IFCSTRUCTURALREACTION:
+	case IFCSTRUCTURALSURFACEACTION:
+	case IFCSTRUCTURALSURFACEREACTION:
+		visitIfcStructuralActivity( static_cast<const IfcStructuralActivity*>( entity ), visitor );
+		return true;
+	case IFCSTRUCTURALANALYSISMODEL:
+		visitIfcStructuralAnalysisModel( static_cast<const IfcStructuralAnalysisModel*>( entity ), visitor );
+		return true;
+	case IFCSTRUCTURALCONNECTION:
+	case IFCSTRUCTURALSURFACECONNECTION:
+		visitIfcStructuralConnection( static_cast<const IfcStructuralConnection*>( entity ), visitor );
+		return true;
+	case IFCSTRUCTURALCURVECONNECTION:
+		visitIfcStructuralCurveConnection( static_cast<const IfcStructuralCurveConnection*>( entity ), visitor );
+		return true;
+	case IFCSTRUCTURALCURVEMEMBER:
+	case IFCSTRUCTURALCURVEMEMBERVARYING:
+		visitIfcStructuralCurveMember( static_cast<const IfcStructuralCurveMember*>( entity ), visitor );
+		return true;
+	case IFCSTRUCTURALLOADCONFIGURATION:
+		visitIfcStructuralLoadConfiguration( static_cast<const IfcStructuralLoadConfiguration*>( entity ), visitor );
+		return true;
+	case IFCSTRUCTURALPOINTCONNECTION:
+		visitIfcStructuralPointConnection( static_cast<const IfcStructuralPointConnection*>( entity ), visitor );
+		return true;
+	case IFCSTRUCTURALRESULTGROUP:
+		visitIfcStructuralResultGroup( static_cast<const IfcStructuralResultGroup*>( entity ), visitor );
+		return true;
+	case IFCSTYLEDITEM:
+		visitIfcStyledItem( static_cast<const IfcStyledItem*>( entity ), visitor );
+		return true;
+	case IFCSUBEDGE:
+		visitIfcSubedge( static_cast<const IfcSubedge*>( entity ), visitor );
+		return true;
+	case IFCINTERSECTIONCURVE:
+	case IFCSEAMCURVE:
+	case IFCSURFACECURVE:
+		visitIfcSurfaceCurve( static_cast<const IfcSurfaceCurve*>( entity ), visitor );
+		return true;
+	case IFCSURFACECURVESWEPTAREASOLID:
+		visitIfcSurfaceCurveSweptAreaSolid( static_cast<const IfcSurfaceCurveSweptAreaSolid*>( entity ), visitor );
+		return true;
+	case IFCSURFACEOFLINEAREXTRUSION:
+		visitIfcSurfaceOfLinearExtrusion( static_cast<const IfcSurfaceOfLinearExtrusion*>( entity ), visitor );
+		return true;
+	case IFCSURFACEOFREVOLUTION:
+		visitIfcSurfaceOfRevolution( static_cast<const IfcSurfaceOfRevolution*>( entity ), visitor );
+		return true;
+	case IFCSURFACESTYLE:
+		visitIfcSurfaceStyle( static_cast<const IfcSurfaceStyle*>( entity ), visitor );
+		return true;
+	case IFCSURFACESTYLELIGHTING:
+		visitIfcSurfaceStyleLighting( static_cast<const IfcSurfaceStyleLighting*>( entity ), visitor );
+		return true;
+	case IFCSURFACESTYLERENDERING:
+		visitIfcSurfaceStyleRendering( static_cast<const IfcSurfaceStyleRendering*>( entity ), visitor );
+		return true;
+	case IFCSURFACESTYLESHADING:
+		visitIfcSurfaceStyleShading( static_cast<const IfcSurfaceStyleShading*>( entity ), visitor );
+		return true;
+	case IFCSURFACESTYLEWITHTEXTURES:
+		visitIfcSurfaceStyleWithTextures( static_cast<const IfcSurfaceStyleWithTextures*>( entity ), visitor );
+		return true;
+	case IFCBLOBTEXTURE:
+	case IFCIMAGETEXTURE:
+	case IFCPIXELTEXTURE:
+	case IFCSURFACETEXTURE:
+		visitIfcSurfaceTexture( static_cast<const IfcSurfaceTexture*>( entity ), visitor );
+		return true;
+	case IFCSWEPTAREASOLID:
+		visitIfcSweptAreaSolid( static_cast<const IfcSweptAreaSolid*>( entity ), visitor );
+		return true;
+	case IFCSWEPTDISKSOLID:
+	case IFCSWEPTDISKSOLIDPOLYGONAL:
+		visitIfcSweptDiskSolid( static_cast<const IfcSweptDiskSolid*>( entity ), visitor );
+		return true;
+	case IFCSWEPTSURFACE:
+		visitIfcSweptSurface( static_cast<const IfcSweptSurface*>( entity ), visitor );
+		return true;
+	case IFCTABLE:
+		visitIfcTable( static_cast<const IfcTable*>( entity ), visitor );
+		return true;
+	case IFCTABLECOLUMN:
+		visitIfcTableColumn( static_cast<const IfcTableColumn*>( entity ), visitor );
+		return true;
+	case IFCTASK:
+		visitIfcTask( static_cast<const IfcTask*>( entity ), visitor );
+		return true;
+	case IFCTASKTIMERECURRING:
+		visitIfcTaskTimeRecurring( static_cast<const IfcTaskTimeRecurring*>( entity ), visitor );
+		return true;
+	case IFCTESSELLATEDFACESET:
+	case IFCTRIANGULATEDFACESET:
+	case IFCTRIANGULATEDIRREGULARNETWORK:
+		visitIfcTessellatedFaceSet( static_cast<const IfcTessellatedFaceSet*>( entity ), visitor );
+		return true;
+	case IFCTEXTLITERAL:
+		visitIfcTextLiteral( static_cast<const IfcTextLiteral*>( entity ), visitor );
+		return true;
+	case IFCTEXTLITERALWITHEXTENT:
+		visitIfcTextLiteralWithExtent( static_cast<const IfcTextLiteralWithExtent*>( entity ), visitor );
+		return true;
+	case IFCTEXTSTYLE:
+		visitIfcTextStyle( static_cast<const IfcTextStyle*>( entity ), visitor );
+		return true;
+	case IFCTEXTSTYLEFORDEFINEDFONT:
+		visitIfcTextStyleForDefinedFont( static_cast<const IfcTextStyleForDefinedFont*>( entity ), visitor );
+		return true;
+	case IFCTEXTURECOORDINATE:
+	case IFCTEXTURECOORDINATEGENERATOR:
+		visitIfcTextureCoordinate( static_cast<const IfcTextureCoordinate*>( entity ), visitor );
+		return true;
+	case IFCTEXTURECOORDINATEINDICES:
+	case IFCTEXTURECOORDINATEINDICESWITHVOIDS:
+		visitIfcTextureCoordinateIndices( static_cast<const IfcTextureCoordinateIndices*>( entity ), visitor );
+		return true;
+	case IFCTEXTUREMAP:
+		visitIfcTextureMap( static_cast<const IfcTextureMap*>( entity ), visitor );
+		return true;
+	case IFCTIMESERIES:
+		visitIfcTimeSeries( static_cast<const IfcTimeSeries*>( entity ), visitor );
+		return true;
+	case IFCTRIMMEDCURVE:
+		visitIfcTrimmedCurve( static_cast<const IfcTrimmedCurve*>( entity ), visitor );
+		return true;
+	case IFCEVENTTYPE:
+	case IFCPROCEDURETYPE:
+	case IFCTASKTYPE:
+	case IFCTYPEOBJECT:
+	case IFCTYPEPROCESS:
+	case IFCTYPERESOURCE:
+		visitIfcTypeObject( static_cast<const IfcTypeObject*>( entity ), visitor );
+		return true;
+	case IFCACTUATORTYPE:
+	case IFCAIRTERMINALBOXTYPE:
+	case IFCAIRTERMINALTYPE:
+	case IFCAIRTOAIRHEATRECOVERYTYPE:
+	case IFCALARMTYPE:
+	case IFCAUDIOVISUALAPPLIANCETYPE:
+	case IFCBEAMTYPE:
+	case IFCBEARINGTYPE:
+	case IFCBOILERTYPE:
+	case IFCBUILDINGELEMENTPARTTYPE:
+	case IFCBUILDINGELEMENTPROXYTYPE:
+	case IFCBUILTELEMENTTYPE:
+	case IFCBURNERTYPE:
+	case IFCCABLECARRIERFITTINGTYPE:
+	case IFCCABLECARRIERSEGMENTTYPE:
+	case IFCCABLEFITTINGTYPE:
+	case IFCCABLESEGMENTTYPE:
+	case IFCCAISSONFOUNDATIONTYPE:
+	case IFCCHILLERTYPE:
+	case IFCCHIMNEYTYPE:
+	case IFCCIVILELEMENTTYPE:
+	case IFCCOILTYPE:
+	case IFCCOLUMNTYPE:
+	case IFCCOMMUNICATIONSAPPLIANCETYPE:
+	case IFCCOMPRESSORTYPE:
+	case IFCCONDENSERTYPE:
+	case IFCCONTROLLERTYPE:
+	case IFCCONVEYORSEGMENTTYPE:
+	case IFCCOOLEDBEAMTYPE:
+	case IFCCOOLINGTOWERTYPE:
+	case IFCCOURSETYPE:
+	case IFCCOVERINGTYPE:
+	case IFCCURTAINWALLTYPE:
+	case IFCDAMPERTYPE:
+	case IFCDEEPFOUNDATIONTYPE:
+	case IFCDISCRETEACCESSORYTYPE:
+	case IFCDISTRIBUTIONBOARDTYPE:
+	case IFCDISTRIBUTIONCHAMBERELEMENTTYPE:
+	case IFCDISTRIBUTIONCONTROLELEMENTTYPE:
+	case IFCDISTRIBUTIONELEMENTTYPE:
+	case IFCDISTRIBUTIONFLOWELEMENTTYPE:
+	case IFCDOORSTYLE:
+	case IFCDOORTYPE:
+	case IFCDUCTFITTINGTYPE:
+	case IFCDUCTSEGMENTTYPE:
+	case IFCDUCTSILENCERTYPE:
+	case IFCELECTRICAPPLIANCETYPE:
+	case IFCELECTRICDISTRIBUTIONBOARDTYPE:
+	case IFCELECTRICFLOWSTORAGEDEVICETYPE:
+	case IFCELECTRICFLOWTREATMENTDEVICETYPE:
+	case IFCELECTRICGENERATORTYPE:
+	case IFCELECTRICMOTORTYPE:
+	case IFCELECTRICTIMECONTROLTYPE:
+	case IFCELEMENTASSEMBLYTYPE:
+	case IFCELEMENTCOMPONENTTYPE:
+	case IFCELEMENTTYPE:
+	case IFCENERGYCONVERSIONDEVICETYPE:
+	case IFCENGINETYPE:
+	case IFCEVAPORATIVECOOLERTYPE:
+	case IFCEVAPORATORTYPE:
+	case IFCFANTYPE:
+	case IFCFASTENERTYPE:
+	case IFCFILTERTYPE:
+	case IFCFIRESUPPRESSIONTERMINALTYPE:
+	case IFCFLOWCONTROLLERTYPE:
+	case IFCFLOWFITTINGTYPE:
+	case IFCFLOWINSTRUMENTTYPE:
+	case IFCFLOWMETERTYPE:
+	case IFCFLOWMOVINGDEVICETYPE:
+	case IFCFLOWSEGMENTTYPE:
+	case IFCFLOWSTORAGEDEVICETYPE:
+	case IFCFLOWTERMINALTYPE:
+	case IFCFLOWTREATMENTDEVICETYPE:
+	case IFCFOOTINGTYPE:
+	case IFCFURNISHINGELEMENTTYPE:
+	case IFCFURNITURETYPE:
+	case IFCGEOGRAPHICELEMENTTYPE:
+	case IFCHEATEXCHANGERTYPE:
+	case IFCHUMIDIFIERTYPE:
+	case IFCIMPACTPROTECTIONDEVICETYPE:
+	case IFCINTERCEPTORTYPE:
+	case IFCJUNCTIONBOXTYPE:
+	case IFCKERBTYPE:
+	case IFCLAMPTYPE:
+	case IFCLIGHTFIXTURETYPE:
+	case IFCLIQUIDTERMINALTYPE:
+	case IFCMECHANICALFASTENERTYPE:
+	case IFCMEDICALDEVICETYPE:
+	case IFCMEMBERTYPE:
+	case IFCMOBILETELECOMMUNICATIONSAPPLIANCETYPE:
+	case IFCMOORINGDEVICETYPE:
+	case IFCMOTORCONNECTIONTYPE:
+	case IFCNAVIGATIONELEMENTTYPE:
+	case IFCOUTLETTYPE:
+	case IFCPAVEMENTTYPE:
+	case IFCPILETYPE:
+	case IFCPIPEFITTINGTYPE:
+	case IFCPIPESEGMENTTYPE:
+	case IFCPLATETYPE:
+	case IFCPROTECTIVEDEVICETRIPPINGUNITTYPE:
+	case IFCPROTECTIVEDEVICETYPE:
+	case IFCPUMPTYPE:
+	case IFCRAILTYPE:
+	case IFCRAILINGTYPE:
+	case IFCRAMPFLIGHTTYPE:
+	case IFCRAMPTYPE:
+	case IFCREINFORCINGBARTYPE:
+	case IFCREINFORCINGELEMENTTYPE:
+	case IFCREINFORCINGMESHTYPE:
+	case IFCROOFTYPE:
+	case IFCSANITARYTERMINALTYPE:
+	case IFCSENSORTYPE:
+	case IFCSHADINGDEVICETYPE:
+	case IFCSIGNTYPE:
+	case IFCSIGNALTYPE:
+	case IFCSLABTYPE:
+	case IFCSOLARDEVICETYPE:
+	case IFCSPACEHEATERTYPE:
+	case IFCSPACETYPE:
+	case IFCSPATIALELEMENTTYPE:
+	case IFCSPATIALSTRUCTUREELEMENTTYPE:
+	case IFCSPATIALZONETYPE:
+	case IFCSTACKTERMINALTYPE:
+	case IFCSTAIRFLIGHTTYPE:
+	case IFCSTAIRTYPE:
+	case IFCSWITCHINGDEVICETYPE:
+	case IFCSYSTEMFURNITUREELEMENTTYPE:
+	case IFCTANKTYPE:
+	case IFCTENDONANCHORTYPE:
+	case IFCTENDONCONDUITTYPE:
+	case IFCTENDONTYPE:
+	case IFCTRACKELEMENTTYPE:
+	case IFCTRANSFORMERTYPE:
+	case IFCTRANSPORTELEMENTTYPE:
+	case IFCTRANSPORTATIONDEVICETYPE:
+	case IFCTUBEBUNDLETYPE:
+	case IFCTYPEPRODUCT:
+	case IFCUNITARYCONTROLELEMENTTYPE:
+	case IFCUNITARYEQUIPMENTTYPE:
+	case IFCVALVETYPE:
+	case IFCVEHICLETYPE:
+	case IFCVIBRATIONDAMPERTYPE:
+	case IFCVIBRATIONISOLATORTYPE:
+	case IFCWALLTYPE:
+	case IFCWASTETERMINALTYPE:
+	case IFCWINDOWSTYLE:
+	case IFCWINDOWTYPE:
+		visitIfcTypeProduct( static_cast<const IfcTypeProduct*>( entity ), visitor );
+		return true;
+	case IFCUNITASSIGNMENT:
+		visitIfcUnitAssignment( static_cast<const IfcUnitAssignment*>( entity ), visitor );
+		return true;
+	case IFCVECTOR:
+		visitIfcVector( static_cast<const IfcVector*>( entity ), visitor );
+		return true;
+	case IFCVERTEXLOOP:
+		visitIfcVertexLoop( static_cast<const IfcVertexLoop*>( entity ), visitor );
+		return true;
+	case IFCVERTEXPOINT:
+		visitIfcVertexPoint( static_cast<const IfcVertexPoint*>( entity ), visitor );
+		return true;
+	case IFCVIRTUALGRIDINTERSECTION:
+		visitIfcVirtualGridIntersection( static_cast<const IfcVirtualGridIntersection*>( entity ), visitor );
+		return true;
+	case IFCWELLKNOWNTEXT:
+		visitIfcWellKnownText( static_cast<const IfcWellKnownText*>( entity ), visitor );
+		return true;
+	case IFCWINDOWLININGPROPERTIES:
+		visitIfcWindowLiningProperties( static_cast<const IfcWindowLiningProperties*>( entity ), visitor );
+		return true;
+	case IFCWINDOWPANELPROPERTIES:
+		visitIfcWindowPanelProperties( static_cast<const IfcWindowPanelProperties*>( entity ), visitor );
+		return true;
+	case IFCWORKCALENDAR:
+		visitIfcWorkCalendar( static_cast<const IfcWorkCalendar*>( entity ), visitor );
+		return true;
+	case IFCWORKCONTROL:
+	case IFCWORKPLAN:
+	case IFCWORKSCHEDULE:
+		visitIfcWorkControl( static_cast<const IfcWorkControl*>( entity ), visitor );
+		return true;
+	case IFCWORKTIME:
+		visitIfcWorkTime( static_cast<const IfcWorkTime*>( entity ), visitor );
+		return true;
+	default:
+		return false;
+	}
+}
+
+bool EntityReferences::forEachInverseReference( const BuildingEntity* entity, EntityReferenceVisitor& visitor )
+{
+	switch( entity->classID() )
+	{
+	case IFCALIGNMENTCANTSEGMENT:
+	case IFCALIGNMENTHORIZONTALSEGMENT:
+	case IFCALIGNMENTPARAMETERSEGMENT:
+	case IFCALIGNMENTVERTICALSEGMENT:
+	case IFCAPPLICATION:
+	case IFCAPPROVALRELATIONSHIP:
+	case IFCBOUNDARYCONDITION:
+	case IFCBOUNDARYEDGECONDITION:
+	case IFCBOUNDARYFACECONDITION:
+	case IFCBOUNDARYNODECONDITION:
+	case IFCBOUNDARYNODECONDITIONWARPING:
+	case IFCCOLOURRGB:
+	case IFCCOLOURRGBLIST:
+	case IFCCOLOURSPECIFICATION:
+	case IFCCONNECTIONCURVEGEOMETRY:
+	case IFCCONNECTIONGEOMETRY:
+	case IFCCONNECTIONPOINTECCENTRICITY:
+	case IFCCONNECTIONPOINTGEOMETRY:
+	case IFCCONNECTIONSURFACEGEOMETRY:
+	case IFCCONNECTIONVOLUMEGEOMETRY:
+	case IFCCOORDINATEOPERATION:
+	case IFCCURRENCYRELATIONSHIP:
+	case IFCCURVESTYLE:
+	case IFCCURVESTYLEFONT:
+	case IFCCURVESTYLEFONTANDSCALING:
+	case IFCCURVESTYLEFONTPATTERN:
+	case IFCDERIVEDUNIT:
+	case IFCDERIVEDUNITELEMENT:
+	case IFCDIMENSIONALEXPONENTS:
+	case IFCDOCUMENTINFORMATIONRELATIONSHIP:
+	case IFCDRAUGHTINGPREDEFINEDCOLOUR:
+	case IFCDRAUGHTINGPREDEFINEDCURVEFONT:
+	case IFCEVENTTIME:
+	case IFCEXTERNALINFORMATION:
+	case IFCEXTERNALREFERENCERELATIONSHIP:
+	case IFCFAILURECONNECTIONCONDITION:
+	case IFCFILLAREASTYLE:
+	case IFCINDEXEDCOLOURMAP:
+	case IFCINDEXEDPOLYGONALTEXTUREMAP:
+	case IFCINDEXEDTEXTUREMAP:
+	case IFCINDEXEDTRIANGLETEXTUREMAP:
+	case IFCIRREGULARTIMESERIESVALUE:
+	case IFCLAGTIME:
+	case IFCLIGHTDISTRIBUTIONDATA:
+	case IFCLIGHTINTENSITYDISTRIBUTION:
+	case IFCMAPCONVERSION:
+	case IFCMAPCONVERSIONSCALED:
+	case IFCMATERIALCLASSIFICATIONRELATIONSHIP:
+	case IFCMATERIALDEFINITIONREPRESENTATION:
+	case IFCMATERIALLIST:
+	case IFCMATERIALRELATIONSHIP:
+	case IFCMEASUREWITHUNIT:
+	case IFCMONETARYUNIT:
+	case IFCNAMEDUNIT:
+	case IFCORGANIZATIONRELATIONSHIP:
+	case IFCOWNERHISTORY:
+	case IFCPERSONANDORGANIZATION:
+	case IFCPREDEFINEDCOLOUR:
+	case IFCPREDEFINEDCURVEFONT:
+	case IFCPREDEFINEDITEM:
+	case IFCPREDEFINEDTEXTFONT:
+	case IFCPRESENTATIONITEM:
+	case IFCPRESENTATIONLAYERASSIGNMENT:
+	case IFCPRESENTATIONLAYERWITHSTYLE:
+	case IFCPRESENTATIONSTYLE:
+	case IFCPRESENTATIONSTYLEASSIGNMENT:
+	case IFCPRODUCTREPRESENTATION:
+	case IFCPROPERTYDEPENDENCYRELATIONSHIP:
+	case IFCRECURRENCEPATTERN:
+	case IFCREFERENCE:
+	case IFCRELADHERESTOELEMENT:
+	case IFCRELAGGREGATES:
+	case IFCRELASSIGNS:
+	case IFCRELASSIGNSTOACTOR:
+	case IFCRELASSIGNSTOCONTROL:
+	case IFCRELASSIGNSTOGROUP:
+	case IFCRELASSIGNSTOGROUPBYFACTOR:
+	case IFCRELASSIGNSTOPROCESS:
+	case IFCRELASSIGNSTOPRODUCT:
+	case IFCRELASSIGNSTORESOURCE:
+	case IFCRELASSOCIATES:
+	case IFCRELASSOCIATESAPPROVAL:
+	case IFCRELASSOCIATESCLASSIFICATION:
+	case IFCRELASSOCIATESCONSTRAINT:
+	case IFCRELASSOCIATESDOCUMENT:
+	case IFCRELASSOCIATESLIBRARY:
+	case IFCRELASSOCIATESMATERIAL:
+	case IFCRELASSOCIATESPROFILEDEF:
+	case IFCRELCONNECTS:
+	case IFCRELCONNECTSELEMENTS:
+	case IFCRELCONNECTSPATHELEMENTS:
+	case IFCRELCONNECTSPORTTOELEMENT:
+	case IFCRELCONNECTSPORTS:
+	case IFCRELCONNECTSSTRUCTURALACTIVITY:
+	case IFCRELCONNECTSSTRUCTURALMEMBER:
+	case IFCRELCONNECTSWITHECCENTRICITY:
+	case IFCRELCONNECTSWITHREALIZINGELEMENTS:
+	case IFCRELCONTAINEDINSPATIALSTRUCTURE:
+	case IFCRELCOVERSBLDGELEMENTS:
+	case IFCRELCOVERSSPACES:
+	case IFCRELDECLARES:
+	case IFCRELDECOMPOSES:
+	case IFCRELDEFINES:
+	case IFCRELDEFINESBYOBJECT:
+	case IFCRELDEFINESBYPROPERTIES:
+	case IFCRELDEFINESBYTEMPLATE:
+	case IFCRELDEFINESBYTYPE:
+	case IFCRELFILLSELEMENT:
+	case IFCRELFLOWCONTROLELEMENTS:
+	case IFCRELINTERFERESELEMENTS:
+	case IFCRELNESTS:
+	case IFCRELPOSITIONS:
+	case IFCRELPROJECTSELEMENT:
+	case IFCRELREFERENCEDINSPATIALSTRUCTURE:
+	case IFCRELSEQUENCE:
+	case IFCRELSERVICESBUILDINGS:
+	case IFCRELSPACEBOUNDARY:
+	case IFCRELVOIDSELEMENT:
+	case IFCRELATIONSHIP:
+	case IFCRESOURCEAPPROVALRELATIONSHIP:
+	case IFCRESOURCECONSTRAINTRELATIONSHIP:
+	case IFCRESOURCELEVELRELATIONSHIP:
+	case IFCRESOURCETIME:
+	case IFCRIGIDOPERATION:
+	case IFCROOT:
+	case IFCSIUNIT:
+	case IFCSCHEDULINGTIME:
+	case IFCSLIPPAGECONNECTIONCONDITION:
+	case IFCSTRUCTURALCONNECTIONCONDITION:
+	case IFCSTRUCTURALLOAD:
+	case IFCSTRUCTURALLOADCONFIGURATION:
+	case IFCSTRUCTURALLOADLINEARFORCE:
+	case IFCSTRUCTURALLOADORRESULT:
+	case IFCSTRUCTURALLOADPLANARFORCE:
+	case IFCSTRUCTURALLOADSINGLEDISPLACEMENT:
+	case IFCSTRUCTURALLOADSINGLEDISPLACEMENTDISTORTION:
+	case IFCSTRUCTURALLOADSINGLEFORCE:
+	case IFCSTRUCTURALLOADSINGLEFORCEWARPING:
+	case IFCSTRUCTURALLOADSTATIC:
+	case IFCSTRUCTURALLOADTEMPERATURE:
+	case IFCSURFACEREINFORCEMENTAREA:
+	case IFCSURFACESTYLE:
+	case IFCSURFACESTYLELIGHTING:
+	case IFCSURFACESTYLEREFRACTION:
+	case IFCSURFACESTYLERENDERING:
+	case IFCSURFACESTYLESHADING:
+	case IFCSURFACESTYLEWITHTEXTURES:
+	case IFCTABLE:
+	case IFCTABLECOLUMN:
+	case IFCTABLEROW:
+	case IFCTASKTIME:
+	case IFCTASKTIMERECURRING:
+	case IFCTEXTSTYLE:
+	case IFCTEXTSTYLEFONTMODEL:
+	case IFCTEXTSTYLEFORDEFINEDFONT:
+	case IFCTEXTSTYLETEXTMODEL:
+	case IFCTEXTURECOORDINATE:
+	case IFCTEXTURECOORDINATEGENERATOR:
+	case IFCTEXTUREMAP:
+	case IFCTEXTUREVERTEX:
+	case IFCTEXTUREVERTEXLIST:
+	case IFCTIMEPERIOD:
+	case IFCTIMESERIESVALUE:
+	case IFCUNITASSIGNMENT:
+	case IFCVIRTUALGRIDINTERSECTION:
+	case IFCWELLKNOWNTEXT:
+	case IFCWORKTIME:
+		return true;
+	case IFCACTOR:
+	case IFCOCCUPANT:
+		visitInverseIfcActor( static_cast<const IfcActor*>( entity ), visitor );
+		return true;
+	case IFCACTORROLE:
+		visitInverseIfcActorRole( static_cast<const IfcActorRole*>( entity ), visitor );
+		return true;
+	case IFCADDRESS:
+	case IFCPOSTALADDRESS:
+	case IFCTELECOMADDRESS:
+		visitInverseIfcAddress( static_cast<const IfcAddress*>( entity ), visitor );
+		return true;
+	case IFCANNOTATION:
+		visitInverseIfcAnnotation( static_cast<const IfcAnnotation*>( entity ), visitor );
+		return true;
+	case IFCAPPLIEDVALUE:
+	case IFCCOSTVALUE:
+		visitInverseIfcAppliedValue( static_cast<const IfcAppliedValue*>( entity ), visitor );
+		return true;
+	case IFCAPPROVAL:
+		visitInverseIfcApproval( static_cast<const IfcApproval*>( entity ), visitor );
+		return true;
+	case IFCCLASSIFICATION:
+		visitInverseIfcClassification( static_cast<const IfcClassification*>( entity ), visitor );
+		return true;
+	case IFCCLASSIFICATIONREFERENCE:
+		visitInverseIfcClassificationReference( static_cast<const IfcClassificationReference*>( entity ), visitor );
+		return true;
+	case IFCCONSTRAINT:
+	case IFCMETRIC:
+	case IFCOBJECTIVE:
+		visitInverseIfcConstraint( static_cast<const IfcConstraint*>( entity ), visitor );
+		return true;
+	case IFCCONTEXT:
+	case IFCPROJECT:
+	case IFCPROJECTLIBRARY:
+		visitInverseIfcContext( static_cast<const IfcContext*>( entity ), visitor );
+		return true;
+	case IFCCONTEXTDEPENDENTUNIT:
+		visitInverseIfcContextDependentUnit( static_cast<const IfcContextDependentUnit*>( entity ), visitor );
+		return true;
+	case IFCACTIONREQUEST:
+	case IFCCONTROL:
+	case IFCCOSTITEM:
+	case IFCCOSTSCHEDULE:
+	case IFCPERFORMANCEHISTORY:
+	case IFCPERMIT:
+	case IFCPROJECTORDER:
+	case IFCWORKCALENDAR:
+	case IFCWORKCONTROL:
+	case IFCWORKPLAN:
+	case IFCWORKSCHEDULE:
+		visitInverseIfcControl( static_cast<const IfcControl*>( entity ), visitor );
+		return true;
+	case IFCCONVERSIONBASEDUNIT:
+	case IFCCONVERSIONBASEDUNITWITHOFFSET:
+		visitInverseIfcConversionBasedUnit( static_cast<const IfcConversionBasedUnit*>( entity ), visitor );
+		return true;
+	case IFCCOORDINATEREFERENCESYSTEM:
+	case IFCGEOGRAPHICCRS:
+	case IFCPROJECTEDCRS:
+		visitInverseIfcCoordinateReferenceSystem( static_cast<const IfcCoordinateReferenceSystem*>( entity ), visitor );
+		return true;
+	case IFCCOVERING:
+		visitInverseIfcCovering( static_cast<const IfcCovering*>( entity ), visitor );
+		return true;
+	case IFCACTUATOR:
+	case IFCALARM:
+	case IFCCONTROLLER:
+	case IFCDISTRIBUTIONCONTROLELEMENT:
+	case IFCFLOWINSTRUMENT:
+	case IFCPROTECTIVEDEVICETRIPPINGUNIT:
+	case IFCSENSOR:
+	case IFCUNITARYCONTROLELEMENT:
+		visitInverseIfcDistributionControlElement( static_cast<const IfcDistributionControlElement*>( entity ), visitor );
+		return true;
+	case IFCDISTRIBUTIONELEMENT:
+		visitInverseIfcDistributionElement( static_cast<const IfcDistributionElement*>( entity ), visitor );
+		return true;
+	case IFCAIRTERMINAL:
+	case IFCAIRTERMINALBOX:
+	case IFCAIRTOAIRHEATRECOVERY:
+	case IFCAUDIOVISUALAPPLIANCE:
+	case IFCBOILER:
+	case IFCBURNER:
+	case IFCCABLECARRIERFITTING:
+	case IFCCABLECARRIERSEGMENT:
+	case IFCCABLEFITTING:
+	case IFCCABLESEGMENT:
+	case IFCCHILLER:
+	case IFCCOIL:
+	case IFCCOMMUNICATIONSAPPLIANCE:
+	case IFCCOMPRESSOR:
+	case IFCCONDENSER:
+	case IFCCONVEYORSEGMENT:
+	case IFCCOOLEDBEAM:
+	case IFCCOOLINGTOWER:
+	case IFCDAMPER:
+	case IFCDISTRIBUTIONBOARD:
+	case IFCDISTRIBUTIONCHAMBERELEMENT:
+	case IFCDISTRIBUTIONFLOWELEMENT:
+	case IFCDUCTFITTING:
+	case IFCDUCTSEGMENT:
+	case IFCDUCTSILENCER:
+	case IFCELECTRICAPPLIANCE:
+	case IFCELECTRICDISTRIBUTIONBOARD:
+	case IFCELECTRICFLOWSTORAGEDEVICE:
+	case IFCELECTRICFLOWTREATMENTDEVICE:
+	case IFCELECTRICGENERATOR:
+	case IFCELECTRICMOTOR:
+	case IFCELECTRICTIMECONTROL:
+	case IFCENERGYCONVERSIONDEVICE:
+	case IFCENGINE:
+	case IFCEVAPORATIVECOOLER:
+	case IFCEVAPORATOR:
+	case IFCFAN:
+	case IFCFILTER:
+	case IFCFIRESUPPRESSIONTERMINAL:
+	case IFCFLOWCONTROLLER:
+	case IFCFLOWFITTING:
+	case IFCFLOWMETER:
+	case IFCFLOWMOVINGDEVICE:
+	case IFCFLOWSEGMENT:
+	case IFCFLOWSTORAGEDEVICE:
+	case IFCFLOWTERMINAL:
+	case IFCFLOWTREATMENTDEVICE:
+	case IFCHEATEXCHANGER:
+	case IFCHUMIDIFIER:
+	case IFCINTERCEPTOR:
+	case IFCJUNCTIONBOX:
+	case IFCLAMP:
+	case IFCLIGHTFIXTURE:
+	case IFCLIQUIDTERMINAL:
+	case IFCMEDICALDEVICE:
+	case IFCMOBILETELECOMMUNICATIONSAPPLIANCE:
+	case IFCMOTORCONNECTION:
+	case IFCOUTLET:
+	case IFCPIPEFITTING:
+	case IFCPIPESEGMENT:
+	case IFCPROTECTIVEDEVICE:
+	case IFCPUMP:
+	case IFCSANITARYTERMINAL:
+	case IFCSIGNAL:
+	case IFCSOLARDEVICE:
+	case IFCSPACEHEATER:
+	case IFCSTACKTERMINAL:
+	case IFCSWITCHINGDEVICE:
+	case IFCTANK:
+	case IFCTRANSFORMER:
+	case IFCTUBEBUNDLE:
+	case IFCUNITARYEQUIPMENT:
+	case IFCVALVE:
+	case IFCWASTETERMINAL:
+		visitInverseIfcDistributionFlowElement( static_cast<const IfcDistributionFlowElement*>( entity ), visitor );
+		return true;
+	case IFCDOCUMENTINFORMATION:
+		visitInverseIfcDocumentInformation( static_cast<const IfcDocumentInformation*>( entity ), visitor );
+		return true;
+	case IFCDOCUMENTREFERENCE:
+		visitInverseIfcDocumentReference( static_cast<const IfcDocumentReference*>( entity ), visitor );
+		return true;
+	case IFCBEAM:
+	case IFCBEARING:
+	case IFCBOREHOLE:
+	case IFCBUILDINGELEMENTPART:
+	case IFCBUILDINGELEMENTPROXY:
+	case IFCBUILTELEMENT:
+	case IFCCAISSONFOUNDATION:
+	case IFCCHIMNEY:
+	case IFCCIVILELEMENT:
+	case IFCCOLUMN:
+	case IFCCOURSE:
+	case IFCCURTAINWALL:
+	case IFCDEEPFOUNDATION:
+	case IFCDISCRETEACCESSORY:
+	case IFCDOOR:
+	case IFCEARTHWORKSELEMENT:
+	case IFCEARTHWORKSFILL:
+	case IFCELEMENT:
+	case IFCELEMENTASSEMBLY:
+	case IFCELEMENTCOMPONENT:
+	case IFCFASTENER:
+	case IFCFEATUREELEMENT:
+	case IFCFOOTING:
+	case IFCFURNISHINGELEMENT:
+	case IFCFURNITURE:
+	case IFCGEOGRAPHICELEMENT:
+	case IFCGEOMODEL:
+	case IFCGEOSLICE:
+	case IFCGEOTECHNICALASSEMBLY:
+	case IFCGEOTECHNICALELEMENT:
+	case IFCGEOTECHNICALSTRATUM:
+	case IFCIMPACTPROTECTIONDEVICE:
+	case IFCKERB:
+	case IFCMECHANICALFASTENER:
+	case IFCMEMBER:
+	case IFCMOORINGDEVICE:
+	case IFCNAVIGATIONELEMENT:
+	case IFCPAVEMENT:
+	case IFCPILE:
+	case IFCPLATE:
+	case IFCRAIL:
+	case IFCRAILING:
+	case IFCRAMP:
+	case IFCRAMPFLIGHT:
+	case IFCREINFORCEDSOIL:
+	case IFCREINFORCINGBAR:
+	case IFCREINFORCINGELEMENT:
+	case IFCREINFORCINGMESH:
+	case IFCROOF:
+	case IFCSHADINGDEVICE:
+	case IFCSIGN:
+	case IFCSLAB:
+	case IFCSTAIR:
+	case IFCSTAIRFLIGHT:
+	case IFCSYSTEMFURNITUREELEMENT:
+	case IFCTENDON:
+	case IFCTENDONANCHOR:
+	case IFCTENDONCONDUIT:
+	case IFCTRACKELEMENT:
+	case IFCTRANSPORTELEMENT:
+	case IFCTRANSPORTATIONDEVICE:
+	case IFCVEHICLE:
+	case IFCVIBRATIONDAMPER:
+	case IFCVIBRATIONISOLATOR:
+	case IFCVIRTUALELEMENT:
+	case IFCWALL:
+	case IFCWALLSTANDARDCASE:
+	case IFCWINDOW:
+		visitInverseIfcElement( static_cast<const IfcElement*>( entity ), visitor );
+		return true;
+	case IFCEXTERNALREFERENCE:
+	case IFCEXTERNALLYDEFINEDHATCHSTYLE:
+	case IFCEXTERNALLYDEFINEDSURFACESTYLE:
+	case IFCEXTERNALLYDEFINEDTEXTFONT:
+		visitInverseIfcExternalReference( static_cast<const IfcExternalReference*>( entity ), visitor );
+		return true;
+	case IFCEXTERNALSPATIALELEMENT:
+		visitInverseIfcExternalSpatialElement( static_cast<const IfcExternalSpatialElement*>( entity ), visitor );
+		return true;
+	case IFCADVANCEDFACE:
+	case IFCFACE:
+	case IFCFACESURFACE:
+		visitInverseIfcFace( static_cast<const IfcFace*>( entity ), visitor );
+		return true;
+	case IFCFEATUREELEMENTADDITION:
+	case IFCPROJECTIONELEMENT:
+		visitInverseIfcFeatureElementAddition( static_cast<const IfcFeatureElementAddition*>( entity ), visitor );
+		return true;
+	case IFCEARTHWORKSCUT:
+	case IFCFEATUREELEMENTSUBTRACTION:
+	case IFCVOIDINGFEATURE:
+		visitInverseIfcFeatureElementSubtraction( static_cast<const IfcFeatureElementSubtraction*>( entity ), visitor );
+		return true;
+	case IFCGEOMETRICREPRESENTATIONCONTEXT:
+	case IFCGEOMETRICREPRESENTATIONSUBCONTEXT:
+		visitInverseIfcGeometricRepresentationContext( static_cast<const IfcGeometricRepresentationContext*>( entity ), visitor );
+		return true;
+	case IFCGRIDAXIS:
+		visitInverseIfcGridAxis( static_cast<const IfcGridAxis*>( entity ), visitor );
+		return true;
+	case IFCASSET:
+	case IFCGROUP:
+	case IFCINVENTORY:
+		visitInverseIfcGroup( static_cast<const IfcGroup*>( entity ), visitor );
+		return true;
+	case IFCINDEXEDPOLYGONALFACE:
+	case IFCINDEXEDPOLYGONALFACEWITHVOIDS:
+		visitInverseIfcIndexedPolygonalFace( static_cast<const IfcIndexedPolygonalFace*>( entity ), visitor );
+		return true;
+	case IFCLIBRARYINFORMATION:
+		visitInverseIfcLibraryInformation( static_cast<const IfcLibraryInformation*>( entity ), visitor );
+		return true;
+	case IFCLIBRARYREFERENCE:
+		visitInverseIfcLibraryReference( static_cast<const IfcLibraryReference*>( entity ), visitor );
+		return true;
+	case IFCMATERIAL:
+		visitInverseIfcMaterial( static_cast<const IfcMaterial*>( entity ), visitor );
+		return true;
+	case IFCMATERIALCONSTITUENT:
+		visitInverseIfcMaterialConstituent( static_cast<const IfcMaterialConstituent*>( entity ), visitor );
+		return true;
+	case IFCMATERIALCONSTITUENTSET:
+	case IFCMATERIALDEFINITION:
+	case IFCMATERIALLAYERSET:
+	case IFCMATERIALPROFILESET:
+		visitInverseIfcMaterialDefinition( static_cast<const IfcMaterialDefinition*>( entity ), visitor );
+		return true;
+	case IFCMATERIALLAYER:
+	case IFCMATERIALLAYERWITHOFFSETS:
+		visitInverseIfcMaterialLayer( static_cast<const IfcMaterialLayer*>( entity ), visitor );
+		return true;
+	case IFCMATERIALPROFILE:
+	case IFCMATERIALPROFILEWITHOFFSETS:
+		visitInverseIfcMaterialProfile( static_cast<const IfcMaterialProfile*>( entity ), visitor );
+		return true;
+	case IFCMATERIALLAYERSETUSAGE:
+	case IFCMATERIALPROFILESETUSAGE:
+	case IFCMATERIALPROFILESETUSAGETAPERING:
+	case IFCMATERIALUSAGEDEFINITION:
+		visitInverseIfcMaterialUsageDefinition( static_cast<const IfcMaterialUsageDefinition*>( entity ), visitor );
+		return true;
+	case IFCOBJECT:
+		visitInverseIfcObject( static_cast<const IfcObject*>( entity ), visitor );
+		return true;
+	case IFCOBJECTDEFINITION:
+		visitInverseIfcObjectDefinition( static_cast<const IfcObjectDefinition*>( entity ), visitor );
+		return true;
+	case IFCGRIDPLACEMENT:
+	case IFCLINEARPLACEMENT:
+	case IFCLOCALPLACEMENT:
+	case IFCOBJECTPLACEMENT:
+		visitInverseIfcObjectPlacement( static_cast<const IfcObjectPlacement*>( entity ), visitor );
+		return true;
+	case IFCOPENINGELEMENT:
+		visitInverseIfcOpeningElement( static_cast<const IfcOpeningElement*>( entity ), visitor );
+		return true;
+	case IFCORGANIZATION:
+		visitInverseIfcOrganization( static_cast<const IfcOrganization*>( entity ), visitor );
+		return true;
+	case IFCPERSON:
+		visitInverseIfcPerson( static_cast<const IfcPerson*>( entity ), visitor );
+		return true;
+	case IFCPHYSICALCOMPLEXQUANTITY:
+	case IFCPHYSICALQUANTITY:
+	case IFCPHYSICALSIMPLEQUANTITY:
+	case IFCQUANTITYAREA:
+	case IFCQUANTITYCOUNT:
+	case IFCQUANTITYLENGTH:
+	case IFCQUANTITYNUMBER:
+	case IFCQUANTITYTIME:
+	case IFCQUANTITYVOLUME:
+	case IFCQUANTITYWEIGHT:
+		visitInverseIfcPhysicalQuantity( static_cast<const IfcPhysicalQuantity*>( entity ), visitor );
+		return true;
+	case IFCDISTRIBUTIONPORT:
+	case IFCPORT:
+		visitInverseIfcPort( static_cast<const IfcPort*>( entity ), visitor );
+		return true;
+	case IFCALIGNMENT:
+	case IFCGRID:
+	case IFCLINEARPOSITIONINGELEMENT:
+	case IFCPOSITIONINGELEMENT:
+	case IFCREFERENT:
+		visitInverseIfcPositioningElement( static_cast<const IfcPositioningElement*>( entity ), visitor );
+		return true;
+	case IFCEVENT:
+	case IFCPROCEDURE:
+	case IFCPROCESS:
+	case IFCTASK:
+		visitInverseIfcProcess( static_cast<const IfcProcess*>( entity ), visitor );
+		return true;
+	case IFCALIGNMENTCANT:
+	case IFCALIGNMENTHORIZONTAL:
+	case IFCALIGNMENTSEGMENT:
+	case IFCALIGNMENTVERTICAL:
+	case IFCLINEARELEMENT:
+	case IFCPRODUCT:
+		visitInverseIfcProduct( static_cast<const IfcProduct*>( entity ), visitor );
+		return true;
+	case IFCPRODUCTDEFINITIONSHAPE:
+		visitInverseIfcProductDefinitionShape( static_cast<const IfcProductDefinitionShape*>( entity ), visitor );
+		return true;
+	case IFCARBITRARYCLOSEDPROFILEDEF:
+	case IFCARBITRARYOPENPROFILEDEF:
+	case IFCARBITRARYPROFILEDEFWITHVOIDS:
+	case IFCASYMMETRICISHAPEPROFILEDEF:
+	case IFCCSHAPEPROFILEDEF:
+	case IFCCENTERLINEPROFILEDEF:
+	case IFCCIRCLEHOLLOWPROFILEDEF:
+	case IFCCIRCLEPROFILEDEF:
+	case IFCCOMPOSITEPROFILEDEF:
+	case IFCDERIVEDPROFILEDEF:
+	case IFCELLIPSEPROFILEDEF:
+	case IFCISHAPEPROFILEDEF:
+	case IFCLSHAPEPROFILEDEF:
+	case IFCMIRROREDPROFILEDEF:
+	case IFCOPENCROSSPROFILEDEF:
+	case IFCPARAMETERIZEDPROFILEDEF:
+	case IFCPROFILEDEF:
+	case IFCRECTANGLEHOLLOWPROFILEDEF:
+	case IFCRECTANGLEPROFILEDEF:
+	case IFCROUNDEDRECTANGLEPROFILEDEF:
+	case IFCTSHAPEPROFILEDEF:
+	case IFCTRAPEZIUMPROFILEDEF:
+	case IFCUSHAPEPROFILEDEF:
+	case IFCZSHAPEPROFILEDEF:
+		visitInverseIfcProfileDef( static_cast<const IfcProfileDef*>( entity ), visitor );
+		return true;
+	case IFCCOMPLEXPROPERTY:
+	case IFCPROPERTY:
+	case IFCPROPERTYBOUNDEDVALUE:
+	case IFCPROPERTYENUMERATEDVALUE:
+	case IFCPROPERTYLISTVALUE:
+	case IFCPROPERTYREFERENCEVALUE:
+	case IFCPROPERTYSINGLEVALUE:
+	case IFCPROPERTYTABLEVALUE:
+	case IFCSIMPLEPROPERTY:
+		visitInverseIfcProperty( static_cast<const IfcProperty*>( entity ), visitor );
+		return true;
+	case IFCEXTENDEDPROPERTIES:
+	case IFCMATERIALPROPERTIES:
+	case IFCPREDEFINEDPROPERTIES:
+	case IFCPROFILEPROPERTIES:
+	case IFCPROPERTYABSTRACTION:
+	case IFCPROPERTYENUMERATION:
+	case IFCREINFORCEMENTBARPROPERTIES:
+	case IFCSECTIONPROPERTIES:
+	case IFCSECTIONREINFORCEMENTPROPERTIES:
+		visitInverseIfcPropertyAbstraction( static_cast<const IfcPropertyAbstraction*>( entity ), visitor );
+		return true;
+	case IFCPROPERTYDEFINITION:
+	case IFCPROPERTYTEMPLATEDEFINITION:
+		visitInverseIfcPropertyDefinition( static_cast<const IfcPropertyDefinition*>( entity ), visitor );
+		return true;
+	case IFCDOORLININGPROPERTIES:
+	case IFCDOORPANELPROPERTIES:
+	case IFCELEMENTQUANTITY:
+	case IFCPERMEABLECOVERINGPROPERTIES:
+	case IFCPREDEFINEDPROPERTYSET:
+	case IFCPROPERTYSET:
+	case IFCPROPERTYSETDEFINITION:
+	case IFCQUANTITYSET:
+	case IFCREINFORCEMENTDEFINITIONPROPERTIES:
+	case IFCWINDOWLININGPROPERTIES:
+	case IFCWINDOWPANELPROPERTIES:
+		visitInverseIfcPropertySetDefinition( static_cast<const IfcPropertySetDefinition*>( entity ), visitor );
+		return true;
+	case IFCPROPERTYSETTEMPLATE:
+		visitInverseIfcPropertySetTemplate( static_cast<const IfcPropertySetTemplate*>( entity ), visitor );
+		return true;
+	case IFCCOMPLEXPROPERTYTEMPLATE:
+	case IFCPROPERTYTEMPLATE:
+	case IFCSIMPLEPROPERTYTEMPLATE:
+		visitInverseIfcPropertyTemplate( static_cast<const IfcPropertyTemplate*>( entity ), visitor );
+		return true;
+	case IFCRELSPACEBOUNDARY1STLEVEL:
+		visitInverseIfcRelSpaceBoundary1stLevel( static_cast<const IfcRelSpaceBoundary1stLevel*>( entity ), visitor );
+		return true;
+	case IFCRELSPACEBOUNDARY2NDLEVEL:
+		visitInverseIfcRelSpaceBoundary2ndLevel( static_cast<const IfcRelSpaceBoundary2ndLevel*>( entity ), visitor );
+		return true;
+	case IFCREPRESENTATION:
+	case IFCSTYLEMODEL:
+	case IFCSTYLEDREPRESENTATION:
+		visitInverseIfcRepresentation( static_cast<const IfcRepresentation*>( entity ), visitor );
+		return true;
+	case IFCREPRESENTATIONCONTEXT:
+		visitInverseIfcRepresentationContext( static_cast<const IfcRepresentationContext*>( entity ), visitor );
+		return true;
+	case IFCADVANCEDBREP:
+	case IFCADVANCEDBREPWITHVOIDS:
+	case IFCANNOTATIONFILLAREA:
+	case IFCAXIS1PLACEMENT:
+	case IFCAXIS2PLACEMENT2D:
+	case IFCAXIS2PLACEMENT3D:
+	case IFCAXIS2PLACEMENTLINEAR:
+	case IFCBSPLINECURVE:
+	case IFCBSPLINECURVEWITHKNOTS:
+	case IFCBSPLINESURFACE:
+	case IFCBSPLINESURFACEWITHKNOTS:
+	case IFCBLOCK:
+	case IFCBOOLEANCLIPPINGRESULT:
+	case IFCBOOLEANRESULT:
+	case IFCBOUNDARYCURVE:
+	case IFCBOUNDEDCURVE:
+	case IFCBOUNDEDSURFACE:
+	case IFCBOUNDINGBOX:
+	case IFCBOXEDHALFSPACE:
+	case IFCCARTESIANPOINT:
+	case IFCCARTESIANPOINTLIST:
+	case IFCCARTESIANPOINTLIST2D:
+	case IFCCARTESIANPOINTLIST3D:
+	case IFCCARTESIANTRANSFORMATIONOPERATOR:
+	case IFCCARTESIANTRANSFORMATIONOPERATOR2D:
+	case IFCCARTESIANTRANSFORMATIONOPERATOR2DNONUNIFORM:
+	case IFCCARTESIANTRANSFORMATIONOPERATOR3D:
+	case IFCCARTESIANTRANSFORMATIONOPERATOR3DNONUNIFORM:
+	case IFCCIRCLE:
+	case IFCCLOSEDSHELL:
+	case IFCCLOTHOID:
+	case IFCCOMPOSITECURVE:
+	case IFCCOMPOSITECURVEONSURFACE:
+	case IFCCONIC:
+	case IFCCONNECTEDFACESET:
+	case IFCCOSINESPIRAL:
+	case IFCCSGPRIMITIVE3D:
+	case IFCCSGSOLID:
+	case IFCCURVE:
+	case IFCCURVEBOUNDEDPLANE:
+	case IFCCURVEBOUNDEDSURFACE:
+	case IFCCYLINDRICALSURFACE:
+	case IFCDIRECTION:
+	case IFCDIRECTRIXCURVESWEPTAREASOLID:
+	case IFCDIRECTRIXDERIVEDREFERENCESWEPTAREASOLID:
+	case IFCEDGE:
+	case IFCEDGECURVE:
+	case IFCEDGELOOP:
+	case IFCELEMENTARYSURFACE:
+	case IFCELLIPSE:
+	case IFCEXTRUDEDAREASOLID:
+	case IFCEXTRUDEDAREASOLIDTAPERED:
+	case IFCFACEBASEDSURFACEMODEL:
+	case IFCFACEBOUND:
+	case IFCFACEOUTERBOUND:
+	case IFCFACETEDBREP:
+	case IFCFACETEDBREPWITHVOIDS:
+	case IFCFILLAREASTYLEHATCHING:
+	case IFCFILLAREASTYLETILES:
+	case IFCFIXEDREFERENCESWEPTAREASOLID:
+	case IFCGEOMETRICCURVESET:
+	case IFCGEOMETRICREPRESENTATIONITEM:
+	case IFCGEOMETRICSET:
+	case IFCGRADIENTCURVE:
+	case IFCHALFSPACESOLID:
+	case IFCINDEXEDPOLYCURVE:
+	case IFCINTERSECTIONCURVE:
+	case IFCLIGHTSOURCE:
+	case IFCLIGHTSOURCEAMBIENT:
+	case IFCLIGHTSOURCEDIRECTIONAL:
+	case IFCLIGHTSOURCEGONIOMETRIC:
+	case IFCLIGHTSOURCEPOSITIONAL:
+	case IFCLIGHTSOURCESPOT:
+	case IFCLINE:
+	case IFCLOOP:
+	case IFCMANIFOLDSOLIDBREP:
+	case IFCMAPPEDITEM:
+	case IFCOFFSETCURVE:
+	case IFCOFFSETCURVE2D:
+	case IFCOFFSETCURVE3D:
+	case IFCOFFSETCURVEBYDISTANCES:
+	case IFCOPENSHELL:
+	case IFCORIENTEDEDGE:
+	case IFCOUTERBOUNDARYCURVE:
+	case IFCPATH:
+	case IFCPCURVE:
+	case IFCPLACEMENT:
+	case IFCPLANARBOX:
+	case IFCPLANAREXTENT:
+	case IFCPLANE:
+	case IFCPOINT:
+	case IFCPOINTBYDISTANCEEXPRESSION:
+	case IFCPOINTONCURVE:
+	case IFCPOINTONSURFACE:
+	case IFCPOLYLOOP:
+	case IFCPOLYGONALBOUNDEDHALFSPACE:
+	case IFCPOLYLINE:
+	case IFCPOLYNOMIALCURVE:
+	case IFCRATIONALBSPLINECURVEWITHKNOTS:
+	case IFCRATIONALBSPLINESURFACEWITHKNOTS:
+	case IFCRECTANGULARPYRAMID:
+	case IFCRECTANGULARTRIMMEDSURFACE:
+	case IFCREPRESENTATIONITEM:
+	case IFCREVOLVEDAREASOLID:
+	case IFCREVOLVEDAREASOLIDTAPERED:
+	case IFCRIGHTCIRCULARCONE:
+	case IFCRIGHTCIRCULARCYLINDER:
+	case IFCSEAMCURVE:
+	case IFCSECONDORDERPOLYNOMIALSPIRAL:
+	case IFCSECTIONEDSOLID:
+	case IFCSECTIONEDSOLIDHORIZONTAL:
+	case IFCSECTIONEDSPINE:
+	case IFCSECTIONEDSURFACE:
+	case IFCSEGMENTEDREFERENCECURVE:
+	case IFCSEVENTHORDERPOLYNOMIALSPIRAL:
+	case IFCSHELLBASEDSURFACEMODEL:
+	case IFCSINESPIRAL:
+	case IFCSOLIDMODEL:
+	case IFCSPHERE:
+	case IFCSPHERICALSURFACE:
+	case IFCSPIRAL:
+	case IFCSTYLEDITEM:
+	case IFCSUBEDGE:
+	case IFCSURFACE:
+	case IFCSURFACECURVE:
+	case IFCSURFACECURVESWEPTAREASOLID:
+	case IFCSURFACEOFLINEAREXTRUSION:
+	case IFCSURFACEOFREVOLUTION:
+	case IFCSWEPTAREASOLID:
+	case IFCSWEPTDISKSOLID:
+	case IFCSWEPTDISKSOLIDPOLYGONAL:
+	case IFCSWEPTSURFACE:
+	case IFCTESSELLATEDITEM:
+	case IFCTEXTLITERAL:
+	case IFCTEXTLITERALWITHEXTENT:
+	case IFCTHIRDORDERPOLYNOMIALSPIRAL:
+	case IFCTOPOLOGICALREPRESENTATIONITEM:
+	case IFCTOROIDALSURFACE:
+	case IFCTRIMMEDCURVE:
+	case IFCVECTOR:
+	case IFCVERTEX:
+	case IFCVERTEXLOOP:
+	case IFCVERTEXPOINT:
+		visitInverseIfcRepresentationItem( static_cast<const IfcRepresentationItem*>( entity ), visitor );
+		return true;
+	case IFCREPRESENTATIONMAP:
+		visitInverseIfcRepresentationMap( static_cast<const IfcRepresentationMap*>( entity ), visitor );
+		return true;
+	case IFCCONSTRUCTIONEQUIPMENTRESOURCE:
+	case IFCCONSTRUCTIONMATERIALRESOURCE:
+	case IFCCONSTRUCTIONPRODUCTRESOURCE:
+	case IFCCONSTRUCTIONRESOURCE:
+	case IFCCREWRESOURCE:
+	case IFCLABORRESOURCE:
+	case IFCRESOURCE:
+	case IFCSUBCONTRACTRESOURCE:
+		visitInverseIfcResource( static_cast<const IfcResource*>( entity ), visitor );
+		return true;
+	case IFCCOMPOSITECURVESEGMENT:
+	case IFCCURVESEGMENT:
+	case IFCREPARAMETRISEDCOMPOSITECURVESEGMENT:
+	case IFCSEGMENT:
+		visitInverseIfcSegment( static_cast<const IfcSegment*>( entity ), visitor );
+		return true;
+	case IFCSHAPEASPECT:
+		visitInverseIfcShapeAspect( static_cast<const IfcShapeAspect*>( entity ), visitor );
+		return true;
+	case IFCSHAPEMODEL:
+	case IFCSHAPEREPRESENTATION:
+	case IFCTOPOLOGYREPRESENTATION:
+		visitInverseIfcShapeModel( static_cast<const IfcShapeModel*>( entity ), visitor );
+		return true;
+	case IFCSPACE:
+		visitInverseIfcSpace( static_cast<const IfcSpace*>( entity ), visitor );
+		return true;
+	case IFCBRIDGE:
+	case IFCBRIDGEPART:
+	case IFCBUILDING:
+	case IFCBUILDINGSTOREY:
+	case IFCEXTERNALSPATIALSTRUCTUREELEMENT:
+	case IFCFACILITY:
+	case IFCFACILITYPART:
+	case IFCFACILITYPARTCOMMON:
+	case IFCMARINEFACILITY:
+	case IFCMARINEPART:
+	case IFCRAILWAY:
+	case IFCRAILWAYPART:
+	case IFCROAD:
+	case IFCROADPART:
+	case IFCSITE:
+	case IFCSPATIALELEMENT:
+	case IFCSPATIALSTRUCTUREELEMENT:
+	case IFCSPATIALZONE:
+		visitInverseIfcSpatialElement( static_cast<const IfcSpatialElement*>( entity ), visitor );
+		return true;
+	case IFCSTRUCTURALACTION:
+	case IFCSTRUCTURALACTIVITY:
+	case IFCSTRUCTURALCURVEACTION:
+	case IFCSTRUCTURALCURVEREACTION:
+	case IFCSTRUCTURALLINEARACTION:
+	case IFCSTRUCTURALPLANARACTION:
+	case IFCSTRUCTURALPOINTACTION:
+	case IFCSTRUCTURALPOINTREACTION:
+	case IFCSTRUCTURALREACTION:
+	case IFCSTRUCTURALSURFACEACTION:
+	case IFCSTRUCTURALSURFACEREACTION:
+		visitInverseIfcStructuralActivity( static_cast<const IfcStructuralActivity*>( entity ), visitor );
+		return true;
+	case IFCSTRUCTURALCONNECTION:
+	case IFCSTRUCTURALCURVECONNECTION:
+	case IFCSTRUCTURALPOINTCONNECTION:
+	case IFCSTRUCTURALSURFACECONNECTION:
+		visitInverseIfcStructuralConnection( static_cast<const IfcStructuralConnection*>( entity ), visitor );
+		return true;
+	case IFCSTRUCTURALITEM:
+		visitInverseIfcStructuralItem( static_cast<const IfcStructuralItem*>( entity ), visitor );
+		return true;
+	case IFCSTRUCTURALLOADCASE:
+	case IFCSTRUCTURALLOADGROUP:
+		visitInverseIfcStructuralLoadGroup( static_cast<const IfcStructuralLoadGroup*>( entity ), visitor );
+		return true;
+	case IFCSTRUCTURALCURVEMEMBER:
+	case IFCSTRUCTURALCURVEMEMBERVARYING:
+	case IFCSTRUCTURALMEMBER:
+	case IFCSTRUCTURALSURFACEMEMBER:
+	case IFCSTRUCTURALSURFACEMEMBERVARYING:
+		visitInverseIfcStructuralMember( static_cast<const IfcStructuralMember*>( entity ), visitor );
+		return true;
+	case IFCSTRUCTURALRESULTGROUP:
+		visitInverseIfcStructuralResultGroup( static_cast<const IfcStructuralResultGroup*>( entity ), visitor );
+		return true;
+	case IFCSURFACEFEATURE:
+		visitInverseIfcSurfaceFeature( static_cast<const IfcSurfaceFeature*>( entity ), visitor );
+		return true;
+	case IFCBLOBTEXTURE:
+	case IFCIMAGETEXTURE:
+	case IFCPIXELTEXTURE:
+	case IFCSURFACETEXTURE:
+		visitInverseIfcSurfaceTexture( static_cast<const IfcSurfaceTexture*>( entity ), visitor );
+		return true;
+	case IFCBUILDINGSYSTEM:
+	case IFCBUILTSYSTEM:
+	case IFCDISTRIBUTIONCIRCUIT:
+	case IFCDISTRIBUTIONSYSTEM:
+	case IFCSTRUCTURALANALYSISMODEL:
+	case IFCSYSTEM:
+	case IFCZONE:
+		visitInverseIfcSystem( static_cast<const IfcSystem*>( entity ), visitor );
+		return true;
+	case IFCPOLYGONALFACESET:
+	case IFCTESSELLATEDFACESET:
+	case IFCTRIANGULATEDFACESET:
+	case IFCTRIANGULATEDIRREGULARNETWORK:
+		visitInverseIfcTessellatedFaceSet( static_cast<const IfcTessellatedFaceSet*>( entity ), visitor );
+		return true;
+	case IFCTEXTURECOORDINATEINDICES:
+	case IFCTEXTURECOORDINATEINDICESWITHVOIDS:
+		visitInverseIfcTextureCoordinateIndices( static_cast<const IfcTextureCoordinateIndices*>( entity ), visitor );
+		return true;
+	case IFCIRREGULARTIMESERIES:
+	case IFCREGULARTIMESERIES:
+	case IFCTIMESERIES:
+		visitInverseIfcTimeSeries( static_cast<const IfcTimeSeries*>( entity ), visitor );
+		return true;
+	case IFCTYPEOBJECT:
+		visitInverseIfcTypeObject( static_cast<const IfcTypeObject*>( entity ), visitor );
+		return true;
+	case IFCEVENTTYPE:
+	case IFCPROCEDURETYPE:
+	case IFCTASKTYPE:
+	case IFCTYPEPROCESS:
+		visitInverseIfcTypeProcess( static_cast<const IfcTypeProcess*>( entity ), visitor );
+		return true;
+	case IFCACTUATORTYPE:
+	case IFCAIRTERMINALBOXTYPE:
+	case IFCAIRTERMINALTYPE:
+	case IFCAIRTOAIRHEATRECOVERYTYPE:
+	case IFCALARMTYPE:
+	case IFCAUDIOVISUALAPPLIANCETYPE:
+	case IFCBEAMTYPE:
+	case IFCBEARINGTYPE:
+	case IFCBOILERTYPE:
+	case IFCBUILDINGELEMENTPARTTYPE:
+	case IFCBUILDINGELEMENTPROXYTYPE:
+	case IFCBUILTELEMENTTYPE:
+	case IFCBURNERTYPE:
+	case IFCCABLECARRIERFITTINGTYPE:
+	case IFCCABLECARRIERSEGMENTTYPE:
+	case IFCCABLEFITTINGTYPE:
+	case IFCCABLESEGMENTTYPE:
+	case IFCCAISSONFOUNDATIONTYPE:
+	case IFCCHILLERTYPE:
+	case IFCCHIMNEYTYPE:
+	case IFCCIVILELEMENTTYPE:
+	case IFCCOILTYPE:
+	case IFCCOLUMNTYPE:
+	case IFCCOMMUNICATIONSAPPLIANCETYPE:
+	case IFCCOMPRESSORTYPE:
+	case IFCCONDENSERTYPE:
+	case IFCCONTROLLERTYPE:
+	case IFCCONVEYORSEGMENTTYPE:
+	case IFCCOOLEDBEAMTYPE:
+	case IFCCOOLINGTOWERTYPE:
+	case IFCCOURSETYPE:
+	case IFCCOVERINGTYPE:
+	case IFCCURTAINWALLTYPE:
+	case IFCDAMPERTYPE:
+	case IFCDEEPFOUNDATIONTYPE:
+	case IFCDISCRETEACCESSORYTYPE:
+	case IFCDISTRIBUTIONBOARDTYPE:
+	case IFCDISTRIBUTIONCHAMBERELEMENTTYPE:
+	case IFCDISTRIBUTIONCONTROLELEMENTTYPE:
+	case IFCDISTRIBUTIONELEMENTTYPE:
+	case IFCDISTRIBUTIONFLOWELEMENTTYPE:
+	case IFCDOORSTYLE:
+	case IFCDOORTYPE:
+	case IFCDUCTFITTINGTYPE:
+	case IFCDUCTSEGMENTTYPE:
+	case IFCDUCTSILENCERTYPE:
+	case IFCELECTRICAPPLIANCETYPE:
+	case IFCELECTRICDISTRIBUTIONBOARDTYPE:
+	case IFCELECTRICFLOWSTORAGEDEVICETYPE:
+	case IFCELECTRICFLOWTREATMENTDEVICETYPE:
+	case IFCELECTRICGENERATORTYPE:
+	case IFCELECTRICMOTORTYPE:
+	case IFCELECTRICTIMECONTROLTYPE:
+	case IFCELEMENTASSEMBLYTYPE:
+	case IFCELEMENTCOMPONENTTYPE:
+	case IFCELEMENTTYPE:
+	case IFCENERGYCONVERSIONDEVICETYPE:
+	case IFCENGINETYPE:
+	case IFCEVAPORATIVECOOLERTYPE:
+	case IFCEVAPORATORTYPE:
+	case IFCFANTYPE:
+	case IFCFASTENERTYPE:
+	case IFCFILTERTYPE:
+	case IFCFIRESUPPRESSIONTERMINALTYPE:
+	case IFCFLOWCONTROLLERTYPE:
+	case IFCFLOWFITTINGTYPE:
+	case IFCFLOWINSTRUMENTTYPE:
+	case IFCFLOWMETERTYPE:
+	case IFCFLOWMOVINGDEVICETYPE:
+	case IFCFLOWSEGMENTTYPE:
+	case IFCFLOWSTORAGEDEVICETYPE:
+	case IFCFLOWTERMINALTYPE:
+	case IFCFLOWTREATMENTDEVICETYPE:
+	case IFCFOOTINGTYPE:
+	case IFCFURNISHINGELEMENTTYPE:
+	case IFCFURNITURETYPE:
+	case IFCGEOGRAPHICELEMENTTYPE:
+	case IFCHEATEXCHANGERTYPE:
+	case IFCHUMIDIFIERTYPE:
+	case IFCIMPACTPROTECTIONDEVICETYPE:
+	case IFCINTERCEPTORTYPE:
+	case IFCJUNCTIONBOXTYPE:
+	case IFCKERBTYPE:
+	case IFCLAMPTYPE:
+	case IFCLIGHTFIXTURETYPE:
+	case IFCLIQUIDTERMINALTYPE:
+	case IFCMECHANICALFASTENERTYPE:
+	case IFCMEDICALDEVICETYPE:
+	case IFCMEMBERTYPE:
+	case IFCMOBILETELECOMMUNICATIONSAPPLIANCETYPE:
+	case IFCMOORINGDEVICETYPE:
+	case IFCMOTORCONNECTIONTYPE:
+	case IFCNAVIGATIONELEMENTTYPE:
+	case IFCOUTLETTYPE:
+	case IFCPAVEMENTTYPE:
+	case IFCPILETYPE:
+	case IFCPIPEFITTINGTYPE:
+	case IFCPIPESEGMENTTYPE:
+	case IFCPLATETYPE:
+	case IFCPROTECTIVEDEVICETRIPPINGUNITTYPE:
+	case IFCPROTECTIVEDEVICETYPE:
+	case IFCPUMPTYPE:
+	case IFCRAILTYPE:
+	case IFCRAILINGTYPE:
+	case IFCRAMPFLIGHTTYPE:
+	case IFCRAMPTYPE:
+	case IFCREINFORCINGBARTYPE:
+	case IFCREINFORCINGELEMENTTYPE:
+	case IFCREINFORCINGMESHTYPE:
+	case IFCROOFTYPE:
+	case IFCSANITARYTERMINALTYPE:
+	case IFCSENSORTYPE:
+	case IFCSHADINGDEVICETYPE:
+	case IFCSIGNTYPE:
+	case IFCSIGNALTYPE:
+	case IFCSLABTYPE:
+	case IFCSOLARDEVICETYPE:
+	case IFCSPACEHEATERTYPE:
+	case IFCSPACETYPE:
+	case IFCSPATIALELEMENTTYPE:
+	case IFCSPATIALSTRUCTUREELEMENTTYPE:
+	case IFCSPATIALZONETYPE:
+	case IFCSTACKTERMINALTYPE:
+	case IFCSTAIRFLIGHTTYPE:
+	case IFCSTAIRTYPE:
+	case IFCSWITCHINGDEVICETYPE:
+	case IFCSYSTEMFURNITUREELEMENTTYPE:
+	case IFCTANKTYPE:
+	case IFCTENDONANCHORTYPE:
+	case IFCTENDONCONDUITTYPE:
+	case IFCTENDONTYPE:
+	case IFCTRACKELEMENTTYPE:
+	case IFCTRANSFORMERTYPE:
+	case IFCTRANSPORTELEMENTTYPE:
+	case IFCTRANSPORTATIONDEVICETYPE:
+	case IFCTUBEBUNDLETYPE:
+	case IFCTYPEPRODUCT:
+	case IFCUNITARYCONTROLELEMENTTYPE:
+	case IFCUNITARYEQUIPMENTTYPE:
+	case IFCVALVETYPE:
+	case IFCVEHICLETYPE:
+	case IFCVIBRATIONDAMPERTYPE:
+	case IFCVIBRATIONISOLATORTYPE:
+	case IFCWALLTYPE:
+	case IFCWASTETERMINALTYPE:
+	case IFCWINDOWSTYLE:
+	case IFCWINDOWTYPE:
+		visitInverseIfcTypeProduct( static_cast<const IfcTypeProduct*>( entity ), visitor );
+		return true;
+	case IFCCONSTRUCTIONEQUIPMENTRESOURCETYPE:
+	case IFCCONSTRUCTIONMATERIALRESOURCETYPE:
+	case IFCCONSTRUCTIONPRODUCTRESOURCETYPE:
+	case IFCCONSTRUCTIONRESOURCETYPE:
+	case IFCCREWRESOURCETYPE:
+	case IFCLABORRESOURCETYPE:
+	case IFCSUBCONTRACTRESOURCETYPE:
+	case IFCTYPERESOURCE:
+		visitInverseIfcTypeResource( static_cast<const IfcTypeResource*>( entity ), visitor );
+		return true;
+	default:
+		return false;
+	}
+}
@@ -0,0 +1,52 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#pragma once
+
+#include "ifcpp/model/BasicTypes.h"
+#include "ifcpp/model/BuildingObject.h"
+#include "ifcpp/model/GlobalDefines.h"
+
+namespace IFC4X3
+{
+	///@brief Receives the entities that the attributes of an entity refer to, see EntityReferences
+	class IFCQUERY_EXPORT EntityReferenceVisitor
+	{
+	public:
+		virtual ~EntityReferenceVisitor() = default;
+
+		///@returns true if the visitor keeps a reference to entity, which it then gets in keepReference. Entities that are already known can be skipped without copying a shared_ptr
+		virtual bool visitReference( BuildingEntity* entity ) = 0;
+
+		virtual void keepReference( const shared_ptr<BuildingEntity>& entity ) = 0;
+	};
+
+	///@brief Entity references of the generated classes, without getAttributes
+	///@details getAttributes allocates a list for each list attribute and a name for each attribute, and the values have to be cast to find the entities.
+	///The functions here read the members that can hold entities directly, and cast only the values of select types that contain entities. They are
+	///generated from the member declarations of the headers in include/, so they have to be updated together with the generated classes.
+	class IFCQUERY_EXPORT EntityReferences
+	{
+	public:
+		///@brief Passes each entity that an attribute of entity refers to, also in lists and select types, to visitor. Inherited attributes first, as in getAttributes
+		///@returns false if the class of entity is not in the table
+		static bool forEachReference( const BuildingEntity* entity, EntityReferenceVisitor& visitor );
+
+		///@brief Same as forEachReference, for the inverse attributes. Expired references are skipped
+		static bool forEachInverseReference( const BuildingEntity* entity, EntityReferenceVisitor& visitor );
+	};
+}
@@ -0,0 +1,1487 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <unordered_map>
+#include <unordered_set>
+#include "ifcpp/IFC4X3/SchemaInfo.h"
+
+using namespace IFC4X3;
+
+namespace
+{
+	struct SchemaTableEntry
+	{
+		const char* name_upper;
+		SchemaTypeKind kind;
+		uint8_t list_depth;
+		const char* supertypes;		// separated by spaces
+		const char* attributes;		// entities: declared types of the attributes that are not inherited, with one '*' per list level
+	};
+
+	const SchemaTableEntry SCHEMA_TABLE[] = {
+		{ "IFCABSORBEDDOSEMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCACCELERATIONMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCACTIONREQUEST", SCHEMA_ENTITY, 0, "IFCCONTROL", "IFCACTIONREQUESTTYPEENUM IFCLABEL IFCTEXT" },
+		{ "IFCACTIONREQUESTTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCACTIONSOURCETYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCACTIONTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCACTOR", SCHEMA_ENTITY, 0, "IFCOBJECT", "IFCACTORSELECT" },
+		{ "IFCACTORROLE", SCHEMA_ENTITY, 0, "IFCRESOURCEOBJECTSELECT", "IFCROLEENUM IFCLABEL IFCTEXT" },
+		{ "IFCACTORSELECT", SCHEMA_SELECT, 0, "", "" },
+		{ "IFCACTUATOR", SCHEMA_ENTITY, 0, "IFCDISTRIBUTIONCONTROLELEMENT", "IFCACTUATORTYPEENUM" },
+		{ "IFCACTUATORTYPE", SCHEMA_ENTITY, 0, "IFCDISTRIBUTIONCONTROLELEMENTTYPE", "IFCACTUATORTYPEENUM" },
+		{ "IFCACTUATORTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCADDRESS", SCHEMA_ENTITY, 0, "IFCOBJECTREFERENCESELECT", "IFCADDRESSTYPEENUM IFCTEXT IFCLABEL" },
+		{ "IFCADDRESSTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCADVANCEDBREP", SCHEMA_ENTITY, 0, "IFCMANIFOLDSOLIDBREP", "" },
+		{ "IFCADVANCEDBREPWITHVOIDS", SCHEMA_ENTITY, 0, "IFCADVANCEDBREP", "IFCCLOSEDSHELL*" },
+		{ "IFCADVANCEDFACE", SCHEMA_ENTITY, 0, "IFCFACESURFACE", "" },
+		{ "IFCAIRTERMINAL", SCHEMA_ENTITY, 0, "IFCFLOWTERMINAL", "IFCAIRTERMINALTYPEENUM" },
+		{ "IFCAIRTERMINALBOX", SCHEMA_ENTITY, 0, "IFCFLOWCONTROLLER", "IFCAIRTERMINALBOXTYPEENUM" },
+		{ "IFCAIRTERMINALBOXTYPE", SCHEMA_ENTITY, 0, "IFCFLOWCONTROLLERTYPE", "IFCAIRTERMINALBOXTYPEENUM" },
+		{ "IFCAIRTERMINALBOXTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCAIRTERMINALTYPE", SCHEMA_ENTITY, 0, "IFCFLOWTERMINALTYPE", "IFCAIRTERMINALTYPEENUM" },
+		{ "IFCAIRTERMINALTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCAIRTOAIRHEATRECOVERY", SCHEMA_ENTITY, 0, "IFCENERGYCONVERSIONDEVICE", "IFCAIRTOAIRHEATRECOVERYTYPEENUM" },
+		{ "IFCAIRTOAIRHEATRECOVERYTYPE", SCHEMA_ENTITY, 0, "IFCENERGYCONVERSIONDEVICETYPE", "IFCAIRTOAIRHEATRECOVERYTYPEENUM" },
+		{ "IFCAIRTOAIRHEATRECOVERYTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCALARM", SCHEMA_ENTITY, 0, "IFCDISTRIBUTIONCONTROLELEMENT", "IFCALARMTYPEENUM" },
+		{ "IFCALARMTYPE", SCHEMA_ENTITY, 0, "IFCDISTRIBUTIONCONTROLELEMENTTYPE", "IFCALARMTYPEENUM" },
+		{ "IFCALARMTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCALIGNMENT", SCHEMA_ENTITY, 0, "IFCLINEARPOSITIONINGELEMENT", "IFCALIGNMENTTYPEENUM" },
+		{ "IFCALIGNMENTCANT", SCHEMA_ENTITY, 0, "IFCLINEARELEMENT", "IFCPOSITIVELENGTHMEASURE" },
+		{ "IFCALIGNMENTCANTSEGMENT", SCHEMA_ENTITY, 0, "IFCALIGNMENTPARAMETERSEGMENT", "IFCLENGTHMEASURE IFCNONNEGATIVELENGTHMEASURE IFCLENGTHMEASURE IFCLENGTHMEASURE IFCLENGTHMEASURE IFCLENGTHMEASURE IFCALIGNMENTCANTSEGMENTTYPEENUM" },
+		{ "IFCALIGNMENTCANTSEGMENTTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCALIGNMENTHORIZONTAL", SCHEMA_ENTITY, 0, "IFCLINEARELEMENT", "" },
+		{ "IFCALIGNMENTHORIZONTALSEGMENT", SCHEMA_ENTITY, 0, "IFCALIGNMENTPARAMETERSEGMENT", "IFCCARTESIANPOINT IFCPLANEANGLEMEASURE IFCLENGTHMEASURE IFCLENGTHMEASURE IFCNONNEGATIVELENGTHMEASURE IFCPOSITIVELENGTHMEASURE IFCALIGNMENTHORIZONTALSEGMENTTYPEENUM" },
+		{ "IFCALIGNMENTHORIZONTALSEGMENTTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCALIGNMENTPARAMETERSEGMENT", SCHEMA_ENTITY, 0, "", "IFCLABEL IFCLABEL" },
+		{ "IFCALIGNMENTSEGMENT", SCHEMA_ENTITY, 0, "IFCLINEARELEMENT", "IFCALIGNMENTPARAMETERSEGMENT" },
+		{ "IFCALIGNMENTTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCALIGNMENTVERTICAL", SCHEMA_ENTITY, 0, "IFCLINEARELEMENT", "" },
+		{ "IFCALIGNMENTVERTICALSEGMENT", SCHEMA_ENTITY, 0, "IFCALIGNMENTPARAMETERSEGMENT", "IFCLENGTHMEASURE IFCNONNEGATIVELENGTHMEASURE IFCLENGTHMEASURE IFCRATIOMEASURE IFCRATIOMEASURE IFCLENGTHMEASURE IFCALIGNMENTVERTICALSEGMENTTYPEENUM" },
+		{ "IFCALIGNMENTVERTICALSEGMENTTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCAMOUNTOFSUBSTANCEMEASURE", SCHEMA_NUMBER, 0, "IFCMEASUREVALUE", "" },
+		{ "IFCANALYSISMODELTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCANALYSISTHEORYTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCANGULARVELOCITYMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCANNOTATION", SCHEMA_ENTITY, 0, "IFCPRODUCT", "IFCANNOTATIONTYPEENUM" },
+		{ "IFCANNOTATIONFILLAREA", SCHEMA_ENTITY, 0, "IFCGEOMETRICREPRESENTATIONITEM", "IFCCURVE IFCCURVE*" },
+		{ "IFCANNOTATIONTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCAPPLICATION", SCHEMA_ENTITY, 0, "", "IFCORGANIZATION IFCLABEL IFCLABEL IFCIDENTIFIER" },
+		{ "IFCAPPLIEDVALUE", SCHEMA_ENTITY, 0, "IFCMETRICVALUESELECT IFCOBJECTREFERENCESELECT IFCRESOURCEOBJECTSELECT", "IFCLABEL IFCTEXT IFCAPPLIEDVALUESELECT IFCMEASUREWITHUNIT IFCDATE IFCDATE IFCLABEL IFCLABEL IFCARITHMETICOPERATORENUM IFCAPPLIEDVALUE*" },
+		{ "IFCAPPLIEDVALUESELECT", SCHEMA_SELECT, 0, "", "" },
+		{ "IFCAPPROVAL", SCHEMA_ENTITY, 0, "IFCRESOURCEOBJECTSELECT", "IFCIDENTIFIER IFCLABEL IFCTEXT IFCDATETIME IFCLABEL IFCLABEL IFCTEXT IFCACTORSELECT IFCACTORSELECT" },
+		{ "IFCAPPROVALRELATIONSHIP", SCHEMA_ENTITY, 0, "IFCRESOURCELEVELRELATIONSHIP", "IFCAPPROVAL IFCAPPROVAL*" },
+		{ "IFCARBITRARYCLOSEDPROFILEDEF", SCHEMA_ENTITY, 0, "IFCPROFILEDEF", "IFCCURVE" },
+		{ "IFCARBITRARYOPENPROFILEDEF", SCHEMA_ENTITY, 0, "IFCPROFILEDEF", "IFCBOUNDEDCURVE" },
+		{ "IFCARBITRARYPROFILEDEFWITHVOIDS", SCHEMA_ENTITY, 0, "IFCARBITRARYCLOSEDPROFILEDEF", "IFCCURVE*" },
+		{ "IFCARCINDEX", SCHEMA_NUMBER, 1, "IFCPOSITIVEINTEGER IFCSEGMENTINDEXSELECT", "" },
+		{ "IFCAREADENSITYMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCAREAMEASURE", SCHEMA_NUMBER, 0, "IFCMEASUREVALUE", "" },
+		{ "IFCARITHMETICOPERATORENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCASSEMBLYPLACEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCASSET", SCHEMA_ENTITY, 0, "IFCGROUP", "IFCIDENTIFIER IFCCOSTVALUE IFCCOSTVALUE IFCCOSTVALUE IFCACTORSELECT IFCACTORSELECT IFCPERSON IFCDATE IFCCOSTVALUE" },
+		{ "IFCASYMMETRICISHAPEPROFILEDEF", SCHEMA_ENTITY, 0, "IFCPARAMETERIZEDPROFILEDEF", "IFCPOSITIVELENGTHMEASURE IFCPOSITIVELENGTHMEASURE IFCPOSITIVELENGTHMEASURE IFCPOSITIVELENGTHMEASURE IFCNONNEGATIVELENGTHMEASURE IFCPOSITIVELENGTHMEASURE IFCPOSITIVELENGTHMEASURE IFCNONNEGATIVELENGTHMEASURE IFCNONNEGATIVELENGTHMEASURE IFCPLANEANGLEMEASURE IFCNONNEGATIVELENGTHMEASURE IFCPLANEANGLEMEASURE" },
+		{ "IFCAUDIOVISUALAPPLIANCE", SCHEMA_ENTITY, 0, "IFCFLOWTERMINAL", "IFCAUDIOVISUALAPPLIANCETYPEENUM" },
+		{ "IFCAUDIOVISUALAPPLIANCETYPE", SCHEMA_ENTITY, 0, "IFCFLOWTERMINALTYPE", "IFCAUDIOVISUALAPPLIANCETYPEENUM" },
+		{ "IFCAUDIOVISUALAPPLIANCETYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCAXIS1PLACEMENT", SCHEMA_ENTITY, 0, "IFCPLACEMENT", "IFCDIRECTION" },
+		{ "IFCAXIS2PLACEMENT", SCHEMA_SELECT, 0, "", "" },
+		{ "IFCAXIS2PLACEMENT2D", SCHEMA_ENTITY, 0, "IFCAXIS2PLACEMENT IFCPLACEMENT", "IFCDIRECTION" },
+		{ "IFCAXIS2PLACEMENT3D", SCHEMA_ENTITY, 0, "IFCAXIS2PLACEMENT IFCPLACEMENT", "IFCDIRECTION IFCDIRECTION" },
+		{ "IFCAXIS2PLACEMENTLINEAR", SCHEMA_ENTITY, 0, "IFCPLACEMENT", "IFCDIRECTION IFCDIRECTION" },
+		{ "IFCBEAM", SCHEMA_ENTITY, 0, "IFCBUILTELEMENT", "IFCBEAMTYPEENUM" },
+		{ "IFCBEAMTYPE", SCHEMA_ENTITY, 0, "IFCBUILTELEMENTTYPE", "IFCBEAMTYPEENUM" },
+		{ "IFCBEAMTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCBEARING", SCHEMA_ENTITY, 0, "IFCBUILTELEMENT", "IFCBEARINGTYPEENUM" },
+		{ "IFCBEARINGTYPE", SCHEMA_ENTITY, 0, "IFCBUILTELEMENTTYPE", "IFCBEARINGTYPEENUM" },
+		{ "IFCBEARINGTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCBENCHMARKENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCBENDINGPARAMETERSELECT", SCHEMA_SELECT, 0, "", "" },
+		{ "IFCBINARY", SCHEMA_BINARY, 0, "IFCSIMPLEVALUE", "" },
+		{ "IFCBLOBTEXTURE", SCHEMA_ENTITY, 0, "IFCSURFACETEXTURE", "IFCIDENTIFIER IFCBINARY" },
+		{ "IFCBLOCK", SCHEMA_ENTITY, 0, "IFCCSGPRIMITIVE3D", "IFCPOSITIVELENGTHMEASURE IFCPOSITIVELENGTHMEASURE IFCPOSITIVELENGTHMEASURE" },
+		{ "IFCBOILER", SCHEMA_ENTITY, 0, "IFCENERGYCONVERSIONDEVICE", "IFCBOILERTYPEENUM" },
+		{ "IFCBOILERTYPE", SCHEMA_ENTITY, 0, "IFCENERGYCONVERSIONDEVICETYPE", "IFCBOILERTYPEENUM" },
+		{ "IFCBOILERTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCBOOLEAN", SCHEMA_ENUM, 0, "IFCMODULUSOFROTATIONALSUBGRADEREACTIONSELECT IFCMODULUSOFSUBGRADEREACTIONSELECT IFCMODULUSOFTRANSLATIONALSUBGRADEREACTIONSELECT IFCROTATIONALSTIFFNESSSELECT IFCSIMPLEVALUE IFCTRANSLATIONALSTIFFNESSSELECT IFCWARPINGSTIFFNESSSELECT", "" },
+		{ "IFCBOOLEANCLIPPINGRESULT", SCHEMA_ENTITY, 0, "IFCBOOLEANRESULT", "" },
+		{ "IFCBOOLEANOPERAND", SCHEMA_SELECT, 0, "", "" },
+		{ "IFCBOOLEANOPERATOR", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCBOOLEANRESULT", SCHEMA_ENTITY, 0, "IFCBOOLEANOPERAND IFCCSGSELECT IFCGEOMETRICREPRESENTATIONITEM", "IFCBOOLEANOPERATOR IFCBOOLEANOPERAND IFCBOOLEANOPERAND" },
+		{ "IFCBOREHOLE", SCHEMA_ENTITY, 0, "IFCGEOTECHNICALASSEMBLY", "" },
+		{ "IFCBOUNDARYCONDITION", SCHEMA_ENTITY, 0, "", "IFCLABEL" },
+		{ "IFCBOUNDARYCURVE", SCHEMA_ENTITY, 0, "IFCCOMPOSITECURVEONSURFACE", "" },
+		{ "IFCBOUNDARYEDGECONDITION", SCHEMA_ENTITY, 0, "IFCBOUNDARYCONDITION", "IFCMODULUSOFTRANSLATIONALSUBGRADEREACTIONSELECT IFCMODULUSOFTRANSLATIONALSUBGRADEREACTIONSELECT IFCMODULUSOFTRANSLATIONALSUBGRADEREACTIONSELECT IFCMODULUSOFROTATIONALSUBGRADEREACTIONSELECT IFCMODULUSOFROTATIONALSUBGRADEREACTIONSELECT IFCMODULUSOFROTATIONALSUBGRADEREACTIONSELECT" },
+		{ "IFCBOUNDARYFACECONDITION", SCHEMA_ENTITY, 0, "IFCBOUNDARYCONDITION", "IFCMODULUSOFSUBGRADEREACTIONSELECT IFCMODULUSOFSUBGRADEREACTIONSELECT IFCMODULUSOFSUBGRADEREACTIONSELECT" },
+		{ "IFCBOUNDARYNODECONDITION", SCHEMA_ENTITY, 0, "IFCBOUNDARYCONDITION", "IFCTRANSLATIONALSTIFFNESSSELECT IFCTRANSLATIONALSTIFFNESSSELECT IFCTRANSLATIONALSTIFFNESSSELECT IFCROTATIONALSTIFFNESSSELECT IFCROTATIONALSTIFFNESSSELECT IFCROTATIONALSTIFFNESSSELECT" },
+		{ "IFCBOUNDARYNODECONDITIONWARPING", SCHEMA_ENTITY, 0, "IFCBOUNDARYNODECONDITION", "IFCWARPINGSTIFFNESSSELECT" },
+		{ "IFCBOUNDEDCURVE", SCHEMA_ENTITY, 0, "IFCCURVEOREDGECURVE IFCCURVE", "" },
+		{ "IFCBOUNDEDSURFACE", SCHEMA_ENTITY, 0, "IFCSURFACE", "" },
+		{ "IFCBOUNDINGBOX", SCHEMA_ENTITY, 0, "IFCGEOMETRICREPRESENTATIONITEM", "IFCCARTESIANPOINT IFCPOSITIVELENGTHMEASURE IFCPOSITIVELENGTHMEASURE IFCPOSITIVELENGTHMEASURE" },
+		{ "IFCBOXALIGNMENT", SCHEMA_STRING, 0, "IFCLABEL", "" },
+		{ "IFCBOXEDHALFSPACE", SCHEMA_ENTITY, 0, "IFCHALFSPACESOLID", "IFCBOUNDINGBOX" },
+		{ "IFCBRIDGE", SCHEMA_ENTITY, 0, "IFCFACILITY", "IFCBRIDGETYPEENUM" },
+		{ "IFCBRIDGEPART", SCHEMA_ENTITY, 0, "IFCFACILITYPART", "IFCBRIDGEPARTTYPEENUM" },
+		{ "IFCBRIDGEPARTTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCBRIDGETYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCBSPLINECURVE", SCHEMA_ENTITY, 0, "IFCBOUNDEDCURVE", "IFCINTEGER IFCCARTESIANPOINT* IFCBSPLINECURVEFORM IFCLOGICAL IFCLOGICAL" },
+		{ "IFCBSPLINECURVEFORM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCBSPLINECURVEWITHKNOTS", SCHEMA_ENTITY, 0, "IFCBSPLINECURVE", "IFCINTEGER* IFCPARAMETERVALUE* IFCKNOTTYPE" },
+		{ "IFCBSPLINESURFACE", SCHEMA_ENTITY, 0, "IFCBOUNDEDSURFACE", "IFCINTEGER IFCINTEGER IFCCARTESIANPOINT** IFCBSPLINESURFACEFORM IFCLOGICAL IFCLOGICAL IFCLOGICAL" },
+		{ "IFCBSPLINESURFACEFORM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCBSPLINESURFACEWITHKNOTS", SCHEMA_ENTITY, 0, "IFCBSPLINESURFACE", "IFCINTEGER* IFCINTEGER* IFCPARAMETERVALUE* IFCPARAMETERVALUE* IFCKNOTTYPE" },
+		{ "IFCBUILDING", SCHEMA_ENTITY, 0, "IFCFACILITY", "IFCLENGTHMEASURE IFCLENGTHMEASURE IFCPOSTALADDRESS" },
+		{ "IFCBUILDINGELEMENTPART", SCHEMA_ENTITY, 0, "IFCELEMENTCOMPONENT", "IFCBUILDINGELEMENTPARTTYPEENUM" },
+		{ "IFCBUILDINGELEMENTPARTTYPE", SCHEMA_ENTITY, 0, "IFCELEMENTCOMPONENTTYPE", "IFCBUILDINGELEMENTPARTTYPEENUM" },
+		{ "IFCBUILDINGELEMENTPARTTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCBUILDINGELEMENTPROXY", SCHEMA_ENTITY, 0, "IFCBUILTELEMENT", "IFCBUILDINGELEMENTPROXYTYPEENUM" },
+		{ "IFCBUILDINGELEMENTPROXYTYPE", SCHEMA_ENTITY, 0, "IFCBUILTELEMENTTYPE", "IFCBUILDINGELEMENTPROXYTYPEENUM" },
+		{ "IFCBUILDINGELEMENTPROXYTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCBUILDINGSTOREY", SCHEMA_ENTITY, 0, "IFCSPATIALSTRUCTUREELEMENT", "IFCLENGTHMEASURE" },
+		{ "IFCBUILDINGSYSTEM", SCHEMA_ENTITY, 0, "IFCSYSTEM", "IFCBUILDINGSYSTEMTYPEENUM IFCLABEL" },
+		{ "IFCBUILDINGSYSTEMTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCBUILTELEMENT", SCHEMA_ENTITY, 0, "IFCELEMENT", "" },
+		{ "IFCBUILTELEMENTTYPE", SCHEMA_ENTITY, 0, "IFCELEMENTTYPE", "" },
+		{ "IFCBUILTSYSTEM", SCHEMA_ENTITY, 0, "IFCSYSTEM", "IFCBUILTSYSTEMTYPEENUM IFCLABEL" },
+		{ "IFCBUILTSYSTEMTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCBURNER", SCHEMA_ENTITY, 0, "IFCENERGYCONVERSIONDEVICE", "IFCBURNERTYPEENUM" },
+		{ "IFCBURNERTYPE", SCHEMA_ENTITY, 0, "IFCENERGYCONVERSIONDEVICETYPE", "IFCBURNERTYPEENUM" },
+		{ "IFCBURNERTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCCABLECARRIERFITTING", SCHEMA_ENTITY, 0, "IFCFLOWFITTING", "IFCCABLECARRIERFITTINGTYPEENUM" },
+		{ "IFCCABLECARRIERFITTINGTYPE", SCHEMA_ENTITY, 0, "IFCFLOWFITTINGTYPE", "IFCCABLECARRIERFITTINGTYPEENUM" },
+		{ "IFCCABLECARRIERFITTINGTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCCABLECARRIERSEGMENT", SCHEMA_ENTITY, 0, "IFCFLOWSEGMENT", "IFCCABLECARRIERSEGMENTTYPEENUM" },
+		{ "IFCCABLECARRIERSEGMENTTYPE", SCHEMA_ENTITY, 0, "IFCFLOWSEGMENTTYPE", "IFCCABLECARRIERSEGMENTTYPEENUM" },
+		{ "IFCCABLECARRIERSEGMENTTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCCABLEFITTING", SCHEMA_ENTITY, 0, "IFCFLOWFITTING", "IFCCABLEFITTINGTYPEENUM" },
+		{ "IFCCABLEFITTINGTYPE", SCHEMA_ENTITY, 0, "IFCFLOWFITTINGTYPE", "IFCCABLEFITTINGTYPEENUM" },
+		{ "IFCCABLEFITTINGTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCCABLESEGMENT", SCHEMA_ENTITY, 0, "IFCFLOWSEGMENT", "IFCCABLESEGMENTTYPEENUM" },
+		{ "IFCCABLESEGMENTTYPE", SCHEMA_ENTITY, 0, "IFCFLOWSEGMENTTYPE", "IFCCABLESEGMENTTYPEENUM" },
+		{ "IFCCABLESEGMENTTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCCAISSONFOUNDATION", SCHEMA_ENTITY, 0, "IFCDEEPFOUNDATION", "IFCCAISSONFOUNDATIONTYPEENUM" },
+		{ "IFCCAISSONFOUNDATIONTYPE", SCHEMA_ENTITY, 0, "IFCDEEPFOUNDATIONTYPE", "IFCCAISSONFOUNDATIONTYPEENUM" },
+		{ "IFCCAISSONFOUNDATIONTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCCARDINALPOINTREFERENCE", SCHEMA_NUMBER, 0, "", "" },
+		{ "IFCCARTESIANPOINT", SCHEMA_ENTITY, 0, "IFCTRIMMINGSELECT IFCPOINT", "REAL*" },
+		{ "IFCCARTESIANPOINTLIST", SCHEMA_ENTITY, 0, "IFCGEOMETRICREPRESENTATIONITEM", "" },
+		{ "IFCCARTESIANPOINTLIST2D", SCHEMA_ENTITY, 0, "IFCCARTESIANPOINTLIST", "IFCLENGTHMEASURE** IFCLABEL*" },
+		{ "IFCCARTESIANPOINTLIST3D", SCHEMA_ENTITY, 0, "IFCCARTESIANPOINTLIST", "IFCLENGTHMEASURE** IFCLABEL*" },
+		{ "IFCCARTESIANTRANSFORMATIONOPERATOR", SCHEMA_ENTITY, 0, "IFCGEOMETRICREPRESENTATIONITEM", "IFCDIRECTION IFCDIRECTION IFCCARTESIANPOINT IFCREAL" },
+		{ "IFCCARTESIANTRANSFORMATIONOPERATOR2D", SCHEMA_ENTITY, 0, "IFCCARTESIANTRANSFORMATIONOPERATOR", "" },
+		{ "IFCCARTESIANTRANSFORMATIONOPERATOR2DNONUNIFORM", SCHEMA_ENTITY, 0, "IFCCARTESIANTRANSFORMATIONOPERATOR2D", "IFCREAL" },
+		{ "IFCCARTESIANTRANSFORMATIONOPERATOR3D", SCHEMA_ENTITY, 0, "IFCCARTESIANTRANSFORMATIONOPERATOR", "IFCDIRECTION" },
+		{ "IFCCARTESIANTRANSFORMATIONOPERATOR3DNONUNIFORM", SCHEMA_ENTITY, 0, "IFCCARTESIANTRANSFORMATIONOPERATOR3D", "IFCREAL IFCREAL" },
+		{ "IFCCENTERLINEPROFILEDEF", SCHEMA_ENTITY, 0, "IFCARBITRARYOPENPROFILEDEF", "IFCPOSITIVELENGTHMEASURE" },
+		{ "IFCCHANGEACTIONENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCCHILLER", SCHEMA_ENTITY, 0, "IFCENERGYCONVERSIONDEVICE", "IFCCHILLERTYPEENUM" },
+		{ "IFCCHILLERTYPE", SCHEMA_ENTITY, 0, "IFCENERGYCONVERSIONDEVICETYPE", "IFCCHILLERTYPEENUM" },
+		{ "IFCCHILLERTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCCHIMNEY", SCHEMA_ENTITY, 0, "IFCBUILTELEMENT", "IFCCHIMNEYTYPEENUM" },
+		{ "IFCCHIMNEYTYPE", SCHEMA_ENTITY, 0, "IFCBUILTELEMENTTYPE", "IFCCHIMNEYTYPEENUM" },
+		{ "IFCCHIMNEYTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCCIRCLE", SCHEMA_ENTITY, 0, "IFCCONIC", "IFCPOSITIVELENGTHMEASURE" },
+		{ "IFCCIRCLEHOLLOWPROFILEDEF", SCHEMA_ENTITY, 0, "IFCCIRCLEPROFILEDEF", "IFCPOSITIVELENGTHMEASURE" },
+		{ "IFCCIRCLEPROFILEDEF", SCHEMA_ENTITY, 0, "IFCPARAMETERIZEDPROFILEDEF", "IFCPOSITIVELENGTHMEASURE" },
+		{ "IFCCIVILELEMENT", SCHEMA_ENTITY, 0, "IFCELEMENT", "" },
+		{ "IFCCIVILELEMENTTYPE", SCHEMA_ENTITY, 0, "IFCELEMENTTYPE", "" },
+		{ "IFCCLASSIFICATION", SCHEMA_ENTITY, 0, "IFCCLASSIFICATIONREFERENCESELECT IFCCLASSIFICATIONSELECT IFCEXTERNALINFORMATION", "IFCLABEL IFCLABEL IFCDATE IFCLABEL IFCTEXT IFCURIREFERENCE IFCIDENTIFIER*" },
+		{ "IFCCLASSIFICATIONREFERENCE", SCHEMA_ENTITY, 0, "IFCCLASSIFICATIONREFERENCESELECT IFCCLASSIFICATIONSELECT IFCEXTERNALREFERENCE", "IFCCLASSIFICATIONREFERENCESELECT IFCTEXT IFCIDENTIFIER" },
+		{ "IFCCLASSIFICATIONREFERENCESELECT", SCHEMA_SELECT, 0, "", "" },
+		{ "IFCCLASSIFICATIONSELECT", SCHEMA_SELECT, 0, "", "" },
+		{ "IFCCLOSEDSHELL", SCHEMA_ENTITY, 0, "IFCSHELL IFCSOLIDORSHELL IFCCONNECTEDFACESET", "" },
+		{ "IFCCLOTHOID", SCHEMA_ENTITY, 0, "IFCSPIRAL", "IFCLENGTHMEASURE" },
+		{ "IFCCOIL", SCHEMA_ENTITY, 0, "IFCENERGYCONVERSIONDEVICE", "IFCCOILTYPEENUM" },
+		{ "IFCCOILTYPE", SCHEMA_ENTITY, 0, "IFCENERGYCONVERSIONDEVICETYPE", "IFCCOILTYPEENUM" },
+		{ "IFCCOILTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCCOLOUR", SCHEMA_SELECT, 0, "IFCFILLSTYLESELECT", "" },
+		{ "IFCCOLOURORFACTOR", SCHEMA_SELECT, 0, "", "" },
+		{ "IFCCOLOURRGB", SCHEMA_ENTITY, 0, "IFCCOLOURORFACTOR IFCCOLOURSPECIFICATION", "IFCNORMALISEDRATIOMEASURE IFCNORMALISEDRATIOMEASURE IFCNORMALISEDRATIOMEASURE" },
+		{ "IFCCOLOURRGBLIST", SCHEMA_ENTITY, 0, "IFCPRESENTATIONITEM", "IFCNORMALISEDRATIOMEASURE**" },
+		{ "IFCCOLOURSPECIFICATION", SCHEMA_ENTITY, 0, "IFCCOLOUR IFCPRESENTATIONITEM", "IFCLABEL" },
+		{ "IFCCOLUMN", SCHEMA_ENTITY, 0, "IFCBUILTELEMENT", "IFCCOLUMNTYPEENUM" },
+		{ "IFCCOLUMNTYPE", SCHEMA_ENTITY, 0, "IFCBUILTELEMENTTYPE", "IFCCOLUMNTYPEENUM" },
+		{ "IFCCOLUMNTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCCOMMUNICATIONSAPPLIANCE", SCHEMA_ENTITY, 0, "IFCFLOWTERMINAL", "IFCCOMMUNICATIONSAPPLIANCETYPEENUM" },
+		{ "IFCCOMMUNICATIONSAPPLIANCETYPE", SCHEMA_ENTITY, 0, "IFCFLOWTERMINALTYPE", "IFCCOMMUNICATIONSAPPLIANCETYPEENUM" },
+		{ "IFCCOMMUNICATIONSAPPLIANCETYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCCOMPLEXNUMBER", SCHEMA_NUMBER, 1, "IFCMEASUREVALUE", "" },
+		{ "IFCCOMPLEXPROPERTY", SCHEMA_ENTITY, 0, "IFCPROPERTY", "IFCIDENTIFIER IFCPROPERTY*" },
+		{ "IFCCOMPLEXPROPERTYTEMPLATE", SCHEMA_ENTITY, 0, "IFCPROPERTYTEMPLATE", "IFCLABEL IFCCOMPLEXPROPERTYTEMPLATETYPEENUM IFCPROPERTYTEMPLATE*" },
+		{ "IFCCOMPLEXPROPERTYTEMPLATETYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCCOMPOSITECURVE", SCHEMA_ENTITY, 0, "IFCBOUNDEDCURVE", "IFCSEGMENT* IFCLOGICAL" },
+		{ "IFCCOMPOSITECURVEONSURFACE", SCHEMA_ENTITY, 0, "IFCCURVEONSURFACE IFCCOMPOSITECURVE", "" },
+		{ "IFCCOMPOSITECURVESEGMENT", SCHEMA_ENTITY, 0, "IFCSEGMENT", "IFCBOOLEAN IFCCURVE" },
+		{ "IFCCOMPOSITEPROFILEDEF", SCHEMA_ENTITY, 0, "IFCPROFILEDEF", "IFCPROFILEDEF* IFCLABEL" },
+		{ "IFCCOMPOUNDPLANEANGLEMEASURE", SCHEMA_NUMBER, 1, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCCOMPRESSOR", SCHEMA_ENTITY, 0, "IFCFLOWMOVINGDEVICE", "IFCCOMPRESSORTYPEENUM" },
+		{ "IFCCOMPRESSORTYPE", SCHEMA_ENTITY, 0, "IFCFLOWMOVINGDEVICETYPE", "IFCCOMPRESSORTYPEENUM" },
+		{ "IFCCOMPRESSORTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCCONDENSER", SCHEMA_ENTITY, 0, "IFCENERGYCONVERSIONDEVICE", "IFCCONDENSERTYPEENUM" },
+		{ "IFCCONDENSERTYPE", SCHEMA_ENTITY, 0, "IFCENERGYCONVERSIONDEVICETYPE", "IFCCONDENSERTYPEENUM" },
+		{ "IFCCONDENSERTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCCONIC", SCHEMA_ENTITY, 0, "IFCCURVE", "IFCAXIS2PLACEMENT" },
+		{ "IFCCONNECTEDFACESET", SCHEMA_ENTITY, 0, "IFCTOPOLOGICALREPRESENTATIONITEM", "IFCFACE*" },
+		{ "IFCCONNECTIONCURVEGEOMETRY", SCHEMA_ENTITY, 0, "IFCCONNECTIONGEOMETRY", "IFCCURVEOREDGECURVE IFCCURVEOREDGECURVE" },
+		{ "IFCCONNECTIONGEOMETRY", SCHEMA_ENTITY, 0, "", "" },
+		{ "IFCCONNECTIONPOINTECCENTRICITY", SCHEMA_ENTITY, 0, "IFCCONNECTIONPOINTGEOMETRY", "IFCLENGTHMEASURE IFCLENGTHMEASURE IFCLENGTHMEASURE" },
+		{ "IFCCONNECTIONPOINTGEOMETRY", SCHEMA_ENTITY, 0, "IFCCONNECTIONGEOMETRY", "IFCPOINTORVERTEXPOINT IFCPOINTORVERTEXPOINT" },
+		{ "IFCCONNECTIONSURFACEGEOMETRY", SCHEMA_ENTITY, 0, "IFCCONNECTIONGEOMETRY", "IFCSURFACEORFACESURFACE IFCSURFACEORFACESURFACE" },
+		{ "IFCCONNECTIONTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCCONNECTIONVOLUMEGEOMETRY", SCHEMA_ENTITY, 0, "IFCCONNECTIONGEOMETRY", "IFCSOLIDORSHELL IFCSOLIDORSHELL" },
+		{ "IFCCONSTRAINT", SCHEMA_ENTITY, 0, "IFCRESOURCEOBJECTSELECT", "IFCLABEL IFCTEXT IFCCONSTRAINTENUM IFCLABEL IFCACTORSELECT IFCDATETIME IFCLABEL" },
+		{ "IFCCONSTRAINTENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCCONSTRUCTIONEQUIPMENTRESOURCE", SCHEMA_ENTITY, 0, "IFCCONSTRUCTIONRESOURCE", "IFCCONSTRUCTIONEQUIPMENTRESOURCETYPEENUM" },
+		{ "IFCCONSTRUCTIONEQUIPMENTRESOURCETYPE", SCHEMA_ENTITY, 0, "IFCCONSTRUCTIONRESOURCETYPE", "IFCCONSTRUCTIONEQUIPMENTRESOURCETYPEENUM" },
+		{ "IFCCONSTRUCTIONEQUIPMENTRESOURCETYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCCONSTRUCTIONMATERIALRESOURCE", SCHEMA_ENTITY, 0, "IFCCONSTRUCTIONRESOURCE", "IFCCONSTRUCTIONMATERIALRESOURCETYPEENUM" },
+		{ "IFCCONSTRUCTIONMATERIALRESOURCETYPE", SCHEMA_ENTITY, 0, "IFCCONSTRUCTIONRESOURCETYPE", "IFCCONSTRUCTIONMATERIALRESOURCETYPEENUM" },
+		{ "IFCCONSTRUCTIONMATERIALRESOURCETYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCCONSTRUCTIONPRODUCTRESOURCE", SCHEMA_ENTITY, 0, "IFCCONSTRUCTIONRESOURCE", "IFCCONSTRUCTIONPRODUCTRESOURCETYPEENUM" },
+		{ "IFCCONSTRUCTIONPRODUCTRESOURCETYPE", SCHEMA_ENTITY, 0, "IFCCONSTRUCTIONRESOURCETYPE", "IFCCONSTRUCTIONPRODUCTRESOURCETYPEENUM" },
+		{ "IFCCONSTRUCTIONPRODUCTRESOURCETYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCCONSTRUCTIONRESOURCE", SCHEMA_ENTITY, 0, "IFCRESOURCE", "IFCRESOURCETIME IFCAPPLIEDVALUE* IFCPHYSICALQUANTITY" },
+		{ "IFCCONSTRUCTIONRESOURCETYPE", SCHEMA_ENTITY, 0, "IFCTYPERESOURCE", "IFCAPPLIEDVALUE* IFCPHYSICALQUANTITY" },
+		{ "IFCCONTEXT", SCHEMA_ENTITY, 0, "IFCOBJECTDEFINITION", "IFCLABEL IFCLABEL IFCLABEL IFCREPRESENTATIONCONTEXT* IFCUNITASSIGNMENT" },
+		{ "IFCCONTEXTDEPENDENTMEASURE", SCHEMA_NUMBER, 0, "IFCMEASUREVALUE", "" },
+		{ "IFCCONTEXTDEPENDENTUNIT", SCHEMA_ENTITY, 0, "IFCRESOURCEOBJECTSELECT IFCNAMEDUNIT", "IFCLABEL" },
+		{ "IFCCONTROL", SCHEMA_ENTITY, 0, "IFCOBJECT", "IFCIDENTIFIER" },
+		{ "IFCCONTROLLER", SCHEMA_ENTITY, 0, "IFCDISTRIBUTIONCONTROLELEMENT", "IFCCONTROLLERTYPEENUM" },
+		{ "IFCCONTROLLERTYPE", SCHEMA_ENTITY, 0, "IFCDISTRIBUTIONCONTROLELEMENTTYPE", "IFCCONTROLLERTYPEENUM" },
+		{ "IFCCONTROLLERTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCCONVERSIONBASEDUNIT", SCHEMA_ENTITY, 0, "IFCRESOURCEOBJECTSELECT IFCNAMEDUNIT", "IFCLABEL IFCMEASUREWITHUNIT" },
+		{ "IFCCONVERSIONBASEDUNITWITHOFFSET", SCHEMA_ENTITY, 0, "IFCCONVERSIONBASEDUNIT", "IFCREAL" },
+		{ "IFCCONVEYORSEGMENT", SCHEMA_ENTITY, 0, "IFCFLOWSEGMENT", "IFCCONVEYORSEGMENTTYPEENUM" },
+		{ "IFCCONVEYORSEGMENTTYPE", SCHEMA_ENTITY, 0, "IFCFLOWSEGMENTTYPE", "IFCCONVEYORSEGMENTTYPEENUM" },
+		{ "IFCCONVEYORSEGMENTTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCCOOLEDBEAM", SCHEMA_ENTITY, 0, "IFCENERGYCONVERSIONDEVICE", "IFCCOOLEDBEAMTYPEENUM" },
+		{ "IFCCOOLEDBEAMTYPE", SCHEMA_ENTITY, 0, "IFCENERGYCONVERSIONDEVICETYPE", "IFCCOOLEDBEAMTYPEENUM" },
+		{ "IFCCOOLEDBEAMTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCCOOLINGTOWER", SCHEMA_ENTITY, 0, "IFCENERGYCONVERSIONDEVICE", "IFCCOOLINGTOWERTYPEENUM" },
+		{ "IFCCOOLINGTOWERTYPE", SCHEMA_ENTITY, 0, "IFCENERGYCONVERSIONDEVICETYPE", "IFCCOOLINGTOWERTYPEENUM" },
+		{ "IFCCOOLINGTOWERTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCCOORDINATEOPERATION", SCHEMA_ENTITY, 0, "", "IFCCOORDINATEREFERENCESYSTEMSELECT IFCCOORDINATEREFERENCESYSTEM" },
+		{ "IFCCOORDINATEREFERENCESYSTEM", SCHEMA_ENTITY, 0, "IFCCOORDINATEREFERENCESYSTEMSELECT", "IFCLABEL IFCTEXT IFCIDENTIFIER" },
+		{ "IFCCOORDINATEREFERENCESYSTEMSELECT", SCHEMA_SELECT, 0, "", "" },
+		{ "IFCCOSINESPIRAL", SCHEMA_ENTITY, 0, "IFCSPIRAL", "IFCLENGTHMEASURE IFCLENGTHMEASURE" },
+		{ "IFCCOSTITEM", SCHEMA_ENTITY, 0, "IFCCONTROL", "IFCCOSTITEMTYPEENUM IFCCOSTVALUE* IFCPHYSICALQUANTITY*" },
+		{ "IFCCOSTITEMTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCCOSTSCHEDULE", SCHEMA_ENTITY, 0, "IFCCONTROL", "IFCCOSTSCHEDULETYPEENUM IFCLABEL IFCDATETIME IFCDATETIME" },
+		{ "IFCCOSTSCHEDULETYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCCOSTVALUE", SCHEMA_ENTITY, 0, "IFCAPPLIEDVALUE", "" },
+		{ "IFCCOUNTMEASURE", SCHEMA_NUMBER, 0, "IFCMEASUREVALUE", "" },
+		{ "IFCCOURSE", SCHEMA_ENTITY, 0, "IFCBUILTELEMENT", "IFCCOURSETYPEENUM" },
+		{ "IFCCOURSETYPE", SCHEMA_ENTITY, 0, "IFCBUILTELEMENTTYPE", "IFCCOURSETYPEENUM" },
+		{ "IFCCOURSETYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCCOVERING", SCHEMA_ENTITY, 0, "IFCBUILTELEMENT", "IFCCOVERINGTYPEENUM" },
+		{ "IFCCOVERINGTYPE", SCHEMA_ENTITY, 0, "IFCBUILTELEMENTTYPE", "IFCCOVERINGTYPEENUM" },
+		{ "IFCCOVERINGTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCCREWRESOURCE", SCHEMA_ENTITY, 0, "IFCCONSTRUCTIONRESOURCE", "IFCCREWRESOURCETYPEENUM" },
+		{ "IFCCREWRESOURCETYPE", SCHEMA_ENTITY, 0, "IFCCONSTRUCTIONRESOURCETYPE", "IFCCREWRESOURCETYPEENUM" },
+		{ "IFCCREWRESOURCETYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCCSGPRIMITIVE3D", SCHEMA_ENTITY, 0, "IFCBOOLEANOPERAND IFCCSGSELECT IFCGEOMETRICREPRESENTATIONITEM", "IFCAXIS2PLACEMENT3D" },
+		{ "IFCCSGSELECT", SCHEMA_SELECT, 0, "", "" },
+		{ "IFCCSGSOLID", SCHEMA_ENTITY, 0, "IFCSOLIDMODEL", "IFCCSGSELECT" },
+		{ "IFCCSHAPEPROFILEDEF", SCHEMA_ENTITY, 0, "IFCPARAMETERIZEDPROFILEDEF", "IFCPOSITIVELENGTHMEASURE IFCPOSITIVELENGTHMEASURE IFCPOSITIVELENGTHMEASURE IFCPOSITIVELENGTHMEASURE IFCNONNEGATIVELENGTHMEASURE" },
+		{ "IFCCURRENCYRELATIONSHIP", SCHEMA_ENTITY, 0, "IFCRESOURCELEVELRELATIONSHIP", "IFCMONETARYUNIT IFCMONETARYUNIT IFCPOSITIVERATIOMEASURE IFCDATETIME IFCLIBRARYINFORMATION" },
+		{ "IFCCURTAINWALL", SCHEMA_ENTITY, 0, "IFCBUILTELEMENT", "IFCCURTAINWALLTYPEENUM" },
+		{ "IFCCURTAINWALLTYPE", SCHEMA_ENTITY, 0, "IFCBUILTELEMENTTYPE", "IFCCURTAINWALLTYPEENUM" },
+		{ "IFCCURTAINWALLTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCCURVATUREMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCCURVE", SCHEMA_ENTITY, 0, "IFCGEOMETRICSETSELECT IFCGEOMETRICREPRESENTATIONITEM", "" },
+		{ "IFCCURVEBOUNDEDPLANE", SCHEMA_ENTITY, 0, "IFCBOUNDEDSURFACE", "IFCPLANE IFCCURVE IFCCURVE*" },
+		{ "IFCCURVEBOUNDEDSURFACE", SCHEMA_ENTITY, 0, "IFCBOUNDEDSURFACE", "IFCSURFACE IFCBOUNDARYCURVE* IFCBOOLEAN" },
+		{ "IFCCURVEFONTORSCALEDCURVEFONTSELECT", SCHEMA_SELECT, 0, "", "" },
+		{ "IFCCURVEINTERPOLATIONENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCCURVEMEASURESELECT", SCHEMA_SELECT, 0, "", "" },
+		{ "IFCCURVEONSURFACE", SCHEMA_SELECT, 0, "", "" },
+		{ "IFCCURVEOREDGECURVE", SCHEMA_SELECT, 0, "", "" },
+		{ "IFCCURVESEGMENT", SCHEMA_ENTITY, 0, "IFCSEGMENT", "IFCPLACEMENT IFCCURVEMEASURESELECT IFCCURVEMEASURESELECT IFCCURVE" },
+		{ "IFCCURVESTYLE", SCHEMA_ENTITY, 0, "IFCPRESENTATIONSTYLE", "IFCCURVEFONTORSCALEDCURVEFONTSELECT IFCSIZESELECT IFCCOLOUR IFCBOOLEAN" },
+		{ "IFCCURVESTYLEFONT", SCHEMA_ENTITY, 0, "IFCCURVESTYLEFONTSELECT IFCPRESENTATIONITEM", "IFCLABEL IFCCURVESTYLEFONTPATTERN*" },
+		{ "IFCCURVESTYLEFONTANDSCALING", SCHEMA_ENTITY, 0, "IFCCURVEFONTORSCALEDCURVEFONTSELECT IFCPRESENTATIONITEM", "IFCLABEL IFCCURVESTYLEFONTSELECT IFCPOSITIVERATIOMEASURE" },
+		{ "IFCCURVESTYLEFONTPATTERN", SCHEMA_ENTITY, 0, "IFCPRESENTATIONITEM", "IFCLENGTHMEASURE IFCPOSITIVELENGTHMEASURE" },
+		{ "IFCCURVESTYLEFONTSELECT", SCHEMA_SELECT, 0, "IFCCURVEFONTORSCALEDCURVEFONTSELECT", "" },
+		{ "IFCCYLINDRICALSURFACE", SCHEMA_ENTITY, 0, "IFCELEMENTARYSURFACE", "IFCPOSITIVELENGTHMEASURE" },
+		{ "IFCDAMPER", SCHEMA_ENTITY, 0, "IFCFLOWCONTROLLER", "IFCDAMPERTYPEENUM" },
+		{ "IFCDAMPERTYPE", SCHEMA_ENTITY, 0, "IFCFLOWCONTROLLERTYPE", "IFCDAMPERTYPEENUM" },
+		{ "IFCDAMPERTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCDATAORIGINENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCDATE", SCHEMA_STRING, 0, "IFCSIMPLEVALUE", "" },
+		{ "IFCDATETIME", SCHEMA_STRING, 0, "IFCSIMPLEVALUE", "" },
+		{ "IFCDAYINMONTHNUMBER", SCHEMA_NUMBER, 0, "", "" },
+		{ "IFCDAYINWEEKNUMBER", SCHEMA_NUMBER, 0, "", "" },
+		{ "IFCDEEPFOUNDATION", SCHEMA_ENTITY, 0, "IFCBUILTELEMENT", "" },
+		{ "IFCDEEPFOUNDATIONTYPE", SCHEMA_ENTITY, 0, "IFCBUILTELEMENTTYPE", "" },
+		{ "IFCDEFINITIONSELECT", SCHEMA_SELECT, 0, "", "" },
+		{ "IFCDERIVEDMEASUREVALUE", SCHEMA_SELECT, 0, "IFCVALUE", "" },
+		{ "IFCDERIVEDPROFILEDEF", SCHEMA_ENTITY, 0, "IFCPROFILEDEF", "IFCPROFILEDEF IFCCARTESIANTRANSFORMATIONOPERATOR2D IFCLABEL" },
+		{ "IFCDERIVEDUNIT", SCHEMA_ENTITY, 0, "IFCUNIT", "IFCDERIVEDUNITELEMENT* IFCDERIVEDUNITENUM IFCLABEL IFCLABEL" },
+		{ "IFCDERIVEDUNITELEMENT", SCHEMA_ENTITY, 0, "", "IFCNAMEDUNIT INTEGER" },
+		{ "IFCDERIVEDUNITENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCDESCRIPTIVEMEASURE", SCHEMA_STRING, 0, "IFCMEASUREVALUE IFCSIZESELECT", "" },
+		{ "IFCDIMENSIONALEXPONENTS", SCHEMA_ENTITY, 0, "", "INTEGER INTEGER INTEGER INTEGER INTEGER INTEGER INTEGER" },
+		{ "IFCDIMENSIONCOUNT", SCHEMA_NUMBER, 0, "", "" },
+		{ "IFCDIRECTION", SCHEMA_ENTITY, 0, "IFCGRIDPLACEMENTDIRECTIONSELECT IFCVECTORORDIRECTION IFCGEOMETRICREPRESENTATIONITEM", "IFCREAL*" },
+		{ "IFCDIRECTIONSENSEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCDIRECTRIXCURVESWEPTAREASOLID", SCHEMA_ENTITY, 0, "IFCSWEPTAREASOLID", "IFCCURVE IFCCURVEMEASURESELECT IFCCURVEMEASURESELECT" },
+		{ "IFCDIRECTRIXDERIVEDREFERENCESWEPTAREASOLID", SCHEMA_ENTITY, 0, "IFCFIXEDREFERENCESWEPTAREASOLID", "" },
+		{ "IFCDISCRETEACCESSORY", SCHEMA_ENTITY, 0, "IFCELEMENTCOMPONENT", "IFCDISCRETEACCESSORYTYPEENUM" },
+		{ "IFCDISCRETEACCESSORYTYPE", SCHEMA_ENTITY, 0, "IFCELEMENTCOMPONENTTYPE", "IFCDISCRETEACCESSORYTYPEENUM" },
+		{ "IFCDISCRETEACCESSORYTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCDISTRIBUTIONBOARD", SCHEMA_ENTITY, 0, "IFCFLOWCONTROLLER", "IFCDISTRIBUTIONBOARDTYPEENUM" },
+		{ "IFCDISTRIBUTIONBOARDTYPE", SCHEMA_ENTITY, 0, "IFCFLOWCONTROLLERTYPE", "IFCDISTRIBUTIONBOARDTYPEENUM" },
+		{ "IFCDISTRIBUTIONBOARDTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCDISTRIBUTIONCHAMBERELEMENT", SCHEMA_ENTITY, 0, "IFCDISTRIBUTIONFLOWELEMENT", "IFCDISTRIBUTIONCHAMBERELEMENTTYPEENUM" },
+		{ "IFCDISTRIBUTIONCHAMBERELEMENTTYPE", SCHEMA_ENTITY, 0, "IFCDISTRIBUTIONFLOWELEMENTTYPE", "IFCDISTRIBUTIONCHAMBERELEMENTTYPEENUM" },
+		{ "IFCDISTRIBUTIONCHAMBERELEMENTTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCDISTRIBUTIONCIRCUIT", SCHEMA_ENTITY, 0, "IFCDISTRIBUTIONSYSTEM", "" },
+		{ "IFCDISTRIBUTIONCONTROLELEMENT", SCHEMA_ENTITY, 0, "IFCDISTRIBUTIONELEMENT", "" },
+		{ "IFCDISTRIBUTIONCONTROLELEMENTTYPE", SCHEMA_ENTITY, 0, "IFCDISTRIBUTIONELEMENTTYPE", "" },
+		{ "IFCDISTRIBUTIONELEMENT", SCHEMA_ENTITY, 0, "IFCELEMENT", "" },
+		{ "IFCDISTRIBUTIONELEMENTTYPE", SCHEMA_ENTITY, 0, "IFCELEMENTTYPE", "" },
+		{ "IFCDISTRIBUTIONFLOWELEMENT", SCHEMA_ENTITY, 0, "IFCDISTRIBUTIONELEMENT", "" },
+		{ "IFCDISTRIBUTIONFLOWELEMENTTYPE", SCHEMA_ENTITY, 0, "IFCDISTRIBUTIONELEMENTTYPE", "" },
+		{ "IFCDISTRIBUTIONPORT", SCHEMA_ENTITY, 0, "IFCPORT", "IFCFLOWDIRECTIONENUM IFCDISTRIBUTIONPORTTYPEENUM IFCDISTRIBUTIONSYSTEMENUM" },
+		{ "IFCDISTRIBUTIONPORTTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCDISTRIBUTIONSYSTEM", SCHEMA_ENTITY, 0, "IFCSYSTEM", "IFCLABEL IFCDISTRIBUTIONSYSTEMENUM" },
+		{ "IFCDISTRIBUTIONSYSTEMENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCDOCUMENTCONFIDENTIALITYENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCDOCUMENTINFORMATION", SCHEMA_ENTITY, 0, "IFCDOCUMENTSELECT IFCEXTERNALINFORMATION", "IFCIDENTIFIER IFCLABEL IFCTEXT IFCURIREFERENCE IFCTEXT IFCTEXT IFCTEXT IFCLABEL IFCACTORSELECT IFCACTORSELECT* IFCDATETIME IFCDATETIME IFCIDENTIFIER IFCDATE IFCDATE IFCDOCUMENTCONFIDENTIALITYENUM IFCDOCUMENTSTATUSENUM" },
+		{ "IFCDOCUMENTINFORMATIONRELATIONSHIP", SCHEMA_ENTITY, 0, "IFCRESOURCELEVELRELATIONSHIP", "IFCDOCUMENTINFORMATION IFCDOCUMENTINFORMATION* IFCLABEL" },
+		{ "IFCDOCUMENTREFERENCE", SCHEMA_ENTITY, 0, "IFCDOCUMENTSELECT IFCEXTERNALREFERENCE", "IFCTEXT IFCDOCUMENTINFORMATION" },
+		{ "IFCDOCUMENTSELECT", SCHEMA_SELECT, 0, "", "" },
+		{ "IFCDOCUMENTSTATUSENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCDOOR", SCHEMA_ENTITY, 0, "IFCBUILTELEMENT", "IFCPOSITIVELENGTHMEASURE IFCPOSITIVELENGTHMEASURE IFCDOORTYPEENUM IFCDOORTYPEOPERATIONENUM IFCLABEL" },
+		{ "IFCDOORLININGPROPERTIES", SCHEMA_ENTITY, 0, "IFCPREDEFINEDPROPERTYSET", "IFCPOSITIVELENGTHMEASURE IFCNONNEGATIVELENGTHMEASURE IFCPOSITIVELENGTHMEASURE IFCNONNEGATIVELENGTHMEASURE IFCNONNEGATIVELENGTHMEASURE IFCLENGTHMEASURE IFCLENGTHMEASURE IFCLENGTHMEASURE IFCPOSITIVELENGTHMEASURE IFCPOSITIVELENGTHMEASURE IFCSHAPEASPECT IFCLENGTHMEASURE IFCLENGTHMEASURE" },
+		{ "IFCDOORPANELOPERATIONENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCDOORPANELPOSITIONENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCDOORPANELPROPERTIES", SCHEMA_ENTITY, 0, "IFCPREDEFINEDPROPERTYSET", "IFCPOSITIVELENGTHMEASURE IFCDOORPANELOPERATIONENUM IFCNORMALISEDRATIOMEASURE IFCDOORPANELPOSITIONENUM IFCSHAPEASPECT" },
+		{ "IFCDOORSTYLE", SCHEMA_ENTITY, 0, "IFCTYPEPRODUCT", "IFCDOORSTYLEOPERATIONENUM IFCDOORSTYLECONSTRUCTIONENUM IFCBOOLEAN IFCBOOLEAN" },
+		{ "IFCDOORSTYLECONSTRUCTIONENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCDOORSTYLEOPERATIONENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCDOORTYPE", SCHEMA_ENTITY, 0, "IFCBUILTELEMENTTYPE", "IFCDOORTYPEENUM IFCDOORTYPEOPERATIONENUM IFCBOOLEAN IFCLABEL" },
+		{ "IFCDOORTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCDOORTYPEOPERATIONENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCDOSEEQUIVALENTMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCDRAUGHTINGPREDEFINEDCOLOUR", SCHEMA_ENTITY, 0, "IFCPREDEFINEDCOLOUR", "" },
+		{ "IFCDRAUGHTINGPREDEFINEDCURVEFONT", SCHEMA_ENTITY, 0, "IFCPREDEFINEDCURVEFONT", "" },
+		{ "IFCDUCTFITTING", SCHEMA_ENTITY, 0, "IFCFLOWFITTING", "IFCDUCTFITTINGTYPEENUM" },
+		{ "IFCDUCTFITTINGTYPE", SCHEMA_ENTITY, 0, "IFCFLOWFITTINGTYPE", "IFCDUCTFITTINGTYPEENUM" },
+		{ "IFCDUCTFITTINGTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCDUCTSEGMENT", SCHEMA_ENTITY, 0, "IFCFLOWSEGMENT", "IFCDUCTSEGMENTTYPEENUM" },
+		{ "IFCDUCTSEGMENTTYPE", SCHEMA_ENTITY, 0, "IFCFLOWSEGMENTTYPE", "IFCDUCTSEGMENTTYPEENUM" },
+		{ "IFCDUCTSEGMENTTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCDUCTSILENCER", SCHEMA_ENTITY, 0, "IFCFLOWTREATMENTDEVICE", "IFCDUCTSILENCERTYPEENUM" },
+		{ "IFCDUCTSILENCERTYPE", SCHEMA_ENTITY, 0, "IFCFLOWTREATMENTDEVICETYPE", "IFCDUCTSILENCERTYPEENUM" },
+		{ "IFCDUCTSILENCERTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCDURATION", SCHEMA_STRING, 0, "IFCSIMPLEVALUE IFCTIMEORRATIOSELECT", "" },
+		{ "IFCDYNAMICVISCOSITYMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCEARTHWORKSCUT", SCHEMA_ENTITY, 0, "IFCFEATUREELEMENTSUBTRACTION", "IFCEARTHWORKSCUTTYPEENUM" },
+		{ "IFCEARTHWORKSCUTTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCEARTHWORKSELEMENT", SCHEMA_ENTITY, 0, "IFCBUILTELEMENT", "" },
+		{ "IFCEARTHWORKSFILL", SCHEMA_ENTITY, 0, "IFCEARTHWORKSELEMENT", "IFCEARTHWORKSFILLTYPEENUM" },
+		{ "IFCEARTHWORKSFILLTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCEDGE", SCHEMA_ENTITY, 0, "IFCTOPOLOGICALREPRESENTATIONITEM", "IFCVERTEX IFCVERTEX" },
+		{ "IFCEDGECURVE", SCHEMA_ENTITY, 0, "IFCCURVEOREDGECURVE IFCEDGE", "IFCCURVE IFCBOOLEAN" },
+		{ "IFCEDGELOOP", SCHEMA_ENTITY, 0, "IFCLOOP", "IFCORIENTEDEDGE*" },
+		{ "IFCELECTRICAPPLIANCE", SCHEMA_ENTITY, 0, "IFCFLOWTERMINAL", "IFCELECTRICAPPLIANCETYPEENUM" },
+		{ "IFCELECTRICAPPLIANCETYPE", SCHEMA_ENTITY, 0, "IFCFLOWTERMINALTYPE", "IFCELECTRICAPPLIANCETYPEENUM" },
+		{ "IFCELECTRICAPPLIANCETYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCELECTRICCAPACITANCEMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCELECTRICCHARGEMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCELECTRICCONDUCTANCEMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCELECTRICCURRENTMEASURE", SCHEMA_NUMBER, 0, "IFCMEASUREVALUE", "" },
+		{ "IFCELECTRICDISTRIBUTIONBOARD", SCHEMA_ENTITY, 0, "IFCFLOWCONTROLLER", "IFCELECTRICDISTRIBUTIONBOARDTYPEENUM" },
+		{ "IFCELECTRICDISTRIBUTIONBOARDTYPE", SCHEMA_ENTITY, 0, "IFCFLOWCONTROLLERTYPE", "IFCELECTRICDISTRIBUTIONBOARDTYPEENUM" },
+		{ "IFCELECTRICDISTRIBUTIONBOARDTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCELECTRICFLOWSTORAGEDEVICE", SCHEMA_ENTITY, 0, "IFCFLOWSTORAGEDEVICE", "IFCELECTRICFLOWSTORAGEDEVICETYPEENUM" },
+		{ "IFCELECTRICFLOWSTORAGEDEVICETYPE", SCHEMA_ENTITY, 0, "IFCFLOWSTORAGEDEVICETYPE", "IFCELECTRICFLOWSTORAGEDEVICETYPEENUM" },
+		{ "IFCELECTRICFLOWSTORAGEDEVICETYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCELECTRICFLOWTREATMENTDEVICE", SCHEMA_ENTITY, 0, "IFCFLOWTREATMENTDEVICE", "IFCELECTRICFLOWTREATMENTDEVICETYPEENUM" },
+		{ "IFCELECTRICFLOWTREATMENTDEVICETYPE", SCHEMA_ENTITY, 0, "IFCFLOWTREATMENTDEVICETYPE", "IFCELECTRICFLOWTREATMENTDEVICETYPEENUM" },
+		{ "IFCELECTRICFLOWTREATMENTDEVICETYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCELECTRICGENERATOR", SCHEMA_ENTITY, 0, "IFCENERGYCONVERSIONDEVICE", "IFCELECTRICGENERATORTYPEENUM" },
+		{ "IFCELECTRICGENERATORTYPE", SCHEMA_ENTITY, 0, "IFCENERGYCONVERSIONDEVICETYPE", "IFCELECTRICGENERATORTYPEENUM" },
+		{ "IFCELECTRICGENERATORTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCELECTRICMOTOR", SCHEMA_ENTITY, 0, "IFCENERGYCONVERSIONDEVICE", "IFCELECTRICMOTORTYPEENUM" },
+		{ "IFCELECTRICMOTORTYPE", SCHEMA_ENTITY, 0, "IFCENERGYCONVERSIONDEVICETYPE", "IFCELECTRICMOTORTYPEENUM" },
+		{ "IFCELECTRICMOTORTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCELECTRICRESISTANCEMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCELECTRICTIMECONTROL", SCHEMA_ENTITY, 0, "IFCFLOWCONTROLLER", "IFCELECTRICTIMECONTROLTYPEENUM" },
+		{ "IFCELECTRICTIMECONTROLTYPE", SCHEMA_ENTITY, 0, "IFCFLOWCONTROLLERTYPE", "IFCELECTRICTIMECONTROLTYPEENUM" },
+		{ "IFCELECTRICTIMECONTROLTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCELECTRICVOLTAGEMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCELEMENT", SCHEMA_ENTITY, 0, "IFCINTERFERENCESELECT IFCSTRUCTURALACTIVITYASSIGNMENTSELECT IFCPRODUCT", "IFCIDENTIFIER" },
+		{ "IFCELEMENTARYSURFACE", SCHEMA_ENTITY, 0, "IFCSURFACE", "IFCAXIS2PLACEMENT3D" },
+		{ "IFCELEMENTASSEMBLY", SCHEMA_ENTITY, 0, "IFCELEMENT", "IFCASSEMBLYPLACEENUM IFCELEMENTASSEMBLYTYPEENUM" },
+		{ "IFCELEMENTASSEMBLYTYPE", SCHEMA_ENTITY, 0, "IFCELEMENTTYPE", "IFCELEMENTASSEMBLYTYPEENUM" },
+		{ "IFCELEMENTASSEMBLYTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCELEMENTCOMPONENT", SCHEMA_ENTITY, 0, "IFCELEMENT", "" },
+		{ "IFCELEMENTCOMPONENTTYPE", SCHEMA_ENTITY, 0, "IFCELEMENTTYPE", "" },
+		{ "IFCELEMENTCOMPOSITIONENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCELEMENTQUANTITY", SCHEMA_ENTITY, 0, "IFCQUANTITYSET", "IFCLABEL IFCPHYSICALQUANTITY*" },
+		{ "IFCELEMENTTYPE", SCHEMA_ENTITY, 0, "IFCTYPEPRODUCT", "IFCLABEL" },
+		{ "IFCELLIPSE", SCHEMA_ENTITY, 0, "IFCCONIC", "IFCPOSITIVELENGTHMEASURE IFCPOSITIVELENGTHMEASURE" },
+		{ "IFCELLIPSEPROFILEDEF", SCHEMA_ENTITY, 0, "IFCPARAMETERIZEDPROFILEDEF", "IFCPOSITIVELENGTHMEASURE IFCPOSITIVELENGTHMEASURE" },
+		{ "IFCENERGYCONVERSIONDEVICE", SCHEMA_ENTITY, 0, "IFCDISTRIBUTIONFLOWELEMENT", "" },
+		{ "IFCENERGYCONVERSIONDEVICETYPE", SCHEMA_ENTITY, 0, "IFCDISTRIBUTIONFLOWELEMENTTYPE", "" },
+		{ "IFCENERGYMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCENGINE", SCHEMA_ENTITY, 0, "IFCENERGYCONVERSIONDEVICE", "IFCENGINETYPEENUM" },
+		{ "IFCENGINETYPE", SCHEMA_ENTITY, 0, "IFCENERGYCONVERSIONDEVICETYPE", "IFCENGINETYPEENUM" },
+		{ "IFCENGINETYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCEVAPORATIVECOOLER", SCHEMA_ENTITY, 0, "IFCENERGYCONVERSIONDEVICE", "IFCEVAPORATIVECOOLERTYPEENUM" },
+		{ "IFCEVAPORATIVECOOLERTYPE", SCHEMA_ENTITY, 0, "IFCENERGYCONVERSIONDEVICETYPE", "IFCEVAPORATIVECOOLERTYPEENUM" },
+		{ "IFCEVAPORATIVECOOLERTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCEVAPORATOR", SCHEMA_ENTITY, 0, "IFCENERGYCONVERSIONDEVICE", "IFCEVAPORATORTYPEENUM" },
+		{ "IFCEVAPORATORTYPE", SCHEMA_ENTITY, 0, "IFCENERGYCONVERSIONDEVICETYPE", "IFCEVAPORATORTYPEENUM" },
+		{ "IFCEVAPORATORTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCEVENT", SCHEMA_ENTITY, 0, "IFCPROCESS", "IFCEVENTTYPEENUM IFCEVENTTRIGGERTYPEENUM IFCLABEL IFCEVENTTIME" },
+		{ "IFCEVENTTIME", SCHEMA_ENTITY, 0, "IFCSCHEDULINGTIME", "IFCDATETIME IFCDATETIME IFCDATETIME IFCDATETIME" },
+		{ "IFCEVENTTRIGGERTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCEVENTTYPE", SCHEMA_ENTITY, 0, "IFCTYPEPROCESS", "IFCEVENTTYPEENUM IFCEVENTTRIGGERTYPEENUM IFCLABEL" },
+		{ "IFCEVENTTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCEXTENDEDPROPERTIES", SCHEMA_ENTITY, 0, "IFCPROPERTYABSTRACTION", "IFCIDENTIFIER IFCTEXT IFCPROPERTY*" },
+		{ "IFCEXTERNALINFORMATION", SCHEMA_ENTITY, 0, "IFCRESOURCEOBJECTSELECT", "" },
+		{ "IFCEXTERNALLYDEFINEDHATCHSTYLE", SCHEMA_ENTITY, 0, "IFCFILLSTYLESELECT IFCEXTERNALREFERENCE", "" },
+		{ "IFCEXTERNALLYDEFINEDSURFACESTYLE", SCHEMA_ENTITY, 0, "IFCSURFACESTYLEELEMENTSELECT IFCEXTERNALREFERENCE", "" },
+		{ "IFCEXTERNALLYDEFINEDTEXTFONT", SCHEMA_ENTITY, 0, "IFCTEXTFONTSELECT IFCEXTERNALREFERENCE", "" },
+		{ "IFCEXTERNALREFERENCE", SCHEMA_ENTITY, 0, "IFCLIGHTDISTRIBUTIONDATASOURCESELECT IFCOBJECTREFERENCESELECT IFCRESOURCEOBJECTSELECT", "IFCURIREFERENCE IFCIDENTIFIER IFCLABEL" },
+		{ "IFCEXTERNALREFERENCERELATIONSHIP", SCHEMA_ENTITY, 0, "IFCRESOURCELEVELRELATIONSHIP", "IFCEXTERNALREFERENCE IFCRESOURCEOBJECTSELECT*" },
+		{ "IFCEXTERNALSPATIALELEMENT", SCHEMA_ENTITY, 0, "IFCSPACEBOUNDARYSELECT IFCEXTERNALSPATIALSTRUCTUREELEMENT", "IFCEXTERNALSPATIALELEMENTTYPEENUM" },
+		{ "IFCEXTERNALSPATIALELEMENTTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCEXTERNALSPATIALSTRUCTUREELEMENT", SCHEMA_ENTITY, 0, "IFCSPATIALELEMENT", "" },
+		{ "IFCEXTRUDEDAREASOLID", SCHEMA_ENTITY, 0, "IFCSWEPTAREASOLID", "IFCDIRECTION IFCPOSITIVELENGTHMEASURE" },
+		{ "IFCEXTRUDEDAREASOLIDTAPERED", SCHEMA_ENTITY, 0, "IFCEXTRUDEDAREASOLID", "IFCPROFILEDEF" },
+		{ "IFCFACE", SCHEMA_ENTITY, 0, "IFCTOPOLOGICALREPRESENTATIONITEM", "IFCFACEBOUND*" },
+		{ "IFCFACEBASEDSURFACEMODEL", SCHEMA_ENTITY, 0, "IFCSURFACEORFACESURFACE IFCGEOMETRICREPRESENTATIONITEM", "IFCCONNECTEDFACESET*" },
+		{ "IFCFACEBOUND", SCHEMA_ENTITY, 0, "IFCTOPOLOGICALREPRESENTATIONITEM", "IFCLOOP IFCBOOLEAN" },
+		{ "IFCFACEOUTERBOUND", SCHEMA_ENTITY, 0, "IFCFACEBOUND", "" },
+		{ "IFCFACESURFACE", SCHEMA_ENTITY, 0, "IFCSURFACEORFACESURFACE IFCFACE", "IFCSURFACE IFCBOOLEAN" },
+		{ "IFCFACETEDBREP", SCHEMA_ENTITY, 0, "IFCMANIFOLDSOLIDBREP", "" },
+		{ "IFCFACETEDBREPWITHVOIDS", SCHEMA_ENTITY, 0, "IFCFACETEDBREP", "IFCCLOSEDSHELL*" },
+		{ "IFCFACILITY", SCHEMA_ENTITY, 0, "IFCSPATIALSTRUCTUREELEMENT", "" },
+		{ "IFCFACILITYPART", SCHEMA_ENTITY, 0, "IFCSPATIALSTRUCTUREELEMENT", "IFCFACILITYUSAGEENUM" },
+		{ "IFCFACILITYPARTCOMMON", SCHEMA_ENTITY, 0, "IFCFACILITYPART", "IFCFACILITYPARTCOMMONTYPEENUM" },
+		{ "IFCFACILITYPARTCOMMONTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCFACILITYUSAGEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCFAILURECONNECTIONCONDITION", SCHEMA_ENTITY, 0, "IFCSTRUCTURALCONNECTIONCONDITION", "IFCFORCEMEASURE IFCFORCEMEASURE IFCFORCEMEASURE IFCFORCEMEASURE IFCFORCEMEASURE IFCFORCEMEASURE" },
+		{ "IFCFAN", SCHEMA_ENTITY, 0, "IFCFLOWMOVINGDEVICE", "IFCFANTYPEENUM" },
+		{ "IFCFANTYPE", SCHEMA_ENTITY, 0, "IFCFLOWMOVINGDEVICETYPE", "IFCFANTYPEENUM" },
+		{ "IFCFANTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCFASTENER", SCHEMA_ENTITY, 0, "IFCELEMENTCOMPONENT", "IFCFASTENERTYPEENUM" },
+		{ "IFCFASTENERTYPE", SCHEMA_ENTITY, 0, "IFCELEMENTCOMPONENTTYPE", "IFCFASTENERTYPEENUM" },
+		{ "IFCFASTENERTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCFEATUREELEMENT", SCHEMA_ENTITY, 0, "IFCELEMENT", "" },
+		{ "IFCFEATUREELEMENTADDITION", SCHEMA_ENTITY, 0, "IFCFEATUREELEMENT", "" },
+		{ "IFCFEATUREELEMENTSUBTRACTION", SCHEMA_ENTITY, 0, "IFCFEATUREELEMENT", "" },
+		{ "IFCFILLAREASTYLE", SCHEMA_ENTITY, 0, "IFCPRESENTATIONSTYLE", "IFCFILLSTYLESELECT* IFCBOOLEAN" },
+		{ "IFCFILLAREASTYLEHATCHING", SCHEMA_ENTITY, 0, "IFCFILLSTYLESELECT IFCGEOMETRICREPRESENTATIONITEM", "IFCCURVESTYLE IFCHATCHLINEDISTANCESELECT IFCCARTESIANPOINT IFCCARTESIANPOINT IFCPLANEANGLEMEASURE" },
+		{ "IFCFILLAREASTYLETILES", SCHEMA_ENTITY, 0, "IFCFILLSTYLESELECT IFCGEOMETRICREPRESENTATIONITEM", "IFCVECTOR* IFCSTYLEDITEM* IFCPOSITIVERATIOMEASURE" },
+		{ "IFCFILLSTYLESELECT", SCHEMA_SELECT, 0, "", "" },
+		{ "IFCFILTER", SCHEMA_ENTITY, 0, "IFCFLOWTREATMENTDEVICE", "IFCFILTERTYPEENUM" },
+		{ "IFCFILTERTYPE", SCHEMA_ENTITY, 0, "IFCFLOWTREATMENTDEVICETYPE", "IFCFILTERTYPEENUM" },
+		{ "IFCFILTERTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCFIRESUPPRESSIONTERMINAL", SCHEMA_ENTITY, 0, "IFCFLOWTERMINAL", "IFCFIRESUPPRESSIONTERMINALTYPEENUM" },
+		{ "IFCFIRESUPPRESSIONTERMINALTYPE", SCHEMA_ENTITY, 0, "IFCFLOWTERMINALTYPE", "IFCFIRESUPPRESSIONTERMINALTYPEENUM" },
+		{ "IFCFIRESUPPRESSIONTERMINALTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCFIXEDREFERENCESWEPTAREASOLID", SCHEMA_ENTITY, 0, "IFCDIRECTRIXCURVESWEPTAREASOLID", "IFCDIRECTION" },
+		{ "IFCFLOWCONTROLLER", SCHEMA_ENTITY, 0, "IFCDISTRIBUTIONFLOWELEMENT", "" },
+		{ "IFCFLOWCONTROLLERTYPE", SCHEMA_ENTITY, 0, "IFCDISTRIBUTIONFLOWELEMENTTYPE", "" },
+		{ "IFCFLOWDIRECTIONENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCFLOWFITTING", SCHEMA_ENTITY, 0, "IFCDISTRIBUTIONFLOWELEMENT", "" },
+		{ "IFCFLOWFITTINGTYPE", SCHEMA_ENTITY, 0, "IFCDISTRIBUTIONFLOWELEMENTTYPE", "" },
+		{ "IFCFLOWINSTRUMENT", SCHEMA_ENTITY, 0, "IFCDISTRIBUTIONCONTROLELEMENT", "IFCFLOWINSTRUMENTTYPEENUM" },
+		{ "IFCFLOWINSTRUMENTTYPE", SCHEMA_ENTITY, 0, "IFCDISTRIBUTIONCONTROLELEMENTTYPE", "IFCFLOWINSTRUMENTTYPEENUM" },
+		{ "IFCFLOWINSTRUMENTTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCFLOWMETER", SCHEMA_ENTITY, 0, "IFCFLOWCONTROLLER", "IFCFLOWMETERTYPEENUM" },
+		{ "IFCFLOWMETERTYPE", SCHEMA_ENTITY, 0, "IFCFLOWCONTROLLERTYPE", "IFCFLOWMETERTYPEENUM" },
+		{ "IFCFLOWMETERTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCFLOWMOVINGDEVICE", SCHEMA_ENTITY, 0, "IFCDISTRIBUTIONFLOWELEMENT", "" },
+		{ "IFCFLOWMOVINGDEVICETYPE", SCHEMA_ENTITY, 0, "IFCDISTRIBUTIONFLOWELEMENTTYPE", "" },
+		{ "IFCFLOWSEGMENT", SCHEMA_ENTITY, 0, "IFCDISTRIBUTIONFLOWELEMENT", "" },
+		{ "IFCFLOWSEGMENTTYPE", SCHEMA_ENTITY, 0, "IFCDISTRIBUTIONFLOWELEMENTTYPE", "" },
+		{ "IFCFLOWSTORAGEDEVICE", SCHEMA_ENTITY, 0, "IFCDISTRIBUTIONFLOWELEMENT", "" },
+		{ "IFCFLOWSTORAGEDEVICETYPE", SCHEMA_ENTITY, 0, "IFCDISTRIBUTIONFLOWELEMENTTYPE", "" },
+		{ "IFCFLOWTERMINAL", SCHEMA_ENTITY, 0, "IFCDISTRIBUTIONFLOWELEMENT", "" },
+		{ "IFCFLOWTERMINALTYPE", SCHEMA_ENTITY, 0, "IFCDISTRIBUTIONFLOWELEMENTTYPE", "" },
+		{ "IFCFLOWTREATMENTDEVICE", SCHEMA_ENTITY, 0, "IFCDISTRIBUTIONFLOWELEMENT", "" },
+		{ "IFCFLOWTREATMENTDEVICETYPE", SCHEMA_ENTITY, 0, "IFCDISTRIBUTIONFLOWELEMENTTYPE", "" },
+		{ "IFCFONTSTYLE", SCHEMA_STRING, 0, "", "" },
+		{ "IFCFONTVARIANT", SCHEMA_STRING, 0, "", "" },
+		{ "IFCFONTWEIGHT", SCHEMA_STRING, 0, "", "" },
+		{ "IFCFOOTING", SCHEMA_ENTITY, 0, "IFCBUILTELEMENT", "IFCFOOTINGTYPEENUM" },
+		{ "IFCFOOTINGTYPE", SCHEMA_ENTITY, 0, "IFCBUILTELEMENTTYPE", "IFCFOOTINGTYPEENUM" },
+		{ "IFCFOOTINGTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCFORCEMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCFREQUENCYMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCFURNISHINGELEMENT", SCHEMA_ENTITY, 0, "IFCELEMENT", "" },
+		{ "IFCFURNISHINGELEMENTTYPE", SCHEMA_ENTITY, 0, "IFCELEMENTTYPE", "" },
+		{ "IFCFURNITURE", SCHEMA_ENTITY, 0, "IFCFURNISHINGELEMENT", "IFCFURNITURETYPEENUM" },
+		{ "IFCFURNITURETYPE", SCHEMA_ENTITY, 0, "IFCFURNISHINGELEMENTTYPE", "IFCASSEMBLYPLACEENUM IFCFURNITURETYPEENUM" },
+		{ "IFCFURNITURETYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCGEOGRAPHICCRS", SCHEMA_ENTITY, 0, "IFCCOORDINATEREFERENCESYSTEM", "IFCIDENTIFIER IFCNAMEDUNIT IFCNAMEDUNIT" },
+		{ "IFCGEOGRAPHICELEMENT", SCHEMA_ENTITY, 0, "IFCELEMENT", "IFCGEOGRAPHICELEMENTTYPEENUM" },
+		{ "IFCGEOGRAPHICELEMENTTYPE", SCHEMA_ENTITY, 0, "IFCELEMENTTYPE", "IFCGEOGRAPHICELEMENTTYPEENUM" },
+		{ "IFCGEOGRAPHICELEMENTTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCGEOMETRICCURVESET", SCHEMA_ENTITY, 0, "IFCGEOMETRICSET", "" },
+		{ "IFCGEOMETRICPROJECTIONENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCGEOMETRICREPRESENTATIONCONTEXT", SCHEMA_ENTITY, 0, "IFCCOORDINATEREFERENCESYSTEMSELECT IFCREPRESENTATIONCONTEXT", "IFCDIMENSIONCOUNT IFCREAL IFCAXIS2PLACEMENT IFCDIRECTION" },
+		{ "IFCGEOMETRICREPRESENTATIONITEM", SCHEMA_ENTITY, 0, "IFCREPRESENTATIONITEM", "" },
+		{ "IFCGEOMETRICREPRESENTATIONSUBCONTEXT", SCHEMA_ENTITY, 0, "IFCGEOMETRICREPRESENTATIONCONTEXT", "IFCGEOMETRICREPRESENTATIONCONTEXT IFCPOSITIVERATIOMEASURE IFCGEOMETRICPROJECTIONENUM IFCLABEL" },
+		{ "IFCGEOMETRICSET", SCHEMA_ENTITY, 0, "IFCGEOMETRICREPRESENTATIONITEM", "IFCGEOMETRICSETSELECT*" },
+		{ "IFCGEOMETRICSETSELECT", SCHEMA_SELECT, 0, "", "" },
+		{ "IFCGEOMODEL", SCHEMA_ENTITY, 0, "IFCGEOTECHNICALASSEMBLY", "" },
+		{ "IFCGEOSLICE", SCHEMA_ENTITY, 0, "IFCGEOTECHNICALASSEMBLY", "" },
+		{ "IFCGEOTECHNICALASSEMBLY", SCHEMA_ENTITY, 0, "IFCGEOTECHNICALELEMENT", "" },
+		{ "IFCGEOTECHNICALELEMENT", SCHEMA_ENTITY, 0, "IFCELEMENT", "" },
+		{ "IFCGEOTECHNICALSTRATUM", SCHEMA_ENTITY, 0, "IFCGEOTECHNICALELEMENT", "IFCGEOTECHNICALSTRATUMTYPEENUM" },
+		{ "IFCGEOTECHNICALSTRATUMTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCGLOBALLYUNIQUEID", SCHEMA_STRING, 0, "", "" },
+		{ "IFCGLOBALORLOCALENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCGRADIENTCURVE", SCHEMA_ENTITY, 0, "IFCCOMPOSITECURVE", "IFCBOUNDEDCURVE IFCPLACEMENT" },
+		{ "IFCGRID", SCHEMA_ENTITY, 0, "IFCPOSITIONINGELEMENT", "IFCGRIDAXIS* IFCGRIDAXIS* IFCGRIDAXIS* IFCGRIDTYPEENUM" },
+		{ "IFCGRIDAXIS", SCHEMA_ENTITY, 0, "", "IFCLABEL IFCCURVE IFCBOOLEAN" },
+		{ "IFCGRIDPLACEMENT", SCHEMA_ENTITY, 0, "IFCOBJECTPLACEMENT", "IFCVIRTUALGRIDINTERSECTION IFCGRIDPLACEMENTDIRECTIONSELECT" },
+		{ "IFCGRIDPLACEMENTDIRECTIONSELECT", SCHEMA_SELECT, 0, "", "" },
+		{ "IFCGRIDTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCGROUP", SCHEMA_ENTITY, 0, "IFCSPATIALREFERENCESELECT IFCOBJECT", "" },
+		{ "IFCHALFSPACESOLID", SCHEMA_ENTITY, 0, "IFCBOOLEANOPERAND IFCGEOMETRICREPRESENTATIONITEM", "IFCSURFACE IFCBOOLEAN" },
+		{ "IFCHATCHLINEDISTANCESELECT", SCHEMA_SELECT, 0, "", "" },
+		{ "IFCHEATEXCHANGER", SCHEMA_ENTITY, 0, "IFCENERGYCONVERSIONDEVICE", "IFCHEATEXCHANGERTYPEENUM" },
+		{ "IFCHEATEXCHANGERTYPE", SCHEMA_ENTITY, 0, "IFCENERGYCONVERSIONDEVICETYPE", "IFCHEATEXCHANGERTYPEENUM" },
+		{ "IFCHEATEXCHANGERTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCHEATFLUXDENSITYMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCHEATINGVALUEMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCHUMIDIFIER", SCHEMA_ENTITY, 0, "IFCENERGYCONVERSIONDEVICE", "IFCHUMIDIFIERTYPEENUM" },
+		{ "IFCHUMIDIFIERTYPE", SCHEMA_ENTITY, 0, "IFCENERGYCONVERSIONDEVICETYPE", "IFCHUMIDIFIERTYPEENUM" },
+		{ "IFCHUMIDIFIERTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCIDENTIFIER", SCHEMA_STRING, 0, "IFCSIMPLEVALUE", "" },
+		{ "IFCILLUMINANCEMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCIMAGETEXTURE", SCHEMA_ENTITY, 0, "IFCSURFACETEXTURE", "IFCURIREFERENCE" },
+		{ "IFCIMPACTPROTECTIONDEVICE", SCHEMA_ENTITY, 0, "IFCELEMENTCOMPONENT", "IFCIMPACTPROTECTIONDEVICETYPEENUM" },
+		{ "IFCIMPACTPROTECTIONDEVICETYPE", SCHEMA_ENTITY, 0, "IFCELEMENTCOMPONENTTYPE", "IFCIMPACTPROTECTIONDEVICETYPEENUM" },
+		{ "IFCIMPACTPROTECTIONDEVICETYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCINDEXEDCOLOURMAP", SCHEMA_ENTITY, 0, "IFCPRESENTATIONITEM", "IFCTESSELLATEDFACESET IFCNORMALISEDRATIOMEASURE IFCCOLOURRGBLIST IFCPOSITIVEINTEGER*" },
+		{ "IFCINDEXEDPOLYCURVE", SCHEMA_ENTITY, 0, "IFCBOUNDEDCURVE", "IFCCARTESIANPOINTLIST IFCSEGMENTINDEXSELECT* IFCBOOLEAN" },
+		{ "IFCINDEXEDPOLYGONALFACE", SCHEMA_ENTITY, 0, "IFCTESSELLATEDITEM", "IFCPOSITIVEINTEGER*" },
+		{ "IFCINDEXEDPOLYGONALFACEWITHVOIDS", SCHEMA_ENTITY, 0, "IFCINDEXEDPOLYGONALFACE", "IFCPOSITIVEINTEGER**" },
+		{ "IFCINDEXEDPOLYGONALTEXTUREMAP", SCHEMA_ENTITY, 0, "IFCINDEXEDTEXTUREMAP", "IFCTEXTURECOORDINATEINDICES*" },
+		{ "IFCINDEXEDTEXTUREMAP", SCHEMA_ENTITY, 0, "IFCTEXTURECOORDINATE", "IFCTESSELLATEDFACESET IFCTEXTUREVERTEXLIST" },
+		{ "IFCINDEXEDTRIANGLETEXTUREMAP", SCHEMA_ENTITY, 0, "IFCINDEXEDTEXTUREMAP", "IFCPOSITIVEINTEGER**" },
+		{ "IFCINDUCTANCEMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCINTEGER", SCHEMA_NUMBER, 0, "IFCSIMPLEVALUE", "" },
+		{ "IFCINTEGERCOUNTRATEMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCINTERCEPTOR", SCHEMA_ENTITY, 0, "IFCFLOWTREATMENTDEVICE", "IFCINTERCEPTORTYPEENUM" },
+		{ "IFCINTERCEPTORTYPE", SCHEMA_ENTITY, 0, "IFCFLOWTREATMENTDEVICETYPE", "IFCINTERCEPTORTYPEENUM" },
+		{ "IFCINTERCEPTORTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCINTERFERENCESELECT", SCHEMA_SELECT, 0, "", "" },
+		{ "IFCINTERNALOREXTERNALENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCINTERSECTIONCURVE", SCHEMA_ENTITY, 0, "IFCSURFACECURVE", "" },
+		{ "IFCINVENTORY", SCHEMA_ENTITY, 0, "IFCGROUP", "IFCINVENTORYTYPEENUM IFCACTORSELECT IFCPERSON* IFCDATE IFCCOSTVALUE IFCCOSTVALUE" },
+		{ "IFCINVENTORYTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCIONCONCENTRATIONMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCIRREGULARTIMESERIES", SCHEMA_ENTITY, 0, "IFCTIMESERIES", "IFCIRREGULARTIMESERIESVALUE*" },
+		{ "IFCIRREGULARTIMESERIESVALUE", SCHEMA_ENTITY, 0, "", "IFCDATETIME IFCVALUE*" },
+		{ "IFCISHAPEPROFILEDEF", SCHEMA_ENTITY, 0, "IFCPARAMETERIZEDPROFILEDEF", "IFCPOSITIVELENGTHMEASURE IFCPOSITIVELENGTHMEASURE IFCPOSITIVELENGTHMEASURE IFCPOSITIVELENGTHMEASURE IFCNONNEGATIVELENGTHMEASURE IFCNONNEGATIVELENGTHMEASURE IFCPLANEANGLEMEASURE" },
+		{ "IFCISOTHERMALMOISTURECAPACITYMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCJUNCTIONBOX", SCHEMA_ENTITY, 0, "IFCFLOWFITTING", "IFCJUNCTIONBOXTYPEENUM" },
+		{ "IFCJUNCTIONBOXTYPE", SCHEMA_ENTITY, 0, "IFCFLOWFITTINGTYPE", "IFCJUNCTIONBOXTYPEENUM" },
+		{ "IFCJUNCTIONBOXTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCKERB", SCHEMA_ENTITY, 0, "IFCBUILTELEMENT", "IFCKERBTYPEENUM" },
+		{ "IFCKERBTYPE", SCHEMA_ENTITY, 0, "IFCBUILTELEMENTTYPE", "IFCKERBTYPEENUM" },
+		{ "IFCKERBTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCKINEMATICVISCOSITYMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCKNOTTYPE", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCLABEL", SCHEMA_STRING, 0, "IFCSIMPLEVALUE", "" },
+		{ "IFCLABORRESOURCE", SCHEMA_ENTITY, 0, "IFCCONSTRUCTIONRESOURCE", "IFCLABORRESOURCETYPEENUM" },
+		{ "IFCLABORRESOURCETYPE", SCHEMA_ENTITY, 0, "IFCCONSTRUCTIONRESOURCETYPE", "IFCLABORRESOURCETYPEENUM" },
+		{ "IFCLABORRESOURCETYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCLAGTIME", SCHEMA_ENTITY, 0, "IFCSCHEDULINGTIME", "IFCTIMEORRATIOSELECT IFCTASKDURATIONENUM" },
+		{ "IFCLAMP", SCHEMA_ENTITY, 0, "IFCFLOWTERMINAL", "IFCLAMPTYPEENUM" },
+		{ "IFCLAMPTYPE", SCHEMA_ENTITY, 0, "IFCFLOWTERMINALTYPE", "IFCLAMPTYPEENUM" },
+		{ "IFCLAMPTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCLANGUAGEID", SCHEMA_STRING, 0, "IFCIDENTIFIER", "" },
+		{ "IFCLAYEREDITEM", SCHEMA_SELECT, 0, "", "" },
+		{ "IFCLAYERSETDIRECTIONENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCLENGTHMEASURE", SCHEMA_NUMBER, 0, "IFCBENDINGPARAMETERSELECT IFCCURVEMEASURESELECT IFCMEASUREVALUE IFCSIZESELECT", "" },
+		{ "IFCLIBRARYINFORMATION", SCHEMA_ENTITY, 0, "IFCLIBRARYSELECT IFCEXTERNALINFORMATION", "IFCLABEL IFCLABEL IFCACTORSELECT IFCDATETIME IFCURIREFERENCE IFCTEXT" },
+		{ "IFCLIBRARYREFERENCE", SCHEMA_ENTITY, 0, "IFCLIBRARYSELECT IFCEXTERNALREFERENCE", "IFCTEXT IFCLANGUAGEID IFCLIBRARYINFORMATION" },
+		{ "IFCLIBRARYSELECT", SCHEMA_SELECT, 0, "", "" },
+		{ "IFCLIGHTDISTRIBUTIONCURVEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCLIGHTDISTRIBUTIONDATA", SCHEMA_ENTITY, 0, "", "IFCPLANEANGLEMEASURE IFCPLANEANGLEMEASURE* IFCLUMINOUSINTENSITYDISTRIBUTIONMEASURE*" },
+		{ "IFCLIGHTDISTRIBUTIONDATASOURCESELECT", SCHEMA_SELECT, 0, "", "" },
+		{ "IFCLIGHTEMISSIONSOURCEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCLIGHTFIXTURE", SCHEMA_ENTITY, 0, "IFCFLOWTERMINAL", "IFCLIGHTFIXTURETYPEENUM" },
+		{ "IFCLIGHTFIXTURETYPE", SCHEMA_ENTITY, 0, "IFCFLOWTERMINALTYPE", "IFCLIGHTFIXTURETYPEENUM" },
+		{ "IFCLIGHTFIXTURETYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCLIGHTINTENSITYDISTRIBUTION", SCHEMA_ENTITY, 0, "IFCLIGHTDISTRIBUTIONDATASOURCESELECT", "IFCLIGHTDISTRIBUTIONCURVEENUM IFCLIGHTDISTRIBUTIONDATA*" },
+		{ "IFCLIGHTSOURCE", SCHEMA_ENTITY, 0, "IFCGEOMETRICREPRESENTATIONITEM", "IFCLABEL IFCCOLOURRGB IFCNORMALISEDRATIOMEASURE IFCNORMALISEDRATIOMEASURE" },
+		{ "IFCLIGHTSOURCEAMBIENT", SCHEMA_ENTITY, 0, "IFCLIGHTSOURCE", "" },
+		{ "IFCLIGHTSOURCEDIRECTIONAL", SCHEMA_ENTITY, 0, "IFCLIGHTSOURCE", "IFCDIRECTION" },
+		{ "IFCLIGHTSOURCEGONIOMETRIC", SCHEMA_ENTITY, 0, "IFCLIGHTSOURCE", "IFCAXIS2PLACEMENT3D IFCCOLOURRGB IFCTHERMODYNAMICTEMPERATUREMEASURE IFCLUMINOUSFLUXMEASURE IFCLIGHTEMISSIONSOURCEENUM IFCLIGHTDISTRIBUTIONDATASOURCESELECT" },
+		{ "IFCLIGHTSOURCEPOSITIONAL", SCHEMA_ENTITY, 0, "IFCLIGHTSOURCE", "IFCCARTESIANPOINT IFCPOSITIVELENGTHMEASURE IFCREAL IFCREAL IFCREAL" },
+		{ "IFCLIGHTSOURCESPOT", SCHEMA_ENTITY, 0, "IFCLIGHTSOURCEPOSITIONAL", "IFCDIRECTION IFCREAL IFCPOSITIVEPLANEANGLEMEASURE IFCPOSITIVEPLANEANGLEMEASURE" },
+		{ "IFCLINE", SCHEMA_ENTITY, 0, "IFCCURVE", "IFCCARTESIANPOINT IFCVECTOR" },
+		{ "IFCLINEARELEMENT", SCHEMA_ENTITY, 0, "IFCPRODUCT", "" },
+		{ "IFCLINEARFORCEMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCLINEARMOMENTMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCLINEARPLACEMENT", SCHEMA_ENTITY, 0, "IFCOBJECTPLACEMENT", "IFCAXIS2PLACEMENTLINEAR IFCAXIS2PLACEMENT3D" },
+		{ "IFCLINEARPOSITIONINGELEMENT", SCHEMA_ENTITY, 0, "IFCPOSITIONINGELEMENT", "" },
+		{ "IFCLINEARSTIFFNESSMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE IFCTRANSLATIONALSTIFFNESSSELECT", "" },
+		{ "IFCLINEARVELOCITYMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCLINEINDEX", SCHEMA_NUMBER, 1, "IFCPOSITIVEINTEGER IFCSEGMENTINDEXSELECT", "" },
+		{ "IFCLIQUIDTERMINAL", SCHEMA_ENTITY, 0, "IFCFLOWTERMINAL", "IFCLIQUIDTERMINALTYPEENUM" },
+		{ "IFCLIQUIDTERMINALTYPE", SCHEMA_ENTITY, 0, "IFCFLOWTERMINALTYPE", "IFCLIQUIDTERMINALTYPEENUM" },
+		{ "IFCLIQUIDTERMINALTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCLOADGROUPTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCLOCALPLACEMENT", SCHEMA_ENTITY, 0, "IFCOBJECTPLACEMENT", "IFCAXIS2PLACEMENT" },
+		{ "IFCLOGICAL", SCHEMA_ENUM, 0, "IFCSIMPLEVALUE", "" },
+		{ "IFCLOGICALOPERATORENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCLOOP", SCHEMA_ENTITY, 0, "IFCTOPOLOGICALREPRESENTATIONITEM", "" },
+		{ "IFCLSHAPEPROFILEDEF", SCHEMA_ENTITY, 0, "IFCPARAMETERIZEDPROFILEDEF", "IFCPOSITIVELENGTHMEASURE IFCPOSITIVELENGTHMEASURE IFCPOSITIVELENGTHMEASURE IFCNONNEGATIVELENGTHMEASURE IFCNONNEGATIVELENGTHMEASURE IFCPLANEANGLEMEASURE" },
+		{ "IFCLUMINOUSFLUXMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCLUMINOUSINTENSITYDISTRIBUTIONMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCLUMINOUSINTENSITYMEASURE", SCHEMA_NUMBER, 0, "IFCMEASUREVALUE", "" },
+		{ "IFCMAGNETICFLUXDENSITYMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCMAGNETICFLUXMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCMANIFOLDSOLIDBREP", SCHEMA_ENTITY, 0, "IFCSOLIDMODEL", "IFCCLOSEDSHELL" },
+		{ "IFCMAPCONVERSION", SCHEMA_ENTITY, 0, "IFCCOORDINATEOPERATION", "IFCLENGTHMEASURE IFCLENGTHMEASURE IFCLENGTHMEASURE IFCREAL IFCREAL IFCREAL" },
+		{ "IFCMAPCONVERSIONSCALED", SCHEMA_ENTITY, 0, "IFCMAPCONVERSION", "IFCREAL IFCREAL IFCREAL" },
+		{ "IFCMAPPEDITEM", SCHEMA_ENTITY, 0, "IFCREPRESENTATIONITEM", "IFCREPRESENTATIONMAP IFCCARTESIANTRANSFORMATIONOPERATOR" },
+		{ "IFCMARINEFACILITY", SCHEMA_ENTITY, 0, "IFCFACILITY", "IFCMARINEFACILITYTYPEENUM" },
+		{ "IFCMARINEFACILITYTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCMARINEPART", SCHEMA_ENTITY, 0, "IFCFACILITYPART", "IFCMARINEPARTTYPEENUM" },
+		{ "IFCMARINEPARTTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCMASSDENSITYMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCMASSFLOWRATEMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCMASSMEASURE", SCHEMA_NUMBER, 0, "IFCMEASUREVALUE", "" },
+		{ "IFCMASSPERLENGTHMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCMATERIAL", SCHEMA_ENTITY, 0, "IFCMATERIALDEFINITION", "IFCLABEL IFCTEXT IFCLABEL" },
+		{ "IFCMATERIALCLASSIFICATIONRELATIONSHIP", SCHEMA_ENTITY, 0, "", "IFCCLASSIFICATIONSELECT* IFCMATERIAL" },
+		{ "IFCMATERIALCONSTITUENT", SCHEMA_ENTITY, 0, "IFCMATERIALDEFINITION", "IFCLABEL IFCTEXT IFCMATERIAL IFCNORMALISEDRATIOMEASURE IFCLABEL" },
+		{ "IFCMATERIALCONSTITUENTSET", SCHEMA_ENTITY, 0, "IFCMATERIALDEFINITION", "IFCLABEL IFCTEXT IFCMATERIALCONSTITUENT*" },
+		{ "IFCMATERIALDEFINITION", SCHEMA_ENTITY, 0, "IFCMATERIALSELECT IFCOBJECTREFERENCESELECT IFCRESOURCEOBJECTSELECT", "" },
+		{ "IFCMATERIALDEFINITIONREPRESENTATION", SCHEMA_ENTITY, 0, "IFCPRODUCTREPRESENTATION", "IFCMATERIAL" },
+		{ "IFCMATERIALLAYER", SCHEMA_ENTITY, 0, "IFCMATERIALDEFINITION", "IFCMATERIAL IFCNONNEGATIVELENGTHMEASURE IFCLOGICAL IFCLABEL IFCTEXT IFCLABEL IFCINTEGER" },
+		{ "IFCMATERIALLAYERSET", SCHEMA_ENTITY, 0, "IFCMATERIALDEFINITION", "IFCMATERIALLAYER* IFCLABEL IFCTEXT" },
+		{ "IFCMATERIALLAYERSETUSAGE", SCHEMA_ENTITY, 0, "IFCMATERIALUSAGEDEFINITION", "IFCMATERIALLAYERSET IFCLAYERSETDIRECTIONENUM IFCDIRECTIONSENSEENUM IFCLENGTHMEASURE IFCPOSITIVELENGTHMEASURE" },
+		{ "IFCMATERIALLAYERWITHOFFSETS", SCHEMA_ENTITY, 0, "IFCMATERIALLAYER", "IFCLAYERSETDIRECTIONENUM IFCLENGTHMEASURE*" },
+		{ "IFCMATERIALLIST", SCHEMA_ENTITY, 0, "IFCMATERIALSELECT", "IFCMATERIAL*" },
+		{ "IFCMATERIALPROFILE", SCHEMA_ENTITY, 0, "IFCMATERIALDEFINITION", "IFCLABEL IFCTEXT IFCMATERIAL IFCPROFILEDEF IFCINTEGER IFCLABEL" },
+		{ "IFCMATERIALPROFILESET", SCHEMA_ENTITY, 0, "IFCMATERIALDEFINITION", "IFCLABEL IFCTEXT IFCMATERIALPROFILE* IFCCOMPOSITEPROFILEDEF" },
+		{ "IFCMATERIALPROFILESETUSAGE", SCHEMA_ENTITY, 0, "IFCMATERIALUSAGEDEFINITION", "IFCMATERIALPROFILESET IFCCARDINALPOINTREFERENCE IFCPOSITIVELENGTHMEASURE" },
+		{ "IFCMATERIALPROFILESETUSAGETAPERING", SCHEMA_ENTITY, 0, "IFCMATERIALPROFILESETUSAGE", "IFCMATERIALPROFILESET IFCCARDINALPOINTREFERENCE" },
+		{ "IFCMATERIALPROFILEWITHOFFSETS", SCHEMA_ENTITY, 0, "IFCMATERIALPROFILE", "IFCLENGTHMEASURE*" },
+		{ "IFCMATERIALPROPERTIES", SCHEMA_ENTITY, 0, "IFCEXTENDEDPROPERTIES", "IFCMATERIALDEFINITION" },
+		{ "IFCMATERIALRELATIONSHIP", SCHEMA_ENTITY, 0, "IFCRESOURCELEVELRELATIONSHIP", "IFCMATERIAL IFCMATERIAL* IFCLABEL" },
+		{ "IFCMATERIALSELECT", SCHEMA_SELECT, 0, "", "" },
+		{ "IFCMATERIALUSAGEDEFINITION", SCHEMA_ENTITY, 0, "IFCMATERIALSELECT", "" },
+		{ "IFCMEASUREVALUE", SCHEMA_SELECT, 0, "IFCVALUE", "" },
+		{ "IFCMEASUREWITHUNIT", SCHEMA_ENTITY, 0, "IFCAPPLIEDVALUESELECT IFCMETRICVALUESELECT", "IFCVALUE IFCUNIT" },
+		{ "IFCMECHANICALFASTENER", SCHEMA_ENTITY, 0, "IFCELEMENTCOMPONENT", "IFCPOSITIVELENGTHMEASURE IFCPOSITIVELENGTHMEASURE IFCMECHANICALFASTENERTYPEENUM" },
+		{ "IFCMECHANICALFASTENERTYPE", SCHEMA_ENTITY, 0, "IFCELEMENTCOMPONENTTYPE", "IFCMECHANICALFASTENERTYPEENUM IFCPOSITIVELENGTHMEASURE IFCPOSITIVELENGTHMEASURE" },
+		{ "IFCMECHANICALFASTENERTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCMEDICALDEVICE", SCHEMA_ENTITY, 0, "IFCFLOWTERMINAL", "IFCMEDICALDEVICETYPEENUM" },
+		{ "IFCMEDICALDEVICETYPE", SCHEMA_ENTITY, 0, "IFCFLOWTERMINALTYPE", "IFCMEDICALDEVICETYPEENUM" },
+		{ "IFCMEDICALDEVICETYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCMEMBER", SCHEMA_ENTITY, 0, "IFCBUILTELEMENT", "IFCMEMBERTYPEENUM" },
+		{ "IFCMEMBERTYPE", SCHEMA_ENTITY, 0, "IFCBUILTELEMENTTYPE", "IFCMEMBERTYPEENUM" },
+		{ "IFCMEMBERTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCMETRIC", SCHEMA_ENTITY, 0, "IFCCONSTRAINT", "IFCBENCHMARKENUM IFCLABEL IFCMETRICVALUESELECT IFCREFERENCE" },
+		{ "IFCMETRICVALUESELECT", SCHEMA_SELECT, 0, "", "" },
+		{ "IFCMIRROREDPROFILEDEF", SCHEMA_ENTITY, 0, "IFCDERIVEDPROFILEDEF", "" },
+		{ "IFCMOBILETELECOMMUNICATIONSAPPLIANCE", SCHEMA_ENTITY, 0, "IFCFLOWTERMINAL", "IFCMOBILETELECOMMUNICATIONSAPPLIANCETYPEENUM" },
+		{ "IFCMOBILETELECOMMUNICATIONSAPPLIANCETYPE", SCHEMA_ENTITY, 0, "IFCFLOWTERMINALTYPE", "IFCMOBILETELECOMMUNICATIONSAPPLIANCETYPEENUM" },
+		{ "IFCMOBILETELECOMMUNICATIONSAPPLIANCETYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCMODULUSOFELASTICITYMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCMODULUSOFLINEARSUBGRADEREACTIONMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE IFCMODULUSOFTRANSLATIONALSUBGRADEREACTIONSELECT", "" },
+		{ "IFCMODULUSOFROTATIONALSUBGRADEREACTIONMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE IFCMODULUSOFROTATIONALSUBGRADEREACTIONSELECT", "" },
+		{ "IFCMODULUSOFROTATIONALSUBGRADEREACTIONSELECT", SCHEMA_SELECT, 0, "", "" },
+		{ "IFCMODULUSOFSUBGRADEREACTIONMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE IFCMODULUSOFSUBGRADEREACTIONSELECT", "" },
+		{ "IFCMODULUSOFSUBGRADEREACTIONSELECT", SCHEMA_SELECT, 0, "", "" },
+		{ "IFCMODULUSOFTRANSLATIONALSUBGRADEREACTIONSELECT", SCHEMA_SELECT, 0, "", "" },
+		{ "IFCMOISTUREDIFFUSIVITYMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCMOLECULARWEIGHTMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCMOMENTOFINERTIAMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCMONETARYMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCMONETARYUNIT", SCHEMA_ENTITY, 0, "IFCUNIT", "IFCLABEL" },
+		{ "IFCMONTHINYEARNUMBER", SCHEMA_NUMBER, 0, "", "" },
+		{ "IFCMOORINGDEVICE", SCHEMA_ENTITY, 0, "IFCBUILTELEMENT", "IFCMOORINGDEVICETYPEENUM" },
+		{ "IFCMOORINGDEVICETYPE", SCHEMA_ENTITY, 0, "IFCBUILTELEMENTTYPE", "IFCMOORINGDEVICETYPEENUM" },
+		{ "IFCMOORINGDEVICETYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCMOTORCONNECTION", SCHEMA_ENTITY, 0, "IFCENERGYCONVERSIONDEVICE", "IFCMOTORCONNECTIONTYPEENUM" },
+		{ "IFCMOTORCONNECTIONTYPE", SCHEMA_ENTITY, 0, "IFCENERGYCONVERSIONDEVICETYPE", "IFCMOTORCONNECTIONTYPEENUM" },
+		{ "IFCMOTORCONNECTIONTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCNAMEDUNIT", SCHEMA_ENTITY, 0, "IFCUNIT", "IFCDIMENSIONALEXPONENTS IFCUNITENUM" },
+		{ "IFCNAVIGATIONELEMENT", SCHEMA_ENTITY, 0, "IFCBUILTELEMENT", "IFCNAVIGATIONELEMENTTYPEENUM" },
+		{ "IFCNAVIGATIONELEMENTTYPE", SCHEMA_ENTITY, 0, "IFCBUILTELEMENTTYPE", "IFCNAVIGATIONELEMENTTYPEENUM" },
+		{ "IFCNAVIGATIONELEMENTTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCNONNEGATIVELENGTHMEASURE", SCHEMA_NUMBER, 0, "IFCLENGTHMEASURE", "" },
+		{ "IFCNORMALISEDRATIOMEASURE", SCHEMA_NUMBER, 0, "IFCRATIOMEASURE IFCCOLOURORFACTOR", "" },
+		{ "IFCNUMERICMEASURE", SCHEMA_NUMBER, 0, "IFCMEASUREVALUE", "" },
+		{ "IFCOBJECT", SCHEMA_ENTITY, 0, "IFCOBJECTDEFINITION", "IFCLABEL" },
+		{ "IFCOBJECTDEFINITION", SCHEMA_ENTITY, 0, "IFCDEFINITIONSELECT IFCROOT", "" },
+		{ "IFCOBJECTIVE", SCHEMA_ENTITY, 0, "IFCCONSTRAINT", "IFCCONSTRAINT* IFCLOGICALOPERATORENUM IFCOBJECTIVEENUM IFCLABEL" },
+		{ "IFCOBJECTIVEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCOBJECTPLACEMENT", SCHEMA_ENTITY, 0, "", "IFCOBJECTPLACEMENT" },
+		{ "IFCOBJECTREFERENCESELECT", SCHEMA_SELECT, 0, "", "" },
+		{ "IFCOCCUPANT", SCHEMA_ENTITY, 0, "IFCACTOR", "IFCOCCUPANTTYPEENUM" },
+		{ "IFCOCCUPANTTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCOFFSETCURVE", SCHEMA_ENTITY, 0, "IFCCURVE", "IFCCURVE" },
+		{ "IFCOFFSETCURVE2D", SCHEMA_ENTITY, 0, "IFCOFFSETCURVE", "IFCLENGTHMEASURE IFCLOGICAL" },
+		{ "IFCOFFSETCURVE3D", SCHEMA_ENTITY, 0, "IFCOFFSETCURVE", "IFCLENGTHMEASURE IFCLOGICAL IFCDIRECTION" },
+		{ "IFCOFFSETCURVEBYDISTANCES", SCHEMA_ENTITY, 0, "IFCOFFSETCURVE", "IFCPOINTBYDISTANCEEXPRESSION* IFCLABEL" },
+		{ "IFCOPENCROSSPROFILEDEF", SCHEMA_ENTITY, 0, "IFCPROFILEDEF", "IFCBOOLEAN IFCNONNEGATIVELENGTHMEASURE* IFCPLANEANGLEMEASURE* IFCLABEL* IFCCARTESIANPOINT" },
+		{ "IFCOPENINGELEMENT", SCHEMA_ENTITY, 0, "IFCFEATUREELEMENTSUBTRACTION", "IFCOPENINGELEMENTTYPEENUM" },
+		{ "IFCOPENINGELEMENTTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCOPENSHELL", SCHEMA_ENTITY, 0, "IFCSHELL IFCCONNECTEDFACESET", "" },
+		{ "IFCORGANIZATION", SCHEMA_ENTITY, 0, "IFCACTORSELECT IFCOBJECTREFERENCESELECT IFCRESOURCEOBJECTSELECT", "IFCIDENTIFIER IFCLABEL IFCTEXT IFCACTORROLE* IFCADDRESS*" },
+		{ "IFCORGANIZATIONRELATIONSHIP", SCHEMA_ENTITY, 0, "IFCRESOURCELEVELRELATIONSHIP", "IFCORGANIZATION IFCORGANIZATION*" },
+		{ "IFCORIENTEDEDGE", SCHEMA_ENTITY, 0, "IFCEDGE", "IFCEDGE IFCBOOLEAN" },
+		{ "IFCOUTERBOUNDARYCURVE", SCHEMA_ENTITY, 0, "IFCBOUNDARYCURVE", "" },
+		{ "IFCOUTLET", SCHEMA_ENTITY, 0, "IFCFLOWTERMINAL", "IFCOUTLETTYPEENUM" },
+		{ "IFCOUTLETTYPE", SCHEMA_ENTITY, 0, "IFCFLOWTERMINALTYPE", "IFCOUTLETTYPEENUM" },
+		{ "IFCOUTLETTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCOWNERHISTORY", SCHEMA_ENTITY, 0, "", "IFCPERSONANDORGANIZATION IFCAPPLICATION IFCSTATEENUM IFCCHANGEACTIONENUM IFCTIMESTAMP IFCPERSONANDORGANIZATION IFCAPPLICATION IFCTIMESTAMP" },
+		{ "IFCPARAMETERIZEDPROFILEDEF", SCHEMA_ENTITY, 0, "IFCPROFILEDEF", "IFCAXIS2PLACEMENT2D" },
+		{ "IFCPARAMETERVALUE", SCHEMA_NUMBER, 0, "IFCCURVEMEASURESELECT IFCMEASUREVALUE IFCTRIMMINGSELECT", "" },
+		{ "IFCPATH", SCHEMA_ENTITY, 0, "IFCTOPOLOGICALREPRESENTATIONITEM", "IFCORIENTEDEDGE*" },
+		{ "IFCPAVEMENT", SCHEMA_ENTITY, 0, "IFCBUILTELEMENT", "IFCPAVEMENTTYPEENUM" },
+		{ "IFCPAVEMENTTYPE", SCHEMA_ENTITY, 0, "IFCBUILTELEMENTTYPE", "IFCPAVEMENTTYPEENUM" },
+		{ "IFCPAVEMENTTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCPCURVE", SCHEMA_ENTITY, 0, "IFCCURVEONSURFACE IFCCURVE", "IFCSURFACE IFCCURVE" },
+		{ "IFCPERFORMANCEHISTORY", SCHEMA_ENTITY, 0, "IFCCONTROL", "IFCLABEL IFCPERFORMANCEHISTORYTYPEENUM" },
+		{ "IFCPERFORMANCEHISTORYTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCPERMEABLECOVERINGOPERATIONENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCPERMEABLECOVERINGPROPERTIES", SCHEMA_ENTITY, 0, "IFCPREDEFINEDPROPERTYSET", "IFCPERMEABLECOVERINGOPERATIONENUM IFCWINDOWPANELPOSITIONENUM IFCPOSITIVELENGTHMEASURE IFCPOSITIVELENGTHMEASURE IFCSHAPEASPECT" },
+		{ "IFCPERMIT", SCHEMA_ENTITY, 0, "IFCCONTROL", "IFCPERMITTYPEENUM IFCLABEL IFCTEXT" },
+		{ "IFCPERMITTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCPERSON", SCHEMA_ENTITY, 0, "IFCACTORSELECT IFCOBJECTREFERENCESELECT IFCRESOURCEOBJECTSELECT", "IFCIDENTIFIER IFCLABEL IFCLABEL IFCLABEL* IFCLABEL* IFCLABEL* IFCACTORROLE* IFCADDRESS*" },
+		{ "IFCPERSONANDORGANIZATION", SCHEMA_ENTITY, 0, "IFCACTORSELECT IFCOBJECTREFERENCESELECT IFCRESOURCEOBJECTSELECT", "IFCPERSON IFCORGANIZATION IFCACTORROLE*" },
+		{ "IFCPHMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCPHYSICALCOMPLEXQUANTITY", SCHEMA_ENTITY, 0, "IFCPHYSICALQUANTITY", "IFCPHYSICALQUANTITY* IFCLABEL IFCLABEL IFCLABEL" },
+		{ "IFCPHYSICALORVIRTUALENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCPHYSICALQUANTITY", SCHEMA_ENTITY, 0, "IFCRESOURCEOBJECTSELECT", "IFCLABEL IFCTEXT" },
+		{ "IFCPHYSICALSIMPLEQUANTITY", SCHEMA_ENTITY, 0, "IFCPHYSICALQUANTITY", "IFCNAMEDUNIT" },
+		{ "IFCPILE", SCHEMA_ENTITY, 0, "IFCDEEPFOUNDATION", "IFCPILETYPEENUM IFCPILECONSTRUCTIONENUM" },
+		{ "IFCPILECONSTRUCTIONENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCPILETYPE", SCHEMA_ENTITY, 0, "IFCDEEPFOUNDATIONTYPE", "IFCPILETYPEENUM" },
+		{ "IFCPILETYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCPIPEFITTING", SCHEMA_ENTITY, 0, "IFCFLOWFITTING", "IFCPIPEFITTINGTYPEENUM" },
+		{ "IFCPIPEFITTINGTYPE", SCHEMA_ENTITY, 0, "IFCFLOWFITTINGTYPE", "IFCPIPEFITTINGTYPEENUM" },
+		{ "IFCPIPEFITTINGTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCPIPESEGMENT", SCHEMA_ENTITY, 0, "IFCFLOWSEGMENT", "IFCPIPESEGMENTTYPEENUM" },
+		{ "IFCPIPESEGMENTTYPE", SCHEMA_ENTITY, 0, "IFCFLOWSEGMENTTYPE", "IFCPIPESEGMENTTYPEENUM" },
+		{ "IFCPIPESEGMENTTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCPIXELTEXTURE", SCHEMA_ENTITY, 0, "IFCSURFACETEXTURE", "IFCINTEGER IFCINTEGER IFCINTEGER IFCBINARY*" },
+		{ "IFCPLACEMENT", SCHEMA_ENTITY, 0, "IFCGEOMETRICREPRESENTATIONITEM", "IFCPOINT" },
+		{ "IFCPLANARBOX", SCHEMA_ENTITY, 0, "IFCPLANAREXTENT", "IFCAXIS2PLACEMENT" },
+		{ "IFCPLANAREXTENT", SCHEMA_ENTITY, 0, "IFCGEOMETRICREPRESENTATIONITEM", "IFCLENGTHMEASURE IFCLENGTHMEASURE" },
+		{ "IFCPLANARFORCEMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCPLANE", SCHEMA_ENTITY, 0, "IFCELEMENTARYSURFACE", "" },
+		{ "IFCPLANEANGLEMEASURE", SCHEMA_NUMBER, 0, "IFCBENDINGPARAMETERSELECT IFCMEASUREVALUE", "" },
+		{ "IFCPLATE", SCHEMA_ENTITY, 0, "IFCBUILTELEMENT", "IFCPLATETYPEENUM" },
+		{ "IFCPLATETYPE", SCHEMA_ENTITY, 0, "IFCBUILTELEMENTTYPE", "IFCPLATETYPEENUM" },
+		{ "IFCPLATETYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCPOINT", SCHEMA_ENTITY, 0, "IFCGEOMETRICSETSELECT IFCPOINTORVERTEXPOINT IFCGEOMETRICREPRESENTATIONITEM", "" },
+		{ "IFCPOINTBYDISTANCEEXPRESSION", SCHEMA_ENTITY, 0, "IFCPOINT", "IFCCURVEMEASURESELECT IFCLENGTHMEASURE IFCLENGTHMEASURE IFCLENGTHMEASURE IFCCURVE" },
+		{ "IFCPOINTONCURVE", SCHEMA_ENTITY, 0, "IFCPOINT", "IFCCURVE IFCPARAMETERVALUE" },
+		{ "IFCPOINTONSURFACE", SCHEMA_ENTITY, 0, "IFCPOINT", "IFCSURFACE IFCPARAMETERVALUE IFCPARAMETERVALUE" },
+		{ "IFCPOINTORVERTEXPOINT", SCHEMA_SELECT, 0, "", "" },
+		{ "IFCPOLYGONALBOUNDEDHALFSPACE", SCHEMA_ENTITY, 0, "IFCHALFSPACESOLID", "IFCAXIS2PLACEMENT3D IFCBOUNDEDCURVE" },
+		{ "IFCPOLYGONALFACESET", SCHEMA_ENTITY, 0, "IFCTESSELLATEDFACESET", "IFCBOOLEAN IFCINDEXEDPOLYGONALFACE* IFCPOSITIVEINTEGER*" },
+		{ "IFCPOLYLINE", SCHEMA_ENTITY, 0, "IFCBOUNDEDCURVE", "IFCCARTESIANPOINT*" },
+		{ "IFCPOLYLOOP", SCHEMA_ENTITY, 0, "IFCLOOP", "IFCCARTESIANPOINT*" },
+		{ "IFCPOLYNOMIALCURVE", SCHEMA_ENTITY, 0, "IFCCURVE", "IFCPLACEMENT IFCREAL* IFCREAL* IFCREAL*" },
+		{ "IFCPORT", SCHEMA_ENTITY, 0, "IFCPRODUCT", "" },
+		{ "IFCPOSITIONINGELEMENT", SCHEMA_ENTITY, 0, "IFCPRODUCT", "" },
+		{ "IFCPOSITIVEINTEGER", SCHEMA_NUMBER, 0, "IFCINTEGER", "" },
+		{ "IFCPOSITIVELENGTHMEASURE", SCHEMA_NUMBER, 0, "IFCLENGTHMEASURE IFCHATCHLINEDISTANCESELECT", "" },
+		{ "IFCPOSITIVEPLANEANGLEMEASURE", SCHEMA_NUMBER, 0, "IFCPLANEANGLEMEASURE", "" },
+		{ "IFCPOSITIVERATIOMEASURE", SCHEMA_NUMBER, 0, "IFCRATIOMEASURE", "" },
+		{ "IFCPOSTALADDRESS", SCHEMA_ENTITY, 0, "IFCADDRESS", "IFCLABEL IFCLABEL* IFCLABEL IFCLABEL IFCLABEL IFCLABEL IFCLABEL" },
+		{ "IFCPOWERMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCPREDEFINEDCOLOUR", SCHEMA_ENTITY, 0, "IFCCOLOUR IFCPREDEFINEDITEM", "" },
+		{ "IFCPREDEFINEDCURVEFONT", SCHEMA_ENTITY, 0, "IFCCURVESTYLEFONTSELECT IFCPREDEFINEDITEM", "" },
+		{ "IFCPREDEFINEDITEM", SCHEMA_ENTITY, 0, "IFCPRESENTATIONITEM", "IFCLABEL" },
+		{ "IFCPREDEFINEDPROPERTIES", SCHEMA_ENTITY, 0, "IFCPROPERTYABSTRACTION", "" },
+		{ "IFCPREDEFINEDPROPERTYSET", SCHEMA_ENTITY, 0, "IFCPROPERTYSETDEFINITION", "" },
+		{ "IFCPREDEFINEDTEXTFONT", SCHEMA_ENTITY, 0, "IFCTEXTFONTSELECT IFCPREDEFINEDITEM", "" },
+		{ "IFCPREFERREDSURFACECURVEREPRESENTATION", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCPRESENTABLETEXT", SCHEMA_STRING, 0, "", "" },
+		{ "IFCPRESENTATIONITEM", SCHEMA_ENTITY, 0, "", "" },
+		{ "IFCPRESENTATIONLAYERASSIGNMENT", SCHEMA_ENTITY, 0, "", "IFCLABEL IFCTEXT IFCLAYEREDITEM* IFCIDENTIFIER" },
+		{ "IFCPRESENTATIONLAYERWITHSTYLE", SCHEMA_ENTITY, 0, "IFCPRESENTATIONLAYERASSIGNMENT", "IFCLOGICAL IFCLOGICAL IFCLOGICAL IFCPRESENTATIONSTYLE*" },
+		{ "IFCPRESENTATIONSTYLE", SCHEMA_ENTITY, 0, "", "IFCLABEL" },
+		{ "IFCPRESENTATIONSTYLEASSIGNMENT", SCHEMA_ENTITY, 0, "IFCPRESENTATIONSTYLE", "IFCPRESENTATIONSTYLE*" },
+		{ "IFCPRESSUREMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCPROCEDURE", SCHEMA_ENTITY, 0, "IFCPROCESS", "IFCPROCEDURETYPEENUM" },
+		{ "IFCPROCEDURETYPE", SCHEMA_ENTITY, 0, "IFCTYPEPROCESS", "IFCPROCEDURETYPEENUM" },
+		{ "IFCPROCEDURETYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCPROCESS", SCHEMA_ENTITY, 0, "IFCPROCESSSELECT IFCOBJECT", "IFCIDENTIFIER IFCTEXT" },
+		{ "IFCPROCESSSELECT", SCHEMA_SELECT, 0, "", "" },
+		{ "IFCPRODUCT", SCHEMA_ENTITY, 0, "IFCPRODUCTSELECT IFCSPATIALREFERENCESELECT IFCOBJECT", "IFCOBJECTPLACEMENT IFCPRODUCTREPRESENTATION" },
+		{ "IFCPRODUCTDEFINITIONSHAPE", SCHEMA_ENTITY, 0, "IFCPRODUCTREPRESENTATIONSELECT IFCPRODUCTREPRESENTATION", "" },
+		{ "IFCPRODUCTREPRESENTATION", SCHEMA_ENTITY, 0, "", "IFCLABEL IFCTEXT IFCREPRESENTATION*" },
+		{ "IFCPRODUCTREPRESENTATIONSELECT", SCHEMA_SELECT, 0, "", "" },
+		{ "IFCPRODUCTSELECT", SCHEMA_SELECT, 0, "", "" },
+		{ "IFCPROFILEDEF", SCHEMA_ENTITY, 0, "IFCRESOURCEOBJECTSELECT", "IFCPROFILETYPEENUM IFCLABEL" },
+		{ "IFCPROFILEPROPERTIES", SCHEMA_ENTITY, 0, "IFCEXTENDEDPROPERTIES", "IFCPROFILEDEF" },
+		{ "IFCPROFILETYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCPROJECT", SCHEMA_ENTITY, 0, "IFCCONTEXT", "" },
+		{ "IFCPROJECTEDCRS", SCHEMA_ENTITY, 0, "IFCCOORDINATEREFERENCESYSTEM", "IFCIDENTIFIER IFCIDENTIFIER IFCIDENTIFIER IFCNAMEDUNIT" },
+		{ "IFCPROJECTEDORTRUELENGTHENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCPROJECTIONELEMENT", SCHEMA_ENTITY, 0, "IFCFEATUREELEMENTADDITION", "IFCPROJECTIONELEMENTTYPEENUM" },
+		{ "IFCPROJECTIONELEMENTTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCPROJECTLIBRARY", SCHEMA_ENTITY, 0, "IFCCONTEXT", "" },
+		{ "IFCPROJECTORDER", SCHEMA_ENTITY, 0, "IFCCONTROL", "IFCPROJECTORDERTYPEENUM IFCLABEL IFCTEXT" },
+		{ "IFCPROJECTORDERTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCPROPERTY", SCHEMA_ENTITY, 0, "IFCPROPERTYABSTRACTION", "IFCIDENTIFIER IFCTEXT" },
+		{ "IFCPROPERTYABSTRACTION", SCHEMA_ENTITY, 0, "IFCRESOURCEOBJECTSELECT", "" },
+		{ "IFCPROPERTYBOUNDEDVALUE", SCHEMA_ENTITY, 0, "IFCSIMPLEPROPERTY", "IFCVALUE IFCVALUE IFCUNIT IFCVALUE" },
+		{ "IFCPROPERTYDEFINITION", SCHEMA_ENTITY, 0, "IFCDEFINITIONSELECT IFCROOT", "" },
+		{ "IFCPROPERTYDEPENDENCYRELATIONSHIP", SCHEMA_ENTITY, 0, "IFCRESOURCELEVELRELATIONSHIP", "IFCPROPERTY IFCPROPERTY IFCTEXT" },
+		{ "IFCPROPERTYENUMERATEDVALUE", SCHEMA_ENTITY, 0, "IFCSIMPLEPROPERTY", "IFCVALUE* IFCPROPERTYENUMERATION" },
+		{ "IFCPROPERTYENUMERATION", SCHEMA_ENTITY, 0, "IFCPROPERTYABSTRACTION", "IFCLABEL IFCVALUE* IFCUNIT" },
+		{ "IFCPROPERTYLISTVALUE", SCHEMA_ENTITY, 0, "IFCSIMPLEPROPERTY", "IFCVALUE* IFCUNIT" },
+		{ "IFCPROPERTYREFERENCEVALUE", SCHEMA_ENTITY, 0, "IFCSIMPLEPROPERTY", "IFCTEXT IFCOBJECTREFERENCESELECT" },
+		{ "IFCPROPERTYSET", SCHEMA_ENTITY, 0, "IFCPROPERTYSETDEFINITION", "IFCPROPERTY*" },
+		{ "IFCPROPERTYSETDEFINITION", SCHEMA_ENTITY, 0, "IFCPROPERTYSETDEFINITIONSELECT IFCPROPERTYDEFINITION", "" },
+		{ "IFCPROPERTYSETDEFINITIONSELECT", SCHEMA_SELECT, 0, "", "" },
+		{ "IFCPROPERTYSETDEFINITIONSET", SCHEMA_ENTITY, 1, "IFCPROPERTYSETDEFINITIONSELECT", "" },
+		{ "IFCPROPERTYSETTEMPLATE", SCHEMA_ENTITY, 0, "IFCPROPERTYTEMPLATEDEFINITION", "IFCPROPERTYSETTEMPLATETYPEENUM IFCIDENTIFIER IFCPROPERTYTEMPLATE*" },
+		{ "IFCPROPERTYSETTEMPLATETYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCPROPERTYSINGLEVALUE", SCHEMA_ENTITY, 0, "IFCSIMPLEPROPERTY", "IFCVALUE IFCUNIT" },
+		{ "IFCPROPERTYTABLEVALUE", SCHEMA_ENTITY, 0, "IFCSIMPLEPROPERTY", "IFCVALUE* IFCVALUE* IFCTEXT IFCUNIT IFCUNIT IFCCURVEINTERPOLATIONENUM" },
+		{ "IFCPROPERTYTEMPLATE", SCHEMA_ENTITY, 0, "IFCPROPERTYTEMPLATEDEFINITION", "" },
+		{ "IFCPROPERTYTEMPLATEDEFINITION", SCHEMA_ENTITY, 0, "IFCPROPERTYDEFINITION", "" },
+		{ "IFCPROTECTIVEDEVICE", SCHEMA_ENTITY, 0, "IFCFLOWCONTROLLER", "IFCPROTECTIVEDEVICETYPEENUM" },
+		{ "IFCPROTECTIVEDEVICETRIPPINGUNIT", SCHEMA_ENTITY, 0, "IFCDISTRIBUTIONCONTROLELEMENT", "IFCPROTECTIVEDEVICETRIPPINGUNITTYPEENUM" },
+		{ "IFCPROTECTIVEDEVICETRIPPINGUNITTYPE", SCHEMA_ENTITY, 0, "IFCDISTRIBUTIONCONTROLELEMENTTYPE", "IFCPROTECTIVEDEVICETRIPPINGUNITTYPEENUM" },
+		{ "IFCPROTECTIVEDEVICETRIPPINGUNITTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCPROTECTIVEDEVICETYPE", SCHEMA_ENTITY, 0, "IFCFLOWCONTROLLERTYPE", "IFCPROTECTIVEDEVICETYPEENUM" },
+		{ "IFCPROTECTIVEDEVICETYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCPUMP", SCHEMA_ENTITY, 0, "IFCFLOWMOVINGDEVICE", "IFCPUMPTYPEENUM" },
+		{ "IFCPUMPTYPE", SCHEMA_ENTITY, 0, "IFCFLOWMOVINGDEVICETYPE", "IFCPUMPTYPEENUM" },
+		{ "IFCPUMPTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCQUANTITYAREA", SCHEMA_ENTITY, 0, "IFCPHYSICALSIMPLEQUANTITY", "IFCAREAMEASURE IFCLABEL" },
+		{ "IFCQUANTITYCOUNT", SCHEMA_ENTITY, 0, "IFCPHYSICALSIMPLEQUANTITY", "IFCCOUNTMEASURE IFCLABEL" },
+		{ "IFCQUANTITYLENGTH", SCHEMA_ENTITY, 0, "IFCPHYSICALSIMPLEQUANTITY", "IFCLENGTHMEASURE IFCLABEL" },
+		{ "IFCQUANTITYNUMBER", SCHEMA_ENTITY, 0, "IFCPHYSICALSIMPLEQUANTITY", "IFCNUMERICMEASURE IFCLABEL" },
+		{ "IFCQUANTITYSET", SCHEMA_ENTITY, 0, "IFCPROPERTYSETDEFINITION", "" },
+		{ "IFCQUANTITYTIME", SCHEMA_ENTITY, 0, "IFCPHYSICALSIMPLEQUANTITY", "IFCTIMEMEASURE IFCLABEL" },
+		{ "IFCQUANTITYVOLUME", SCHEMA_ENTITY, 0, "IFCPHYSICALSIMPLEQUANTITY", "IFCVOLUMEMEASURE IFCLABEL" },
+		{ "IFCQUANTITYWEIGHT", SCHEMA_ENTITY, 0, "IFCPHYSICALSIMPLEQUANTITY", "IFCMASSMEASURE IFCLABEL" },
+		{ "IFCRADIOACTIVITYMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCRAIL", SCHEMA_ENTITY, 0, "IFCBUILTELEMENT", "IFCRAILTYPEENUM" },
+		{ "IFCRAILING", SCHEMA_ENTITY, 0, "IFCBUILTELEMENT", "IFCRAILINGTYPEENUM" },
+		{ "IFCRAILINGTYPE", SCHEMA_ENTITY, 0, "IFCBUILTELEMENTTYPE", "IFCRAILINGTYPEENUM" },
+		{ "IFCRAILINGTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCRAILTYPE", SCHEMA_ENTITY, 0, "IFCBUILTELEMENTTYPE", "IFCRAILTYPEENUM" },
+		{ "IFCRAILTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCRAILWAY", SCHEMA_ENTITY, 0, "IFCFACILITY", "IFCRAILWAYTYPEENUM" },
+		{ "IFCRAILWAYPART", SCHEMA_ENTITY, 0, "IFCFACILITYPART", "IFCRAILWAYPARTTYPEENUM" },
+		{ "IFCRAILWAYPARTTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCRAILWAYTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCRAMP", SCHEMA_ENTITY, 0, "IFCBUILTELEMENT", "IFCRAMPTYPEENUM" },
+		{ "IFCRAMPFLIGHT", SCHEMA_ENTITY, 0, "IFCBUILTELEMENT", "IFCRAMPFLIGHTTYPEENUM" },
+		{ "IFCRAMPFLIGHTTYPE", SCHEMA_ENTITY, 0, "IFCBUILTELEMENTTYPE", "IFCRAMPFLIGHTTYPEENUM" },
+		{ "IFCRAMPFLIGHTTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCRAMPTYPE", SCHEMA_ENTITY, 0, "IFCBUILTELEMENTTYPE", "IFCRAMPTYPEENUM" },
+		{ "IFCRAMPTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCRATIOMEASURE", SCHEMA_NUMBER, 0, "IFCMEASUREVALUE IFCSIZESELECT IFCTIMEORRATIOSELECT", "" },
+		{ "IFCRATIONALBSPLINECURVEWITHKNOTS", SCHEMA_ENTITY, 0, "IFCBSPLINECURVEWITHKNOTS", "IFCREAL*" },
+		{ "IFCRATIONALBSPLINESURFACEWITHKNOTS", SCHEMA_ENTITY, 0, "IFCBSPLINESURFACEWITHKNOTS", "IFCREAL**" },
+		{ "IFCREAL", SCHEMA_NUMBER, 0, "IFCSIMPLEVALUE", "" },
+		{ "IFCRECTANGLEHOLLOWPROFILEDEF", SCHEMA_ENTITY, 0, "IFCRECTANGLEPROFILEDEF", "IFCPOSITIVELENGTHMEASURE IFCNONNEGATIVELENGTHMEASURE IFCNONNEGATIVELENGTHMEASURE" },
+		{ "IFCRECTANGLEPROFILEDEF", SCHEMA_ENTITY, 0, "IFCPARAMETERIZEDPROFILEDEF", "IFCPOSITIVELENGTHMEASURE IFCPOSITIVELENGTHMEASURE" },
+		{ "IFCRECTANGULARPYRAMID", SCHEMA_ENTITY, 0, "IFCCSGPRIMITIVE3D", "IFCPOSITIVELENGTHMEASURE IFCPOSITIVELENGTHMEASURE IFCPOSITIVELENGTHMEASURE" },
+		{ "IFCRECTANGULARTRIMMEDSURFACE", SCHEMA_ENTITY, 0, "IFCBOUNDEDSURFACE", "IFCSURFACE IFCPARAMETERVALUE IFCPARAMETERVALUE IFCPARAMETERVALUE IFCPARAMETERVALUE IFCBOOLEAN IFCBOOLEAN" },
+		{ "IFCRECURRENCEPATTERN", SCHEMA_ENTITY, 0, "", "IFCRECURRENCETYPEENUM IFCDAYINMONTHNUMBER* IFCDAYINWEEKNUMBER* IFCMONTHINYEARNUMBER* IFCINTEGER IFCINTEGER IFCINTEGER IFCTIMEPERIOD*" },
+		{ "IFCRECURRENCETYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCREFERENCE", SCHEMA_ENTITY, 0, "IFCAPPLIEDVALUESELECT IFCMETRICVALUESELECT", "IFCIDENTIFIER IFCIDENTIFIER IFCLABEL IFCINTEGER* IFCREFERENCE" },
+		{ "IFCREFERENT", SCHEMA_ENTITY, 0, "IFCPOSITIONINGELEMENT", "IFCREFERENTTYPEENUM" },
+		{ "IFCREFERENTTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCREFLECTANCEMETHODENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCREGULARTIMESERIES", SCHEMA_ENTITY, 0, "IFCTIMESERIES", "IFCTIMEMEASURE IFCTIMESERIESVALUE*" },
+		{ "IFCREINFORCEDSOIL", SCHEMA_ENTITY, 0, "IFCEARTHWORKSELEMENT", "IFCREINFORCEDSOILTYPEENUM" },
+		{ "IFCREINFORCEDSOILTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCREINFORCEMENTBARPROPERTIES", SCHEMA_ENTITY, 0, "IFCPREDEFINEDPROPERTIES", "IFCAREAMEASURE IFCLABEL IFCREINFORCINGBARSURFACEENUM IFCLENGTHMEASURE IFCPOSITIVELENGTHMEASURE IFCCOUNTMEASURE" },
+		{ "IFCREINFORCEMENTDEFINITIONPROPERTIES", SCHEMA_ENTITY, 0, "IFCPREDEFINEDPROPERTYSET", "IFCLABEL IFCSECTIONREINFORCEMENTPROPERTIES*" },
+		{ "IFCREINFORCINGBAR", SCHEMA_ENTITY, 0, "IFCREINFORCINGELEMENT", "IFCPOSITIVELENGTHMEASURE IFCAREAMEASURE IFCPOSITIVELENGTHMEASURE IFCREINFORCINGBARTYPEENUM IFCREINFORCINGBARSURFACEENUM" },
+		{ "IFCREINFORCINGBARROLEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCREINFORCINGBARSURFACEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCREINFORCINGBARTYPE", SCHEMA_ENTITY, 0, "IFCREINFORCINGELEMENTTYPE", "IFCREINFORCINGBARTYPEENUM IFCPOSITIVELENGTHMEASURE IFCAREAMEASURE IFCPOSITIVELENGTHMEASURE IFCREINFORCINGBARSURFACEENUM IFCLABEL IFCBENDINGPARAMETERSELECT*" },
+		{ "IFCREINFORCINGBARTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCREINFORCINGELEMENT", SCHEMA_ENTITY, 0, "IFCELEMENTCOMPONENT", "IFCLABEL" },
+		{ "IFCREINFORCINGELEMENTTYPE", SCHEMA_ENTITY, 0, "IFCELEMENTCOMPONENTTYPE", "" },
+		{ "IFCREINFORCINGMESH", SCHEMA_ENTITY, 0, "IFCREINFORCINGELEMENT", "IFCPOSITIVELENGTHMEASURE IFCPOSITIVELENGTHMEASURE IFCPOSITIVELENGTHMEASURE IFCPOSITIVELENGTHMEASURE IFCAREAMEASURE IFCAREAMEASURE IFCPOSITIVELENGTHMEASURE IFCPOSITIVELENGTHMEASURE IFCREINFORCINGMESHTYPEENUM" },
+		{ "IFCREINFORCINGMESHTYPE", SCHEMA_ENTITY, 0, "IFCREINFORCINGELEMENTTYPE", "IFCREINFORCINGMESHTYPEENUM IFCPOSITIVELENGTHMEASURE IFCPOSITIVELENGTHMEASURE IFCPOSITIVELENGTHMEASURE IFCPOSITIVELENGTHMEASURE IFCAREAMEASURE IFCAREAMEASURE IFCPOSITIVELENGTHMEASURE IFCPOSITIVELENGTHMEASURE IFCLABEL IFCBENDINGPARAMETERSELECT*" },
+		{ "IFCREINFORCINGMESHTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCRELADHERESTOELEMENT", SCHEMA_ENTITY, 0, "IFCRELDECOMPOSES", "IFCELEMENT IFCSURFACEFEATURE*" },
+		{ "IFCRELAGGREGATES", SCHEMA_ENTITY, 0, "IFCRELDECOMPOSES", "IFCOBJECTDEFINITION IFCOBJECTDEFINITION*" },
+		{ "IFCRELASSIGNS", SCHEMA_ENTITY, 0, "IFCRELATIONSHIP", "IFCOBJECTDEFINITION* IFCSTRIPPEDOPTIONAL" },
+		{ "IFCRELASSIGNSTOACTOR", SCHEMA_ENTITY, 0, "IFCRELASSIGNS", "IFCACTOR IFCACTORROLE" },
+		{ "IFCRELASSIGNSTOCONTROL", SCHEMA_ENTITY, 0, "IFCRELASSIGNS", "IFCCONTROL" },
+		{ "IFCRELASSIGNSTOGROUP", SCHEMA_ENTITY, 0, "IFCRELASSIGNS", "IFCGROUP" },
+		{ "IFCRELASSIGNSTOGROUPBYFACTOR", SCHEMA_ENTITY, 0, "IFCRELASSIGNSTOGROUP", "IFCRATIOMEASURE" },
+		{ "IFCRELASSIGNSTOPROCESS", SCHEMA_ENTITY, 0, "IFCRELASSIGNS", "IFCPROCESSSELECT IFCMEASUREWITHUNIT" },
+		{ "IFCRELASSIGNSTOPRODUCT", SCHEMA_ENTITY, 0, "IFCRELASSIGNS", "IFCPRODUCTSELECT" },
+		{ "IFCRELASSIGNSTORESOURCE", SCHEMA_ENTITY, 0, "IFCRELASSIGNS", "IFCRESOURCESELECT" },
+		{ "IFCRELASSOCIATES", SCHEMA_ENTITY, 0, "IFCRELATIONSHIP", "IFCDEFINITIONSELECT*" },
+		{ "IFCRELASSOCIATESAPPROVAL", SCHEMA_ENTITY, 0, "IFCRELASSOCIATES", "IFCAPPROVAL" },
+		{ "IFCRELASSOCIATESCLASSIFICATION", SCHEMA_ENTITY, 0, "IFCRELASSOCIATES", "IFCCLASSIFICATIONSELECT" },
+		{ "IFCRELASSOCIATESCONSTRAINT", SCHEMA_ENTITY, 0, "IFCRELASSOCIATES", "IFCLABEL IFCCONSTRAINT" },
+		{ "IFCRELASSOCIATESDOCUMENT", SCHEMA_ENTITY, 0, "IFCRELASSOCIATES", "IFCDOCUMENTSELECT" },
+		{ "IFCRELASSOCIATESLIBRARY", SCHEMA_ENTITY, 0, "IFCRELASSOCIATES", "IFCLIBRARYSELECT" },
+		{ "IFCRELASSOCIATESMATERIAL", SCHEMA_ENTITY, 0, "IFCRELASSOCIATES", "IFCMATERIALSELECT" },
+		{ "IFCRELASSOCIATESPROFILEDEF", SCHEMA_ENTITY, 0, "IFCRELASSOCIATES", "IFCPROFILEDEF" },
+		{ "IFCRELATIONSHIP", SCHEMA_ENTITY, 0, "IFCROOT", "" },
+		{ "IFCRELCONNECTS", SCHEMA_ENTITY, 0, "IFCRELATIONSHIP", "" },
+		{ "IFCRELCONNECTSELEMENTS", SCHEMA_ENTITY, 0, "IFCRELCONNECTS", "IFCCONNECTIONGEOMETRY IFCELEMENT IFCELEMENT" },
+		{ "IFCRELCONNECTSPATHELEMENTS", SCHEMA_ENTITY, 0, "IFCRELCONNECTSELEMENTS", "IFCINTEGER* IFCINTEGER* IFCCONNECTIONTYPEENUM IFCCONNECTIONTYPEENUM" },
+		{ "IFCRELCONNECTSPORTS", SCHEMA_ENTITY, 0, "IFCRELCONNECTS", "IFCPORT IFCPORT IFCELEMENT" },
+		{ "IFCRELCONNECTSPORTTOELEMENT", SCHEMA_ENTITY, 0, "IFCRELCONNECTS", "IFCPORT IFCDISTRIBUTIONELEMENT" },
+		{ "IFCRELCONNECTSSTRUCTURALACTIVITY", SCHEMA_ENTITY, 0, "IFCRELCONNECTS", "IFCSTRUCTURALACTIVITYASSIGNMENTSELECT IFCSTRUCTURALACTIVITY" },
+		{ "IFCRELCONNECTSSTRUCTURALMEMBER", SCHEMA_ENTITY, 0, "IFCRELCONNECTS", "IFCSTRUCTURALMEMBER IFCSTRUCTURALCONNECTION IFCBOUNDARYCONDITION IFCSTRUCTURALCONNECTIONCONDITION IFCLENGTHMEASURE IFCAXIS2PLACEMENT3D" },
+		{ "IFCRELCONNECTSWITHECCENTRICITY", SCHEMA_ENTITY, 0, "IFCRELCONNECTSSTRUCTURALMEMBER", "IFCCONNECTIONGEOMETRY" },
+		{ "IFCRELCONNECTSWITHREALIZINGELEMENTS", SCHEMA_ENTITY, 0, "IFCRELCONNECTSELEMENTS", "IFCELEMENT* IFCLABEL" },
+		{ "IFCRELCONTAINEDINSPATIALSTRUCTURE", SCHEMA_ENTITY, 0, "IFCRELCONNECTS", "IFCPRODUCT* IFCSPATIALELEMENT" },
+		{ "IFCRELCOVERSBLDGELEMENTS", SCHEMA_ENTITY, 0, "IFCRELCONNECTS", "IFCELEMENT IFCCOVERING*" },
+		{ "IFCRELCOVERSSPACES", SCHEMA_ENTITY, 0, "IFCRELCONNECTS", "IFCSPACE IFCCOVERING*" },
+		{ "IFCRELDECLARES", SCHEMA_ENTITY, 0, "IFCRELATIONSHIP", "IFCCONTEXT IFCDEFINITIONSELECT*" },
+		{ "IFCRELDECOMPOSES", SCHEMA_ENTITY, 0, "IFCRELATIONSHIP", "" },
+		{ "IFCRELDEFINES", SCHEMA_ENTITY, 0, "IFCRELATIONSHIP", "" },
+		{ "IFCRELDEFINESBYOBJECT", SCHEMA_ENTITY, 0, "IFCRELDEFINES", "IFCOBJECT* IFCOBJECT" },
+		{ "IFCRELDEFINESBYPROPERTIES", SCHEMA_ENTITY, 0, "IFCRELDEFINES", "IFCOBJECTDEFINITION* IFCPROPERTYSETDEFINITIONSELECT" },
+		{ "IFCRELDEFINESBYTEMPLATE", SCHEMA_ENTITY, 0, "IFCRELDEFINES", "IFCPROPERTYSETDEFINITION* IFCPROPERTYSETTEMPLATE" },
+		{ "IFCRELDEFINESBYTYPE", SCHEMA_ENTITY, 0, "IFCRELDEFINES", "IFCOBJECT* IFCTYPEOBJECT" },
+		{ "IFCRELFILLSELEMENT", SCHEMA_ENTITY, 0, "IFCRELCONNECTS", "IFCOPENINGELEMENT IFCELEMENT" },
+		{ "IFCRELFLOWCONTROLELEMENTS", SCHEMA_ENTITY, 0, "IFCRELCONNECTS", "IFCDISTRIBUTIONCONTROLELEMENT* IFCDISTRIBUTIONFLOWELEMENT" },
+		{ "IFCRELINTERFERESELEMENTS", SCHEMA_ENTITY, 0, "IFCRELCONNECTS", "IFCINTERFERENCESELECT IFCINTERFERENCESELECT IFCCONNECTIONGEOMETRY IFCIDENTIFIER IFCLOGICAL IFCSPATIALZONE" },
+		{ "IFCRELNESTS", SCHEMA_ENTITY, 0, "IFCRELDECOMPOSES", "IFCOBJECTDEFINITION IFCOBJECTDEFINITION*" },
+		{ "IFCRELPOSITIONS", SCHEMA_ENTITY, 0, "IFCRELCONNECTS", "IFCPOSITIONINGELEMENT IFCPRODUCT*" },
+		{ "IFCRELPROJECTSELEMENT", SCHEMA_ENTITY, 0, "IFCRELDECOMPOSES", "IFCELEMENT IFCFEATUREELEMENTADDITION" },
+		{ "IFCRELREFERENCEDINSPATIALSTRUCTURE", SCHEMA_ENTITY, 0, "IFCRELCONNECTS", "IFCSPATIALREFERENCESELECT* IFCSPATIALELEMENT" },
+		{ "IFCRELSEQUENCE", SCHEMA_ENTITY, 0, "IFCRELCONNECTS", "IFCPROCESS IFCPROCESS IFCLAGTIME IFCSEQUENCEENUM IFCLABEL" },
+		{ "IFCRELSERVICESBUILDINGS", SCHEMA_ENTITY, 0, "IFCRELCONNECTS", "IFCSYSTEM IFCSPATIALELEMENT*" },
+		{ "IFCRELSPACEBOUNDARY", SCHEMA_ENTITY, 0, "IFCRELCONNECTS", "IFCSPACEBOUNDARYSELECT IFCELEMENT IFCCONNECTIONGEOMETRY IFCPHYSICALORVIRTUALENUM IFCINTERNALOREXTERNALENUM" },
+		{ "IFCRELSPACEBOUNDARY1STLEVEL", SCHEMA_ENTITY, 0, "IFCRELSPACEBOUNDARY", "IFCRELSPACEBOUNDARY1STLEVEL" },
+		{ "IFCRELSPACEBOUNDARY2NDLEVEL", SCHEMA_ENTITY, 0, "IFCRELSPACEBOUNDARY1STLEVEL", "IFCRELSPACEBOUNDARY2NDLEVEL" },
+		{ "IFCRELVOIDSELEMENT", SCHEMA_ENTITY, 0, "IFCRELDECOMPOSES", "IFCELEMENT IFCFEATUREELEMENTSUBTRACTION" },
+		{ "IFCREPARAMETRISEDCOMPOSITECURVESEGMENT", SCHEMA_ENTITY, 0, "IFCCOMPOSITECURVESEGMENT", "IFCPARAMETERVALUE" },
+		{ "IFCREPRESENTATION", SCHEMA_ENTITY, 0, "IFCLAYEREDITEM", "IFCREPRESENTATIONCONTEXT IFCLABEL IFCLABEL IFCREPRESENTATIONITEM*" },
+		{ "IFCREPRESENTATIONCONTEXT", SCHEMA_ENTITY, 0, "", "IFCLABEL IFCLABEL" },
+		{ "IFCREPRESENTATIONITEM", SCHEMA_ENTITY, 0, "IFCLAYEREDITEM", "" },
+		{ "IFCREPRESENTATIONMAP", SCHEMA_ENTITY, 0, "IFCPRODUCTREPRESENTATIONSELECT", "IFCAXIS2PLACEMENT IFCREPRESENTATION" },
+		{ "IFCRESOURCE", SCHEMA_ENTITY, 0, "IFCRESOURCESELECT IFCOBJECT", "IFCIDENTIFIER IFCTEXT" },
+		{ "IFCRESOURCEAPPROVALRELATIONSHIP", SCHEMA_ENTITY, 0, "IFCRESOURCELEVELRELATIONSHIP", "IFCRESOURCEOBJECTSELECT* IFCAPPROVAL" },
+		{ "IFCRESOURCECONSTRAINTRELATIONSHIP", SCHEMA_ENTITY, 0, "IFCRESOURCELEVELRELATIONSHIP", "IFCCONSTRAINT IFCRESOURCEOBJECTSELECT*" },
+		{ "IFCRESOURCELEVELRELATIONSHIP", SCHEMA_ENTITY, 0, "", "IFCLABEL IFCTEXT" },
+		{ "IFCRESOURCEOBJECTSELECT", SCHEMA_SELECT, 0, "", "" },
+		{ "IFCRESOURCESELECT", SCHEMA_SELECT, 0, "", "" },
+		{ "IFCRESOURCETIME", SCHEMA_ENTITY, 0, "IFCSCHEDULINGTIME", "IFCDURATION IFCPOSITIVERATIOMEASURE IFCDATETIME IFCDATETIME IFCLABEL IFCDURATION IFCBOOLEAN IFCDATETIME IFCDURATION IFCPOSITIVERATIOMEASURE IFCDATETIME IFCDATETIME IFCDURATION IFCPOSITIVERATIOMEASURE IFCPOSITIVERATIOMEASURE" },
+		{ "IFCREVOLVEDAREASOLID", SCHEMA_ENTITY, 0, "IFCSWEPTAREASOLID", "IFCAXIS1PLACEMENT IFCPLANEANGLEMEASURE" },
+		{ "IFCREVOLVEDAREASOLIDTAPERED", SCHEMA_ENTITY, 0, "IFCREVOLVEDAREASOLID", "IFCPROFILEDEF" },
+		{ "IFCRIGHTCIRCULARCONE", SCHEMA_ENTITY, 0, "IFCCSGPRIMITIVE3D", "IFCPOSITIVELENGTHMEASURE IFCPOSITIVELENGTHMEASURE" },
+		{ "IFCRIGHTCIRCULARCYLINDER", SCHEMA_ENTITY, 0, "IFCCSGPRIMITIVE3D", "IFCPOSITIVELENGTHMEASURE IFCPOSITIVELENGTHMEASURE" },
+		{ "IFCRIGIDOPERATION", SCHEMA_ENTITY, 0, "IFCCOORDINATEOPERATION", "IFCMEASUREVALUE IFCMEASUREVALUE IFCLENGTHMEASURE" },
+		{ "IFCROAD", SCHEMA_ENTITY, 0, "IFCFACILITY", "IFCROADTYPEENUM" },
+		{ "IFCROADPART", SCHEMA_ENTITY, 0, "IFCFACILITYPART", "IFCROADPARTTYPEENUM" },
+		{ "IFCROADPARTTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCROADTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCROLEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCROOF", SCHEMA_ENTITY, 0, "IFCBUILTELEMENT", "IFCROOFTYPEENUM" },
+		{ "IFCROOFTYPE", SCHEMA_ENTITY, 0, "IFCBUILTELEMENTTYPE", "IFCROOFTYPEENUM" },
+		{ "IFCROOFTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCROOT", SCHEMA_ENTITY, 0, "", "IFCGLOBALLYUNIQUEID IFCOWNERHISTORY IFCLABEL IFCTEXT" },
+		{ "IFCROTATIONALFREQUENCYMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCROTATIONALMASSMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCROTATIONALSTIFFNESSMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE IFCROTATIONALSTIFFNESSSELECT", "" },
+		{ "IFCROTATIONALSTIFFNESSSELECT", SCHEMA_SELECT, 0, "", "" },
+		{ "IFCROUNDEDRECTANGLEPROFILEDEF", SCHEMA_ENTITY, 0, "IFCRECTANGLEPROFILEDEF", "IFCPOSITIVELENGTHMEASURE" },
+		{ "IFCSANITARYTERMINAL", SCHEMA_ENTITY, 0, "IFCFLOWTERMINAL", "IFCSANITARYTERMINALTYPEENUM" },
+		{ "IFCSANITARYTERMINALTYPE", SCHEMA_ENTITY, 0, "IFCFLOWTERMINALTYPE", "IFCSANITARYTERMINALTYPEENUM" },
+		{ "IFCSANITARYTERMINALTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCSCHEDULINGTIME", SCHEMA_ENTITY, 0, "", "IFCLABEL IFCDATAORIGINENUM IFCLABEL" },
+		{ "IFCSEAMCURVE", SCHEMA_ENTITY, 0, "IFCSURFACECURVE", "" },
+		{ "IFCSECONDORDERPOLYNOMIALSPIRAL", SCHEMA_ENTITY, 0, "IFCSPIRAL", "IFCLENGTHMEASURE IFCLENGTHMEASURE IFCLENGTHMEASURE" },
+		{ "IFCSECTIONALAREAINTEGRALMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCSECTIONEDSOLID", SCHEMA_ENTITY, 0, "IFCSOLIDMODEL", "IFCCURVE IFCPROFILEDEF*" },
+		{ "IFCSECTIONEDSOLIDHORIZONTAL", SCHEMA_ENTITY, 0, "IFCSECTIONEDSOLID", "IFCAXIS2PLACEMENTLINEAR*" },
+		{ "IFCSECTIONEDSPINE", SCHEMA_ENTITY, 0, "IFCGEOMETRICREPRESENTATIONITEM", "IFCCOMPOSITECURVE IFCPROFILEDEF* IFCAXIS2PLACEMENT3D*" },
+		{ "IFCSECTIONEDSURFACE", SCHEMA_ENTITY, 0, "IFCSURFACE", "IFCCURVE IFCAXIS2PLACEMENTLINEAR* IFCPROFILEDEF*" },
+		{ "IFCSECTIONMODULUSMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCSECTIONPROPERTIES", SCHEMA_ENTITY, 0, "IFCPREDEFINEDPROPERTIES", "IFCSECTIONTYPEENUM IFCPROFILEDEF IFCPROFILEDEF" },
+		{ "IFCSECTIONREINFORCEMENTPROPERTIES", SCHEMA_ENTITY, 0, "IFCPREDEFINEDPROPERTIES", "IFCLENGTHMEASURE IFCLENGTHMEASURE IFCLENGTHMEASURE IFCREINFORCINGBARROLEENUM IFCSECTIONPROPERTIES IFCREINFORCEMENTBARPROPERTIES*" },
+		{ "IFCSECTIONTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCSEGMENT", SCHEMA_ENTITY, 0, "IFCGEOMETRICREPRESENTATIONITEM", "IFCTRANSITIONCODE" },
+		{ "IFCSEGMENTEDREFERENCECURVE", SCHEMA_ENTITY, 0, "IFCCOMPOSITECURVE", "IFCBOUNDEDCURVE IFCPLACEMENT" },
+		{ "IFCSEGMENTINDEXSELECT", SCHEMA_SELECT, 0, "", "" },
+		{ "IFCSENSOR", SCHEMA_ENTITY, 0, "IFCDISTRIBUTIONCONTROLELEMENT", "IFCSENSORTYPEENUM" },
+		{ "IFCSENSORTYPE", SCHEMA_ENTITY, 0, "IFCDISTRIBUTIONCONTROLELEMENTTYPE", "IFCSENSORTYPEENUM" },
+		{ "IFCSENSORTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCSEQUENCEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCSEVENTHORDERPOLYNOMIALSPIRAL", SCHEMA_ENTITY, 0, "IFCSPIRAL", "IFCLENGTHMEASURE IFCLENGTHMEASURE IFCLENGTHMEASURE IFCLENGTHMEASURE IFCLENGTHMEASURE IFCLENGTHMEASURE IFCLENGTHMEASURE IFCLENGTHMEASURE" },
+		{ "IFCSHADINGDEVICE", SCHEMA_ENTITY, 0, "IFCBUILTELEMENT", "IFCSHADINGDEVICETYPEENUM" },
+		{ "IFCSHADINGDEVICETYPE", SCHEMA_ENTITY, 0, "IFCBUILTELEMENTTYPE", "IFCSHADINGDEVICETYPEENUM" },
+		{ "IFCSHADINGDEVICETYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCSHAPEASPECT", SCHEMA_ENTITY, 0, "IFCRESOURCEOBJECTSELECT", "IFCSHAPEMODEL* IFCLABEL IFCTEXT IFCLOGICAL IFCPRODUCTREPRESENTATIONSELECT" },
+		{ "IFCSHAPEMODEL", SCHEMA_ENTITY, 0, "IFCREPRESENTATION", "" },
+		{ "IFCSHAPEREPRESENTATION", SCHEMA_ENTITY, 0, "IFCSHAPEMODEL", "" },
+		{ "IFCSHEARMODULUSMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCSHELL", SCHEMA_SELECT, 0, "", "" },
+		{ "IFCSHELLBASEDSURFACEMODEL", SCHEMA_ENTITY, 0, "IFCGEOMETRICREPRESENTATIONITEM", "IFCSHELL*" },
+		{ "IFCSIGN", SCHEMA_ENTITY, 0, "IFCELEMENTCOMPONENT", "IFCSIGNTYPEENUM" },
+		{ "IFCSIGNAL", SCHEMA_ENTITY, 0, "IFCFLOWTERMINAL", "IFCSIGNALTYPEENUM" },
+		{ "IFCSIGNALTYPE", SCHEMA_ENTITY, 0, "IFCFLOWTERMINALTYPE", "IFCSIGNALTYPEENUM" },
+		{ "IFCSIGNALTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCSIGNTYPE", SCHEMA_ENTITY, 0, "IFCELEMENTCOMPONENTTYPE", "IFCSIGNTYPEENUM" },
+		{ "IFCSIGNTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCSIMPLEPROPERTY", SCHEMA_ENTITY, 0, "IFCPROPERTY", "" },
+		{ "IFCSIMPLEPROPERTYTEMPLATE", SCHEMA_ENTITY, 0, "IFCPROPERTYTEMPLATE", "IFCSIMPLEPROPERTYTEMPLATETYPEENUM IFCLABEL IFCLABEL IFCPROPERTYENUMERATION IFCUNIT IFCUNIT IFCLABEL IFCSTATEENUM" },
+		{ "IFCSIMPLEPROPERTYTEMPLATETYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCSIMPLEVALUE", SCHEMA_SELECT, 0, "IFCVALUE", "" },
+		{ "IFCSINESPIRAL", SCHEMA_ENTITY, 0, "IFCSPIRAL", "IFCLENGTHMEASURE IFCLENGTHMEASURE IFCLENGTHMEASURE" },
+		{ "IFCSIPREFIX", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCSITE", SCHEMA_ENTITY, 0, "IFCSPATIALSTRUCTUREELEMENT", "IFCCOMPOUNDPLANEANGLEMEASURE IFCCOMPOUNDPLANEANGLEMEASURE IFCLENGTHMEASURE IFCLABEL IFCPOSTALADDRESS" },
+		{ "IFCSIUNIT", SCHEMA_ENTITY, 0, "IFCNAMEDUNIT", "IFCSIPREFIX IFCSIUNITNAME" },
+		{ "IFCSIUNITNAME", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCSIZESELECT", SCHEMA_SELECT, 0, "", "" },
+		{ "IFCSLAB", SCHEMA_ENTITY, 0, "IFCBUILTELEMENT", "IFCSLABTYPEENUM" },
+		{ "IFCSLABTYPE", SCHEMA_ENTITY, 0, "IFCBUILTELEMENTTYPE", "IFCSLABTYPEENUM" },
+		{ "IFCSLABTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCSLIPPAGECONNECTIONCONDITION", SCHEMA_ENTITY, 0, "IFCSTRUCTURALCONNECTIONCONDITION", "IFCLENGTHMEASURE IFCLENGTHMEASURE IFCLENGTHMEASURE" },
+		{ "IFCSOLARDEVICE", SCHEMA_ENTITY, 0, "IFCENERGYCONVERSIONDEVICE", "IFCSOLARDEVICETYPEENUM" },
+		{ "IFCSOLARDEVICETYPE", SCHEMA_ENTITY, 0, "IFCENERGYCONVERSIONDEVICETYPE", "IFCSOLARDEVICETYPEENUM" },
+		{ "IFCSOLARDEVICETYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCSOLIDANGLEMEASURE", SCHEMA_NUMBER, 0, "IFCMEASUREVALUE", "" },
+		{ "IFCSOLIDMODEL", SCHEMA_ENTITY, 0, "IFCBOOLEANOPERAND IFCSOLIDORSHELL IFCGEOMETRICREPRESENTATIONITEM", "" },
+		{ "IFCSOLIDORSHELL", SCHEMA_SELECT, 0, "", "" },
+		{ "IFCSOUNDPOWERLEVELMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCSOUNDPOWERMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCSOUNDPRESSURELEVELMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCSOUNDPRESSUREMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCSPACE", SCHEMA_ENTITY, 0, "IFCSPACEBOUNDARYSELECT IFCSPATIALSTRUCTUREELEMENT", "IFCSPACETYPEENUM IFCLENGTHMEASURE" },
+		{ "IFCSPACEBOUNDARYSELECT", SCHEMA_SELECT, 0, "", "" },
+		{ "IFCSPACEHEATER", SCHEMA_ENTITY, 0, "IFCFLOWTERMINAL", "IFCSPACEHEATERTYPEENUM" },
+		{ "IFCSPACEHEATERTYPE", SCHEMA_ENTITY, 0, "IFCFLOWTERMINALTYPE", "IFCSPACEHEATERTYPEENUM" },
+		{ "IFCSPACEHEATERTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCSPACETYPE", SCHEMA_ENTITY, 0, "IFCSPATIALSTRUCTUREELEMENTTYPE", "IFCSPACETYPEENUM IFCLABEL" },
+		{ "IFCSPACETYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCSPATIALELEMENT", SCHEMA_ENTITY, 0, "IFCINTERFERENCESELECT IFCPRODUCT", "IFCLABEL" },
+		{ "IFCSPATIALELEMENTTYPE", SCHEMA_ENTITY, 0, "IFCTYPEPRODUCT", "IFCLABEL" },
+		{ "IFCSPATIALREFERENCESELECT", SCHEMA_SELECT, 0, "", "" },
+		{ "IFCSPATIALSTRUCTUREELEMENT", SCHEMA_ENTITY, 0, "IFCSPATIALELEMENT", "IFCELEMENTCOMPOSITIONENUM" },
+		{ "IFCSPATIALSTRUCTUREELEMENTTYPE", SCHEMA_ENTITY, 0, "IFCSPATIALELEMENTTYPE", "" },
+		{ "IFCSPATIALZONE", SCHEMA_ENTITY, 0, "IFCSPATIALELEMENT", "IFCSPATIALZONETYPEENUM" },
+		{ "IFCSPATIALZONETYPE", SCHEMA_ENTITY, 0, "IFCSPATIALELEMENTTYPE", "IFCSPATIALZONETYPEENUM IFCLABEL" },
+		{ "IFCSPATIALZONETYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCSPECIFICHEATCAPACITYMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCSPECULAREXPONENT", SCHEMA_NUMBER, 0, "IFCSPECULARHIGHLIGHTSELECT", "" },
+		{ "IFCSPECULARHIGHLIGHTSELECT", SCHEMA_SELECT, 0, "", "" },
+		{ "IFCSPECULARROUGHNESS", SCHEMA_NUMBER, 0, "IFCSPECULARHIGHLIGHTSELECT", "" },
+		{ "IFCSPHERE", SCHEMA_ENTITY, 0, "IFCCSGPRIMITIVE3D", "IFCPOSITIVELENGTHMEASURE" },
+		{ "IFCSPHERICALSURFACE", SCHEMA_ENTITY, 0, "IFCELEMENTARYSURFACE", "IFCPOSITIVELENGTHMEASURE" },
+		{ "IFCSPIRAL", SCHEMA_ENTITY, 0, "IFCCURVE", "IFCAXIS2PLACEMENT" },
+		{ "IFCSTACKTERMINAL", SCHEMA_ENTITY, 0, "IFCFLOWTERMINAL", "IFCSTACKTERMINALTYPEENUM" },
+		{ "IFCSTACKTERMINALTYPE", SCHEMA_ENTITY, 0, "IFCFLOWTERMINALTYPE", "IFCSTACKTERMINALTYPEENUM" },
+		{ "IFCSTACKTERMINALTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCSTAIR", SCHEMA_ENTITY, 0, "IFCBUILTELEMENT", "IFCSTAIRTYPEENUM" },
+		{ "IFCSTAIRFLIGHT", SCHEMA_ENTITY, 0, "IFCBUILTELEMENT", "IFCINTEGER IFCINTEGER IFCPOSITIVELENGTHMEASURE IFCPOSITIVELENGTHMEASURE IFCSTAIRFLIGHTTYPEENUM" },
+		{ "IFCSTAIRFLIGHTTYPE", SCHEMA_ENTITY, 0, "IFCBUILTELEMENTTYPE", "IFCSTAIRFLIGHTTYPEENUM" },
+		{ "IFCSTAIRFLIGHTTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCSTAIRTYPE", SCHEMA_ENTITY, 0, "IFCBUILTELEMENTTYPE", "IFCSTAIRTYPEENUM" },
+		{ "IFCSTAIRTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCSTATEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCSTRIPPEDOPTIONAL", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCSTRUCTURALACTION", SCHEMA_ENTITY, 0, "IFCSTRUCTURALACTIVITY", "IFCBOOLEAN" },
+		{ "IFCSTRUCTURALACTIVITY", SCHEMA_ENTITY, 0, "IFCPRODUCT", "IFCSTRUCTURALLOAD IFCGLOBALORLOCALENUM" },
+		{ "IFCSTRUCTURALACTIVITYASSIGNMENTSELECT", SCHEMA_SELECT, 0, "", "" },
+		{ "IFCSTRUCTURALANALYSISMODEL", SCHEMA_ENTITY, 0, "IFCSYSTEM", "IFCANALYSISMODELTYPEENUM IFCAXIS2PLACEMENT3D IFCSTRUCTURALLOADGROUP* IFCSTRUCTURALRESULTGROUP* IFCOBJECTPLACEMENT" },
+		{ "IFCSTRUCTURALCONNECTION", SCHEMA_ENTITY, 0, "IFCSTRUCTURALITEM", "IFCBOUNDARYCONDITION" },
+		{ "IFCSTRUCTURALCONNECTIONCONDITION", SCHEMA_ENTITY, 0, "", "IFCLABEL" },
+		{ "IFCSTRUCTURALCURVEACTION", SCHEMA_ENTITY, 0, "IFCSTRUCTURALACTION", "IFCPROJECTEDORTRUELENGTHENUM IFCSTRUCTURALCURVEACTIVITYTYPEENUM" },
+		{ "IFCSTRUCTURALCURVEACTIVITYTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCSTRUCTURALCURVECONNECTION", SCHEMA_ENTITY, 0, "IFCSTRUCTURALCONNECTION", "IFCDIRECTION" },
+		{ "IFCSTRUCTURALCURVEMEMBER", SCHEMA_ENTITY, 0, "IFCSTRUCTURALMEMBER", "IFCSTRUCTURALCURVEMEMBERTYPEENUM IFCDIRECTION" },
+		{ "IFCSTRUCTURALCURVEMEMBERTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCSTRUCTURALCURVEMEMBERVARYING", SCHEMA_ENTITY, 0, "IFCSTRUCTURALCURVEMEMBER", "" },
+		{ "IFCSTRUCTURALCURVEREACTION", SCHEMA_ENTITY, 0, "IFCSTRUCTURALREACTION", "IFCSTRUCTURALCURVEACTIVITYTYPEENUM" },
+		{ "IFCSTRUCTURALITEM", SCHEMA_ENTITY, 0, "IFCSTRUCTURALACTIVITYASSIGNMENTSELECT IFCPRODUCT", "" },
+		{ "IFCSTRUCTURALLINEARACTION", SCHEMA_ENTITY, 0, "IFCSTRUCTURALCURVEACTION", "" },
+		{ "IFCSTRUCTURALLOAD", SCHEMA_ENTITY, 0, "", "IFCLABEL" },
+		{ "IFCSTRUCTURALLOADCASE", SCHEMA_ENTITY, 0, "IFCSTRUCTURALLOADGROUP", "IFCRATIOMEASURE*" },
+		{ "IFCSTRUCTURALLOADCONFIGURATION", SCHEMA_ENTITY, 0, "IFCSTRUCTURALLOAD", "IFCSTRUCTURALLOADORRESULT* IFCLENGTHMEASURE**" },
+		{ "IFCSTRUCTURALLOADGROUP", SCHEMA_ENTITY, 0, "IFCGROUP", "IFCLOADGROUPTYPEENUM IFCACTIONTYPEENUM IFCACTIONSOURCETYPEENUM IFCRATIOMEASURE IFCLABEL" },
+		{ "IFCSTRUCTURALLOADLINEARFORCE", SCHEMA_ENTITY, 0, "IFCSTRUCTURALLOADSTATIC", "IFCLINEARFORCEMEASURE IFCLINEARFORCEMEASURE IFCLINEARFORCEMEASURE IFCLINEARMOMENTMEASURE IFCLINEARMOMENTMEASURE IFCLINEARMOMENTMEASURE" },
+		{ "IFCSTRUCTURALLOADORRESULT", SCHEMA_ENTITY, 0, "IFCSTRUCTURALLOAD", "" },
+		{ "IFCSTRUCTURALLOADPLANARFORCE", SCHEMA_ENTITY, 0, "IFCSTRUCTURALLOADSTATIC", "IFCPLANARFORCEMEASURE IFCPLANARFORCEMEASURE IFCPLANARFORCEMEASURE" },
+		{ "IFCSTRUCTURALLOADSINGLEDISPLACEMENT", SCHEMA_ENTITY, 0, "IFCSTRUCTURALLOADSTATIC", "IFCLENGTHMEASURE IFCLENGTHMEASURE IFCLENGTHMEASURE IFCPLANEANGLEMEASURE IFCPLANEANGLEMEASURE IFCPLANEANGLEMEASURE" },
+		{ "IFCSTRUCTURALLOADSINGLEDISPLACEMENTDISTORTION", SCHEMA_ENTITY, 0, "IFCSTRUCTURALLOADSINGLEDISPLACEMENT", "IFCCURVATUREMEASURE" },
+		{ "IFCSTRUCTURALLOADSINGLEFORCE", SCHEMA_ENTITY, 0, "IFCSTRUCTURALLOADSTATIC", "IFCFORCEMEASURE IFCFORCEMEASURE IFCFORCEMEASURE IFCTORQUEMEASURE IFCTORQUEMEASURE IFCTORQUEMEASURE" },
+		{ "IFCSTRUCTURALLOADSINGLEFORCEWARPING", SCHEMA_ENTITY, 0, "IFCSTRUCTURALLOADSINGLEFORCE", "IFCWARPINGMOMENTMEASURE" },
+		{ "IFCSTRUCTURALLOADSTATIC", SCHEMA_ENTITY, 0, "IFCSTRUCTURALLOADORRESULT", "" },
+		{ "IFCSTRUCTURALLOADTEMPERATURE", SCHEMA_ENTITY, 0, "IFCSTRUCTURALLOADSTATIC", "IFCTHERMODYNAMICTEMPERATUREMEASURE IFCTHERMODYNAMICTEMPERATUREMEASURE IFCTHERMODYNAMICTEMPERATUREMEASURE" },
+		{ "IFCSTRUCTURALMEMBER", SCHEMA_ENTITY, 0, "IFCSTRUCTURALITEM", "" },
+		{ "IFCSTRUCTURALPLANARACTION", SCHEMA_ENTITY, 0, "IFCSTRUCTURALSURFACEACTION", "" },
+		{ "IFCSTRUCTURALPOINTACTION", SCHEMA_ENTITY, 0, "IFCSTRUCTURALACTION", "" },
+		{ "IFCSTRUCTURALPOINTCONNECTION", SCHEMA_ENTITY, 0, "IFCSTRUCTURALCONNECTION", "IFCAXIS2PLACEMENT3D" },
+		{ "IFCSTRUCTURALPOINTREACTION", SCHEMA_ENTITY, 0, "IFCSTRUCTURALREACTION", "" },
+		{ "IFCSTRUCTURALREACTION", SCHEMA_ENTITY, 0, "IFCSTRUCTURALACTIVITY", "" },
+		{ "IFCSTRUCTURALRESULTGROUP", SCHEMA_ENTITY, 0, "IFCGROUP", "IFCANALYSISTHEORYTYPEENUM IFCSTRUCTURALLOADGROUP IFCBOOLEAN" },
+		{ "IFCSTRUCTURALSURFACEACTION", SCHEMA_ENTITY, 0, "IFCSTRUCTURALACTION", "IFCPROJECTEDORTRUELENGTHENUM IFCSTRUCTURALSURFACEACTIVITYTYPEENUM" },
+		{ "IFCSTRUCTURALSURFACEACTIVITYTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCSTRUCTURALSURFACECONNECTION", SCHEMA_ENTITY, 0, "IFCSTRUCTURALCONNECTION", "" },
+		{ "IFCSTRUCTURALSURFACEMEMBER", SCHEMA_ENTITY, 0, "IFCSTRUCTURALMEMBER", "IFCSTRUCTURALSURFACEMEMBERTYPEENUM IFCPOSITIVELENGTHMEASURE" },
+		{ "IFCSTRUCTURALSURFACEMEMBERTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCSTRUCTURALSURFACEMEMBERVARYING", SCHEMA_ENTITY, 0, "IFCSTRUCTURALSURFACEMEMBER", "" },
+		{ "IFCSTRUCTURALSURFACEREACTION", SCHEMA_ENTITY, 0, "IFCSTRUCTURALREACTION", "IFCSTRUCTURALSURFACEACTIVITYTYPEENUM" },
+		{ "IFCSTYLEDITEM", SCHEMA_ENTITY, 0, "IFCREPRESENTATIONITEM", "IFCREPRESENTATIONITEM IFCPRESENTATIONSTYLE* IFCLABEL" },
+		{ "IFCSTYLEDREPRESENTATION", SCHEMA_ENTITY, 0, "IFCSTYLEMODEL", "" },
+		{ "IFCSTYLEMODEL", SCHEMA_ENTITY, 0, "IFCREPRESENTATION", "" },
+		{ "IFCSUBCONTRACTRESOURCE", SCHEMA_ENTITY, 0, "IFCCONSTRUCTIONRESOURCE", "IFCSUBCONTRACTRESOURCETYPEENUM" },
+		{ "IFCSUBCONTRACTRESOURCETYPE", SCHEMA_ENTITY, 0, "IFCCONSTRUCTIONRESOURCETYPE", "IFCSUBCONTRACTRESOURCETYPEENUM" },
+		{ "IFCSUBCONTRACTRESOURCETYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCSUBEDGE", SCHEMA_ENTITY, 0, "IFCEDGE", "IFCEDGE" },
+		{ "IFCSURFACE", SCHEMA_ENTITY, 0, "IFCGEOMETRICSETSELECT IFCSURFACEORFACESURFACE IFCGEOMETRICREPRESENTATIONITEM", "" },
+		{ "IFCSURFACECURVE", SCHEMA_ENTITY, 0, "IFCCURVEONSURFACE IFCCURVE", "IFCCURVE IFCPCURVE* IFCPREFERREDSURFACECURVEREPRESENTATION" },
+		{ "IFCSURFACECURVESWEPTAREASOLID", SCHEMA_ENTITY, 0, "IFCDIRECTRIXCURVESWEPTAREASOLID", "IFCSURFACE" },
+		{ "IFCSURFACEFEATURE", SCHEMA_ENTITY, 0, "IFCFEATUREELEMENT", "IFCSURFACEFEATURETYPEENUM" },
+		{ "IFCSURFACEFEATURETYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCSURFACEOFLINEAREXTRUSION", SCHEMA_ENTITY, 0, "IFCSWEPTSURFACE", "IFCDIRECTION IFCLENGTHMEASURE" },
+		{ "IFCSURFACEOFREVOLUTION", SCHEMA_ENTITY, 0, "IFCSWEPTSURFACE", "IFCAXIS1PLACEMENT" },
+		{ "IFCSURFACEORFACESURFACE", SCHEMA_SELECT, 0, "", "" },
+		{ "IFCSURFACEREINFORCEMENTAREA", SCHEMA_ENTITY, 0, "IFCSTRUCTURALLOADORRESULT", "IFCLENGTHMEASURE* IFCLENGTHMEASURE* IFCRATIOMEASURE" },
+		{ "IFCSURFACESIDE", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCSURFACESTYLE", SCHEMA_ENTITY, 0, "IFCPRESENTATIONSTYLE", "IFCSURFACESIDE IFCSURFACESTYLEELEMENTSELECT*" },
+		{ "IFCSURFACESTYLEELEMENTSELECT", SCHEMA_SELECT, 0, "", "" },
+		{ "IFCSURFACESTYLELIGHTING", SCHEMA_ENTITY, 0, "IFCSURFACESTYLEELEMENTSELECT IFCPRESENTATIONITEM", "IFCCOLOURRGB IFCCOLOURRGB IFCCOLOURRGB IFCCOLOURRGB" },
+		{ "IFCSURFACESTYLEREFRACTION", SCHEMA_ENTITY, 0, "IFCSURFACESTYLEELEMENTSELECT IFCPRESENTATIONITEM", "IFCREAL IFCREAL" },
+		{ "IFCSURFACESTYLERENDERING", SCHEMA_ENTITY, 0, "IFCSURFACESTYLESHADING", "IFCCOLOURORFACTOR IFCCOLOURORFACTOR IFCCOLOURORFACTOR IFCCOLOURORFACTOR IFCCOLOURORFACTOR IFCSPECULARHIGHLIGHTSELECT IFCREFLECTANCEMETHODENUM" },
+		{ "IFCSURFACESTYLESHADING", SCHEMA_ENTITY, 0, "IFCSURFACESTYLEELEMENTSELECT IFCPRESENTATIONITEM", "IFCCOLOURRGB IFCNORMALISEDRATIOMEASURE" },
+		{ "IFCSURFACESTYLEWITHTEXTURES", SCHEMA_ENTITY, 0, "IFCSURFACESTYLEELEMENTSELECT IFCPRESENTATIONITEM", "IFCSURFACETEXTURE*" },
+		{ "IFCSURFACETEXTURE", SCHEMA_ENTITY, 0, "IFCPRESENTATIONITEM", "IFCBOOLEAN IFCBOOLEAN IFCIDENTIFIER IFCCARTESIANTRANSFORMATIONOPERATOR2D IFCIDENTIFIER*" },
+		{ "IFCSWEPTAREASOLID", SCHEMA_ENTITY, 0, "IFCSOLIDMODEL", "IFCPROFILEDEF IFCAXIS2PLACEMENT3D" },
+		{ "IFCSWEPTDISKSOLID", SCHEMA_ENTITY, 0, "IFCSOLIDMODEL", "IFCCURVE IFCPOSITIVELENGTHMEASURE IFCPOSITIVELENGTHMEASURE IFCPARAMETERVALUE IFCPARAMETERVALUE" },
+		{ "IFCSWEPTDISKSOLIDPOLYGONAL", SCHEMA_ENTITY, 0, "IFCSWEPTDISKSOLID", "IFCNONNEGATIVELENGTHMEASURE" },
+		{ "IFCSWEPTSURFACE", SCHEMA_ENTITY, 0, "IFCSURFACE", "IFCPROFILEDEF IFCAXIS2PLACEMENT3D" },
+		{ "IFCSWITCHINGDEVICE", SCHEMA_ENTITY, 0, "IFCFLOWCONTROLLER", "IFCSWITCHINGDEVICETYPEENUM" },
+		{ "IFCSWITCHINGDEVICETYPE", SCHEMA_ENTITY, 0, "IFCFLOWCONTROLLERTYPE", "IFCSWITCHINGDEVICETYPEENUM" },
+		{ "IFCSWITCHINGDEVICETYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCSYSTEM", SCHEMA_ENTITY, 0, "IFCGROUP", "" },
+		{ "IFCSYSTEMFURNITUREELEMENT", SCHEMA_ENTITY, 0, "IFCFURNISHINGELEMENT", "IFCSYSTEMFURNITUREELEMENTTYPEENUM" },
+		{ "IFCSYSTEMFURNITUREELEMENTTYPE", SCHEMA_ENTITY, 0, "IFCFURNISHINGELEMENTTYPE", "IFCSYSTEMFURNITUREELEMENTTYPEENUM" },
+		{ "IFCSYSTEMFURNITUREELEMENTTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCTABLE", SCHEMA_ENTITY, 0, "IFCMETRICVALUESELECT IFCOBJECTREFERENCESELECT", "IFCLABEL IFCTABLEROW* IFCTABLECOLUMN*" },
+		{ "IFCTABLECOLUMN", SCHEMA_ENTITY, 0, "", "IFCIDENTIFIER IFCLABEL IFCTEXT IFCUNIT IFCREFERENCE" },
+		{ "IFCTABLEROW", SCHEMA_ENTITY, 0, "", "IFCVALUE* IFCBOOLEAN" },
+		{ "IFCTANK", SCHEMA_ENTITY, 0, "IFCFLOWSTORAGEDEVICE", "IFCTANKTYPEENUM" },
+		{ "IFCTANKTYPE", SCHEMA_ENTITY, 0, "IFCFLOWSTORAGEDEVICETYPE", "IFCTANKTYPEENUM" },
+		{ "IFCTANKTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCTASK", SCHEMA_ENTITY, 0, "IFCPROCESS", "IFCLABEL IFCLABEL IFCBOOLEAN IFCINTEGER IFCTASKTIME IFCTASKTYPEENUM" },
+		{ "IFCTASKDURATIONENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCTASKTIME", SCHEMA_ENTITY, 0, "IFCSCHEDULINGTIME", "IFCTASKDURATIONENUM IFCDURATION IFCDATETIME IFCDATETIME IFCDATETIME IFCDATETIME IFCDATETIME IFCDATETIME IFCDURATION IFCDURATION IFCBOOLEAN IFCDATETIME IFCDURATION IFCDATETIME IFCDATETIME IFCDURATION IFCPOSITIVERATIOMEASURE" },
+		{ "IFCTASKTIMERECURRING", SCHEMA_ENTITY, 0, "IFCTASKTIME", "IFCRECURRENCEPATTERN" },
+		{ "IFCTASKTYPE", SCHEMA_ENTITY, 0, "IFCTYPEPROCESS", "IFCTASKTYPEENUM IFCLABEL" },
+		{ "IFCTASKTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCTELECOMADDRESS", SCHEMA_ENTITY, 0, "IFCADDRESS", "IFCLABEL* IFCLABEL* IFCLABEL IFCLABEL* IFCURIREFERENCE IFCURIREFERENCE*" },
+		{ "IFCTEMPERATUREGRADIENTMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCTEMPERATURERATEOFCHANGEMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCTENDON", SCHEMA_ENTITY, 0, "IFCREINFORCINGELEMENT", "IFCTENDONTYPEENUM IFCPOSITIVELENGTHMEASURE IFCAREAMEASURE IFCFORCEMEASURE IFCPRESSUREMEASURE IFCNORMALISEDRATIOMEASURE IFCPOSITIVELENGTHMEASURE IFCPOSITIVELENGTHMEASURE" },
+		{ "IFCTENDONANCHOR", SCHEMA_ENTITY, 0, "IFCREINFORCINGELEMENT", "IFCTENDONANCHORTYPEENUM" },
+		{ "IFCTENDONANCHORTYPE", SCHEMA_ENTITY, 0, "IFCREINFORCINGELEMENTTYPE", "IFCTENDONANCHORTYPEENUM" },
+		{ "IFCTENDONANCHORTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCTENDONCONDUIT", SCHEMA_ENTITY, 0, "IFCREINFORCINGELEMENT", "IFCTENDONCONDUITTYPEENUM" },
+		{ "IFCTENDONCONDUITTYPE", SCHEMA_ENTITY, 0, "IFCREINFORCINGELEMENTTYPE", "IFCTENDONCONDUITTYPEENUM" },
+		{ "IFCTENDONCONDUITTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCTENDONTYPE", SCHEMA_ENTITY, 0, "IFCREINFORCINGELEMENTTYPE", "IFCTENDONTYPEENUM IFCPOSITIVELENGTHMEASURE IFCAREAMEASURE IFCPOSITIVELENGTHMEASURE" },
+		{ "IFCTENDONTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCTESSELLATEDFACESET", SCHEMA_ENTITY, 0, "IFCBOOLEANOPERAND IFCTESSELLATEDITEM", "IFCCARTESIANPOINTLIST3D" },
+		{ "IFCTESSELLATEDITEM", SCHEMA_ENTITY, 0, "IFCGEOMETRICREPRESENTATIONITEM", "" },
+		{ "IFCTEXT", SCHEMA_STRING, 0, "IFCSIMPLEVALUE", "" },
+		{ "IFCTEXTALIGNMENT", SCHEMA_STRING, 0, "", "" },
+		{ "IFCTEXTDECORATION", SCHEMA_STRING, 0, "", "" },
+		{ "IFCTEXTFONTNAME", SCHEMA_STRING, 0, "", "" },
+		{ "IFCTEXTFONTSELECT", SCHEMA_SELECT, 0, "", "" },
+		{ "IFCTEXTLITERAL", SCHEMA_ENTITY, 0, "IFCGEOMETRICREPRESENTATIONITEM", "IFCPRESENTABLETEXT IFCAXIS2PLACEMENT IFCTEXTPATH" },
+		{ "IFCTEXTLITERALWITHEXTENT", SCHEMA_ENTITY, 0, "IFCTEXTLITERAL", "IFCPLANAREXTENT IFCBOXALIGNMENT" },
+		{ "IFCTEXTPATH", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCTEXTSTYLE", SCHEMA_ENTITY, 0, "IFCPRESENTATIONSTYLE", "IFCTEXTSTYLEFORDEFINEDFONT IFCTEXTSTYLETEXTMODEL IFCTEXTFONTSELECT IFCBOOLEAN" },
+		{ "IFCTEXTSTYLEFONTMODEL", SCHEMA_ENTITY, 0, "IFCPREDEFINEDTEXTFONT", "IFCTEXTFONTNAME* IFCFONTSTYLE IFCFONTVARIANT IFCFONTWEIGHT IFCSIZESELECT" },
+		{ "IFCTEXTSTYLEFORDEFINEDFONT", SCHEMA_ENTITY, 0, "IFCPRESENTATIONITEM", "IFCCOLOUR IFCCOLOUR" },
+		{ "IFCTEXTSTYLETEXTMODEL", SCHEMA_ENTITY, 0, "IFCPRESENTATIONITEM", "IFCSIZESELECT IFCTEXTALIGNMENT IFCTEXTDECORATION IFCSIZESELECT IFCSIZESELECT IFCTEXTTRANSFORMATION IFCSIZESELECT" },
+		{ "IFCTEXTTRANSFORMATION", SCHEMA_STRING, 0, "", "" },
+		{ "IFCTEXTURECOORDINATE", SCHEMA_ENTITY, 0, "IFCPRESENTATIONITEM", "IFCSURFACETEXTURE*" },
+		{ "IFCTEXTURECOORDINATEGENERATOR", SCHEMA_ENTITY, 0, "IFCTEXTURECOORDINATE", "IFCLABEL IFCREAL*" },
+		{ "IFCTEXTURECOORDINATEINDICES", SCHEMA_ENTITY, 0, "", "IFCPOSITIVEINTEGER* IFCINDEXEDPOLYGONALFACE" },
+		{ "IFCTEXTURECOORDINATEINDICESWITHVOIDS", SCHEMA_ENTITY, 0, "IFCTEXTURECOORDINATEINDICES", "IFCPOSITIVEINTEGER**" },
+		{ "IFCTEXTUREMAP", SCHEMA_ENTITY, 0, "IFCTEXTURECOORDINATE", "IFCTEXTUREVERTEX* IFCFACE" },
+		{ "IFCTEXTUREVERTEX", SCHEMA_ENTITY, 0, "IFCPRESENTATIONITEM", "IFCPARAMETERVALUE*" },
+		{ "IFCTEXTUREVERTEXLIST", SCHEMA_ENTITY, 0, "IFCPRESENTATIONITEM", "IFCPARAMETERVALUE**" },
+		{ "IFCTHERMALADMITTANCEMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCTHERMALCONDUCTIVITYMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCTHERMALEXPANSIONCOEFFICIENTMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCTHERMALRESISTANCEMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCTHERMALTRANSMITTANCEMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCTHERMODYNAMICTEMPERATUREMEASURE", SCHEMA_NUMBER, 0, "IFCMEASUREVALUE", "" },
+		{ "IFCTHIRDORDERPOLYNOMIALSPIRAL", SCHEMA_ENTITY, 0, "IFCSPIRAL", "IFCLENGTHMEASURE IFCLENGTHMEASURE IFCLENGTHMEASURE IFCLENGTHMEASURE" },
+		{ "IFCTIME", SCHEMA_STRING, 0, "IFCSIMPLEVALUE", "" },
+		{ "IFCTIMEMEASURE", SCHEMA_NUMBER, 0, "IFCMEASUREVALUE", "" },
+		{ "IFCTIMEORRATIOSELECT", SCHEMA_SELECT, 0, "", "" },
+		{ "IFCTIMEPERIOD", SCHEMA_ENTITY, 0, "", "IFCTIME IFCTIME" },
+		{ "IFCTIMESERIES", SCHEMA_ENTITY, 0, "IFCMETRICVALUESELECT IFCOBJECTREFERENCESELECT IFCRESOURCEOBJECTSELECT", "IFCLABEL IFCTEXT IFCDATETIME IFCDATETIME IFCTIMESERIESDATATYPEENUM IFCDATAORIGINENUM IFCLABEL IFCUNIT" },
+		{ "IFCTIMESERIESDATATYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCTIMESERIESVALUE", SCHEMA_ENTITY, 0, "", "IFCVALUE*" },
+		{ "IFCTIMESTAMP", SCHEMA_NUMBER, 0, "IFCSIMPLEVALUE", "" },
+		{ "IFCTOPOLOGICALREPRESENTATIONITEM", SCHEMA_ENTITY, 0, "IFCREPRESENTATIONITEM", "" },
+		{ "IFCTOPOLOGYREPRESENTATION", SCHEMA_ENTITY, 0, "IFCSHAPEMODEL", "" },
+		{ "IFCTOROIDALSURFACE", SCHEMA_ENTITY, 0, "IFCELEMENTARYSURFACE", "IFCPOSITIVELENGTHMEASURE IFCPOSITIVELENGTHMEASURE" },
+		{ "IFCTORQUEMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCTRACKELEMENT", SCHEMA_ENTITY, 0, "IFCBUILTELEMENT", "IFCTRACKELEMENTTYPEENUM" },
+		{ "IFCTRACKELEMENTTYPE", SCHEMA_ENTITY, 0, "IFCBUILTELEMENTTYPE", "IFCTRACKELEMENTTYPEENUM" },
+		{ "IFCTRACKELEMENTTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCTRANSFORMER", SCHEMA_ENTITY, 0, "IFCENERGYCONVERSIONDEVICE", "IFCTRANSFORMERTYPEENUM" },
+		{ "IFCTRANSFORMERTYPE", SCHEMA_ENTITY, 0, "IFCENERGYCONVERSIONDEVICETYPE", "IFCTRANSFORMERTYPEENUM" },
+		{ "IFCTRANSFORMERTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCTRANSITIONCODE", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCTRANSLATIONALSTIFFNESSSELECT", SCHEMA_SELECT, 0, "", "" },
+		{ "IFCTRANSPORTATIONDEVICE", SCHEMA_ENTITY, 0, "IFCELEMENT", "" },
+		{ "IFCTRANSPORTATIONDEVICETYPE", SCHEMA_ENTITY, 0, "IFCELEMENTTYPE", "" },
+		{ "IFCTRANSPORTELEMENT", SCHEMA_ENTITY, 0, "IFCTRANSPORTATIONDEVICE", "IFCTRANSPORTELEMENTTYPEENUM" },
+		{ "IFCTRANSPORTELEMENTTYPE", SCHEMA_ENTITY, 0, "IFCTRANSPORTATIONDEVICETYPE", "IFCTRANSPORTELEMENTTYPEENUM" },
+		{ "IFCTRANSPORTELEMENTTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCTRAPEZIUMPROFILEDEF", SCHEMA_ENTITY, 0, "IFCPARAMETERIZEDPROFILEDEF", "IFCPOSITIVELENGTHMEASURE IFCPOSITIVELENGTHMEASURE IFCPOSITIVELENGTHMEASURE IFCLENGTHMEASURE" },
+		{ "IFCTRIANGULATEDFACESET", SCHEMA_ENTITY, 0, "IFCTESSELLATEDFACESET", "IFCPARAMETERVALUE** IFCBOOLEAN IFCPOSITIVEINTEGER** IFCPOSITIVEINTEGER*" },
+		{ "IFCTRIANGULATEDIRREGULARNETWORK", SCHEMA_ENTITY, 0, "IFCTRIANGULATEDFACESET", "IFCINTEGER*" },
+		{ "IFCTRIMMEDCURVE", SCHEMA_ENTITY, 0, "IFCBOUNDEDCURVE", "IFCCURVE IFCTRIMMINGSELECT* IFCTRIMMINGSELECT* IFCBOOLEAN IFCTRIMMINGPREFERENCE" },
+		{ "IFCTRIMMINGPREFERENCE", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCTRIMMINGSELECT", SCHEMA_SELECT, 0, "", "" },
+		{ "IFCTSHAPEPROFILEDEF", SCHEMA_ENTITY, 0, "IFCPARAMETERIZEDPROFILEDEF", "IFCPOSITIVELENGTHMEASURE IFCPOSITIVELENGTHMEASURE IFCPOSITIVELENGTHMEASURE IFCPOSITIVELENGTHMEASURE IFCNONNEGATIVELENGTHMEASURE IFCNONNEGATIVELENGTHMEASURE IFCNONNEGATIVELENGTHMEASURE IFCPLANEANGLEMEASURE IFCPLANEANGLEMEASURE" },
+		{ "IFCTUBEBUNDLE", SCHEMA_ENTITY, 0, "IFCENERGYCONVERSIONDEVICE", "IFCTUBEBUNDLETYPEENUM" },
+		{ "IFCTUBEBUNDLETYPE", SCHEMA_ENTITY, 0, "IFCENERGYCONVERSIONDEVICETYPE", "IFCTUBEBUNDLETYPEENUM" },
+		{ "IFCTUBEBUNDLETYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCTYPEOBJECT", SCHEMA_ENTITY, 0, "IFCOBJECTDEFINITION", "IFCIDENTIFIER IFCPROPERTYSETDEFINITION*" },
+		{ "IFCTYPEPROCESS", SCHEMA_ENTITY, 0, "IFCPROCESSSELECT IFCTYPEOBJECT", "IFCIDENTIFIER IFCTEXT IFCLABEL" },
+		{ "IFCTYPEPRODUCT", SCHEMA_ENTITY, 0, "IFCPRODUCTSELECT IFCTYPEOBJECT", "IFCREPRESENTATIONMAP* IFCLABEL" },
+		{ "IFCTYPERESOURCE", SCHEMA_ENTITY, 0, "IFCRESOURCESELECT IFCTYPEOBJECT", "IFCIDENTIFIER IFCTEXT IFCLABEL" },
+		{ "IFCUNIT", SCHEMA_SELECT, 0, "", "" },
+		{ "IFCUNITARYCONTROLELEMENT", SCHEMA_ENTITY, 0, "IFCDISTRIBUTIONCONTROLELEMENT", "IFCUNITARYCONTROLELEMENTTYPEENUM" },
+		{ "IFCUNITARYCONTROLELEMENTTYPE", SCHEMA_ENTITY, 0, "IFCDISTRIBUTIONCONTROLELEMENTTYPE", "IFCUNITARYCONTROLELEMENTTYPEENUM" },
+		{ "IFCUNITARYCONTROLELEMENTTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCUNITARYEQUIPMENT", SCHEMA_ENTITY, 0, "IFCENERGYCONVERSIONDEVICE", "IFCUNITARYEQUIPMENTTYPEENUM" },
+		{ "IFCUNITARYEQUIPMENTTYPE", SCHEMA_ENTITY, 0, "IFCENERGYCONVERSIONDEVICETYPE", "IFCUNITARYEQUIPMENTTYPEENUM" },
+		{ "IFCUNITARYEQUIPMENTTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCUNITASSIGNMENT", SCHEMA_ENTITY, 0, "", "IFCUNIT*" },
+		{ "IFCUNITENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCURIREFERENCE", SCHEMA_STRING, 0, "IFCSIMPLEVALUE", "" },
+		{ "IFCUSHAPEPROFILEDEF", SCHEMA_ENTITY, 0, "IFCPARAMETERIZEDPROFILEDEF", "IFCPOSITIVELENGTHMEASURE IFCPOSITIVELENGTHMEASURE IFCPOSITIVELENGTHMEASURE IFCPOSITIVELENGTHMEASURE IFCNONNEGATIVELENGTHMEASURE IFCNONNEGATIVELENGTHMEASURE IFCPLANEANGLEMEASURE" },
+		{ "IFCVALUE", SCHEMA_SELECT, 0, "IFCAPPLIEDVALUESELECT IFCMETRICVALUESELECT", "" },
+		{ "IFCVALVE", SCHEMA_ENTITY, 0, "IFCFLOWCONTROLLER", "IFCVALVETYPEENUM" },
+		{ "IFCVALVETYPE", SCHEMA_ENTITY, 0, "IFCFLOWCONTROLLERTYPE", "IFCVALVETYPEENUM" },
+		{ "IFCVALVETYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCVAPORPERMEABILITYMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCVECTOR", SCHEMA_ENTITY, 0, "IFCHATCHLINEDISTANCESELECT IFCVECTORORDIRECTION IFCGEOMETRICREPRESENTATIONITEM", "IFCDIRECTION IFCLENGTHMEASURE" },
+		{ "IFCVECTORORDIRECTION", SCHEMA_SELECT, 0, "", "" },
+		{ "IFCVEHICLE", SCHEMA_ENTITY, 0, "IFCTRANSPORTATIONDEVICE", "IFCVEHICLETYPEENUM" },
+		{ "IFCVEHICLETYPE", SCHEMA_ENTITY, 0, "IFCTRANSPORTATIONDEVICETYPE", "IFCVEHICLETYPEENUM" },
+		{ "IFCVEHICLETYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCVERTEX", SCHEMA_ENTITY, 0, "IFCTOPOLOGICALREPRESENTATIONITEM", "" },
+		{ "IFCVERTEXLOOP", SCHEMA_ENTITY, 0, "IFCLOOP", "IFCVERTEX" },
+		{ "IFCVERTEXPOINT", SCHEMA_ENTITY, 0, "IFCPOINTORVERTEXPOINT IFCVERTEX", "IFCPOINT" },
+		{ "IFCVIBRATIONDAMPER", SCHEMA_ENTITY, 0, "IFCELEMENTCOMPONENT", "IFCVIBRATIONDAMPERTYPEENUM" },
+		{ "IFCVIBRATIONDAMPERTYPE", SCHEMA_ENTITY, 0, "IFCELEMENTCOMPONENTTYPE", "IFCVIBRATIONDAMPERTYPEENUM" },
+		{ "IFCVIBRATIONDAMPERTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCVIBRATIONISOLATOR", SCHEMA_ENTITY, 0, "IFCELEMENTCOMPONENT", "IFCVIBRATIONISOLATORTYPEENUM" },
+		{ "IFCVIBRATIONISOLATORTYPE", SCHEMA_ENTITY, 0, "IFCELEMENTCOMPONENTTYPE", "IFCVIBRATIONISOLATORTYPEENUM" },
+		{ "IFCVIBRATIONISOLATORTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCVIRTUALELEMENT", SCHEMA_ENTITY, 0, "IFCELEMENT", "IFCVIRTUALELEMENTTYPEENUM" },
+		{ "IFCVIRTUALELEMENTTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCVIRTUALGRIDINTERSECTION", SCHEMA_ENTITY, 0, "IFCGRIDPLACEMENTDIRECTIONSELECT", "IFCGRIDAXIS* IFCLENGTHMEASURE*" },
+		{ "IFCVOIDINGFEATURE", SCHEMA_ENTITY, 0, "IFCFEATUREELEMENTSUBTRACTION", "IFCVOIDINGFEATURETYPEENUM" },
+		{ "IFCVOIDINGFEATURETYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCVOLUMEMEASURE", SCHEMA_NUMBER, 0, "IFCMEASUREVALUE", "" },
+		{ "IFCVOLUMETRICFLOWRATEMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCWALL", SCHEMA_ENTITY, 0, "IFCBUILTELEMENT", "IFCWALLTYPEENUM" },
+		{ "IFCWALLSTANDARDCASE", SCHEMA_ENTITY, 0, "IFCWALL", "" },
+		{ "IFCWALLTYPE", SCHEMA_ENTITY, 0, "IFCBUILTELEMENTTYPE", "IFCWALLTYPEENUM" },
+		{ "IFCWALLTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCWARPINGCONSTANTMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE", "" },
+		{ "IFCWARPINGMOMENTMEASURE", SCHEMA_NUMBER, 0, "IFCDERIVEDMEASUREVALUE IFCWARPINGSTIFFNESSSELECT", "" },
+		{ "IFCWARPINGSTIFFNESSSELECT", SCHEMA_SELECT, 0, "", "" },
+		{ "IFCWASTETERMINAL", SCHEMA_ENTITY, 0, "IFCFLOWTERMINAL", "IFCWASTETERMINALTYPEENUM" },
+		{ "IFCWASTETERMINALTYPE", SCHEMA_ENTITY, 0, "IFCFLOWTERMINALTYPE", "IFCWASTETERMINALTYPEENUM" },
+		{ "IFCWASTETERMINALTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCWELLKNOWNTEXT", SCHEMA_ENTITY, 0, "", "IFCWELLKNOWNTEXTLITERAL IFCCOORDINATEREFERENCESYSTEM" },
+		{ "IFCWELLKNOWNTEXTLITERAL", SCHEMA_STRING, 0, "", "" },
+		{ "IFCWINDOW", SCHEMA_ENTITY, 0, "IFCBUILTELEMENT", "IFCPOSITIVELENGTHMEASURE IFCPOSITIVELENGTHMEASURE IFCWINDOWTYPEENUM IFCWINDOWTYPEPARTITIONINGENUM IFCLABEL" },
+		{ "IFCWINDOWLININGPROPERTIES", SCHEMA_ENTITY, 0, "IFCPREDEFINEDPROPERTYSET", "IFCPOSITIVELENGTHMEASURE IFCNONNEGATIVELENGTHMEASURE IFCNONNEGATIVELENGTHMEASURE IFCNONNEGATIVELENGTHMEASURE IFCNORMALISEDRATIOMEASURE IFCNORMALISEDRATIOMEASURE IFCNORMALISEDRATIOMEASURE IFCNORMALISEDRATIOMEASURE IFCSHAPEASPECT IFCLENGTHMEASURE IFCLENGTHMEASURE IFCLENGTHMEASURE" },
+		{ "IFCWINDOWPANELOPERATIONENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCWINDOWPANELPOSITIONENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCWINDOWPANELPROPERTIES", SCHEMA_ENTITY, 0, "IFCPREDEFINEDPROPERTYSET", "IFCWINDOWPANELOPERATIONENUM IFCWINDOWPANELPOSITIONENUM IFCPOSITIVELENGTHMEASURE IFCPOSITIVELENGTHMEASURE IFCSHAPEASPECT" },
+		{ "IFCWINDOWSTYLE", SCHEMA_ENTITY, 0, "IFCTYPEPRODUCT", "IFCWINDOWSTYLECONSTRUCTIONENUM IFCWINDOWSTYLEOPERATIONENUM IFCBOOLEAN IFCBOOLEAN" },
+		{ "IFCWINDOWSTYLECONSTRUCTIONENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCWINDOWSTYLEOPERATIONENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCWINDOWTYPE", SCHEMA_ENTITY, 0, "IFCBUILTELEMENTTYPE", "IFCWINDOWTYPEENUM IFCWINDOWTYPEPARTITIONINGENUM IFCBOOLEAN IFCLABEL" },
+		{ "IFCWINDOWTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCWINDOWTYPEPARTITIONINGENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCWORKCALENDAR", SCHEMA_ENTITY, 0, "IFCCONTROL", "IFCWORKTIME* IFCWORKTIME* IFCWORKCALENDARTYPEENUM" },
+		{ "IFCWORKCALENDARTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCWORKCONTROL", SCHEMA_ENTITY, 0, "IFCCONTROL", "IFCDATETIME IFCPERSON* IFCLABEL IFCDURATION IFCDURATION IFCDATETIME IFCDATETIME" },
+		{ "IFCWORKPLAN", SCHEMA_ENTITY, 0, "IFCWORKCONTROL", "IFCWORKPLANTYPEENUM" },
+		{ "IFCWORKPLANTYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCWORKSCHEDULE", SCHEMA_ENTITY, 0, "IFCWORKCONTROL", "IFCWORKSCHEDULETYPEENUM" },
+		{ "IFCWORKSCHEDULETYPEENUM", SCHEMA_ENUM, 0, "", "" },
+		{ "IFCWORKTIME", SCHEMA_ENTITY, 0, "IFCSCHEDULINGTIME", "IFCRECURRENCEPATTERN IFCDATE IFCDATE" },
+		{ "IFCZONE", SCHEMA_ENTITY, 0, "IFCSYSTEM", "IFCLABEL" },
+		{ "IFCZSHAPEPROFILEDEF", SCHEMA_ENTITY, 0, "IFCPARAMETERIZEDPROFILEDEF", "IFCPOSITIVELENGTHMEASURE IFCPOSITIVELENGTHMEASURE IFCPOSITIVELENGTHMEASURE IFCPOSITIVELENGTHMEASURE IFCNONNEGATIVELENGTHMEASURE IFCNONNEGATIVELENGTHMEASURE" },
+		{ "INTEGER", SCHEMA_NUMBER, 0, "", "" },
+		{ "REAL", SCHEMA_NUMBER, 0, "", "" },
+	};
+
+	template<typename F>
+	void forEachToken( const char* str, F f )
+	{
+		while( *str )
+		{
+			while( *str == ' ' ) { ++str; }
+			const char* begin = str;
+			while( *str && *str != ' ' ) { ++str; }
+			if( str > begin )
+			{
+				f( begin, size_t( str - begin ) );
+			}
+		}
+	}
+
+	bool isEntityClass( const SchemaType* type )
+	{
+		return type && type->kind == SCHEMA_ENTITY && type->list_depth == 0;
+	}
+
+	class SchemaTable
+	{
+	public:
+		SchemaTable()
+		{
+			std::unordered_map<std::string, const SchemaTableEntry*> entries;
+			for( const SchemaTableEntry& entry : SCHEMA_TABLE )
+			{
+				SchemaType& type = m_types[entry.name_upper];
+				type.name_upper = entry.name_upper;
+				type.kind = entry.kind;
+				type.list_depth = entry.list_depth;
+				entries[entry.name_upper] = &entry;
+			}
+
+			for( const SchemaTableEntry& entry : SCHEMA_TABLE )
+			{
+				SchemaType& type = m_types[entry.name_upper];
+				forEachToken( entry.supertypes, [&]( const char* name, size_t length ) {
+						const SchemaType* supertype = find( std::string( name, length ) );
+						if( supertype )
+						{
+							type.supertypes.push_back( supertype );
+						}
+					} );
+			}
+
+			std::unordered_set<const SchemaType*> done;
+			for( auto& it : m_types )
+			{
+				if( isEntityClass( &it.second ) )
+				{
+					addAttributes( it.second, entries, done );
+				}
+			}
+		}
+
+		const SchemaType* find( const std::string& name_upper ) const
+		{
+			auto it = m_types.find( name_upper );
+			return it == m_types.end() ? nullptr : &it->second;
+		}
+
+	private:
+		/// inherited attributes first, like in getAttributes
+		void addAttributes( SchemaType& type, const std::unordered_map<std::string, const SchemaTableEntry*>& entries, std::unordered_set<const SchemaType*>& done )
+		{
+			if( !done.insert( &type ).second )
+			{
+				return;
+			}
+
+			for( const SchemaType* supertype : type.supertypes )
+			{
+				if( isEntityClass( supertype ) )
+				{
+					SchemaType& entity_supertype = m_types[supertype->name_upper];
+					addAttributes( entity_supertype, entries, done );
+					type.attributes = entity_supertype.attributes;
+					break;
+				}
+			}
+
+			forEachToken( entries.at( type.name_upper )->attributes, [&]( const char* name, size_t length ) {
+					SchemaAttribute attribute;
+					while( length > 0 && name[length - 1] == '*' )
+					{
+						++attribute.list_depth;
+						--length;
+					}
+					attribute.type = find( std::string( name, length ) );
+					type.attributes.push_back( attribute );
+				} );
+		}
+
+		std::unordered_map<std::string, SchemaType> m_types;
+	};
+
+	const SchemaTable& getSchemaTable()
+	{
+		static const SchemaTable table;
+		return table;
+	}
+}
+
+const SchemaType* SchemaInfo::getType( const std::string& name_upper )
+{
+	return getSchemaTable().find( name_upper );
+}
+
+bool SchemaInfo::isAssignable( const SchemaType* value_type, const SchemaType* declared_type )
+{
+	if( !value_type || !declared_type )
+	{
+		return false;
+	}
+	if( value_type == declared_type )
+	{
+		return true;
+	}
+	for( const SchemaType* supertype : value_type->supertypes )
+	{
+		if( isAssignable( supertype, declared_type ) )
+		{
+			return true;
+		}
+	}
+	return false;
+}
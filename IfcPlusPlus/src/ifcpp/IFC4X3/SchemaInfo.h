@@ -0,0 +1,67 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "ifcpp/model/GlobalDefines.h"
+
+namespace IFC4X3
+{
+	/// How the values of a type are written in STEP
+	enum SchemaTypeKind : uint8_t
+	{
+		SCHEMA_ENTITY,		// entity classes, and defined types that are lists of entity references: #12
+		SCHEMA_SELECT,		// the value is written with its type: IFCLABEL('text')
+		SCHEMA_STRING,		// 'text'
+		SCHEMA_ENUM,		// enumerations, BOOLEAN and LOGICAL: .NOTDEFINED. .T.
+		SCHEMA_NUMBER,		// 2.5
+		SCHEMA_BINARY		// "0F"
+	};
+
+	struct SchemaType;
+
+	struct SchemaAttribute
+	{
+		const SchemaType* type = nullptr;	// declared type, for example IFCLABEL, or REAL and INTEGER for the few attributes of built-in types
+		uint8_t list_depth = 0;				// LIST or SET levels of the attribute itself, without those of a list type like IfcLineIndex
+	};
+
+	struct SchemaType
+	{
+		std::string name_upper;
+		SchemaTypeKind kind = SCHEMA_ENTITY;
+		uint8_t list_depth = 0;						// LIST or SET levels of a defined type, for example 1 for IfcLineIndex
+		std::vector<const SchemaType*> supertypes;	// direct entity supertype, the type a defined type is based on, and the select types that contain the type
+		std::vector<SchemaAttribute> attributes;	// entities: all attributes, including the inherited ones, in the order of getAttributes and readStepArguments
+	};
+
+	///@brief Declared types of the attributes of the generated classes, and the kind of each type
+	///@details The table is taken from the member declarations and the EXPRESS comments of the headers in include/, so it has to be updated together with the
+	///generated classes. It is built on first use and read only afterwards, so it can be used from several threads.
+	class IFCQUERY_EXPORT SchemaInfo
+	{
+	public:
+		///@returns the entity class or type, for example IFCWALL or IFCLABEL. nullptr if it is not in the schema
+		static const SchemaType* getType( const std::string& name_upper );
+
+		///@returns true if a value of type value_type can be assigned to an attribute of the declared type: same type, subtype, or member of a select type
+		static bool isAssignable( const SchemaType* value_type, const SchemaType* declared_type );
+	};
+}
@@ -21,6 +21,6 @@ namespace IFC4X3
 		virtual uint32_t classID() const { return 2801250643; }
 		virtual void getStepParameter( std::stringstream& stream, bool is_select_type, size_t precision ) const;
 		static shared_ptr<IfcText> createObjectFromSTEP( const std::string& arg, const BuildingModelMapType<int,shared_ptr<BuildingEntity> >& map, std::stringstream& errorStream, std::unordered_set<int>& entityIdNotFound );
-		std::string m_value;
+		SharedString m_value;
 	};
 }
@@ -0,0 +1,875 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#define _USE_MATH_DEFINES
+#include <algorithm>
+#include <cmath>
+#include <IfcAxis2Placement2D.h>
+#include <IfcAxis2Placement3D.h>
+#include <IfcAxis2PlacementLinear.h>
+#include <IfcCartesianPoint.h>
+#include <IfcCircle.h>
+#include <IfcClothoid.h>
+#include <IfcCompositeCurve.h>
+#include <IfcCosineSpiral.h>
+#include <IfcDirection.h>
+#include <IfcGradientCurve.h>
+#include <IfcLengthMeasure.h>
+#include <IfcLine.h>
+#include <IfcParameterValue.h>
+#include <IfcPointByDistanceExpression.h>
+#include <IfcPolynomialCurve.h>
+#include <IfcPositiveLengthMeasure.h>
+#include <IfcReal.h>
+#include <IfcSecondOrderPolynomialSpiral.h>
+#include <IfcSegmentedReferenceCurve.h>
+#include <IfcSeventhOrderPolynomialSpiral.h>
+#include <IfcSineSpiral.h>
+#include <IfcThirdOrderPolynomialSpiral.h>
+#include <IfcVector.h>
+#include "AlignmentConverter.h"
+
+using namespace IFC4X3;
+
+namespace
+{
+	// 8 point Gauss-Legendre rule on [-1,1], exact for polynomials up to degree 15
+	const double s_gaussNodes[8] = { -0.9602898564975363, -0.7966664774136267, -0.5255324099163290, -0.1834346424956498,
+		0.1834346424956498, 0.5255324099163290, 0.7966664774136267, 0.9602898564975363 };
+	const double s_gaussWeights[8] = { 0.1012285362903763, 0.2223810344533745, 0.3137066458778873, 0.3626837833783620,
+		0.3626837833783620, 0.3137066458778873, 0.2223810344533745, 0.1012285362903763 };
+
+	template<typename T, typename F>
+	T integrateGauss( const F& f, double a, double b )
+	{
+		const double half = 0.5 * ( b - a );
+		const double mid = 0.5 * ( a + b );
+		T result = f( mid + half * s_gaussNodes[0] ) * s_gaussWeights[0];
+		for( size_t ii = 1; ii < 8; ++ii )
+		{
+			result = result + f( mid + half * s_gaussNodes[ii] ) * s_gaussWeights[ii];
+		}
+		return result * half;
+	}
+
+	double magnitude( double value ) { return std::abs( value ); }
+	double magnitude( const vec2& value ) { return value.length(); }
+
+	//\brief Adaptive Gauss-Legendre integration, bisects until both halves agree with the whole interval
+	template<typename T, typename F>
+	T integrateAdaptive( const F& f, double a, double b, double tolerance, int depth = 0 )
+	{
+		const double mid = 0.5 * ( a + b );
+		const T whole = integrateGauss<T>( f, a, b );
+		const T left = integrateGauss<T>( f, a, mid );
+		const T right = integrateGauss<T>( f, mid, b );
+		const T sum = left + right;
+		if( depth > 30 || magnitude( sum - whole ) < tolerance )
+		{
+			return sum;
+		}
+		return integrateAdaptive<T>( f, a, mid, 0.5 * tolerance, depth + 1 ) + integrateAdaptive<T>( f, mid, b, 0.5 * tolerance, depth + 1 );
+	}
+
+	inline vec2 rotate( const vec2& v, double cosAngle, double sinAngle )
+	{
+		return carve::geom::VECTOR( v.x * cosAngle - v.y * sinAngle, v.x * sinAngle + v.y * cosAngle );
+	}
+
+	// integrals are computed to 1e-10 m, well below the sub-millimetre accuracy that stationing needs
+	const double s_integrationTolerance = 1e-10;
+}
+
+void AlignmentCurve::Segment::init()
+{
+	vec2 startPoint;
+	double startAngle = 0;
+	m_knot_step = 0;
+	m_knot_points.clear();
+	m_knot_parameters.clear();
+	m_parent_start_point = carve::geom::VECTOR( 0.0, 0.0 );
+	m_parent_start_angle = 0;
+
+	if( m_type == PARENT_SPIRAL )
+	{
+		// the start point needs the integral from the spiral origin, the knots inside the segment are relative to it
+		startPoint = integrateAdaptive<vec2>( [&]( double t ) { const double theta = getTheta( t ); return carve::geom::VECTOR( std::cos( theta ), std::sin( theta ) ); },
+			0.0, m_parent_start, s_integrationTolerance );
+		startAngle = getTheta( m_parent_start );
+	}
+	else
+	{
+		evaluateParent( m_parent_start, startPoint, startAngle );
+	}
+
+	m_parent_start_point = startPoint;
+	m_parent_start_angle = m_direction < 0 ? startAngle + M_PI : startAngle;
+
+	if( m_type != PARENT_SPIRAL && m_type != PARENT_POLYNOMIAL )
+	{
+		return;
+	}
+
+	// knots at most 2 m and about 0.1 rad of turning apart, so that the integration from the nearest knot is short
+	double maxCurvature = 0;
+	for( size_t ii = 0; ii <= 16; ++ii )
+	{
+		maxCurvature = std::max( maxCurvature, std::abs( getCurvature( m_length * double( ii ) / 16.0 ) ) );
+	}
+	double numKnotIntervals = std::ceil( std::max( m_length / 2.0, maxCurvature * m_length / 0.1 ) );
+	numKnotIntervals = std::min( std::max( numKnotIntervals, 1.0 ), 100000.0 );
+	m_knot_step = m_length / numKnotIntervals;
+	const size_t numKnots = size_t( numKnotIntervals ) + 1;
+	m_knot_points.reserve( numKnots );
+	m_knot_points.push_back( carve::geom::VECTOR( 0.0, 0.0 ) );
+
+	if( m_type == PARENT_SPIRAL )
+	{
+		for( size_t ii = 1; ii < numKnots; ++ii )
+		{
+			const double t0 = m_parent_start + m_direction * m_knot_step * double( ii - 1 );
+			const double t1 = m_parent_start + m_direction * m_knot_step * double( ii );
+			m_knot_points.push_back( m_knot_points.back() + toSegment( integrateParent( t0, t1 ) ) );
+		}
+	}
+	else
+	{
+		m_knot_parameters.reserve( numKnots );
+		m_knot_parameters.push_back( m_parent_start );
+		for( size_t ii = 1; ii < numKnots; ++ii )
+		{
+			const double u = findPolynomialParameter( m_knot_parameters.back(), m_direction * m_knot_step );
+			m_knot_parameters.push_back( u );
+			m_knot_points.push_back( toSegment( integrateParent( m_parent_start, u ) ) );
+		}
+	}
+}
+
+double AlignmentCurve::Segment::getTheta( double t ) const
+{
+	double theta = 0;
+	double power = t;
+	for( size_t ii = 0; ii < 8; ++ii )
+	{
+		theta += m_theta_poly[ii] * power;
+		power *= t;
+	}
+	if( m_trig_length > 0 )
+	{
+		theta += m_theta_cos * std::sin( M_PI * t / m_trig_length );
+		theta += m_theta_sin * ( 1.0 - std::cos( 2.0 * M_PI * t / m_trig_length ) );
+	}
+	return theta;
+}
+
+void AlignmentCurve::Segment::getPolynomialDerivative( double u, vec2& derivative ) const
+{
+	derivative = carve::geom::VECTOR( 0.0, 0.0 );
+	double power = 1.0;
+	for( size_t ii = 1; ii < m_coefficients_x.size(); ++ii )
+	{
+		derivative.x += double( ii ) * m_coefficients_x[ii] * power;
+		power *= u;
+	}
+	power = 1.0;
+	for( size_t ii = 1; ii < m_coefficients_y.size(); ++ii )
+	{
+		derivative.y += double( ii ) * m_coefficients_y[ii] * power;
+		power *= u;
+	}
+}
+
+double AlignmentCurve::Segment::getPolynomialArcLength( double u0, double u1 ) const
+{
+	return integrateAdaptive<double>( [&]( double u ) { vec2 d; getPolynomialDerivative( u, d ); return d.length(); }, u0, u1, s_integrationTolerance );
+}
+
+double AlignmentCurve::Segment::findPolynomialParameter( double u_start, double arc_length ) const
+{
+	// Newton iteration on the arc length, which grows monotonically with the parameter
+	vec2 derivative;
+	getPolynomialDerivative( u_start, derivative );
+	double speed = derivative.length();
+	double u = speed > 1e-12 ? u_start + arc_length / speed : u_start + arc_length;
+	for( size_t ii = 0; ii < 50; ++ii )
+	{
+		const double error = getPolynomialArcLength( u_start, u ) - arc_length;
+		getPolynomialDerivative( u, derivative );
+		speed = derivative.length();
+		if( speed < 1e-12 )
+		{
+			break;
+		}
+		u -= error / speed;
+		if( std::abs( error ) < s_integrationTolerance )
+		{
+			break;
+		}
+	}
+	return u;
+}
+
+void AlignmentCurve::Segment::evaluateParent( double t, vec2& point, double& angle ) const
+{
+	switch( m_type )
+	{
+	case PARENT_LINE:
+		point = carve::geom::VECTOR( t, 0.0 );
+		angle = 0;
+		break;
+	case PARENT_CIRCLE:
+		angle = t / m_radius;
+		point = carve::geom::VECTOR( m_radius * std::cos( angle ), m_radius * std::sin( angle ) );
+		angle += M_PI_2;
+		break;
+	case PARENT_SPIRAL:
+		// only used for the start point, see init
+		point = integrateAdaptive<vec2>( [&]( double tt ) { const double theta = getTheta( tt ); return carve::geom::VECTOR( std::cos( theta ), std::sin( theta ) ); },
+			0.0, t, s_integrationTolerance );
+		angle = getTheta( t );
+		break;
+	case PARENT_POLYNOMIAL:
+	{
+		point = carve::geom::VECTOR( 0.0, 0.0 );
+		double power = 1.0;
+		for( size_t ii = 0; ii < std::max( m_coefficients_x.size(), m_coefficients_y.size() ); ++ii )
+		{
+			if( ii < m_coefficients_x.size() ) point.x += m_coefficients_x[ii] * power;
+			if( ii < m_coefficients_y.size() ) point.y += m_coefficients_y[ii] * power;
+			power *= t;
+		}
+		vec2 derivative;
+		getPolynomialDerivative( t, derivative );
+		angle = std::atan2( derivative.y, derivative.x );
+		break;
+	}
+	}
+}
+
+vec2 AlignmentCurve::Segment::integrateParent( double t0, double t ) const
+{
+	if( m_type == PARENT_SPIRAL )
+	{
+		return integrateGauss<vec2>( [&]( double tt ) { const double theta = getTheta( tt ); return carve::geom::VECTOR( std::cos( theta ), std::sin( theta ) ); }, t0, t );
+	}
+
+	vec2 point0, point1;
+	double angle0 = 0, angle1 = 0;
+	evaluateParent( t0, point0, angle0 );
+	evaluateParent( t, point1, angle1 );
+	return point1 - point0;
+}
+
+vec2 AlignmentCurve::Segment::toSegment( const vec2& parentVector ) const
+{
+	return rotate( parentVector, std::cos( m_parent_start_angle ), -std::sin( m_parent_start_angle ) );
+}
+
+void AlignmentCurve::Segment::evaluate( double s, vec2& point, vec2& tangent ) const
+{
+	const double s_clamped = std::min( std::max( s, 0.0 ), m_length );
+	vec2 local;
+	double angle = 0;
+
+	if( m_type == PARENT_SPIRAL )
+	{
+		size_t knot = m_knot_step > 0 ? size_t( s_clamped / m_knot_step ) : 0;
+		knot = std::min( knot, m_knot_points.size() - 1 );
+		const double t_knot = m_parent_start + m_direction * m_knot_step * double( knot );
+		const double t = m_parent_start + m_direction * s_clamped;
+		local = m_knot_points[knot] + toSegment( integrateParent( t_knot, t ) );
+		angle = getTheta( t ) - getTheta( m_parent_start );
+	}
+	else if( m_type == PARENT_POLYNOMIAL )
+	{
+		size_t knot = m_knot_step > 0 ? size_t( s_clamped / m_knot_step ) : 0;
+		knot = std::min( knot, m_knot_parameters.size() - 1 );
+		const double u = findPolynomialParameter( m_knot_parameters[knot], m_direction * ( s_clamped - m_knot_step * double( knot ) ) );
+		vec2 parentPoint;
+		evaluateParent( u, parentPoint, angle );
+		local = toSegment( parentPoint - m_parent_start_point );
+		angle -= ( m_direction < 0 ? m_parent_start_angle - M_PI : m_parent_start_angle );
+	}
+	else
+	{
+		vec2 parentPoint;
+		evaluateParent( m_parent_start + m_direction * s_clamped, parentPoint, angle );
+		local = toSegment( parentPoint - m_parent_start_point );
+		angle -= ( m_direction < 0 ? m_parent_start_angle - M_PI : m_parent_start_angle );
+	}
+
+	vec2 localTangent = carve::geom::VECTOR( std::cos( angle ), std::sin( angle ) );
+	if( s != s_clamped )
+	{
+		// extrapolate along the tangent at the end of the segment
+		local = local + localTangent * ( s - s_clamped );
+	}
+
+	point = m_placement_location + rotate( local, m_placement_x.x, m_placement_x.y );
+	tangent = rotate( localTangent, m_placement_x.x, m_placement_x.y );
+}
+
+double AlignmentCurve::Segment::getCurvature( double s ) const
+{
+	switch( m_type )
+	{
+	case PARENT_LINE:
+		return 0;
+	case PARENT_CIRCLE:
+		return 1.0 / m_radius;
+	case PARENT_SPIRAL:
+	{
+		const double t = m_parent_start + m_direction * s;
+		double curvature = 0;
+		double power = 1.0;
+		for( size_t ii = 0; ii < 8; ++ii )
+		{
+			curvature += double( ii + 1 ) * m_theta_poly[ii] * power;
+			power *= t;
+		}
+		if( m_trig_length > 0 )
+		{
+			curvature += m_theta_cos * M_PI / m_trig_length * std::cos( M_PI * t / m_trig_length );
+			curvature += m_theta_sin * 2.0 * M_PI / m_trig_length * std::sin( 2.0 * M_PI * t / m_trig_length );
+		}
+		return curvature;
+	}
+	case PARENT_POLYNOMIAL:
+	{
+		double u = m_parent_start;
+		if( !m_knot_parameters.empty() )
+		{
+			const double s_clamped = std::min( std::max( s, 0.0 ), m_length );
+			size_t knot = m_knot_step > 0 ? size_t( s_clamped / m_knot_step ) : 0;
+			knot = std::min( knot, m_knot_parameters.size() - 1 );
+			u = findPolynomialParameter( m_knot_parameters[knot], m_direction * ( s_clamped - m_knot_step * double( knot ) ) );
+		}
+
+		// curvature of a parametric curve: (x'y'' - y'x'') / |P'|^3
+		vec2 d1, d2 = carve::geom::VECTOR( 0.0, 0.0 );
+		getPolynomialDerivative( u, d1 );
+		double power = 1.0;
+		for( size_t ii = 2; ii < m_coefficients_x.size(); ++ii )
+		{
+			d2.x += double( ii * ( ii - 1 ) ) * m_coefficients_x[ii] * power;
+			power *= u;
+		}
+		power = 1.0;
+		for( size_t ii = 2; ii < m_coefficients_y.size(); ++ii )
+		{
+			d2.y += double( ii * ( ii - 1 ) ) * m_coefficients_y[ii] * power;
+			power *= u;
+		}
+		const double speed = d1.length();
+		if( speed < 1e-12 )
+		{
+			return 0;
+		}
+		return ( d1.x * d2.y - d1.y * d2.x ) / ( speed * speed * speed );
+	}
+	}
+	return 0;
+}
+
+void AlignmentCurve::Segment::getSampleLengths( double maxTurnAngle, int minNumPointsPerArc, std::vector<double>& lengths ) const
+{
+	lengths.push_back( 0 );
+	if( m_length <= 0 )
+	{
+		return;
+	}
+
+	if( m_type == PARENT_LINE )
+	{
+		lengths.push_back( m_length );
+		return;
+	}
+
+	if( m_type == PARENT_CIRCLE )
+	{
+		const double openingAngle = m_length / m_radius;
+		size_t numIntervals = size_t( std::ceil( openingAngle / maxTurnAngle ) );
+		numIntervals = std::max( numIntervals, size_t( std::max( minNumPointsPerArc - 1, 1 ) ) );
+		for( size_t ii = 1; ii <= numIntervals; ++ii )
+		{
+			lengths.push_back( m_length * double( ii ) / double( numIntervals ) );
+		}
+		return;
+	}
+
+	// spirals and polynomials: step length from the curvature at both ends of the step
+	double s = 0;
+	double step = m_length;
+	for( size_t ii = 0; ii < 100000 && s < m_length; ++ii )
+	{
+		double curvature = std::max( std::abs( getCurvature( s ) ), std::abs( getCurvature( std::min( s + step, m_length ) ) ) );
+		step = curvature > 1e-12 ? std::min( maxTurnAngle / curvature, m_length ) : m_length;
+		step = std::min( step, m_length - s );
+		s += step;
+		if( m_length - s < 1e-9 )
+		{
+			s = m_length;
+		}
+		lengths.push_back( s );
+	}
+}
+
+void AlignmentCurve::SegmentSequence::evaluateAtLength( double distance, vec2& point, vec2& tangent ) const
+{
+	if( m_segments.empty() )
+	{
+		point = carve::geom::VECTOR( distance, 0.0 );
+		tangent = carve::geom::VECTOR( 1.0, 0.0 );
+		return;
+	}
+
+	auto it = std::upper_bound( m_start_distances.begin(), m_start_distances.end(), distance );
+	size_t index = it == m_start_distances.begin() ? 0 : size_t( it - m_start_distances.begin() ) - 1;
+	m_segments[index].evaluate( distance - m_start_distances[index], point, tangent );
+}
+
+void AlignmentCurve::SegmentSequence::evaluateAtX( double x, vec2& point, vec2& tangent ) const
+{
+	if( m_segments.empty() )
+	{
+		point = carve::geom::VECTOR( x, 0.0 );
+		tangent = carve::geom::VECTOR( 1.0, 0.0 );
+		return;
+	}
+
+	auto it = std::upper_bound( m_start_distances.begin(), m_start_distances.end(), x );
+	size_t index = it == m_start_distances.begin() ? 0 : size_t( it - m_start_distances.begin() ) - 1;
+	const Segment& segment = m_segments[index];
+
+	// the x coordinate grows monotonically along vertical and cant segments, so Newton iteration converges fast from the linear guess
+	double s = x - m_start_distances[index];
+	for( size_t ii = 0; ii < 50; ++ii )
+	{
+		segment.evaluate( s, point, tangent );
+		const double error = point.x - x;
+		if( std::abs( error ) < 1e-10 || std::abs( tangent.x ) < 1e-12 )
+		{
+			break;
+		}
+		s -= error / tangent.x;
+	}
+}
+
+void AlignmentCurve::SegmentSequence::getSampleDistances( double maxTurnAngle, int minNumPointsPerArc, bool byX, std::vector<double>& distances ) const
+{
+	std::vector<double> lengths;
+	for( size_t ii = 0; ii < m_segments.size(); ++ii )
+	{
+		const Segment& segment = m_segments[ii];
+		lengths.clear();
+		segment.getSampleLengths( maxTurnAngle, minNumPointsPerArc, lengths );
+		for( double s : lengths )
+		{
+			if( byX )
+			{
+				vec2 point, tangent;
+				segment.evaluate( s, point, tangent );
+				distances.push_back( point.x );
+			}
+			else
+			{
+				distances.push_back( m_start_distances[ii] + s );
+			}
+		}
+	}
+}
+
+void AlignmentCurve::getFrame( double distance, Frame& frame ) const
+{
+	vec2 point, tangent;
+	m_horizontal.evaluateAtLength( distance, point, tangent );
+
+	double height = 0;
+	double slope = 0;
+	for( const SegmentSequence* profile : { &m_vertical, &m_cant } )
+	{
+		if( profile->empty() )
+		{
+			continue;
+		}
+		vec2 profilePoint, profileTangent;
+		profile->evaluateAtX( distance, profilePoint, profileTangent );
+		height += profilePoint.y;
+		if( std::abs( profileTangent.x ) > 1e-12 )
+		{
+			slope += profileTangent.y / profileTangent.x;
+		}
+	}
+
+	frame.m_point = carve::geom::VECTOR( point.x, point.y, height );
+	frame.m_tangent = carve::geom::VECTOR( tangent.x, tangent.y, slope ).normalized();
+	frame.m_lateral = carve::geom::VECTOR( -tangent.y, tangent.x, 0.0 ).normalized();
+	frame.m_up = carve::geom::cross( frame.m_tangent, frame.m_lateral ).normalized();
+}
+
+void AlignmentCurve::getPoints( double maxTurnAngle, int minNumPointsPerArc, std::vector<vec3>& points ) const
+{
+	std::vector<double> distances;
+	m_horizontal.getSampleDistances( maxTurnAngle, minNumPointsPerArc, false, distances );
+	const double length = getLength();
+	const size_t numHorizontal = distances.size();
+	m_vertical.getSampleDistances( maxTurnAngle, minNumPointsPerArc, true, distances );
+	m_cant.getSampleDistances( maxTurnAngle, minNumPointsPerArc, true, distances );
+	if( distances.size() > numHorizontal )
+	{
+		// profile samples are only needed where the horizontal alignment is
+		distances.erase( std::remove_if( distances.begin() + numHorizontal, distances.end(), [&]( double d ) { return d < 0 || d > length; } ), distances.end() );
+	}
+	std::sort( distances.begin(), distances.end() );
+	distances.erase( std::unique( distances.begin(), distances.end(), []( double a, double b ) { return std::abs( a - b ) < 1e-6; } ), distances.end() );
+
+	points.reserve( points.size() + distances.size() );
+	Frame frame;
+	for( double distance : distances )
+	{
+		getFrame( distance, frame );
+		points.push_back( frame.m_point );
+	}
+}
+
+bool AlignmentConverter::isAlignmentCurve( const shared_ptr<IfcCurve>& curve )
+{
+	shared_ptr<IfcCompositeCurve> composite_curve = dynamic_pointer_cast<IfcCompositeCurve>( curve );
+	if( !composite_curve )
+	{
+		return false;
+	}
+	return std::any_of( composite_curve->m_Segments.begin(), composite_curve->m_Segments.end(),
+		[]( const shared_ptr<IfcSegment>& segment ) { return dynamic_pointer_cast<IfcCurveSegment>( segment ) != nullptr; } );
+}
+
+shared_ptr<AlignmentCurve> AlignmentConverter::getAlignmentCurve( const shared_ptr<IfcCurve>& curve )
+{
+	if( !isAlignmentCurve( curve ) )
+	{
+		return shared_ptr<AlignmentCurve>();
+	}
+	if( curve->m_tag <= 0 )
+	{
+		return createAlignmentCurve( curve );
+	}
+
+	shared_ptr<CacheEntry> entry;
+	{
+		std::lock_guard<std::mutex> lock( m_writelock_alignment_cache );
+		shared_ptr<CacheEntry>& cached = m_alignment_cache[curve->m_tag];
+		if( !cached )
+		{
+			cached = std::make_shared<CacheEntry>();
+		}
+		entry = cached;
+	}
+
+	// other threads that need the same curve wait here until it is created
+	std::call_once( entry->m_computed, [&]() { entry->m_curve = createAlignmentCurve( curve ); } );
+	return entry->m_curve;
+}
+
+shared_ptr<AlignmentCurve> AlignmentConverter::createAlignmentCurve( const shared_ptr<IfcCurve>& curve )
+{
+	shared_ptr<AlignmentCurve> result = std::make_shared<AlignmentCurve>();
+
+	shared_ptr<IfcSegmentedReferenceCurve> reference_curve = dynamic_pointer_cast<IfcSegmentedReferenceCurve>( curve );
+	if( reference_curve )
+	{
+		// cant segments are given over the distance along the base curve, which is an IfcGradientCurve
+		shared_ptr<AlignmentCurve> base = getAlignmentCurve( reference_curve->m_BaseCurve );
+		if( !base || !convertSegments( reference_curve->m_Segments, true, result->m_cant ) )
+		{
+			return shared_ptr<AlignmentCurve>();
+		}
+		result->m_horizontal = base->m_horizontal;
+		result->m_vertical = base->m_vertical;
+		return result;
+	}
+
+	shared_ptr<IfcGradientCurve> gradient_curve = dynamic_pointer_cast<IfcGradientCurve>( curve );
+	if( gradient_curve )
+	{
+		// vertical segments are given in the plane of distance along the horizontal alignment and height
+		shared_ptr<AlignmentCurve> base = getAlignmentCurve( gradient_curve->m_BaseCurve );
+		if( !base || !convertSegments( gradient_curve->m_Segments, true, result->m_vertical ) )
+		{
+			return shared_ptr<AlignmentCurve>();
+		}
+		result->m_horizontal = base->m_horizontal;
+		return result;
+	}
+
+	shared_ptr<IfcCompositeCurve> composite_curve = dynamic_pointer_cast<IfcCompositeCurve>( curve );
+	if( !composite_curve || !convertSegments( composite_curve->m_Segments, false, result->m_horizontal ) )
+	{
+		return shared_ptr<AlignmentCurve>();
+	}
+	return result;
+}
+
+bool AlignmentConverter::convertSegments( const std::vector<shared_ptr<IfcSegment> >& segments, bool startAtPlacementX, AlignmentCurve::SegmentSequence& sequence )
+{
+	double distance = 0;
+	for( const shared_ptr<IfcSegment>& ifc_segment : segments )
+	{
+		shared_ptr<IfcCurveSegment> curve_segment = dynamic_pointer_cast<IfcCurveSegment>( ifc_segment );
+		if( !curve_segment )
+		{
+			return false;
+		}
+
+		AlignmentCurve::Segment segment;
+		if( !convertCurveSegment( curve_segment, segment ) )
+		{
+			return false;
+		}
+
+		sequence.m_start_distances.push_back( startAtPlacementX ? segment.m_placement_location.x : distance );
+		distance += segment.m_length;
+		sequence.m_segments.push_back( std::move( segment ) );
+	}
+	return !sequence.m_segments.empty();
+}
+
+bool AlignmentConverter::convertCurveSegment( const shared_ptr<IfcCurveSegment>& curve_segment, AlignmentCurve::Segment& segment )
+{
+	const double length_factor = m_unit_converter->getLengthInMeterFactor();
+	double angle_factor = m_unit_converter->getAngleInRadiantFactor();
+	if( m_unit_converter->getAngularUnit() == UnitConverter::UNDEFINED )
+	{
+		angle_factor = 1.0;
+	}
+
+	convertPlacement2D( curve_segment->m_Placement, segment.m_placement_location, segment.m_placement_x );
+
+	// IfcCurveMeasureSelect is either a length along the curve or a curve parameter
+	auto getMeasure = [&]( const shared_ptr<IfcCurveMeasureSelect>& measure, bool& isParameter ) -> double
+	{
+		isParameter = false;
+		shared_ptr<IfcLengthMeasure> length_measure = dynamic_pointer_cast<IfcLengthMeasure>( measure );
+		if( length_measure )
+		{
+			return length_measure->m_value * length_factor;
+		}
+		shared_ptr<IfcParameterValue> parameter_value = dynamic_pointer_cast<IfcParameterValue>( measure );
+		if( parameter_value )
+		{
+			isParameter = true;
+			return parameter_value->m_value;
+		}
+		return 0;
+	};
+	bool startIsParameter = false;
+	bool lengthIsParameter = false;
+	double start = getMeasure( curve_segment->m_SegmentStart, startIsParameter );
+	double length = getMeasure( curve_segment->m_SegmentLength, lengthIsParameter );
+
+	// factor from the curve parameter to the arc length, for lines, circles and spirals
+	double parameterToLength = length_factor;
+	const shared_ptr<IfcCurve>& parent = curve_segment->m_ParentCurve;
+
+	auto setSpiralTerm = [&]( const shared_ptr<IfcLengthMeasure>& term, size_t exponent )
+	{
+		// curvature term sign(A) * s^i / |A|^(i+1), integrated to the tangent angle
+		if( term && std::abs( term->m_value ) > 1e-15 )
+		{
+			const double a = term->m_value * length_factor;
+			segment.m_theta_poly[exponent] = ( a < 0 ? -1.0 : 1.0 ) / ( double( exponent + 1 ) * std::pow( std::abs( a ), double( exponent + 1 ) ) );
+		}
+	};
+
+	if( dynamic_pointer_cast<IfcLine>( parent ) )
+	{
+		shared_ptr<IfcLine> line = dynamic_pointer_cast<IfcLine>( parent );
+		segment.m_type = AlignmentCurve::Segment::PARENT_LINE;
+		if( line->m_Dir && line->m_Dir->m_Magnitude )
+		{
+			parameterToLength = line->m_Dir->m_Magnitude->m_value * length_factor;
+		}
+	}
+	else if( dynamic_pointer_cast<IfcCircle>( parent ) )
+	{
+		shared_ptr<IfcCircle> circle = dynamic_pointer_cast<IfcCircle>( parent );
+		if( !circle->m_Radius || circle->m_Radius->m_value <= 0 )
+		{
+			return false;
+		}
+		segment.m_type = AlignmentCurve::Segment::PARENT_CIRCLE;
+		segment.m_radius = circle->m_Radius->m_value * length_factor;
+		parameterToLength = angle_factor * segment.m_radius;
+	}
+	else if( dynamic_pointer_cast<IfcClothoid>( parent ) )
+	{
+		shared_ptr<IfcClothoid> clothoid = dynamic_pointer_cast<IfcClothoid>( parent );
+		segment.m_type = AlignmentCurve::Segment::PARENT_SPIRAL;
+		setSpiralTerm( clothoid->m_ClothoidConstant, 1 );
+	}
+	else if( dynamic_pointer_cast<IfcSecondOrderPolynomialSpiral>( parent ) )
+	{
+		shared_ptr<IfcSecondOrderPolynomialSpiral> spiral = dynamic_pointer_cast<IfcSecondOrderPolynomialSpiral>( parent );
+		segment.m_type = AlignmentCurve::Segment::PARENT_SPIRAL;
+		setSpiralTerm( spiral->m_QuadraticTerm, 2 );
+		setSpiralTerm( spiral->m_LinearTerm, 1 );
+		setSpiralTerm( spiral->m_ConstantTerm, 0 );
+	}
+	else if( dynamic_pointer_cast<IfcThirdOrderPolynomialSpiral>( parent ) )
+	{
+		shared_ptr<IfcThirdOrderPolynomialSpiral> spiral = dynamic_pointer_cast<IfcThirdOrderPolynomialSpiral>( parent );
+		segment.m_type = AlignmentCurve::Segment::PARENT_SPIRAL;
+		setSpiralTerm( spiral->m_CubicTerm, 3 );
+		setSpiralTerm( spiral->m_QuadraticTerm, 2 );
+		setSpiralTerm( spiral->m_LinearTerm, 1 );
+		setSpiralTerm( spiral->m_ConstantTerm, 0 );
+	}
+	else if( dynamic_pointer_cast<IfcSeventhOrderPolynomialSpiral>( parent ) )
+	{
+		shared_ptr<IfcSeventhOrderPolynomialSpiral> spiral = dynamic_pointer_cast<IfcSeventhOrderPolynomialSpiral>( parent );
+		segment.m_type = AlignmentCurve::Segment::PARENT_SPIRAL;
+		setSpiralTerm( spiral->m_SepticTerm, 7 );
+		setSpiralTerm( spiral->m_SexticTerm, 6 );
+		setSpiralTerm( spiral->m_QuinticTerm, 5 );
+		setSpiralTerm( spiral->m_QuarticTerm, 4 );
+		setSpiralTerm( spiral->m_CubicTerm, 3 );
+		setSpiralTerm( spiral->m_QuadraticTerm, 2 );
+		setSpiralTerm( spiral->m_LinearTerm, 1 );
+		setSpiralTerm( spiral->m_ConstantTerm, 0 );
+	}
+	else if( dynamic_pointer_cast<IfcCosineSpiral>( parent ) || dynamic_pointer_cast<IfcSineSpiral>( parent ) )
+	{
+		// the period of the trigonometric term is the length of the transition, which is the segment length
+		segment.m_type = AlignmentCurve::Segment::PARENT_SPIRAL;
+		segment.m_trig_length = std::abs( lengthIsParameter ? length * length_factor : length );
+		if( segment.m_trig_length <= 0 )
+		{
+			return false;
+		}
+
+		shared_ptr<IfcCosineSpiral> cosine_spiral = dynamic_pointer_cast<IfcCosineSpiral>( parent );
+		if( cosine_spiral )
+		{
+			setSpiralTerm( cosine_spiral->m_ConstantTerm, 0 );
+			if( cosine_spiral->m_CosineTerm && std::abs( cosine_spiral->m_CosineTerm->m_value ) > 1e-15 )
+			{
+				segment.m_theta_cos = segment.m_trig_length / ( M_PI * cosine_spiral->m_CosineTerm->m_value * length_factor );
+			}
+		}
+		else
+		{
+			shared_ptr<IfcSineSpiral> sine_spiral = dynamic_pointer_cast<IfcSineSpiral>( parent );
+			setSpiralTerm( sine_spiral->m_ConstantTerm, 0 );
+			setSpiralTerm( sine_spiral->m_LinearTerm, 1 );
+			if( sine_spiral->m_SineTerm && std::abs( sine_spiral->m_SineTerm->m_value ) > 1e-15 )
+			{
+				segment.m_theta_sin = segment.m_trig_length / ( 2.0 * M_PI * sine_spiral->m_SineTerm->m_value * length_factor );
+			}
+		}
+	}
+	else if( dynamic_pointer_cast<IfcPolynomialCurve>( parent ) )
+	{
+		shared_ptr<IfcPolynomialCurve> polynomial = dynamic_pointer_cast<IfcPolynomialCurve>( parent );
+		segment.m_type = AlignmentCurve::Segment::PARENT_POLYNOMIAL;
+		for( const shared_ptr<IfcReal>& coefficient : polynomial->m_CoefficientsX )
+		{
+			segment.m_coefficients_x.push_back( coefficient ? coefficient->m_value * length_factor : 0.0 );
+		}
+		for( const shared_ptr<IfcReal>& coefficient : polynomial->m_CoefficientsY )
+		{
+			segment.m_coefficients_y.push_back( coefficient ? coefficient->m_value * length_factor : 0.0 );
+		}
+		if( segment.m_coefficients_x.empty() )
+		{
+			// y given as function of x
+			segment.m_coefficients_x = { 0.0, length_factor };
+		}
+
+		// the curve parameter is not the arc length, so lengths are converted by integration
+		segment.m_parent_start = startIsParameter ? start : segment.findPolynomialParameter( 0.0, start );
+		segment.m_direction = length < 0 ? -1.0 : 1.0;
+		segment.m_length = std::abs( lengthIsParameter ? segment.getPolynomialArcLength( segment.m_parent_start, segment.m_parent_start + length ) : length );
+		segment.init();
+		return true;
+	}
+	else
+	{
+		return false;
+	}
+
+	if( startIsParameter )
+	{
+		start *= parameterToLength;
+	}
+	if( lengthIsParameter )
+	{
+		length *= parameterToLength;
+	}
+	segment.m_parent_start = start;
+	segment.m_direction = length < 0 ? -1.0 : 1.0;
+	segment.m_length = std::abs( length );
+	segment.init();
+	return true;
+}
+
+void AlignmentConverter::convertPlacement2D( const shared_ptr<IfcPlacement>& placement, vec2& location, vec2& x_axis ) const
+{
+	const double length_factor = m_unit_converter->getLengthInMeterFactor();
+	location = carve::geom::VECTOR( 0.0, 0.0 );
+	x_axis = carve::geom::VECTOR( 1.0, 0.0 );
+	if( !placement )
+	{
+		return;
+	}
+
+	shared_ptr<IfcCartesianPoint> cartesian_point = dynamic_pointer_cast<IfcCartesianPoint>( placement->m_Location );
+	if( cartesian_point )
+	{
+		location = carve::geom::VECTOR( cartesian_point->m_Coordinates[0] * length_factor, cartesian_point->m_Coordinates[1] * length_factor );
+	}
+	else
+	{
+		// IfcAxis2PlacementLinear of cant segments: the x coordinate is the distance along
+		shared_ptr<IfcPointByDistanceExpression> point_by_distance = dynamic_pointer_cast<IfcPointByDistanceExpression>( placement->m_Location );
+		if( point_by_distance )
+		{
+			shared_ptr<IfcLengthMeasure> distance_along = dynamic_pointer_cast<IfcLengthMeasure>( point_by_distance->m_DistanceAlong );
+			if( distance_along )
+			{
+				location.x = distance_along->m_value * length_factor;
+			}
+		}
+	}
+
+	shared_ptr<IfcDirection> ref_direction;
+	if( dynamic_pointer_cast<IfcAxis2Placement2D>( placement ) )
+	{
+		ref_direction = dynamic_pointer_cast<IfcAxis2Placement2D>( placement )->m_RefDirection;
+	}
+	else if( dynamic_pointer_cast<IfcAxis2Placement3D>( placement ) )
+	{
+		ref_direction = dynamic_pointer_cast<IfcAxis2Placement3D>( placement )->m_RefDirection;
+	}
+
+	if( ref_direction && ref_direction->m_DirectionRatios.size() > 1 && ref_direction->m_DirectionRatios[0] && ref_direction->m_DirectionRatios[1] )
+	{
+		vec2 direction = carve::geom::VECTOR( ref_direction->m_DirectionRatios[0]->m_value, ref_direction->m_DirectionRatios[1]->m_value );
+		if( direction.length2() > 1e-30 )
+		{
+			x_axis = direction.normalized();
+		}
+	}
+}
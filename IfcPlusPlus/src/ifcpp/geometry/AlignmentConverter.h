@@ -0,0 +1,197 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <map>
+#include <mutex>
+#include <vector>
+#include <ifcpp/model/BasicTypes.h>
+#include <ifcpp/model/GlobalDefines.h>
+#include <ifcpp/model/StatusCallback.h>
+#include <ifcpp/model/UnitConverter.h>
+#include <IfcCurve.h>
+#include <IfcCurveSegment.h>
+#include <IfcPlacement.h>
+#include <IfcSegment.h>
+#include "IncludeCarveHeaders.h"
+
+using namespace IFC4X3;
+
+///@brief Exact evaluation of IFC4X3 alignment curves by distance along the alignment
+///@details Handles IfcCompositeCurve made of IfcCurveSegment (the horizontal alignment), IfcGradientCurve (horizontal plus vertical profile) and
+///IfcSegmentedReferenceCurve (gradient curve plus cant). Each segment is evaluated in closed form (IfcLine, IfcCircle) or by Gauss-Legendre integration of
+///the tangent angle (IfcClothoid and the other IfcSpiral types) or of the parametric derivative (IfcPolynomialCurve), starting from precomputed knots,
+///so a point costs one binary search over the segments and one short integration.
+///The parent curve of a segment is moved so that its point at SegmentStart lies on the segment's Placement, with the tangent in the direction of
+///traversal along the placement's x axis. A negative SegmentLength runs backwards along the parent curve.
+///An AlignmentCurve is not modified after it has been created, so it can be evaluated from several threads at once.
+class IFCQUERY_EXPORT AlignmentCurve
+{
+public:
+	//\brief Position and orientation on the curve: tangent in the direction of increasing distance, lateral to the left and up, orthonormal
+	struct Frame
+	{
+		vec3 m_point;
+		vec3 m_tangent;
+		vec3 m_lateral;
+		vec3 m_up;
+	};
+
+	//\brief One IfcCurveSegment in the 2D space of its composite curve: plan (x, y) for horizontal segments, (distance along, height) for vertical ones
+	class Segment
+	{
+	public:
+		enum ParentType { PARENT_LINE, PARENT_CIRCLE, PARENT_SPIRAL, PARENT_POLYNOMIAL };
+
+		ParentType			m_type = PARENT_LINE;
+		double				m_length = 0;				// arc length of the segment, always >= 0
+		double				m_direction = 1;			// -1 if the segment runs backwards on the parent curve
+		double				m_parent_start = 0;			// arc length on the parent curve at SegmentStart, or the curve parameter in case of IfcPolynomialCurve
+		vec2				m_placement_location;
+		vec2				m_placement_x;				// unit vector
+
+		// IfcCircle
+		double				m_radius = 0;
+
+		// spirals: tangent angle theta(s) = sum m_theta_poly[i] * s^(i+1) + m_theta_cos * sin(pi*s/L) + m_theta_sin * (1 - cos(2*pi*s/L)), with L = m_trig_length
+		double				m_theta_poly[8] = {};
+		double				m_theta_cos = 0;
+		double				m_theta_sin = 0;
+		double				m_trig_length = 0;
+
+		// IfcPolynomialCurve, scaled to meter
+		std::vector<double>	m_coefficients_x;
+		std::vector<double>	m_coefficients_y;
+
+		// parent curve in segment coordinates: start point at the origin, start tangent along +x
+		vec2				m_parent_start_point;
+		double				m_parent_start_angle = 0;	// tangent angle of the parent curve at the start, in the direction of traversal
+
+		// knots every m_knot_step along the segment, in segment coordinates. Polynomial curves also keep the curve parameter at each knot
+		double				m_knot_step = 0;
+		std::vector<vec2>	m_knot_points;
+		std::vector<double>	m_knot_parameters;
+
+		//\brief Completes the segment after the attributes above are set: computes the start frame of the parent curve and the knots
+		void init();
+
+		//\brief Evaluates the segment at arc length s from its start. Values outside of [0, m_length] are extrapolated along the tangent at the end
+		void evaluate( double s, vec2& point, vec2& tangent ) const;
+
+		double getCurvature( double s ) const;
+
+		//\brief Arc lengths along the segment, including 0 and m_length, so that the tangent turns at most maxTurnAngle between two of them
+		void getSampleLengths( double maxTurnAngle, int minNumPointsPerArc, std::vector<double>& lengths ) const;
+
+		// IfcPolynomialCurve: arc length between two curve parameters, and the parameter at a signed arc length from u_start
+		double getPolynomialArcLength( double u0, double u1 ) const;
+		double findPolynomialParameter( double u_start, double arc_length ) const;
+
+	protected:
+		// point and tangent angle on the parent curve, relative to its own position. t is the arc length, or the curve parameter in case of IfcPolynomialCurve
+		void evaluateParent( double t, vec2& point, double& angle ) const;
+		double getTheta( double t ) const;
+		void getPolynomialDerivative( double u, vec2& derivative ) const;
+		// point on the parent curve between knot parameter t0 and t, by integration of the tangent, relative to the point at t0
+		vec2 integrateParent( double t0, double t ) const;
+		vec2 toSegment( const vec2& parentPoint ) const;
+	};
+
+	//\brief Segments of one composite curve, found by binary search over their start distances
+	class SegmentSequence
+	{
+	public:
+		std::vector<Segment>	m_segments;
+		std::vector<double>		m_start_distances;	// horizontal: accumulated segment lengths. Vertical and cant: x coordinate of the segment start
+
+		bool empty() const { return m_segments.empty(); }
+		double getLength() const { return m_segments.empty() ? 0.0 : m_start_distances.back() + m_segments.back().m_length; }
+
+		//\brief Point and tangent at the given distance along the horizontal curve
+		void evaluateAtLength( double distance, vec2& point, vec2& tangent ) const;
+
+		//\brief Point and tangent where the curve reaches the given x coordinate, used for vertical and cant segments, which are given over the distance along
+		void evaluateAtX( double x, vec2& point, vec2& tangent ) const;
+
+		//\brief Appends the distances of the sample points, see Segment::getSampleLengths. Vertical segments give x coordinates
+		void getSampleDistances( double maxTurnAngle, int minNumPointsPerArc, bool byX, std::vector<double>& distances ) const;
+	};
+
+	SegmentSequence		m_horizontal;
+	SegmentSequence		m_vertical;			// empty if not an IfcGradientCurve or IfcSegmentedReferenceCurve
+	SegmentSequence		m_cant;				// empty if not an IfcSegmentedReferenceCurve
+
+	//\brief Length of the horizontal alignment. Distances along the alignment are measured in plan, as stations are
+	double getLength() const { return m_horizontal.getLength(); }
+
+	//\brief Evaluates the curve at a distance along the horizontal alignment, in O(log n) of the number of segments
+	void getFrame( double distance, Frame& frame ) const;
+
+	//\brief Points along the whole curve, adaptively sampled so that the tangent turns at most maxTurnAngle between two points
+	void getPoints( double maxTurnAngle, int minNumPointsPerArc, std::vector<vec3>& points ) const;
+};
+
+//\brief Creates the AlignmentCurve of IFC curves and caches it per curve
+class IFCQUERY_EXPORT AlignmentConverter : public StatusCallback
+{
+protected:
+	struct CacheEntry
+	{
+		std::once_flag				m_computed;
+		shared_ptr<AlignmentCurve>	m_curve;
+	};
+
+	shared_ptr<UnitConverter>						m_unit_converter;
+	std::map<int, shared_ptr<CacheEntry> >			m_alignment_cache;
+	std::mutex										m_writelock_alignment_cache;
+
+public:
+	AlignmentConverter( shared_ptr<UnitConverter>& uc ) : m_unit_converter( uc )
+	{
+	}
+
+	virtual ~AlignmentConverter()
+	{
+	}
+
+	void setUnitConverter( shared_ptr<UnitConverter>& unit_converter )
+	{
+		// cached curves are scaled with the previous length unit
+		clearAlignmentCache();
+		m_unit_converter = unit_converter;
+	}
+
+	void clearAlignmentCache()
+	{
+		std::lock_guard<std::mutex> lock( m_writelock_alignment_cache );
+		m_alignment_cache.clear();
+	}
+
+	//\brief Returns true if the curve is an IfcCompositeCurve with at least one IfcCurveSegment, for example an alignment
+	static bool isAlignmentCurve( const shared_ptr<IfcCurve>& curve );
+
+	//\brief Returns the evaluator for an alignment curve. It is created once per curve and shared by all callers, also from different threads.
+	//Returns nullptr if the curve is not an alignment curve, or if it has a segment with a parent curve that can not be evaluated exactly.
+	shared_ptr<AlignmentCurve> getAlignmentCurve( const shared_ptr<IfcCurve>& curve );
+
+protected:
+	shared_ptr<AlignmentCurve> createAlignmentCurve( const shared_ptr<IfcCurve>& curve );
+	bool convertSegments( const std::vector<shared_ptr<IfcSegment> >& segments, bool startAtPlacementX, AlignmentCurve::SegmentSequence& sequence );
+	bool convertCurveSegment( const shared_ptr<IfcCurveSegment>& curve_segment, AlignmentCurve::Segment& segment );
+	void convertPlacement2D( const shared_ptr<IfcPlacement>& placement, vec2& location, vec2& x_axis ) const;
+};
@@ -270,7 +270,7 @@ bool CSG_Adapter::computeCSG_Carve(const shared_ptr<carve::mesh::MeshSet<3> >& i
 	ScopedTimeMeasure measure(&(params.generalSettings->m_mapCsgTimeTag), tag, 10);
 #endif
 
-	printToDebugLog(__FUNC__, "element tag " + std::to_string(tag));
+	CARVE_TRACE_SCOPE(__FUNC__, tag);
 	GeomProcessingParams paramsUnscaled(params);
 	shared_ptr<GeometrySettings> geomSettingsLocal(new GeometrySettings(params.generalSettings));
 	double scale = normMesh.getScale();
@@ -302,15 +302,11 @@ bool CSG_Adapter::computeCSG_Carve(const shared_ptr<carve::mesh::MeshSet<3> >& i
 
 	size_t numDegenerateFacesA = MeshOps::countDegeneratedFaces(inputA.get());
 	size_t numDegenerateFacesB = MeshOps::countDegeneratedFaces(inputB.get());
-	if (numDegenerateFacesA > 0)
+	if (numDegenerateFacesA > 0 || numDegenerateFacesB > 0)
 	{
+		// the result is the first operand. That is not the union of both
 		assignResultOnFail(inputA, inputB, operation, result);
-		return true;
-	}
-	if (numDegenerateFacesB > 0)
-	{
-		assignResultOnFail(inputA, inputB, operation, result);
-		return true;
+		return operation != carve::csg::CSG::UNION;
 	}
 
 	if (inputA == inputB)
@@ -772,13 +768,14 @@ bool CSG_Adapter::computeCSG_Carve(const shared_ptr<carve::mesh::MeshSet<3> >& i
 }
 #define _ORDER_CSG_BY_VOLUME
 
-void CSG_Adapter::computeCSG(shared_ptr<carve::mesh::MeshSet<3> >& op1, const std::vector<shared_ptr<carve::mesh::MeshSet<3> > >& operands2, const carve::csg::CSG::OP operation, GeomProcessingParams& params)
+bool CSG_Adapter::computeCSG(shared_ptr<carve::mesh::MeshSet<3> >& op1, const std::vector<shared_ptr<carve::mesh::MeshSet<3> > >& operands2, const carve::csg::CSG::OP operation, GeomProcessingParams& params)
 {
-	if (!op1 || operands2.size() == 0)
+	if (!op1)
 	{
-		return;
+		return false;
 	}
 
+	bool all_done = true;
 	bool success = false;
 	std::multimap<double, shared_ptr<carve::mesh::MeshSet<3> > > mapVolumeMeshes;
 	for (const shared_ptr<carve::mesh::MeshSet<3> >&meshset2 : operands2)
@@ -820,7 +817,13 @@ void CSG_Adapter::computeCSG(shared_ptr<carve::mesh::MeshSet<3> >& op1, const st
 				break;
 			}
 		}
+
+		if (!success)
+		{
+			all_done = false;
+		}
 	}
+	return all_done;
 }
 
 void CSG_Adapter::handleInnerOuterMeshesInOperands(shared_ptr<carve::mesh::MeshSet<3> >& op1, shared_ptr<carve::mesh::MeshSet<3> >& op2, shared_ptr<carve::mesh::MeshSet<3> >& result,
@@ -26,7 +26,8 @@ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OU
 class CSG_Adapter
 {
 public:
-	static void computeCSG(shared_ptr<carve::mesh::MeshSet<3> >& op1, const std::vector<shared_ptr<carve::mesh::MeshSet<3> > >& operands2,
+	///@returns true if the operation was done with each of operands2. Otherwise op1 is the result of the operands that succeeded
+	static bool computeCSG(shared_ptr<carve::mesh::MeshSet<3> >& op1, const std::vector<shared_ptr<carve::mesh::MeshSet<3> > >& operands2,
 		const carve::csg::CSG::OP operation, GeomProcessingParams& params);
 
 
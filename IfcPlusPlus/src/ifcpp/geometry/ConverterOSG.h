@@ -26,6 +26,7 @@ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OU
 #include <osgUtil/Tessellator>
 
 #include <ifcpp/model/BasicTypes.h>
+#include <ifcpp/model/BuildingGuid.h>
 #include <ifcpp/model/StatusCallback.h>
 #include <ifcpp/IFC4X3/EntityFactory.h>
 #include <ifcpp/IFC4X3/include/IfcCurtainWall.h>
@@ -974,7 +975,7 @@ public:
 	/*\brief method convertToOSG: Creates geometry for OpenSceneGraph from given ProductShapeData.
 	\param[out] parent_group Group to append the geometry.
 	**/
-	void convertToOSG(const std::unordered_map<std::string, shared_ptr<ProductShapeData> >& map_shape_data, osg::ref_ptr<ProductNodeType>& parent_group)
+	void convertToOSG(const std::unordered_map<BinaryGuid, shared_ptr<ProductShapeData> >& map_shape_data, osg::ref_ptr<ProductNodeType>& parent_group)
 	{
 		progressTextCallback("Converting geometry to OpenGL format ...");
 		progressValueCallback(0, "scenegraph");
@@ -0,0 +1,214 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <ifcpp/geometry/GeometrySettings.h>
+#include <ifcpp/model/UnitConverter.h>
+#include <IfcCartesianPoint.h>
+#include <IfcParameterValue.h>
+#include "CurveCache.h"
+
+static void appendTrimValues(const std::vector<shared_ptr<IfcTrimmingSelect> >& trim_vec, std::vector<double>& values)
+{
+	for (const shared_ptr<IfcTrimmingSelect>& trim : trim_vec)
+	{
+		shared_ptr<IfcParameterValue> parameter = dynamic_pointer_cast<IfcParameterValue>(trim);
+		if (parameter)
+		{
+			values.push_back(1);
+			values.push_back(parameter->m_value);
+			continue;
+		}
+
+		shared_ptr<IfcCartesianPoint> point = dynamic_pointer_cast<IfcCartesianPoint>(trim);
+		if (point)
+		{
+			values.push_back(2);
+			for (double coord : point->m_Coordinates)
+			{
+				// unset coordinates are NaN, which would never compare equal
+				values.push_back(std::isnan(coord) ? std::numeric_limits<double>::max() : coord);
+			}
+			continue;
+		}
+
+		values.push_back(0);
+	}
+}
+
+CurveCache::Key CurveCache::createKey(const shared_ptr<IfcCurve>& curve, const std::vector<shared_ptr<IfcTrimmingSelect> >& trim1_vec, const std::vector<shared_ptr<IfcTrimmingSelect> >& trim2_vec,
+	bool senseAgreement, const shared_ptr<GeometrySettings>& geom_settings, const shared_ptr<UnitConverter>& unit_converter)
+{
+	Key key;
+	key.curve = curve.get();
+	key.senseAgreement = senseAgreement;
+	key.numVerticesPerCircle = geom_settings->getNumVerticesPerCircle();
+	key.minNumVerticesPerArc = geom_settings->getMinNumVerticesPerArc();
+	key.numVerticesPerControlPoint = geom_settings->getNumVerticesPerControlPoint();
+	key.epsMergePoints = geom_settings->getEpsilonMergePoints();
+	key.lengthFactor = unit_converter->getLengthInMeterFactor();
+	key.angleFactor = unit_converter->getAngleInRadiantFactor();
+
+	// trimming selects are compared by value, since equal trims are often separate objects, for example the edge points of IfcEdgeCurve
+	key.trims.reserve(1 + 2 * (trim1_vec.size() + trim2_vec.size()));
+	key.trims.push_back(double(trim1_vec.size()));
+	appendTrimValues(trim1_vec, key.trims);
+	appendTrimValues(trim2_vec, key.trims);
+	return key;
+}
+
+bool CurveCache::Key::operator==(const Key& other) const
+{
+	return curve == other.curve && senseAgreement == other.senseAgreement && numVerticesPerCircle == other.numVerticesPerCircle
+		&& minNumVerticesPerArc == other.minNumVerticesPerArc && numVerticesPerControlPoint == other.numVerticesPerControlPoint
+		&& epsMergePoints == other.epsMergePoints && lengthFactor == other.lengthFactor && angleFactor == other.angleFactor && trims == other.trims;
+}
+
+size_t CurveCache::KeyHash::operator()(const Key& key) const
+{
+	size_t hash = std::hash<const IfcCurve*>()(key.curve);
+	auto combine = [&hash](size_t value)
+	{
+		hash ^= value + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+	};
+	combine(key.senseAgreement ? 1 : 0);
+	combine(std::hash<int>()(key.numVerticesPerCircle));
+	combine(std::hash<int>()(key.minNumVerticesPerArc));
+	combine(std::hash<double>()(key.epsMergePoints));
+	for (double value : key.trims)
+	{
+		combine(std::hash<double>()(value));
+	}
+	return hash;
+}
+
+shared_ptr<const std::vector<CurveCache::CurveSegment> > CurveCache::find(const Key& key)
+{
+	Shard& shard = getShard(key);
+	std::lock_guard<std::mutex> lock(shard.mutex);
+	auto it = shard.map.find(key);
+	if (it == shard.map.end())
+	{
+		m_num_misses.fetch_add(1, std::memory_order_relaxed);
+		return shared_ptr<const std::vector<CurveSegment> >();
+	}
+
+	shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+	m_num_hits.fetch_add(1, std::memory_order_relaxed);
+	return it->second->segments;
+}
+
+shared_ptr<const std::vector<CurveCache::CurveSegment> > CurveCache::insert(const Key& key, const shared_ptr<IfcCurve>& curve, const shared_ptr<const std::vector<CurveSegment> >& segments,
+	int64_t nanosecondsConverting)
+{
+	m_nanoseconds_converting.fetch_add(nanosecondsConverting, std::memory_order_relaxed);
+	if (!segments)
+	{
+		return segments;
+	}
+
+	size_t numPoints = 0;
+	for (const CurveSegment& seg : *segments)
+	{
+		numPoints += seg.m_points.size();
+	}
+
+	const size_t maxNumPointsPerShard = m_max_num_points.load(std::memory_order_relaxed) / NUM_SHARDS;
+	if (numPoints > maxNumPointsPerShard)
+	{
+		return segments;
+	}
+
+	Shard& shard = getShard(key);
+	std::lock_guard<std::mutex> lock(shard.mutex);
+	auto it = shard.map.find(key);
+	if (it != shard.map.end())
+	{
+		return it->second->segments;
+	}
+
+	Entry entry;
+	entry.key = key;
+	entry.curve = curve;
+	entry.segments = segments;
+	entry.numPoints = numPoints;
+	shard.lru.push_front(std::move(entry));
+	shard.map.emplace(key, shard.lru.begin());
+	shard.numPoints += numPoints;
+	evict(shard, maxNumPointsPerShard);
+	return segments;
+}
+
+void CurveCache::evict(Shard& shard, size_t maxNumPointsPerShard)
+{
+	while (shard.numPoints > maxNumPointsPerShard && !shard.lru.empty())
+	{
+		Entry& last = shard.lru.back();
+		shard.numPoints -= last.numPoints;
+		shard.map.erase(last.key);
+		shard.lru.pop_back();
+		m_num_evicted.fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+void CurveCache::clearCurveCache()
+{
+	for (Shard& shard : m_shards)
+	{
+		std::lock_guard<std::mutex> lock(shard.mutex);
+		shard.map.clear();
+		shard.lru.clear();
+		shard.numPoints = 0;
+	}
+}
+
+void CurveCache::setMaxNumCachedPoints(size_t maxNumPoints)
+{
+	m_max_num_points = maxNumPoints;
+	const size_t maxNumPointsPerShard = maxNumPoints / NUM_SHARDS;
+	for (Shard& shard : m_shards)
+	{
+		std::lock_guard<std::mutex> lock(shard.mutex);
+		evict(shard, maxNumPointsPerShard);
+	}
+}
+
+CurveCache::Statistics CurveCache::getStatistics() const
+{
+	Statistics stats;
+	stats.numHits = m_num_hits.load(std::memory_order_relaxed);
+	stats.numMisses = m_num_misses.load(std::memory_order_relaxed);
+	stats.numEvicted = m_num_evicted.load(std::memory_order_relaxed);
+	stats.secondsConverting = double(m_nanoseconds_converting.load(std::memory_order_relaxed)) * 1e-9;
+	for (const Shard& shard : m_shards)
+	{
+		std::lock_guard<std::mutex> lock(shard.mutex);
+		stats.numCachedEntries += shard.lru.size();
+		stats.numCachedPoints += shard.numPoints;
+	}
+	return stats;
+}
+
+void CurveCache::resetStatistics()
+{
+	m_num_hits = 0;
+	m_num_misses = 0;
+	m_num_evicted = 0;
+	m_nanoseconds_converting = 0;
+}
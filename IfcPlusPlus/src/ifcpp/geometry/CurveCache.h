@@ -0,0 +1,137 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include <ifcpp/model/BasicTypes.h>
+#include <IfcCurve.h>
+#include <IfcTrimmingSelect.h>
+#include "CurveConverter.h"
+
+//\brief Discretized curves, so that curves that are referenced by many items, like the directrices and profile arcs of pipe fittings, are converted only once
+///@details An entry is identified by the curve, its trimming and sense, and the settings that influence the discretization. The curve is held by the entry,
+///so that its address is not reused while the entry exists. Entries are immutable and shared. When the cache is full, the least recently used entries are evicted.
+///The callback of GeometrySettings::setNumVerticesPerCircleGivenRadius is not part of the key, clear the cache after changing it.
+class CurveCache
+{
+public:
+	typedef CurveConverter::CurveSegment CurveSegment;
+
+	struct Statistics
+	{
+		size_t numHits = 0;				// number of conversions that have been answered from the cache
+		size_t numMisses = 0;			// number of conversions that have been computed
+		size_t numEvicted = 0;			// number of entries that have been removed to stay within the size bound
+		size_t numCachedEntries = 0;
+		size_t numCachedPoints = 0;
+		double secondsConverting = 0;	// time of the computed conversions, including the conversion of their sub-curves
+
+		double hitRate() const
+		{
+			if( numHits + numMisses == 0 )
+			{
+				return 0;
+			}
+			return double(numHits) / double(numHits + numMisses);
+		}
+
+		double estimatedSecondsSaved() const
+		{
+			if( numMisses == 0 )
+			{
+				return 0;
+			}
+			return secondsConverting / double(numMisses) * double(numHits);
+		}
+	};
+
+	struct Key
+	{
+		const IfcCurve* curve = nullptr;
+		bool senseAgreement = true;
+		int numVerticesPerCircle = 0;
+		int minNumVerticesPerArc = 0;
+		int numVerticesPerControlPoint = 0;
+		double epsMergePoints = 0;
+		double lengthFactor = 1.0;
+		double angleFactor = 1.0;
+		std::vector<double> trims;	// number of trimming selects of Trim1, then type and values of each trimming select of Trim1 and Trim2
+
+		bool operator==(const Key& other) const;
+	};
+
+	CurveCache() = default;
+	CurveCache(const CurveCache&) = delete;
+	CurveCache& operator=(const CurveCache&) = delete;
+
+	static Key createKey(const shared_ptr<IfcCurve>& curve, const std::vector<shared_ptr<IfcTrimmingSelect> >& trim1_vec, const std::vector<shared_ptr<IfcTrimmingSelect> >& trim2_vec,
+		bool senseAgreement, const shared_ptr<GeometrySettings>& geom_settings, const shared_ptr<UnitConverter>& unit_converter);
+
+	//\brief Returns the cached segments and marks them as recently used, or nullptr
+	shared_ptr<const std::vector<CurveSegment> > find(const Key& key);
+
+	//\brief Stores the computed segments. If another thread has stored the same key in the meantime, its segments are returned instead
+	shared_ptr<const std::vector<CurveSegment> > insert(const Key& key, const shared_ptr<IfcCurve>& curve, const shared_ptr<const std::vector<CurveSegment> >& segments, int64_t nanosecondsConverting);
+
+	void clearCurveCache();
+
+	//\brief Maximum number of points of all cached curves. Segments with more points than fit into one shard are not cached
+	void setMaxNumCachedPoints(size_t maxNumPoints);
+	size_t getMaxNumCachedPoints() const { return m_max_num_points.load(std::memory_order_relaxed); }
+
+	Statistics getStatistics() const;
+	void resetStatistics();
+
+protected:
+	struct KeyHash
+	{
+		size_t operator()(const Key& key) const;
+	};
+
+	struct Entry
+	{
+		Key key;
+		shared_ptr<IfcCurve> curve;
+		shared_ptr<const std::vector<CurveSegment> > segments;
+		size_t numPoints = 0;
+	};
+
+	// sharded, so that parallel converter threads rarely wait for each other. Each shard has its own LRU list, most recently used first
+	static const size_t NUM_SHARDS = 64;
+	struct Shard
+	{
+		mutable std::mutex mutex;
+		std::list<Entry> lru;
+		std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> map;
+		size_t numPoints = 0;
+	};
+	Shard m_shards[NUM_SHARDS];
+
+	std::atomic<size_t> m_max_num_points{ 2000000 };
+	std::atomic<size_t> m_num_hits{ 0 };
+	std::atomic<size_t> m_num_misses{ 0 };
+	std::atomic<size_t> m_num_evicted{ 0 };
+	std::atomic<int64_t> m_nanoseconds_converting{ 0 };
+
+	Shard& getShard(const Key& key) { return m_shards[KeyHash()(key) % NUM_SHARDS]; }
+	void evict(Shard& shard, size_t maxNumPointsPerShard);
+};
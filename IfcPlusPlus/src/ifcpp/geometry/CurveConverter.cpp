@@ -15,6 +15,8 @@ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTH
 LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 */
 
+#include <algorithm>
+#include <chrono>
 #include <optional>
 #include <ifcpp/geometry/GeometryException.h>
 #include <ifcpp/geometry/GeometrySettings.h>
@@ -32,6 +34,7 @@ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OU
 #include <IfcCompositeCurve.h>
 #include <IfcCompositeCurveSegment.h>
 #include <IfcCurve.h>
+#include <IfcCurveMeasureSelect.h>
 #include <IfcCurveSegment.h>
 #include <IfcDirection.h>
 #include <IfcEdgeCurve.h>
@@ -63,14 +66,21 @@ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OU
 #include "PointConverter.h"
 #include "SplineConverter.h"
 #include "CurveConverter.h"
+#include "CurveCache.h"
 
 CurveConverter::CurveConverter(shared_ptr<GeometrySettings>& gs, shared_ptr<PlacementConverter>& placement_converter, shared_ptr<PointConverter>& pc, shared_ptr<SplineConverter>& sc)
 		: m_geom_settings(gs), m_placement_converter(placement_converter), m_point_converter(pc), m_spline_converter(sc)
 {
+	m_curve_cache = shared_ptr<CurveCache>(new CurveCache());
 }
 
 CurveConverter:: ~CurveConverter() {}
 
+void CurveConverter::clearCurveCache()
+{
+	m_curve_cache->clearCurveCache();
+}
+
 void CurveConverter::appendSegments(const std::vector<CurveSegment>& segmentsToAppend, std::vector<CurveSegment>& target_vec, double epsilonMergePoints)
 {
 	if (segmentsToAppend.size() == 0)
@@ -167,9 +177,194 @@ void CurveConverter::convertIfcCurve(const shared_ptr<IfcCurve>& ifc_curve, std:
 	convertIfcCurve(ifc_curve, segments, trim1_vec, trim2_vec, senseAgreement);
 }
 
-bool trimpointWarning = true;
+void CurveConverter::convertIfcDirectrix(const shared_ptr<IfcCurve>& directrix, const shared_ptr<IfcCurveMeasureSelect>& startParam, const shared_ptr<IfcCurveMeasureSelect>& endParam,
+	std::vector<vec3>& points) const
+{
+	double lengthFactor = m_point_converter->getUnitConverter()->getLengthInMeterFactor();
+	double epsilonMergePoints = m_geom_settings->getEpsilonMergePoints();
+
+	auto appendPoints = [&](const std::vector<CurveSegment>& segments, std::vector<vec3>& target)
+	{
+		for (const CurveSegment& seg : segments)
+		{
+			for (const vec3& point : seg.m_points)
+			{
+				if (target.size() > 0 && (target.back() - point).length() < epsilonMergePoints)
+				{
+					continue;
+				}
+				target.push_back(point);
+			}
+		}
+	};
+
+	// the segments are shared with the curve cache, the points are copied only once
+	std::vector<shared_ptr<IfcTrimmingSelect> > noTrims;
+	if (!startParam && !endParam)
+	{
+		appendPoints(*getCurveSegments(directrix, noTrims, noTrims, true), points);
+		return;
+	}
+
+	// conics and lines: parameter values are the angle and the multiple of the line vector, the same as for IfcTrimmedCurve
+	shared_ptr<IfcCurve> basis_curve = directrix;
+	std::vector<shared_ptr<IfcTrimmingSelect> > trim1_vec;
+	std::vector<shared_ptr<IfcTrimmingSelect> > trim2_vec;
+	bool senseAgreement = true;
+	shared_ptr<IfcTrimmedCurve> trimmed_curve = dynamic_pointer_cast<IfcTrimmedCurve>(directrix);
+	if (trimmed_curve && trimmed_curve->m_BasisCurve)
+	{
+		basis_curve = trimmed_curve->m_BasisCurve;
+		trim1_vec = trimmed_curve->m_Trim1;
+		trim2_vec = trimmed_curve->m_Trim2;
+		if (trimmed_curve->m_SenseAgreement) { senseAgreement = trimmed_curve->m_SenseAgreement->m_value; }
+	}
+
+	shared_ptr<IfcParameterValue> startParameter = dynamic_pointer_cast<IfcParameterValue>(startParam);
+	shared_ptr<IfcParameterValue> endParameter = dynamic_pointer_cast<IfcParameterValue>(endParam);
+	shared_ptr<IfcConic> conic = dynamic_pointer_cast<IfcConic>(basis_curve);
+	const bool allParameterValues = (!startParam || startParameter) && (!endParam || endParameter);
+	if (allParameterValues && (conic || dynamic_pointer_cast<IfcLine>(basis_curve)))
+	{
+		if (startParameter)
+		{
+			trim1_vec = { startParameter };
+		}
+		if (endParameter)
+		{
+			trim2_vec = { endParameter };
+		}
+
+		if (conic && trim1_vec.empty())
+		{
+			trim1_vec = { shared_ptr<IfcParameterValue>(new IfcParameterValue(0.0)) };
+		}
+		if (conic && trim2_vec.empty())
+		{
+			// without EndParam, the sweep ends at the end of the directrix, which is one full period in plane angle units
+			const double planeAngleFactor = m_point_converter->getUnitConverter()->getAngleInRadiantFactor();
+			trim2_vec = { shared_ptr<IfcParameterValue>(new IfcParameterValue(2.0 * M_PI / planeAngleFactor)) };
+		}
+		if (startParameter && endParameter && endParameter->m_value < startParameter->m_value)
+		{
+			senseAgreement = !senseAgreement;
+		}
+
+		appendPoints(*getCurveSegments(basis_curve, trim1_vec, trim2_vec, senseAgreement), points);
+		return;
+	}
+
+	// other curves, and length measures: trimmed at the arc length. Parameter values of polylines have one unit per segment
+	std::vector<vec3> curve_points;
+	appendPoints(*getCurveSegments(directrix, noTrims, noTrims, true), curve_points);
+	if (curve_points.size() < 2)
+	{
+		points = curve_points;
+		return;
+	}
+
+	std::vector<double> arc_lengths(curve_points.size(), 0.0);
+	for (size_t ii = 1; ii < curve_points.size(); ++ii)
+	{
+		arc_lengths[ii] = arc_lengths[ii - 1] + (curve_points[ii] - curve_points[ii - 1]).length() / lengthFactor;
+	}
+
+	shared_ptr<IfcPolyline> polyline = dynamic_pointer_cast<IfcPolyline>(directrix);
+	auto arcLengthAt = [&](const shared_ptr<IfcCurveMeasureSelect>& measure, double defaultLength) -> double
+	{
+		shared_ptr<IfcLengthMeasure> length = dynamic_pointer_cast<IfcLengthMeasure>(measure);
+		shared_ptr<IfcParameterValue> parameter = dynamic_pointer_cast<IfcParameterValue>(measure);
+		if (length)
+		{
+			return length->m_value;
+		}
+		if (parameter && polyline && polyline->m_Points.size() == curve_points.size())
+		{
+			const double index = std::max(0.0, std::min(parameter->m_value, double(curve_points.size() - 1)));
+			const size_t idx = std::min(size_t(index), curve_points.size() - 2);
+			return arc_lengths[idx] + (arc_lengths[idx + 1] - arc_lengths[idx]) * (index - double(idx));
+		}
+		if (parameter)
+		{
+			return parameter->m_value;
+		}
+		return defaultLength;
+	};
+
+	double start = arcLengthAt(startParam, 0.0);
+	double end = arcLengthAt(endParam, arc_lengths.back());
+	const bool reverse = end < start;
+	if (reverse)
+	{
+		std::swap(start, end);
+	}
+	start = std::max(start, 0.0);
+	end = std::min(end, arc_lengths.back());
+
+	auto pointAt = [&](double arc_length) -> vec3
+	{
+		size_t idx = std::upper_bound(arc_lengths.begin(), arc_lengths.end(), arc_length) - arc_lengths.begin();
+		idx = std::max(size_t(1), std::min(idx, arc_lengths.size() - 1));
+		const double segment_length = arc_lengths[idx] - arc_lengths[idx - 1];
+		const double t = segment_length > 0 ? (arc_length - arc_lengths[idx - 1]) / segment_length : 0;
+		return curve_points[idx - 1] + (curve_points[idx] - curve_points[idx - 1]) * t;
+	};
+
+	points.push_back(pointAt(start));
+	for (size_t ii = 0; ii < curve_points.size(); ++ii)
+	{
+		if (arc_lengths[ii] > start && arc_lengths[ii] < end)
+		{
+			points.push_back(curve_points[ii]);
+		}
+	}
+	points.push_back(pointAt(end));
+	if (reverse)
+	{
+		std::reverse(points.begin(), points.end());
+	}
+}
+
 void CurveConverter::convertIfcCurve(const shared_ptr<IfcCurve>& ifc_curve, std::vector<CurveSegment>& resultSegments,
 	std::vector<shared_ptr<IfcTrimmingSelect> >& trim1_vec, std::vector<shared_ptr<IfcTrimmingSelect> >& trim2_vec, bool senseAgreement) const
+{
+	shared_ptr<const std::vector<CurveSegment> > segments = getCurveSegments(ifc_curve, trim1_vec, trim2_vec, senseAgreement);
+	if (resultSegments.empty())
+	{
+		resultSegments = *segments;
+		return;
+	}
+	appendSegments(*segments, resultSegments, m_geom_settings->getEpsilonMergePoints());
+}
+
+shared_ptr<const std::vector<CurveConverter::CurveSegment> > CurveConverter::getCurveSegments(const shared_ptr<IfcCurve>& ifc_curve, std::vector<shared_ptr<IfcTrimmingSelect> >& trim1_vec,
+	std::vector<shared_ptr<IfcTrimmingSelect> >& trim2_vec, bool senseAgreement) const
+{
+	if (!ifc_curve)
+	{
+		shared_ptr<std::vector<CurveSegment> > segments(new std::vector<CurveSegment>());
+		convertIfcCurveUncached(ifc_curve, *segments, trim1_vec, trim2_vec, senseAgreement);
+		return segments;
+	}
+
+	CurveCache::Key key = CurveCache::createKey(ifc_curve, trim1_vec, trim2_vec, senseAgreement, m_geom_settings, m_point_converter->getUnitConverter());
+	shared_ptr<const std::vector<CurveSegment> > cached = m_curve_cache->find(key);
+	if (cached)
+	{
+		return cached;
+	}
+
+	// not locked while converting, since sub-curves of composite and trimmed curves are looked up recursively. If two threads convert the same curve, the first result is kept
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	shared_ptr<std::vector<CurveSegment> > segments(new std::vector<CurveSegment>());
+	convertIfcCurveUncached(ifc_curve, *segments, trim1_vec, trim2_vec, senseAgreement);
+	const int64_t nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+	return m_curve_cache->insert(key, ifc_curve, segments, nanoseconds);
+}
+
+bool trimpointWarning = true;
+void CurveConverter::convertIfcCurveUncached(const shared_ptr<IfcCurve>& ifc_curve, std::vector<CurveSegment>& resultSegments,
+	std::vector<shared_ptr<IfcTrimmingSelect> >& trim1_vec, std::vector<shared_ptr<IfcTrimmingSelect> >& trim2_vec, bool senseAgreement) const
 {
 	double lengthFactor = m_point_converter->getUnitConverter()->getLengthInMeterFactor();
 	double epsilonMergePoints = m_geom_settings->getEpsilonMergePoints();
@@ -181,6 +376,24 @@ void CurveConverter::convertIfcCurve(const shared_ptr<IfcCurve>& ifc_curve, std:
 		shared_ptr<IfcCompositeCurve> composite_curve = dynamic_pointer_cast<IfcCompositeCurve>(bounded_curve);
 		if (composite_curve)
 		{
+			if (AlignmentConverter::isAlignmentCurve(composite_curve))
+			{
+				// IfcCurveSegment with placements, spirals, gradient and cant: evaluated exactly along the whole curve
+				shared_ptr<AlignmentCurve> alignmentCurve = m_placement_converter->getAlignmentConverter()->getAlignmentCurve(composite_curve);
+				if (alignmentCurve)
+				{
+					resultSegments.push_back(CurveSegment(CurveSegment::CURVE_TYPE_POLYLINE));
+					CurveSegment& currentSegment = resultSegments.back();
+					const double maxTurnAngle = 2.0 * M_PI / double(std::max(m_geom_settings->getNumVerticesPerCircle(), 3));
+					alignmentCurve->getPoints(maxTurnAngle, m_geom_settings->getMinNumVerticesPerArc(), currentSegment.m_points);
+					if (!senseAgreement)
+					{
+						currentSegment.reverseOrientation();
+					}
+					return;
+				}
+			}
+
 			// ENTITY IfcBoundedCurve ABSTRACT SUPERTYPE OF	(ONEOF(IfcCompositeCurve, IfcPolyline, IfcTrimmedCurve, IfcBSplineCurve))
 			for (const shared_ptr<IfcSegment>& ifcSegment : composite_curve->m_Segments)
 			{
@@ -527,6 +740,13 @@ void CurveConverter::convertIfcCurve(const shared_ptr<IfcCurve>& ifc_curve, std:
 		getTrimAngle(trim2_vec, circleCenter, circleRadius, circleRadius2, endAngle, circlePosition, circlePositionInverse);
 		computeOpeningAngle(startAngle, endAngle, epsilonMergePoints, senseAgreement, openingAngle);
 
+		if (std::abs(openingAngle) < epsilonMergePoints && trim1_vec.size() > 0 && trim2_vec.size() > 0)
+		{
+			// coinciding trim points, for example a circular edge with the same start and end vertex, close the conic
+			openingAngle = senseAgreement ? M_PI * 2.0 : -M_PI * 2.0;
+			endAngle = startAngle + openingAngle;
+		}
+
 		if (trim1_vec.size() == 0 && trim2_vec.size() == 0)
 		{
 			// no trimming, add full circle
@@ -668,19 +888,20 @@ void CurveConverter::convertIfcCurve(const shared_ptr<IfcCurve>& ifc_curve, std:
 				line_direction.normalize();
 			}
 
-			line_end = line_origin + line_direction;  // will be overwritten by trimming points in most cases
+			// parameter u is a multiple of the magnitude of the line vector
+			double parameter_length = lengthFactor;
 			if (line_vec->m_Magnitude)
 			{
-				line_end = line_origin + line_direction * line_vec->m_Magnitude->m_value;
+				parameter_length = line_vec->m_Magnitude->m_value * lengthFactor;
 			}
+			const vec3 line_point = line_origin;
+			line_end = line_point + line_direction * parameter_length;  // will be overwritten by trimming points in most cases
 
 			// check for trimming at beginning of line
-			double start_parameter = 0.0;
 			shared_ptr<IfcParameterValue> trim_par1;
 			if (GeomUtils::findFirstInVector(trim1_vec, trim_par1))
 			{
-				start_parameter = trim_par1->m_value;
-				line_origin = line_origin + line_direction * start_parameter;
+				line_origin = line_point + line_direction * (trim_par1->m_value * parameter_length);
 			}
 			else
 			{
@@ -710,7 +931,7 @@ void CurveConverter::convertIfcCurve(const shared_ptr<IfcCurve>& ifc_curve, std:
 			shared_ptr<IfcParameterValue> trim_par2;
 			if (GeomUtils::findFirstInVector(trim2_vec, trim_par2))
 			{
-				line_end = line_origin + line_direction * trim_par2->m_value * lengthFactor;
+				line_end = line_point + line_direction * (trim_par2->m_value * parameter_length);
 			}
 			else
 			{
@@ -1053,6 +1274,20 @@ void CurveConverter::convertIfcEdge(const shared_ptr<IfcEdge>& edge, std::vector
 			{
 				std::copy(seg.m_points.begin(), seg.m_points.end(), std::back_inserter(curvePoints));
 			}
+
+			// use the exact vertex points at the ends, so that the faces sharing the edge or vertex are welded, also where the curve is evaluated with rounding errors, like at the end of a full circle
+			const double eps = m_geom_settings->getEpsilonMergePoints();
+			if (curvePoints.size() > 1)
+			{
+				if (hasEdgeStart && (curvePoints.front() - p0).length2() < eps * eps * 100.0)
+				{
+					curvePoints.front() = p0;
+				}
+				if (hasEdgeEnd && (curvePoints.back() - p1).length2() < eps * eps * 100.0)
+				{
+					curvePoints.back() = p1;
+				}
+			}
 		}
 		else
 		{
@@ -34,6 +34,7 @@ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OU
 #include <IfcCompositeCurve.h>
 #include <IfcCompositeCurveSegment.h>
 #include <IfcCurve.h>
+#include <IfcCurveMeasureSelect.h>
 #include <IfcCurveSegment.h>
 #include <IfcDirection.h>
 #include <IfcEdgeCurve.h>
@@ -66,6 +67,7 @@ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OU
 #include "SplineConverter.h"
 #include "IncludeCarveHeaders.h"
 
+class CurveCache;
 
 //\brief class to convert different types of IFC curve representations into carve input geometry
 class CurveConverter : public StatusCallback
@@ -75,6 +77,7 @@ protected:
 	shared_ptr<PlacementConverter>	m_placement_converter;
 	shared_ptr<PointConverter>		m_point_converter;
 	shared_ptr<SplineConverter>		m_spline_converter;
+	shared_ptr<CurveCache>			m_curve_cache;
 	bool m_debugDumpGeometry = false;
 
 public:
@@ -110,6 +113,8 @@ public:
 	const shared_ptr<PlacementConverter>& getPlacementConverter() { return m_placement_converter; }
 	const shared_ptr<PointConverter>& getPointConverter() { return m_point_converter; }
 	const shared_ptr<SplineConverter>& getSplineConverter() { return m_spline_converter; }
+	const shared_ptr<CurveCache>& getCurveCache() { return m_curve_cache; }
+	void clearCurveCache();
 
 	void convertIfcCurve2D(const shared_ptr<IfcCurve>& ifc_curve, std::vector<vec2>& loops, std::vector<vec2>& segment_start_points, bool senseAgreement) const;
 
@@ -121,7 +126,18 @@ public:
 
 	void convertIfcCurve(const shared_ptr<IfcCurve>& ifc_curve, std::vector<CurveSegment>& resultSegments,
 		std::vector<shared_ptr<IfcTrimmingSelect> >& trim1_vec, std::vector<shared_ptr<IfcTrimmingSelect> >& trim2_vec, bool senseAgreement) const;
+
+	//\brief Returns the discretized curve. It is computed once per curve, trimming, sense and discretization settings, and shared by all callers. The segments must not be modified
+	shared_ptr<const std::vector<CurveSegment> > getCurveSegments(const shared_ptr<IfcCurve>& ifc_curve, std::vector<shared_ptr<IfcTrimmingSelect> >& trim1_vec,
+		std::vector<shared_ptr<IfcTrimmingSelect> >& trim2_vec, bool senseAgreement) const;
 	
+	//\brief Discretizes the directrix of a swept solid between its optional parameters StartParam and EndParam
+	///@details Parameter values of conics and lines are trimmed exactly in their own parametrisation, the angle and the multiple of the line vector.
+	///Parameter values of polylines have one unit per segment. Length measures, and parameter values of all other curves, are arc lengths.
+	///If the end is before the start, the points are reversed
+	void convertIfcDirectrix(const shared_ptr<IfcCurve>& directrix, const shared_ptr<IfcCurveMeasureSelect>& startParam, const shared_ptr<IfcCurveMeasureSelect>& endParam,
+		std::vector<vec3>& points) const;
+
 	void getTrimAngle(const std::vector<shared_ptr<IfcTrimmingSelect> >& trimSelect1, const vec3& circleCenter, double radius1, double radius2,
 		double& trimAngle1, const carve::math::Matrix& circlePlacement, const carve::math::Matrix& circlePlacementInverse) const;
 
@@ -141,4 +157,8 @@ public:
 	void convertIfcLoop(const shared_ptr<IfcLoop>& loop, std::vector<vec3>& loopPoints) const;
 
 	static void computeOpeningAngle(double startAngle, double endAngle, double eps, bool senseAgreement, double& openingAngle);
+
+protected:
+	void convertIfcCurveUncached(const shared_ptr<IfcCurve>& ifc_curve, std::vector<CurveSegment>& resultSegments,
+		std::vector<shared_ptr<IfcTrimmingSelect> >& trim1_vec, std::vector<shared_ptr<IfcTrimmingSelect> >& trim2_vec, bool senseAgreement) const;
 };
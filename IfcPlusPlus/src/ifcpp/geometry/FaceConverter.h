@@ -23,17 +23,27 @@ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OU
 #include <ifcpp/model/UnitConverter.h>
 
 #include <IfcAdvancedFace.h>
+#include <IfcArbitraryOpenProfileDef.h>
+#include <IfcAxis1Placement.h>
+#include <IfcBoundaryCurve.h>
+#include <IfcCenterLineProfileDef.h>
 #include <IfcCurveBoundedPlane.h>
 #include <IfcCurveBoundedSurface.h>
 #include <IfcCylindricalSurface.h>
+#include <IfcEdgeLoop.h>
 #include <IfcFace.h>
 #include <IfcFaceBound.h>
+#include <IfcOrientedEdge.h>
+#include <IfcParameterValue.h>
 #include <IfcPlane.h>
 #include <IfcRationalBSplineSurfaceWithKnots.h>
 #include <IfcRectangularTrimmedSurface.h>
+#include <IfcSphericalSurface.h>
 #include <IfcSurfaceOfLinearExtrusion.h>
 #include <IfcSurfaceOfRevolution.h>
 #include <IfcSweptSurface.h>
+#include <IfcToroidalSurface.h>
+#include <IfcVertexLoop.h>
 
 #include "IncludeCarveHeaders.h"
 #include "GeometryInputData.h"
@@ -42,6 +52,7 @@ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OU
 #include "PolyInputCache3D.h"
 #include "ProfileCache.h"
 #include "Sweeper.h"
+#include "SurfaceTessellator.h"
 
 class SurfaceProxy
 {
@@ -160,36 +171,117 @@ public:
 			{
 				shared_ptr<IfcCurveBoundedSurface> curve_bounded_surface = dynamic_pointer_cast<IfcCurveBoundedSurface>( bounded_surface );
 				shared_ptr<IfcSurface>& basis_surface = curve_bounded_surface->m_BasisSurface;
-				if( basis_surface )
+				if( !basis_surface )
 				{
-					convertIfcSurface( basis_surface, item_data, surface_proxy );
+					return;
 				}
 
-				// TODO: implement
-#ifdef _DEBUG
-				std::cout << "IfcCurveBoundedSurface boundaries not implemented." << std::endl;
-#endif
+				// boundaries are curves on the basis surface. The face is on the left side of each boundary, seen against the surface normal
+				double eps = m_geom_settings->getEpsilonMergePoints();
+				std::vector<std::vector<vec3> > face_loops;
+				for( const shared_ptr<IfcBoundaryCurve>& boundary : curve_bounded_surface->m_Boundaries )
+				{
+					if( !boundary )
+					{
+						continue;
+					}
+					std::vector<CurveConverter::CurveSegment> segments;
+					face_loops.push_back( std::vector<vec3>() );
+					m_curve_converter->convertIfcCurve( boundary, segments, true );
+					for( auto& seg : segments )
+					{
+						std::copy( seg.m_points.begin(), seg.m_points.end(), std::back_inserter( face_loops.back() ) );
+					}
+					GeomUtils::removeDuplicates( face_loops.back(), eps );
+					GeomUtils::unClosePolygon( face_loops.back(), eps );
+				}
+
+				shared_ptr<AnalyticSurface> analytic_surface = createAnalyticSurface( basis_surface );
+				if( analytic_surface && face_loops.size() > 0 )
+				{
+					PolyInputCache3D poly_cache( eps );
+					GeomProcessingParams params( m_geom_settings, curve_bounded_surface.get(), this );
+					bool triangulated = true;
+					if( analytic_surface->m_type == AnalyticSurface::SURFACE_PLANE )
+					{
+						createTriangulated3DFace( face_loops, poly_cache, params, false );
+					}
+					else
+					{
+						triangulated = SurfaceTessellator::triangulateFace( *analytic_surface, face_loops, true, poly_cache, eps );
+					}
+					if( triangulated )
+					{
+						item_data->addOpenPolyhedron( poly_cache.m_poly_data, params );
+						return;
+					}
+				}
+
+				messageCallback( "IfcCurveBoundedSurface: boundaries could not be mapped to the basis surface", StatusCallback::MESSAGE_TYPE_MINOR_WARNING, __FUNC__, curve_bounded_surface.get() );
+				convertIfcSurface( basis_surface, item_data, surface_proxy );
 			}
 			else if( dynamic_pointer_cast<IfcRectangularTrimmedSurface>( bounded_surface ) )
 			{
 				shared_ptr<IfcRectangularTrimmedSurface> rectengular_trimmed_surface = dynamic_pointer_cast<IfcRectangularTrimmedSurface>( bounded_surface );
 
 				shared_ptr<IfcSurface>& basis_surface = rectengular_trimmed_surface->m_BasisSurface;
-				if( basis_surface )
+				if( !basis_surface )
+				{
+					return;
+				}
+
+				shared_ptr<AnalyticSurface> analytic_surface = createAnalyticSurface( basis_surface );
+				const shared_ptr<IfcParameterValue>& u1 = rectengular_trimmed_surface->m_U1;
+				const shared_ptr<IfcParameterValue>& v1 = rectengular_trimmed_surface->m_V1;
+				const shared_ptr<IfcParameterValue>& u2 = rectengular_trimmed_surface->m_U2;
+				const shared_ptr<IfcParameterValue>& v2 = rectengular_trimmed_surface->m_V2;
+				if( !analytic_surface || !u1 || !v1 || !u2 || !v2 )
 				{
 					convertIfcSurface( basis_surface, item_data, surface_proxy );
+					return;
 				}
 
-				//shared_ptr<IfcParameterValue>& u1 = rectengular_trimmed_surface->m_U1;
-				//shared_ptr<IfcParameterValue>& v1 = rectengular_trimmed_surface->m_V1;
-				//shared_ptr<IfcParameterValue>& u2 = rectengular_trimmed_surface->m_U2;
-				//shared_ptr<IfcParameterValue>& v2 = rectengular_trimmed_surface->m_V2;
-				//bool u_sense = rectengular_trimmed_surface->m_Usense;
-				//bool v_sense = rectengular_trimmed_surface->m_Vsense;
-				// TODO: implement
-#ifdef _DEBUG
-				std::cout << "IfcRectangularTrimmedSurface U1, V1, U2, V2 not implemented." << std::endl;
-#endif
+				double range[2][2] = { { u1->m_value, u2->m_value }, { v1->m_value, v2->m_value } };
+				bool sense[2] = { true, true };
+				if( rectengular_trimmed_surface->m_Usense )
+				{
+					sense[0] = rectengular_trimmed_surface->m_Usense->m_value;
+				}
+				if( rectengular_trimmed_surface->m_Vsense )
+				{
+					sense[1] = rectengular_trimmed_surface->m_Vsense->m_value;
+				}
+				for( int dim = 0; dim < 2; ++dim )
+				{
+					// angles are in the plane angle unit, arc lengths and plane coordinates in the length unit
+					double factor = isAngleParameter( *analytic_surface, dim ) ? m_unit_converter->getAngleInRadiantFactor() : m_unit_converter->getLengthInMeterFactor();
+					if( analytic_surface->m_type == AnalyticSurface::SURFACE_LINEAR_EXTRUSION && dim == 1 )
+					{
+						// multiple of the extrusion vector
+						factor = 1.0;
+					}
+					range[dim][0] *= factor;
+					range[dim][1] *= factor;
+
+					const double period = analytic_surface->m_period[dim];
+					if( period > 0 )
+					{
+						if( sense[dim] && range[dim][1] <= range[dim][0] )
+						{
+							range[dim][1] += period;
+						}
+						else if( !sense[dim] && range[dim][1] >= range[dim][0] )
+						{
+							range[dim][1] -= period;
+						}
+					}
+				}
+
+				double eps = m_geom_settings->getEpsilonMergePoints();
+				PolyInputCache3D poly_cache( eps );
+				GeomProcessingParams params( m_geom_settings, rectengular_trimmed_surface.get(), this );
+				SurfaceTessellator::triangulatePatch( *analytic_surface, range[0][0], range[0][1], range[1][0], range[1][1], true, poly_cache, eps );
+				item_data->addOpenPolyhedron( poly_cache.m_poly_data, params );
 			}
 			return;
 		}
@@ -311,7 +403,11 @@ public:
 						}
 
 						GeomProcessingParams params(m_geom_settings, surface.get(), this);
-						m_sweeper->extrude(swept_profile, extrusion_direction, item_data, params);
+						shared_ptr<ExtrusionCapTriangulation> caps = m_profile_cache->getExtrusionCapTriangulation(swept_surface_profile, profileCon);
+						if (caps && swept_profile.size() > 0)
+						{
+							m_sweeper->extrude(*caps, extrusion_direction, item_data, params);
+						}
 					}
 
 					return;
@@ -320,10 +416,16 @@ public:
 			shared_ptr<IfcSurfaceOfRevolution> suface_of_revolution = dynamic_pointer_cast<IfcSurfaceOfRevolution>( swept_surface );
 			if( suface_of_revolution )
 			{
-				// TODO: implement
-#ifdef _DEBUG
-				std::cout << "IfcSurfaceOfRevolution not implemented." << std::endl;
-#endif
+				// full revolution of the swept curve
+				shared_ptr<AnalyticSurface> analytic_surface = createAnalyticSurface( suface_of_revolution );
+				if( analytic_surface )
+				{
+					double eps = m_geom_settings->getEpsilonMergePoints();
+					PolyInputCache3D poly_cache( eps );
+					GeomProcessingParams params( m_geom_settings, suface_of_revolution.get(), this );
+					SurfaceTessellator::triangulatePatch( *analytic_surface, analytic_surface->m_range_min[0], analytic_surface->m_range_max[0], 0.0, 2.0 * M_PI, true, poly_cache, eps );
+					item_data->addOpenPolyhedron( poly_cache.m_poly_data, params );
+				}
 				return;
 			}
 
@@ -332,134 +434,276 @@ public:
 		throw UnhandledRepresentationException( surface );
 	}
 
-	void convertIfcFaceList( const std::vector<shared_ptr<IfcFace> >& vec_faces, shared_ptr<ItemShapeData> item_data, ShellType st )
+	//\brief Parametric form of the surface of an IfcAdvancedFace, or of the basis surface of a bounded surface
+	///@return nullptr if the surface type is not supported or degenerated
+	shared_ptr<AnalyticSurface> createAnalyticSurface( const shared_ptr<IfcSurface>& surface )
 	{
-		if( vec_faces.size() == 0 )
-		{
-			return;
-		}
-		double eps = m_geom_settings->getEpsilonMergePoints();
-		PolyInputCache3D poly_cache(eps);
-		GeomProcessingParams params( m_geom_settings, nullptr,  this );
+		shared_ptr<AnalyticSurface> analytic_surface( new AnalyticSurface() );
+		const double length_factor = m_unit_converter->getLengthInMeterFactor();
+		shared_ptr<TransformData> surface_transform;
 
-		if (item_data)
+		shared_ptr<IfcElementarySurface> elementary_surface = dynamic_pointer_cast<IfcElementarySurface>( surface );
+		shared_ptr<IfcSweptSurface> swept_surface = dynamic_pointer_cast<IfcSweptSurface>( surface );
+		if( elementary_surface )
 		{
-			// some linux debugging
-			std::string tagString = "";
-			if(!item_data->m_ifc_representation.expired() )
+			if( elementary_surface->m_Position )
+			{
+				m_curve_converter->getPlacementConverter()->convertIfcAxis2Placement3D( elementary_surface->m_Position, surface_transform );
+			}
+
+			shared_ptr<IfcCylindricalSurface> cylindrical_surface = dynamic_pointer_cast<IfcCylindricalSurface>( elementary_surface );
+			shared_ptr<IfcSphericalSurface> spherical_surface = dynamic_pointer_cast<IfcSphericalSurface>( elementary_surface );
+			shared_ptr<IfcToroidalSurface> toroidal_surface = dynamic_pointer_cast<IfcToroidalSurface>( elementary_surface );
+			if( dynamic_pointer_cast<IfcPlane>( elementary_surface ) )
 			{
-				shared_ptr<IfcRepresentation> representation( item_data->m_ifc_representation );
-				tagString = ", representation tag: " + std::to_string(representation->m_tag);
+				analytic_surface->m_type = AnalyticSurface::SURFACE_PLANE;
 			}
-			if (!item_data->m_product.expired())
+			else if( cylindrical_surface && cylindrical_surface->m_Radius )
 			{
-				shared_ptr<ProductShapeData> shapeData(item_data->m_product);
-				tagString = ", product guid: " + shapeData->m_entity_guid;
+				analytic_surface->m_type = AnalyticSurface::SURFACE_CYLINDER;
+				analytic_surface->m_radius = cylindrical_surface->m_Radius->m_value * length_factor;
+			}
+			else if( spherical_surface && spherical_surface->m_Radius )
+			{
+				analytic_surface->m_type = AnalyticSurface::SURFACE_SPHERE;
+				analytic_surface->m_radius = spherical_surface->m_Radius->m_value * length_factor;
+			}
+			else if( toroidal_surface && toroidal_surface->m_MajorRadius && toroidal_surface->m_MinorRadius )
+			{
+				analytic_surface->m_type = AnalyticSurface::SURFACE_TORUS;
+				analytic_surface->m_radius = toroidal_surface->m_MajorRadius->m_value * length_factor;
+				analytic_surface->m_minor_radius = toroidal_surface->m_MinorRadius->m_value * length_factor;
+			}
+			else
+			{
+				return nullptr;
 			}
-			
-			printToDebugLog(__FUNC__, "num faces: " + std::to_string(vec_faces.size()) + tagString);
 		}
-		
-		for( size_t ii = 0; ii < vec_faces.size(); ++ii )
+		else if( swept_surface )
 		{
-			const shared_ptr<IfcFace>& ifc_face = vec_faces[ii];
-			if( !ifc_face )
+			// the swept curve is parametrised by its arc length
+			const shared_ptr<IfcProfileDef>& swept_surface_profile = swept_surface->m_SweptCurve;
+			shared_ptr<ProfileConverter> profile_converter = m_profile_cache->getProfileConverter( swept_surface_profile, true );
+			if( !profile_converter || profile_converter->getCoordinates().empty() )
 			{
-				continue;
+				return nullptr;
 			}
+			for( const vec2& point : profile_converter->getCoordinates()[0] )
+			{
+				analytic_surface->m_curve_points.push_back( carve::geom::VECTOR( point.x, point.y, 0.0 ) );
+			}
+			analytic_surface->m_curve_closed = !dynamic_pointer_cast<IfcArbitraryOpenProfileDef>( swept_surface_profile ) || dynamic_pointer_cast<IfcCenterLineProfileDef>( swept_surface_profile );
 
-			const std::vector<shared_ptr<IfcFaceBound> >& vec_bounds = ifc_face->m_Bounds;
-			std::vector<std::vector<vec3> > face_loops;
-			params.ifc_entity = ifc_face.get();
-
-			for( auto it_bounds = vec_bounds.begin(); it_bounds != vec_bounds.end(); ++it_bounds )
+			if( swept_surface->m_Position )
 			{
-				const shared_ptr<IfcFaceBound>& face_bound = ( *it_bounds );
+				m_curve_converter->getPlacementConverter()->convertIfcAxis2Placement3D( swept_surface->m_Position, surface_transform );
+			}
 
-				if( !face_bound )
+			shared_ptr<IfcSurfaceOfRevolution> surface_of_revolution = dynamic_pointer_cast<IfcSurfaceOfRevolution>( swept_surface );
+			shared_ptr<IfcSurfaceOfLinearExtrusion> linear_extrusion = dynamic_pointer_cast<IfcSurfaceOfLinearExtrusion>( swept_surface );
+			if( surface_of_revolution && surface_of_revolution->m_AxisPosition )
+			{
+				const shared_ptr<IfcAxis1Placement>& axis_position = surface_of_revolution->m_AxisPosition;
+				analytic_surface->m_type = AnalyticSurface::SURFACE_REVOLUTION;
+				analytic_surface->m_axis_location = carve::geom::VECTOR( 0, 0, 0 );
+				analytic_surface->m_axis_direction = carve::geom::VECTOR( 0, 0, 1 );
+				PointConverter::convertIfcCartesianPoint( dynamic_pointer_cast<IfcCartesianPoint>( axis_position->m_Location ), analytic_surface->m_axis_location, length_factor );
+				if( axis_position->m_Axis && axis_position->m_Axis->m_DirectionRatios.size() > 2 )
 				{
-					continue;
+					const std::vector<shared_ptr<IfcReal> >& ratios = axis_position->m_Axis->m_DirectionRatios;
+					analytic_surface->m_axis_direction = carve::geom::VECTOR( ratios[0]->m_value, ratios[1]->m_value, ratios[2]->m_value );
 				}
-
-				// ENTITY IfcLoop SUPERTYPE OF(ONEOF(IfcEdgeLoop, IfcPolyLoop, IfcVertexLoop))
-				const shared_ptr<IfcLoop>& loop = face_bound->m_Bound;
-				if( !loop )
+			}
+			else if( linear_extrusion && linear_extrusion->m_ExtrudedDirection && linear_extrusion->m_ExtrudedDirection->m_DirectionRatios.size() > 2 )
+			{
+				const std::vector<shared_ptr<IfcReal> >& ratios = linear_extrusion->m_ExtrudedDirection->m_DirectionRatios;
+				analytic_surface->m_type = AnalyticSurface::SURFACE_LINEAR_EXTRUSION;
+				analytic_surface->m_extrusion_direction = carve::geom::VECTOR( ratios[0]->m_value, ratios[1]->m_value, ratios[2]->m_value );
+				analytic_surface->m_extrusion_direction.normalize();
+				if( linear_extrusion->m_Depth )
 				{
-					if( it_bounds == vec_bounds.begin() )
-					{
-						break;
-					}
-					else
-					{
-						continue;
-					}
+					analytic_surface->m_extrusion_direction *= linear_extrusion->m_Depth->m_value * length_factor;
 				}
+			}
+			else
+			{
+				return nullptr;
+			}
+		}
+		else
+		{
+			return nullptr;
+		}
 
-				face_loops.push_back( std::vector<vec3>() );
-				std::vector<vec3>& loop_points = face_loops.back();
+		if( surface_transform )
+		{
+			analytic_surface->m_position = surface_transform->m_matrix;
+		}
+		if( !analytic_surface->init( *m_geom_settings, m_geom_settings->getEpsilonMergePoints() ) )
+		{
+			return nullptr;
+		}
+		return analytic_surface;
+	}
+
+	static bool isAngleParameter( const AnalyticSurface& surface, int parameter )
+	{
+		switch( surface.m_type )
+		{
+		case AnalyticSurface::SURFACE_CYLINDER:
+			return parameter == 0;
+		case AnalyticSurface::SURFACE_SPHERE:
+		case AnalyticSurface::SURFACE_TORUS:
+			return true;
+		case AnalyticSurface::SURFACE_REVOLUTION:
+			return parameter == 1;
+		default:
+			return false;
+		}
+	}
 
-				m_curve_converter->convertIfcLoop( loop, loop_points );
+	void convertIfcFaceList( const std::vector<shared_ptr<IfcFace> >& vec_faces, shared_ptr<ItemShapeData> item_data, ShellType st )
+	{
+		if( vec_faces.size() == 0 )
+		{
+			return;
+		}
+		double eps = m_geom_settings->getEpsilonMergePoints();
+		PolyInputCache3D poly_cache(eps);
+		GeomProcessingParams params( m_geom_settings, nullptr,  this );
 
-				if( loop_points.size() < 3 )
+		// product and representation are visible in the enclosing trace scopes
+		CARVE_TRACE_SCOPE(__FUNC__, vec_faces.size());
+
+		// Edges of advanced faces are converted once, so that adjacent faces use exactly the same points along their common edge, and curved faces
+		// that are tessellated independently still form a closed mesh
+		std::map<const IfcEdge*, std::vector<vec3> > map_edge_points;
+		std::vector<shared_ptr<IfcEdge> > vec_edges;
+		size_t numCurvedFaces = 0;
+		for( const shared_ptr<IfcFace>& ifc_face : vec_faces )
+		{
+			shared_ptr<IfcAdvancedFace> advanced_face = dynamic_pointer_cast<IfcAdvancedFace>( ifc_face );
+			if( !advanced_face )
+			{
+				continue;
+			}
+			if( advanced_face->m_FaceSurface && !dynamic_pointer_cast<IfcPlane>( advanced_face->m_FaceSurface ) )
+			{
+				++numCurvedFaces;
+			}
+			for( const shared_ptr<IfcFaceBound>& face_bound : advanced_face->m_Bounds )
+			{
+				shared_ptr<IfcEdgeLoop> edge_loop = face_bound ? dynamic_pointer_cast<IfcEdgeLoop>( face_bound->m_Bound ) : nullptr;
+				if( !edge_loop )
 				{
-					if( it_bounds == vec_bounds.begin() )
-					{
-						break;
-					}
-					else
+					continue;
+				}
+				for( const shared_ptr<IfcOrientedEdge>& oriented_edge : edge_loop->m_EdgeList )
+				{
+					if( oriented_edge && oriented_edge->m_EdgeElement && map_edge_points.insert( { oriented_edge->m_EdgeElement.get(), std::vector<vec3>() } ).second )
 					{
-						continue;
+						vec_edges.push_back( oriented_edge->m_EdgeElement );
 					}
 				}
-
-				bool orientation = true;
-				if( face_bound->m_Orientation )
+			}
+		}
+		if( vec_edges.size() > 0 )
+		{
+			const double length_factor = m_unit_converter->getLengthInMeterFactor();
+			FOR_EACH_LOOP vec_edges.begin(), vec_edges.end(), [&](const shared_ptr<IfcEdge>& edge) {
+				try
 				{
-					orientation = face_bound->m_Orientation->m_value;
+					m_curve_converter->convertIfcEdge( edge, map_edge_points.find( edge.get() )->second, length_factor );
 				}
-				if( !orientation )
+				catch( ... )
 				{
-					std::reverse( loop_points.begin(), loop_points.end() );
+					// the edge is converted again with the face, where the error is reported
+					map_edge_points.find( edge.get() )->second.clear();
 				}
-			}
+			});
+		}
+		const std::map<const IfcEdge*, std::vector<vec3> >* edge_points = map_edge_points.size() > 0 ? &map_edge_points : nullptr;
 
-			for( size_t iiLoop = 0; iiLoop < face_loops.size(); ++iiLoop )
+		size_t numFaces = vec_faces.size();
+		size_t chunkSize = std::max(m_geom_settings->m_numFacesPerTriangulationChunk, size_t(1));
+		size_t minNumFacesParallel = m_geom_settings->m_minNumFacesParallelTriangulation;
+		if( numCurvedFaces > 1 )
+		{
+			// tessellating a curved face costs as much as thousands of planar faces
+			chunkSize = std::max( std::min( chunkSize, numFaces / 64 ), size_t( 1 ) );
+			minNumFacesParallel = 0;
+		}
+		if( numFaces < minNumFacesParallel || numFaces <= chunkSize )
+		{
+			for( size_t ii = 0; ii < numFaces; ++ii )
 			{
-				std::vector<vec3>& loop = face_loops[iiLoop];
-				GeomUtils::unClosePolygon(loop, params.epsMergePoints);
+				const shared_ptr<IfcFace>& ifc_face = vec_faces[ii];
+				if( !ifc_face )
+				{
+					continue;
+				}
+				convertIfcFace( ifc_face, poly_cache, params, edge_points );
 			}
-			
-			createTriangulated3DFace( face_loops, poly_cache, params, false );
-
-#ifdef _DEBUG
-			if( ifc_face->m_tag == 279929)
+		}
+		else
+		{
+			// Triangulate chunks of faces in parallel. Each chunk only records its points and faces, then they are welded
+			// into poly_cache in the original face order, so the result is identical to the sequential loop above
+			struct FaceChunk
 			{
-				params.debugDump = true;
+				size_t begin = 0;
+				size_t end = 0;
+				shared_ptr<PolyInputCache3D> cache;
+				std::exception_ptr exception;
+			};
+			std::vector<FaceChunk> vecChunks;
+			for( size_t ii = 0; ii < numFaces; ii += chunkSize )
+			{
+				FaceChunk chunk;
+				chunk.begin = ii;
+				chunk.end = std::min(ii + chunkSize, numFaces);
+				chunk.cache = std::make_shared<PolyInputCache3D>( eps, true );
+				vecChunks.push_back( chunk );
 			}
 
-			shared_ptr<IfcAdvancedFace> advancedFace = dynamic_pointer_cast<IfcAdvancedFace>( ifc_face );
+			FOR_EACH_LOOP vecChunks.begin(), vecChunks.end(), [&](FaceChunk& chunk) {
+				GeomProcessingParams chunkParams( params );
+				try
+				{
+					for( size_t ii = chunk.begin; ii < chunk.end; ++ii )
+					{
+						const shared_ptr<IfcFace>& ifc_face = vec_faces[ii];
+						if( !ifc_face )
+						{
+							continue;
+						}
+						convertIfcFace( ifc_face, *chunk.cache, chunkParams, edge_points );
+					}
+				}
+				catch( ... )
+				{
+					chunk.exception = std::current_exception();
+				}
+			});
 
-			if( params.debugDump )//|| advancedFace )
+			for( FaceChunk& chunk : vecChunks )
 			{
-				vec4 color(0.5, 0.6, 0.7, 1.0);
-				for( size_t iiLoop = 0; iiLoop < face_loops.size(); ++iiLoop )
+				if( chunk.exception )
 				{
-					std::vector<vec3>& loop = face_loops[iiLoop];
-					GeomDebugDump::dumpPolyline(loop, color, 0, false, false);
+					std::rethrow_exception( chunk.exception );
 				}
+				chunk.cache->mergeDeferredInto( poly_cache );
+				chunk.cache.reset();
+			}
 
-				//if( ii == 34 )
+			for( auto it = vec_faces.rbegin(); it != vec_faces.rend(); ++it )
+			{
+				if( *it )
 				{
-					//PolyInputCache3D poly_cache_dump(eps);
-					//createTriangulated3DFace(face_loops, poly_cache_dump, params);
-					//std::map<std::string, std::string> mesh_input_options;
-					//shared_ptr<carve::mesh::MeshSet<3> > meshset(poly_cache_dump.m_poly_data->createMesh(mesh_input_options, eps));
-					//bool drawNormals = false;
-					//GeomDebugDump::dumpMeshset(meshset, color, drawNormals, false, false);
+					params.ifc_entity = it->get();
+					break;
 				}
-				GeomDebugDump::moveOffset(0.0001);
 			}
-#endif
 		}
 
 		// IfcFaceList can be a closed or open shell
@@ -477,6 +721,199 @@ public:
 		}
 	}
 
+	//\brief Converts the loop, taking the points of edges from edge_points if they are in there
+	void convertIfcLoop( const shared_ptr<IfcLoop>& loop, const std::map<const IfcEdge*, std::vector<vec3> >* edge_points, std::vector<vec3>& loop_points )
+	{
+		if( dynamic_pointer_cast<IfcVertexLoop>( loop ) )
+		{
+			// a single vertex does not bound an area
+			return;
+		}
+
+		shared_ptr<IfcEdgeLoop> edge_loop = dynamic_pointer_cast<IfcEdgeLoop>( loop );
+		if( !edge_points || !edge_loop )
+		{
+			m_curve_converter->convertIfcLoop( loop, loop_points );
+			return;
+		}
+
+		const double length_factor = m_unit_converter->getLengthInMeterFactor();
+		for( const shared_ptr<IfcOrientedEdge>& oriented_edge : edge_loop->m_EdgeList )
+		{
+			if( !oriented_edge )
+			{
+				continue;
+			}
+			std::vector<vec3> edge_points_converted;
+			const std::vector<vec3>* vec_edge_points = &edge_points_converted;
+			auto it_edge = edge_points->find( oriented_edge->m_EdgeElement.get() );
+			if( it_edge != edge_points->end() && it_edge->second.size() > 0 )
+			{
+				vec_edge_points = &it_edge->second;
+			}
+			else
+			{
+				m_curve_converter->convertIfcEdge( oriented_edge->m_EdgeElement, edge_points_converted, length_factor );
+			}
+
+			bool orientation = true;
+			if( oriented_edge->m_Orientation )
+			{
+				orientation = oriented_edge->m_Orientation->m_value;
+			}
+			if( orientation )
+			{
+				std::copy( vec_edge_points->begin(), vec_edge_points->end(), std::back_inserter( loop_points ) );
+			}
+			else
+			{
+				std::copy( vec_edge_points->rbegin(), vec_edge_points->rend(), std::back_inserter( loop_points ) );
+			}
+		}
+
+		double eps = m_geom_settings->getEpsilonMergePoints();
+		GeomUtils::removeDuplicates( loop_points, eps );
+		GeomUtils::closePolygon( loop_points, eps );
+	}
+
+	void convertIfcFace( const shared_ptr<IfcFace>& ifc_face, PolyInputCache3D& poly_cache, GeomProcessingParams& params, const std::map<const IfcEdge*, std::vector<vec3> >* edge_points = nullptr )
+	{
+		const std::vector<shared_ptr<IfcFaceBound> >& vec_bounds = ifc_face->m_Bounds;
+		std::vector<std::vector<vec3> > face_loops;
+		params.ifc_entity = ifc_face.get();
+
+		for( auto it_bounds = vec_bounds.begin(); it_bounds != vec_bounds.end(); ++it_bounds )
+		{
+			const shared_ptr<IfcFaceBound>& face_bound = ( *it_bounds );
+
+			if( !face_bound )
+			{
+				continue;
+			}
+
+			// ENTITY IfcLoop SUPERTYPE OF(ONEOF(IfcEdgeLoop, IfcPolyLoop, IfcVertexLoop))
+			const shared_ptr<IfcLoop>& loop = face_bound->m_Bound;
+			if( !loop )
+			{
+				if( it_bounds == vec_bounds.begin() )
+				{
+					break;
+				}
+				else
+				{
+					continue;
+				}
+			}
+
+			face_loops.push_back( std::vector<vec3>() );
+			std::vector<vec3>& loop_points = face_loops.back();
+
+			convertIfcLoop( loop, edge_points, loop_points );
+
+			if( loop_points.size() < 3 )
+			{
+				if( it_bounds == vec_bounds.begin() )
+				{
+					break;
+				}
+				else
+				{
+					continue;
+				}
+			}
+
+			bool orientation = true;
+			if( face_bound->m_Orientation )
+			{
+				orientation = face_bound->m_Orientation->m_value;
+			}
+			if( !orientation )
+			{
+				std::reverse( loop_points.begin(), loop_points.end() );
+			}
+		}
+
+		for( size_t iiLoop = 0; iiLoop < face_loops.size(); ++iiLoop )
+		{
+			std::vector<vec3>& loop = face_loops[iiLoop];
+			GeomUtils::unClosePolygon(loop, params.epsMergePoints);
+		}
+
+		shared_ptr<IfcFaceSurface> face_surface = dynamic_pointer_cast<IfcFaceSurface>( ifc_face );
+		if( face_surface && face_surface->m_FaceSurface && !dynamic_pointer_cast<IfcPlane>( face_surface->m_FaceSurface ) )
+		{
+			shared_ptr<AnalyticSurface> analytic_surface = createAnalyticSurface( face_surface->m_FaceSurface );
+			if( analytic_surface )
+			{
+				bool same_sense = true;
+				if( face_surface->m_SameSense )
+				{
+					same_sense = face_surface->m_SameSense->m_value;
+				}
+
+				bool has_bounds = false;
+				for( const std::vector<vec3>& loop : face_loops )
+				{
+					has_bounds = has_bounds || loop.size() > 2;
+				}
+				if( !has_bounds )
+				{
+					// closed surface without boundary, for example a sphere bounded by a vertex loop
+					if( analytic_surface->m_type == AnalyticSurface::SURFACE_SPHERE )
+					{
+						SurfaceTessellator::triangulatePatch( *analytic_surface, 0.0, 2.0 * M_PI, -0.5 * M_PI, 0.5 * M_PI, same_sense, poly_cache, params.epsMergePoints );
+					}
+					else if( analytic_surface->m_type == AnalyticSurface::SURFACE_TORUS )
+					{
+						SurfaceTessellator::triangulatePatch( *analytic_surface, 0.0, 2.0 * M_PI, 0.0, 2.0 * M_PI, same_sense, poly_cache, params.epsMergePoints );
+					}
+					return;
+				}
+
+				if( SurfaceTessellator::triangulateFace( *analytic_surface, face_loops, same_sense, poly_cache, params.epsMergePoints ) )
+				{
+					return;
+				}
+				if( params.callbackFunc )
+				{
+					params.callbackFunc->messageCallback( "Face bounds could not be mapped to the surface parameters, triangulating the bounds", StatusCallback::MESSAGE_TYPE_MINOR_WARNING, __FUNC__, ifc_face.get() );
+				}
+			}
+		}
+
+		createTriangulated3DFace( face_loops, poly_cache, params, false );
+
+#ifdef _DEBUG
+		if( ifc_face->m_tag == 279929)
+		{
+			params.debugDump = true;
+		}
+
+		shared_ptr<IfcAdvancedFace> advancedFace = dynamic_pointer_cast<IfcAdvancedFace>( ifc_face );
+
+		if( params.debugDump )//|| advancedFace )
+		{
+			vec4 color(0.5, 0.6, 0.7, 1.0);
+			for( size_t iiLoop = 0; iiLoop < face_loops.size(); ++iiLoop )
+			{
+				std::vector<vec3>& loop = face_loops[iiLoop];
+				GeomDebugDump::dumpPolyline(loop, color, 0, false, false);
+			}
+
+			//if( ii == 34 )
+			{
+				//PolyInputCache3D poly_cache_dump(eps);
+				//createTriangulated3DFace(face_loops, poly_cache_dump, params);
+				//std::map<std::string, std::string> mesh_input_options;
+				//shared_ptr<carve::mesh::MeshSet<3> > meshset(poly_cache_dump.m_poly_data->createMesh(mesh_input_options, eps));
+				//bool drawNormals = false;
+				//GeomDebugDump::dumpMeshset(meshset, color, drawNormals, false, false);
+			}
+			GeomDebugDump::moveOffset(0.0001);
+		}
+#endif
+	}
+
 	static void triangulateCurvedPolygon(std::vector<vec3>& loopPoints3D, PolyInputCache3D& meshOut, GeomProcessingParams& params, 
 		double maxAllowedDistanceFromPlane)
 	{
@@ -928,7 +1365,7 @@ public:
 					if (dot(normalTriangle0, normalOuterBound) > 0)
 					{
 						// normalTriangle0 and normalOuterBound should point in the same direction" << std::endl;
-						meshOut.m_poly_data->addFace(idx0, idx1, idx2);
+						meshOut.addFace(idx0, idx1, idx2);
 #ifdef _DEBUG
 						polyDebug.m_poly_data->addFace(idx0_dbg, idx1_dbg, idx2_dbg);
 #endif
@@ -936,7 +1373,7 @@ public:
 					else
 					{
 						// normalTriangle0 and normalOuterBound should point in the same direction" << std::endl;
-						meshOut.m_poly_data->addFace(idx0, idx2, idx1);
+						meshOut.addFace(idx0, idx2, idx1);
 #ifdef _DEBUG
 						polyDebug.m_poly_data->addFace(idx0_dbg, idx2_dbg, idx1_dbg);
 #endif
@@ -945,14 +1382,14 @@ public:
 					if (dot(normalTriangle1, normalOuterBound) > 0)
 					{
 						//std::cout << "normalTriangle1 and normalOuterBound should point in the same direction" << std::endl;
-						meshOut.m_poly_data->addFace(idx2, idx3, idx0);
+						meshOut.addFace(idx2, idx3, idx0);
 #ifdef _DEBUG
 						polyDebug.m_poly_data->addFace(idx2_dbg, idx3_dbg, idx0_dbg);
 #endif
 					}
 					else
 					{
-						meshOut.m_poly_data->addFace(idx2, idx0, idx3);
+						meshOut.addFace(idx2, idx0, idx3);
 #ifdef _DEBUG
 						polyDebug.m_poly_data->addFace(idx2_dbg, idx0_dbg, idx3_dbg);
 #endif
@@ -1081,14 +1518,14 @@ public:
 				if (dot(triangleNormal, normalOuterBound) >= 0)
 				{
 
-					meshOut.m_poly_data->addFace(idxA, idxB, idxC);
+					meshOut.addFace(idxA, idxB, idxC);
 #ifdef _DEBUG
 					polyDebug.m_poly_data->addFace(idxA_dbg, idxB_dbg, idxC_dbg);
 #endif
 				}
 				else
 				{
-					meshOut.m_poly_data->addFace(idxA, idxC, idxB);
+					meshOut.addFace(idxA, idxC, idxB);
 #ifdef _DEBUG
 					polyDebug.m_poly_data->addFace(idxA_dbg, idxC_dbg, idxB_dbg);
 #endif
@@ -20,9 +20,11 @@ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OU
 // #define _DEBUG_LOOP_SEQENTIAL  // define for debugging geometry conversion
 
 #include <map>
+#include <numeric>
 #include <thread>
 #include <unordered_set>
 #include <ifcpp/model/BasicTypes.h>
+#include <ifcpp/model/BuildingGuid.h>
 #include <ifcpp/model/BuildingModel.h>
 #include <ifcpp/model/StatusCallback.h>
 #include <ifcpp/reader/ReaderUtil.h>
@@ -63,8 +65,8 @@ protected:
 	shared_ptr<GeometrySettings>			m_geom_settings;
 	shared_ptr<RepresentationConverter>		m_representation_converter;
 
-	std::unordered_map<std::string, shared_ptr<ProductShapeData> >	m_product_shape_data;
-	std::unordered_map<std::string, shared_ptr<BuildingObject> >	m_map_outside_spatial_structure;
+	std::unordered_map<BinaryGuid, shared_ptr<ProductShapeData> >	m_product_shape_data;
+	std::unordered_map<BinaryGuid, shared_ptr<BuildingObject> >		m_map_outside_spatial_structure;
 	std::unordered_set<int> m_setResolvedProjectStructure;
 	vec3 m_siteOffset;
 	double m_recent_progress = 0;
@@ -81,8 +83,8 @@ public:
 	shared_ptr<RepresentationConverter>& getRepresentationConverter() { return m_representation_converter; }
 	shared_ptr<GeometrySettings>& getGeomSettings() { return m_geom_settings; }
 	void setGeomSettings(shared_ptr<GeometrySettings>& settings) { m_geom_settings = settings; }
-	std::unordered_map<std::string, shared_ptr<ProductShapeData> >& getShapeInputData() { return m_product_shape_data; }
-	std::unordered_map<std::string, shared_ptr<BuildingObject> >& getObjectsOutsideSpatialStructure() { return m_map_outside_spatial_structure; }
+	std::unordered_map<BinaryGuid, shared_ptr<ProductShapeData> >& getShapeInputData() { return m_product_shape_data; }
+	std::unordered_map<BinaryGuid, shared_ptr<BuildingObject> >& getObjectsOutsideSpatialStructure() { return m_map_outside_spatial_structure; }
 	bool m_clear_memory_immedeately = true;
 	bool m_set_model_to_origin = false;
 
@@ -116,6 +118,9 @@ public:
 
 		m_ifc_model->clearCache();
 		m_ifc_model->clearIfcModel();
+
+		// the meshes are freed now, so the chunks of the pool for mesh edges and faces can be given back
+		carve::poolRelease();
 		progressTextCallback("Unloading model done");
 		progressValueCallback(0.0, "parse");
 
@@ -361,69 +366,38 @@ public:
 		}
 	}
 
-	void resolveProjectStructure(shared_ptr<ProductShapeData>& product_data, bool resolveSecondaryStructure)
+	/// candidate child of a product in the project structure, see collectStructureChildren
+	struct StructureChild
 	{
-		if (!product_data)
-		{
-			return;
-		}
-		product_data->m_added_to_spatial_structure = true;
+		int tag = -1;
+		size_t product_index = SIZE_MAX;	// SIZE_MAX if the object has no geometry input data
+	};
 
-		if (product_data->m_ifc_object_definition.expired())
-		{
-			return;
-		}
-
-		shared_ptr<IfcObjectDefinition> ifc_object_def(product_data->m_ifc_object_definition);
-		if (!ifc_object_def)
+	void addStructureChild(const shared_ptr<IfcObjectDefinition>& related_obj_def, const std::unordered_map<const IfcObjectDefinition*, size_t>& map_product_index, std::vector<StructureChild>& children) const
+	{
+		StructureChild child;
+		child.tag = related_obj_def->m_tag;
+		auto it_index = map_product_index.find(related_obj_def.get());
+		if (it_index != map_product_index.end())
 		{
-			return;
+			child.product_index = it_index->second;
 		}
+		children.push_back(child);
+	}
 
-#ifdef _DEBUG
-		std::string className = IFC4X3::EntityFactory::getStringForClassID(ifc_object_def->classID());
-#endif
-
+	/// collects the objects that are attached below ifc_object_def, in the order in which they are added to the project structure
+	void collectStructureChildren(const shared_ptr<IfcObjectDefinition>& ifc_object_def, bool resolveSecondaryStructure, const std::unordered_map<const IfcObjectDefinition*, size_t>& map_product_index, std::vector<StructureChild>& children) const
+	{
 		for (const weak_ptr<IfcRelAggregates>& relAggregates_weak_ptr : ifc_object_def->m_IsDecomposedBy_inverse)
 		{
-			if (relAggregates_weak_ptr.expired())
-			{
-				continue;
-			}
-			shared_ptr<IfcRelAggregates> relAggregates(relAggregates_weak_ptr);
+			shared_ptr<IfcRelAggregates> relAggregates = relAggregates_weak_ptr.lock();
 			if (relAggregates)
 			{
 				for (const shared_ptr<IfcObjectDefinition>& related_obj_def : relAggregates->m_RelatedObjects)
 				{
 					if (related_obj_def)
 					{
-						int tag = related_obj_def->m_tag;
-						if (tag < 0)
-						{
-							std::cout << "invalid tag: " << tag << std::endl;
-							continue;
-						}
-
-						if (m_setResolvedProjectStructure.find(tag) != m_setResolvedProjectStructure.end())
-						{
-							continue;
-						}
-						m_setResolvedProjectStructure.insert(tag);
-
-						if (related_obj_def->m_GlobalId)
-						{
-							std::string guid = related_obj_def->m_GlobalId->m_value;
-							auto it_product_map = m_product_shape_data.find(guid);
-							if (it_product_map != m_product_shape_data.end())
-							{
-								shared_ptr<ProductShapeData>& related_product_shape = it_product_map->second;
-								if (related_product_shape)
-								{
-									product_data->addChildProduct(related_product_shape, product_data);
-									resolveProjectStructure(related_product_shape, resolveSecondaryStructure);
-								}
-							}
-						}
+						addStructureChild(related_obj_def, map_product_index, children);
 					}
 				}
 			}
@@ -434,192 +408,170 @@ public:
 		{
 			for (const weak_ptr<IfcRelContainedInSpatialStructure>& rel_contained_weak_ptr : spatial_ele->m_ContainsElements_inverse)
 			{
-				if (rel_contained_weak_ptr.expired())
-				{
-					continue;
-				}
-				shared_ptr<IfcRelContainedInSpatialStructure> rel_contained(rel_contained_weak_ptr);
+				shared_ptr<IfcRelContainedInSpatialStructure> rel_contained = rel_contained_weak_ptr.lock();
 				if (rel_contained)
 				{
 					for (const shared_ptr<IfcProduct>& related_product : rel_contained->m_RelatedElements)
 					{
 						if (related_product)
 						{
-							int tag = related_product->m_tag;
-							if (tag < 0)
-							{
-								std::cout << "tag invalid: " << tag << std::endl;
-								continue;
-							}
-
-							if (m_setResolvedProjectStructure.find(tag) != m_setResolvedProjectStructure.end())
-							{
-								continue;
-							}
-							m_setResolvedProjectStructure.insert(tag);
-
-							if (related_product->m_GlobalId)
-							{
-								std::string related_guid = related_product->m_GlobalId->m_value;
-
-								auto it_product_map = m_product_shape_data.find(related_guid);
-								if (it_product_map != m_product_shape_data.end())
-								{
-									shared_ptr<ProductShapeData>& related_product_shape = it_product_map->second;
-									if (related_product_shape)
-									{
-										product_data->addChildProduct(related_product_shape, product_data);
-										resolveProjectStructure(related_product_shape, resolveSecondaryStructure);
-									}
-								}
-							}
+							addStructureChild(related_product, map_product_index, children);
 						}
 					}
 				}
 			}
 		}
 
-		if (resolveSecondaryStructure)
+		if (!resolveSecondaryStructure)
 		{
-			// handle IfcRelAssigns
-			shared_ptr<IfcSpatialElement> ifcSpatial = dynamic_pointer_cast<IfcSpatialElement>(ifc_object_def);
-			if (ifcSpatial)
-			{
-				//std::cout << "ifcSpatial: " << ifcSpatial->m_tag << std::endl;
+			return;
+		}
 
-				//ServicedBySystems	 : 	SET OF IfcRelServicesBuildings FOR RelatedBuildings;
-				for (auto servicedBy_weak_ptr : ifcSpatial->m_ServicedBySystems_inverse)
+		// handle IfcRelAssigns
+		if (spatial_ele)
+		{
+			//ServicedBySystems	 : 	SET OF IfcRelServicesBuildings FOR RelatedBuildings;
+			for (const weak_ptr<IfcRelServicesBuildings>& servicedBy_weak_ptr : spatial_ele->m_ServicedBySystems_inverse)
+			{
+				shared_ptr<IfcRelServicesBuildings> servicedBy = servicedBy_weak_ptr.lock();
+				if (!servicedBy || !servicedBy->m_RelatingSystem)
 				{
+					continue;
+				}
 
-					if (servicedBy_weak_ptr.expired())
+				for (const weak_ptr<IfcRelAssignsToGroup>& groupedBy_weak : servicedBy->m_RelatingSystem->m_IsGroupedBy_inverse)
+				{
+					shared_ptr<IfcRelAssignsToGroup> groupedBy = groupedBy_weak.lock();
+					if (!groupedBy)
 					{
 						continue;
 					}
-					shared_ptr<IfcRelServicesBuildings> servicedBy(servicedBy_weak_ptr);
-					if (servicedBy)
-					{
-						//shared_ptr<IfcSystem>						m_RelatingSystem;
-						//std::vector<shared_ptr<IfcSpatialElement> >	m_RelatedBuildings;
-						shared_ptr<IfcSystem> sys = servicedBy->m_RelatingSystem;
-						//std::cout << "m_ServicesBuildings_inverse: " << sys->m_ServicesBuildings_inverse.size() << std::endl;
-						//std::cout << "m_ServicesFacilities_inverse: " << sys->m_ServicesFacilities_inverse.size() << std::endl;
-
 
-						for (auto groupedBy_weak : sys->m_IsGroupedBy_inverse)
+					for (const shared_ptr<IfcObjectDefinition>& related_object : groupedBy->m_RelatedObjects)
+					{
+						if (related_object)
 						{
-							if (groupedBy_weak.expired()) { continue; }
-							shared_ptr<IfcRelAssignsToGroup> groupedBy(groupedBy_weak);
-
-							//  std::vector<shared_ptr<IfcObjectDefinition> >	m_RelatedObjects;
-							//  shared_ptr<IfcObjectTypeEnum>					m_RelatedObjectsType;		//optional
-
-							// IfcRelAssignsToGroup -----------------------------------------------------------
-							// attributes:
-							shared_ptr<IfcGroup>& group = groupedBy->m_RelatingGroup;
-
-							for (auto related_object : groupedBy->m_RelatedObjects)
-							{
-								int tag = related_object->m_tag;
-								if (tag < 0)
-								{
-									std::cout << "tag invalid: " << tag << std::endl;
-									continue;
-								}
-
-								if (m_setResolvedProjectStructure.find(tag) != m_setResolvedProjectStructure.end())
-								{
-									// std::cout << "duplicate guid in model tree: " << related_guid << std::endl;
-									continue;
-								}
-								m_setResolvedProjectStructure.insert(tag);
-
-								if (related_object->m_GlobalId)
-								{
-									std::string related_guid = related_object->m_GlobalId->m_value;
-
-									auto it_product_map = m_product_shape_data.find(related_guid);
-									if (it_product_map != m_product_shape_data.end())
-									{
-										shared_ptr<ProductShapeData>& related_product_shape = it_product_map->second;
-										if (related_product_shape)
-										{
-											product_data->addChildProduct(related_product_shape, product_data);
-											resolveProjectStructure(related_product_shape, resolveSecondaryStructure);
-										}
-									}
-								}
-							}
+							addStructureChild(related_object, map_product_index, children);
 						}
 					}
 				}
 			}
+		}
 
-			// handle IfcRelConnects
-			shared_ptr<IfcDistributionElement> distributionElement = dynamic_pointer_cast<IfcDistributionElement>(ifc_object_def);
-			if (distributionElement)
+		// handle IfcRelConnects
+		shared_ptr<IfcDistributionElement> distributionElement = dynamic_pointer_cast<IfcDistributionElement>(ifc_object_def);
+		if (distributionElement)
+		{
+			// #971193= IFCFLOWSEGMENT('2zIAtK02XAfPD15y9EpuCl',#41,'name',$,'description',#971178,#971191,'6021202');  - in spatial structure
+			//#4542544= IFCDISTRIBUTIONPORT('0$K3Bu1NXCwviGJbnhv$tO',#41,'name','description',$,#4542542,$,.SOURCEANDSINK.);  
+			//#4542546= IFCRELCONNECTSPORTTOELEMENT('0dih3rwKj6FhUYiBG4sVkO',#41,'name','description',#4542544,#971193);
+			for (const weak_ptr<IfcRelConnectsPortToElement>& RelConnectsPortToElement_weak_ptr : distributionElement->m_HasPorts_inverse)
 			{
-				// #971193= IFCFLOWSEGMENT('2zIAtK02XAfPD15y9EpuCl',#41,'name',$,'description',#971178,#971191,'6021202');  - in spatial structure
-				//#4542544= IFCDISTRIBUTIONPORT('0$K3Bu1NXCwviGJbnhv$tO',#41,'name','description',$,#4542542,$,.SOURCEANDSINK.);  
-				//#4542546= IFCRELCONNECTSPORTTOELEMENT('0dih3rwKj6FhUYiBG4sVkO',#41,'name','description',#4542544,#971193);
+				shared_ptr<IfcRelConnectsPortToElement> RelConnectsPortToElement = RelConnectsPortToElement_weak_ptr.lock();
+				if (RelConnectsPortToElement && RelConnectsPortToElement->m_RelatingPort)
+				{
+					addStructureChild(RelConnectsPortToElement->m_RelatingPort, map_product_index, children);
+				}
+			}
+		}
+	}
 
-				std::string className = IFC4X3::EntityFactory::getStringForClassID(distributionElement->classID());
-				//std::cout << "#" <<  distributionElement->m_tag << "=" << className << " " << std::endl;
+	/**
+	* \brief method resolveProjectStructure: Attaches all products below product_data, following IfcRelAggregates, IfcRelContainedInSpatialStructure and optionally IfcRelServicesBuildings and IfcRelConnectsPortToElement.
+	* The candidate children of all products are collected in parallel first, then the tree is built depth first with an explicit stack, so that deeply nested assemblies do not overflow the call stack.
+	* Each object is attached only once, at its first occurrence. m_setResolvedProjectStructure is kept between calls.
+	*/
+	void resolveProjectStructure(shared_ptr<ProductShapeData>& product_data, bool resolveSecondaryStructure)
+	{
+		if (!product_data)
+		{
+			return;
+		}
 
-				for (auto RelConnectsPortToElement_weak_ptr : distributionElement->m_HasPorts_inverse)
-				{
-					if (RelConnectsPortToElement_weak_ptr.expired())
-					{
-						continue;
-					}
-					shared_ptr<IfcRelConnectsPortToElement> RelConnectsPortToElement(RelConnectsPortToElement_weak_ptr);
-					if (RelConnectsPortToElement)
-					{
-						shared_ptr<IfcPort> related_object = RelConnectsPortToElement->m_RelatingPort;
-						if (related_object)
-						{
-							//shared_ptr<IfcPort>					m_RelatingPort;
-							//shared_ptr<IfcDistributionElement>	m_RelatedElement;
+		std::vector<shared_ptr<ProductShapeData> > vec_products;
+		vec_products.reserve(m_product_shape_data.size() + 1);
+		vec_products.push_back(product_data);
+		for (auto& it : m_product_shape_data)
+		{
+			if (it.second && it.second != product_data)
+			{
+				vec_products.push_back(it.second);
+			}
+		}
 
-							int tag = related_object->m_tag;
+		// products by their object definition, so that related objects are found without going through their GUID
+		std::unordered_map<const IfcObjectDefinition*, size_t> map_product_index;
+		map_product_index.reserve(vec_products.size());
+		for (size_t ii = 0; ii < vec_products.size(); ++ii)
+		{
+			shared_ptr<IfcObjectDefinition> ifc_object_def = vec_products[ii]->m_ifc_object_definition.lock();
+			if (ifc_object_def)
+			{
+				map_product_index[ifc_object_def.get()] = ii;
+			}
+		}
 
-							if (tag < 0)
-							{
-								std::cout << "tag invalid: " << tag << std::endl;
-								continue;
-							}
+		std::vector<std::vector<StructureChild> > vec_children(vec_products.size());
+		std::vector<size_t> vec_indices(vec_products.size());
+		std::iota(vec_indices.begin(), vec_indices.end(), 0);
+		FOR_EACH_LOOP vec_indices.begin(), vec_indices.end(), [&](size_t index) {
+			shared_ptr<IfcObjectDefinition> ifc_object_def = vec_products[index]->m_ifc_object_definition.lock();
+			if (ifc_object_def)
+			{
+				collectStructureChildren(ifc_object_def, resolveSecondaryStructure, map_product_index, vec_children[index]);
+			}
+		});
 
-							if (m_setResolvedProjectStructure.find(tag) != m_setResolvedProjectStructure.end())
-							{
-								// std::cout << "duplicate guid in model tree: " << related_guid << std::endl;
-								continue;
-							}
-							m_setResolvedProjectStructure.insert(tag);
+		struct StackEntry
+		{
+			size_t product_index;
+			size_t next_child;
+		};
+		std::vector<StackEntry> stack;
+		stack.push_back({ 0, 0 });
+		product_data->m_added_to_spatial_structure = true;
 
-							if (related_object->m_GlobalId)
-							{
-								std::string related_guid = related_object->m_GlobalId->m_value;
-								auto it_product_map = m_product_shape_data.find(related_guid);
-								if (it_product_map != m_product_shape_data.end())
-								{
-									shared_ptr<ProductShapeData>& related_product_shape = it_product_map->second;
-									if (related_product_shape)
-									{
-										product_data->addChildProduct(related_product_shape, product_data);
-										resolveProjectStructure(related_product_shape, resolveSecondaryStructure);
-									}
-								}
-							}
-						}
-					}
-				}
+		while (!stack.empty())
+		{
+			StackEntry& entry = stack.back();
+			const std::vector<StructureChild>& children = vec_children[entry.product_index];
+			if (entry.next_child >= children.size())
+			{
+				stack.pop_back();
+				continue;
 			}
+
+			const StructureChild& child = children[entry.next_child];
+			++entry.next_child;
+			if (child.tag < 0)
+			{
+				std::cout << "tag invalid: " << child.tag << std::endl;
+				continue;
+			}
+
+			if (!m_setResolvedProjectStructure.insert(child.tag).second)
+			{
+				// already attached somewhere else in the project structure
+				continue;
+			}
+
+			if (child.product_index == SIZE_MAX)
+			{
+				continue;
+			}
+
+			shared_ptr<ProductShapeData>& parent_product = vec_products[entry.product_index];
+			shared_ptr<ProductShapeData>& child_product = vec_products[child.product_index];
+			parent_product->addChildProduct(child_product, parent_product);
+			child_product->m_added_to_spatial_structure = true;
+			stack.push_back({ child.product_index, 0 });
 		}
 	}
 
 	void fixModelHierarchy()
 	{
 		// sometimes there are IfcBuilding, not attached to IfcSite and IfcProject
-		std::unordered_map<std::string, shared_ptr<ProductShapeData> >& map_shapeInputData = getShapeInputData();
+		std::unordered_map<BinaryGuid, shared_ptr<ProductShapeData> >& map_shapeInputData = getShapeInputData();
 		shared_ptr<BuildingModel> ifc_model = getBuildingModel();
 		shared_ptr<IfcProject> ifc_project = ifc_model->getIfcProject();
 		std::vector<shared_ptr<IfcSite> > vec_ifc_sites;
@@ -627,7 +579,6 @@ public:
 
 		for (auto it : map_shapeInputData)
 		{
-			std::string guid = it.first;
 			shared_ptr<ProductShapeData>& product_shape = it.second;
 
 			if (product_shape->m_ifc_object_definition.expired())
@@ -733,7 +684,7 @@ public:
 	{
 		progressTextCallback("Creating geometry...");
 		progressValueCallback(0, "geometry");
-		printToDebugLog(__FUNC__, "start converting");
+		CARVE_TRACE_SCOPE(__FUNC__, 0);
 		m_product_shape_data.clear();
 		m_map_outside_spatial_structure.clear();
 		m_setResolvedProjectStructure.clear();
@@ -745,6 +696,9 @@ public:
 			return;
 		}
 
+		// resolve all styles up front, so that the product conversion only needs to look them up
+		m_representation_converter->getStylesConverter()->resolveStyles(m_ifc_model->getMapIfcEntities());
+
 		shared_ptr<ProductShapeData> ifcProjectData;
 		std::vector<shared_ptr<IfcObjectDefinition> > vecObjectDefinitions;
 		getAllObjectDefinitions(vecObjectDefinitions, ifcProjectData);
@@ -810,9 +764,10 @@ public:
 					thread_err << "undefined error, product id " << tag;
 				}
 
+				const BinaryGuid binary_guid(guid);
 				{
 					std::lock_guard<std::mutex> lock(writelock_map);
-					m_product_shape_data[guid] = product_geom_input_data;
+					m_product_shape_data[binary_guid] = product_geom_input_data;
 				}
 
 				if (thread_err.tellp() > 0)
@@ -829,11 +784,7 @@ public:
 		// subtract openings in assemblies etc, in case the opening is attached at the top level
 		ii = 0;
 		FOR_EACH_LOOP vecObjectDefinitions.begin(), vecObjectDefinitions.end(), [&](shared_ptr<IfcObjectDefinition>& object_def) {
-			std::string guid;
-			if (object_def->m_GlobalId)
-			{
-				guid = object_def->m_GlobalId->m_value;
-			}
+			const BinaryGuid guid(object_def->m_GlobalId ? object_def->m_GlobalId->m_value : std::string());
 			auto it_find = m_product_shape_data.find(guid);
 			if (it_find != m_product_shape_data.end())
 			{
@@ -900,7 +851,7 @@ public:
 						if (guid.size() >= 18)
 						{
 							shared_ptr<IfcRoot> ifc_object_def_as_root = ifc_object_def;
-							m_map_outside_spatial_structure[guid] = ifc_object_def_as_root;
+							m_map_outside_spatial_structure[BinaryGuid(guid)] = ifc_object_def_as_root;
 						}
 						else
 						{
@@ -1070,9 +1021,7 @@ public:
 			return;
 		}
 
-		// some linux debugging:
-		int productTag = ifc_product->m_tag;
-		printToDebugLog(__FUNC__, "converting element " + std::to_string(productTag));
+		CARVE_TRACE_SCOPE(__FUNC__, ifc_product->m_tag);
 
 		std::vector<weak_ptr<IfcRelVoidsElement> > vec_rel_voids;
 		shared_ptr<IfcElement> ifc_element = dynamic_pointer_cast<IfcElement>(ifc_product);
@@ -1225,12 +1174,9 @@ public:
 					continue;
 				}
 
-				std::string guid;
 				if (related_object->m_GlobalId)
 				{
-					guid = related_object->m_GlobalId->m_value;
-
-					auto it_find_related_shape = m_product_shape_data.find(guid);
+					auto it_find_related_shape = m_product_shape_data.find(BinaryGuid(related_object->m_GlobalId->m_value));
 					if (it_find_related_shape != m_product_shape_data.end())
 					{
 						shared_ptr<ProductShapeData>& related_product_shape = it_find_related_shape->second;
@@ -848,6 +848,10 @@ public:
 		m_styles.clear();
 		m_ifc_object_definition.reset();
 		m_object_placement.reset();
+		for( const shared_ptr<ProductShapeData>& child : m_child_products )
+		{
+			child->m_parent.reset();
+		}
 		m_child_products.clear();
 		m_geometric_items.clear();
 	}
@@ -867,18 +871,11 @@ public:
 		}
 	}
 	
+	//\brief Compares with the direct parent only. The walk further up used to ignore its result, and made deep assembly chains quadratic.
+	//Cycles are prevented by resolveProjectStructure, which attaches each object once
 	bool isContainedInParentsList( shared_ptr<ProductShapeData>& product_data_check )
 	{
-		if( !m_parent.expired() )
-		{
-			shared_ptr<ProductShapeData> product_data_parent( m_parent );
-			if( product_data_parent == product_data_check )
-			{
-				return true;
-			}
-			product_data_parent->isContainedInParentsList( product_data_check );
-		}
-		return false;
+		return !m_parent.expired() && m_parent.lock() == product_data_check;
 	}
 
 	void addChildProduct( shared_ptr<ProductShapeData>& add_child, shared_ptr<ProductShapeData>& ptr_self )
@@ -893,23 +890,13 @@ public:
 			return;
 		}
 
-		for( size_t ii = 0; ii < m_child_products.size(); ++ii )
+		// a product has only one parent, so checking the parent is enough to find out if it is in m_child_products already
+		if( add_child->m_parent.lock().get() == this )
 		{
-			const shared_ptr<ProductShapeData>& existing_child = m_child_products[ii];
-			if( existing_child == add_child )
-			{
 #ifdef _DEBUG
-				if( existing_child->m_entity_guid.compare( add_child->m_entity_guid ) == 0 )
-				{
-					std::cout << __FUNCTION__ << ": child already added, tag: " << add_child->m_entity_guid << std::endl;
-				}
-				else
-				{
-					std::cout << __FUNCTION__ << ": tag mismatch: " << add_child->m_entity_guid << " != " << existing_child->m_entity_guid << std::endl;
-				}
+			std::cout << __FUNCTION__ << ": child already added, guid: " << add_child->m_entity_guid << std::endl;
 #endif
-				return;
-			}
+			return;
 		}
 
 		m_child_products.push_back( add_child );
@@ -70,6 +70,8 @@ public:
 		m_excludeIfcTypes = other->m_excludeIfcTypes;
 		m_renderOnlyIfcTypes = other->m_excludeIfcTypes;
 		m_maxNumFaceEdges = other->m_maxNumFaceEdges;
+		m_minNumFacesParallelTriangulation = other->m_minNumFacesParallelTriangulation;
+		m_numFacesPerTriangulationChunk = other->m_numFacesPerTriangulationChunk;
 		m_num_vertices_per_circle = other->m_num_vertices_per_circle;
 		m_num_vertices_per_circle_default = other->m_num_vertices_per_circle_default;
 		m_min_num_vertices_per_arc = other->m_min_num_vertices_per_arc;
@@ -84,6 +86,8 @@ public:
 		m_epsilonMergePoints = other->m_epsilonMergePoints;
 		m_epsCoplanarAngle = other->m_epsCoplanarAngle;
 		m_mergeAlignedEdges = other->m_mergeAlignedEdges;
+		m_clipHalfSpacesByPlanes = other->m_clipHalfSpacesByPlanes;
+		m_unionSubtractionOperands = other->m_unionSubtractionOperands;
 		m_callback_simplify_mesh = other->m_callback_simplify_mesh;
 	}
 
@@ -163,7 +167,11 @@ public:
 	std::unordered_set<uint32_t> m_excludeIfcTypes;		// if set, these types will not be converted
 	std::unordered_set<uint32_t> m_renderOnlyIfcTypes;	// if set, only these types will be converted
 	size_t m_maxNumFaceEdges = MAX_NUM_EDGES;
+	size_t m_minNumFacesParallelTriangulation = 20000;	// face lists with at least this many faces are triangulated in parallel chunks
+	size_t m_numFacesPerTriangulationChunk = 4000;
 	bool m_mergeAlignedEdges = true;
+	bool m_clipHalfSpacesByPlanes = true;	// cut chains of unbounded or enclosing half-spaces directly by planes, use CSG only in degenerate cases
+	bool m_unionSubtractionOperands = false;	// compute A - B1 - ... - Bn as A - (B1 + ... + Bn), with the unions in parallel. Faster for many cut-outs, but not identical to subtracting one after the other
 	MeshSimplifyCallbackType m_callback_simplify_mesh;
 	std::map<int, std::vector<int>, std::greater<int> > m_mapCsgTimeTag;
 	
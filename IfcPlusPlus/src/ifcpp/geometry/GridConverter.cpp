@@ -0,0 +1,360 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#define _USE_MATH_DEFINES
+#include <cmath>
+#include <limits>
+#include <IfcBoolean.h>
+#include <IfcLengthMeasure.h>
+#include "CurveConverter.h"
+#include "GridConverter.h"
+
+namespace
+{
+	inline double cross2D( const vec2& a, const vec2& b )
+	{
+		return a.x * b.y - a.y * b.x;
+	}
+
+	//\brief Distance along the primitive from its bounds to the given point on its carrier line or circle, 0 if the point is within the bounds
+	double getDistanceOutside( const GridConverter::AxisPrimitive& primitive, const vec2& point )
+	{
+		if( primitive.m_is_arc )
+		{
+			const double angle = std::atan2( point.y - primitive.m_center.y, point.x - primitive.m_center.x );
+			double delta = primitive.m_opening_angle > 0 ? angle - primitive.m_start_angle : primitive.m_start_angle - angle;
+			delta = std::fmod( delta, 2.0 * M_PI );
+			if( delta < 0 )
+			{
+				delta += 2.0 * M_PI;
+			}
+			const double opening = std::abs( primitive.m_opening_angle );
+			if( delta <= opening + 1e-12 )
+			{
+				return 0;
+			}
+			return primitive.m_radius * std::min( delta - opening, 2.0 * M_PI - delta );
+		}
+
+		const vec2 direction = primitive.m_end - primitive.m_start;
+		const double length = direction.length();
+		const double t = carve::geom::dot( point - primitive.m_start, direction ) / length;
+		return std::max( 0.0, std::max( -t, t - length ) );
+	}
+
+	//\brief Moves the primitive by offset to the left of its direction
+	bool getOffsetPrimitive( const GridConverter::AxisPrimitive& primitive, double offset, GridConverter::AxisPrimitive& result )
+	{
+		result = primitive;
+		if( primitive.m_is_arc )
+		{
+			result.m_radius = primitive.m_opening_angle > 0 ? primitive.m_radius - offset : primitive.m_radius + offset;
+			return result.m_radius > 1e-9;
+		}
+
+		vec2 direction = primitive.m_end - primitive.m_start;
+		const double length = direction.length();
+		if( length < 1e-12 )
+		{
+			return false;
+		}
+		direction = direction / length;
+		const vec2 left = carve::geom::VECTOR( -direction.y, direction.x );
+		result.m_start = primitive.m_start + left * offset;
+		result.m_end = primitive.m_end + left * offset;
+		return true;
+	}
+
+	//\brief Intersection points of the carrier lines or circles of two primitives
+	void getCarrierIntersections( const GridConverter::AxisPrimitive& a, const GridConverter::AxisPrimitive& b, std::vector<vec2>& points )
+	{
+		if( !a.m_is_arc && !b.m_is_arc )
+		{
+			const vec2 u = a.m_end - a.m_start;
+			const vec2 v = b.m_end - b.m_start;
+			const double denominator = cross2D( u, v );
+			if( std::abs( denominator ) < 1e-12 * u.length() * v.length() )
+			{
+				return;
+			}
+			const double t = cross2D( b.m_start - a.m_start, v ) / denominator;
+			points.push_back( a.m_start + u * t );
+			return;
+		}
+
+		if( a.m_is_arc != b.m_is_arc )
+		{
+			const GridConverter::AxisPrimitive& line = a.m_is_arc ? b : a;
+			const GridConverter::AxisPrimitive& arc = a.m_is_arc ? a : b;
+			const vec2 u = ( line.m_end - line.m_start ).normalized();
+			const vec2 f = line.m_start - arc.m_center;
+			const double half_b = carve::geom::dot( f, u );
+			const double discriminant = half_b * half_b - ( carve::geom::dot( f, f ) - arc.m_radius * arc.m_radius );
+			if( discriminant < 0 )
+			{
+				return;
+			}
+			const double root = std::sqrt( discriminant );
+			points.push_back( line.m_start + u * ( -half_b - root ) );
+			if( root > 1e-12 )
+			{
+				points.push_back( line.m_start + u * ( -half_b + root ) );
+			}
+			return;
+		}
+
+		const vec2 center_delta = b.m_center - a.m_center;
+		const double distance = center_delta.length();
+		if( distance < 1e-12 || distance > a.m_radius + b.m_radius || distance < std::abs( a.m_radius - b.m_radius ) )
+		{
+			return;
+		}
+		const double along = ( a.m_radius * a.m_radius - b.m_radius * b.m_radius + distance * distance ) / ( 2.0 * distance );
+		const double height = std::sqrt( std::max( 0.0, a.m_radius * a.m_radius - along * along ) );
+		const vec2 direction = center_delta / distance;
+		const vec2 middle = a.m_center + direction * along;
+		const vec2 perpendicular = carve::geom::VECTOR( -direction.y, direction.x );
+		points.push_back( middle + perpendicular * height );
+		if( height > 1e-12 )
+		{
+			points.push_back( middle - perpendicular * height );
+		}
+	}
+}
+
+shared_ptr<IfcGrid> GridConverter::getGrid( const shared_ptr<IfcVirtualGridIntersection>& grid_intersection )
+{
+	if( !grid_intersection )
+	{
+		return shared_ptr<IfcGrid>();
+	}
+	for( const shared_ptr<IfcGridAxis>& grid_axis : grid_intersection->m_IntersectingAxes )
+	{
+		if( !grid_axis )
+		{
+			continue;
+		}
+		for( const std::vector<weak_ptr<IfcGrid> >* part_of : { &grid_axis->m_PartOfU_inverse, &grid_axis->m_PartOfV_inverse, &grid_axis->m_PartOfW_inverse } )
+		{
+			for( const weak_ptr<IfcGrid>& grid_weak : *part_of )
+			{
+				shared_ptr<IfcGrid> grid = grid_weak.lock();
+				if( grid )
+				{
+					return grid;
+				}
+			}
+		}
+	}
+	return shared_ptr<IfcGrid>();
+}
+
+shared_ptr<GridConverter::GridCacheEntry> GridConverter::getGridCacheEntry( const shared_ptr<IfcGrid>& grid )
+{
+	shared_ptr<GridCacheEntry> entry;
+	{
+		std::lock_guard<std::mutex> lock( m_writelock_grid_cache );
+		shared_ptr<GridCacheEntry>& cached = m_grid_cache[grid->m_tag];
+		if( !cached )
+		{
+			cached = std::make_shared<GridCacheEntry>();
+		}
+		entry = cached;
+	}
+
+	// all axes of the grid are discretised at once, other threads wait here until it is done
+	std::call_once( entry->m_computed, [&]()
+		{
+			for( const std::vector<shared_ptr<IfcGridAxis> >* axes : { &grid->m_UAxes, &grid->m_VAxes, &grid->m_WAxes } )
+			{
+				for( const shared_ptr<IfcGridAxis>& grid_axis : *axes )
+				{
+					if( grid_axis )
+					{
+						convertGridAxis( grid_axis, entry->m_axes[grid_axis.get()] );
+					}
+				}
+			}
+		} );
+	return entry;
+}
+
+void GridConverter::convertGridAxis( const shared_ptr<IfcGridAxis>& grid_axis, std::vector<AxisPrimitive>& primitives )
+{
+	shared_ptr<CurveConverter> curve_converter = m_curve_converter.lock();
+	if( !curve_converter || !grid_axis->m_AxisCurve )
+	{
+		return;
+	}
+
+	const bool same_sense = !grid_axis->m_SameSense || grid_axis->m_SameSense->m_value;
+	std::vector<CurveConverter::CurveSegment> segments;
+	curve_converter->convertIfcCurve( grid_axis->m_AxisCurve, segments, same_sense );
+
+	const double eps = curve_converter->getGeomSettings()->getEpsilonMergePoints();
+	for( const CurveConverter::CurveSegment& segment : segments )
+	{
+		const std::vector<vec3>& points = segment.m_points;
+		if( ( segment.m_type == CurveConverter::CurveSegment::CURVE_TYPE_CIRCLE || segment.m_type == CurveConverter::CurveSegment::CURVE_TYPE_ARC ) && points.size() > 2 )
+		{
+			// keep circular arcs exact, with the orientation of the discretised points
+			AxisPrimitive arc;
+			arc.m_is_arc = true;
+			arc.m_center = carve::geom::VECTOR( segment.arcOrCircleCenter.x, segment.arcOrCircleCenter.y );
+			arc.m_start = carve::geom::VECTOR( points.front().x, points.front().y );
+			arc.m_end = carve::geom::VECTOR( points.back().x, points.back().y );
+			arc.m_radius = ( arc.m_start - arc.m_center ).length();
+			arc.m_start_angle = std::atan2( arc.m_start.y - arc.m_center.y, arc.m_start.x - arc.m_center.x );
+
+			bool is_circular = arc.m_radius > eps;
+			double previous_angle = arc.m_start_angle;
+			for( size_t ii = 1; ii < points.size() && is_circular; ++ii )
+			{
+				const vec2 offset_point = carve::geom::VECTOR( points[ii].x - arc.m_center.x, points[ii].y - arc.m_center.y );
+				if( std::abs( offset_point.length() - arc.m_radius ) > eps * 1000.0 + arc.m_radius * 1e-9 )
+				{
+					// ellipse
+					is_circular = false;
+					break;
+				}
+				const double angle = std::atan2( offset_point.y, offset_point.x );
+				double delta = angle - previous_angle;
+				if( delta > M_PI ) delta -= 2.0 * M_PI;
+				if( delta < -M_PI ) delta += 2.0 * M_PI;
+				arc.m_opening_angle += delta;
+				previous_angle = angle;
+			}
+
+			if( is_circular )
+			{
+				primitives.push_back( arc );
+				continue;
+			}
+		}
+
+		for( size_t ii = 1; ii < points.size(); ++ii )
+		{
+			AxisPrimitive line;
+			line.m_start = carve::geom::VECTOR( points[ii - 1].x, points[ii - 1].y );
+			line.m_end = carve::geom::VECTOR( points[ii].x, points[ii].y );
+			if( ( line.m_end - line.m_start ).length2() > eps * eps )
+			{
+				primitives.push_back( line );
+			}
+		}
+	}
+}
+
+bool GridConverter::intersectAxes( const std::vector<AxisPrimitive>& axis1, double offset1, const std::vector<AxisPrimitive>& axis2, double offset2, vec2& point )
+{
+	double min_distance_outside = std::numeric_limits<double>::max();
+	std::vector<vec2> candidates;
+	AxisPrimitive primitive1, primitive2;
+	for( const AxisPrimitive& original1 : axis1 )
+	{
+		if( !getOffsetPrimitive( original1, offset1, primitive1 ) )
+		{
+			continue;
+		}
+		for( const AxisPrimitive& original2 : axis2 )
+		{
+			if( !getOffsetPrimitive( original2, offset2, primitive2 ) )
+			{
+				continue;
+			}
+
+			candidates.clear();
+			getCarrierIntersections( primitive1, primitive2, candidates );
+			for( const vec2& candidate : candidates )
+			{
+				const double distance_outside = getDistanceOutside( primitive1, candidate ) + getDistanceOutside( primitive2, candidate );
+				if( distance_outside < min_distance_outside - 1e-9 )
+				{
+					min_distance_outside = distance_outside;
+					point = candidate;
+				}
+			}
+		}
+	}
+	return min_distance_outside < std::numeric_limits<double>::max();
+}
+
+bool GridConverter::getIntersectionPoint( const shared_ptr<IfcVirtualGridIntersection>& grid_intersection, vec3& point )
+{
+	if( !grid_intersection || grid_intersection->m_IntersectingAxes.size() < 2 )
+	{
+		return false;
+	}
+	const shared_ptr<IfcGridAxis>& axis1 = grid_intersection->m_IntersectingAxes[0];
+	const shared_ptr<IfcGridAxis>& axis2 = grid_intersection->m_IntersectingAxes[1];
+	if( !axis1 || !axis2 )
+	{
+		return false;
+	}
+
+	const double length_factor = m_unit_converter->getLengthInMeterFactor();
+	double offsets[3] = { 0, 0, 0 };
+	for( size_t ii = 0; ii < 3 && ii < grid_intersection->m_OffsetDistances.size(); ++ii )
+	{
+		if( grid_intersection->m_OffsetDistances[ii] )
+		{
+			offsets[ii] = grid_intersection->m_OffsetDistances[ii]->m_value * length_factor;
+		}
+	}
+
+	shared_ptr<IfcGrid> grid = getGrid( grid_intersection );
+	shared_ptr<GridCacheEntry> entry;
+	if( grid && grid->m_tag > 0 )
+	{
+		entry = getGridCacheEntry( grid );
+	}
+	else
+	{
+		// axes that are not part of a grid read from a file, not cached
+		entry = std::make_shared<GridCacheEntry>();
+	}
+
+	const IntersectionKey key( axis1.get(), axis2.get(), offsets[0], offsets[1] );
+	{
+		std::lock_guard<std::mutex> lock( entry->m_writelock_intersections );
+		auto it = entry->m_intersections.find( key );
+		if( it != entry->m_intersections.end() )
+		{
+			point = carve::geom::VECTOR( it->second.second.x, it->second.second.y, offsets[2] );
+			return it->second.first;
+		}
+	}
+
+	std::vector<AxisPrimitive> converted1, converted2;
+	const std::vector<AxisPrimitive>* primitives1 = &converted1;
+	const std::vector<AxisPrimitive>* primitives2 = &converted2;
+	auto it1 = entry->m_axes.find( axis1.get() );
+	auto it2 = entry->m_axes.find( axis2.get() );
+	if( it1 != entry->m_axes.end() ) primitives1 = &it1->second;
+	else convertGridAxis( axis1, converted1 );
+	if( it2 != entry->m_axes.end() ) primitives2 = &it2->second;
+	else convertGridAxis( axis2, converted2 );
+
+	vec2 point2D = carve::geom::VECTOR( 0.0, 0.0 );
+	const bool intersects = intersectAxes( *primitives1, offsets[0], *primitives2, offsets[1], point2D );
+	{
+		std::lock_guard<std::mutex> lock( entry->m_writelock_intersections );
+		entry->m_intersections[key] = std::make_pair( intersects, point2D );
+	}
+	point = carve::geom::VECTOR( point2D.x, point2D.y, offsets[2] );
+	return intersects;
+}
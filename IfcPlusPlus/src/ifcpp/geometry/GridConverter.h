@@ -0,0 +1,113 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <vector>
+#include <ifcpp/model/BasicTypes.h>
+#include <ifcpp/model/GlobalDefines.h>
+#include <ifcpp/model/StatusCallback.h>
+#include <ifcpp/model/UnitConverter.h>
+#include <IfcGrid.h>
+#include <IfcGridAxis.h>
+#include <IfcVirtualGridIntersection.h>
+#include "IncludeCarveHeaders.h"
+
+using namespace IFC4X3;
+
+class CurveConverter;
+
+//\brief Computes the points of IfcVirtualGridIntersection in the object coordinate system of the IfcGrid
+///@details The axis curves of a grid are discretised once, when the first intersection on the grid is requested. Straight parts and circular arcs are kept
+///as such, so that intersections of offset axes are exact. Each pair of axes with its offset distances is intersected once and memoised, so that
+///elements on the same grid point, also from different threads, share the result.
+class IFCQUERY_EXPORT GridConverter : public StatusCallback
+{
+public:
+	//\brief Straight line piece or circular arc of a grid axis, in the xy plane of the grid, oriented according to SameSense
+	struct AxisPrimitive
+	{
+		bool	m_is_arc = false;
+		vec2	m_start;
+		vec2	m_end;
+		vec2	m_center;
+		double	m_radius = 0;
+		double	m_start_angle = 0;
+		double	m_opening_angle = 0;	// positive if counter-clockwise
+	};
+
+protected:
+	typedef std::tuple<const IfcGridAxis*, const IfcGridAxis*, double, double> IntersectionKey;
+
+	struct GridCacheEntry
+	{
+		std::once_flag												m_computed;
+		std::map<const IfcGridAxis*, std::vector<AxisPrimitive> >	m_axes;
+		std::map<IntersectionKey, std::pair<bool, vec2> >			m_intersections;
+		std::mutex													m_writelock_intersections;
+	};
+
+	shared_ptr<UnitConverter>							m_unit_converter;
+	weak_ptr<CurveConverter>							m_curve_converter;
+	std::map<int, shared_ptr<GridCacheEntry> >			m_grid_cache;
+	std::mutex											m_writelock_grid_cache;
+
+public:
+	GridConverter( shared_ptr<UnitConverter>& uc ) : m_unit_converter( uc )
+	{
+	}
+
+	virtual ~GridConverter()
+	{
+	}
+
+	//\brief The axis curves are discretised with the curve converter, which is set after construction because it uses the PlacementConverter itself
+	void setCurveConverter( const shared_ptr<CurveConverter>& curve_converter )
+	{
+		m_curve_converter = curve_converter;
+	}
+
+	void setUnitConverter( shared_ptr<UnitConverter>& unit_converter )
+	{
+		clearGridCache();
+		m_unit_converter = unit_converter;
+	}
+
+	void clearGridCache()
+	{
+		std::lock_guard<std::mutex> lock( m_writelock_grid_cache );
+		m_grid_cache.clear();
+	}
+
+	//\brief Returns the IfcGrid that the intersecting axes belong to, or nullptr
+	static shared_ptr<IfcGrid> getGrid( const shared_ptr<IfcVirtualGridIntersection>& grid_intersection );
+
+	//\brief Intersection point of the two axes, moved by the offset distances: the first two are lateral offsets to the left of the axes, the third is
+	//the height. Returns false if the axes do not intersect
+	bool getIntersectionPoint( const shared_ptr<IfcVirtualGridIntersection>& grid_intersection, vec3& point );
+
+	//\brief Intersection point of two axis curves, each offset to the left by the given distance. If the curves do not intersect within their bounds,
+	//the intersection closest to them is taken, so that virtual intersections of straight axes work
+	static bool intersectAxes( const std::vector<AxisPrimitive>& axis1, double offset1, const std::vector<AxisPrimitive>& axis2, double offset2, vec2& point );
+
+protected:
+	shared_ptr<GridCacheEntry> getGridCacheEntry( const shared_ptr<IfcGrid>& grid );
+	void convertGridAxis( const shared_ptr<IfcGridAxis>& grid_axis, std::vector<AxisPrimitive>& primitives );
+};
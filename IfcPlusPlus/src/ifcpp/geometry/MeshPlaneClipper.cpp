@@ -0,0 +1,633 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
+#include "IncludeCarveHeaders.h"
+#include "GeomUtils.h"
+#include "MeshPlaneClipper.h"
+
+namespace
+{
+	// Indexed faces. Points that are cut away are not removed, they are just not referenced anymore
+	struct FaceList
+	{
+		std::vector<vec3>					m_points;
+		std::vector<std::vector<uint32_t> >	m_faces;
+	};
+
+	inline uint64_t directedEdgeKey( uint32_t a, uint32_t b )
+	{
+		return (uint64_t( a ) << 32) | b;
+	}
+
+	inline double cross2D( const vec2& a, const vec2& b )
+	{
+		return a.x * b.y - a.y * b.x;
+	}
+
+	double distancePointSegment2D( const vec2& p, const vec2& a, const vec2& b )
+	{
+		vec2 ab = b - a;
+		double len2 = dot( ab, ab );
+		double t = 0;
+		if( len2 > 0 )
+		{
+			t = std::clamp( dot( p - a, ab ) / len2, 0.0, 1.0 );
+		}
+		vec2 closest = a + ab * t;
+		return (p - closest).length();
+	}
+
+	// true if the segments cross each other in their interior. Touching end points are not a crossing
+	bool segmentsCross2D( const vec2& a, const vec2& b, const vec2& c, const vec2& d, double eps )
+	{
+		double o1 = cross2D( b - a, c - a );
+		double o2 = cross2D( b - a, d - a );
+		double o3 = cross2D( d - c, a - c );
+		double o4 = cross2D( d - c, b - c );
+		double epsAB = eps * (b - a).length();
+		double epsCD = eps * (d - c).length();
+		return ((o1 > epsAB && o2 < -epsAB) || (o1 < -epsAB && o2 > epsAB)) && ((o3 > epsCD && o4 < -epsCD) || (o3 < -epsCD && o4 > epsCD));
+	}
+
+	bool isInsideOrOnBoundary( const std::vector<vec2>& boundary, const vec2& p, double eps )
+	{
+		if( GeomUtils::pointInPolySimple( boundary, p, eps ) )
+		{
+			return true;
+		}
+		for( size_t ii = 0; ii < boundary.size(); ++ii )
+		{
+			if( distancePointSegment2D( p, boundary[ii], boundary[(ii + 1) % boundary.size()] ) <= eps )
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	// A polygonal bounded half-space acts like an unbounded one if the mesh does not reach out of the prism of the boundary
+	bool isInsideBoundaryPrism( const FaceList& faceList, const MeshPlaneClipper::ClippingPlane& clippingPlane, double eps )
+	{
+		const std::vector<vec2>& boundary = clippingPlane.m_boundary;
+		if( boundary.size() < 3 )
+		{
+			return false;
+		}
+
+		std::vector<vec2> points2D( faceList.m_points.size() );
+		std::vector<bool> pointChecked( faceList.m_points.size(), false );
+		for( const std::vector<uint32_t>& face : faceList.m_faces )
+		{
+			for( uint32_t idx : face )
+			{
+				if( pointChecked[idx] )
+				{
+					continue;
+				}
+				vec3 d = faceList.m_points[idx] - clippingPlane.m_boundary_origin;
+				points2D[idx] = carve::geom::VECTOR( dot( d, clippingPlane.m_boundary_x ), dot( d, clippingPlane.m_boundary_y ) );
+				if( !isInsideOrOnBoundary( boundary, points2D[idx], eps ) )
+				{
+					return false;
+				}
+				pointChecked[idx] = true;
+			}
+		}
+
+		// with a concave boundary, an edge between two inside points can still leave the prism
+		for( const std::vector<uint32_t>& face : faceList.m_faces )
+		{
+			for( size_t ii = 0; ii < face.size(); ++ii )
+			{
+				uint32_t idxA = face[ii];
+				uint32_t idxB = face[(ii + 1) % face.size()];
+				if( idxA > idxB )
+				{
+					// each edge once, the opposite half-edge has the same points
+					continue;
+				}
+				const vec2& a = points2D[idxA];
+				const vec2& b = points2D[idxB];
+				if( !isInsideOrOnBoundary( boundary, (a + b) * 0.5, eps ) )
+				{
+					return false;
+				}
+				for( size_t jj = 0; jj < boundary.size(); ++jj )
+				{
+					if( segmentsCross2D( a, b, boundary[jj], boundary[(jj + 1) % boundary.size()], eps ) )
+					{
+						return false;
+					}
+				}
+			}
+		}
+		return true;
+	}
+
+	// Triangulates the loops of the cut, in the plane, with the normal -N, so that the cap faces point out of the kept part
+	bool addCapFaces( FaceList& faceList, const std::vector<std::vector<uint32_t> >& loops, const carve::geom::plane<3>& plane, double eps )
+	{
+		vec3 capNormal = -plane.N.normalized();
+		vec3 helperAxis = carve::geom::VECTOR( 1, 0, 0 );
+		if( std::abs( capNormal.y ) < std::abs( capNormal.x ) && std::abs( capNormal.y ) <= std::abs( capNormal.z ) )
+		{
+			helperAxis = carve::geom::VECTOR( 0, 1, 0 );
+		}
+		else if( std::abs( capNormal.z ) < std::abs( capNormal.x ) && std::abs( capNormal.z ) < std::abs( capNormal.y ) )
+		{
+			helperAxis = carve::geom::VECTOR( 0, 0, 1 );
+		}
+		vec3 axisU = cross( capNormal, helperAxis ).normalized();
+		vec3 axisV = cross( capNormal, axisU );
+
+		// outer loops are counter-clockwise around the cap normal, holes are clockwise
+		std::vector<std::vector<vec2> > loops2D( loops.size() );
+		std::vector<double> loopArea( loops.size(), 0 );
+		std::vector<size_t> outerLoops;
+		std::vector<size_t> holeLoops;
+		for( size_t ii = 0; ii < loops.size(); ++ii )
+		{
+			const std::vector<uint32_t>& loop = loops[ii];
+			std::vector<vec2>& loop2D = loops2D[ii];
+			for( uint32_t idx : loop )
+			{
+				const vec3& p = faceList.m_points[idx];
+				loop2D.push_back( carve::geom::VECTOR( dot( p, axisU ), dot( p, axisV ) ) );
+			}
+
+			double area = 0;
+			for( size_t jj = 0; jj < loop2D.size(); ++jj )
+			{
+				area += cross2D( loop2D[jj], loop2D[(jj + 1) % loop2D.size()] );
+			}
+			area *= 0.5;
+			if( std::abs( area ) < eps * eps )
+			{
+				return false;
+			}
+			loopArea[ii] = area;
+			if( area > 0 )
+			{
+				outerLoops.push_back( ii );
+			}
+			else
+			{
+				holeLoops.push_back( ii );
+			}
+		}
+
+		// assign each hole to the smallest outer loop that contains it
+		std::vector<std::vector<size_t> > holesOfOuterLoop( loops.size() );
+		for( size_t holeIndex : holeLoops )
+		{
+			const std::vector<vec2>& hole2D = loops2D[holeIndex];
+			vec2 centroid = carve::geom::VECTOR( 0, 0 );
+			for( const vec2& p : hole2D )
+			{
+				centroid += p;
+			}
+			centroid /= double( hole2D.size() );
+
+			size_t bestOuter = loops.size();
+			for( size_t outerIndex : outerLoops )
+			{
+				if( GeomUtils::pointInPolySimple( loops2D[outerIndex], centroid, eps ) )
+				{
+					if( bestOuter == loops.size() || loopArea[outerIndex] < loopArea[bestOuter] )
+					{
+						bestOuter = outerIndex;
+					}
+				}
+			}
+			if( bestOuter == loops.size() )
+			{
+				return false;
+			}
+			holesOfOuterLoop[bestOuter].push_back( holeIndex );
+		}
+
+		for( size_t outerIndex : outerLoops )
+		{
+			if( holesOfOuterLoop[outerIndex].empty() )
+			{
+				// The loop is planar, so it can be used as face directly. Triangulation would not keep the collinear points where the cut crosses the edges of coplanar faces
+				faceList.m_faces.push_back( loops[outerIndex] );
+				continue;
+			}
+
+			std::vector<std::vector<vec2> > polygon2D;
+			std::vector<std::vector<uint32_t> > polygonIndices;
+			polygon2D.push_back( loops2D[outerIndex] );
+			polygonIndices.push_back( loops[outerIndex] );
+			for( size_t holeIndex : holesOfOuterLoop[outerIndex] )
+			{
+				polygon2D.push_back( loops2D[holeIndex] );
+				polygonIndices.push_back( loops[holeIndex] );
+			}
+
+			std::vector<vec2> pathMerged;
+			std::vector<uint32_t> pathMergedIndices;
+			std::vector<carve::triangulate::tri_idx> triangulated;
+			try
+			{
+				std::vector<std::pair<size_t, size_t> > pathIncorporatedHoles = carve::triangulate::incorporateHolesIntoPolygon( polygon2D );	// first is loop index, second is vertex index in loop
+				for( const std::pair<size_t, size_t>& loopAndVertex : pathIncorporatedHoles )
+				{
+					pathMerged.push_back( polygon2D[loopAndVertex.first][loopAndVertex.second] );
+					pathMergedIndices.push_back( polygonIndices[loopAndVertex.first][loopAndVertex.second] );
+				}
+				carve::triangulate::triangulate( pathMerged, triangulated, eps );
+				carve::triangulate::improve( pathMerged, triangulated );
+			}
+			catch( ... )
+			{
+				return false;
+			}
+
+			for( const carve::triangulate::tri_idx& triangle : triangulated )
+			{
+				uint32_t idxA = pathMergedIndices[triangle.a];
+				uint32_t idxB = pathMergedIndices[triangle.b];
+				uint32_t idxC = pathMergedIndices[triangle.c];
+				if( idxA == idxB || idxB == idxC || idxC == idxA )
+				{
+					continue;
+				}
+				faceList.m_faces.push_back( { idxA, idxB, idxC } );
+			}
+		}
+		return true;
+	}
+
+	// number of changes between the kept and the removed side along the face loop. Vertices in the plane are ignored
+	int countSideChanges( const std::vector<uint32_t>& face, const std::vector<int>& side )
+	{
+		int numSideChanges = 0;
+		int previousSide = 0;
+		int firstSide = 0;
+		for( uint32_t idx : face )
+		{
+			int s = side[idx];
+			if( s == 0 )
+			{
+				continue;
+			}
+			if( firstSide == 0 )
+			{
+				firstSide = s;
+			}
+			else if( s != previousSide )
+			{
+				++numSideChanges;
+			}
+			previousSide = s;
+		}
+		if( previousSide != firstSide )
+		{
+			++numSideChanges;
+		}
+		return numSideChanges;
+	}
+
+	// Triangulates a concave face in its plane, so that each part can be clipped separately
+	bool triangulateFace( const FaceList& faceList, const std::vector<uint32_t>& face, std::vector<std::vector<uint32_t> >& triangles, double eps )
+	{
+		vec3 faceNormal = carve::geom::VECTOR( 0, 0, 0 );
+		for( size_t ii = 0; ii < face.size(); ++ii )
+		{
+			faceNormal += cross( faceList.m_points[face[ii]], faceList.m_points[face[(ii + 1) % face.size()]] );
+		}
+		if( faceNormal.length2() < eps * eps )
+		{
+			return false;
+		}
+		faceNormal.normalize();
+		vec3 helperAxis = std::abs( faceNormal.x ) < 0.9 ? carve::geom::VECTOR( 1, 0, 0 ) : carve::geom::VECTOR( 0, 1, 0 );
+		vec3 axisU = cross( faceNormal, helperAxis ).normalized();
+		vec3 axisV = cross( faceNormal, axisU );
+
+		std::vector<vec2> face2D;
+		for( uint32_t idx : face )
+		{
+			const vec3& p = faceList.m_points[idx];
+			face2D.push_back( carve::geom::VECTOR( dot( p, axisU ), dot( p, axisV ) ) );
+		}
+
+		std::vector<carve::triangulate::tri_idx> triangulated;
+		try
+		{
+			carve::triangulate::triangulate( face2D, triangulated, eps );
+		}
+		catch( ... )
+		{
+			return false;
+		}
+
+		for( const carve::triangulate::tri_idx& triangle : triangulated )
+		{
+			uint32_t idxA = face[triangle.a];
+			uint32_t idxB = face[triangle.b];
+			uint32_t idxC = face[triangle.c];
+			if( idxA == idxB || idxB == idxC || idxC == idxA )
+			{
+				continue;
+			}
+			triangles.push_back( { idxA, idxB, idxC } );
+		}
+		return true;
+	}
+
+	bool clipByPlane( FaceList& faceList, const carve::geom::plane<3>& plane, double eps )
+	{
+		std::vector<vec3>& points = faceList.m_points;
+		std::vector<double> distance( points.size() );
+		std::vector<int> side( points.size() );
+		std::vector<bool> onPlane( points.size() );
+		bool anyKept = false;
+		bool anyRemoved = false;
+		for( const std::vector<uint32_t>& face : faceList.m_faces )
+		{
+			for( uint32_t idx : face )
+			{
+				double dist = dot( plane.N, points[idx] ) + plane.d;
+				distance[idx] = dist;
+				side[idx] = dist > eps ? 1 : (dist < -eps ? -1 : 0);
+				onPlane[idx] = side[idx] == 0;
+				anyKept = anyKept || side[idx] > 0;
+				anyRemoved = anyRemoved || side[idx] < 0;
+			}
+		}
+
+		if( !anyRemoved )
+		{
+			return true;
+		}
+		if( !anyKept )
+		{
+			// everything is cut away
+			return false;
+		}
+
+		// A concave face can be split into several parts by the plane. It is triangulated first, then each triangle is clipped
+		std::vector<std::vector<uint32_t> > facesToClip;
+		facesToClip.reserve( faceList.m_faces.size() );
+		for( std::vector<uint32_t>& face : faceList.m_faces )
+		{
+			if( countSideChanges( face, side ) > 2 )
+			{
+				if( !triangulateFace( faceList, face, facesToClip, eps ) )
+				{
+					return false;
+				}
+				continue;
+			}
+			facesToClip.push_back( std::move( face ) );
+		}
+
+		std::unordered_map<uint64_t, uint32_t> mapIntersectionPoints;
+		auto getIntersectionPoint = [&]( uint32_t idxA, uint32_t idxB ) -> uint32_t
+		{
+			uint64_t key = directedEdgeKey( std::min( idxA, idxB ), std::max( idxA, idxB ) );
+			auto it = mapIntersectionPoints.find( key );
+			if( it != mapIntersectionPoints.end() )
+			{
+				return it->second;
+			}
+			double t = distance[idxA] / (distance[idxA] - distance[idxB]);
+			uint32_t newIndex = (uint32_t)points.size();
+			points.push_back( points[idxA] + (points[idxB] - points[idxA]) * t );
+			onPlane.push_back( true );
+			mapIntersectionPoints[key] = newIndex;
+			return newIndex;
+		};
+
+		std::vector<std::vector<uint32_t> > clippedFaces;
+		clippedFaces.reserve( facesToClip.size() );
+		for( const std::vector<uint32_t>& face : facesToClip )
+		{
+			bool hasKept = false;
+			bool hasRemoved = false;
+			for( uint32_t idx : face )
+			{
+				hasKept = hasKept || side[idx] > 0;
+				hasRemoved = hasRemoved || side[idx] < 0;
+			}
+
+			if( !hasKept && !hasRemoved )
+			{
+				// face in the plane. Keep it if it faces away from the kept part
+				vec3 faceNormal = carve::geom::VECTOR( 0, 0, 0 );
+				for( size_t ii = 0; ii < face.size(); ++ii )
+				{
+					faceNormal += cross( points[face[ii]], points[face[(ii + 1) % face.size()]] );
+				}
+				if( dot( faceNormal, plane.N ) < 0 )
+				{
+					clippedFaces.push_back( face );
+				}
+				continue;
+			}
+			if( !hasRemoved )
+			{
+				clippedFaces.push_back( face );
+				continue;
+			}
+			if( !hasKept )
+			{
+				continue;
+			}
+
+			std::vector<uint32_t> clippedFace;
+			for( size_t ii = 0; ii < face.size(); ++ii )
+			{
+				uint32_t idxA = face[ii];
+				uint32_t idxB = face[(ii + 1) % face.size()];
+				if( side[idxA] >= 0 )
+				{
+					clippedFace.push_back( idxA );
+				}
+				if( side[idxA] * side[idxB] < 0 )
+				{
+					clippedFace.push_back( getIntersectionPoint( idxA, idxB ) );
+				}
+			}
+			if( clippedFace.size() > 2 )
+			{
+				clippedFaces.push_back( clippedFace );
+			}
+		}
+
+		// half-edges without opposite half-edge are the cut. They must be in the plane, and form simple loops
+		std::unordered_set<uint64_t> setHalfEdges;
+		for( const std::vector<uint32_t>& face : clippedFaces )
+		{
+			for( size_t ii = 0; ii < face.size(); ++ii )
+			{
+				setHalfEdges.insert( directedEdgeKey( face[ii], face[(ii + 1) % face.size()] ) );
+			}
+		}
+
+		std::unordered_map<uint32_t, uint32_t> mapCapEdges;
+		for( const std::vector<uint32_t>& face : clippedFaces )
+		{
+			for( size_t ii = 0; ii < face.size(); ++ii )
+			{
+				uint32_t idxA = face[ii];
+				uint32_t idxB = face[(ii + 1) % face.size()];
+				if( setHalfEdges.find( directedEdgeKey( idxB, idxA ) ) != setHalfEdges.end() )
+				{
+					continue;
+				}
+				if( !onPlane[idxA] || !onPlane[idxB] )
+				{
+					return false;
+				}
+				// the cap uses the edge in the opposite direction
+				if( !mapCapEdges.insert( { idxB, idxA } ).second )
+				{
+					return false;
+				}
+			}
+		}
+
+		std::vector<std::vector<uint32_t> > loops;
+		std::unordered_set<uint32_t> setVisited;
+		for( const auto& capEdge : mapCapEdges )
+		{
+			if( setVisited.find( capEdge.first ) != setVisited.end() )
+			{
+				continue;
+			}
+			std::vector<uint32_t> loop;
+			uint32_t current = capEdge.first;
+			while( setVisited.insert( current ).second )
+			{
+				loop.push_back( current );
+				auto itNext = mapCapEdges.find( current );
+				if( itNext == mapCapEdges.end() )
+				{
+					return false;
+				}
+				current = itNext->second;
+			}
+			if( current != capEdge.first || loop.size() < 3 )
+			{
+				return false;
+			}
+			loops.push_back( loop );
+		}
+
+		faceList.m_faces.swap( clippedFaces );
+		if( loops.size() > 0 )
+		{
+			return addCapFaces( faceList, loops, plane, eps );
+		}
+		return true;
+	}
+}
+
+bool MeshPlaneClipper::clipMeshSet( const shared_ptr<carve::mesh::MeshSet<3> >& meshset, const std::vector<ClippingPlane>& planes, shared_ptr<carve::mesh::MeshSet<3> >& resultMeshset, double eps )
+{
+	if( !meshset )
+	{
+		return false;
+	}
+	if( meshset->vertex_storage.empty() )
+	{
+		return false;
+	}
+
+	FaceList faceList;
+	const carve::mesh::Vertex<3>* firstVertex = &meshset->vertex_storage[0];
+	for( const carve::mesh::Vertex<3>& vertex : meshset->vertex_storage )
+	{
+		faceList.m_points.push_back( vertex.v );
+	}
+	for( const carve::mesh::Mesh<3>* mesh : meshset->meshes )
+	{
+		if( !mesh->isClosed() )
+		{
+			return false;
+		}
+		for( const carve::mesh::Face<3>* face : mesh->faces )
+		{
+			std::vector<uint32_t> faceIndices;
+			const carve::mesh::Edge<3>* edge = face->edge;
+			for( size_t ii = 0; ii < face->nVertices(); ++ii )
+			{
+				faceIndices.push_back( (uint32_t)(edge->vert - firstVertex) );
+				edge = edge->next;
+			}
+			faceList.m_faces.push_back( faceIndices );
+		}
+	}
+
+	for( const ClippingPlane& clippingPlane : planes )
+	{
+		if( clippingPlane.m_boundary.size() > 0 )
+		{
+			if( !isInsideBoundaryPrism( faceList, clippingPlane, eps ) )
+			{
+				return false;
+			}
+		}
+		if( !clipByPlane( faceList, clippingPlane.m_plane, eps ) )
+		{
+			return false;
+		}
+	}
+
+	// copy only the points that are still used
+	carve::input::PolyhedronData polyData;
+	std::vector<int> newIndices( faceList.m_points.size(), -1 );
+	for( const std::vector<uint32_t>& face : faceList.m_faces )
+	{
+		std::vector<int> faceIndices;
+		for( uint32_t idx : face )
+		{
+			if( newIndices[idx] < 0 )
+			{
+				newIndices[idx] = (int)polyData.points.size();
+				polyData.points.push_back( faceList.m_points[idx] );
+			}
+			faceIndices.push_back( newIndices[idx] );
+		}
+		polyData.addFace( faceIndices.begin(), faceIndices.end() );
+	}
+
+	shared_ptr<carve::mesh::MeshSet<3> > clippedMeshset( polyData.createMesh( carve::input::opts(), eps ) );
+	if( !clippedMeshset || clippedMeshset->meshes.empty() )
+	{
+		return false;
+	}
+	for( carve::mesh::Mesh<3>* mesh : clippedMeshset->meshes )
+	{
+		if( !mesh->isClosed() )
+		{
+			return false;
+		}
+		if( mesh->volume() <= 0 )
+		{
+			return false;
+		}
+	}
+	resultMeshset = clippedMeshset;
+	return true;
+}
@@ -0,0 +1,49 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <vector>
+#include <ifcpp/model/BasicTypes.h>
+#include <ifcpp/model/GlobalDefines.h>
+#include "IncludeCarveHeaders.h"
+
+///@brief Cuts closed meshes by planes without a boolean operation, used for IfcHalfSpaceSolid and chains of IfcBooleanClippingResult
+///@details The faces are clipped against each plane, and the cut is closed with a triangulated cap polygon, so the result is closed again.
+///All planes are applied in one pass over a simple indexed face list, the carve mesh is created only once at the end.
+///Concave faces that would be split into several parts are triangulated first. The clipper does not try to handle degenerate cases.
+///It returns false for example if the cut edges do not form simple loops, or if the result is empty. The caller should then use the CSG operation.
+class IFCQUERY_EXPORT MeshPlaneClipper
+{
+public:
+	struct ClippingPlane
+	{
+		// The part of the mesh with dot(N, p) + d > 0 is kept
+		carve::geom::plane<3>	m_plane;
+
+		// For IfcPolygonalBoundedHalfSpace: the boundary polygon in the XY plane of the boundary position.
+		// The plane is used only if the whole mesh is inside the prism of the boundary at the time the plane is applied.
+		std::vector<vec2>		m_boundary;
+		vec3					m_boundary_origin;
+		vec3					m_boundary_x;
+		vec3					m_boundary_y;
+	};
+
+	///@brief Applies all planes to the meshset, in the given order
+	///@return false if the mesh is not closed, or in a degenerate case. resultMeshset is not set then
+	static bool clipMeshSet( const shared_ptr<carve::mesh::MeshSet<3> >& meshset, const std::vector<ClippingPlane>& planes, shared_ptr<carve::mesh::MeshSet<3> >& resultMeshset, double eps );
+};
@@ -28,7 +28,7 @@ void MeshSimplifier::simplifyMeshSet(shared_ptr<carve::mesh::MeshSet<3> >& meshs
 		return;
 	}
 
-	printToDebugLog(__FUNC__, "");
+	CARVE_TRACE_SCOPE(__FUNC__, paramsInput.ifc_entity ? paramsInput.ifc_entity->m_tag : 0);
 	GeomProcessingParams params(paramsInput);
 	StatusCallback* report_callback = params.callbackFunc;
 	BuildingEntity* entity = params.ifc_entity;
@@ -24,6 +24,7 @@ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OU
 #include <IfcAxis1Placement.h>
 #include <IfcAxis2Placement2D.h>
 #include <IfcAxis2Placement3D.h>
+#include <IfcAxis2PlacementLinear.h>
 #include <IfcCartesianPoint.h>
 #include <IfcCartesianTransformationOperator.h>
 #include <IfcCartesianTransformationOperator2DnonUniform.h>
@@ -32,16 +33,21 @@ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OU
 #include <IfcDirection.h>
 #include <IfcGeometricRepresentationContext.h>
 #include <IfcGeometricRepresentationSubContext.h>
+#include <IfcGrid.h>
 #include <IfcGridAxis.h>
 #include <IfcGridPlacement.h>
 #include <IfcLengthMeasure.h>
+#include <IfcLinearPlacement.h>
 #include <IfcLocalPlacement.h>
 #include <IfcObjectPlacement.h>
 #include <IfcPlacement.h>
+#include <IfcPointByDistanceExpression.h>
 #include <IfcRepresentationContext.h>
 #include <IfcReal.h>
 #include <IfcVirtualGridIntersection.h>
+#include "AlignmentConverter.h"
 #include "GeomUtils.h"
+#include "GridConverter.h"
 #include "GeometryInputData.h"
 #include "IncludeCarveHeaders.h"
 
@@ -51,10 +57,25 @@ class PlacementConverter : public StatusCallback
 {
 public:
 	shared_ptr<UnitConverter>	m_unit_converter;
+	shared_ptr<AlignmentConverter>	m_alignment_converter;
+	shared_ptr<GridConverter>		m_grid_converter;
 
 	PlacementConverter( shared_ptr<UnitConverter>& uc ) : m_unit_converter( uc )
 	{
+		m_alignment_converter = shared_ptr<AlignmentConverter>( new AlignmentConverter( m_unit_converter ) );
+		m_alignment_converter->setMessageTarget( this );
+		m_grid_converter = shared_ptr<GridConverter>( new GridConverter( m_unit_converter ) );
+		m_grid_converter->setMessageTarget( this );
+	}
+
+	const shared_ptr<AlignmentConverter>& getAlignmentConverter() { return m_alignment_converter; }
+	const shared_ptr<GridConverter>& getGridConverter() { return m_grid_converter; }
 
+	void setUnitConverter( shared_ptr<UnitConverter>& unit_converter )
+	{
+		m_unit_converter = unit_converter;
+		m_alignment_converter->setUnitConverter( unit_converter );
+		m_grid_converter->setUnitConverter( unit_converter );
 	}
 
 	void convertIfcAxis2Placement2D( const shared_ptr<IfcAxis2Placement2D>& axis2placement2d, shared_ptr<TransformData>& resultingTransform, bool only_rotation = false )
@@ -219,6 +240,100 @@ public:
 		resultingTransform->m_placement_tag = axis2placement3d->m_tag;
 	}
 
+	//\brief Converts a placement relative to a curve, usually an alignment. Returns false if the basis curve can not be evaluated
+	bool convertIfcAxis2PlacementLinear( const shared_ptr<IfcAxis2PlacementLinear>& axis2placement_linear, shared_ptr<TransformData>& resultingTransform, bool only_rotation = false )
+	{
+		if( !axis2placement_linear )
+		{
+			return false;
+		}
+		shared_ptr<IfcPointByDistanceExpression> point_by_distance = dynamic_pointer_cast<IfcPointByDistanceExpression>( axis2placement_linear->m_Location );
+		if( !point_by_distance )
+		{
+			return false;
+		}
+		shared_ptr<AlignmentCurve> alignment_curve = m_alignment_converter->getAlignmentCurve( point_by_distance->m_BasisCurve );
+		if( !alignment_curve )
+		{
+			return false;
+		}
+
+		const double length_factor = m_unit_converter->getLengthInMeterFactor();
+		// IfcParameterValue is not the distance along a composite curve, leave it to the CartesianPosition
+		shared_ptr<IfcLengthMeasure> distance_length = dynamic_pointer_cast<IfcLengthMeasure>( point_by_distance->m_DistanceAlong );
+		if( !distance_length )
+		{
+			return false;
+		}
+		const double distance_along = distance_length->m_value * length_factor;
+
+		AlignmentCurve::Frame frame;
+		alignment_curve->getFrame( distance_along, frame );
+
+		vec3 translate( carve::geom::VECTOR( 0.0, 0.0, 0.0 ) );
+		if( !only_rotation )
+		{
+			translate = frame.m_point;
+			if( point_by_distance->m_OffsetLongitudinal )
+			{
+				translate += frame.m_tangent * ( point_by_distance->m_OffsetLongitudinal->m_value * length_factor );
+			}
+			if( point_by_distance->m_OffsetLateral )
+			{
+				translate += frame.m_lateral * ( point_by_distance->m_OffsetLateral->m_value * length_factor );
+			}
+			if( point_by_distance->m_OffsetVertical )
+			{
+				translate += frame.m_up * ( point_by_distance->m_OffsetVertical->m_value * length_factor );
+			}
+		}
+
+		// Axis and RefDirection are given relative to the curve: x along the tangent, y to the left, z up
+		vec3 local_z( carve::geom::VECTOR( 0.0, 0.0, 1.0 ) );
+		vec3 ref_direction( carve::geom::VECTOR( 1.0, 0.0, 0.0 ) );
+		if( axis2placement_linear->m_Axis && axis2placement_linear->m_Axis->m_DirectionRatios.size() > 2 )
+		{
+			std::vector<shared_ptr<IfcReal> >& axis = axis2placement_linear->m_Axis->m_DirectionRatios;
+			local_z = carve::geom::VECTOR( axis[0]->m_value, axis[1]->m_value, axis[2]->m_value );
+		}
+		if( axis2placement_linear->m_RefDirection && axis2placement_linear->m_RefDirection->m_DirectionRatios.size() > 2 )
+		{
+			std::vector<shared_ptr<IfcReal> >& ref = axis2placement_linear->m_RefDirection->m_DirectionRatios;
+			ref_direction = carve::geom::VECTOR( ref[0]->m_value, ref[1]->m_value, ref[2]->m_value );
+		}
+
+		vec3 local_y = carve::geom::cross( local_z, ref_direction );
+		if( local_y.length2() < 1e-12 )
+		{
+			messageCallback( "#" + std::to_string( axis2placement_linear->m_tag ) + "=IfcAxis2PlacementLinear has incorrect Axis and RefDirection", StatusCallback::MESSAGE_TYPE_WARNING, __FUNC__, axis2placement_linear.get() );
+			local_z = carve::geom::VECTOR( 0.0, 0.0, 1.0 );
+			local_y = carve::geom::VECTOR( 0.0, 1.0, 0.0 );
+		}
+		vec3 local_x = carve::geom::cross( local_y, local_z );
+		GeomUtils::safeNormalize( local_x, 1e-15 );
+		GeomUtils::safeNormalize( local_y, 1e-15 );
+		GeomUtils::safeNormalize( local_z, 1e-15 );
+
+		auto toWorld = [&]( const vec3& v ) { return frame.m_tangent * v.x + frame.m_lateral * v.y + frame.m_up * v.z; };
+		local_x = toWorld( local_x );
+		local_y = toWorld( local_y );
+		local_z = toWorld( local_z );
+
+		if( !resultingTransform )
+		{
+			resultingTransform = shared_ptr<TransformData>( new TransformData() );
+		}
+
+		resultingTransform->m_matrix = carve::math::Matrix(
+			local_x.x, local_y.x, local_z.x, translate.x,
+			local_x.y, local_y.y, local_z.y, translate.y,
+			local_x.z, local_y.z, local_z.z, translate.z,
+			0, 0, 0, 1 );
+		resultingTransform->m_placement_entity = axis2placement_linear;
+		resultingTransform->m_placement_tag = axis2placement_linear->m_tag;
+		return true;
+	}
+
 	inline void getPlane( const shared_ptr<IfcAxis2Placement3D>& axis2placement3d, carve::geom::plane<3>& plane, vec3& translate )
 	{
 		const double length_factor = m_unit_converter->getLengthInMeterFactor();
@@ -478,21 +593,95 @@ public:
 				}
 			}
 		}
+		else if( dynamic_pointer_cast<IfcLinearPlacement>( ifc_object_placement ) )
+		{
+			shared_ptr<IfcLinearPlacement> linear_placement = dynamic_pointer_cast<IfcLinearPlacement>( ifc_object_placement );
+			if( linear_placement->m_PlacementRelTo )
+			{
+				convertIfcObjectPlacement( linear_placement->m_PlacementRelTo, product_data, placement_already_applied, only_rotation );
+			}
+
+			shared_ptr<TransformData> relative_placement_matrix;
+			if( convertIfcAxis2PlacementLinear( linear_placement->m_RelativePlacement, relative_placement_matrix, only_rotation ) )
+			{
+				product_data->addTransform( relative_placement_matrix );
+			}
+			else if( linear_placement->m_CartesianPosition )
+			{
+				// the basis curve can not be evaluated, so use the precomputed position
+				convertIfcAxis2Placement3D( linear_placement->m_CartesianPosition, relative_placement_matrix, only_rotation );
+				product_data->addTransform( relative_placement_matrix );
+			}
+			else
+			{
+				messageCallback( "IfcLinearPlacement: basis curve not supported", StatusCallback::MESSAGE_TYPE_WARNING, __FUNC__, linear_placement.get() );
+			}
+		}
 		else if( dynamic_pointer_cast<IfcGridPlacement>( ifc_object_placement ) )
 		{
 			shared_ptr<IfcGridPlacement> grid_placement = dynamic_pointer_cast<IfcGridPlacement>( ifc_object_placement );
-
 			shared_ptr<IfcVirtualGridIntersection> grid_intersection = grid_placement->m_PlacementLocation;
-			if( grid_intersection )
+			vec3 translate( carve::geom::VECTOR( 0.0, 0.0, 0.0 ) );
+			if( !m_grid_converter->getIntersectionPoint( grid_intersection, translate ) )
 			{
-				//std::vector<shared_ptr<IfcGridAxis> >& vec_grid_axis = grid_intersection->m_IntersectingAxes;
-				//std::vector<shared_ptr<IfcLengthMeasure> >& vec_offsets = grid_intersection->m_OffsetDistances;
-				// todo: implement
+				messageCallback( "IfcGridPlacement: grid axes do not intersect", StatusCallback::MESSAGE_TYPE_WARNING, __FUNC__, grid_placement.get() );
+				return;
+			}
+
+			// the grid axes are given in the object coordinate system of the grid
+			if( grid_placement->m_PlacementRelTo )
+			{
+				convertIfcObjectPlacement( grid_placement->m_PlacementRelTo, product_data, placement_already_applied, only_rotation );
+			}
+			else
+			{
+				shared_ptr<IfcGrid> grid = GridConverter::getGrid( grid_intersection );
+				if( grid && grid->m_ObjectPlacement )
+				{
+					convertIfcObjectPlacement( grid->m_ObjectPlacement, product_data, placement_already_applied, only_rotation );
+				}
+			}
 
+			// IfcGridPlacementDirectionSelect: explicit direction, or a second intersection that the x axis points to.
+			// Without PlacementRefDirection, the axes are parallel to the ones of the grid
+			vec3 local_x( carve::geom::VECTOR( 1.0, 0.0, 0.0 ) );
+			vec3 local_z( carve::geom::VECTOR( 0.0, 0.0, 1.0 ) );
+			shared_ptr<IfcDirection> ref_direction = dynamic_pointer_cast<IfcDirection>( grid_placement->m_PlacementRefDirection );
+			shared_ptr<IfcVirtualGridIntersection> ref_intersection = dynamic_pointer_cast<IfcVirtualGridIntersection>( grid_placement->m_PlacementRefDirection );
+			if( ref_direction && ref_direction->m_DirectionRatios.size() > 1 )
+			{
+				std::vector<shared_ptr<IfcReal> >& ratios = ref_direction->m_DirectionRatios;
+				local_x = carve::geom::VECTOR( ratios[0]->m_value, ratios[1]->m_value, 0.0 );
+			}
+			else if( ref_intersection )
+			{
+				vec3 ref_point;
+				if( m_grid_converter->getIntersectionPoint( ref_intersection, ref_point ) )
+				{
+					local_x = carve::geom::VECTOR( ref_point.x - translate.x, ref_point.y - translate.y, 0.0 );
+				}
+			}
+			if( local_x.length2() < 1e-20 )
+			{
+				local_x = carve::geom::VECTOR( 1.0, 0.0, 0.0 );
+			}
+			GeomUtils::safeNormalize( local_x, 1e-15 );
+			vec3 local_y = carve::geom::cross( local_z, local_x );
+
+			if( only_rotation )
+			{
+				translate = carve::geom::VECTOR( 0.0, 0.0, 0.0 );
 			}
-			messageCallback( "IfcGridPlacement not implemented", StatusCallback::MESSAGE_TYPE_WARNING, __FUNC__, grid_placement.get() );
 
-			//IfcGridPlacementDirectionSelect* ref_direction = grid_placement->m_PlacementRefDirection.get();	//optional
+			shared_ptr<TransformData> grid_placement_matrix( new TransformData() );
+			grid_placement_matrix->m_matrix = carve::math::Matrix(
+				local_x.x, local_y.x, local_z.x, translate.x,
+				local_x.y, local_y.y, local_z.y, translate.y,
+				local_x.z, local_y.z, local_z.z, translate.z,
+				0, 0, 0, 1 );
+			grid_placement_matrix->m_placement_entity = grid_placement;
+			grid_placement_matrix->m_placement_tag = grid_placement->m_tag;
+			product_data->addTransform( grid_placement_matrix );
 		}
 	}
 
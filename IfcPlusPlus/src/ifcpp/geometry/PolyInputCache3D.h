@@ -46,12 +46,24 @@ public:
 	shared_ptr<carve::input::PolyhedronData> m_poly_data;
 	double epsilon;
 
-	PolyInputCache3D(double eps = 1e-6) : epsilon(eps) {
+	// If m_deferWelding is set, points and faces are only recorded. They can be merged into another cache later with
+	// mergeDeferredInto, which gives exactly the same result as adding them to that cache directly.
+	// This allows to triangulate parts of a mesh in parallel and weld the points in the original order afterwards.
+	bool m_deferWelding = false;
+
+	PolyInputCache3D(double eps = 1e-6, bool deferWelding = false) : epsilon(eps), m_deferWelding(deferWelding) {
 		m_poly_data = shared_ptr<carve::input::PolyhedronData>(new carve::input::PolyhedronData());
 	}
 
 	// Adds a point to the cache. Returns the index of the existing or newly inserted point.
 	uint32_t addPoint(const vec3& pt) {
+		if (m_deferWelding)
+		{
+			uint32_t newIndex = static_cast<uint32_t>(m_poly_data->points.size());
+			m_poly_data->points.push_back(pt);
+			return newIndex;
+		}
+
 		uint32_t hash = Vec3Hash(pt, epsilon);
 		std::vector<vec3>& pointList = m_poly_data->points;
 
@@ -72,10 +84,51 @@ public:
 		return newIndex;
 	}
 
+	void addFace(uint32_t idxA, uint32_t idxB, uint32_t idxC)
+	{
+		if (m_deferWelding)
+		{
+			m_deferredOps.push_back({ DEFERRED_FACE, { idxA, idxB, idxC, 0 }, 0.0 });
+			return;
+		}
+		m_poly_data->addFace(idxA, idxB, idxC);
+	}
+
 	void clearPointCache()
 	{
 		m_hashToIndexMap.clear();
 		m_poly_data->points.clear();
+		m_deferredOps.clear();
+	}
+
+	// Welds the recorded points into target, then adds the recorded faces with the resulting indices
+	void mergeDeferredInto(PolyInputCache3D& target) const
+	{
+		const std::vector<vec3>& points = m_poly_data->points;
+		std::vector<uint32_t> targetIndex(points.size());
+		for (size_t ii = 0; ii < points.size(); ++ii)
+		{
+			targetIndex[ii] = target.addPoint(points[ii]);
+		}
+
+		for (const DeferredOp& op : m_deferredOps)
+		{
+			const uint32_t* idx = op.idx;
+			if (op.type == DEFERRED_FACE)
+			{
+				target.addFace(targetIndex[idx[0]], targetIndex[idx[1]], targetIndex[idx[2]]);
+			}
+			else if (op.type == DEFERRED_TRIANGLE_CHECK)
+			{
+				target.addTriangleCheckDegenerate(targetIndex[idx[0]], targetIndex[idx[1]], targetIndex[idx[2]],
+					points[idx[0]], points[idx[1]], points[idx[2]], op.eps);
+			}
+			else if (op.type == DEFERRED_QUAD_CHECK)
+			{
+				target.addFaceCheckIndexes(targetIndex[idx[0]], targetIndex[idx[1]], targetIndex[idx[2]], targetIndex[idx[3]],
+					points[idx[0]], points[idx[1]], points[idx[2]], points[idx[3]], op.eps);
+			}
+		}
 	}
 
 	void copyOtherPolyData(shared_ptr<carve::input::PolyhedronData>& other)
@@ -106,6 +159,13 @@ public:
 	void addFaceCheckIndexes(uint32_t idxA, uint32_t idxB, uint32_t idxC, uint32_t idxD,
 		const vec3& v0, const vec3& v1, const vec3& v2, const vec3& v3, double eps)
 	{
+		if (m_deferWelding)
+		{
+			// index comparison is only meaningful after welding
+			m_deferredOps.push_back({ DEFERRED_QUAD_CHECK, { idxA, idxB, idxC, idxD }, eps });
+			return;
+		}
+
 		std::unordered_set<uint32_t> setIndices = { idxA, idxB, idxC, idxD };
 
 		if (setIndices.size() == 3)
@@ -146,6 +206,12 @@ public:
 	void addTriangleCheckDegenerate(uint32_t idxA, uint32_t idxB, uint32_t idxC,
 		const vec3& pointA, const vec3& pointB, const vec3& pointC, double eps)
 	{
+		if (m_deferWelding)
+		{
+			m_deferredOps.push_back({ DEFERRED_TRIANGLE_CHECK, { idxA, idxB, idxC, 0 }, eps });
+			return;
+		}
+
 		if (idxA == idxB || idxA == idxC || idxB == idxC)
 		{
 #ifdef _DEBUG
@@ -218,4 +284,14 @@ public:
 		}
 #endif
 	}
+
+protected:
+	enum DeferredOpType { DEFERRED_FACE, DEFERRED_TRIANGLE_CHECK, DEFERRED_QUAD_CHECK };
+	struct DeferredOp
+	{
+		DeferredOpType type;
+		uint32_t idx[4];
+		double eps;
+	};
+	std::vector<DeferredOp> m_deferredOps;
 };
@@ -17,25 +17,76 @@ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OU
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
 #include <map>
+#include <tuple>
 #include <ifcpp/model/BasicTypes.h>
 #include <ifcpp/model/StatusCallback.h>
 #include "ProfileConverter.h"
 #include "CurveConverter.h"
 #include "SplineConverter.h"
+#include "Sweeper.h"
 
 class ProfileCache : public StatusCallback
 {
+public:
+	struct CapTriangulationStatistics
+	{
+		size_t numTriangulated = 0;		// number of cap triangulations that have been computed
+		size_t numReused = 0;			// number of times a cached cap triangulation has been used instead
+		double secondsTriangulating = 0;
+
+		double estimatedSecondsSaved() const
+		{
+			if( numTriangulated == 0 )
+			{
+				return 0;
+			}
+			return secondsTriangulating / double(numTriangulated) * double(numReused);
+		}
+	};
+
 protected:
+	// cap triangulations depend on the profile and on the settings that influence its tessellation
+	struct CapTriangulationKey
+	{
+		int profileID;
+		bool simplifyPaths;
+		int numVerticesPerCircle;
+		double epsMergePoints;
+		double epsCoplanarAngle;
+
+		bool operator<(const CapTriangulationKey& other) const
+		{
+			return std::tie(profileID, simplifyPaths, numVerticesPerCircle, epsMergePoints, epsCoplanarAngle)
+				< std::tie(other.profileID, other.simplifyPaths, other.numVerticesPerCircle, other.epsMergePoints, other.epsCoplanarAngle);
+		}
+	};
+
+	template<typename T>
+	struct CapTriangulationEntry
+	{
+		std::once_flag m_computed;
+		shared_ptr<T> m_caps;
+	};
+
 	shared_ptr<CurveConverter>					m_curve_converter;
 	shared_ptr<SplineConverter>					m_spline_converter;
+	shared_ptr<Sweeper>							m_sweeper;
 	std::map<int,shared_ptr<ProfileConverter> >	m_profile_cache;
+	std::map<CapTriangulationKey, shared_ptr<CapTriangulationEntry<ExtrusionCapTriangulation> > >	m_extrusion_cap_cache;
+	std::map<CapTriangulationKey, shared_ptr<CapTriangulationEntry<SweepCapTriangulation> > >		m_sweep_cap_cache;
+	std::atomic<size_t> m_num_caps_triangulated{ 0 };
+	std::atomic<size_t> m_num_caps_reused{ 0 };
+	std::atomic<int64_t> m_nanoseconds_triangulating{ 0 };
 
 	std::mutex m_writelock_profile_cache;
+	std::mutex m_writelock_cap_cache;
 
 public:
-	ProfileCache( shared_ptr<CurveConverter>& cc, shared_ptr<SplineConverter>& sc )
-		: m_curve_converter( cc ), m_spline_converter( sc )
+	ProfileCache( shared_ptr<CurveConverter>& cc, shared_ptr<SplineConverter>& sc, shared_ptr<Sweeper>& sw )
+		: m_curve_converter( cc ), m_spline_converter( sc ), m_sweeper( sw )
 	{
 	}
 
@@ -46,8 +97,93 @@ public:
 	void clearProfileCache()
 	{
 		m_profile_cache.clear();
+
+		std::lock_guard<std::mutex> lock(m_writelock_cap_cache);
+		m_extrusion_cap_cache.clear();
+		m_sweep_cap_cache.clear();
+	}
+
+	CapTriangulationStatistics getCapTriangulationStatistics() const
+	{
+		CapTriangulationStatistics stats;
+		stats.numTriangulated = m_num_caps_triangulated;
+		stats.numReused = m_num_caps_reused;
+		stats.secondsTriangulating = double(m_nanoseconds_triangulating) * 1e-9;
+		return stats;
+	}
+
+	void resetCapTriangulationStatistics()
+	{
+		m_num_caps_triangulated = 0;
+		m_num_caps_reused = 0;
+		m_nanoseconds_triangulating = 0;
+	}
+
+	//\brief Returns the cap triangulation for extrusions of the given profile. It is computed once per profile and tessellation settings, and shared by all extrusions of that profile
+	shared_ptr<ExtrusionCapTriangulation> getExtrusionCapTriangulation( const shared_ptr<IfcProfileDef>& ifc_profile, const shared_ptr<ProfileConverter>& profile_converter )
+	{
+		const shared_ptr<GeometrySettings>& geom_settings = m_curve_converter->getGeomSettings();
+		const double epsMergePoints = geom_settings->getEpsilonMergePoints();
+		const double epsCoplanarAngle = geom_settings->getEpsilonCoplanarAngle();
+		return getCapTriangulation( m_extrusion_cap_cache, ifc_profile, profile_converter, [&](ExtrusionCapTriangulation& caps) {
+			Sweeper::triangulateExtrusionCaps( profile_converter->getCoordinates(), epsMergePoints, epsCoplanarAngle, caps );
+		});
+	}
+
+	//\brief Returns the cap triangulation for sweeps of the given profile along a directrix. It is computed once per profile and tessellation settings
+	shared_ptr<SweepCapTriangulation> getSweepCapTriangulation( const shared_ptr<IfcProfileDef>& ifc_profile, const shared_ptr<ProfileConverter>& profile_converter )
+	{
+		return getCapTriangulation( m_sweep_cap_cache, ifc_profile, profile_converter, [&](SweepCapTriangulation& caps) {
+			m_sweeper->triangulateSweepCaps( profile_converter->getCoordinates(), caps, ifc_profile.get() );
+		});
 	}
 
+protected:
+	template<typename T, typename TriangulateFunc>
+	shared_ptr<T> getCapTriangulation( std::map<CapTriangulationKey, shared_ptr<CapTriangulationEntry<T> > >& cache, const shared_ptr<IfcProfileDef>& ifc_profile,
+		const shared_ptr<ProfileConverter>& profile_converter, const TriangulateFunc& triangulate )
+	{
+		if( !ifc_profile || !profile_converter )
+		{
+			return shared_ptr<T>();
+		}
+
+		const shared_ptr<GeometrySettings>& geom_settings = m_curve_converter->getGeomSettings();
+		CapTriangulationKey key = { ifc_profile->m_tag, profile_converter->m_simplifyPathsByDefault, geom_settings->getNumVerticesPerCircle(),
+			geom_settings->getEpsilonMergePoints(), geom_settings->getEpsilonCoplanarAngle() };
+
+		shared_ptr<CapTriangulationEntry<T> > entry;
+		{
+			std::lock_guard<std::mutex> lock(m_writelock_cap_cache);
+			shared_ptr<CapTriangulationEntry<T> >& existing_entry = cache[key];
+			if( !existing_entry )
+			{
+				existing_entry = make_shared<CapTriangulationEntry<T> >();
+			}
+			entry = existing_entry;
+		}
+
+		// triangulate outside of the cache lock, so that different profiles are triangulated in parallel. Other threads requesting the same profile wait here
+		bool computed_here = false;
+		std::call_once( entry->m_computed, [&]() {
+			std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+			shared_ptr<T> caps = make_shared<T>();
+			triangulate( *caps );
+			entry->m_caps = caps;
+			m_nanoseconds_triangulating += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+			++m_num_caps_triangulated;
+			computed_here = true;
+		});
+
+		if( !computed_here )
+		{
+			++m_num_caps_reused;
+		}
+		return entry->m_caps;
+	}
+
+public:
+
 	shared_ptr<ProfileConverter> getProfileConverter( const shared_ptr<IfcProfileDef>& ifc_profile, bool simplifyPaths)
 	{
 		if( !ifc_profile )
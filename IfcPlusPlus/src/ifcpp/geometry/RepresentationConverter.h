@@ -105,7 +105,8 @@ public:
 		m_sweeper = shared_ptr<Sweeper>( new Sweeper( m_geom_settings, m_unit_converter ) );
 		m_placement_converter = shared_ptr<PlacementConverter>( new PlacementConverter( m_unit_converter ) );
 		m_curve_converter = shared_ptr<CurveConverter>( new CurveConverter( m_geom_settings, m_placement_converter, m_point_converter, m_spline_converter ) );
-		m_profile_cache = shared_ptr<ProfileCache>( new ProfileCache( m_curve_converter, m_spline_converter ) );
+		m_placement_converter->getGridConverter()->setCurveConverter( m_curve_converter );
+		m_profile_cache = shared_ptr<ProfileCache>( new ProfileCache( m_curve_converter, m_spline_converter, m_sweeper ) );
 		m_face_converter = shared_ptr<FaceConverter>( new FaceConverter( m_geom_settings, m_unit_converter, m_curve_converter, m_spline_converter, m_sweeper, m_profile_cache ) );
 		m_solid_converter = shared_ptr<SolidModelConverter>( new SolidModelConverter( m_geom_settings, m_point_converter, m_curve_converter, m_face_converter, m_profile_cache, m_sweeper, m_styles_converter ) );
 		
@@ -129,6 +130,9 @@ public:
 	void clearCache()
 	{
 		m_profile_cache->clearProfileCache();
+		m_curve_converter->clearCurveCache();
+		m_placement_converter->getAlignmentConverter()->clearAlignmentCache();
+		m_placement_converter->getGridConverter()->clearGridCache();
 		m_styles_converter->clearStylesCache();
 	}
 	shared_ptr<GeometrySettings>&		getGeomSettings()	{ return m_geom_settings; }
@@ -148,7 +152,7 @@ public:
 		m_unit_converter = unit_converter;
 		m_point_converter->setUnitConverter( unit_converter );
 		m_sweeper->m_unit_converter = unit_converter;
-		m_placement_converter->m_unit_converter = unit_converter;
+		m_placement_converter->setUnitConverter( unit_converter );
 		m_face_converter->m_unit_converter = unit_converter;
 	}
 
@@ -201,7 +205,7 @@ public:
 		bool cacheIfcItems)
 	{
 		representationData->m_ifc_representation = ifcRepresentation;
-		printToDebugLog(__FUNC__, "");
+		CARVE_TRACE_SCOPE(__FUNC__, ifcRepresentation->m_tag);
 
 		for( const shared_ptr<IfcRepresentationItem>& representationItem : ifcRepresentation->m_Items )
 		{
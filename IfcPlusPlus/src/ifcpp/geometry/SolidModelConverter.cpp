@@ -15,6 +15,7 @@ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTH
 LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 */
 
+#include <numeric>
 #include <ifcpp/geometry/GeometrySettings.h>
 #include <ifcpp/model/BasicTypes.h>
 #include <ifcpp/model/StatusCallback.h>
@@ -38,6 +39,7 @@ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OU
 #include <IfcIndexedColourMap.h>
 #include <IfcIndexedPolygonalFaceWithVoids.h>
 #include <IfcManifoldSolidBrep.h>
+#include <IfcPlane.h>
 #include <IfcPolygonalBoundedHalfSpace.h>
 #include <IfcPolygonalFaceSet.h>
 #include <IfcRectangularPyramid.h>
@@ -136,22 +138,24 @@ void SolidModelConverter::convertIfcSolidModel( const shared_ptr<IfcSolidModel>&
 				//EndParam	 : OPTIONAL IfcParameterValue;
 				//FixedReference	 : IfcDirection;
 
-				shared_ptr<IfcCurve>& ifc_directrix_curve = fixed_reference_swept_area_solid->m_Directrix;
-				//shared_ptr<IfcParameterValue>& ifc_start_param = fixed_reference_swept_area_solid->m_StartParam;				//optional
-				//shared_ptr<IfcParameterValue>& ifc_end_param = fixed_reference_swept_area_solid->m_EndParam;					//optional
-				//shared_ptr<IfcDirection>& ifc_fixed_reference = fixed_reference_swept_area_solid->m_FixedReference;				// TODO: apply fixed reference
-				messageCallback("IfcFixedReferenceSweptAreaSolid: Fixed reference not implemented", StatusCallback::MESSAGE_TYPE_WARNING, __FUNC__, fixed_reference_swept_area_solid.get());
-
-				std::vector<CurveConverter::CurveSegment> segments;
-				m_curve_converter->convertIfcCurve(ifc_directrix_curve, segments, true);
+				// the local x axis of the profile is the projection of FixedReference onto the plane normal to the directrix
 				std::vector<vec3> basis_curve_points;
-				for (auto& seg : segments)
+				m_curve_converter->convertIfcDirectrix(fixed_reference_swept_area_solid->m_Directrix, fixed_reference_swept_area_solid->m_StartParam, fixed_reference_swept_area_solid->m_EndParam, basis_curve_points);
+
+				std::vector<vec3> section_references;
+				const shared_ptr<IfcDirection>& ifc_fixed_reference = fixed_reference_swept_area_solid->m_FixedReference;
+				if (ifc_fixed_reference && ifc_fixed_reference->m_DirectionRatios.size() > 1)
 				{
-					std::copy(seg.m_points.begin(), seg.m_points.end(), std::back_inserter(basis_curve_points));
+					const std::vector<shared_ptr<IfcReal> >& ratios = ifc_fixed_reference->m_DirectionRatios;
+					section_references.push_back(carve::geom::VECTOR(ratios[0]->m_value, ratios[1]->m_value, ratios.size() > 2 ? ratios[2]->m_value : 0.0));
 				}
 
 				GeomProcessingParams params(m_geom_settings, fixed_reference_swept_area_solid.get(), this);
-				m_sweeper->sweepArea(basis_curve_points, profile_paths, item_data_solid, params);
+				shared_ptr<SweepCapTriangulation> caps = m_profile_cache->getSweepCapTriangulation(swept_area, profile_converter);
+				if (caps)
+				{
+					m_sweeper->sweepArea(basis_curve_points, *caps, item_data_solid, params, section_references);
+				}
 				item_data->addItemData(item_data_solid);
 				item_data->applyTransformToItem(swept_area_pos->m_matrix, eps, false);
 
@@ -170,38 +174,31 @@ void SolidModelConverter::convertIfcSolidModel( const shared_ptr<IfcSolidModel>&
 			shared_ptr<IfcSurfaceCurveSweptAreaSolid> surface_curve_swept_area_solid = dynamic_pointer_cast<IfcSurfaceCurveSweptAreaSolid>(swept_area_solid);
 			if (surface_curve_swept_area_solid)
 			{
-				shared_ptr<IfcCurve>& ifc_directrix_curve = surface_curve_swept_area_solid->m_Directrix;
-				//shared_ptr<IfcParameterValue>& ifc_start_param = surface_curve_swept_area_solid->m_StartParam;				//optional
-				//shared_ptr<IfcParameterValue>& ifc_end_param = surface_curve_swept_area_solid->m_EndParam;					//optional
-				shared_ptr<IfcSurface>& ifc_reference_surface = surface_curve_swept_area_solid->m_ReferenceSurface;			// TODO: apply start_param, end_param
-				messageCallback("IfcSurfaceCurveSweptAreaSolid: StartParam and EndParam not implemented", StatusCallback::MESSAGE_TYPE_WARNING, __FUNC__, surface_curve_swept_area_solid.get());
-
-				std::vector<CurveConverter::CurveSegment> segments;
-				m_curve_converter->convertIfcCurve(ifc_directrix_curve, segments, true);
 				std::vector<vec3> directrix_curve_points;
-				for (auto& seg : segments)
-				{
-					std::copy(seg.m_points.begin(), seg.m_points.end(), std::back_inserter(directrix_curve_points));
-				}
-
-				// apply reference curve
-				//shared_ptr<carve::input::PolylineSetData> reference_surface_data( new carve::input::PolylineSetData() );
-				shared_ptr<SurfaceProxy> surface_proxy;
-				m_face_converter->convertIfcSurface(ifc_reference_surface, item_data_solid, surface_proxy);
+				m_curve_converter->convertIfcDirectrix(surface_curve_swept_area_solid->m_Directrix, surface_curve_swept_area_solid->m_StartParam, surface_curve_swept_area_solid->m_EndParam, directrix_curve_points);
 
-				if (surface_proxy)
+				// the local x axis of the profile is the normal of the reference surface at the directrix
+				std::vector<vec3> section_references;
+				shared_ptr<AnalyticSurface> reference_surface = m_face_converter->createAnalyticSurface(surface_curve_swept_area_solid->m_ReferenceSurface);
+				if (reference_surface)
 				{
+					section_references.resize(directrix_curve_points.size(), carve::geom::VECTOR(0.0, 0.0, 0.0));
 					for (size_t ii = 0; ii < directrix_curve_points.size(); ++ii)
 					{
-						//vec3& point_3d = directrix_curve_points[ii];
-						//vec2 point_2d( carve::geom::VECTOR( point_3d.x, point_3d.y ) );
-						//surface_proxy->computePointOnSurface( point_3d, point_3d );
-						// TODO: implement
+						reference_surface->computeNormal(directrix_curve_points[ii], section_references[ii]);
 					}
 				}
+				else
+				{
+					messageCallback("IfcSurfaceCurveSweptAreaSolid: ReferenceSurface type not supported, using rotation minimizing frames", StatusCallback::MESSAGE_TYPE_WARNING, __FUNC__, surface_curve_swept_area_solid.get());
+				}
 
 				GeomProcessingParams params(m_geom_settings, surface_curve_swept_area_solid.get(), this);
-				m_sweeper->sweepArea(directrix_curve_points, profile_paths, item_data_solid, params);
+				shared_ptr<SweepCapTriangulation> caps = m_profile_cache->getSweepCapTriangulation(swept_area, profile_converter);
+				if (caps)
+				{
+					m_sweeper->sweepArea(directrix_curve_points, *caps, item_data_solid, params, section_references);
+				}
 				item_data->addItemData(item_data_solid);
 				item_data->applyTransformToItem(swept_area_pos->m_matrix, eps, false);
 
@@ -243,13 +240,19 @@ void SolidModelConverter::convertIfcSolidModel( const shared_ptr<IfcSolidModel>&
 			shared_ptr<IfcAdvancedBrepWithVoids> brep_with_voids = dynamic_pointer_cast<IfcAdvancedBrepWithVoids>( solid_model );
 			if( brep_with_voids )
 			{
-					
-				//std::vector<shared_ptr<IfcClosedShell> >& vec_voids = advanced_brep_with_voids->m_Voids;
-
-				// TODO: subtract voids from outer shell
-#ifdef _DEBUG
-				std::cout << "IfcAdvancedBrep not implemented" << std::endl;
-#endif
+				// subtract voids from outer shell
+				shared_ptr<ItemShapeData> voids_data( new ItemShapeData() );
+				for( const shared_ptr<IfcClosedShell>& void_shell : brep_with_voids->m_Voids )
+				{
+					if( void_shell )
+					{
+						m_face_converter->convertIfcFaceList( void_shell->m_CfsFaces, voids_data, FaceConverter::CLOSED_SHELL );
+					}
+				}
+				if( voids_data->m_meshsets.size() > 0 )
+				{
+					computeCSGForAllMeshsets( item_data, voids_data->m_meshsets, carve::csg::CSG::A_MINUS_B, brep_with_voids.get() );
+				}
 			}
 			return;
 		}
@@ -319,15 +322,8 @@ void SolidModelConverter::convertIfcSolidModel( const shared_ptr<IfcSolidModel>&
 			radius_inner = swept_disp_solid->m_InnerRadius->m_value*length_in_meter;
 		}
 
-		// TODO: handle start param, end param
-
-		std::vector<CurveConverter::CurveSegment> segments;
-		m_curve_converter->convertIfcCurve( directrix_curve, segments, true );
 		std::vector<vec3> basis_curve_points;
-		for (auto& seg : segments)
-		{
-			std::copy(seg.m_points.begin(), seg.m_points.end(), std::back_inserter(basis_curve_points));
-		}
+		m_curve_converter->convertIfcDirectrix( directrix_curve, swept_disp_solid->m_StartParam, swept_disp_solid->m_EndParam, basis_curve_points );
 		GeomUtils::removeDuplicates(basis_curve_points, eps);
 
 		shared_ptr<ItemShapeData> item_data_solid( new ItemShapeData() );
@@ -402,7 +398,11 @@ void SolidModelConverter::convertIfcExtrudedAreaSolid( const shared_ptr<IfcExtru
 			return;
 		}
 		GeomProcessingParams params(m_geom_settings, extruded_area.get(), this);
-		m_sweeper->extrude(paths, extrusion_vector, item_data, params);
+		shared_ptr<ExtrusionCapTriangulation> caps = m_profile_cache->getExtrusionCapTriangulation(swept_area, profile_converter);
+		if (caps)
+		{
+			m_sweeper->extrude(*caps, extrusion_vector, item_data, params);
+		}
 	}
 }
 
@@ -835,14 +835,84 @@ void SolidModelConverter::convertIfcBooleanResult( const shared_ptr<IfcBooleanRe
 		return;
 	}
 
-	// convert the first operand
-	shared_ptr<ItemShapeData> first_operand_data( new ItemShapeData() );
-	shared_ptr<ItemShapeData> empty_operand;
-	convertIfcBooleanOperand( ifc_first_operand, first_operand_data, empty_operand );
+	if( m_geom_settings->m_clipHalfSpacesByPlanes )
+	{
+		// nested IfcBooleanClippingResult, for example a wall that is cut by several roof planes. Collect all differences with a half-space
+		std::vector<shared_ptr<IfcBooleanResult> > clipping_chain;
+		shared_ptr<IfcBooleanResult> current_result = bool_result;
+		while( current_result )
+		{
+			if( !current_result->m_Operator || current_result->m_Operator->m_enum != IfcBooleanOperator::ENUM_DIFFERENCE || !current_result->m_FirstOperand )
+			{
+				break;
+			}
+			shared_ptr<IfcHalfSpaceSolid> half_space = dynamic_pointer_cast<IfcHalfSpaceSolid>( current_result->m_SecondOperand );
+			if( !half_space || dynamic_pointer_cast<IfcBoxedHalfSpace>( half_space ) )
+			{
+				break;
+			}
+			clipping_chain.push_back( current_result );
+			current_result = dynamic_pointer_cast<IfcBooleanResult>( current_result->m_FirstOperand );
+		}
+
+		if( clipping_chain.size() > 0 )
+		{
+			convertHalfSpaceClippingChain( clipping_chain, item_data );
+			return;
+		}
+	}
+
+	if( csg_operation == carve::csg::CSG::A_MINUS_B )
+	{
+		// element with many cut-outs, given as nested differences ((A - B1) - B2) - ... - Bn
+		std::vector<shared_ptr<IfcBooleanResult> > difference_chain;
+		shared_ptr<IfcBooleanResult> current_result = bool_result;
+		while( current_result )
+		{
+			if( !current_result->m_Operator || current_result->m_Operator->m_enum != IfcBooleanOperator::ENUM_DIFFERENCE || !current_result->m_FirstOperand || !current_result->m_SecondOperand )
+			{
+				break;
+			}
+			if( dynamic_pointer_cast<IfcHalfSpaceSolid>( current_result->m_SecondOperand ) )
+			{
+				// a half-space ends the chain. The rest is converted as first operand, so that half-spaces are clipped by planes (see convertHalfSpaceClippingChain)
+				break;
+			}
+			difference_chain.push_back( current_result );
+			current_result = dynamic_pointer_cast<IfcBooleanResult>( current_result->m_FirstOperand );
+		}
+
+		if( difference_chain.size() > 1 )
+		{
+			convertDifferenceChain( difference_chain, item_data );
+			return;
+		}
+	}
 
-	// convert the second operand
+	// convert the first and the second operand. A half-space depends on the size of the first operand, other operands are converted in parallel
+	shared_ptr<ItemShapeData> first_operand_data( new ItemShapeData() );
 	shared_ptr<ItemShapeData> second_operand_data( new ItemShapeData() );
-	convertIfcBooleanOperand( ifc_second_operand, second_operand_data, first_operand_data );
+	shared_ptr<ItemShapeData> empty_operand;
+	if( dynamic_pointer_cast<IfcHalfSpaceSolid>( ifc_second_operand ) )
+	{
+		convertIfcBooleanOperand( ifc_first_operand, first_operand_data, empty_operand );
+		convertIfcBooleanOperand( ifc_second_operand, second_operand_data, first_operand_data );
+	}
+	else
+	{
+		std::vector<int> operand_index = { 0, 1 };
+		FOR_EACH_LOOP operand_index.begin(), operand_index.end(), [&]( int index )
+		{
+			if( index == 0 )
+			{
+				convertIfcBooleanOperand( ifc_first_operand, first_operand_data, empty_operand );
+			}
+			else
+			{
+				convertIfcBooleanOperand( ifc_second_operand, second_operand_data, empty_operand );
+			}
+		} );
+	}
 
 	//vec4 color(0.5, 0.5, 0.5, 1.);
 	//GeomDebugDump::dumpItemShapeInputData(first_operand_data, color);
@@ -867,21 +937,7 @@ void SolidModelConverter::convertIfcBooleanResult( const shared_ptr<IfcBooleanRe
 #endif
 
 	// for every first operand polyhedrons, apply all second operand polyhedrons
-	std::vector<shared_ptr<carve::mesh::MeshSet<3> > >& vec_first_operand_meshsets = first_operand_data->m_meshsets;
-	for( size_t i_meshset_first = 0; i_meshset_first < vec_first_operand_meshsets.size(); ++i_meshset_first )
-	{
-		shared_ptr<carve::mesh::MeshSet<3> >& first_operand_meshset = vec_first_operand_meshsets[i_meshset_first];
-
-		if (!first_operand_meshset)
-		{
-			continue;
-		}
-		std::vector<shared_ptr<carve::mesh::MeshSet<3> > >& vec_second_operand_meshsets = second_operand_data->m_meshsets;
-		GeomProcessingParams params(m_geom_settings);
-		params.callbackFunc = this;
-		params.ifc_entity = bool_result.get();
-		CSG_Adapter::computeCSG(first_operand_meshset, vec_second_operand_meshsets, csg_operation, params);
-	}
+	computeCSGForAllMeshsets( first_operand_data, second_operand_data->m_meshsets, csg_operation, bool_result.get() );
 
 	// now copy processed first operands to result input data
 	std::copy( first_operand_data->m_meshsets.begin(), first_operand_data->m_meshsets.end(), std::back_inserter( item_data->m_meshsets ) );
@@ -902,6 +958,287 @@ void SolidModelConverter::convertIfcBooleanResult( const shared_ptr<IfcBooleanRe
 	}
 }
 
+void SolidModelConverter::convertHalfSpaceClippingChain( const std::vector<shared_ptr<IfcBooleanResult> >& clipping_chain, shared_ptr<ItemShapeData> item_data )
+{
+	// the first operand of the innermost result is converted only once
+	shared_ptr<ItemShapeData> operand_data( new ItemShapeData() );
+	shared_ptr<ItemShapeData> empty_operand;
+	convertIfcBooleanOperand( clipping_chain.back()->m_FirstOperand, operand_data, empty_operand );
+
+	// styles of the nested results, as convertIfcBooleanOperand would add them
+	if( m_geom_settings->handleStyledItems() )
+	{
+		for( size_t ii = 1; ii < clipping_chain.size(); ++ii )
+		{
+			std::vector<shared_ptr<StyleData> > vec_style_data;
+			m_styles_converter->convertRepresentationStyle( clipping_chain[ii], vec_style_data );
+			for( auto& style : vec_style_data )
+			{
+				operand_data->addStyle( style );
+			}
+		}
+	}
+
+	std::vector<MeshPlaneClipper::ClippingPlane> clipping_planes;
+	for( auto it = clipping_chain.rbegin(); it != clipping_chain.rend(); ++it )
+	{
+		MeshPlaneClipper::ClippingPlane clipping_plane;
+		if( !getHalfSpaceClippingPlane( dynamic_pointer_cast<IfcHalfSpaceSolid>( (*it)->m_SecondOperand ), clipping_plane ) )
+		{
+			clipping_planes.clear();
+			break;
+		}
+		clipping_planes.push_back( clipping_plane );
+	}
+
+	bool clipped_by_planes = false;
+	if( clipping_planes.size() == clipping_chain.size() )
+	{
+		double eps = m_geom_settings->getEpsilonMergePoints();
+		std::vector<shared_ptr<carve::mesh::MeshSet<3> > > vec_clipped_meshsets;
+		clipped_by_planes = true;
+		for( const shared_ptr<carve::mesh::MeshSet<3> >& meshset : operand_data->m_meshsets )
+		{
+			if( !meshset )
+			{
+				continue;
+			}
+			shared_ptr<carve::mesh::MeshSet<3> > clipped_meshset;
+			if( !MeshPlaneClipper::clipMeshSet( meshset, clipping_planes, clipped_meshset, eps ) )
+			{
+				clipped_by_planes = false;
+				break;
+			}
+			vec_clipped_meshsets.push_back( clipped_meshset );
+		}
+
+		if( clipped_by_planes )
+		{
+			operand_data->m_meshsets = vec_clipped_meshsets;
+		}
+	}
+
+	if( !clipped_by_planes )
+	{
+		// degenerate case: subtract the half-spaces one after the other, starting with the innermost result
+		for( auto it = clipping_chain.rbegin(); it != clipping_chain.rend(); ++it )
+		{
+			const shared_ptr<IfcBooleanResult>& bool_result = *it;
+			shared_ptr<ItemShapeData> second_operand_data( new ItemShapeData() );
+			convertIfcBooleanOperand( bool_result->m_SecondOperand, second_operand_data, operand_data );
+			computeCSGForAllMeshsets( operand_data, second_operand_data->m_meshsets, carve::csg::CSG::A_MINUS_B, bool_result.get() );
+		}
+	}
+
+	std::copy( operand_data->m_meshsets.begin(), operand_data->m_meshsets.end(), std::back_inserter( item_data->m_meshsets ) );
+	std::copy( operand_data->m_styles.begin(), operand_data->m_styles.end(), std::back_inserter( item_data->m_styles ) );
+}
+
+void SolidModelConverter::convertDifferenceChain( const std::vector<shared_ptr<IfcBooleanResult> >& difference_chain, shared_ptr<ItemShapeData> item_data )
+{
+	// The tools are stored in the order of subtraction, so the innermost result comes first
+	const size_t num_tools = difference_chain.size();
+	std::vector<shared_ptr<IfcBooleanResult> > vec_results( difference_chain.rbegin(), difference_chain.rend() );
+	std::vector<shared_ptr<ItemShapeData> > vec_tool_data( num_tools );
+	const bool union_tools = m_geom_settings->m_unionSubtractionOperands;
+
+	// Convert the first operand of the innermost result and all tools in parallel. The chain ends before half-spaces, so no tool depends on the size of another operand
+	shared_ptr<ItemShapeData> operand_data( new ItemShapeData() );
+	shared_ptr<ItemShapeData> empty_operand;
+	std::vector<size_t> vec_tasks = { num_tools };
+	for( size_t ii = 0; ii < num_tools; ++ii )
+	{
+		vec_tasks.push_back( ii );
+	}
+
+	FOR_EACH_LOOP vec_tasks.begin(), vec_tasks.end(), [&]( size_t task )
+	{
+		if( task == num_tools )
+		{
+			convertIfcBooleanOperand( vec_results[0]->m_FirstOperand, operand_data, empty_operand );
+			return;
+		}
+		shared_ptr<ItemShapeData> tool_data( new ItemShapeData() );
+		convertIfcBooleanOperand( vec_results[task]->m_SecondOperand, tool_data, empty_operand );
+		vec_tool_data[task] = tool_data;
+	} );
+
+	// styles of the nested results, as convertIfcBooleanOperand would add them
+	if( m_geom_settings->handleStyledItems() )
+	{
+		for( size_t ii = 1; ii < difference_chain.size(); ++ii )
+		{
+			std::vector<shared_ptr<StyleData> > vec_style_data;
+			m_styles_converter->convertRepresentationStyle( difference_chain[ii], vec_style_data );
+			for( auto& style : vec_style_data )
+			{
+				operand_data->addStyle( style );
+			}
+		}
+	}
+
+	if( !union_tools )
+	{
+		// subtract one after the other, in the same order as nested results would be computed
+		for( size_t ii = 0; ii < num_tools; ++ii )
+		{
+			computeCSGForAllMeshsets( operand_data, vec_tool_data[ii]->m_meshsets, carve::csg::CSG::A_MINUS_B, vec_results[ii].get() );
+		}
+	}
+	else
+	{
+		// A - B1 - B2 - ... - Bn = A - (B1 + B2 + ... + Bn). The union is computed as balanced tree, each level in parallel
+		std::vector<shared_ptr<carve::mesh::MeshSet<3> > > vec_tool_meshsets;
+		for( const shared_ptr<ItemShapeData>& tool_data : vec_tool_data )
+		{
+			for( const shared_ptr<carve::mesh::MeshSet<3> >& meshset : tool_data->m_meshsets )
+			{
+				if( meshset )
+				{
+					vec_tool_meshsets.push_back( meshset );
+				}
+			}
+		}
+
+		BuildingEntity* ifc_entity = difference_chain[0].get();
+		while( vec_tool_meshsets.size() > 1 )
+		{
+			const size_t num_pairs = vec_tool_meshsets.size() / 2;
+			std::vector<std::vector<shared_ptr<carve::mesh::MeshSet<3> > > > vec_pair_results( num_pairs );
+			std::vector<size_t> vec_pairs( num_pairs );
+			std::iota( vec_pairs.begin(), vec_pairs.end(), 0 );
+			FOR_EACH_LOOP vec_pairs.begin(), vec_pairs.end(), [&]( size_t pair_index )
+			{
+				shared_ptr<carve::mesh::MeshSet<3> > meshset_a = vec_tool_meshsets[pair_index * 2];
+				const shared_ptr<carve::mesh::MeshSet<3> >& meshset_b = vec_tool_meshsets[pair_index * 2 + 1];
+				GeomProcessingParams params( m_geom_settings );
+				params.callbackFunc = this;
+				params.ifc_entity = ifc_entity;
+				if( !CSG_Adapter::computeCSG( meshset_a, { meshset_b }, carve::csg::CSG::UNION, params ) )
+				{
+					// union failed, keep both tools and subtract them separately
+					vec_pair_results[pair_index] = { meshset_a, meshset_b };
+					return;
+				}
+				vec_pair_results[pair_index] = { meshset_a };
+			} );
+
+			std::vector<shared_ptr<carve::mesh::MeshSet<3> > > vec_next_level;
+			for( const std::vector<shared_ptr<carve::mesh::MeshSet<3> > >& pair_result : vec_pair_results )
+			{
+				std::copy( pair_result.begin(), pair_result.end(), std::back_inserter( vec_next_level ) );
+			}
+			if( vec_tool_meshsets.size() % 2 == 1 )
+			{
+				vec_next_level.push_back( vec_tool_meshsets.back() );
+			}
+			if( vec_next_level.size() == vec_tool_meshsets.size() )
+			{
+				// no union succeeded on this level
+				break;
+			}
+			vec_tool_meshsets.swap( vec_next_level );
+		}
+
+		computeCSGForAllMeshsets( operand_data, vec_tool_meshsets, carve::csg::CSG::A_MINUS_B, ifc_entity );
+	}
+
+	std::copy( operand_data->m_meshsets.begin(), operand_data->m_meshsets.end(), std::back_inserter( item_data->m_meshsets ) );
+	std::copy( operand_data->m_styles.begin(), operand_data->m_styles.end(), std::back_inserter( item_data->m_styles ) );
+}
+
+void SolidModelConverter::computeCSGForAllMeshsets( shared_ptr<ItemShapeData>& first_operand_data, const std::vector<shared_ptr<carve::mesh::MeshSet<3> > >& vec_second_operand_meshsets,
+	carve::csg::CSG::OP csg_operation, BuildingEntity* ifc_entity )
+{
+	std::vector<shared_ptr<carve::mesh::MeshSet<3> > >& vec_first_operand_meshsets = first_operand_data->m_meshsets;
+	if( vec_first_operand_meshsets.size() < 2 )
+	{
+		for( shared_ptr<carve::mesh::MeshSet<3> >& first_operand_meshset : vec_first_operand_meshsets )
+		{
+			if( !first_operand_meshset )
+			{
+				continue;
+			}
+			GeomProcessingParams params( m_geom_settings );
+			params.callbackFunc = this;
+			params.ifc_entity = ifc_entity;
+			CSG_Adapter::computeCSG( first_operand_meshset, vec_second_operand_meshsets, csg_operation, params );
+		}
+		return;
+	}
+
+	// The first operand meshsets are independent of each other. The second operands are copied for each task, since checking a mesh caches some values in it
+	FOR_EACH_LOOP vec_first_operand_meshsets.begin(), vec_first_operand_meshsets.end(), [&]( shared_ptr<carve::mesh::MeshSet<3> >& first_operand_meshset )
+	{
+		if( !first_operand_meshset )
+		{
+			return;
+		}
+		std::vector<shared_ptr<carve::mesh::MeshSet<3> > > vec_second_operand_copies;
+		for( const shared_ptr<carve::mesh::MeshSet<3> >& meshset : vec_second_operand_meshsets )
+		{
+			if( meshset )
+			{
+				vec_second_operand_copies.push_back( shared_ptr<carve::mesh::MeshSet<3> >( meshset->clone() ) );
+			}
+		}
+		GeomProcessingParams params( m_geom_settings );
+		params.callbackFunc = this;
+		params.ifc_entity = ifc_entity;
+		CSG_Adapter::computeCSG( first_operand_meshset, vec_second_operand_copies, csg_operation, params );
+	} );
+}
+
+bool SolidModelConverter::getHalfSpaceClippingPlane( const shared_ptr<IfcHalfSpaceSolid>& half_space_solid, MeshPlaneClipper::ClippingPlane& clipping_plane )
+{
+	if( !half_space_solid || !half_space_solid->m_AgreementFlag )
+	{
+		return false;
+	}
+
+	// only planes. Other elementary surfaces are approximated by CSG
+	shared_ptr<IfcPlane> base_plane = dynamic_pointer_cast<IfcPlane>( half_space_solid->m_BaseSurface );
+	if( !base_plane || !base_plane->m_Position )
+	{
+		return false;
+	}
+	vec3 base_surface_position;
+	m_curve_converter->getPlacementConverter()->getPlane( base_plane->m_Position, clipping_plane.m_plane, base_surface_position );
+
+	// If the agreement flag is TRUE, the half-space is on the side that the normal points away from, so the difference keeps the side of the normal
+	if( !half_space_solid->m_AgreementFlag->m_value )
+	{
+		clipping_plane.m_plane.negate();
+	}
+
+	shared_ptr<IfcPolygonalBoundedHalfSpace> polygonal_half_space = dynamic_pointer_cast<IfcPolygonalBoundedHalfSpace>( half_space_solid );
+	if( polygonal_half_space )
+	{
+		carve::math::Matrix boundary_position_matrix( carve::math::Matrix::IDENT() );
+		if( polygonal_half_space->m_Position )
+		{
+			shared_ptr<TransformData> boundary_transform;
+			m_curve_converter->getPlacementConverter()->convertIfcAxis2Placement3D( polygonal_half_space->m_Position, boundary_transform );
+			if( boundary_transform )
+			{
+				boundary_position_matrix = boundary_transform->m_matrix;
+			}
+		}
+		clipping_plane.m_boundary_origin = carve::geom::VECTOR( boundary_position_matrix._41, boundary_position_matrix._42, boundary_position_matrix._43 );
+		clipping_plane.m_boundary_x = carve::geom::VECTOR( boundary_position_matrix._11, boundary_position_matrix._12, boundary_position_matrix._13 ).normalized();
+		clipping_plane.m_boundary_y = carve::geom::VECTOR( boundary_position_matrix._21, boundary_position_matrix._22, boundary_position_matrix._23 ).normalized();
+
+		std::vector<vec2> segment_start_points_2d;
+		m_curve_converter->convertIfcCurve2D( polygonal_half_space->m_PolygonalBoundary, clipping_plane.m_boundary, segment_start_points_2d, true );
+		GeomUtils::unClosePolygon( clipping_plane.m_boundary, m_geom_settings->getEpsilonMergePoints() );
+		if( clipping_plane.m_boundary.size() < 3 )
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
 void SolidModelConverter::convertIfcCsgPrimitive3D( const shared_ptr<IfcCsgPrimitive3D>& csg_primitive, shared_ptr<ItemShapeData> item_data )
 {
 	shared_ptr<carve::input::PolyhedronData> polyhedron_data( new carve::input::PolyhedronData() );
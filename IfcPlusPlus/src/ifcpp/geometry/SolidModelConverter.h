@@ -26,6 +26,7 @@ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OU
 #include <IfcIndexedPolygonalFace.h>
 #include <IfcRevolvedAreaSolid.h>
 #include "IncludeCarveHeaders.h"
+#include "MeshPlaneClipper.h"
 class FaceConverter;
 class PointConverter;
 class CurveConverter;
@@ -62,6 +63,20 @@ public:
 
 	void convertIfcBooleanResult(const shared_ptr<IfcBooleanResult>& bool_result, shared_ptr<ItemShapeData> item_data);
 
+	///@brief Converts nested IfcBooleanResult objects that all subtract a half-space from the first operand, given from the outermost to the innermost.
+	///@details The half-spaces are applied in one pass with MeshPlaneClipper. If that is not possible, they are subtracted one after the other with CSG.
+	void convertHalfSpaceClippingChain(const std::vector<shared_ptr<IfcBooleanResult> >& clipping_chain, shared_ptr<ItemShapeData> item_data);
+
+	///@brief Converts nested differences ((A - B1) - B2) - ... - Bn, given from the outermost to the innermost result. None of the tools is a half-space.
+	///@details A and the tools B1..Bn are converted in parallel, then subtracted in the original order, or as one union of all tools if GeometrySettings::m_unionSubtractionOperands is set
+	void convertDifferenceChain(const std::vector<shared_ptr<IfcBooleanResult> >& difference_chain, shared_ptr<ItemShapeData> item_data);
+
+	///@brief Applies the CSG operation with all second operand meshsets to each first operand meshset. Several first operand meshsets are processed in parallel
+	void computeCSGForAllMeshsets(shared_ptr<ItemShapeData>& first_operand_data, const std::vector<shared_ptr<carve::mesh::MeshSet<3> > >& vec_second_operand_meshsets, carve::csg::CSG::OP csg_operation, BuildingEntity* ifc_entity);
+
+	///@brief Plane of an unbounded IfcHalfSpaceSolid or IfcPolygonalBoundedHalfSpace, oriented so that the part of the other operand that remains after the difference is on the positive side
+	bool getHalfSpaceClippingPlane(const shared_ptr<IfcHalfSpaceSolid>& half_space_solid, MeshPlaneClipper::ClippingPlane& clipping_plane);
+
 	void convertIfcCsgPrimitive3D(const shared_ptr<IfcCsgPrimitive3D>& csg_primitive, shared_ptr<ItemShapeData> item_data);
 
 	void extrudeBox(const std::vector<vec3>& boundary_points, const vec3& extrusion_vector, shared_ptr<carve::input::PolyhedronData>& box_data);
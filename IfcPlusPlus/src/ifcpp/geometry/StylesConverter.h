@@ -17,7 +17,9 @@ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OU
 
 #pragma once
 
+#include <algorithm>
 #include <map>
+#include <unordered_map>
 
 #include <ifcpp/model/BasicTypes.h>
 #include <ifcpp/model/StatusCallback.h>
@@ -77,6 +79,13 @@ protected:
 	std::mutex m_writelock_styles_converter;
 	std::mutex m_mutexSearch;
 
+	// style table, filled once by resolveStyles and not modified during geometry conversion
+	bool m_style_table_resolved = false;
+	std::unordered_map<int, shared_ptr<StyleData> > m_style_table;								// IfcPresentationStyle tag -> entry of m_style_palette
+	std::unordered_map<int, std::vector<shared_ptr<StyleData> > > m_styled_item_table;			// IfcStyledItem tag -> styles
+	std::unordered_map<int, std::vector<shared_ptr<StyleData> > > m_material_style_table;		// IfcMaterial tag -> styles
+	std::vector<shared_ptr<StyleData> > m_style_palette;										// distinct styles
+
 public:
 	StylesConverter()
 	{
@@ -88,6 +97,112 @@ public:
 	void clearStylesCache()
 	{
 		m_map_ifc_styles.clear();
+		m_style_table_resolved = false;
+		m_style_table.clear();
+		m_styled_item_table.clear();
+		m_material_style_table.clear();
+		m_style_palette.clear();
+	}
+
+	const std::vector<shared_ptr<StyleData> >& getStylePalette() { return m_style_palette; }
+
+	//\brief Converts all presentation styles, styled items and material styles of the model before geometry conversion starts.
+	// Styles with equal appearance share one StyleData. Afterwards the convert methods only do lock-free lookups in the table.
+	void resolveStyles(const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map_entities)
+	{
+		clearStylesCache();
+
+		std::vector<std::pair<shared_ptr<IfcPresentationStyle>, shared_ptr<StyleData> > > vec_styles;
+		std::vector<std::pair<shared_ptr<IfcStyledItem>, std::vector<shared_ptr<StyleData> > > > vec_styled_items;
+		std::vector<std::pair<shared_ptr<IfcMaterial>, std::vector<shared_ptr<StyleData> > > > vec_materials;
+		for (auto it = map_entities.begin(); it != map_entities.end(); ++it)
+		{
+			const shared_ptr<BuildingEntity>& entity = it->second;
+			if (!entity)
+			{
+				continue;
+			}
+
+			shared_ptr<IfcPresentationStyle> presentation_style = dynamic_pointer_cast<IfcPresentationStyle>(entity);
+			if (presentation_style)
+			{
+				vec_styles.push_back({ presentation_style, shared_ptr<StyleData>() });
+				continue;
+			}
+
+			shared_ptr<IfcStyledItem> styled_item = dynamic_pointer_cast<IfcStyledItem>(entity);
+			if (styled_item)
+			{
+				vec_styled_items.push_back({ styled_item, std::vector<shared_ptr<StyleData> >() });
+				continue;
+			}
+
+			shared_ptr<IfcMaterial> material = dynamic_pointer_cast<IfcMaterial>(entity);
+			if (material)
+			{
+				vec_materials.push_back({ material, std::vector<shared_ptr<StyleData> >() });
+			}
+		}
+
+		// sort by tag, so that the palette does not depend on the order of the entity map
+		std::sort(vec_styles.begin(), vec_styles.end(), [](const auto& a, const auto& b) { return a.first->m_tag < b.first->m_tag; });
+
+		FOR_EACH_LOOP vec_styles.begin(), vec_styles.end(), [&](std::pair<shared_ptr<IfcPresentationStyle>, shared_ptr<StyleData> >& style_pair) {
+			shared_ptr<StyleData> style_data(new StyleData(style_pair.first->m_tag));
+			convertIfcPresentationStyleData(style_pair.first, style_data);
+			style_pair.second = style_data;
+		});
+
+		std::map<std::vector<double>, shared_ptr<StyleData> > map_palette;
+		for (auto& style_pair : vec_styles)
+		{
+			shared_ptr<StyleData>& style_data = style_pair.second;
+			if (!style_data->m_text_style)
+			{
+				const StyleData& s = *style_data;
+				std::vector<double> key = { s.m_color_ambient.r, s.m_color_ambient.g, s.m_color_ambient.b, s.m_color_ambient.a,
+					s.m_color_diffuse.r, s.m_color_diffuse.g, s.m_color_diffuse.b, s.m_color_diffuse.a,
+					s.m_color_specular.r, s.m_color_specular.g, s.m_color_specular.b, s.m_color_specular.a,
+					s.m_shininess, s.m_transparency, s.m_specular_exponent, s.m_specular_roughness, (double)s.m_apply_to_geometry_type, (double)s.m_complete };
+
+				auto it_palette = map_palette.find(key);
+				if (it_palette != map_palette.end())
+				{
+					style_data = it_palette->second;
+				}
+				else
+				{
+					map_palette[key] = style_data;
+					m_style_palette.push_back(style_data);
+				}
+			}
+			else
+			{
+				m_style_palette.push_back(style_data);
+			}
+			m_style_table[style_pair.first->m_tag] = style_data;
+		}
+
+		// from here on, styles are only looked up in m_style_table
+		m_style_table_resolved = true;
+
+		FOR_EACH_LOOP vec_styled_items.begin(), vec_styled_items.end(), [&](std::pair<shared_ptr<IfcStyledItem>, std::vector<shared_ptr<StyleData> > >& item_pair) {
+			convertIfcStyledItem(item_pair.first, item_pair.second);
+		});
+
+		FOR_EACH_LOOP vec_materials.begin(), vec_materials.end(), [&](std::pair<shared_ptr<IfcMaterial>, std::vector<shared_ptr<StyleData> > >& material_pair) {
+			convertIfcMaterial(material_pair.first, material_pair.second);
+		});
+
+		for (auto& item_pair : vec_styled_items)
+		{
+			m_styled_item_table[item_pair.first->m_tag] = std::move(item_pair.second);
+		}
+
+		for (auto& material_pair : vec_materials)
+		{
+			m_material_style_table[material_pair.first->m_tag] = std::move(material_pair.second);
+		}
 	}
 
 	static void convertIfcSpecularHighlightSelect(shared_ptr<IfcSpecularHighlightSelect> highlight_select, shared_ptr<StyleData>& style_data)
@@ -270,6 +385,21 @@ public:
 	void convertIfcPresentationStyle(shared_ptr<IfcPresentationStyle> presentation_style, shared_ptr<StyleData>& style_data)
 	{
 		int style_id = presentation_style->m_tag;
+		if (m_style_table_resolved)
+		{
+			auto it_find_existing_style = m_style_table.find(style_id);
+			if (it_find_existing_style != m_style_table.end())
+			{
+				style_data = it_find_existing_style->second;
+				return;
+			}
+
+			// style is not part of the model that has been resolved, convert it without caching
+			style_data = shared_ptr<StyleData>(new StyleData(style_id));
+			convertIfcPresentationStyleData(presentation_style, style_data);
+			return;
+		}
+
 		{
 
 			auto it_find_existing_style = m_map_ifc_styles.find(style_id);
@@ -294,11 +424,16 @@ public:
 			}
 		}
 
+		convertIfcPresentationStyleData(presentation_style, style_data);
+	}
+
+	static void convertIfcPresentationStyleData(const shared_ptr<IfcPresentationStyle>& presentation_style, shared_ptr<StyleData>& style_data)
+	{
 		// ENTITY IfcPresentationStyle	ABSTRACT SUPERTYPE OF(ONEOF(IfcCurveStyle, IfcFillAreaStyle, IfcSurfaceStyle, IfcSymbolStyle, IfcTextStyle));
 		shared_ptr<IfcCurveStyle> curve_style = dynamic_pointer_cast<IfcCurveStyle>(presentation_style);
 		if (curve_style)
 		{
-			convertIfcCurveStyle(curve_style, style_data);
+			convertIfcCurveStyleData(curve_style, style_data);
 			return;
 		}
 
@@ -326,7 +461,7 @@ public:
 
 					if (hatching->m_HatchLineAppearance)
 					{
-						convertIfcCurveStyle(hatching->m_HatchLineAppearance, style_data);
+						convertIfcCurveStyleData(hatching->m_HatchLineAppearance, style_data);
 					}
 					continue;
 				}
@@ -376,7 +511,7 @@ public:
 		shared_ptr<IfcSurfaceStyle> surface_style = dynamic_pointer_cast<IfcSurfaceStyle>(presentation_style);
 		if (surface_style)
 		{
-			convertIfcSurfaceStyle(surface_style, style_data);
+			convertIfcSurfaceStyleData(surface_style, style_data);
 			return;
 		}
 
@@ -398,6 +533,18 @@ public:
 			return;
 		}
 		int style_id = curve_style->m_tag;
+		if (m_style_table_resolved)
+		{
+			auto it_find_existing_style = m_style_table.find(style_id);
+			if (it_find_existing_style != m_style_table.end())
+			{
+				style_data = it_find_existing_style->second;
+				return;
+			}
+			style_data = shared_ptr<StyleData>(new StyleData(style_id));
+			convertIfcCurveStyleData(curve_style, style_data);
+			return;
+		}
 #if ENABLE_STYLE_CACHING
 		auto it_find_existing_style = m_map_ifc_styles.find(style_id);
 		if (it_find_existing_style != m_map_ifc_styles.end())
@@ -420,9 +567,14 @@ public:
 
 			std::lock_guard<std::mutex> lock(m_writelock_styles_converter);
 			m_map_ifc_styles[style_id] = style_data;
-			style_data->m_apply_to_geometry_type = StyleData::GEOM_TYPE_CURVE;
 		}
 
+		convertIfcCurveStyleData(curve_style, style_data);
+	}
+
+	static void convertIfcCurveStyleData(const shared_ptr<IfcCurveStyle>& curve_style, shared_ptr<StyleData>& style_data)
+	{
+		style_data->m_apply_to_geometry_type = StyleData::GEOM_TYPE_CURVE;
 
 		//CurveFont		: OPTIONAL IfcCurveFontOrScaledCurveFontSelect;
 		//CurveWidth	: OPTIONAL IfcSizeSelect;
@@ -455,6 +607,16 @@ public:
 			return;
 		}
 
+		if (m_style_table_resolved)
+		{
+			auto it_find_material = m_material_style_table.find(mat->m_tag);
+			if (it_find_material != m_material_style_table.end())
+			{
+				std::copy(it_find_material->second.begin(), it_find_material->second.end(), std::back_inserter(vec_style_data));
+				return;
+			}
+		}
+
 		// IfcMaterialDefinition -----------------------------------------------------------
 		// inverse attributes:
 		//  std::vector<weak_ptr<IfcRelAssociatesMaterial> >			m_AssociatedTo_inverse;
@@ -656,6 +818,18 @@ public:
 			return;
 		}
 		const int style_id = surface_style->m_tag;
+		if (m_style_table_resolved)
+		{
+			auto it_find_existing_style = m_style_table.find(style_id);
+			if (it_find_existing_style != m_style_table.end())
+			{
+				style_data = it_find_existing_style->second;
+				return;
+			}
+			style_data = shared_ptr<StyleData>(new StyleData(style_id));
+			convertIfcSurfaceStyleData(surface_style, style_data);
+			return;
+		}
 
 		{
 			std::lock_guard<std::mutex> lock(m_writelock_styles_converter);
@@ -680,6 +854,11 @@ public:
 			}
 		}
 
+		convertIfcSurfaceStyleData(surface_style, style_data);
+	}
+
+	static void convertIfcSurfaceStyleData(const shared_ptr<IfcSurfaceStyle>& surface_style, shared_ptr<StyleData>& style_data)
+	{
 		style_data->m_apply_to_geometry_type = StyleData::GEOM_TYPE_SURFACE;
 
 		std::vector<shared_ptr<IfcSurfaceStyleElementSelect> >& vec_styles = surface_style->m_Styles;
@@ -764,6 +943,16 @@ public:
 		shared_ptr<IfcStyledItem> styled_item(styled_item_weak);
 		const int style_id = styled_item->m_tag;
 
+		if (m_style_table_resolved)
+		{
+			auto it_find_styled_item = m_styled_item_table.find(style_id);
+			if (it_find_styled_item != m_styled_item_table.end())
+			{
+				std::copy(it_find_styled_item->second.begin(), it_find_styled_item->second.end(), std::back_inserter(vec_style_data));
+				return;
+			}
+		}
+		else
 		{
 			//std::lock_guard<std::mutex> lock(m_writelock_styles_converter);
 			auto it_find_existing_style = m_map_ifc_styles.find(style_id);
@@ -0,0 +1,1121 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#define _USE_MATH_DEFINES
+#include <cmath>
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <unordered_map>
+#include <unordered_set>
+#include <earcut/include/mapbox/earcut.hpp>
+#include "GeometrySettings.h"
+#include "GeomUtils.h"
+#include "PolyInputCache3D.h"
+#include "SurfaceTessellator.h"
+
+namespace
+{
+	struct SurfaceVertex
+	{
+		vec2	uv;
+		vec3	point;
+	};
+	typedef std::vector<SurfaceVertex> SurfaceRing;
+
+	inline uint64_t edgeKey( uint32_t a, uint32_t b )
+	{
+		if( a > b )
+		{
+			std::swap( a, b );
+		}
+		return ( uint64_t( a ) << 32 ) | b;
+	}
+
+	double computeSignedArea( const SurfaceRing& ring )
+	{
+		double area = 0;
+		for( size_t ii = 0; ii < ring.size(); ++ii )
+		{
+			const vec2& a = ring[ii].uv;
+			const vec2& b = ring[( ii + 1 ) % ring.size()].uv;
+			area += a.x * b.y - b.x * a.y;
+		}
+		return area * 0.5;
+	}
+
+	vec2 computeCentroid( const SurfaceRing& ring )
+	{
+		vec2 centroid = carve::geom::VECTOR( 0, 0 );
+		for( const SurfaceVertex& vertex : ring )
+		{
+			centroid += vertex.uv;
+		}
+		return centroid / double( std::max( ring.size(), size_t( 1 ) ) );
+	}
+
+	//\brief Appends the points strictly between uvA and uvB, spaced according to the step sizes of the surface
+	void addSubdividedLine( const AnalyticSurface& surface, const vec2& uvA, const vec2& uvB, SurfaceRing& ring )
+	{
+		double numSteps = 1;
+		for( int dim = 0; dim < 2; ++dim )
+		{
+			if( std::isfinite( surface.m_max_step[dim] ) )
+			{
+				numSteps = std::max( numSteps, std::ceil( std::abs( uvB[dim] - uvA[dim] ) / surface.m_max_step[dim] - 1.e-9 ) );
+			}
+		}
+		const int num = int( std::min( numSteps, 10000.0 ) );
+		for( int ii = 1; ii < num; ++ii )
+		{
+			const vec2 uv = uvA + ( uvB - uvA ) * ( double( ii ) / double( num ) );
+			ring.push_back( { uv, surface.evaluate( uv.x, uv.y ) } );
+		}
+	}
+
+	void shiftRing( SurfaceRing& ring, int dim, double shift )
+	{
+		for( SurfaceVertex& vertex : ring )
+		{
+			vertex.uv[dim] += shift;
+		}
+	}
+
+	//\brief Maps a boundary loop to the parameter space, continuous across the seams of periodic parameters
+	///@param[out] winding: number of periods the loop runs through, for each parameter
+	bool mapLoop( const AnalyticSurface& surface, const std::vector<vec3>& loop, SurfaceRing& ring, std::array<int, 2>& winding )
+	{
+		const size_t numPoints = loop.size();
+		std::vector<vec2> uv( numPoints );
+		std::vector<char> defined( numPoints );
+		size_t first = numPoints;
+		for( size_t ii = 0; ii < numPoints; ++ii )
+		{
+			defined[ii] = surface.project( loop[ii], uv[ii] );
+			if( defined[ii] && first == numPoints )
+			{
+				first = ii;
+			}
+		}
+		if( first == numPoints )
+		{
+			return false;
+		}
+
+		// unwrap, so that adjacent points are less than half a period apart
+		winding = { 0, 0 };
+		vec2 previous = uv[first];
+		for( size_t kk = 1; kk <= numPoints; ++kk )
+		{
+			const size_t ii = ( first + kk ) % numPoints;
+			if( !defined[ii] )
+			{
+				continue;
+			}
+			vec2 current = uv[ii];
+			for( int dim = 0; dim < 2; ++dim )
+			{
+				if( surface.m_period[dim] > 0 )
+				{
+					current[dim] = previous[dim] + std::remainder( uv[ii][dim] - previous[dim], surface.m_period[dim] );
+				}
+			}
+			if( kk == numPoints )
+			{
+				for( int dim = 0; dim < 2; ++dim )
+				{
+					if( surface.m_period[dim] > 0 )
+					{
+						winding[dim] = int( std::lround( ( current[dim] - uv[first][dim] ) / surface.m_period[dim] ) );
+					}
+				}
+				break;
+			}
+			uv[ii] = current;
+			previous = current;
+		}
+
+		// a pole is expanded to a line from the parameter of the previous point to the parameter of the next point
+		const int pole = surface.m_pole_parameter;
+		for( size_t kk = 0; kk < numPoints; ++kk )
+		{
+			const size_t ii = ( first + kk ) % numPoints;
+			if( defined[ii] )
+			{
+				ring.push_back( { uv[ii], loop[ii] } );
+				continue;
+			}
+			if( pole < 0 )
+			{
+				continue;
+			}
+
+			vec2 next = uv[first];
+			next[pole] += winding[pole] * surface.m_period[pole];
+			for( size_t jj = kk + 1; jj < numPoints; ++jj )
+			{
+				if( defined[( first + jj ) % numPoints] )
+				{
+					next = uv[( first + jj ) % numPoints];
+					break;
+				}
+			}
+
+			vec2 uvA = ring.back().uv;
+			vec2 uvB = next;
+			uvA[1 - pole] = uv[ii][1 - pole];
+			uvB[1 - pole] = uv[ii][1 - pole];
+			ring.push_back( { uvA, loop[ii] } );
+			addSubdividedLine( surface, uvA, uvB, ring );
+			if( std::abs( uvB[pole] - uvA[pole] ) > 1.e-12 )
+			{
+				ring.push_back( { uvB, loop[ii] } );
+			}
+		}
+		return ring.size() > 2;
+	}
+
+	bool isOnPole( const AnalyticSurface& surface, const vec2& uv )
+	{
+		if( surface.m_pole_parameter < 0 )
+		{
+			return false;
+		}
+		const int dim = 1 - surface.m_pole_parameter;
+		return ( surface.m_pole_at_min[dim] && std::abs( uv[dim] - surface.m_range_min[dim] ) < 1.e-9 )
+			|| ( surface.m_pole_at_max[dim] && std::abs( uv[dim] - surface.m_range_max[dim] ) < 1.e-9 );
+	}
+
+	inline double orientation2D( const vec2& a, const vec2& b, const vec2& c )
+	{
+		return ( b.x - a.x ) * ( c.y - a.y ) - ( b.y - a.y ) * ( c.x - a.x );
+	}
+
+	inline double angleAt( const vec2& corner, const vec2& a, const vec2& b )
+	{
+		const vec2 da = a - corner;
+		const vec2 db = b - corner;
+		const double lengths = da.length() * db.length();
+		return lengths > 0 ? std::acos( std::max( -1.0, std::min( 1.0, dot( da, db ) / lengths ) ) ) : 0.0;
+	}
+
+	//\brief Flips interior edges towards a Delaunay triangulation in (u,v), scaled by the local metric of the surface. Triangles must be counter-clockwise in (u,v)
+	///@details Ear clipping of long bands, like the mantle of a cylinder, creates fans of long triangles that would be refined unnecessarily
+	void flipEdges( const AnalyticSurface& surface, const std::vector<SurfaceVertex>& vertices, std::vector<uint32_t>& triangles, const std::unordered_set<uint64_t>& boundaryEdges, double eps )
+	{
+		const size_t numTriangles = triangles.size() / 3;
+		for( size_t iteration = 0; iteration < 1000; ++iteration )
+		{
+			// interior edge -> triangle and index of the edge in the triangle
+			std::unordered_map<uint64_t, std::pair<size_t, int> > edgeToTriangle;
+			bool flipped = false;
+			std::vector<char> modified( numTriangles, 0 );
+			for( size_t tri = 0; tri < numTriangles; ++tri )
+			{
+				for( int kk = 0; kk < 3; ++kk )
+				{
+					const uint32_t a = triangles[tri * 3 + kk];
+					const uint32_t b = triangles[tri * 3 + ( kk + 1 ) % 3];
+					const uint64_t key = edgeKey( a, b );
+					if( boundaryEdges.count( key ) > 0 )
+					{
+						continue;
+					}
+					auto it = edgeToTriangle.find( key );
+					if( it == edgeToTriangle.end() )
+					{
+						edgeToTriangle[key] = { tri, kk };
+						continue;
+					}
+
+					const size_t other = it->second.first;
+					if( modified[tri] || modified[other] )
+					{
+						continue;
+					}
+					const uint32_t c = triangles[tri * 3 + ( kk + 2 ) % 3];
+					const uint32_t d = triangles[other * 3 + ( it->second.second + 2 ) % 3];
+					const SurfaceVertex& va = vertices[a];
+					const SurfaceVertex& vb = vertices[b];
+					const SurfaceVertex& vc = vertices[c];
+					const SurfaceVertex& vd = vertices[d];
+					if( ( vc.point - vd.point ).length2() < eps * eps || ( va.point - vb.point ).length2() < eps * eps )
+					{
+						continue;
+					}
+
+					// the new diagonal from c to d has to be inside the quad in (u,v)
+					if( orientation2D( vc.uv, vd.uv, va.uv ) * orientation2D( vc.uv, vd.uv, vb.uv ) >= 0 )
+					{
+						continue;
+					}
+
+					// length of the derivatives at the center of the quad
+					const vec2 center = ( va.uv + vb.uv + vc.uv + vd.uv ) * 0.25;
+					const double h = 1.e-4;
+					const double scaleU = ( surface.evaluate( center.x + h, center.y ) - surface.evaluate( center.x - h, center.y ) ).length() / ( 2.0 * h );
+					const double scaleV = ( surface.evaluate( center.x, center.y + h ) - surface.evaluate( center.x, center.y - h ) ).length() / ( 2.0 * h );
+					if( scaleU < eps || scaleV < eps )
+					{
+						continue;
+					}
+					auto scaled = [&]( const vec2& uv ) { return carve::geom::VECTOR( uv.x * scaleU, uv.y * scaleV ); };
+					if( angleAt( scaled( vc.uv ), scaled( va.uv ), scaled( vb.uv ) ) + angleAt( scaled( vd.uv ), scaled( va.uv ), scaled( vb.uv ) ) <= M_PI + 1.e-9 )
+					{
+						continue;
+					}
+
+					// quad a, d, b, c is counter-clockwise
+					triangles[tri * 3 + 0] = a;
+					triangles[tri * 3 + 1] = d;
+					triangles[tri * 3 + 2] = c;
+					triangles[other * 3 + 0] = d;
+					triangles[other * 3 + 1] = b;
+					triangles[other * 3 + 2] = c;
+					modified[tri] = modified[other] = 1;
+					flipped = true;
+				}
+			}
+			if( !flipped )
+			{
+				break;
+			}
+		}
+	}
+
+	//\brief Inserts the points of the grid of the step sizes into the triangles of the outline, so that the refinement starts with triangles of about the final size
+	///@details Points closer than half a step to the boundary are left out, to avoid slivers along boundary edges that can not be flipped
+	void insertGridPoints( const AnalyticSurface& surface, std::vector<SurfaceVertex>& vertices, std::vector<uint32_t>& triangles, const std::unordered_set<uint64_t>& boundaryEdges )
+	{
+		const double stepU = surface.m_max_step[0];
+		const double stepV = surface.m_max_step[1];
+		if( !std::isfinite( stepU ) || !std::isfinite( stepV ) || triangles.empty() )
+		{
+			return;
+		}
+
+		// parameters in units of the steps, so that the grid points are at integer coordinates
+		auto toGrid = [&]( const vec2& uv ) { return carve::geom::VECTOR( uv.x / stepU, uv.y / stepV ); };
+		vec2 gridMin = toGrid( vertices[triangles[0]].uv );
+		vec2 gridMax = gridMin;
+		for( uint32_t idx : triangles )
+		{
+			const vec2 point = toGrid( vertices[idx].uv );
+			gridMin = carve::geom::VECTOR( std::min( gridMin.x, point.x ), std::min( gridMin.y, point.y ) );
+			gridMax = carve::geom::VECTOR( std::max( gridMax.x, point.x ), std::max( gridMax.y, point.y ) );
+		}
+		if( ( gridMax.x - gridMin.x + 1.0 ) * ( gridMax.y - gridMin.y + 1.0 ) > 250000.0 )
+		{
+			return;
+		}
+		auto gridKey = []( int64_t iu, int64_t iv ) { return ( uint64_t( uint32_t( iu ) ) << 32 ) | uint64_t( uint32_t( iv ) ); };
+
+		std::unordered_set<uint64_t> blocked;
+		for( uint64_t edge : boundaryEdges )
+		{
+			const vec2 a = toGrid( vertices[uint32_t( edge >> 32 )].uv );
+			const vec2 b = toGrid( vertices[uint32_t( edge & 0xFFFFFFFF )].uv );
+			const vec2 ab = b - a;
+			const double length2 = ab.length2();
+			for( int64_t iu = int64_t( std::floor( std::min( a.x, b.x ) - 0.5 ) ); iu <= int64_t( std::ceil( std::max( a.x, b.x ) + 0.5 ) ); ++iu )
+			{
+				for( int64_t iv = int64_t( std::floor( std::min( a.y, b.y ) - 0.5 ) ); iv <= int64_t( std::ceil( std::max( a.y, b.y ) + 0.5 ) ); ++iv )
+				{
+					const vec2 point = carve::geom::VECTOR( double( iu ), double( iv ) );
+					const double t = length2 > 0 ? std::max( 0.0, std::min( 1.0, dot( point - a, ab ) / length2 ) ) : 0.0;
+					if( ( point - ( a + ab * t ) ).length2() < 0.25 )
+					{
+						blocked.insert( gridKey( iu, iv ) );
+					}
+				}
+			}
+		}
+
+		auto isInside = [&]( const vec2& point, uint32_t a, uint32_t b, uint32_t c ) {
+			const vec2& uvA = vertices[a].uv;
+			const vec2& uvB = vertices[b].uv;
+			const vec2& uvC = vertices[c].uv;
+			const double area = orientation2D( uvA, uvB, uvC );
+			const double tolerance = area * 1.e-9;
+			return area > 0 && orientation2D( uvA, uvB, point ) > tolerance && orientation2D( uvB, uvC, point ) > tolerance && orientation2D( uvC, uvA, point ) > tolerance;
+		};
+
+		// each triangle is split at the point closest to its center, and the other points are distributed to the three new triangles
+		struct InsertTask
+		{
+			uint32_t corners[3];
+			std::vector<vec2> points;
+		};
+		std::vector<uint32_t> result;
+		result.reserve( triangles.size() );
+		std::vector<InsertTask> tasks;
+		for( size_t ii = 0; ii + 2 < triangles.size(); ii += 3 )
+		{
+			InsertTask task = { { triangles[ii], triangles[ii + 1], triangles[ii + 2] }, {} };
+			vec2 triangleMin = toGrid( vertices[task.corners[0]].uv );
+			vec2 triangleMax = triangleMin;
+			for( int kk = 1; kk < 3; ++kk )
+			{
+				const vec2 point = toGrid( vertices[task.corners[kk]].uv );
+				triangleMin = carve::geom::VECTOR( std::min( triangleMin.x, point.x ), std::min( triangleMin.y, point.y ) );
+				triangleMax = carve::geom::VECTOR( std::max( triangleMax.x, point.x ), std::max( triangleMax.y, point.y ) );
+			}
+			for( int64_t iu = int64_t( std::ceil( triangleMin.x ) ); iu <= int64_t( std::floor( triangleMax.x ) ); ++iu )
+			{
+				for( int64_t iv = int64_t( std::ceil( triangleMin.y ) ); iv <= int64_t( std::floor( triangleMax.y ) ); ++iv )
+				{
+					const vec2 uv = carve::geom::VECTOR( double( iu ) * stepU, double( iv ) * stepV );
+					if( blocked.count( gridKey( iu, iv ) ) == 0 && isInside( uv, task.corners[0], task.corners[1], task.corners[2] ) )
+					{
+						task.points.push_back( uv );
+					}
+				}
+			}
+			tasks.push_back( std::move( task ) );
+
+			while( !tasks.empty() )
+			{
+				InsertTask current = std::move( tasks.back() );
+				tasks.pop_back();
+				const uint32_t a = current.corners[0], b = current.corners[1], c = current.corners[2];
+				if( current.points.empty() )
+				{
+					result.insert( result.end(), { a, b, c } );
+					continue;
+				}
+
+				const vec2 center = ( vertices[a].uv + vertices[b].uv + vertices[c].uv ) / 3.0;
+				size_t closest = 0;
+				for( size_t jj = 1; jj < current.points.size(); ++jj )
+				{
+					if( ( current.points[jj] - center ).length2() < ( current.points[closest] - center ).length2() )
+					{
+						closest = jj;
+					}
+				}
+				const vec2 uv = current.points[closest];
+				const uint32_t idx = uint32_t( vertices.size() );
+				vertices.push_back( { uv, surface.evaluate( uv.x, uv.y ) } );
+
+				InsertTask children[3] = { { { a, b, idx }, {} }, { { b, c, idx }, {} }, { { c, a, idx }, {} } };
+				for( size_t jj = 0; jj < current.points.size(); ++jj )
+				{
+					for( InsertTask& child : children )
+					{
+						// points on the new edges are left out
+						if( jj != closest && isInside( current.points[jj], child.corners[0], child.corners[1], child.corners[2] ) )
+						{
+							child.points.push_back( current.points[jj] );
+							break;
+						}
+					}
+				}
+				for( InsertTask& child : children )
+				{
+					tasks.push_back( std::move( child ) );
+				}
+			}
+		}
+		triangles.swap( result );
+	}
+
+	//\brief Checks if an edge deviates from the surface, or runs over several steps, where the deviation at the midpoint could be small by chance
+	bool isEdgeTooLong( const AnalyticSurface& surface, const SurfaceVertex& a, const SurfaceVertex& b, double eps )
+	{
+		const double length2 = ( b.point - a.point ).length2();
+		if( length2 < eps * eps || length2 < surface.m_max_deviation * surface.m_max_deviation )
+		{
+			// edges shorter than the deviation can not deviate more, like the edges next to a pole over many steps of the undefined parameter
+			return false;
+		}
+
+		vec2 uvCheck = ( a.uv + b.uv ) * 0.5;
+		vec2 delta = b.uv - a.uv;
+		const bool poleA = isOnPole( surface, a.uv );
+		if( poleA != isOnPole( surface, b.uv ) )
+		{
+			// all points of a pole line coincide, so the edge runs along the line of constant undefined parameter through the other vertex
+			const int dim = surface.m_pole_parameter;
+			uvCheck[dim] = poleA ? b.uv[dim] : a.uv[dim];
+			delta[dim] = 0;
+		}
+		if( std::abs( delta.x ) > surface.m_max_step[0] * 4.0 || std::abs( delta.y ) > surface.m_max_step[1] * 4.0 )
+		{
+			return true;
+		}
+
+		// edges within one step are as fine as the boundary curves
+		if( std::abs( delta.x ) <= surface.m_max_step[0] * 1.01 && std::abs( delta.y ) <= surface.m_max_step[1] * 1.01 )
+		{
+			return false;
+		}
+		const vec3 pointCheck = surface.evaluate( uvCheck.x, uvCheck.y );
+		return ( pointCheck - ( a.point + b.point ) * 0.5 ).length() > surface.m_max_deviation;
+	}
+
+	//\brief Splits interior edges that are longer than the step sizes of the surface, until all edges are short enough
+	void refineMesh( const AnalyticSurface& surface, std::vector<SurfaceVertex>& vertices, std::vector<uint32_t>& triangles, const std::unordered_set<uint64_t>& boundaryEdges,
+		double eps )
+	{
+		const size_t maxNumVertices = 250000;
+		for( int pass = 0; pass < 32; ++pass )
+		{
+			std::unordered_map<uint64_t, uint32_t> midpoints;
+			for( size_t ii = 0; ii < triangles.size() && vertices.size() < maxNumVertices; ++ii )
+			{
+				const uint32_t idxA = triangles[ii];
+				const uint32_t idxB = triangles[ii % 3 == 2 ? ii - 2 : ii + 1];
+				const uint64_t key = edgeKey( idxA, idxB );
+				if( boundaryEdges.count( key ) > 0 || midpoints.count( key ) > 0 || !isEdgeTooLong( surface, vertices[idxA], vertices[idxB], eps ) )
+				{
+					continue;
+				}
+
+				const vec2 uv = ( vertices[idxA].uv + vertices[idxB].uv ) * 0.5;
+				midpoints[key] = uint32_t( vertices.size() );
+				vertices.push_back( { uv, surface.evaluate( uv.x, uv.y ) } );
+			}
+
+			if( midpoints.empty() )
+			{
+				break;
+			}
+
+			std::vector<uint32_t> refined;
+			refined.reserve( triangles.size() * 2 );
+			for( size_t ii = 0; ii + 2 < triangles.size(); ii += 3 )
+			{
+				const uint32_t t[3] = { triangles[ii], triangles[ii + 1], triangles[ii + 2] };
+				int64_t mid[3];
+				int numSplit = 0;
+				for( int kk = 0; kk < 3; ++kk )
+				{
+					auto it = midpoints.find( edgeKey( t[kk], t[( kk + 1 ) % 3] ) );
+					mid[kk] = it != midpoints.end() ? int64_t( it->second ) : -1;
+					numSplit += it != midpoints.end() ? 1 : 0;
+				}
+
+				if( numSplit == 0 )
+				{
+					refined.insert( refined.end(), { t[0], t[1], t[2] } );
+				}
+				else if( numSplit == 1 )
+				{
+					const int r = mid[0] >= 0 ? 0 : ( mid[1] >= 0 ? 1 : 2 );
+					const uint32_t a = t[r], b = t[( r + 1 ) % 3], c = t[( r + 2 ) % 3], m = uint32_t( mid[r] );
+					refined.insert( refined.end(), { a, m, c, m, b, c } );
+				}
+				else if( numSplit == 2 )
+				{
+					// rotate, so that the edge from c to a is the one not split
+					const int unsplit = mid[0] < 0 ? 0 : ( mid[1] < 0 ? 1 : 2 );
+					const int r = ( unsplit + 1 ) % 3;
+					const uint32_t a = t[r], b = t[( r + 1 ) % 3], c = t[( r + 2 ) % 3];
+					const uint32_t mAB = uint32_t( mid[r] ), mBC = uint32_t( mid[( r + 1 ) % 3] );
+					refined.insert( refined.end(), { mAB, b, mBC, a, mAB, mBC, a, mBC, c } );
+				}
+				else
+				{
+					const uint32_t m0 = uint32_t( mid[0] ), m1 = uint32_t( mid[1] ), m2 = uint32_t( mid[2] );
+					refined.insert( refined.end(), { t[0], m0, m2, m0, t[1], m1, m2, m1, t[2], m0, m1, m2 } );
+				}
+			}
+			triangles.swap( refined );
+			flipEdges( surface, vertices, triangles, boundaryEdges, eps );
+		}
+	}
+
+	//\brief Replaces points that are closer than eps by the first of them, so that PolyInputCache3D, which welds only identical points, joins the seams and poles
+	void weldPoints( std::vector<SurfaceVertex>& vertices, double eps )
+	{
+		struct CellHash
+		{
+			size_t operator()( const std::array<int64_t, 3>& cell ) const
+			{
+				return size_t( cell[0] * 73856093 ) ^ size_t( cell[1] * 19349663 ) ^ size_t( cell[2] * 83492791 );
+			}
+		};
+		std::unordered_map<std::array<int64_t, 3>, std::vector<uint32_t>, CellHash> grid;
+		for( size_t ii = 0; ii < vertices.size(); ++ii )
+		{
+			vec3& point = vertices[ii].point;
+			const std::array<int64_t, 3> cell = { int64_t( std::floor( point.x / eps ) ), int64_t( std::floor( point.y / eps ) ), int64_t( std::floor( point.z / eps ) ) };
+			bool welded = false;
+			for( int neighbor = 0; neighbor < 27 && !welded; ++neighbor )
+			{
+				const std::array<int64_t, 3> neighborCell = { cell[0] + neighbor % 3 - 1, cell[1] + ( neighbor / 3 ) % 3 - 1, cell[2] + neighbor / 9 - 1 };
+				auto it = grid.find( neighborCell );
+				if( it == grid.end() )
+				{
+					continue;
+				}
+				for( uint32_t other : it->second )
+				{
+					if( ( vertices[other].point - point ).length2() < eps * eps )
+					{
+						point = vertices[other].point;
+						welded = true;
+						break;
+					}
+				}
+			}
+			if( !welded )
+			{
+				grid[cell].push_back( uint32_t( ii ) );
+			}
+		}
+	}
+
+	//\brief Triangulates an outer ring with holes in parameter space, refines and adds the triangles to the mesh
+	bool triangulateRings( const AnalyticSurface& surface, const std::vector<SurfaceRing>& rings, bool sameSense, PolyInputCache3D& meshOut, double eps )
+	{
+		std::vector<SurfaceVertex> vertices;
+		std::vector<std::vector<std::array<double, 2> > > polygons2d;
+		std::unordered_set<uint64_t> boundaryEdges;
+		for( const SurfaceRing& ring : rings )
+		{
+			if( ring.size() < 3 )
+			{
+				if( polygons2d.empty() )
+				{
+					return false;
+				}
+				continue;
+			}
+
+			const uint32_t offset = uint32_t( vertices.size() );
+			polygons2d.push_back( std::vector<std::array<double, 2> >() );
+			for( size_t ii = 0; ii < ring.size(); ++ii )
+			{
+				vertices.push_back( ring[ii] );
+				polygons2d.back().push_back( { ring[ii].uv.x, ring[ii].uv.y } );
+				boundaryEdges.insert( edgeKey( offset + uint32_t( ii ), offset + uint32_t( ( ii + 1 ) % ring.size() ) ) );
+			}
+		}
+
+		std::vector<uint32_t> triangles = mapbox::earcut<uint32_t>( polygons2d );
+		if( triangles.empty() )
+		{
+			return false;
+		}
+
+		for( size_t ii = 0; ii + 2 < triangles.size(); ii += 3 )
+		{
+			if( orientation2D( vertices[triangles[ii]].uv, vertices[triangles[ii + 1]].uv, vertices[triangles[ii + 2]].uv ) < 0 )
+			{
+				std::swap( triangles[ii + 1], triangles[ii + 2] );
+			}
+		}
+		insertGridPoints( surface, vertices, triangles, boundaryEdges );
+		flipEdges( surface, vertices, triangles, boundaryEdges, eps );
+		refineMesh( surface, vertices, triangles, boundaryEdges, eps );
+		weldPoints( vertices, eps );
+
+		for( size_t ii = 0; ii + 2 < triangles.size(); ii += 3 )
+		{
+			const SurfaceVertex& a = vertices[triangles[ii]];
+			const SurfaceVertex& b = vertices[triangles[ii + 1]];
+			const SurfaceVertex& c = vertices[triangles[ii + 2]];
+			if( ( orientation2D( a.uv, b.uv, c.uv ) > 0 ) == sameSense )
+			{
+				meshOut.addFaceCheckIndexes( a.point, b.point, c.point, eps );
+			}
+			else
+			{
+				meshOut.addFaceCheckIndexes( a.point, c.point, b.point, eps );
+			}
+		}
+		return true;
+	}
+}
+
+bool AnalyticSurface::init( GeometrySettings& geomSettings, double eps )
+{
+	m_eps = eps;
+	GeomUtils::computeInverse( m_position, m_position_inverse );
+	const double inf = std::numeric_limits<double>::infinity();
+	m_period[0] = m_period[1] = 0;
+	m_max_step[0] = m_max_step[1] = inf;
+	m_range_min[0] = m_range_min[1] = -inf;
+	m_range_max[0] = m_range_max[1] = inf;
+	m_pole_at_min[0] = m_pole_at_min[1] = m_pole_at_max[0] = m_pole_at_max[1] = false;
+	m_pole_parameter = -1;
+
+	auto angularStep = [&]( double radius ) {
+		return 2.0 * M_PI / double( std::max( geomSettings.getNumVerticesPerCircleWithRadius( radius ), 3 ) );
+	};
+
+	// twice the sagitta of a circle discretised like the boundary curves, so that chords along the boundary density are accepted
+	auto chordDeviation = [&]( double radius ) {
+		return 2.0 * radius * ( 1.0 - std::cos( 0.5 * angularStep( radius ) ) );
+	};
+	m_max_deviation = inf;
+
+	switch( m_type )
+	{
+	case SURFACE_PLANE:
+		return true;
+	case SURFACE_CYLINDER:
+		m_period[0] = 2.0 * M_PI;
+		m_max_step[0] = angularStep( m_radius );
+		m_max_deviation = chordDeviation( m_radius );
+		return m_radius > eps;
+	case SURFACE_SPHERE:
+		m_period[0] = 2.0 * M_PI;
+		m_max_step[0] = m_max_step[1] = angularStep( m_radius );
+		m_range_min[1] = -0.5 * M_PI;
+		m_range_max[1] = 0.5 * M_PI;
+		m_pole_at_min[1] = m_pole_at_max[1] = true;
+		m_pole_parameter = 0;
+		m_max_deviation = chordDeviation( m_radius );
+		return m_radius > eps;
+	case SURFACE_TORUS:
+		m_period[0] = m_period[1] = 2.0 * M_PI;
+		m_max_step[0] = angularStep( m_radius + m_minor_radius );
+		m_max_step[1] = angularStep( m_minor_radius );
+		m_max_deviation = std::min( chordDeviation( m_radius + m_minor_radius ), chordDeviation( m_minor_radius ) );
+		return m_minor_radius > eps && m_radius > m_minor_radius;
+	default:
+		break;
+	}
+
+	// swept curve, parametrised by arc length
+	if( m_curve_closed && m_curve_points.size() > 1 && ( m_curve_points.front() - m_curve_points.back() ).length2() > eps * eps )
+	{
+		m_curve_points.push_back( m_curve_points.front() );
+	}
+	if( m_curve_points.size() < 2 )
+	{
+		return false;
+	}
+
+	m_curve_lengths.assign( 1, 0.0 );
+	double minSegmentLength = inf;
+	for( size_t ii = 1; ii < m_curve_points.size(); ++ii )
+	{
+		const double segmentLength = ( m_curve_points[ii] - m_curve_points[ii - 1] ).length();
+		m_curve_lengths.push_back( m_curve_lengths.back() + segmentLength );
+		if( segmentLength > eps )
+		{
+			minSegmentLength = std::min( minSegmentLength, segmentLength );
+		}
+	}
+	const double curveLength = m_curve_lengths.back();
+	if( curveLength < eps )
+	{
+		return false;
+	}
+	m_range_min[0] = 0;
+	m_range_max[0] = curveLength;
+	if( m_curve_closed )
+	{
+		m_period[0] = curveLength;
+	}
+	if( m_curve_points.size() > 2 )
+	{
+		// points of the curve are kinks of the surface
+		m_max_step[0] = minSegmentLength;
+	}
+
+	m_projection_points.clear();
+	if( m_type == SURFACE_LINEAR_EXTRUSION )
+	{
+		for( const vec3& point : m_curve_points )
+		{
+			m_projection_points.push_back( carve::geom::VECTOR( point.x, point.y ) );
+		}
+
+		// deviation of a circle with the same length
+		m_max_deviation = chordDeviation( curveLength / ( 2.0 * M_PI ) );
+		return m_extrusion_direction.length2() > eps * eps;
+	}
+
+	if( m_axis_direction.length2() < eps * eps )
+	{
+		return false;
+	}
+	m_axis_direction.normalize();
+	double maxDistanceToAxis = 0;
+	for( const vec3& point : m_curve_points )
+	{
+		const vec3 d = point - m_axis_location;
+		const double height = dot( d, m_axis_direction );
+		const vec3 radial = d - m_axis_direction * height;
+		const double distanceToAxis = radial.length();
+		m_projection_points.push_back( carve::geom::VECTOR( height, distanceToAxis ) );
+		if( distanceToAxis > maxDistanceToAxis )
+		{
+			maxDistanceToAxis = distanceToAxis;
+			m_meridian_reference = radial / distanceToAxis;
+		}
+	}
+	if( maxDistanceToAxis < eps )
+	{
+		return false;
+	}
+
+	m_period[1] = 2.0 * M_PI;
+	m_max_step[1] = angularStep( maxDistanceToAxis );
+	m_max_deviation = chordDeviation( maxDistanceToAxis );
+	m_pole_parameter = 1;
+	if( !m_curve_closed )
+	{
+		m_pole_at_min[0] = m_projection_points.front().y < eps * 10.0;
+		m_pole_at_max[0] = m_projection_points.back().y < eps * 10.0;
+	}
+	return true;
+}
+
+vec3 AnalyticSurface::evaluateCurve( double u ) const
+{
+	const double curveLength = m_curve_lengths.back();
+	if( m_curve_closed )
+	{
+		u -= std::floor( u / curveLength ) * curveLength;
+	}
+	u = std::max( 0.0, std::min( u, curveLength ) );
+
+	size_t idx = std::upper_bound( m_curve_lengths.begin(), m_curve_lengths.end(), u ) - m_curve_lengths.begin();
+	idx = std::max( size_t( 1 ), std::min( idx, m_curve_lengths.size() - 1 ) );
+	const double segmentLength = m_curve_lengths[idx] - m_curve_lengths[idx - 1];
+	const double t = segmentLength > 0 ? ( u - m_curve_lengths[idx - 1] ) / segmentLength : 0;
+	return m_curve_points[idx - 1] + ( m_curve_points[idx] - m_curve_points[idx - 1] ) * t;
+}
+
+double AnalyticSurface::projectToCurve( const vec2& point ) const
+{
+	double minDistance2 = std::numeric_limits<double>::max();
+	double result = 0;
+	for( size_t ii = 1; ii < m_projection_points.size(); ++ii )
+	{
+		const vec2& a = m_projection_points[ii - 1];
+		const vec2 ab = m_projection_points[ii] - a;
+		const double length2 = ab.length2();
+		double t = length2 > 0 ? dot( point - a, ab ) / length2 : 0;
+		t = std::max( 0.0, std::min( 1.0, t ) );
+		const double distance2 = ( a + ab * t - point ).length2();
+		if( distance2 < minDistance2 )
+		{
+			minDistance2 = distance2;
+			result = m_curve_lengths[ii - 1] + t * ( m_curve_lengths[ii] - m_curve_lengths[ii - 1] );
+		}
+	}
+	return result;
+}
+
+vec3 AnalyticSurface::evaluate( double u, double v ) const
+{
+	vec3 local;
+	switch( m_type )
+	{
+	case SURFACE_PLANE:
+		local = carve::geom::VECTOR( u, v, 0.0 );
+		break;
+	case SURFACE_CYLINDER:
+		local = carve::geom::VECTOR( m_radius * std::cos( u ), m_radius * std::sin( u ), v );
+		break;
+	case SURFACE_SPHERE:
+		local = carve::geom::VECTOR( m_radius * std::cos( v ) * std::cos( u ), m_radius * std::cos( v ) * std::sin( u ), m_radius * std::sin( v ) );
+		break;
+	case SURFACE_TORUS:
+	{
+		const double distanceToAxis = m_radius + m_minor_radius * std::cos( v );
+		local = carve::geom::VECTOR( distanceToAxis * std::cos( u ), distanceToAxis * std::sin( u ), m_minor_radius * std::sin( v ) );
+		break;
+	}
+	case SURFACE_REVOLUTION:
+	{
+		// Rodrigues' rotation of the curve point around the axis
+		const vec3 d = evaluateCurve( u ) - m_axis_location;
+		const vec3& axis = m_axis_direction;
+		const double cosV = std::cos( v );
+		local = m_axis_location + d * cosV + cross( axis, d ) * std::sin( v ) + axis * ( dot( axis, d ) * ( 1.0 - cosV ) );
+		break;
+	}
+	case SURFACE_LINEAR_EXTRUSION:
+		local = evaluateCurve( u ) + m_extrusion_direction * v;
+		break;
+	}
+	return m_position * local;
+}
+
+bool AnalyticSurface::project( const vec3& point, vec2& uv ) const
+{
+	const vec3 local = m_position_inverse * point;
+	const double poleDistance = m_eps * 10.0;
+	switch( m_type )
+	{
+	case SURFACE_PLANE:
+		uv = carve::geom::VECTOR( local.x, local.y );
+		return true;
+	case SURFACE_CYLINDER:
+		uv = carve::geom::VECTOR( std::atan2( local.y, local.x ), local.z );
+		return true;
+	case SURFACE_SPHERE:
+	{
+		const double distanceToAxis = std::hypot( local.x, local.y );
+		uv.y = std::atan2( local.z, distanceToAxis );
+		if( distanceToAxis < poleDistance )
+		{
+			uv.x = 0;
+			return false;
+		}
+		uv.x = std::atan2( local.y, local.x );
+		return true;
+	}
+	case SURFACE_TORUS:
+		uv.x = std::atan2( local.y, local.x );
+		uv.y = std::atan2( local.z, std::hypot( local.x, local.y ) - m_radius );
+		return true;
+	case SURFACE_REVOLUTION:
+	{
+		const vec3 d = local - m_axis_location;
+		const double height = dot( d, m_axis_direction );
+		const vec3 radial = d - m_axis_direction * height;
+		const double distanceToAxis = radial.length();
+		uv.x = projectToCurve( carve::geom::VECTOR( height, distanceToAxis ) );
+		if( distanceToAxis < poleDistance )
+		{
+			uv.y = 0;
+			return false;
+		}
+		uv.y = std::atan2( dot( cross( m_meridian_reference, radial ), m_axis_direction ), dot( m_meridian_reference, radial ) );
+		return true;
+	}
+	case SURFACE_LINEAR_EXTRUSION:
+	{
+		// the swept curve is in the xy plane
+		const vec3& direction = m_extrusion_direction;
+		uv.y = std::abs( direction.z ) > m_eps ? local.z / direction.z : dot( local, direction ) / direction.length2();
+		const vec3 onCurve = local - direction * uv.y;
+		uv.x = projectToCurve( carve::geom::VECTOR( onCurve.x, onCurve.y ) );
+		return true;
+	}
+	}
+	return false;
+}
+
+bool AnalyticSurface::computeNormal( const vec3& point, vec3& normal ) const
+{
+	vec2 uv;
+	if( !project( point, uv ) )
+	{
+		return false;
+	}
+
+	// central differences, also well defined at the kinks of piecewise linear swept curves
+	const double step = 1.e-5;
+	const vec3 du = ( evaluate( uv.x + step, uv.y ) - evaluate( uv.x - step, uv.y ) ) / ( 2.0 * step );
+	const vec3 dv = ( evaluate( uv.x, uv.y + step ) - evaluate( uv.x, uv.y - step ) ) / ( 2.0 * step );
+	normal = cross( du, dv );
+	const double length = normal.length();
+	if( length < 1.e-10 )
+	{
+		return false;
+	}
+	normal /= length;
+	return true;
+}
+
+bool SurfaceTessellator::triangulateFace( const AnalyticSurface& surface, const std::vector<std::vector<vec3> >& loops, bool sameSense, PolyInputCache3D& meshOut, double eps )
+{
+	std::vector<SurfaceRing> rings;
+	std::vector<std::array<int, 2> > windings;
+	int wrapParameter = -1;
+	std::vector<size_t> wrappingRings;
+	for( const std::vector<vec3>& loop : loops )
+	{
+		if( loop.size() < 3 )
+		{
+			continue;
+		}
+		SurfaceRing ring;
+		std::array<int, 2> winding;
+		if( !mapLoop( surface, loop, ring, winding ) )
+		{
+			continue;
+		}
+		if( std::abs( winding[0] ) > 1 || std::abs( winding[1] ) > 1 || ( winding[0] != 0 && winding[1] != 0 ) )
+		{
+			return false;
+		}
+		if( winding[0] != 0 || winding[1] != 0 )
+		{
+			const int parameter = winding[0] != 0 ? 0 : 1;
+			if( wrapParameter >= 0 && wrapParameter != parameter )
+			{
+				return false;
+			}
+			wrapParameter = parameter;
+			wrappingRings.push_back( rings.size() );
+		}
+		rings.push_back( ring );
+		windings.push_back( winding );
+	}
+	if( rings.empty() )
+	{
+		return false;
+	}
+
+	// outer ring in parameter space, and the interval of the periodic parameters it covers
+	SurfaceRing outer;
+	size_t outerIndex = rings.size();
+	vec2 windowStart = carve::geom::VECTOR( 0, 0 );
+	if( wrappingRings.empty() )
+	{
+		double maxArea = -1;
+		for( size_t ii = 0; ii < rings.size(); ++ii )
+		{
+			const double area = std::abs( computeSignedArea( rings[ii] ) );
+			if( area > maxArea )
+			{
+				maxArea = area;
+				outerIndex = ii;
+			}
+		}
+		outer = rings[outerIndex];
+	}
+	else if( wrappingRings.size() == 1 )
+	{
+		// loop around a pole, for example the equator of a hemisphere. Close it through the pole on the side of the face
+		const int p = wrapParameter;
+		const int q = 1 - p;
+		outerIndex = wrappingRings[0];
+		const SurfaceRing& ring = rings[outerIndex];
+		const int winding = windings[outerIndex][p];
+
+		// the face is on the left side of the loop in (u,v) if the normals agree
+		bool interiorAtMax = ( p == 0 ) == ( winding > 0 );
+		if( !sameSense )
+		{
+			interiorAtMax = !interiorAtMax;
+		}
+		if( interiorAtMax ? !surface.m_pole_at_max[q] : !surface.m_pole_at_min[q] )
+		{
+			return false;
+		}
+		const double limit = interiorAtMax ? surface.m_range_max[q] : surface.m_range_min[q];
+
+		outer = ring;
+		const vec2 start = ring[0].uv;
+		vec2 end = start;
+		end[p] += winding * surface.m_period[p];
+		vec2 poleEnd = end;
+		poleEnd[q] = limit;
+		vec2 poleStart = start;
+		poleStart[q] = limit;
+		outer.push_back( { end, ring[0].point } );
+		addSubdividedLine( surface, end, poleEnd, outer );
+		outer.push_back( { poleEnd, surface.evaluate( poleEnd.x, poleEnd.y ) } );
+		addSubdividedLine( surface, poleEnd, poleStart, outer );
+		outer.push_back( { poleStart, surface.evaluate( poleStart.x, poleStart.y ) } );
+		addSubdividedLine( surface, poleStart, start, outer );
+		windowStart[p] = std::min( start[p], end[p] );
+	}
+	else if( wrappingRings.size() == 2 && windings[wrappingRings[0]][wrapParameter] == -windings[wrappingRings[1]][wrapParameter] )
+	{
+		// band between two loops around the surface, for example the mantle of a cylinder. Cut it open along a seam line
+		const int p = wrapParameter;
+		const double period = surface.m_period[p];
+		const bool firstIsForward = windings[wrappingRings[0]][p] > 0;
+		const SurfaceRing& forward = rings[wrappingRings[firstIsForward ? 0 : 1]];
+		const SurfaceRing& backward = rings[wrappingRings[firstIsForward ? 1 : 0]];
+		outerIndex = wrappingRings[firstIsForward ? 0 : 1];
+
+		const double seam = forward[0].uv[p];
+		size_t seamIndexBackward = 0;
+		double minDistance = std::numeric_limits<double>::max();
+		for( size_t ii = 0; ii < backward.size(); ++ii )
+		{
+			const double distance = std::abs( std::remainder( backward[ii].uv[p] - seam, period ) );
+			if( distance < minDistance )
+			{
+				minDistance = distance;
+				seamIndexBackward = ii;
+			}
+		}
+		const double shift = std::round( ( seam + period - backward[seamIndexBackward].uv[p] ) / period ) * period;
+
+		outer = forward;
+		vec2 forwardEnd = forward[0].uv;
+		forwardEnd[p] += period;
+		vec2 backwardStart = backward[seamIndexBackward].uv;
+		backwardStart[p] += shift;
+		outer.push_back( { forwardEnd, forward[0].point } );
+		addSubdividedLine( surface, forwardEnd, backwardStart, outer );
+		for( size_t kk = 0; kk <= backward.size(); ++kk )
+		{
+			// the backward ring is continuous from its first point, and ends one period before it
+			const size_t idx = seamIndexBackward + kk;
+			SurfaceVertex vertex = backward[idx % backward.size()];
+			vertex.uv[p] += shift - ( idx >= backward.size() ? period : 0.0 );
+			outer.push_back( vertex );
+		}
+		addSubdividedLine( surface, outer.back().uv, forward[0].uv, outer );
+		windowStart[p] = seam;
+	}
+	else
+	{
+		return false;
+	}
+
+	const vec2 centroidOuter = computeCentroid( outer );
+	for( int dim = 0; dim < 2; ++dim )
+	{
+		if( dim != wrapParameter )
+		{
+			windowStart[dim] = centroidOuter[dim] - surface.m_period[dim] * 0.5;
+		}
+	}
+
+	std::vector<SurfaceRing> polygon = { outer };
+	for( size_t ii = 0; ii < rings.size(); ++ii )
+	{
+		if( ii == outerIndex || std::find( wrappingRings.begin(), wrappingRings.end(), ii ) != wrappingRings.end() )
+		{
+			continue;
+		}
+
+		// move holes into the periodic interval of the outer ring
+		SurfaceRing hole = rings[ii];
+		const vec2 centroid = computeCentroid( hole );
+		for( int dim = 0; dim < 2; ++dim )
+		{
+			const double period = surface.m_period[dim];
+			if( period > 0 )
+			{
+				shiftRing( hole, dim, -std::floor( ( centroid[dim] - windowStart[dim] ) / period ) * period );
+			}
+		}
+		polygon.push_back( hole );
+	}
+
+	return triangulateRings( surface, polygon, sameSense, meshOut, eps );
+}
+
+void SurfaceTessellator::triangulatePatch( const AnalyticSurface& surface, double u1, double u2, double v1, double v2, bool sameSense, PolyInputCache3D& meshOut, double eps )
+{
+	const vec2 corners[4] = { carve::geom::VECTOR( u1, v1 ), carve::geom::VECTOR( u2, v1 ), carve::geom::VECTOR( u2, v2 ), carve::geom::VECTOR( u1, v2 ) };
+	SurfaceRing ring;
+	for( int ii = 0; ii < 4; ++ii )
+	{
+		const vec2& corner = corners[ii];
+		ring.push_back( { corner, surface.evaluate( corner.x, corner.y ) } );
+		addSubdividedLine( surface, corner, corners[( ii + 1 ) % 4], ring );
+	}
+	triangulateRings( surface, { ring }, sameSense, meshOut, eps );
+}
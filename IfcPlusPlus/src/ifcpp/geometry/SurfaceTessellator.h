@@ -0,0 +1,97 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <vector>
+#include <ifcpp/model/GlobalDefines.h>
+#include "IncludeCarveHeaders.h"
+
+class GeometrySettings;
+class PolyInputCache3D;
+
+//\brief Curved surface in the (u,v) parametrisation of ISO 10303-42
+///@details Cylinder: u = angle, v = height. Sphere: u = longitude, v = latitude in [-pi/2, pi/2]. Torus: u = angle around the axis, v = angle around the
+///tube. Surface of revolution: u = arc length along the swept curve, v = rotation angle. Surface of linear extrusion: u = arc length along the swept curve,
+///v = extrusion distance. All geometry is in the coordinate system m_position.
+class IFCQUERY_EXPORT AnalyticSurface
+{
+public:
+	enum SurfaceType { SURFACE_PLANE, SURFACE_CYLINDER, SURFACE_SPHERE, SURFACE_TORUS, SURFACE_REVOLUTION, SURFACE_LINEAR_EXTRUSION };
+
+	SurfaceType				m_type = SURFACE_PLANE;
+	carve::math::Matrix		m_position;
+	double					m_radius = 0;			// cylinder, sphere, major radius of torus
+	double					m_minor_radius = 0;		// torus
+
+	// swept curve of surfaces of revolution and linear extrusion, in the xy plane
+	std::vector<vec3>		m_curve_points;
+	bool					m_curve_closed = false;
+	vec3					m_axis_location;		// surface of revolution
+	vec3					m_axis_direction;		// surface of revolution
+	vec3					m_extrusion_direction;	// surface of linear extrusion, not normalized
+
+	//\brief Computes the derived values below. Must be called once the attributes above are set
+	///@return false if the surface is degenerated
+	bool init( GeometrySettings& geomSettings, double eps );
+
+	vec3 evaluate( double u, double v ) const;
+
+	//\brief Parameters of a point on the surface, or close to it
+	///@return false if the point is on a pole, where parameter m_pole_parameter is undefined
+	bool project( const vec3& point, vec2& uv ) const;
+
+	//\brief Unit normal du x dv at a point on the surface, or close to it
+	///@return false on poles and where the surface is degenerated
+	bool computeNormal( const vec3& point, vec3& normal ) const;
+
+	double	m_period[2] = { 0, 0 };			// 0 if the parameter is not periodic
+	double	m_max_step[2] = { 0, 0 };		// parameter difference of adjacent points on boundaries, infinite along straight lines
+	double	m_max_deviation = 0;			// largest distance of mesh edges to the surface
+	double	m_range_min[2] = { 0, 0 };		// parameter range of non-periodic bounded parameters
+	double	m_range_max[2] = { 0, 0 };
+	bool	m_pole_at_min[2] = { false, false };	// the surface collapses to a point at m_range_min
+	bool	m_pole_at_max[2] = { false, false };
+	int		m_pole_parameter = -1;			// parameter that is undefined on poles
+
+protected:
+	vec3 evaluateCurve( double u ) const;
+	double projectToCurve( const vec2& point ) const;
+
+	carve::math::Matrix		m_position_inverse;
+	std::vector<double>		m_curve_lengths;
+	std::vector<vec2>		m_projection_points;	// curve points in the xy plane, or (height on axis, distance to axis) for surfaces of revolution
+	vec3					m_meridian_reference;	// direction from the axis to the swept curve, surface of revolution
+	double					m_eps = 1.e-6;
+};
+
+//\brief Triangulates trimmed patches of analytic surfaces in their parameter space
+///@details Boundary points are mapped to (u,v), unwrapped across the seams of periodic parameters and triangulated there. Interior edges are split until
+///they do not exceed the step sizes of the surface, and new points are evaluated on the surface. Boundary points are used unchanged, so faces that
+///share edge points form a closed mesh.
+class IFCQUERY_EXPORT SurfaceTessellator
+{
+public:
+	//\brief Triangulates a face bounded by closed loops on the surface
+	///@param[in] loops: boundary points without repeated first point. The face is on the left side of each loop, seen against the face normal
+	///@param[in] sameSense: the face normal agrees with the surface normal du x dv
+	///@return false if the loops do not bound a region that can be mapped to the parameter space, for example loops around a torus
+	static bool triangulateFace( const AnalyticSurface& surface, const std::vector<std::vector<vec3> >& loops, bool sameSense, PolyInputCache3D& meshOut, double eps );
+
+	//\brief Triangulates the parameter range [u1,u2] x [v1,v2]
+	static void triangulatePatch( const AnalyticSurface& surface, double u1, double u2, double v1, double v2, bool sameSense, PolyInputCache3D& meshOut, double eps );
+};
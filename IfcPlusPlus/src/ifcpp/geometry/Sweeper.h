@@ -28,6 +28,30 @@ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OU
 class GeometrySettings;
 class UnitConverter;
 
+//\brief Loops and cap triangles of an extruded profile. Independent of the extrusion vector, so it can be shared by all extrusions of the same profile
+struct ExtrusionCapTriangulation
+{
+	struct LoopSet
+	{
+		std::vector<std::vector<array2d> >	m_loops;		// outer loop first, then the holes, oriented as needed for the extrusion
+		std::vector<array2d>				m_pointsFlat;	// points of all loops, in the same order as m_loops
+		std::vector<uint32_t>				m_triangles;	// cap triangles, indexes into m_pointsFlat
+	};
+	std::vector<LoopSet> m_loopSets;
+	bool m_smallLoopDetected = false;
+};
+
+//\brief Loops and cap triangles of a swept profile, one loop set for each group of enclosed loops
+struct SweepCapTriangulation
+{
+	struct LoopSet
+	{
+		std::vector<std::vector<vec2> >	m_loops;			// loops used for triangulation
+		std::vector<int>				m_faceIndexes;		// for each face: number of vertices, followed by vertex indexes
+	};
+	std::vector<LoopSet> m_loopSets;
+};
+
 class Sweeper : public StatusCallback
 {
 public:
@@ -52,18 +76,7 @@ public:
 			return;
 		}
 
-		// loops and indexes
-		//  3----------------------------2
-		//  |                            |
-		//  |   1-------------------2    |3---------2
-		//  |   |                   |    |          |
-		//  |   |                   |    |          |face_loops[2]
-		//  |   0---face_loops[1]---3    |0---------1
-		//  |                            |
-		//  0-------face_loops[0]--------1
-
 		double eps = m_geom_settings->getEpsilonMergePoints();
-		double epsCoplanarAngle = m_geom_settings->getEpsilonCoplanarAngle();
 		if( extrusionVector.length2() < eps*eps*100 )
 		{
 #ifdef _DEBUG
@@ -73,6 +86,28 @@ public:
 			return;
 		}
 
+		ExtrusionCapTriangulation caps;
+		triangulateExtrusionCaps(faceLoopsInput, eps, m_geom_settings->getEpsilonCoplanarAngle(), caps);
+		extrude(caps, extrusionVector, itemData, params);
+	}
+
+	/*\brief Sorts the cross sections of an extrusion into outer loops and holes, and triangulates the front and back cap.
+	  The result does not depend on the extrusion vector, so it can be cached per profile (see ProfileCache)
+	  \param[in] faceLoopsInput Set of cross sections to extrude
+	  \param[out] caps Loops and cap triangles
+	**/
+	static void triangulateExtrusionCaps(const std::vector<std::vector<vec2> >& faceLoopsInput, double eps, double epsCoplanarAngle, ExtrusionCapTriangulation& caps)
+	{
+		// loops and indexes
+		//  3----------------------------2
+		//  |                            |
+		//  |   1-------------------2    |3---------2
+		//  |   |                   |    |          |
+		//  |   |                   |    |          |face_loops[2]
+		//  |   0---face_loops[1]---3    |0---------1
+		//  |                            |
+		//  0-------face_loops[0]--------1
+
 		struct FaceLoop
 		{
 			std::vector<array2d> m_loop;
@@ -242,7 +277,7 @@ public:
 			}
 
 			double loop_area = std::abs(GeomUtils::signedArea(path_loop_2d));
-			double min_loop_area = m_geom_settings->getEpsilonMergePoints();
+			double min_loop_area = eps;
 			if( loop_area < min_loop_area )
 			{
 				warning_small_loop_detected = true;
@@ -294,24 +329,13 @@ public:
 			}
 		}
 
-		if( warning_small_loop_detected )
-		{
-			std::stringstream err;
-			err << "std::abs( signed_area ) < 1.e-10";
-			messageCallback(err.str().c_str(), StatusCallback::MESSAGE_TYPE_MINOR_WARNING, __FUNC__, params.ifc_entity);
-		}
-
-		if( faceLoopsTriangulate.size() == 0 )
-		{
-#ifdef _DEBUG
-			std::cout << "faceLoopsTriangulate.size() == 0" << std::endl;
-#endif
-			return;
-		}
+		caps.m_smallLoopDetected = warning_small_loop_detected;
 
 		for (shared_ptr<FaceLoopSet>& existingLoopSet : faceLoopsTriangulate)
 		{
-			std::vector<std::vector<array2d>> loopsForEarcut;
+			caps.m_loopSets.push_back(ExtrusionCapTriangulation::LoopSet());
+			ExtrusionCapTriangulation::LoopSet& capLoopSet = caps.m_loopSets.back();
+			std::vector<std::vector<array2d> >& loopsForEarcut = capLoopSet.m_loops;
 			for (size_t iiLoop = 0; iiLoop < existingLoopSet->m_faceLoops.size(); ++iiLoop)
 			{
 				shared_ptr<FaceLoop>& existingLoop = existingLoopSet->m_faceLoops[iiLoop];
@@ -331,9 +355,44 @@ public:
 				loopsForEarcut.push_back(loop);
 			}
 
-			std::vector<uint32_t> triangulated = mapbox::earcut<uint32_t>(loopsForEarcut);
-			std::vector<array2d> polygons2dFlatVector;
-			GeomUtils::polygons2flatVec(loopsForEarcut, polygons2dFlatVector);
+			capLoopSet.m_triangles = mapbox::earcut<uint32_t>(loopsForEarcut);
+			GeomUtils::polygons2flatVec(loopsForEarcut, capLoopSet.m_pointsFlat);
+		}
+	}
+
+	/*\brief Extrudes previously triangulated cross sections along a direction
+	  \param[in] caps Loops and cap triangles, see triangulateExtrusionCaps
+	  \param[in] extrusionVector Extrusion vector
+	  \param[out] itemData Container to add result polyhedron
+	**/
+	void extrude(const ExtrusionCapTriangulation& caps, const vec3 extrusionVector, shared_ptr<ItemShapeData>& itemData, GeomProcessingParams& params)
+	{
+		double eps = m_geom_settings->getEpsilonMergePoints();
+		if( extrusionVector.length2() < eps*eps*100 )
+		{
+			return;
+		}
+
+		if( caps.m_smallLoopDetected )
+		{
+			std::stringstream err;
+			err << "std::abs( signed_area ) < 1.e-10";
+			messageCallback(err.str().c_str(), StatusCallback::MESSAGE_TYPE_MINOR_WARNING, __FUNC__, params.ifc_entity);
+		}
+
+		if( caps.m_loopSets.size() == 0 )
+		{
+#ifdef _DEBUG
+			std::cout << "faceLoopsTriangulate.size() == 0" << std::endl;
+#endif
+			return;
+		}
+
+		for( const ExtrusionCapTriangulation::LoopSet& capLoopSet : caps.m_loopSets )
+		{
+			const std::vector<std::vector<array2d> >& loopsForEarcut = capLoopSet.m_loops;
+			const std::vector<uint32_t>& triangulated = capLoopSet.m_triangles;
+			const std::vector<array2d>& polygons2dFlatVector = capLoopSet.m_pointsFlat;
 			size_t numPointsInAllLoops = polygons2dFlatVector.size();
 
 #ifdef _DEBUG
@@ -347,7 +406,7 @@ public:
 					// add points bottom
 					for (size_t ii = 0; ii < polygons2dFlatVector.size(); ++ii)
 					{
-						array2d& point2D = polygons2dFlatVector[ii];
+						const array2d& point2D = polygons2dFlatVector[ii];
 						vec3 point3D = carve::geom::VECTOR(point2D[0], point2D[1], 0);
 						poly_data->addVertex(point3D);
 					}
@@ -381,7 +440,7 @@ public:
 			// add points bottom
 			for (size_t ii = 0; ii < polygons2dFlatVector.size(); ++ii)
 			{
-				array2d& point2D = polygons2dFlatVector[ii];
+				const array2d& point2D = polygons2dFlatVector[ii];
 				vec3 point3D = carve::geom::VECTOR(point2D[0], point2D[1], 0);
 				polyhedronResult->addVertex(point3D);
 			}
@@ -389,7 +448,7 @@ public:
 			// add points top
 			for (size_t ii = 0; ii < polygons2dFlatVector.size(); ++ii)
 			{
-				array2d& point2D = polygons2dFlatVector[ii];
+				const array2d& point2D = polygons2dFlatVector[ii];
 				vec3 point3D = carve::geom::VECTOR(point2D[0], point2D[1], 0);
 				vec3 point3D_top = point3D + extrusionVector;
 				polyhedronResult->addVertex(point3D_top);
@@ -400,7 +459,7 @@ public:
 			size_t idxLoopOffset = 0;
 			for (size_t ii = 0; ii < loopsForEarcut.size(); ++ii)
 			{
-				std::vector<array2d>& loop2D = loopsForEarcut[ii];
+				const std::vector<array2d>& loop2D = loopsForEarcut[ii];
 
 #ifdef _DEBUG
 				glm::dvec3 loopNormal_glm = GeomUtils::computePolygon2DNormal(loop2D, eps);
@@ -434,8 +493,8 @@ public:
 				const size_t numLoopPoints = loop2D.size();
 				for (size_t jj = 0; jj < numLoopPoints; ++jj)
 				{
-					array2d& point2D = loop2D[jj];
-					array2d& point2D_next = loop2D[(jj + 1) % numLoopPoints];
+					const array2d& point2D = loop2D[jj];
+					const array2d& point2D_next = loop2D[(jj + 1) % numLoopPoints];
 
 					vec3 point3D = carve::geom::VECTOR(point2D[0], point2D[1], 0);
 					vec3 point3D_next = carve::geom::VECTOR(point2D_next[0], point2D_next[1], 0);
@@ -1192,6 +1251,18 @@ public:
 		//  |                            |
 		//  0-------face_loops[0]--------1
 
+		SweepCapTriangulation caps;
+		triangulateSweepCaps(profile_paths_input, caps, params.ifc_entity);
+		sweepArea(curvePoints, caps, itemData, params);
+	}
+
+	/*\brief Groups the cross sections of a sweep into enclosed loops, and triangulates the front and back cap of each group.
+	  The result does not depend on the sweep path, so it can be cached per profile (see ProfileCache)
+	  \param[in] profile_paths_input Set of cross sections to sweep
+	  \param[out] caps Loops and cap triangles
+	**/
+	void triangulateSweepCaps(const std::vector<std::vector<vec2> >& profile_paths_input, SweepCapTriangulation& caps, BuildingEntity* ifc_entity)
+	{
 		double eps = m_geom_settings->getEpsilonMergePoints();
 		std::vector<std::vector<std::vector<vec2> > > profile_paths_enclosed;
 		findEnclosedLoops(profile_paths_input, profile_paths_enclosed, eps);
@@ -1199,214 +1270,349 @@ public:
 		for (size_t ii_profile_paths = 0; ii_profile_paths < profile_paths_enclosed.size(); ++ii_profile_paths)
 		{
 			const std::vector<std::vector<vec2> >& profile_paths = profile_paths_enclosed[ii_profile_paths];
+			caps.m_loopSets.push_back(SweepCapTriangulation::LoopSet());
+			SweepCapTriangulation::LoopSet& capLoopSet = caps.m_loopSets.back();
+			triangulateLoops(profile_paths, capLoopSet.m_loops, capLoopSet.m_faceIndexes, ifc_entity);
+		}
+	}
 
-			for (size_t ii = 0; ii < profile_paths.size(); ++ii)
-			{
-				std::vector<int> face_indexes;
-				std::vector<std::vector<vec2> > face_loops_used_for_triangulation;
-				triangulateLoops(profile_paths, face_loops_used_for_triangulation, face_indexes, params.ifc_entity);
+	//\brief Position and orientation of a cross section on the sweep path
+	struct SweepSection
+	{
+		vec3	m_origin;
+		vec3	m_local_x;
+		vec3	m_local_y;
+		vec3	m_miter_direction;		// at turns, the cross section is stretched in this direction, to fit into the bisecting plane
+		double	m_miter_scale = 1.0;
+	};
+
+	/*\brief Computes a cross section for each point of a sweep path. The section planes are normal to the path tangent, which is the normal
+	  of the bisecting plane of adjacent path segments. The local x axis of the cross section is the projection of the section reference onto the
+	  section plane, local y = tangent x local x. Without reference, or where it is parallel to the tangent, the x axis is transported along the
+	  path with rotation minimizing frames: from segment to segment, it is turned by the minimal rotation of the segment direction (double reflection).
+	  So each segment is an untwisted prism between the bisecting planes
+	  \param[in] curvePoints Path without repeated points
+	  \param[in] sectionReferences Empty, one fixed reference direction, or one direction per path point
+	  \param[out] sections Cross section for each path point. If the path is closed, there is no section for the last point, which coincides with the first
+	**/
+	void computeSweepSections(const std::vector<vec3>& curvePoints, const std::vector<vec3>& sectionReferences, std::vector<SweepSection>& sections, GeomProcessingParams& params)
+	{
+		const size_t num_curvePoints = curvePoints.size();
+		sections.clear();
+		if (num_curvePoints < 2)
+		{
+			return;
+		}
 
-				size_t num_points_in_all_loops = 0;
-				for (size_t ii = 0; ii < face_loops_used_for_triangulation.size(); ++ii)
-				{
-					const std::vector<vec2>& loop = face_loops_used_for_triangulation[ii];
-					num_points_in_all_loops += loop.size();
-				}
+		double eps = m_geom_settings->getEpsilonMergePoints();
+		std::vector<vec3> segment_directions(num_curvePoints - 1);
+		for (size_t ii = 0; ii < num_curvePoints - 1; ++ii)
+		{
+			segment_directions[ii] = curvePoints[ii + 1] - curvePoints[ii];
+			segment_directions[ii] /= segment_directions[ii].length();
+		}
 
-				shared_ptr<carve::input::PolyhedronData> poly_data(new carve::input::PolyhedronData());
-				poly_data->points.resize(num_points_in_all_loops * curvePoints.size());
-
-				const vec3& curve_point_first = curvePoints[0];
-				const vec3& curve_point_second = curvePoints[1];
-				const vec3 curve_normal = GeomUtils::computePolygonNormal(curvePoints, eps);
-
-				// rotate face loops into first direction
-				vec3  section_local_y = curve_normal;
-				vec3  section_local_z = curve_point_first - curve_point_second;
-				vec3  section_local_x = carve::geom::cross(section_local_y, section_local_z);
-				section_local_y = carve::geom::cross(section_local_x, section_local_z);
-				section_local_x.normalize();
-				section_local_y.normalize();
-				section_local_z.normalize();
-
-				carve::math::Matrix matrix_first_direction = carve::math::Matrix(
-					section_local_x.x, section_local_y.x, section_local_z.x, 0,
-					section_local_x.y, section_local_y.y, section_local_z.y, 0,
-					section_local_x.z, section_local_y.z, section_local_z.z, 0,
-					0, 0, 0, 1);
-
-				std::vector<vec3>& polyhedron_points = poly_data->points;
-				size_t polyhedron_point_index = 0;
-				for (size_t ii = 0; ii < face_loops_used_for_triangulation.size(); ++ii)
-				{
-					const std::vector<vec2>& loop = face_loops_used_for_triangulation[ii];
-					for (size_t jj = 0; jj < loop.size(); ++jj)
-					{
-						const vec2& vec_2d = loop[jj];
-						vec3  vec_3d(carve::geom::VECTOR(vec_2d.x, vec_2d.y, 0));
+		std::vector<vec3> tangents(num_curvePoints);
+		tangents[0] = segment_directions.front();
+		tangents[num_curvePoints - 1] = segment_directions.back();
+		for (size_t ii = 1; ii < num_curvePoints - 1; ++ii)
+		{
+			vec3 tangent = segment_directions[ii - 1] + segment_directions[ii];
+			if (tangent.length2() < 1.e-12)
+			{
+				// path turns back onto itself
+				messageCallback("sweep path turns by 180 degrees", StatusCallback::MESSAGE_TYPE_WARNING, __FUNC__, params.ifc_entity);
+				tangent = segment_directions[ii - 1];
+			}
+			tangents[ii] = tangent / tangent.length();
+		}
 
-						// cross section is defined in XY plane
-						vec_3d = matrix_first_direction * vec_3d + curve_point_first;
-						polyhedron_points[polyhedron_point_index++] = vec_3d;
-					}
-				}
+		// closed path: the end sections are in the bisecting plane of the last and the first segment, so that they coincide
+		const bool closed_path = num_curvePoints > 3 && (curvePoints.front() - curvePoints.back()).length2() <= eps * eps;
+		if (closed_path)
+		{
+			vec3 tangent = segment_directions.back() + segment_directions.front();
+			if (tangent.length2() > 1.e-12)
+			{
+				tangents[0] = tangent / tangent.length();
+				tangents[num_curvePoints - 1] = tangents[0];
+			}
+		}
 
-				for (size_t ii = 1; ii < num_curvePoints; ++ii)
+		auto referenceAxis = [&](size_t ii, vec3& local_x) -> bool
+		{
+			if (sectionReferences.empty())
+			{
+				return false;
+			}
+			const vec3& reference = sectionReferences.size() == num_curvePoints ? sectionReferences[ii] : sectionReferences[0];
+			vec3 projected = reference - tangents[ii] * dot(reference, tangents[ii]);
+			if (projected.length2() < 1.e-12 * reference.length2() || reference.length2() < 1.e-20)
+			{
+				return false;
+			}
+			local_x = projected / projected.length();
+			return true;
+		};
+
+		// first section without reference: local y in direction of the normal of the path
+		vec3 local_x;
+		if (!referenceAxis(0, local_x))
+		{
+			const vec3 curve_normal = GeomUtils::computePolygonNormal(curvePoints, eps);
+			local_x = carve::geom::cross(curve_normal, curvePoints[0] - curvePoints[1]);
+			if (local_x.length2() < 1.e-12 * (curvePoints[0] - curvePoints[1]).length2())
+			{
+				// straight path, or no path normal
+				local_x = carve::geom::cross(carve::geom::VECTOR(0.0, 0.0, 1.0), tangents[0]);
+				if (local_x.length2() < 1.e-6)
 				{
-					vec3 curve_point_current = curvePoints[ii];
-					vec3 curve_point_next;
-					vec3 curve_point_before;
-					if (ii == 0)
-					{
-						// first point
-						curve_point_next = curvePoints[ii + 1];
-						vec3 delta_element = curve_point_next - curve_point_current;
-						curve_point_before = curve_point_current - (delta_element);
-					}
-					else if (ii == num_curvePoints - 1)
-					{
-						// last point
-						curve_point_before = curvePoints[ii - 1];
-						vec3 delta_element = curve_point_current - curve_point_before;
-						curve_point_next = curve_point_before + (delta_element);
-					}
-					else
-					{
-						// inner point
-						curve_point_next = curvePoints[ii + 1];
-						curve_point_before = curvePoints[ii - 1];
-					}
+					local_x = carve::geom::cross(carve::geom::VECTOR(0.0, 1.0, 0.0), tangents[0]);
+				}
+			}
+			local_x /= local_x.length();
+		}
 
-					vec3 bisecting_normal;
-					GeomUtils::bisectingPlane(curve_point_before, curve_point_current, curve_point_next, bisecting_normal, eps);
+		// double reflection: minimal rotation of a vector, that turns the unit direction 'from' into 'to'
+		auto rotateMinimal = [](const vec3& v, const vec3& from, const vec3& to) -> vec3
+		{
+			const vec3 bisector = from + to;
+			const double c1 = dot(bisector, bisector);
+			if (c1 < 1.e-20)
+			{
+				return v;
+			}
+			const vec3 reflected = v - bisector * (2.0 / c1 * dot(bisector, v));
+			return reflected - to * (2.0 * dot(to, reflected));
+		};
 
-					vec3 section1 = curve_point_current - curve_point_before;
-					section1.normalize();
-					if (ii == num_curvePoints - 1)
-					{
-						bisecting_normal *= -1.0;
-					}
+		// x axis of the segment before the current point, then of the segment after it
+		vec3 segment_x = local_x;
+		sections.resize(num_curvePoints);
+		for (size_t ii = 0; ii < num_curvePoints; ++ii)
+		{
+			const vec3& tangent = tangents[ii];
+			const vec3& segment_direction_before = ii > 0 ? segment_directions[ii - 1] : segment_directions.front();
+			const vec3& segment_direction_after = ii < num_curvePoints - 1 ? segment_directions[ii] : segment_directions.back();
+			if (referenceAxis(ii, local_x))
+			{
+				segment_x = rotateMinimal(local_x, tangent, segment_direction_before);
+			}
+			else
+			{
+				local_x = rotateMinimal(segment_x, segment_direction_before, tangent);
+			}
+			segment_x = rotateMinimal(segment_x, segment_direction_before, segment_direction_after);
+
+			// remove accumulated numerical drift
+			local_x = local_x - tangent * dot(local_x, tangent);
+			local_x /= local_x.length();
+			segment_x = segment_x - segment_direction_after * dot(segment_x, segment_direction_after);
+			segment_x /= segment_x.length();
+
+			SweepSection& section = sections[ii];
+			section.m_origin = curvePoints[ii];
+			section.m_local_x = local_x;
+			section.m_local_y = carve::geom::cross(tangent, local_x);
+
+			// the incoming segment hits the bisecting plane at an angle. Cross sections normal to the segment are stretched in the plane of the turn
+			const vec3& segment_direction = ii > 0 ? segment_directions[ii - 1] : (closed_path ? segment_directions.back() : segment_directions.front());
+			const double cos_half_turn = dot(segment_direction, tangent);
+			vec3 miter_direction = segment_direction - tangent * cos_half_turn;
+			section.m_miter_direction = carve::geom::VECTOR(0.0, 0.0, 0.0);
+			if (miter_direction.length2() > 1.e-20 && cos_half_turn > 1.e-6)
+			{
+				section.m_miter_direction = miter_direction / miter_direction.length();
+				section.m_miter_scale = 1.0 / cos_half_turn;
+			}
+		}
 
-					carve::geom::plane<3> bisecting_plane(bisecting_normal, curve_point_current);
-					for (size_t jj = 0; jj < num_points_in_all_loops; ++jj)
-					{
-						vec3& section_point_3d = polyhedron_points[polyhedron_point_index];
-						vec3& previous_section_point_3d = polyhedron_points[polyhedron_point_index - num_points_in_all_loops];
+		if (closed_path)
+		{
+			sections.pop_back();
+		}
+	}
 
-						polyhedron_point_index++;
+	/*\brief Sweeps previously triangulated cross sections along a path. At turns, the points are placed in the bisecting plane
+	  \param[in] curvePoints Path along which the cross section is swept
+	  \param[in] caps Loops and cap triangles, see triangulateSweepCaps
+	  \param[out] itemData Container to add result polyhedron
+	  \param[in] sectionReferences Direction of the local x axis of the cross section, see computeSweepSections: empty for rotation minimizing frames,
+	  one fixed reference direction, or one direction per curve point, for example the normal of a reference surface
+	**/
+	void sweepArea(const std::vector<vec3>& curvePointsInput, const SweepCapTriangulation& caps, shared_ptr<ItemShapeData>& itemData, GeomProcessingParams& params,
+		const std::vector<vec3>& sectionReferencesInput = std::vector<vec3>())
+	{
+		double eps = m_geom_settings->getEpsilonMergePoints();
+		const bool referencePerPoint = sectionReferencesInput.size() > 1 && sectionReferencesInput.size() == curvePointsInput.size();
+		std::vector<vec3> curvePoints;
+		std::vector<vec3> sectionReferences;
+		if (!referencePerPoint && sectionReferencesInput.size() > 0)
+		{
+			sectionReferences.push_back(sectionReferencesInput[0]);
+		}
+		for (size_t ii = 0; ii < curvePointsInput.size(); ++ii)
+		{
+			if (curvePoints.size() > 0 && (curvePointsInput[ii] - curvePoints.back()).length2() <= eps * eps)
+			{
+				continue;
+			}
+			curvePoints.push_back(curvePointsInput[ii]);
+			if (referencePerPoint)
+			{
+				sectionReferences.push_back(sectionReferencesInput[ii]);
+			}
+		}
 
-						vec3 v;
-						double t;
-						carve::IntersectionClass intersect = carve::geom3d::rayPlaneIntersection(bisecting_plane, previous_section_point_3d, previous_section_point_3d + section1, v, t, eps);
-						if (intersect > 0)
-						{
-							section_point_3d = v;
-						}
-						else
-						{
-							messageCallback("no intersection found", StatusCallback::MESSAGE_TYPE_WARNING, __FUNC__, params.ifc_entity);
-						}
-					}
-				}
+		const size_t num_curvePoints = curvePoints.size();
+		if (num_curvePoints < 2)
+		{
+			messageCallback("num curve points < 2", StatusCallback::MESSAGE_TYPE_WARNING, __FUNC__, params.ifc_entity);
+			return;
+		}
 
-				// add face loops for all sections
-				const size_t num_poly_points = polyhedron_points.size();
-				size_t loop_offset = 0;
-				for (size_t ii = 0; ii < face_loops_used_for_triangulation.size(); ++ii)
-				{
-					const std::vector<vec2>& loop = face_loops_used_for_triangulation[ii];
+		std::vector<SweepSection> sections;
+		computeSweepSections(curvePoints, sectionReferences, sections, params);
+		const size_t num_sections = sections.size();
+		const bool closed_path = num_sections < num_curvePoints;
 
-					for (size_t jj = 0; jj < loop.size(); ++jj)
-					{
-						for (size_t kk = 0; kk < num_curvePoints - 1; ++kk)
-						{
-							size_t tri_idx_a = num_points_in_all_loops * kk + jj + loop_offset;
+		for (const SweepCapTriangulation::LoopSet& capLoopSet : caps.m_loopSets)
+		{
+			// a closed path results in a ring without caps
+			const std::vector<int> no_face_indexes;
+			const std::vector<int>& face_indexes = closed_path ? no_face_indexes : capLoopSet.m_faceIndexes;
+			const std::vector<std::vector<vec2> >& face_loops_used_for_triangulation = capLoopSet.m_loops;
 
-							size_t tri_idx_next = tri_idx_a + 1;
-							if (jj == loop.size() - 1)
-							{
-								tri_idx_next -= loop.size();
-							}
-							size_t tri_idx_up = tri_idx_a + num_points_in_all_loops;  // next section
-							size_t tri_idx_next_up = tri_idx_next + num_points_in_all_loops;  // next section
+			std::vector<vec2> points_in_all_loops;
+			for (size_t ii = 0; ii < face_loops_used_for_triangulation.size(); ++ii)
+			{
+				const std::vector<vec2>& loop = face_loops_used_for_triangulation[ii];
+				std::copy(loop.begin(), loop.end(), std::back_inserter(points_in_all_loops));
+			}
+			const size_t num_points_in_all_loops = points_in_all_loops.size();
 
+			shared_ptr<carve::input::PolyhedronData> poly_data(new carve::input::PolyhedronData());
+			poly_data->points.resize(num_points_in_all_loops * num_sections);
+			std::vector<vec3>& polyhedron_points = poly_data->points;
 
-							if (tri_idx_a >= num_poly_points || tri_idx_next >= num_poly_points || tri_idx_up >= num_poly_points || tri_idx_next_up >= num_poly_points)
-							{
-								messageCallback("invalid triangle index", StatusCallback::MESSAGE_TYPE_WARNING, __FUNC__, params.ifc_entity);
-								continue;
-							}
+			// cross sections are independent of each other
+			auto placeSection = [&](const SweepSection& section)
+			{
+				size_t polyhedron_point_index = (&section - sections.data()) * num_points_in_all_loops;
+				for (const vec2& vec_2d : points_in_all_loops)
+				{
+					// cross section is defined in XY plane
+					vec3 offset = section.m_local_x * vec_2d.x + section.m_local_y * vec_2d.y;
+					offset += section.m_miter_direction * (dot(section.m_miter_direction, offset) * (section.m_miter_scale - 1.0));
+					polyhedron_points[polyhedron_point_index++] = section.m_origin + offset;
+				}
+			};
 
-							poly_data->addFace(tri_idx_a, tri_idx_next, tri_idx_next_up);
-							poly_data->addFace(tri_idx_next_up, tri_idx_up, tri_idx_a);
-						}
-					}
+			if (polyhedron_points.size() > 20000)
+			{
+				FOR_EACH_LOOP sections.begin(), sections.end(), placeSection);
+			}
+			else
+			{
+				std::for_each(sections.begin(), sections.end(), placeSection);
+			}
 
-					loop_offset += loop.size();
-				}
+			// add face loops for all sections
+			const size_t num_poly_points = polyhedron_points.size();
+			size_t loop_offset = 0;
+			for (size_t ii = 0; ii < face_loops_used_for_triangulation.size(); ++ii)
+			{
+				const std::vector<vec2>& loop = face_loops_used_for_triangulation[ii];
 
-				// add front and back cap
-				for (size_t ii = 0; ii < face_indexes.size(); ++ii)
+				for (size_t jj = 0; jj < loop.size(); ++jj)
 				{
-					size_t num_face_vertices = face_indexes[ii];
-
-					if (num_face_vertices == 3)
+					for (size_t kk = 0; kk < num_curvePoints - 1; ++kk)
 					{
-						size_t tri_idx_a = face_indexes[ii + 1];
-						size_t tri_idx_b = face_indexes[ii + 2];
-						size_t tri_idx_c = face_indexes[ii + 3];
-						if (tri_idx_a >= num_poly_points || tri_idx_b >= num_poly_points || tri_idx_c >= num_poly_points)
-						{
-							messageCallback("invalid triangle index", StatusCallback::MESSAGE_TYPE_WARNING, __FUNC__, params.ifc_entity);
-							ii += num_face_vertices;
-							continue;
-						}
+						const size_t jj_next = jj == loop.size() - 1 ? 0 : jj + 1;
+						const size_t section_begin = num_points_in_all_loops * kk + loop_offset;
+						const size_t next_section_begin = num_points_in_all_loops * ((kk + 1) % num_sections) + loop_offset;  // first section again at the end of closed paths
 
-						poly_data->addFace(tri_idx_a, tri_idx_c, tri_idx_b);
+						size_t tri_idx_a = section_begin + jj;
+						size_t tri_idx_next = section_begin + jj_next;
+						size_t tri_idx_up = next_section_begin + jj;  // next section
+						size_t tri_idx_next_up = next_section_begin + jj_next;  // next section
 
-						size_t tri_idx_a_back_cap = tri_idx_a + num_poly_points - num_points_in_all_loops;
-						size_t tri_idx_b_back_cap = tri_idx_b + num_poly_points - num_points_in_all_loops;
-						size_t tri_idx_c_back_cap = tri_idx_c + num_poly_points - num_points_in_all_loops;
-						if (tri_idx_a_back_cap >= num_poly_points || tri_idx_b_back_cap >= num_poly_points || tri_idx_c_back_cap >= num_poly_points)
+
+						if (tri_idx_a >= num_poly_points || tri_idx_next >= num_poly_points || tri_idx_up >= num_poly_points || tri_idx_next_up >= num_poly_points)
 						{
 							messageCallback("invalid triangle index", StatusCallback::MESSAGE_TYPE_WARNING, __FUNC__, params.ifc_entity);
-							ii += num_face_vertices;
 							continue;
 						}
 
-						poly_data->addFace(tri_idx_a_back_cap, tri_idx_b_back_cap, tri_idx_c_back_cap);
-					}
-					else if (num_face_vertices == 2)
-					{
-						// add polyline
-						//poly_data->addFace( face_indexes[ii+1], face_indexes[ii+2] );
+						poly_data->addFace(tri_idx_a, tri_idx_next, tri_idx_next_up);
+						poly_data->addFace(tri_idx_next_up, tri_idx_up, tri_idx_a);
 					}
-					else if (num_face_vertices == 1)
+				}
+
+				loop_offset += loop.size();
+			}
+
+			// add front and back cap
+			for (size_t ii = 0; ii < face_indexes.size(); ++ii)
+			{
+				size_t num_face_vertices = face_indexes[ii];
+
+				if (num_face_vertices == 3)
+				{
+					size_t tri_idx_a = face_indexes[ii + 1];
+					size_t tri_idx_b = face_indexes[ii + 2];
+					size_t tri_idx_c = face_indexes[ii + 3];
+					if (tri_idx_a >= num_poly_points || tri_idx_b >= num_poly_points || tri_idx_c >= num_poly_points)
 					{
-						// add polyline
-						//poly_data->addFace( face_indexes[ii+1], face_indexes[ii+2] );
+						messageCallback("invalid triangle index", StatusCallback::MESSAGE_TYPE_WARNING, __FUNC__, params.ifc_entity);
+						ii += num_face_vertices;
+						continue;
 					}
-					else
+
+					poly_data->addFace(tri_idx_a, tri_idx_c, tri_idx_b);
+
+					size_t tri_idx_a_back_cap = tri_idx_a + num_poly_points - num_points_in_all_loops;
+					size_t tri_idx_b_back_cap = tri_idx_b + num_poly_points - num_points_in_all_loops;
+					size_t tri_idx_c_back_cap = tri_idx_c + num_poly_points - num_points_in_all_loops;
+					if (tri_idx_a_back_cap >= num_poly_points || tri_idx_b_back_cap >= num_poly_points || tri_idx_c_back_cap >= num_poly_points)
 					{
-						messageCallback("num_face_vertices != 3", StatusCallback::MESSAGE_TYPE_WARNING, __FUNC__, params.ifc_entity);
+						messageCallback("invalid triangle index", StatusCallback::MESSAGE_TYPE_WARNING, __FUNC__, params.ifc_entity);
+						ii += num_face_vertices;
+						continue;
 					}
-					ii += num_face_vertices;
-				}
 
-				try
+					poly_data->addFace(tri_idx_a_back_cap, tri_idx_b_back_cap, tri_idx_c_back_cap);
+				}
+				else if (num_face_vertices == 2)
 				{
-					itemData->addClosedPolyhedron(poly_data, params);
+					// add polyline
+					//poly_data->addFace( face_indexes[ii+1], face_indexes[ii+2] );
 				}
-				catch (BuildingException & exception)
+				else if (num_face_vertices == 1)
 				{
-					messageCallback(exception.what(), StatusCallback::MESSAGE_TYPE_WARNING, "", params.ifc_entity);  // calling function already in e.what()
+					// add polyline
+					//poly_data->addFace( face_indexes[ii+1], face_indexes[ii+2] );
+				}
+				else
+				{
+					messageCallback("num_face_vertices != 3", StatusCallback::MESSAGE_TYPE_WARNING, __FUNC__, params.ifc_entity);
+				}
+				ii += num_face_vertices;
+			}
+
+			try
+			{
+				itemData->addClosedPolyhedron(poly_data, params);
+			}
+			catch (BuildingException & exception)
+			{
+				messageCallback(exception.what(), StatusCallback::MESSAGE_TYPE_WARNING, "", params.ifc_entity);  // calling function already in e.what()
 #ifdef _DEBUG
-					vec4 color(0.7, 0.7, 0.7, 1.0);
-					shared_ptr<carve::mesh::MeshSet<3> > meshset(poly_data->createMesh(carve::input::opts(), eps));
-					bool drawNormals = true;
-					GeomDebugDump::dumpMeshset(meshset, color, drawNormals, true);
+				vec4 color(0.7, 0.7, 0.7, 1.0);
+				shared_ptr<carve::mesh::MeshSet<3> > meshset(poly_data->createMesh(carve::input::opts(), eps));
+				bool drawNormals = true;
+				GeomDebugDump::dumpMeshset(meshset, color, drawNormals, true);
 #endif
-				}
 			}
 		}
 	}
@@ -155,7 +155,125 @@ std::string decompressGUID(const std::string& in)
 ///instead of uppercase letters and uses '_' and '$' as last two characters.
 std::string createBase64Uuid()
 {
-	std::string guid_uncompressed = createGUID32();
-	std::string guid_compressed = compressGUID(guid_uncompressed);
-	return guid_compressed;
+	static thread_local GuidGenerator generator;
+	return generator.createBase64Uuid();
+}
+
+bool BinaryGuid::fromBase64(const std::string& ifc_guid)
+{
+	if (ifc_guid.size() != 22)
+	{
+		return false;
+	}
+
+	// first character holds the two highest bits, each following character 6 bits
+	uint64_t high = 0;
+	uint64_t low = 0;
+	for (size_t ii = 0; ii < 22; ++ii)
+	{
+		const unsigned char c = (unsigned char)ifc_guid[ii];
+		if (c >= sizeof(base64mask))
+		{
+			return false;
+		}
+		const char value = base64mask[c];
+		if (value < 0 || (ii == 0 && value > 3))
+		{
+			return false;
+		}
+		high = (high << 6) | (low >> 58);
+		low = (low << 6) | (uint64_t)value;
+	}
+	m_high = high;
+	m_low = low;
+	return true;
+}
+
+void BinaryGuid::fromString(const std::string& ifc_guid)
+{
+	if (fromBase64(ifc_guid))
+	{
+		return;
+	}
+
+	// FNV-1a with two different offsets
+	uint64_t high = 0xcbf29ce484222325ull;
+	uint64_t low = 0x84222325cbf29ce4ull;
+	for (const char c : ifc_guid)
+	{
+		high = (high ^ (unsigned char)c) * 0x100000001b3ull;
+		low = (low ^ (unsigned char)c) * 0x100000001b3ull;
+	}
+	m_high = high;
+	m_low = low;
+}
+
+std::string BinaryGuid::toBase64() const
+{
+	static constexpr std::array<char, 64> base64Chars = {
+		'0','1','2','3','4','5','6','7','8','9',
+		'A','B','C','D','E','F','G','H','I','J','K','L','M','N','O','P','Q','R','S','T','U','V','W','X','Y','Z',
+		'a','b','c','d','e','f','g','h','i','j','k','l','m','n','o','p','q','r','s','t','u','v','w','x','y','z',
+		'_','$'
+	};
+
+	std::string result(22, '0');
+	uint64_t high = m_high;
+	uint64_t low = m_low;
+	for (size_t ii = 21; ii > 0; --ii)
+	{
+		result[ii] = base64Chars[low & 63];
+		low = (low >> 6) | (high << 58);
+		high >>= 6;
+	}
+	result[0] = base64Chars[low & 3];
+	return result;
+}
+
+GuidGenerator::GuidGenerator()
+{
+	std::random_device rd;
+	seed((uint64_t(rd()) << 32) ^ uint64_t(rd()));
+}
+
+GuidGenerator::GuidGenerator(uint64_t seed_value)
+{
+	seed(seed_value);
+}
+
+void GuidGenerator::seed(uint64_t seed_value)
+{
+	// splitmix64, to spread the bits of the seed over the whole state
+	for (uint64_t& state : m_state)
+	{
+		seed_value += 0x9E3779B97F4A7C15ull;
+		uint64_t z = seed_value;
+		z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+		z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+		state = z ^ (z >> 31);
+	}
+}
+
+uint64_t GuidGenerator::next()
+{
+	// xoshiro256**
+	auto rotl = [](uint64_t x, int k) { return (x << k) | (x >> (64 - k)); };
+	const uint64_t result = rotl(m_state[1] * 5, 7) * 9;
+	const uint64_t t = m_state[1] << 17;
+	m_state[2] ^= m_state[0];
+	m_state[3] ^= m_state[1];
+	m_state[1] ^= m_state[2];
+	m_state[0] ^= m_state[3];
+	m_state[2] ^= t;
+	m_state[3] = rotl(m_state[3], 45);
+	return result;
+}
+
+BinaryGuid GuidGenerator::createBinaryGuid()
+{
+	// same layout as createGUID32: version 4 in the 13th hex digit, variant 10 in the highest bits of the 17th hex digit
+	BinaryGuid guid;
+	guid.m_high = (next() & ~0xF000ull) | 0x4000ull;
+	guid.m_low = (next() & 0x3FFFFFFFFFFFFFFFull) | 0x8000000000000000ull;
+	return guid;
 }
@@ -17,6 +17,8 @@ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OU
 
 #pragma once
 
+#include <cstdint>
+#include <functional>
 #include <string>
 #include "GlobalDefines.h"
 
@@ -39,4 +41,71 @@ IFCQUERY_EXPORT std::string decompressGUID(const std::string& in);
 ///@details Use desired character type as template parameter - char or wchar_t.
 ///IFC uses a different base64 character set than RFC4648 - it starts with digits
 ///instead of uppercase letters and uses '_' and '$' as last two characters.
-IFCQUERY_EXPORT std::string createBase64Uuid();
\ No newline at end of file
+IFCQUERY_EXPORT std::string createBase64Uuid();
+
+///@brief IFC GUID as 128 bit value, to be used as key in maps and sets instead of the 22 character string
+///@details Comparing and hashing two 64 bit integers is much cheaper than doing the same with strings, and it needs 16 bytes instead of a heap allocated string.
+///The bits are stored in the same order as in the uncompressed GUID, so sorting by BinaryGuid gives the same order as sorting the 36 character GUID strings.
+class IFCQUERY_EXPORT BinaryGuid
+{
+public:
+	uint64_t m_high = 0;
+	uint64_t m_low = 0;
+
+	BinaryGuid() = default;
+
+	///@brief Same as fromString
+	explicit BinaryGuid(const std::string& ifc_guid) { fromString(ifc_guid); }
+
+	///@brief Decodes an IFC GUID string with 22 characters, for example "3n0m0Cc6L4xhvkpCU0k1GZ"
+	///@returns false if the string is not a valid IFC GUID. In that case, the value is not changed
+	bool fromBase64(const std::string& ifc_guid);
+
+	///@brief Decodes an IFC GUID string. Strings that are not valid IFC GUIDs (empty, wrong length, invalid characters, or made unique by appending "_1" etc) are hashed into 128 bits, so that they can still be used as key
+	void fromString(const std::string& ifc_guid);
+
+	///@returns IFC GUID string with 22 characters. Only meaningful if the value was created from a valid IFC GUID
+	std::string toBase64() const;
+
+	bool operator==(const BinaryGuid& other) const { return m_high == other.m_high && m_low == other.m_low; }
+	bool operator!=(const BinaryGuid& other) const { return !(*this == other); }
+	bool operator<(const BinaryGuid& other) const { return m_high != other.m_high ? m_high < other.m_high : m_low < other.m_low; }
+
+	size_t hash() const
+	{
+		// GUID bits are random already, so mixing both halves is enough
+		return (size_t)(m_high ^ (m_low * 0x9E3779B97F4A7C15ull));
+	}
+};
+
+///@brief Creates random (version 4) GUIDs with xoshiro256**, for creating many entities at once
+///@details createGUID32 sets up a new std::mt19937 from std::random_device and formats through a stringstream for each GUID. This generator is seeded once
+///and produces the 122 random bits of a GUID with two 64 bit steps. It is not thread safe, use one generator per thread.
+class IFCQUERY_EXPORT GuidGenerator
+{
+public:
+	///@brief Seeds the generator from std::random_device
+	GuidGenerator();
+
+	///@brief Seeds the generator with a fixed value, so that the same sequence of GUIDs is created each time, for example in tests
+	explicit GuidGenerator(uint64_t seed);
+
+	BinaryGuid createBinaryGuid();
+
+	///@returns IFC GUID string with 22 characters, for example "3n0m0Cc6L4xhvkpCU0k1GZ"
+	std::string createBase64Uuid() { return createBinaryGuid().toBase64(); }
+
+private:
+	void seed(uint64_t seed);
+	uint64_t next();
+
+	uint64_t m_state[4];
+};
+
+namespace std
+{
+	template<> struct hash<BinaryGuid>
+	{
+		size_t operator()(const BinaryGuid& guid) const noexcept { return guid.hash(); }
+	};
+}
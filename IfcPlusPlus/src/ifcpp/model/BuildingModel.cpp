@@ -16,6 +16,7 @@ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OU
 */
 
 #pragma warning( disable: 4996 )
+#include <algorithm>
 #include <iostream>
 #include <ctime>
 #include <memory>
@@ -57,6 +58,7 @@ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OU
 #include "IfcUnitEnum.h"
 #include "IfcValue.h"
 #include "ifcpp/IFC4X3/EntityFactory.h"
+#include "ifcpp/IFC4X3/EntityReferences.h"
 #include "ifcpp/reader/ReaderUtil.h"
 #include "ifcpp/writer/WriterUtil.h"
 
@@ -64,6 +66,7 @@ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OU
 #include "BuildingGuid.h"
 #include "BuildingException.h"
 #include "BuildingModel.h"
+#include "StringPool.h"
 #include "UnitConverter.h"
 
 using namespace IFC4X3;
@@ -284,6 +287,14 @@ void BuildingModel::setUnitConverter( shared_ptr<UnitConverter>& uc )
 	m_unit_converter = uc;
 }
 
+static void raiseToAtLeast( std::atomic<int>& value, int candidate )
+{
+	int current = value;
+	while( candidate > current && !value.compare_exchange_weak( current, candidate ) )
+	{
+	}
+}
+
 void BuildingModel::setMapIfcEntities( const std::unordered_map<int, shared_ptr<BuildingEntity> >& map )
 {
 	clearIfcModel();
@@ -336,6 +347,43 @@ void BuildingModel::insertEntity( shared_ptr<BuildingEntity> e, bool overwrite_e
 	}
 }
 
+void BuildingModel::insertEntities( const std::vector<shared_ptr<BuildingEntity> >& entities, bool overwrite_existing, bool warn_on_existing_entities )
+{
+	m_map_entities.reserve( m_map_entities.size() + entities.size() );
+	int max_tag = m_max_entity_id;
+	for( const shared_ptr<BuildingEntity>& e : entities )
+	{
+		if( !e )
+		{
+			continue;
+		}
+		if( e->m_tag <= 0 )
+		{
+			e->m_tag = reserveEntityTags( 1 );
+		}
+		if( e->m_tag > max_tag )
+		{
+			max_tag = e->m_tag;
+		}
+
+		auto result = m_map_entities.insert( { e->m_tag, e } );
+		if( !result.second )
+		{
+			// key already exists
+			if( overwrite_existing )
+			{
+				result.first->second = e;
+			}
+			else if( warn_on_existing_entities )
+			{
+				messageCallback( "Entity already in model", StatusCallback::MESSAGE_TYPE_WARNING, __FUNC__, e.get() );
+			}
+		}
+	}
+
+	raiseToAtLeast( m_max_entity_id, max_tag );
+}
+
 void BuildingModel::removeEntity( shared_ptr<BuildingEntity> e )
 {
 	if( !e )
@@ -384,7 +432,8 @@ void BuildingModel::removeEntity( shared_ptr<BuildingEntity> e )
 		}
 
 		if (entity_found->m_tag == m_max_entity_id) {
-			if (m_max_entity_id > 0) {
+			// tags that are reserved for entities that are not inserted yet must not be given out again
+			if (m_max_entity_id > 0 && m_max_entity_id > m_max_reserved_entity_id) {
 				--m_max_entity_id;
 			}
 		}
@@ -404,7 +453,7 @@ void BuildingModel::removeEntity( int tag )
 
 int BuildingModel::getNextUnusedEntityTagFast()
 {
-	if( m_map_entities.empty() )
+	if( m_map_entities.empty() && m_max_entity_id < 1 )
 	{
 		m_max_entity_id = 1;
 		return 1;
@@ -427,6 +476,7 @@ int BuildingModel::getNextUnusedEntityTagFast()
 			}
 		}
 
+		raiseToAtLeast(m_max_entity_id, m_max_reserved_entity_id);
 		next_unused_id = m_max_entity_id + 1;
 		if (m_map_entities.find(next_unused_id) != m_map_entities.end())
 		{
@@ -438,14 +488,31 @@ int BuildingModel::getNextUnusedEntityTagFast()
 	return next_unused_id;
 }
 
+int BuildingModel::reserveEntityTags( size_t count )
+{
+	int current_max = m_max_entity_id;
+	if( count == 0 )
+	{
+		return current_max > 0 ? current_max + 1 : 1;
+	}
+
+	int first_tag = 1;
+	do
+	{
+		first_tag = current_max > 0 ? current_max + 1 : 1;
+	} while( !m_max_entity_id.compare_exchange_weak( current_max, first_tag + (int)count - 1 ) );
+	raiseToAtLeast( m_max_reserved_entity_id, first_tag + (int)count - 1 );
+	return first_tag;
+}
+
 int BuildingModel::getLowestUnusedEntityTagSlow()
 {
-	if (m_map_entities.empty())
+	if (m_map_entities.empty() && m_max_reserved_entity_id < 1)
 	{
 		return 1;
 	}
 
-	m_max_entity_id = 1;
+	m_max_entity_id = std::max(1, m_max_reserved_entity_id.load());
 	for (auto it = m_map_entities.begin(); it != m_map_entities.end(); ++it)
 	{
 		int tag = it->first;
@@ -591,6 +658,7 @@ void BuildingModel::clearIfcModel()
 {
 	m_map_entities.clear();
 	m_max_entity_id = -1;
+	m_max_reserved_entity_id = -1;
 	m_ifc_project.reset();
 	m_geom_context_3d.reset();
 	m_ifc_schema_version_current = IFC4X1;
@@ -599,6 +667,22 @@ void BuildingModel::clearIfcModel()
 	m_IFC_FILE_DESCRIPTION = "";
 	m_file_header = "";
 	m_unit_converter->resetUnitFactors();
+	if( m_string_pool )
+	{
+		m_string_pool->clear();
+	}
+}
+
+void BuildingModel::setStringPoolEnabled(bool enabled)
+{
+	if( !enabled )
+	{
+		m_string_pool.reset();
+	}
+	else if( !m_string_pool )
+	{
+		m_string_pool = std::make_shared<StringPool>();
+	}
 }
 
 void BuildingModel::resetIfcModel()
@@ -706,92 +790,151 @@ void BuildingModel::unsetInverseAttributes()
 	}
 }
 
-void BuildingModel::collectDependentEntities( shared_ptr<BuildingObject> obj, std::unordered_map<BuildingObject*, shared_ptr<BuildingObject> >& target_map, bool resolveInverseAttributes)
+// pushes all entities in attribute that are not yet in target_map, also entities in nested lists
+template<typename TargetMap>
+static void pushUnvisitedEntities( const shared_ptr<BuildingObject>& attribute, TargetMap& target_map, std::vector<shared_ptr<BuildingEntity> >& stack )
 {
-	if( !obj )
+	if( !attribute )
 	{
 		return;
 	}
-	if( target_map.find( obj.get() ) != target_map.end() )
+
+	static const uint32_t attribute_object_vector_class_id = AttributeObjectVector().classID();
+	if( attribute->classID() == attribute_object_vector_class_id )
 	{
-		//return;
+		const AttributeObjectVector* attribute_object_vector = static_cast<const AttributeObjectVector*>( attribute.get() );
+		for( const shared_ptr<BuildingObject>& attribute_object : attribute_object_vector->m_vec )
+		{
+			pushUnvisitedEntities( attribute_object, target_map, stack );
+		}
+		return;
 	}
 
-	target_map[obj.get()] = obj;
+	shared_ptr<BuildingEntity> attribute_entity = dynamic_pointer_cast<BuildingEntity>( attribute );
+	if( attribute_entity )
+	{
+		if( target_map.insert( { attribute_entity.get(), attribute_entity } ).second )
+		{
+			stack.push_back( attribute_entity );
+		}
+	}
+}
 
-	shared_ptr<BuildingEntity> entity = dynamic_pointer_cast<BuildingEntity>( obj );
+// adds the referenced entities that are not yet in target_map to target_map and to the stack
+template<typename TargetMap>
+class UnvisitedEntityCollector : public IFC4X3::EntityReferenceVisitor
+{
+public:
+	UnvisitedEntityCollector( TargetMap& target_map, std::vector<shared_ptr<BuildingEntity> >& stack ) : m_target_map( target_map ), m_stack( stack )
+	{
+	}
+
+	bool visitReference( BuildingEntity* entity ) override
+	{
+		return m_target_map.find( entity ) == m_target_map.end();
+	}
+
+	void keepReference( const shared_ptr<BuildingEntity>& entity ) override
+	{
+		m_target_map.insert( { entity.get(), entity } );
+		m_stack.push_back( entity );
+	}
+
+private:
+	TargetMap& m_target_map;
+	std::vector<shared_ptr<BuildingEntity> >& m_stack;
+};
 
-	if( entity )
+template<typename TargetMap>
+static void collectDependentEntitiesIterative( std::vector<shared_ptr<BuildingEntity> >& stack, TargetMap& target_map, bool resolveInverseAttributes )
+{
+	// explicit stack instead of recursion, so that deep graphs can not overflow the call stack
+	UnvisitedEntityCollector<TargetMap> collector( target_map, stack );
+	std::vector<std::pair<std::string, shared_ptr<BuildingObject> > > vec_attributes;
+	while( !stack.empty() )
 	{
-		shared_ptr<IfcElementAssembly> ele_assembly = dynamic_pointer_cast<IfcElementAssembly>(entity);
-		if( ele_assembly )
+		shared_ptr<BuildingEntity> entity = std::move( stack.back() );
+		stack.pop_back();
+
+		if( entity->classID() == IFCELEMENTASSEMBLY )
 		{
-			int assembly_id = ele_assembly->m_tag;
-			std::vector<weak_ptr<IfcRelAggregates> >& vec_is_decomposed_by = ele_assembly->m_IsDecomposedBy_inverse;
-			for( const auto& is_decomposed_weak_ptr : vec_is_decomposed_by )
+			shared_ptr<IfcElementAssembly> ele_assembly = dynamic_pointer_cast<IfcElementAssembly>( entity );
+			if( ele_assembly )
 			{
-				shared_ptr<IfcRelDecomposes> rel_dec;
-				if( is_decomposed_weak_ptr.expired() )
-				{
-					continue;
-				}
-				shared_ptr<IfcRelAggregates> is_decomposed_ptr(is_decomposed_weak_ptr);
-				if( is_decomposed_ptr )
+				for( const weak_ptr<IfcRelAggregates>& is_decomposed_weak_ptr : ele_assembly->m_IsDecomposedBy_inverse )
 				{
-					shared_ptr<BuildingEntity> as_ifcpp_entity = is_decomposed_ptr;
-					collectDependentEntities(as_ifcpp_entity, target_map, resolveInverseAttributes);
+					if( is_decomposed_weak_ptr.expired() )
+					{
+						continue;
+					}
+					shared_ptr<IfcRelAggregates> is_decomposed_ptr( is_decomposed_weak_ptr );
+					if( collector.visitReference( is_decomposed_ptr.get() ) )
+					{
+						collector.keepReference( is_decomposed_ptr );
+					}
 				}
 			}
 		}
 
-		std::vector<std::pair<std::string, shared_ptr<BuildingObject> > > vec_attributes;
-		entity->getAttributes(vec_attributes);
+		// the generated classes are read through the reference table, which allocates nothing
+		if( IFC4X3::EntityReferences::forEachReference( entity.get(), collector ) )
+		{
+			if( resolveInverseAttributes )
+			{
+				IFC4X3::EntityReferences::forEachInverseReference( entity.get(), collector );
+			}
+			continue;
+		}
 
+		vec_attributes.clear();
+		entity->getAttributes( vec_attributes );
 		if( resolveInverseAttributes )
 		{
-			entity->getAttributesInverse(vec_attributes);
+			entity->getAttributesInverse( vec_attributes );
 		}
 
 		for( auto& vec_attribute : vec_attributes )
 		{
-			shared_ptr<BuildingObject>& attribute = vec_attribute.second;
-			if( !attribute )
-			{
-				// empty attribute
-				continue;
-			}
-			shared_ptr<BuildingEntity> attribute_entity = dynamic_pointer_cast<BuildingEntity>(attribute);
-			if( attribute_entity )
-			{
-				if( target_map.find(attribute_entity.get()) == target_map.end() )
-				{
-					target_map[attribute_entity.get()] = attribute_entity;
-					collectDependentEntities(attribute_entity, target_map, resolveInverseAttributes);
-				}
-				continue;
-			}
-
-			shared_ptr<AttributeObjectVector> attribute_object_vector = dynamic_pointer_cast<AttributeObjectVector>(attribute);
-			if( attribute_object_vector )
-			{
-				std::vector<shared_ptr<BuildingObject> >& vec_of_attributes = attribute_object_vector->m_vec;
-				for( auto& attribute_object : vec_of_attributes )
-				{
-					collectDependentEntities(attribute_object, target_map, resolveInverseAttributes);
-				}
-				continue;
-			}
+			pushUnvisitedEntities( vec_attribute.second, target_map, stack );
 		}
+	}
+}
+
+void BuildingModel::collectDependentEntities( shared_ptr<BuildingObject> obj, std::unordered_map<BuildingObject*, shared_ptr<BuildingObject> >& target_map, bool resolveInverseAttributes)
+{
+	if( !obj )
+	{
 		return;
 	}
 
-	shared_ptr<AttributeObjectVector> attribute_object_vector = dynamic_pointer_cast<AttributeObjectVector>(obj);
+	target_map[obj.get()] = obj;
+
+	std::vector<shared_ptr<BuildingEntity> > stack;
+	shared_ptr<AttributeObjectVector> attribute_object_vector = dynamic_pointer_cast<AttributeObjectVector>( obj );
 	if( attribute_object_vector )
 	{
-		std::vector<shared_ptr<BuildingObject> >& vec_of_attributes = attribute_object_vector->m_vec;
-		for( auto& attribute_object : vec_of_attributes )
+		pushUnvisitedEntities( obj, target_map, stack );
+	}
+	else
+	{
+		shared_ptr<BuildingEntity> entity = dynamic_pointer_cast<BuildingEntity>( obj );
+		if( entity )
+		{
+			stack.push_back( entity );
+		}
+	}
+	collectDependentEntitiesIterative( stack, target_map, resolveInverseAttributes );
+}
+
+void BuildingModel::collectDependentEntities( const std::vector<shared_ptr<BuildingEntity> >& roots, std::unordered_map<BuildingEntity*, shared_ptr<BuildingEntity> >& target_map )
+{
+	std::vector<shared_ptr<BuildingEntity> > stack;
+	for( const shared_ptr<BuildingEntity>& root : roots )
+	{
+		if( root && target_map.insert( { root.get(), root } ).second )
 		{
-			collectDependentEntities(attribute_object, target_map, resolveInverseAttributes);
+			stack.push_back( root );
 		}
 	}
+	collectDependentEntitiesIterative( stack, target_map, false );
 }
@@ -17,6 +17,7 @@ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OU
 
 #pragma once
 
+#include <atomic>
 #include <vector>
 #include <unordered_map>
 #include <string>
@@ -25,6 +26,7 @@ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OU
 
 class BuildingObject;
 class BuildingEntity;
+class StringPool;
 class UnitConverter;
 namespace IFC4X3
 {
@@ -42,6 +44,9 @@ public:
 	BuildingModelMapType<int, shared_ptr<BuildingEntity> >& getMapIfcEntities() { return m_map_entities; }
 	void setMapIfcEntities(const std::unordered_map<int, shared_ptr<BuildingEntity> >& map);
 	void insertEntity(shared_ptr<BuildingEntity> e, bool overwrite_existing = false, bool warn_on_existing_entities = true);
+
+	/*! \brief Method insertEntities. Same as insertEntity for each entity, but the map is grown only once. Use it for entities that are created in large numbers, see BulkEntityBuilder */
+	void insertEntities(const std::vector<shared_ptr<BuildingEntity> >& entities, bool overwrite_existing = false, bool warn_on_existing_entities = true);
 	void removeEntity(shared_ptr<BuildingEntity> e);
 	void removeEntity(int tag);
 	void removeUnreferencedEntities();
@@ -51,10 +56,18 @@ public:
 
 	/*! \brief Method getNextUnusedEntityTagFast. Return a tag that is not in the model. Do not look for gaps in existing map. */
 	int getNextUnusedEntityTagFast();
+
+	/*! \brief Method reserveEntityTags. Reserves count consecutive tags above all tags that are in the model or reserved, and returns the first one.
+	  The entities with these tags can be inserted later. Can be called from several threads at once. The reserved tags are not given out again until clearIfcModel */
+	int reserveEntityTags(size_t count);
 	shared_ptr<IFC4X3::IfcProject> getIfcProject();
 	shared_ptr<IFC4X3::IfcGeometricRepresentationContext> getIfcGeometricRepresentationContext3D();
 	shared_ptr<UnitConverter>& getUnitConverter() { return m_unit_converter; }
 
+	/*! \brief Method setStringPoolEnabled. If enabled, the reader shares the string storage of IfcLabel, IfcIdentifier and IfcText values between all attributes with the same value. See StringPool */
+	void setStringPoolEnabled(bool enabled);
+	shared_ptr<StringPool>& getStringPool() { return m_string_pool; }
+
 	/*! \brief Method getIfcSchemaVersion. Returns the IFC version of the loaded file */
 	SchemaVersionEnum& getIfcSchemaVersionEnumOfLoadedFile() { return m_ifc_schema_version_loaded_file; }
 	std::string getIfcSchemaVersionOfLoadedFile();
@@ -85,6 +98,10 @@ public:
 	void initFileHeader(const std::string& fileName, const std::string& generatingApplication);
 	static void collectDependentEntities(shared_ptr<BuildingObject> entity, std::unordered_map<BuildingObject*, shared_ptr<BuildingObject> >& target_map, bool resolveInverseAttributes);
 
+	/*! \brief Method collectDependentEntities. Adds the roots and all entities that they reference directly or indirectly to target_map. Inverse attributes are not followed.
+	  Iterative, so it works also for deep graphs. Only reads the entities, so it can run for different roots in parallel */
+	static void collectDependentEntities(const std::vector<shared_ptr<BuildingEntity> >& roots, std::unordered_map<BuildingEntity*, shared_ptr<BuildingEntity> >& target_map);
+
 	void cancelLoading()
 	{
 		m_cancelLoading = true;
@@ -96,10 +113,12 @@ public:
 
 private:
 	BuildingModelMapType<int, shared_ptr<BuildingEntity> >	m_map_entities;
-	int														m_max_entity_id = -1;
+	std::atomic<int>										m_max_entity_id{ -1 };
+	std::atomic<int>										m_max_reserved_entity_id{ -1 };	// highest tag given out by reserveEntityTags. m_max_entity_id is never lowered below it
 	shared_ptr<IFC4X3::IfcProject>							m_ifc_project;
 	shared_ptr<IFC4X3::IfcGeometricRepresentationContext>	m_geom_context_3d;
 	shared_ptr<UnitConverter>							m_unit_converter;
+	shared_ptr<StringPool>								m_string_pool;
 	std::string											m_file_name;
 	std::string											m_file_header;
 	std::string											m_IFC_FILE_DESCRIPTION;
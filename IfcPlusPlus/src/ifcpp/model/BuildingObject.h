@@ -25,6 +25,7 @@ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OU
 #include <unordered_map>
 #include <unordered_set>
 #include "ifcpp/model/BasicTypes.h"
+#include "ifcpp/model/SharedString.h"
 
 enum LogicalEnum { LOGICAL_TRUE, LOGICAL_FALSE, LOGICAL_UNKNOWN };
 
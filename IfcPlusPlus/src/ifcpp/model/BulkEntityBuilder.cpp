@@ -0,0 +1,54 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <iterator>
+#include "BulkEntityBuilder.h"
+
+BulkEntityBuilder::BulkEntityBuilder( shared_ptr<BuildingModel> model ) : m_model( model )
+{
+}
+
+GuidGenerator BulkEntityBuilder::createGuidGenerator( int firstTag ) const
+{
+	if( m_deterministicGuids )
+	{
+		// one generator per block, seeded with the first tag, so that blocks do not repeat each other's GUIDs
+		return GuidGenerator( m_guidSeed ^ ( uint64_t( firstTag ) * 0x9E3779B97F4A7C15ull ) );
+	}
+	return GuidGenerator();
+}
+
+void BulkEntityBuilder::appendCreatedEntities( std::vector<shared_ptr<BuildingEntity> >& created )
+{
+	std::lock_guard<std::mutex> lock( m_mutex );
+	if( m_createdEntities.empty() )
+	{
+		m_createdEntities.swap( created );
+		return;
+	}
+	m_createdEntities.insert( m_createdEntities.end(), std::make_move_iterator( created.begin() ), std::make_move_iterator( created.end() ) );
+}
+
+void BulkEntityBuilder::insertIntoModel()
+{
+	std::vector<shared_ptr<BuildingEntity> > created;
+	{
+		std::lock_guard<std::mutex> lock( m_mutex );
+		created.swap( m_createdEntities );
+	}
+	m_model->insertEntities( created );
+}
@@ -0,0 +1,95 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+#include "BasicTypes.h"
+#include "BuildingGuid.h"
+#include "BuildingModel.h"
+#include "BuildingObject.h"
+#include "GlobalDefines.h"
+#include "IfcGloballyUniqueId.h"
+#include "IfcRoot.h"
+
+///@brief Creates large numbers of entities for a model, for example in programmatic model generation
+///@details createEntities reserves a range of consecutive tags in the model, allocates the entities in one contiguous block and gives IfcRoot objects a new
+///GlobalId from a GuidGenerator. The entities of a block share one allocation: the memory is released when the last entity of the block is released.
+///createEntities can be called from several threads at once. The created entities are collected and put into the model map at once by insertIntoModel.
+class IFCQUERY_EXPORT BulkEntityBuilder
+{
+public:
+	explicit BulkEntityBuilder( shared_ptr<BuildingModel> model );
+
+	///@brief Creates GUIDs from a fixed seed, for example for tests. The GUIDs of a block depend on the seed and on the first tag of the block.
+	///@details The tags are handed out in the order in which the blocks are reserved. When several threads create blocks at once, that order can change between runs,
+	///and so can the GUID of each entity. The same GUIDs in each run are only created if the blocks are reserved in the same order, for example from one thread
+	void setDeterministicGuids( uint64_t seed ) { m_deterministicGuids = true; m_guidSeed = seed; }
+
+	template<typename T>
+	void createEntities( size_t count, std::vector<shared_ptr<T> >& result )
+	{
+		static_assert(std::is_base_of<BuildingEntity, T>::value, "T must be an entity type");
+		if( count == 0 )
+		{
+			return;
+		}
+
+		const int firstTag = m_model->reserveEntityTags( count );
+		shared_ptr<std::vector<T> > block = std::make_shared<std::vector<T> >( count );
+		GuidGenerator guidGenerator = createGuidGenerator( firstTag );
+		std::vector<shared_ptr<BuildingEntity> > created;
+		created.reserve( count );
+		if( result.capacity() < result.size() + count )
+		{
+			// grow geometrically, since result is usually filled by many calls
+			result.reserve( std::max( result.size() + count, 2 * result.capacity() ) );
+		}
+
+		for( size_t ii = 0; ii < count; ++ii )
+		{
+			// aliasing constructor: each entity shares the reference count of the block
+			shared_ptr<T> entity( block, &( *block )[ii] );
+			entity->m_tag = firstTag + (int)ii;
+			if constexpr( std::is_base_of<IFC4X3::IfcRoot, T>::value )
+			{
+				entity->m_GlobalId = std::make_shared<IFC4X3::IfcGloballyUniqueId>( guidGenerator.createBase64Uuid() );
+			}
+			created.push_back( entity );
+			result.push_back( std::move( entity ) );
+		}
+		appendCreatedEntities( created );
+	}
+
+	///@brief Inserts all entities that were created since the last call into the model
+	void insertIntoModel();
+
+private:
+	GuidGenerator createGuidGenerator( int firstTag ) const;
+	void appendCreatedEntities( std::vector<shared_ptr<BuildingEntity> >& created );
+
+	shared_ptr<BuildingModel>					m_model;
+	std::mutex									m_mutex;
+	std::vector<shared_ptr<BuildingEntity> >	m_createdEntities;
+	bool										m_deterministicGuids = false;
+	uint64_t									m_guidSeed = 0;
+};
@@ -0,0 +1,364 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+
+#include "IfcGloballyUniqueId.h"
+#include "IfcRoot.h"
+
+#include "AttributeObject.h"
+#include "BuildingException.h"
+#include "BuildingGuid.h"
+#include "BuildingObject.h"
+#include "ModelDiff.h"
+
+using namespace IFC4X3;
+
+namespace
+{
+	inline void hashCombine( uint64_t& seed, uint64_t value )
+	{
+		// mixing function of splitmix64
+		value += 0x9e3779b97f4a7c15ull + seed;
+		value = ( value ^ ( value >> 30 ) ) * 0xbf58476d1ce4e5b9ull;
+		value = ( value ^ ( value >> 27 ) ) * 0x94d049bb133111ebull;
+		seed = value ^ ( value >> 31 );
+	}
+
+	inline uint64_t hashDouble( double value )
+	{
+		if( value == 0.0 )
+		{
+			value = 0.0;	// same hash for -0.0 and 0.0
+		}
+		uint64_t bits = 0;
+		std::memcpy( &bits, &value, sizeof( value ) );
+		return bits;
+	}
+
+	///@brief Content hashes of the entities of one model
+	class ContentHasher
+	{
+	public:
+		explicit ContentHasher( bool ignore_owner_history ) : m_ignore_owner_history( ignore_owner_history ) {}
+
+		///@brief Hash over the class and all attributes of the entity. References to IfcRoot objects are hashed by GUID, other references by content
+		uint64_t hashEntityContent( const BuildingEntity* entity, int depth )
+		{
+			std::vector<uint64_t> attribute_hashes;
+			hashAttributes( entity, attribute_hashes, depth );
+			uint64_t seed = entity->classID();
+			for( uint64_t attribute_hash : attribute_hashes )
+			{
+				hashCombine( seed, attribute_hash );
+			}
+			return seed;
+		}
+
+		///@brief One hash per attribute, in the order of getAttributes
+		void hashAttributes( const BuildingEntity* entity, std::vector<uint64_t>& attribute_hashes, int depth )
+		{
+			std::vector<std::pair<std::string, shared_ptr<BuildingObject> > > vec_attributes;
+			entity->getAttributes( vec_attributes );
+			attribute_hashes.resize( vec_attributes.size() );
+			for( size_t ii = 0; ii < vec_attributes.size(); ++ii )
+			{
+				if( m_ignore_owner_history && vec_attributes[ii].first == "OwnerHistory" )
+				{
+					attribute_hashes[ii] = 0;
+					continue;
+				}
+				attribute_hashes[ii] = hashAttribute( vec_attributes[ii].second, depth );
+			}
+		}
+
+	private:
+		uint64_t hashAttribute( const shared_ptr<BuildingObject>& attribute, int depth )
+		{
+			if( !attribute )
+			{
+				return 0x5a5a5a5a5a5a5a5aull;	// unset optional attribute
+			}
+
+			const uint32_t class_id = attribute->classID();
+			uint64_t seed = class_id;
+			static const uint32_t class_id_vector = AttributeObjectVector().classID();
+			static const uint32_t class_id_bool = BoolAttribute().classID();
+			static const uint32_t class_id_logical = LogicalAttribute().classID();
+			static const uint32_t class_id_integer = IntegerAttribute().classID();
+			static const uint32_t class_id_real = RealAttribute().classID();
+			static const uint32_t class_id_string = StringAttribute().classID();
+			static const uint32_t class_id_binary = BinaryAttribute().classID();
+
+			if( class_id == class_id_vector )
+			{
+				const AttributeObjectVector* vec = static_cast<const AttributeObjectVector*>( attribute.get() );
+				hashCombine( seed, vec->m_vec.size() );
+				for( const shared_ptr<BuildingObject>& item : vec->m_vec )
+				{
+					hashCombine( seed, hashAttribute( item, depth ) );
+				}
+				return seed;
+			}
+			if( class_id == class_id_bool )
+			{
+				hashCombine( seed, static_cast<const BoolAttribute*>( attribute.get() )->m_value ? 1 : 0 );
+				return seed;
+			}
+			if( class_id == class_id_logical )
+			{
+				hashCombine( seed, static_cast<uint64_t>( static_cast<const LogicalAttribute*>( attribute.get() )->m_value ) );
+				return seed;
+			}
+			if( class_id == class_id_integer )
+			{
+				hashCombine( seed, static_cast<uint64_t>( static_cast<const IntegerAttribute*>( attribute.get() )->m_value ) );
+				return seed;
+			}
+			if( class_id == class_id_real )
+			{
+				hashCombine( seed, hashDouble( static_cast<const RealAttribute*>( attribute.get() )->m_value ) );
+				return seed;
+			}
+			if( class_id == class_id_string )
+			{
+				hashCombine( seed, std::hash<std::string>()( static_cast<const StringAttribute*>( attribute.get() )->m_value ) );
+				return seed;
+			}
+			if( class_id == class_id_binary )
+			{
+				return seed;
+			}
+
+			const BuildingEntity* entity = dynamic_cast<const BuildingEntity*>( attribute.get() );
+			if( entity )
+			{
+				const IfcRoot* root = dynamic_cast<const IfcRoot*>( entity );
+				if( root )
+				{
+					// reference to another object: only the identity matters, changes of the object itself are reported for that object
+					if( root->m_GlobalId )
+					{
+						hashCombine( seed, BinaryGuid( root->m_GlobalId->m_value ).hash() );
+					}
+					return seed;
+				}
+				hashCombine( seed, hashSharedEntity( entity, depth + 1 ) );
+				return seed;
+			}
+
+			// defined types, enums and other simple values
+			std::stringstream& strs = getThreadStream();
+			strs.str( std::string() );
+			attribute->getStepParameter( strs, true, 15 );
+			hashCombine( seed, std::hash<std::string>()( strs.str() ) );
+			return seed;
+		}
+
+		uint64_t hashSharedEntity( const BuildingEntity* entity, int depth )
+		{
+			if( depth > 1000 )
+			{
+				// entity graphs without IfcRoot objects are not that deep, unless there is a cycle
+				return entity->classID();
+			}
+
+			Shard& shard = m_shards[std::hash<const BuildingEntity*>()( entity ) % NUM_SHARDS];
+			{
+				std::lock_guard<std::mutex> lock( shard.mutex );
+				auto it = shard.map.find( entity );
+				if( it != shard.map.end() )
+				{
+					return it->second;
+				}
+			}
+
+			// computed without lock. If two threads compute the same entity, both get the same value
+			const uint64_t content_hash = hashEntityContent( entity, depth );
+			std::lock_guard<std::mutex> lock( shard.mutex );
+			shard.map.insert( { entity, content_hash } );
+			return content_hash;
+		}
+
+		static std::stringstream& getThreadStream()
+		{
+			static thread_local std::stringstream strs;
+			strs.imbue( std::locale::classic() );
+			return strs;
+		}
+
+		static const size_t NUM_SHARDS = 64;
+		struct Shard
+		{
+			std::mutex mutex;
+			std::unordered_map<const BuildingEntity*, uint64_t> map;
+		};
+		Shard m_shards[NUM_SHARDS];
+		bool m_ignore_owner_history;
+	};
+
+	struct RootObjectHash
+	{
+		shared_ptr<IfcRoot>	m_object;
+		BinaryGuid			m_guid;
+		uint64_t			m_content_hash = 0;
+	};
+
+	void collectRootObjects( const shared_ptr<BuildingModel>& model, std::vector<RootObjectHash>& vec_roots )
+	{
+		for( auto& it : model->getMapIfcEntities() )
+		{
+			shared_ptr<IfcRoot> root = dynamic_pointer_cast<IfcRoot>( it.second );
+			if( root && root->m_GlobalId )
+			{
+				RootObjectHash root_hash;
+				root_hash.m_object = root;
+				vec_roots.push_back( root_hash );
+			}
+		}
+		std::sort( vec_roots.begin(), vec_roots.end(), []( const RootObjectHash& a, const RootObjectHash& b ) { return a.m_object->m_tag < b.m_object->m_tag; } );
+	}
+}
+
+void ModelDiff::compareModels( const shared_ptr<BuildingModel>& oldModel, const shared_ptr<BuildingModel>& newModel, Result& result )
+{
+	if( !oldModel || !newModel )
+	{
+		throw BuildingException( "Model not set.", __FUNC__ );
+	}
+
+	result = Result();
+	progressTextCallback( "Comparing models..." );
+	progressValueCallback( 0, "diff" );
+
+	std::vector<RootObjectHash> vec_old;
+	std::vector<RootObjectHash> vec_new;
+	collectRootObjects( oldModel, vec_old );
+	collectRootObjects( newModel, vec_new );
+
+	ContentHasher hasher_old( m_ignore_owner_history );
+	ContentHasher hasher_new( m_ignore_owner_history );
+
+	// one loop over both models, so that a small model does not leave threads idle
+	std::vector<std::pair<RootObjectHash*, ContentHasher*> > vec_tasks;
+	vec_tasks.reserve( vec_old.size() + vec_new.size() );
+	for( RootObjectHash& root_hash : vec_old )
+	{
+		vec_tasks.push_back( { &root_hash, &hasher_old } );
+	}
+	for( RootObjectHash& root_hash : vec_new )
+	{
+		vec_tasks.push_back( { &root_hash, &hasher_new } );
+	}
+
+	FOR_EACH_LOOP vec_tasks.begin(), vec_tasks.end(), [&]( std::pair<RootObjectHash*, ContentHasher*>& task )
+	{
+		RootObjectHash& root_hash = *task.first;
+		root_hash.m_guid = BinaryGuid( root_hash.m_object->m_GlobalId->m_value );
+		root_hash.m_content_hash = task.second->hashEntityContent( root_hash.m_object.get(), 0 );
+	} );
+	progressValueCallback( 0.8, "diff" );
+
+	std::unordered_map<BinaryGuid, size_t> map_old;
+	map_old.reserve( vec_old.size() );
+	for( size_t ii = 0; ii < vec_old.size(); ++ii )
+	{
+		if( !map_old.insert( { vec_old[ii].m_guid, ii } ).second )
+		{
+			messageCallback( "GUID is used more than once in old model: " + vec_old[ii].m_object->m_GlobalId->m_value, StatusCallback::MESSAGE_TYPE_WARNING, __FUNC__, vec_old[ii].m_object.get() );
+		}
+	}
+
+	std::vector<bool> vec_old_matched( vec_old.size(), false );
+	std::vector<size_t> vec_modified_old_index;
+	std::vector<size_t> vec_modified_new_index;
+	for( size_t ii = 0; ii < vec_new.size(); ++ii )
+	{
+		const RootObjectHash& new_hash = vec_new[ii];
+		auto it_find = map_old.find( new_hash.m_guid );
+		if( it_find == map_old.end() || vec_old_matched[it_find->second] )
+		{
+			result.m_added.push_back( new_hash.m_object );
+			continue;
+		}
+
+		const size_t old_index = it_find->second;
+		vec_old_matched[old_index] = true;
+		if( vec_old[old_index].m_content_hash == new_hash.m_content_hash )
+		{
+			++result.m_num_unchanged;
+		}
+		else
+		{
+			vec_modified_old_index.push_back( old_index );
+			vec_modified_new_index.push_back( ii );
+		}
+	}
+
+	for( size_t ii = 0; ii < vec_old.size(); ++ii )
+	{
+		if( !vec_old_matched[ii] )
+		{
+			result.m_removed.push_back( vec_old[ii].m_object );
+		}
+	}
+
+	// changed attributes only for the modified objects. Hashes of referenced entities are in the cache already
+	result.m_modified.resize( vec_modified_new_index.size() );
+	std::vector<size_t> vec_modified_indices( vec_modified_new_index.size() );
+	for( size_t ii = 0; ii < vec_modified_indices.size(); ++ii )
+	{
+		vec_modified_indices[ii] = ii;
+	}
+
+	FOR_EACH_LOOP vec_modified_indices.begin(), vec_modified_indices.end(), [&]( size_t ii )
+	{
+		const shared_ptr<IfcRoot>& old_object = vec_old[vec_modified_old_index[ii]].m_object;
+		const shared_ptr<IfcRoot>& new_object = vec_new[vec_modified_new_index[ii]].m_object;
+		ModifiedObject& modified = result.m_modified[ii];
+		modified.m_guid = new_object->m_GlobalId->m_value;
+		modified.m_old_object = old_object;
+		modified.m_new_object = new_object;
+
+		if( old_object->classID() != new_object->classID() )
+		{
+			modified.m_changed_attributes.push_back( "type" );
+			return;
+		}
+
+		std::vector<uint64_t> old_attribute_hashes;
+		std::vector<uint64_t> new_attribute_hashes;
+		hasher_old.hashAttributes( old_object.get(), old_attribute_hashes, 0 );
+		hasher_new.hashAttributes( new_object.get(), new_attribute_hashes, 0 );
+
+		std::vector<std::pair<std::string, shared_ptr<BuildingObject> > > vec_attributes;
+		new_object->getAttributes( vec_attributes );
+		for( size_t jj = 0; jj < vec_attributes.size() && jj < old_attribute_hashes.size() && jj < new_attribute_hashes.size(); ++jj )
+		{
+			if( old_attribute_hashes[jj] != new_attribute_hashes[jj] )
+			{
+				modified.m_changed_attributes.push_back( vec_attributes[jj].first );
+			}
+		}
+	} );
+
+	progressValueCallback( 1.0, "diff" );
+}
@@ -0,0 +1,62 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include "BasicTypes.h"
+#include "BuildingModel.h"
+#include "GlobalDefines.h"
+#include "StatusCallback.h"
+
+namespace IFC4X3
+{
+	class IfcRoot;
+}
+
+///@brief Compares two revisions of a model by GUID
+///@details Each IfcRoot object gets a content hash over its attributes and over the entities that it references and that have no GUID themselves (placements,
+///representations, property values, ...). Tags are ignored, so a file that was written again with different tags has no changes. A reference to another
+///IfcRoot object is hashed by its GUID, so a modified wall does not make its storey modified. Changes of relationships show up as modified relationship objects.
+///The hashes of both models are computed in parallel. Hashes of shared entities without GUID are cached, so each of them is hashed only once.
+class IFCQUERY_EXPORT ModelDiff : public StatusCallback
+{
+public:
+	struct ModifiedObject
+	{
+		std::string							m_guid;
+		shared_ptr<IFC4X3::IfcRoot>			m_old_object;
+		shared_ptr<IFC4X3::IfcRoot>			m_new_object;
+		std::vector<std::string>			m_changed_attributes;	// names as in getAttributes. Contains only "type" if the entity type changed
+	};
+
+	struct Result
+	{
+		std::vector<shared_ptr<IFC4X3::IfcRoot> >	m_added;		// objects of the new model, sorted by tag
+		std::vector<shared_ptr<IFC4X3::IfcRoot> >	m_removed;		// objects of the old model, sorted by tag
+		std::vector<ModifiedObject>					m_modified;		// sorted by tag in the new model
+		size_t										m_num_unchanged = 0;
+	};
+
+	ModelDiff() = default;
+	~ModelDiff() override = default;
+
+	void compareModels( const shared_ptr<BuildingModel>& oldModel, const shared_ptr<BuildingModel>& newModel, Result& result );
+
+	bool m_ignore_owner_history = true;		// IfcOwnerHistory usually changes with each export, even if the object itself did not change
+};
@@ -0,0 +1,129 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#pragma once
+
+#include <atomic>
+#include <ostream>
+#include <string>
+#include "GlobalDefines.h"
+
+///@brief String value of IfcLabel, IfcIdentifier and IfcText
+///@details The value is a single pointer to immutable, reference counted storage. Values that were read while a StringPool was active share the storage of the pool,
+///so each distinct string exists only once. Assigning a new value replaces the storage of this object only, so it can be modified like a std::string without
+///affecting other entities. An empty value has no storage.
+class IFCQUERY_EXPORT SharedString
+{
+public:
+	SharedString() = default;
+	SharedString( const std::string& value ) : m_storage( createStorage( std::string( value ) ) ) {}
+	SharedString( std::string&& value ) : m_storage( createStorage( std::move( value ) ) ) {}
+	SharedString( const char* value ) : m_storage( createStorage( std::string( value ) ) ) {}
+	SharedString( const SharedString& other ) : m_storage( other.m_storage ) { addReference( m_storage ); }
+	SharedString( SharedString&& other ) noexcept : m_storage( other.m_storage ) { other.m_storage = nullptr; }
+	~SharedString() { releaseReference( m_storage ); }
+
+	SharedString& operator=( const SharedString& other )
+	{
+		addReference( other.m_storage );
+		releaseReference( m_storage );
+		m_storage = other.m_storage;
+		return *this;
+	}
+	SharedString& operator=( SharedString&& other ) noexcept
+	{
+		if( this != &other )
+		{
+			releaseReference( m_storage );
+			m_storage = other.m_storage;
+			other.m_storage = nullptr;
+		}
+		return *this;
+	}
+	SharedString& operator=( const std::string& value ) { return *this = SharedString( value ); }
+	SharedString& operator=( std::string&& value ) { return *this = SharedString( std::move( value ) ); }
+	SharedString& operator=( const char* value ) { return *this = SharedString( value ); }
+
+	const std::string& str() const { return m_storage ? m_storage->m_value : emptyString(); }
+	operator const std::string&() const { return str(); }
+	const char* c_str() const { return str().c_str(); }
+	size_t size() const { return str().size(); }
+	size_t length() const { return str().size(); }
+	bool empty() const { return m_storage == nullptr; }
+	int compare( const std::string& other ) const { return str().compare( other ); }
+	int compare( const char* other ) const { return str().compare( other ); }
+
+	///@brief True if both values refer to the same storage. Values from one StringPool are equal if and only if they share the storage
+	bool sharesStorageWith( const SharedString& other ) const { return m_storage != nullptr && m_storage == other.m_storage; }
+
+	bool operator==( const SharedString& other ) const { return m_storage == other.m_storage || str() == other.str(); }
+	bool operator!=( const SharedString& other ) const { return !( *this == other ); }
+	bool operator<( const SharedString& other ) const { return str() < other.str(); }
+
+	friend bool operator==( const SharedString& a, const std::string& b ) { return a.str() == b; }
+	friend bool operator==( const std::string& a, const SharedString& b ) { return a == b.str(); }
+	friend bool operator==( const SharedString& a, const char* b ) { return a.str() == b; }
+	friend bool operator==( const char* a, const SharedString& b ) { return a == b.str(); }
+	friend bool operator!=( const SharedString& a, const std::string& b ) { return a.str() != b; }
+	friend bool operator!=( const std::string& a, const SharedString& b ) { return a != b.str(); }
+	friend bool operator!=( const SharedString& a, const char* b ) { return a.str() != b; }
+	friend bool operator!=( const char* a, const SharedString& b ) { return a != b.str(); }
+	friend std::string operator+( const SharedString& a, const std::string& b ) { return a.str() + b; }
+	friend std::string operator+( const std::string& a, const SharedString& b ) { return a + b.str(); }
+	friend std::string operator+( const SharedString& a, const char* b ) { return a.str() + b; }
+	friend std::string operator+( const char* a, const SharedString& b ) { return a + b.str(); }
+	friend std::ostream& operator<<( std::ostream& stream, const SharedString& value ) { return stream << value.str(); }
+
+private:
+	friend class StringPool;
+
+	struct Storage
+	{
+		explicit Storage( std::string&& value ) : m_value( std::move( value ) ) {}
+		std::atomic<uint32_t>	m_reference_count{ 1 };
+		const std::string		m_value;
+	};
+
+	static Storage* createStorage( std::string&& value )
+	{
+		if( value.empty() )
+		{
+			return nullptr;
+		}
+		return new Storage( std::move( value ) );
+	}
+	static void addReference( Storage* storage )
+	{
+		if( storage )
+		{
+			storage->m_reference_count.fetch_add( 1, std::memory_order_relaxed );
+		}
+	}
+	static void releaseReference( Storage* storage )
+	{
+		if( storage && storage->m_reference_count.fetch_sub( 1, std::memory_order_acq_rel ) == 1 )
+		{
+			delete storage;
+		}
+	}
+	static const std::string& emptyString()
+	{
+		static const std::string empty;
+		return empty;
+	}
+
+	Storage* m_storage = nullptr;
+};
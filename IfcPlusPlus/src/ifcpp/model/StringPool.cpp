@@ -0,0 +1,97 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "StringPool.h"
+
+static thread_local StringPool* s_current_string_pool = nullptr;
+
+StringPool* StringPool::current()
+{
+	return s_current_string_pool;
+}
+
+StringPool::~StringPool()
+{
+	clear();
+}
+
+SharedString StringPool::intern(std::string&& value)
+{
+	if (value.empty())
+	{
+		return SharedString();
+	}
+
+	m_num_lookups.fetch_add(1, std::memory_order_relaxed);
+	Shard& shard = m_shards[std::hash<std::string_view>()(value) % NUM_SHARDS];
+
+	std::lock_guard<std::mutex> lock(shard.mutex);
+	auto it = shard.map.find(value);
+	if (it != shard.map.end())
+	{
+		// an own value would need its own storage, and a heap buffer for strings that do not fit into the small string buffer
+		size_t num_bytes = sizeof(SharedString::Storage);
+		if (value.size() > 15)
+		{
+			num_bytes += value.size() + 1;
+		}
+		m_num_bytes_saved.fetch_add(num_bytes, std::memory_order_relaxed);
+		m_num_shared.fetch_add(1, std::memory_order_relaxed);
+		return it->second;
+	}
+
+	// the key refers to the string in the storage, which does not move
+	SharedString pooled(std::move(value));
+	shard.map.emplace(std::string_view(pooled.str()), pooled);
+	m_num_distinct.fetch_add(1, std::memory_order_relaxed);
+	return pooled;
+}
+
+SharedString StringPool::find(const std::string& value) const
+{
+	const Shard& shard = m_shards[std::hash<std::string_view>()(value) % NUM_SHARDS];
+	std::lock_guard<std::mutex> lock(shard.mutex);
+	auto it = shard.map.find(value);
+	if (it != shard.map.end())
+	{
+		return it->second;
+	}
+	return SharedString();
+}
+
+void StringPool::clear()
+{
+	for (Shard& shard : m_shards)
+	{
+		std::lock_guard<std::mutex> lock(shard.mutex);
+		shard.map.clear();
+	}
+	m_num_lookups = 0;
+	m_num_shared = 0;
+	m_num_distinct = 0;
+	m_num_bytes_saved = 0;
+}
+
+StringPoolScope::StringPoolScope(StringPool* pool) : m_previous(s_current_string_pool)
+{
+	s_current_string_pool = pool;
+}
+
+StringPoolScope::~StringPoolScope()
+{
+	s_current_string_pool = m_previous;
+}
@@ -0,0 +1,87 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include "GlobalDefines.h"
+#include "SharedString.h"
+
+///@brief Pool of string values of IfcLabel, IfcIdentifier and IfcText, so that the storage of each distinct value exists only once per model
+///@details Models repeat the same property names, object types and material names many times. While a pool is active (see StringPoolScope), readString sets SharedString
+///values to the pooled, immutable storage instead of allocating a new string. Each attribute still has its own object, so modifying the value of one entity does not
+///affect the others. Since equal values share the storage, two pooled values can be compared with SharedString::sharesStorageWith.
+///The pool keeps one reference to each storage, and the map keys point into the stored strings, so each distinct value is stored once.
+class IFCQUERY_EXPORT StringPool
+{
+public:
+	StringPool() = default;
+	~StringPool();
+	StringPool(const StringPool&) = delete;
+	StringPool& operator=(const StringPool&) = delete;
+
+	///@brief Returns a value with the pooled storage of the given decoded value, creates the storage if it does not exist yet
+	SharedString intern(std::string&& value);
+
+	///@brief Returns a value with the pooled storage of the given decoded value, or an empty value if no such value has been read
+	///@details Can be used for fast property queries: look up the name once, then compare it with SharedString::sharesStorageWith of each value.
+	SharedString find(const std::string& value) const;
+
+	void clear();
+
+	size_t getNumLookups() const { return m_num_lookups.load(std::memory_order_relaxed); }
+	size_t getNumSharedValues() const { return m_num_shared.load(std::memory_order_relaxed); }
+	size_t getNumDistinctValues() const { return m_num_distinct.load(std::memory_order_relaxed); }
+
+	///@brief Approximate number of bytes that were not allocated because a value was shared
+	size_t getNumBytesSaved() const { return m_num_bytes_saved.load(std::memory_order_relaxed); }
+
+	///@brief Pool that is used by createObjectFromSTEP in the calling thread, or nullptr
+	static StringPool* current();
+
+protected:
+	// sharded, so that parallel reader threads rarely wait for each other
+	static const size_t NUM_SHARDS = 64;
+	struct Shard
+	{
+		mutable std::mutex mutex;
+		std::unordered_map<std::string_view, SharedString> map;
+	};
+	Shard m_shards[NUM_SHARDS];
+
+	std::atomic<size_t> m_num_lookups{ 0 };
+	std::atomic<size_t> m_num_shared{ 0 };
+	std::atomic<size_t> m_num_distinct{ 0 };
+	std::atomic<size_t> m_num_bytes_saved{ 0 };
+};
+
+///@brief Makes a pool the current pool of the calling thread, until the scope ends. A nullptr pool disables pooling in the scope
+class IFCQUERY_EXPORT StringPoolScope
+{
+public:
+	explicit StringPoolScope(StringPool* pool);
+	~StringPoolScope();
+	StringPoolScope(const StringPoolScope&) = delete;
+	StringPoolScope& operator=(const StringPoolScope&) = delete;
+
+private:
+	StringPool* m_previous;
+};
@@ -0,0 +1,547 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <cmath>
+#include <numeric>
+#include <sstream>
+
+#include <ifcpp/model/AttributeObject.h>
+#include <ifcpp/model/BasicTypes.h>
+#include <ifcpp/model/BuildingException.h>
+#include <ifcpp/model/BuildingObject.h>
+#include <ifcpp/model/UnitConverter.h>
+#include <IfcCartesianPoint.h>
+#include <IfcCartesianPointList2D.h>
+#include <IfcCartesianPointList3D.h>
+#include <IfcConic.h>
+#include <IfcDefinitionSelect.h>
+#include <IfcDirection.h>
+#include <IfcLengthMeasure.h>
+#include <IfcMeasureWithUnit.h>
+#include <IfcParameterValue.h>
+#include <IfcPhysicalSimpleQuantity.h>
+#include <IfcPlaneAngleMeasure.h>
+#include <IfcProject.h>
+#include <IfcPropertyBoundedValue.h>
+#include <IfcPropertyEnumeration.h>
+#include <IfcPropertyListValue.h>
+#include <IfcPropertySingleValue.h>
+#include <IfcPropertyTableValue.h>
+#include <IfcRelAggregates.h>
+#include <IfcRelAssociates.h>
+#include <IfcRelDeclares.h>
+#include <IfcRelDefinesByProperties.h>
+#include <IfcRepresentationContext.h>
+#include <IfcTrimmedCurve.h>
+
+#include "ReaderSTEP.h"
+#include "FederatedModelReader.h"
+
+using namespace IFC4X3;
+
+void FederatedModelReader::loadModelsFromFiles( const std::vector<std::string>& filePaths, shared_ptr<BuildingModel>& targetModel )
+{
+	if( !targetModel )
+	{
+		throw BuildingException( "Model not set.", __FUNC__ );
+	}
+
+	m_source_files.clear();
+	m_source_files.resize( filePaths.size() );
+	if( filePaths.empty() )
+	{
+		return;
+	}
+
+	progressTextCallback( "Loading " + std::to_string( filePaths.size() ) + " IFC files ..." );
+	progressValueCallback( 0, "parse" );
+
+	// forward warnings and errors, but not the progress of each single file
+	StatusCallback::MessageCallbackType forward_messages = [this]( shared_ptr<Message> m )
+	{
+		if( m && m->m_message_type != MESSAGE_TYPE_PROGRESS_VALUE && m->m_message_type != MESSAGE_TYPE_PROGRESS_TEXT && m->m_message_type != MESSAGE_TYPE_CLEAR_MESSAGES )
+		{
+			messageCallback( m );
+		}
+	};
+
+	// 1: read each file into its own model, all files in parallel
+	std::vector<shared_ptr<BuildingModel> > vec_models( filePaths.size() );
+	std::vector<size_t> vec_file_indices( filePaths.size() );
+	std::iota( vec_file_indices.begin(), vec_file_indices.end(), 0 );
+	const bool use_string_pool = targetModel->getStringPool() != nullptr;
+	std::atomic<size_t> num_files_loaded( 0 );
+
+	FOR_EACH_LOOP vec_file_indices.begin(), vec_file_indices.end(), [&]( size_t file_index )
+	{
+		SourceFile& source = m_source_files[file_index];
+		source.m_file_path = filePaths[file_index];
+
+		shared_ptr<BuildingModel> model( new BuildingModel() );
+		model->setMessageCallBack( forward_messages );
+		model->setStringPoolEnabled( use_string_pool );
+		shared_ptr<ReaderSTEP> reader( new ReaderSTEP() );
+		reader->setMessageCallBack( forward_messages );
+
+		try
+		{
+			reader->loadModelFromFile( source.m_file_path, model );
+		}
+		catch( std::exception& e )
+		{
+			messageCallback( source.m_file_path + ": " + e.what(), StatusCallback::MESSAGE_TYPE_ERROR, __FUNC__ );
+		}
+		catch( ... )
+		{
+			messageCallback( source.m_file_path + ": undefined error", StatusCallback::MESSAGE_TYPE_ERROR, __FUNC__ );
+		}
+
+		const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map_entities = model->getMapIfcEntities();
+		for( auto it = map_entities.begin(); it != map_entities.end(); ++it )
+		{
+			source.m_max_tag = std::max( source.m_max_tag, it->first );
+		}
+		source.m_num_entities = map_entities.size();
+		source.m_ifc_project = model->getIfcProject();
+		if( source.m_ifc_project )
+		{
+			source.m_length_unit_factor = model->getUnitConverter()->getLengthInMeterFactor();
+			source.m_angle_unit_factor = model->getUnitConverter()->getAngleInRadiantFactor();
+		}
+		vec_models[file_index] = model;
+
+		const size_t num_loaded = ++num_files_loaded;
+		progressValueCallback( 0.9 * double( num_loaded ) / double( filePaths.size() ), "parse" );
+	} );
+
+	// 2: tag offsets, and the project of the federated model
+	shared_ptr<IfcProject> target_project;
+	size_t target_project_file_index = 0;
+	int64_t tag_offset = 0;
+	for( size_t ii = 0; ii < m_source_files.size(); ++ii )
+	{
+		SourceFile& source = m_source_files[ii];
+		source.m_tag_offset = (int)tag_offset;
+		if( tag_offset + source.m_max_tag > INT_MAX )
+		{
+			messageCallback( source.m_file_path + ": too many entities in federated model, file skipped", StatusCallback::MESSAGE_TYPE_ERROR, __FUNC__ );
+			vec_models[ii].reset();
+			source.m_num_entities = 0;
+			source.m_max_tag = 0;
+			continue;
+		}
+		tag_offset += source.m_max_tag;
+
+		if( !target_project && source.m_ifc_project )
+		{
+			target_project = source.m_ifc_project;
+			target_project_file_index = ii;
+		}
+	}
+
+	// 3: shift tags. Each entity belongs to exactly one file, so the files can be processed in parallel
+	FOR_EACH_LOOP vec_file_indices.begin(), vec_file_indices.end(), [&]( size_t file_index )
+	{
+		const shared_ptr<BuildingModel>& model = vec_models[file_index];
+		const int offset = m_source_files[file_index].m_tag_offset;
+		if( !model || offset == 0 )
+		{
+			return;
+		}
+		const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map_entities = model->getMapIfcEntities();
+		for( auto it = map_entities.begin(); it != map_entities.end(); ++it )
+		{
+			if( it->second )
+			{
+				it->second->m_tag += offset;
+			}
+		}
+	} );
+
+	// 4: convert files with other units to the units of the project of the federated model. Each entity belongs to exactly one file, so the files can be processed in parallel
+	if( target_project )
+	{
+		const SourceFile& target_source = m_source_files[target_project_file_index];
+		FOR_EACH_LOOP vec_file_indices.begin(), vec_file_indices.end(), [&]( size_t file_index )
+		{
+			SourceFile& source = m_source_files[file_index];
+			if( !vec_models[file_index] || !source.m_ifc_project || file_index == target_project_file_index )
+			{
+				return;
+			}
+
+			const double length_tolerance = 1e-9 * std::max( std::abs( source.m_length_unit_factor ), std::abs( target_source.m_length_unit_factor ) );
+			const double angle_tolerance = 1e-9 * std::max( std::abs( source.m_angle_unit_factor ), std::abs( target_source.m_angle_unit_factor ) );
+			if( std::abs( source.m_length_unit_factor - target_source.m_length_unit_factor ) <= length_tolerance
+				&& std::abs( source.m_angle_unit_factor - target_source.m_angle_unit_factor ) <= angle_tolerance )
+			{
+				return;
+			}
+			source.m_units_match = false;
+
+			if( std::abs( target_source.m_length_unit_factor ) < 1e-12 || std::abs( target_source.m_angle_unit_factor ) < 1e-12 )
+			{
+				// can not happen with valid unit definitions. Refuse the file instead of merging it with wrong scale
+				messageCallback( source.m_file_path + ": units can not be converted to the units of " + target_source.m_file_path + ", file skipped", StatusCallback::MESSAGE_TYPE_ERROR, __FUNC__ );
+				vec_models[file_index].reset();
+				source.m_num_entities = 0;
+				return;
+			}
+
+			const double length_factor = source.m_length_unit_factor / target_source.m_length_unit_factor;
+			const double angle_factor = source.m_angle_unit_factor / target_source.m_angle_unit_factor;
+			convertUnits( vec_models[file_index], length_factor, angle_factor );
+
+			std::stringstream strs;
+			strs << source.m_file_path << ": units differ from " << target_source.m_file_path << ", lengths scaled by " << length_factor << ", angles by " << angle_factor;
+			messageCallback( strs.str(), StatusCallback::MESSAGE_TYPE_MINOR_WARNING, __FUNC__ );
+		} );
+
+		// attach the content of the other projects to the project of the federated model
+		for( size_t ii = 0; ii < m_source_files.size(); ++ii )
+		{
+			SourceFile& source = m_source_files[ii];
+			if( !vec_models[ii] || !source.m_ifc_project || ii == target_project_file_index )
+			{
+				continue;
+			}
+			mergeProject( source.m_ifc_project, target_project );
+		}
+	}
+
+	// 5: put everything into the target model
+	targetModel->clearIfcModel();
+	size_t num_entities_total = 0;
+	for( const SourceFile& source : m_source_files )
+	{
+		num_entities_total += source.m_num_entities;
+	}
+	targetModel->getMapIfcEntities().reserve( num_entities_total );
+
+	for( size_t ii = 0; ii < vec_models.size(); ++ii )
+	{
+		const shared_ptr<BuildingModel>& model = vec_models[ii];
+		if( !model )
+		{
+			continue;
+		}
+		const shared_ptr<IfcProject>& file_project = m_source_files[ii].m_ifc_project;
+		const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map_entities = model->getMapIfcEntities();
+		for( auto it = map_entities.begin(); it != map_entities.end(); ++it )
+		{
+			const shared_ptr<BuildingEntity>& entity = it->second;
+			if( !entity )
+			{
+				continue;
+			}
+			if( file_project && file_project != target_project && entity.get() == file_project.get() )
+			{
+				continue;
+			}
+			targetModel->insertEntity( entity, false, true );
+		}
+	}
+
+	if( target_project )
+	{
+		const shared_ptr<BuildingModel>& target_file_model = vec_models[target_project_file_index];
+		targetModel->setFileHeader( target_file_model->getFileHeader() );
+		targetModel->setFileDescription( target_file_model->getFileDescription() );
+		targetModel->setFileName( target_file_model->getFileName() );
+		targetModel->getIfcSchemaVersionEnumOfLoadedFile() = target_file_model->getIfcSchemaVersionEnumOfLoadedFile();
+	}
+	targetModel->setIfcSchemaVersionEnumCurrent( BuildingModel::IFC4X3 );
+	targetModel->updateCache();
+
+	progressValueCallback( 1.0, "parse" );
+}
+
+int FederatedModelReader::getSourceFileIndex( int tag ) const
+{
+	// offsets are sorted, so the file is the last one with an offset below the tag
+	auto it = std::upper_bound( m_source_files.begin(), m_source_files.end(), tag, []( int t, const SourceFile& source ) { return t <= source.m_tag_offset; } );
+	if( it == m_source_files.begin() )
+	{
+		return -1;
+	}
+	--it;
+	if( tag > it->m_tag_offset + it->m_max_tag )
+	{
+		return -1;
+	}
+	return (int)std::distance( m_source_files.begin(), it );
+}
+
+void FederatedModelReader::mergeProject( const shared_ptr<IfcProject>& project, const shared_ptr<IfcProject>& target_project )
+{
+	// spatial structure: IfcProject -> IfcSite, IfcBuilding...
+	for( const weak_ptr<IfcRelAggregates>& rel_weak : project->m_IsDecomposedBy_inverse )
+	{
+		if( rel_weak.expired() )
+		{
+			continue;
+		}
+		shared_ptr<IfcRelAggregates> rel( rel_weak );
+		if( rel->m_RelatingObject.get() == project.get() )
+		{
+			rel->m_RelatingObject = target_project;
+			target_project->m_IsDecomposedBy_inverse.push_back( rel );
+		}
+	}
+
+	// declared types and libraries
+	for( const weak_ptr<IfcRelDeclares>& rel_weak : project->m_Declares_inverse )
+	{
+		if( rel_weak.expired() )
+		{
+			continue;
+		}
+		shared_ptr<IfcRelDeclares> rel( rel_weak );
+		if( rel->m_RelatingContext.get() == project.get() )
+		{
+			rel->m_RelatingContext = target_project;
+			target_project->m_Declares_inverse.push_back( rel );
+		}
+	}
+
+	// property sets of the project
+	for( const weak_ptr<IfcRelDefinesByProperties>& rel_weak : project->m_IsDefinedBy_inverse )
+	{
+		if( rel_weak.expired() )
+		{
+			continue;
+		}
+		shared_ptr<IfcRelDefinesByProperties> rel( rel_weak );
+		for( shared_ptr<IfcObjectDefinition>& related_object : rel->m_RelatedObjects )
+		{
+			if( related_object.get() == project.get() )
+			{
+				related_object = target_project;
+			}
+		}
+		target_project->m_IsDefinedBy_inverse.push_back( rel );
+	}
+
+	// classifications, documents, libraries
+	const IfcDefinitionSelect* project_as_definition = project.get();
+	for( const weak_ptr<IfcRelAssociates>& rel_weak : project->m_HasAssociations_inverse )
+	{
+		if( rel_weak.expired() )
+		{
+			continue;
+		}
+		shared_ptr<IfcRelAssociates> rel( rel_weak );
+		for( shared_ptr<IfcDefinitionSelect>& related_object : rel->m_RelatedObjects )
+		{
+			if( related_object.get() == project_as_definition )
+			{
+				related_object = target_project;
+			}
+		}
+		target_project->m_HasAssociations_inverse.push_back( rel );
+	}
+
+	for( const shared_ptr<IfcRepresentationContext>& context : project->m_RepresentationContexts )
+	{
+		if( !context )
+		{
+			continue;
+		}
+		if( std::find( target_project->m_RepresentationContexts.begin(), target_project->m_RepresentationContexts.end(), context ) == target_project->m_RepresentationContexts.end() )
+		{
+			target_project->m_RepresentationContexts.push_back( context );
+		}
+	}
+
+	if( !project->m_HasAssignments_inverse.empty() || !project->m_Nests_inverse.empty() || !project->m_IsNestedBy_inverse.empty() || !project->m_HasContext_inverse.empty() )
+	{
+		std::stringstream strs;
+		strs << "IfcProject #" << project->m_tag << ": assignments and nesting relationships of the project are not merged";
+		messageCallback( strs.str(), StatusCallback::MESSAGE_TYPE_MINOR_WARNING, __FUNC__, project.get() );
+	}
+}
+
+namespace
+{
+	///@returns true if the values of entity are given in a unit of their own instead of the units of the project
+	bool hasOwnUnit( BuildingEntity* entity )
+	{
+		if( dynamic_cast<IfcMeasureWithUnit*>( entity ) )
+		{
+			return true;
+		}
+		if( IfcPhysicalSimpleQuantity* quantity = dynamic_cast<IfcPhysicalSimpleQuantity*>( entity ) )
+		{
+			return quantity->m_Unit != nullptr;
+		}
+		if( IfcPropertySingleValue* property = dynamic_cast<IfcPropertySingleValue*>( entity ) )
+		{
+			return property->m_Unit != nullptr;
+		}
+		if( IfcPropertyBoundedValue* property = dynamic_cast<IfcPropertyBoundedValue*>( entity ) )
+		{
+			return property->m_Unit != nullptr;
+		}
+		if( IfcPropertyListValue* property = dynamic_cast<IfcPropertyListValue*>( entity ) )
+		{
+			return property->m_Unit != nullptr;
+		}
+		if( IfcPropertyEnumeration* enumeration = dynamic_cast<IfcPropertyEnumeration*>( entity ) )
+		{
+			return enumeration->m_Unit != nullptr;
+		}
+		if( IfcPropertyTableValue* table = dynamic_cast<IfcPropertyTableValue*>( entity ) )
+		{
+			return table->m_DefiningUnit != nullptr || table->m_DefinedUnit != nullptr;
+		}
+		return false;
+	}
+
+	void scaleCoordinateList( std::vector<std::vector<shared_ptr<IfcLengthMeasure> > >& coord_list, double length_factor, std::unordered_set<BuildingObject*>& set_converted )
+	{
+		for( std::vector<shared_ptr<IfcLengthMeasure> >& coords : coord_list )
+		{
+			for( shared_ptr<IfcLengthMeasure>& coordinate : coords )
+			{
+				if( coordinate && set_converted.insert( coordinate.get() ).second )
+				{
+					coordinate->m_value *= length_factor;
+				}
+			}
+		}
+	}
+}
+
+void FederatedModelReader::convertUnits( const shared_ptr<BuildingModel>& model, double length_factor, double angle_factor )
+{
+	std::unordered_set<BuildingObject*> set_converted;
+	std::vector<std::pair<std::string, shared_ptr<BuildingObject> > > vec_attributes;
+	std::vector<shared_ptr<BuildingObject> > stack_values;
+	const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map_entities = model->getMapIfcEntities();
+	for( auto it = map_entities.begin(); it != map_entities.end(); ++it )
+	{
+		const shared_ptr<BuildingEntity>& entity = it->second;
+		if( !entity )
+		{
+			continue;
+		}
+		// values with their own unit are not in the units of the project
+		if( hasOwnUnit( entity.get() ) )
+		{
+			continue;
+		}
+
+		// ratios of a direction are not lengths
+		if( dynamic_cast<IfcDirection*>( entity.get() ) )
+		{
+			continue;
+		}
+
+		// coordinates of points are plain doubles, not measure objects, so getAttributes only returns copies of them
+		IfcCartesianPoint* point = dynamic_cast<IfcCartesianPoint*>( entity.get() );
+		if( point )
+		{
+			for( double& coordinate : point->m_Coordinates )
+			{
+				if( !std::isnan( coordinate ) )
+				{
+					coordinate *= length_factor;
+				}
+			}
+			continue;
+		}
+
+		IfcCartesianPointList2D* point_list_2d = dynamic_cast<IfcCartesianPointList2D*>( entity.get() );
+		if( point_list_2d )
+		{
+			scaleCoordinateList( point_list_2d->m_CoordList, length_factor, set_converted );
+			continue;
+		}
+
+		IfcCartesianPointList3D* point_list_3d = dynamic_cast<IfcCartesianPointList3D*>( entity.get() );
+		if( point_list_3d )
+		{
+			scaleCoordinateList( point_list_3d->m_CoordList, length_factor, set_converted );
+			continue;
+		}
+
+		vec_attributes.clear();
+		entity->getAttributes( vec_attributes );
+
+		// trimming parameters of circles and ellipses are angles
+		bool parameters_are_angles = false;
+		shared_ptr<IfcTrimmedCurve> trimmed_curve = dynamic_pointer_cast<IfcTrimmedCurve>( entity );
+		if( trimmed_curve )
+		{
+			parameters_are_angles = dynamic_pointer_cast<IfcConic>( trimmed_curve->m_BasisCurve ) != nullptr;
+		}
+
+		for( const std::pair<std::string, shared_ptr<BuildingObject> >& attribute : vec_attributes )
+		{
+			stack_values.push_back( attribute.second );
+		}
+		while( !stack_values.empty() )
+		{
+			shared_ptr<BuildingObject> value = stack_values.back();
+			stack_values.pop_back();
+
+			// referenced entities are converted on their own
+			if( !value || dynamic_pointer_cast<BuildingEntity>( value ) )
+			{
+				continue;
+			}
+
+			shared_ptr<AttributeObjectVector> vec_values = dynamic_pointer_cast<AttributeObjectVector>( value );
+			if( vec_values )
+			{
+				std::copy( vec_values->m_vec.begin(), vec_values->m_vec.end(), std::back_inserter( stack_values ) );
+				continue;
+			}
+
+			if( !set_converted.insert( value.get() ).second )
+			{
+				continue;
+			}
+
+			shared_ptr<IfcLengthMeasure> length_measure = dynamic_pointer_cast<IfcLengthMeasure>( value );
+			if( length_measure )
+			{
+				length_measure->m_value *= length_factor;
+				continue;
+			}
+
+			shared_ptr<IfcPlaneAngleMeasure> angle_measure = dynamic_pointer_cast<IfcPlaneAngleMeasure>( value );
+			if( angle_measure )
+			{
+				angle_measure->m_value *= angle_factor;
+				continue;
+			}
+
+			if( parameters_are_angles )
+			{
+				shared_ptr<IfcParameterValue> parameter_value = dynamic_pointer_cast<IfcParameterValue>( value );
+				if( parameter_value )
+				{
+					parameter_value->m_value *= angle_factor;
+				}
+			}
+		}
+	}
+}
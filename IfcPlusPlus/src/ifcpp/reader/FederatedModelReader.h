@@ -0,0 +1,74 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include "ifcpp/model/BasicTypes.h"
+#include "ifcpp/model/BuildingModel.h"
+#include "ifcpp/model/StatusCallback.h"
+
+namespace IFC4X3
+{
+	class IfcProject;
+}
+
+///@brief Loads several IFC files concurrently and merges them into one BuildingModel, for example architecture, structure and MEP models of one building
+///@details Each file is read by its own ReaderSTEP. The tags of file i are shifted by the sum of the highest tags of the files before it, so tags stay unique and
+///the source file of an entity can be found from its tag alone (see getSourceFileIndex).
+///The IfcProject of the first file becomes the project of the federated model. The spatial structure, property sets, associations, declarations and representation
+///contexts of the other projects are attached to it.
+///Files with a different length or plane angle unit are converted to the units of the first project: all length and plane angle measures, point coordinates
+///and the trimming parameters of circles and ellipses are scaled. Direction ratios, and values with their own unit, for example in IfcMeasureWithUnit or in
+///an IfcQuantityLength with Unit, are kept.
+class IFCQUERY_EXPORT FederatedModelReader : public StatusCallback
+{
+public:
+	struct SourceFile
+	{
+		std::string							m_file_path;
+		int									m_tag_offset = 0;	// added to each tag of the file
+		int									m_max_tag = 0;		// highest tag in the file, before adding m_tag_offset
+		size_t								m_num_entities = 0;
+		double								m_length_unit_factor = 1.0;
+		double								m_angle_unit_factor = 1.0;
+		bool								m_units_match = true;	// false if the units differ from the units of the first file. The values of the file are then converted
+		shared_ptr<IFC4X3::IfcProject>		m_ifc_project;		// original project of the file. Only the first one is part of the federated model
+	};
+
+	FederatedModelReader() = default;
+	~FederatedModelReader() override = default;
+
+	/*\brief Reads all files in parallel and puts the merged entities into targetModel. Existing content of targetModel is removed.
+	  \param[in] filePaths Absolute paths of the files to read. Each file can have any format that ReaderSTEP::loadModelFromFile supports.
+	**/
+	void loadModelsFromFiles( const std::vector<std::string>& filePaths, shared_ptr<BuildingModel>& targetModel );
+
+	const std::vector<SourceFile>& getSourceFiles() const { return m_source_files; }
+
+	///@returns index into getSourceFiles() of the file that contains the entity with the given (federated) tag, or -1
+	int getSourceFileIndex( int tag ) const;
+
+protected:
+	void mergeProject( const shared_ptr<IFC4X3::IfcProject>& project, const shared_ptr<IFC4X3::IfcProject>& target_project );
+
+	///@brief Multiplies all length measures in the entities of model with length_factor, and all plane angle measures with angle_factor
+	void convertUnits( const shared_ptr<BuildingModel>& model, double length_factor, double angle_factor );
+
+	std::vector<SourceFile> m_source_files;
+};
@@ -0,0 +1,350 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <mutex>
+#include <unordered_set>
+
+#include <ifcpp/model/StringPool.h>
+#include <ifcpp/IFC4X3/EntityFactory.h>
+#include <ifcpp/IFC4X3/SchemaInfo.h>
+
+#include "ReaderUtil.h"
+#include "ReaderEntityArguments.h"
+
+using namespace IFC4X3;
+
+namespace
+{
+	ValueInfo getValueInfo(const SchemaType* type, int list_depth)
+	{
+		ValueInfo info;
+		if (!type)
+		{
+			return info;
+		}
+		switch (type->kind)
+		{
+		case SCHEMA_STRING: info.kind = VALUE_STRING; break;
+		case SCHEMA_ENUM: info.kind = VALUE_ENUM; break;
+		case SCHEMA_NUMBER: info.kind = VALUE_NUMBER; break;
+		case SCHEMA_BINARY: info.kind = VALUE_BINARY; break;
+		default: info.kind = VALUE_OTHER; break;
+		}
+		info.list_depth = list_depth + type->list_depth;
+		return info;
+	}
+
+	bool isReferenced(const EntityReadObject& read_object, int tag)
+	{
+		const std::string tag_str = "#" + std::to_string(tag);
+		for (const std::string& arg : read_object.arguments)
+		{
+			size_t pos = arg.find(tag_str);
+			while (pos != std::string::npos)
+			{
+				const size_t end = pos + tag_str.size();
+				if (end == arg.size() || !isdigit((unsigned char)arg[end]))
+				{
+					return true;
+				}
+				pos = arg.find(tag_str, end);
+			}
+		}
+		return false;
+	}
+}
+
+int ClassInfo::findAttribute(const std::string& name) const
+{
+	for (size_t ii = 0; ii < attributes.size(); ++ii)
+	{
+		if (std_iequal(attributes[ii].name, name))
+		{
+			return int(ii);
+		}
+	}
+	return -1;
+}
+
+bool isNumber(const std::string& str)
+{
+	if (str.empty())
+	{
+		return false;
+	}
+	char* end = nullptr;
+	strtod(str.c_str(), &end);
+	return end == str.c_str() + str.size();
+}
+
+std::string formatLiteral(const std::string& value, ValueKind kind)
+{
+	switch (kind)
+	{
+	case VALUE_STRING:
+		return "'" + value + "'";
+	case VALUE_ENUM:
+		if (std_iequal(value, "true")) { return ".T."; }
+		if (std_iequal(value, "false")) { return ".F."; }
+		if (std_iequal(value, "unknown")) { return ".U."; }
+		{
+			std::string upper = value;
+			convertStringToUpperCase(upper);
+			return "." + upper + ".";
+		}
+	case VALUE_NUMBER:
+		return value.empty() ? std::string("$") : value;
+	case VALUE_BINARY:
+		return "\"" + value + "\"";
+	default:
+		return isNumber(value) ? value : "'" + value + "'";
+	}
+}
+
+const ClassInfo* AttributeTypeCache::getEntityClass(const std::string& class_name)
+{
+	auto it = m_classes.find(class_name);
+	if (it != m_classes.end())
+	{
+		return it->second.get();
+	}
+
+	std::string class_name_upper = class_name;
+	convertStringToUpperCase(class_name_upper);
+	shared_ptr<BuildingEntity> entity(EntityFactory::createEntityObject(class_name_upper));
+	const SchemaType* schema_type = SchemaInfo::getType(class_name_upper);
+	shared_ptr<ClassInfo> class_info;
+	if (entity && schema_type)
+	{
+		class_info = std::make_shared<ClassInfo>();
+		class_info->class_name_upper = class_name_upper;
+		class_info->schema_type = schema_type;
+		class_info->num_arguments = entity->getNumAttributes();
+		std::vector<std::pair<std::string, shared_ptr<BuildingObject> > > vec_attributes;
+		entity->getAttributes(vec_attributes);
+		for (size_t ii = 0; ii < vec_attributes.size() && ii < class_info->num_arguments && ii < schema_type->attributes.size(); ++ii)
+		{
+			const SchemaAttribute& schema_attribute = schema_type->attributes[ii];
+			AttributeInfo attribute;
+			attribute.name = vec_attributes[ii].first;
+			attribute.type = schema_attribute.type;
+			attribute.is_list = schema_attribute.list_depth > 0;
+			attribute.value = getValueInfo(schema_attribute.type, schema_attribute.list_depth);
+			class_info->attributes.push_back(attribute);
+		}
+	}
+	m_classes[class_name] = class_info;
+	return class_info.get();
+}
+
+const ValueInfo& AttributeTypeCache::getTypeInfo(const std::string& type_name_upper)
+{
+	auto it = m_types.find(type_name_upper);
+	if (it != m_types.end())
+	{
+		return it->second;
+	}
+	return m_types[type_name_upper] = getValueInfo(SchemaInfo::getType(type_name_upper), 0);
+}
+
+void AttributeTypeCache::resolveBackReferences(std::vector<EntityReadObject>& entities, std::vector<BackReference>& back_references)
+{
+	if (back_references.empty())
+	{
+		return;
+	}
+
+	std::unordered_map<int, size_t> map_tag_index;
+	map_tag_index.reserve(entities.size());
+	for (size_t ii = 0; ii < entities.size(); ++ii)
+	{
+		map_tag_index[entities[ii].entity->m_tag] = ii;
+	}
+
+	std::stable_sort(back_references.begin(), back_references.end(), [](const BackReference& a, const BackReference& b) { return a.child_tag < b.child_tag; });
+
+	for (size_t ii = 0; ii < back_references.size(); )
+	{
+		size_t run_end = ii + 1;
+		while (run_end < back_references.size() && back_references[run_end].child_tag == back_references[ii].child_tag)
+		{
+			++run_end;
+		}
+
+		auto it_child = map_tag_index.find(back_references[ii].child_tag);
+		if (it_child != map_tag_index.end())
+		{
+			EntityReadObject& child = entities[it_child->second];
+			std::vector<int> parent_tags;
+			shared_ptr<BuildingEntity> parent_entity;
+			for (size_t jj = ii; jj < run_end; ++jj)
+			{
+				const shared_ptr<BuildingEntity>& parent = entities[back_references[jj].parent_index].entity;
+				if (!isReferenced(child, parent->m_tag) && std::find(parent_tags.begin(), parent_tags.end(), parent->m_tag) == parent_tags.end())
+				{
+					parent_tags.push_back(parent->m_tag);
+					if (!parent_entity)
+					{
+						parent_entity = parent;
+					}
+				}
+			}
+
+			if (parent_entity)
+			{
+				setBackReference(child, parent_entity, parent_tags);
+			}
+		}
+		ii = run_end;
+	}
+	back_references.clear();
+}
+
+void AttributeTypeCache::setBackReference(EntityReadObject& child, const shared_ptr<BuildingEntity>& parent, const std::vector<int>& parent_tags)
+{
+	const ClassInfo& class_info = *child.class_info;
+	std::vector<std::pair<size_t, bool> >& candidates = m_back_reference_attributes[std::make_pair(&class_info, parent->classID())];
+	if (candidates.empty())
+	{
+		// attributes that accept the parent as single reference or in a list
+		std::string parent_class_upper = EntityFactory::getStringForClassID(parent->classID());
+		convertStringToUpperCase(parent_class_upper);
+		const SchemaType* parent_type = SchemaInfo::getType(parent_class_upper);
+		for (size_t ii = 0; ii < class_info.attributes.size(); ++ii)
+		{
+			if (class_info.attributes[ii].value.kind == VALUE_OTHER && SchemaInfo::isAssignable(parent_type, class_info.attributes[ii].type))
+			{
+				candidates.emplace_back(ii, class_info.attributes[ii].is_list);
+			}
+		}
+		if (candidates.empty())
+		{
+			candidates.emplace_back(SIZE_MAX, false);
+		}
+	}
+
+	for (const std::pair<size_t, bool>& candidate : candidates)
+	{
+		if (candidate.first == SIZE_MAX || child.arguments[candidate.first] != "$")
+		{
+			continue;
+		}
+
+		std::string& arg = child.arguments[candidate.first];
+		if (candidate.second)
+		{
+			arg = "(";
+			for (size_t ii = 0; ii < parent_tags.size(); ++ii)
+			{
+				arg += (ii > 0 ? ",#" : "#") + std::to_string(parent_tags[ii]);
+			}
+			arg += ")";
+		}
+		else
+		{
+			arg = "#" + std::to_string(parent_tags[0]);
+		}
+		return;
+	}
+}
+
+void readEntityArguments(std::vector<EntityReadObject>& vec_entities, shared_ptr<BuildingModel>& targetModel, StatusCallback* status, std::stringstream& err)
+{
+	for (EntityReadObject& read_object : vec_entities)
+	{
+		targetModel->insertEntity(read_object.entity);
+	}
+
+	// now all entities exist, so the references can be resolved. Every entity can be initialized independently in parallel
+	const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map_entities = targetModel->getMapIfcEntities();
+	const size_t num_objects = vec_entities.size();
+	std::unordered_set<int> entityIdNotFoundAll;
+	std::mutex mutexProgress;
+	std::mutex mutexError;
+	std::mutex mutexEntityIdNotFound;
+	std::atomic<size_t> num_read(0);
+	double last_progress = 0.3;
+	StringPool* string_pool = targetModel->getStringPool().get();
+
+	FOR_EACH_LOOP vec_entities.begin(), vec_entities.end(), [&](EntityReadObject& read_object) {
+			if (targetModel->isLoadingCancelled())
+			{
+				return;
+			}
+
+			StringPoolScope string_pool_scope(string_pool);
+			std::stringstream errorStream;
+			std::unordered_set<int> entityIdNotFound;
+			const shared_ptr<BuildingEntity>& entity = read_object.entity;
+
+			try
+			{
+				entity->readStepArguments(read_object.arguments, map_entities, errorStream, entityIdNotFound);
+			}
+			catch (std::exception& e)
+			{
+				errorStream << "#" << entity->m_tag << "=" << EntityFactory::getStringForClassID(entity->classID()) << ": " << e.what() << std::endl;
+			}
+			catch (...)
+			{
+				errorStream << "#" << entity->m_tag << "=" << EntityFactory::getStringForClassID(entity->classID()) << " readStepArguments: error occurred" << std::endl;
+			}
+			std::vector<std::string>().swap(read_object.arguments);
+
+			if (entityIdNotFound.size() > 0)
+			{
+				const std::lock_guard<std::mutex> lock(mutexEntityIdNotFound);
+				entityIdNotFoundAll.insert(entityIdNotFound.begin(), entityIdNotFound.end());
+			}
+
+			if (errorStream.tellp() > 0)
+			{
+				const std::lock_guard<std::mutex> lock(mutexError);
+				err << errorStream.str();
+			}
+
+			const size_t ii = ++num_read;
+			if (ii % 1000 == 0)
+			{
+				const std::lock_guard<std::mutex> lock(mutexProgress);
+				const double progress = 0.3 + 0.6 * double(ii) / double(num_objects);
+				if (progress - last_progress > 0.03)
+				{
+					status->progressValueCallback(progress, "parse");
+					last_progress = progress;
+				}
+			}
+		});
+	vec_entities.clear();
+
+	if (entityIdNotFoundAll.size() > 0)
+	{
+		err << "Entity with id # ";
+		for (auto it = entityIdNotFoundAll.begin(); it != entityIdNotFoundAll.end(); ++it)
+		{
+			if (it != entityIdNotFoundAll.begin())
+			{
+				err << ", ";
+			}
+			err << *it;
+		}
+		err << "  not found" << std::endl;
+	}
+}
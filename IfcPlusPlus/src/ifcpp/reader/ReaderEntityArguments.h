@@ -0,0 +1,106 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "ifcpp/model/BasicTypes.h"
+#include "ifcpp/model/BuildingObject.h"
+#include "ifcpp/model/BuildingModel.h"
+#include "ifcpp/model/StatusCallback.h"
+#include "ifcpp/IFC4X3/SchemaInfo.h"
+
+// Shared by the readers of formats other than STEP (ifcXML, ifcJSON): they convert each entity into STEP arguments,
+// and then initialize all entities with readStepArguments, like ReaderSTEP.
+
+/// How a value is written as STEP argument
+enum ValueKind : uint8_t { VALUE_OTHER, VALUE_STRING, VALUE_ENUM, VALUE_NUMBER, VALUE_BINARY };
+
+struct ValueInfo
+{
+	ValueKind kind = VALUE_OTHER;	// VALUE_OTHER: entity references, select types, or unknown
+	int list_depth = 0;
+};
+
+struct AttributeInfo
+{
+	std::string name;
+	const IFC4X3::SchemaType* type = nullptr;	// declared type
+	ValueInfo value;
+	bool is_list = false;
+};
+
+struct ClassInfo
+{
+	std::string class_name_upper;
+	const IFC4X3::SchemaType* schema_type = nullptr;
+	size_t num_arguments = 0;
+	std::vector<AttributeInfo> attributes;
+
+	/// index of the attribute with the given name, case insensitive. -1 if there is no such attribute
+	int findAttribute(const std::string& name) const;
+};
+
+struct EntityReadObject
+{
+	shared_ptr<BuildingEntity> entity;
+	const ClassInfo* class_info = nullptr;
+	std::vector<std::string> arguments;
+};
+
+/// entity that is given inside an inverse attribute, for example IfcRelAggregates inside IsDecomposedBy of the relating object
+struct BackReference
+{
+	int child_tag;
+	size_t parent_index;
+};
+
+bool isNumber(const std::string& str);
+
+/// converts a single value into a STEP argument, for example 'text', .ENUM. or 2.5
+std::string formatLiteral(const std::string& value, ValueKind kind);
+
+/// Attribute types of the entity classes, from IFC4X3::SchemaInfo, together with the attribute names of getAttributes.
+/// The results are cached per class. Not thread safe, it is used in the sequential first pass of the readers.
+class AttributeTypeCache
+{
+public:
+	/// class of an entity, for example IfcWall. nullptr if the name is not an entity of the schema
+	const ClassInfo* getEntityClass(const std::string& class_name);
+
+	/// kind of value of a defined type, for example IFCLABEL
+	const ValueInfo& getTypeInfo(const std::string& type_name_upper);
+
+	/// Entities in inverse attributes omit the reference to the enclosing entity, for example the RelatingObject of an IfcRelAggregates in IsDecomposedBy.
+	/// It is set to the first attribute that is not given and that accepts the enclosing entity. A list attribute gets all enclosing entities.
+	void resolveBackReferences(std::vector<EntityReadObject>& entities, std::vector<BackReference>& back_references);
+
+private:
+	void setBackReference(EntityReadObject& child, const shared_ptr<BuildingEntity>& parent, const std::vector<int>& parent_tags);
+
+	std::unordered_map<std::string, shared_ptr<ClassInfo> > m_classes;
+	std::unordered_map<std::string, ValueInfo> m_types;
+	std::map<std::pair<const ClassInfo*, uint32_t>, std::vector<std::pair<size_t, bool> > > m_back_reference_attributes;
+};
+
+/// Second pass: inserts the entities into the model and initializes them in parallel with readStepArguments. Errors are appended to err
+void readEntityArguments(std::vector<EntityReadObject>& entities, shared_ptr<BuildingModel>& model, StatusCallback* status, std::stringstream& err);
@@ -0,0 +1,562 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <clocale>
+#include <cstdio>
+#include <functional>
+#include <map>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <external/RapidJSON/error/en.h>
+#include <external/RapidJSON/filereadstream.h>
+#include <external/RapidJSON/istreamwrapper.h>
+#include <external/RapidJSON/reader.h>
+
+#include <ifcpp/model/BasicTypes.h>
+#include <ifcpp/model/BuildingModel.h>
+#include <ifcpp/model/BuildingException.h>
+#include <ifcpp/IFC4X3/EntityFactory.h>
+#include <ifcpp/writer/WriterUtil.h>
+
+#include "ReaderEntityArguments.h"
+#include "ReaderUtil.h"
+#include "ReaderJSON.h"
+
+using namespace IFC4X3;
+
+namespace
+{
+	/// Value of the entity that is currently read. Inline entities are replaced by a reference as soon as they are complete
+	struct JsonNode
+	{
+		enum NodeType : uint8_t { NODE_NULL, NODE_BOOL, NODE_NUMBER, NODE_STRING, NODE_ARRAY, NODE_OBJECT, NODE_ENTITY_REF };
+
+		NodeType type = NODE_NULL;
+		bool boolean = false;
+		bool is_inline_entity = false;		// NODE_ENTITY_REF: the entity was given here, not referenced
+		bool is_entity_list = false;		// NODE_ARRAY: the "data" array, its objects are entities
+		int tag = -1;
+		std::string text;					// NODE_STRING and NODE_NUMBER
+		std::vector<std::string> keys;		// NODE_OBJECT: one key per item
+		std::vector<JsonNode> items;
+
+		const JsonNode* findMember(const char* key) const
+		{
+			for (size_t ii = 0; ii < keys.size(); ++ii)
+			{
+				if (keys[ii] == key)
+				{
+					return &items[ii];
+				}
+			}
+			return nullptr;
+		}
+
+		const std::string* findString(const char* key) const
+		{
+			const JsonNode* member = findMember(key);
+			return member && member->type == NODE_STRING ? &member->text : nullptr;
+		}
+	};
+
+	/// First pass: SAX handler that creates the entities with their STEP arguments
+	class IfcJsonReadPass : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, IfcJsonReadPass>
+	{
+	public:
+		IfcJsonReadPass(StatusCallback* status, shared_ptr<BuildingModel>& model, std::streampos file_size) : m_status(status), m_model(model), m_file_size(file_size) {}
+
+		std::vector<EntityReadObject> m_entities;
+		std::map<std::string, std::string> m_header_fields;
+		BuildingModel::SchemaVersionEnum m_schema_version = BuildingModel::IFC_VERSION_UNDEFINED;
+		std::stringstream m_err;
+		std::stringstream m_err_unknown_entity;
+		bool m_cancelled = false;
+		std::function<size_t()> m_tell;	// bytes read so far, for the progress
+
+		void finish()
+		{
+			m_type_cache.resolveBackReferences(m_entities, m_back_references);
+		}
+
+		bool Null()
+		{
+			return addValue(JsonNode());
+		}
+
+		bool Bool(bool b)
+		{
+			JsonNode node;
+			node.type = JsonNode::NODE_BOOL;
+			node.boolean = b;
+			return addValue(std::move(node));
+		}
+
+		bool RawNumber(const char* str, rapidjson::SizeType length, bool)
+		{
+			JsonNode node;
+			node.type = JsonNode::NODE_NUMBER;
+			node.text.assign(str, length);
+			return addValue(std::move(node));
+		}
+
+		bool String(const char* str, rapidjson::SizeType length, bool)
+		{
+			JsonNode node;
+			node.type = JsonNode::NODE_STRING;
+			node.text.assign(str, length);
+			return addValue(std::move(node));
+		}
+
+		bool Key(const char* str, rapidjson::SizeType length, bool)
+		{
+			m_stack.back().keys.emplace_back(str, length);
+			return true;
+		}
+
+		bool StartObject()
+		{
+			m_stack.emplace_back();
+			m_stack.back().type = JsonNode::NODE_OBJECT;
+			return true;
+		}
+
+		bool EndObject(rapidjson::SizeType)
+		{
+			JsonNode node = std::move(m_stack.back());
+			m_stack.pop_back();
+			if (m_stack.empty())
+			{
+				readHeader(node);
+				return true;
+			}
+
+			if (m_stack.back().is_entity_list)
+			{
+				createEntity(node);
+				if (++m_num_top_level_entities % 10000 == 0)
+				{
+					if (m_model->isLoadingCancelled())
+					{
+						m_cancelled = true;
+						return false;
+					}
+					if (m_tell)
+					{
+						m_status->progressValueCallback(0.05 + 0.25 * double(m_tell()) / double(std::max(std::streamoff(1), std::streamoff(m_file_size))), "parse");
+					}
+				}
+				return true;
+			}
+
+			const std::string* ref = node.findString("ref");
+			if (ref)
+			{
+				JsonNode ref_node;
+				ref_node.type = JsonNode::NODE_ENTITY_REF;
+				ref_node.tag = getTagForId(*ref);
+				return addValue(std::move(ref_node));
+			}
+
+			// entity given inline, for example an IfcCartesianPoint in the location of an IfcAxis2Placement3D
+			const std::string* type = node.findString("type");
+			if (type && m_type_cache.getEntityClass(*type))
+			{
+				JsonNode ref_node;
+				ref_node.type = JsonNode::NODE_ENTITY_REF;
+				ref_node.tag = createEntity(node);
+				ref_node.is_inline_entity = true;
+				return addValue(std::move(ref_node));
+			}
+			return addValue(std::move(node));
+		}
+
+		bool StartArray()
+		{
+			// entities are in the "data" array of the root object, or in the root array
+			const bool is_entity_list = m_stack.empty() || (m_stack.size() == 1 && !m_stack.back().keys.empty() && m_stack.back().keys.back() == "data");
+			m_stack.emplace_back();
+			m_stack.back().type = JsonNode::NODE_ARRAY;
+			m_stack.back().is_entity_list = is_entity_list;
+			return true;
+		}
+
+		bool EndArray(rapidjson::SizeType)
+		{
+			JsonNode node = std::move(m_stack.back());
+			m_stack.pop_back();
+			if (m_stack.empty() || node.is_entity_list)
+			{
+				if (!m_stack.empty())
+				{
+					// the key "data" has no item
+					m_stack.back().keys.pop_back();
+				}
+				return true;
+			}
+			return addValue(std::move(node));
+		}
+
+	private:
+		bool addValue(JsonNode&& node)
+		{
+			if (m_stack.empty() || m_stack.back().is_entity_list)
+			{
+				return true;
+			}
+			m_stack.back().items.push_back(std::move(node));
+			return true;
+		}
+
+		void readHeader(const JsonNode& root)
+		{
+			for (size_t ii = 0; ii < root.keys.size() && ii < root.items.size(); ++ii)
+			{
+				const JsonNode& item = root.items[ii];
+				if (item.type == JsonNode::NODE_STRING)
+				{
+					m_header_fields[root.keys[ii]] = item.text;
+				}
+			}
+
+			auto it = m_header_fields.find("schemaIdentifier");
+			if (it != m_header_fields.end())
+			{
+				std::string value = it->second;
+				convertStringToUpperCase(value);
+				if (value.find("IFC4X3") != std::string::npos) { m_schema_version = BuildingModel::IFC4X3; }
+				else if (value.find("IFC4X1") != std::string::npos) { m_schema_version = BuildingModel::IFC4X1; }
+				else if (value.find("IFC4") != std::string::npos) { m_schema_version = BuildingModel::IFC4; }
+				else if (value.find("IFC2X3") != std::string::npos) { m_schema_version = BuildingModel::IFC2X3; }
+			}
+		}
+
+		int newTag()
+		{
+			while (m_used_tags.find(m_next_free_tag) != m_used_tags.end())
+			{
+				++m_next_free_tag;
+			}
+			m_used_tags.insert(m_next_free_tag);
+			return m_next_free_tag++;
+		}
+
+		int getTagForId(const std::string& id)
+		{
+			auto it = m_map_id_tag.find(id);
+			if (it != m_map_id_tag.end())
+			{
+				return it->second;
+			}
+
+			// keep the number of ids like "i123", so that the tags are the same as in the STEP file that the ifcJSON file was created from
+			int tag = -1;
+			if (id.size() > 1 && id.size() < 10 && !isdigit((unsigned char)id[0]) && std::all_of(id.begin() + 1, id.end(), [](char c) { return isdigit((unsigned char)c); }))
+			{
+				tag = atoi(id.c_str() + 1);
+				if (!m_used_tags.insert(tag).second)
+				{
+					tag = -1;
+				}
+			}
+			if (tag < 0)
+			{
+				tag = newTag();
+			}
+			m_map_id_tag[id] = tag;
+			return tag;
+		}
+
+		/// creates the entity and converts its attributes into STEP arguments. Returns the tag of the entity, or -1 if it is not an entity of the schema
+		int createEntity(const JsonNode& node)
+		{
+			const std::string* type = node.findString("type");
+			if (!type)
+			{
+				return -1;
+			}
+
+			const ClassInfo* class_info = m_type_cache.getEntityClass(*type);
+			if (!class_info)
+			{
+				if (m_unknown_entities.insert(*type).second)
+				{
+					m_err_unknown_entity << "unknown IFC entity: " << *type << std::endl;
+				}
+				return -1;
+			}
+
+			const std::string* id = node.findString("id");
+			const std::string* global_id = node.findString("globalId");
+			int tag = -1;
+			if (id)
+			{
+				tag = getTagForId(*id);
+				if (global_id && m_map_id_tag.find(*global_id) == m_map_id_tag.end())
+				{
+					m_map_id_tag[*global_id] = tag;
+				}
+			}
+			else if (global_id)
+			{
+				tag = getTagForId(*global_id);
+			}
+			else
+			{
+				tag = newTag();
+			}
+
+			shared_ptr<BuildingEntity> entity(EntityFactory::createEntityObject(class_info->class_name_upper));
+			entity->m_tag = tag;
+
+			EntityReadObject read_object;
+			read_object.entity = entity;
+			read_object.class_info = class_info;
+			read_object.arguments.assign(class_info->num_arguments, "$");
+
+			const size_t entity_index = m_entities.size();
+			for (size_t ii = 0; ii < node.keys.size() && ii < node.items.size(); ++ii)
+			{
+				const std::string& key = node.keys[ii];
+				if (key == "type" || key == "id")
+				{
+					continue;
+				}
+
+				const int attribute_index = class_info->findAttribute(key);
+				if (attribute_index < 0)
+				{
+					// inverse attribute. Entities that are given inline here need the reference back to this entity
+					addBackReferences(node.items[ii], entity_index);
+					continue;
+				}
+				const AttributeInfo& attribute = class_info->attributes[attribute_index];
+				read_object.arguments[attribute_index] = formatNode(node.items[ii], attribute.value, attribute.is_list);
+			}
+			m_entities.push_back(std::move(read_object));
+			return tag;
+		}
+
+		void addBackReferences(const JsonNode& node, size_t entity_index)
+		{
+			if (node.type == JsonNode::NODE_ENTITY_REF && node.is_inline_entity && node.tag >= 0)
+			{
+				m_back_references.push_back({ node.tag, entity_index });
+			}
+			else if (node.type == JsonNode::NODE_ARRAY)
+			{
+				for (const JsonNode& item : node.items)
+				{
+					addBackReferences(item, entity_index);
+				}
+			}
+		}
+
+		/// converts a JSON value into a STEP argument
+		std::string formatNode(const JsonNode& node, const ValueInfo& info, bool is_list)
+		{
+			if (is_list && node.type != JsonNode::NODE_ARRAY && node.type != JsonNode::NODE_NULL)
+			{
+				// single value given for a LIST or SET attribute: list with one element
+				ValueInfo inner_info = info;
+				inner_info.list_depth = std::max(0, info.list_depth - 1);
+				return "(" + formatNode(node, inner_info, inner_info.list_depth > 0) + ")";
+			}
+
+			switch (node.type)
+			{
+			case JsonNode::NODE_BOOL:
+				return node.boolean ? ".T." : ".F.";
+			case JsonNode::NODE_NUMBER:
+				return info.kind == VALUE_STRING ? "'" + node.text + "'" : node.text;
+			case JsonNode::NODE_STRING:
+				return formatLiteral(node.text, info.kind);
+			case JsonNode::NODE_ENTITY_REF:
+				return node.tag >= 0 ? "#" + std::to_string(node.tag) : std::string("$");
+			case JsonNode::NODE_OBJECT:
+				{
+					// value of a select type: {"type": "IfcLabel", "value": "text"}
+					const std::string* type = node.findString("type");
+					const JsonNode* value = node.findMember("value");
+					if (!type || !value)
+					{
+						return "$";
+					}
+					std::string type_name_upper = *type;
+					convertStringToUpperCase(type_name_upper);
+					return type_name_upper + "(" + formatNode(*value, m_type_cache.getTypeInfo(type_name_upper), false) + ")";
+				}
+			case JsonNode::NODE_ARRAY:
+				{
+					ValueInfo inner_info = info;
+					inner_info.list_depth = std::max(0, info.list_depth - 1);
+					std::string result = "(";
+					for (size_t ii = 0; ii < node.items.size(); ++ii)
+					{
+						if (ii > 0)
+						{
+							result += ',';
+						}
+						result += formatNode(node.items[ii], inner_info, false);
+					}
+					result += ")";
+					return result;
+				}
+			default:
+				return "$";
+			}
+		}
+
+		StatusCallback* m_status;
+		shared_ptr<BuildingModel>& m_model;
+		std::streampos m_file_size;
+		size_t m_num_top_level_entities = 0;
+		std::vector<JsonNode> m_stack;
+		AttributeTypeCache m_type_cache;
+		std::unordered_map<std::string, int> m_map_id_tag;
+		std::unordered_set<int> m_used_tags;
+		int m_next_free_tag = 1;
+		std::vector<BackReference> m_back_references;
+		std::unordered_set<std::string> m_unknown_entities;
+	};
+
+	template<typename InputStream>
+	void parseJson(InputStream& is, IfcJsonReadPass& read_pass, std::stringstream& err)
+	{
+		rapidjson::Reader reader;
+		read_pass.m_tell = [&is]() { return is.Tell(); };
+		rapidjson::ParseResult result = reader.Parse<rapidjson::kParseNumbersAsStringsFlag | rapidjson::kParseStopWhenDoneFlag>(is, read_pass);
+		if (read_pass.m_cancelled)
+		{
+			read_pass.m_entities.clear();
+			return;
+		}
+		if (result.IsError())
+		{
+			err << "JSON parse error at offset " << result.Offset() << ": " << rapidjson::GetParseError_En(result.Code()) << std::endl;
+		}
+		read_pass.m_tell = nullptr;
+		read_pass.finish();
+	}
+
+	void loadModelJSON(const std::function<void(IfcJsonReadPass&, std::stringstream&)>& parse, std::streampos file_size, shared_ptr<BuildingModel>& targetModel, StatusCallback* status)
+	{
+		if (!targetModel)
+		{
+			throw BuildingException("Model not set.", __FUNC__);
+		}
+
+		std::string current_numeric_locale(setlocale(LC_NUMERIC, nullptr));
+		setlocale(LC_NUMERIC, "C");
+
+		std::stringstream err;
+		IfcJsonReadPass read_pass(status, targetModel, file_size);
+		try
+		{
+			parse(read_pass, err);
+		}
+		catch (std::exception& e)
+		{
+			err << e.what();
+		}
+		catch (...)
+		{
+			err << __FUNC__ << ": error occurred" << std::endl;
+		}
+		status->progressValueCallback(0.3, "parse");
+
+		if (read_pass.m_err_unknown_entity.tellp() > 0)
+		{
+			status->messageCallback(read_pass.m_err_unknown_entity.str(), StatusCallback::MESSAGE_TYPE_UNKNOWN_ENTITY, __FUNC__);
+		}
+		err << read_pass.m_err.str();
+
+		// header
+		const std::map<std::string, std::string>& header = read_pass.m_header_fields;
+		auto headerField = [&header](const char* name) -> std::string
+		{
+			auto it = header.find(name);
+			// apostrophes, backslashes and non-ASCII characters would break the STEP header
+			return it == header.end() ? std::string() : encodeStepString(it->second);
+		};
+		targetModel->setFileHeader("");
+		targetModel->setFileDescription("FILE_DESCRIPTION(('" + headerField("description") + "'),'2;1')");
+		targetModel->setFileName("FILE_NAME('" + headerField("name") + "','" + headerField("timeStamp") + "',(''),(''),'"
+			+ headerField("preprocessorVersion") + "','" + headerField("originatingSystem") + "','')");
+		targetModel->setIfcSchemaVersionEnumCurrent(read_pass.m_schema_version);
+		status->messageCallback(std::string("Detected IFC version: ") + targetModel->getIfcSchemaVersionCurrent(), StatusCallback::MESSAGE_TYPE_GENERAL_MESSAGE, __FUNC__);
+
+		// currently generated IFC classes are IFC4X3, files with older versions are converted. So after loading, the schema is always IFC4X3
+		targetModel->setIfcSchemaVersionEnumCurrent(BuildingModel::IFC4X3);
+
+		// second pass: now all entities exist, so the references can be resolved
+		readEntityArguments(read_pass.m_entities, targetModel, status, err);
+
+		setlocale(LC_NUMERIC, current_numeric_locale.c_str());
+		if (err.tellp() > 0)
+		{
+			status->messageCallback(err.str(), StatusCallback::MESSAGE_TYPE_ERROR, __FUNC__);
+		}
+
+		targetModel->resolveInverseAttributes();
+		targetModel->updateCache();
+		status->progressValueCallback(1.0, "parse");
+	}
+}
+
+ReaderJSON::ReaderJSON() = default;
+ReaderJSON::~ReaderJSON() = default;
+
+void ReaderJSON::loadModelFromFile(const std::string& filePath, shared_ptr<BuildingModel>& targetModel)
+{
+#ifdef _MSC_VER
+	FILE* file = _wfopen(string2wstring(filePath).c_str(), L"rb");
+#else
+	FILE* file = fopen(filePath.c_str(), "rb");
+#endif
+	if (!file)
+	{
+		std::stringstream strs;
+		strs << "Could not open file: " << filePath.c_str();
+		messageCallback(strs.str().c_str(), StatusCallback::MESSAGE_TYPE_ERROR, __FUNC__);
+		return;
+	}
+
+	fseek(file, 0, SEEK_END);
+	const std::streampos file_end_pos = ftell(file);
+	fseek(file, 0, SEEK_SET);
+
+	loadModelJSON([file](IfcJsonReadPass& read_pass, std::stringstream& err) {
+			std::vector<char> buffer(1 << 16);
+			rapidjson::FileReadStream is(file, buffer.data(), buffer.size());
+			parseJson(is, read_pass, err);
+		}, file_end_pos, targetModel, this);
+	fclose(file);
+}
+
+void ReaderJSON::loadModelFromStream(std::istream& content, std::streampos file_end_pos, shared_ptr<BuildingModel>& targetModel)
+{
+	loadModelJSON([&content](IfcJsonReadPass& read_pass, std::stringstream& err) {
+			std::vector<char> buffer(1 << 16);
+			rapidjson::IStreamWrapper is(content, buffer.data(), buffer.size());
+			parseJson(is, read_pass, err);
+		}, file_end_pos, targetModel, this);
+}
@@ -29,6 +29,7 @@ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OU
 #include <ifcpp/model/BasicTypes.h>
 #include <ifcpp/model/BuildingModel.h>
 #include <ifcpp/model/BuildingException.h>
+#include <ifcpp/model/StringPool.h>
 #include <ifcpp/model/UnknownEntityException.h>
 #include <ifcpp/IFC4X3/EntityFactory.h>
 #include <IfcBuilding.h>
@@ -61,8 +62,10 @@ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OU
 
 #include <external/zippy/zippy.hpp>
 
+#include "ReaderJSON.h"
 #include "ReaderUtil.h"
 #include "ReaderSTEP.h"
+#include "ReaderXML.h"
 
 using namespace IFC4X3;
 
@@ -82,8 +85,16 @@ void ReaderSTEP::loadModelFromFile(const std::string& filePath, shared_ptr<Build
 	}
 	else if (std_iequal(ext, ".ifcXML"))
 	{
-		// TODO: implement xml reader
-		messageCallback("ifcXML not yet implemented", StatusCallback::MESSAGE_TYPE_ERROR, __FUNC__);
+		ReaderXML reader_xml;
+		reader_xml.setMessageTarget(this);
+		reader_xml.loadModelFromFile(filePath, targetModel);
+		return;
+	}
+	else if (std_iequal(ext, ".ifcJSON") || std_iequal(ext, ".json"))
+	{
+		ReaderJSON reader_json;
+		reader_json.setMessageTarget(this);
+		reader_json.loadModelFromFile(filePath, targetModel);
 		return;
 	}
 	else if (std_iequal(ext, ".ifcZIP") || std_iequal(ext, ".zip"))
@@ -563,6 +574,7 @@ void ReaderSTEP::readEntityArguments(std::vector<std::pair<std::string, shared_p
 	std::mutex mutexError;
 	std::mutex mutexEntityIdNotFound;
 	int i = 0;
+	StringPool* string_pool = model->getStringPool().get();
 
 #ifdef _DEBUG
 	std::unordered_set<std::string> setClassesWithAdjustedArguments;
@@ -579,17 +591,16 @@ void ReaderSTEP::readEntityArguments(std::vector<std::pair<std::string, shared_p
 			{
 				return;
 			}
+			StringPoolScope string_pool_scope(string_pool);
 			std::stringstream errorStream;
 			std::unordered_set<int> entityIdNotFound;
 			std::string& argument_str = entity_read_object.first;
-			std::vector<std::string> arguments_raw;
-			tokenizeEntityArguments(argument_str, arguments_raw);
+			std::vector<std::string> arguments_decoded;
+			tokenizeEntityArguments(argument_str, arguments_decoded);
 			argument_str.clear();
 
 			// character decoding:
-			std::vector<std::string> arguments_decoded;
-			decodeArgumentStrings(arguments_raw, arguments_decoded);
-			arguments_raw.clear();
+			decodeArgumentStrings(arguments_decoded);
 
 			const size_t num_expected_arguments = entity->getNumAttributes();
 			if (entity->classID() == IFCCOLOURRGB)
@@ -702,6 +713,14 @@ void ReaderSTEP::readEntityArguments(std::vector<std::pair<std::string, shared_p
 			++i;
 		});
 
+	if (string_pool && string_pool->getNumLookups() > 0)
+	{
+		std::stringstream strs;
+		strs << "string pool: " << string_pool->getNumDistinctValues() << " distinct values, " << string_pool->getNumSharedValues() << " of " << string_pool->getNumLookups()
+			<< " values shared, approx. " << string_pool->getNumBytesSaved() / 1024 << " kB saved";
+		messageCallback(strs.str(), StatusCallback::MESSAGE_TYPE_GENERAL_MESSAGE, __FUNC__);
+	}
+
 	for (auto it = vec_entities.begin(); it != vec_entities.end(); ++it)
 	{
 		if (model->isLoadingCancelled())
@@ -17,6 +17,7 @@ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OU
 
 #define _USE_MATH_DEFINES
 #include <cmath>
+#include <cstring>
 #include <iostream>
 #include <limits>
 #include <locale>
@@ -24,6 +25,7 @@ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OU
 #include <codecvt>
 
 #include "ifcpp/model/BuildingException.h"
+#include "ifcpp/model/StringPool.h"
 #include "ReaderUtil.h"
 
 #ifndef CP_UTF8
@@ -37,32 +39,28 @@ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OU
 #include <codecvt>
 #endif
 
-template <typename T>
-static T convertToHex(unsigned char mc)
+namespace
 {
-	if (mc >= '0' && mc <= '9')
+	struct HexDigitTable
 	{
-		return static_cast<T>(mc) - static_cast<T>('0');
-	}
-	else if (mc >= 'A' && mc <= 'F')
-	{
-		return 10 + static_cast<T>(mc) - static_cast<T>('A');
-	}
-	else if (mc >= 'a' && mc <= 'f')
-	{
-		return 10 + static_cast<T>(mc) - static_cast<T>('a');
-	}
-
-	return 0;
+		// characters that are not hexadecimal digits have the value 0
+		uint8_t value[256] = {};
+		constexpr HexDigitTable()
+		{
+			for (int ii = 0; ii < 10; ++ii)
+			{
+				value['0' + ii] = uint8_t(ii);
+			}
+			for (int ii = 0; ii < 6; ++ii)
+			{
+				value['A' + ii] = uint8_t(10 + ii);
+				value['a' + ii] = uint8_t(10 + ii);
+			}
+		}
+	};
+	constexpr HexDigitTable s_hexDigits;
 }
 
-//static char Hex2Char(unsigned char h1, unsigned char h2)
-//{
-//	// Combine the Unicode values into a single wchar_t
-//	char returnValue = (convertToHex(h1) << 4) + convertToHex(h2);
-//	return (returnValue);
-//}
-
 std::string wstring2string(const std::wstring& wstr)
 {
 	if (wstr.empty()) return std::string();
@@ -1074,193 +1072,197 @@ static char16_t checkAndConvertAppleEncoding(char16_t input)
 	return input;
 }
 
-void decodeArgumentString(const std::string& argument_str, std::string& arg_out)
+static void appendUtf8(char*& out, uint32_t codePoint)
 {
-	const size_t arg_length = argument_str.length();
-	if (arg_length == 0)
+	if (codePoint < 0x80)
 	{
-		return;
+		*out++ = char(codePoint);
+	}
+	else if (codePoint < 0x800)
+	{
+		*out++ = char(0xC0 | (codePoint >> 6));
+		*out++ = char(0x80 | (codePoint & 0x3F));
+	}
+	else if (codePoint < 0x10000)
+	{
+		*out++ = char(0xE0 | (codePoint >> 12));
+		*out++ = char(0x80 | ((codePoint >> 6) & 0x3F));
+		*out++ = char(0x80 | (codePoint & 0x3F));
 	}
+	else
+	{
+		*out++ = char(0xF0 | (codePoint >> 18));
+		*out++ = char(0x80 | ((codePoint >> 12) & 0x3F));
+		*out++ = char(0x80 | ((codePoint >> 6) & 0x3F));
+		*out++ = char(0x80 | (codePoint & 0x3F));
+	}
+}
 
-	std::string arg_str_new;
+static inline bool isEndOfHexRun(const char* pos, const char* end)
+{
+	// \X0\ terminates \X2\ and \X4\ runs
+	return end - pos >= 4 && pos[1] == 'X' && pos[2] == '0' && pos[3] == '\\';
+}
 
-	char* stream_pos = const_cast<char*>(argument_str.c_str());		// ascii characters from STEP file
-	while (*stream_pos != '\0')
+/*\brief Decodes the escape sequences of a STEP string into buffer, which is resized as needed.
+  \return false if the string can be used as it is, because it contains no escape sequence (or a malformed \X2\ run, which is kept as it was).
+**/
+static bool decodeStepEscapes(const char* begin, const char* end, std::string& buffer)
+{
+	// memchr is vectorized in the C runtime libraries, so clean strings and the plain parts between escape sequences are passed over in bulk
+	const char* pos = begin;
+	const char* backslash = static_cast<const char*>(memchr(pos, '\\', end - pos));
+	if (!backslash)
 	{
-		if (*stream_pos == '\\')
+		return false;
+	}
+
+	// each escape sequence is at least as long as the UTF-8 characters it stands for, so the decoded string fits into the length of the input
+	buffer.resize(end - begin);
+	char* const out_begin = &buffer[0];
+	char* out = out_begin;
+
+	while (backslash)
+	{
+		memcpy(out, pos, backslash - pos);
+		out += backslash - pos;
+		pos = backslash;
+		const ptrdiff_t remaining = end - pos;
+		const char c1 = remaining > 1 ? pos[1] : '\0';
+		const char c2 = remaining > 2 ? pos[2] : '\0';
+
+		if (c1 == 'S' && c2 == '\\' && remaining > 3)
 		{
-			char c1 = *(stream_pos + 1);
-			if (c1 == 'S')
+			// \S\ for example 'Heizk\S\vrper': the next character code v shall be interpreted as v + 128
+			const char first = pos[3];
+			if (remaining > 4 && pos[4] == '\\')
 			{
-				// we have \S
-				char c2 = *(stream_pos + 2);
-				if (c2 == '\\')
+				if (remaining > 7 && (pos[5] == 'S' || pos[5] == 'Q') && pos[6] == '\\')
 				{
-					// we have '\S\', for example 'Heizk\S\vrper'
-					char c3 = *(stream_pos + 3);
-					if (c3 != '\0')
-					{
-						char c4 = *(stream_pos + 4);
-						if (c4 == '\\')
-						{
-							// we have '\S\ . \'
-							char c5 = *(stream_pos + 5);
-							if (c5 == 'S')
-							{
-								if (*(stream_pos + 6) == '\\')
-								{
-									if (*(stream_pos + 7) != '\0')
-									{
-										char first = c3;
-										char second = *(stream_pos + 7);
-										char append_char = char(125 + first + second);
-										arg_str_new += append_char;
-										stream_pos += 8;
-										continue;
-									}
-								}
-							}
-							else if (c5 == 'Q')
-							{
-								if (*(stream_pos + 6) == '\\')
-								{
-									if (*(stream_pos + 7) != '\0')
-									{
-										char first = c3;
-										char second = *(stream_pos + 7);
-										char append_char = char(125 + first + second);
-										arg_str_new += append_char;
-										stream_pos += 8;
-										continue;
-									}
-								}
-							}
-						}
-						else
-						{
-							// next characters code value v shall be interpreted as v + 128
-							char first = c3;
-							char append_char = char(128 + first);
-							uint8_t charAsUint = append_char;
-							arg_str_new.push_back(0xc0 | charAsUint >> 6);
-							arg_str_new.push_back(0x80 | (charAsUint & 0x3f));
-
-							stream_pos += 4;
-							continue;
-						}
-					}
+					*out++ = char(125 + first + pos[7]);
+					pos += 8;
 				}
+				else
+				{
+					*out++ = '\\';
+					++pos;
+				}
+			}
+			else
+			{
+				appendUtf8(out, uint8_t(128 + first));
+				pos += 4;
 			}
-			else if (c1 == 'X')
+		}
+		else if (c1 == 'X' && c2 == '\\' && remaining > 4)
+		{
+			// \X\hh: one octet of ISO 8859-1
+			uint32_t codePoint = (s_hexDigits.value[uint8_t(pos[3])] << 4) | s_hexDigits.value[uint8_t(pos[4])];
+			if (codePoint >= 0x80 && codePoint <= 0x9F)
 			{
-				char c2 = *(stream_pos + 2);
-				if (c2 == '\\')
+				codePoint = checkAndConvertAppleEncoding(char16_t(codePoint));
+			}
+			appendUtf8(out, codePoint);
+			pos += 5;
+		}
+		else if (c1 == 'X' && c2 == '0' && remaining > 3 && pos[3] == '\\')
+		{
+			pos += 4;
+		}
+		else if (c1 == 'X' && (c2 == '2' || c2 == '4') && remaining > 3 && pos[3] == '\\')
+		{
+			// \X2\ is followed by multiples of four hexadecimal characters, encoding UTF-16 code units, for example pot\X2\00EA\X0\ncia.
+			// \X4\ is followed by multiples of eight hexadecimal characters, each one a code point. \X0\ terminates the run in both cases.
+			const ptrdiff_t numDigits = c2 == '2' ? 4 : 8;
+			pos += 4;
+			uint32_t pendingHighSurrogate = 0;
+			while (end - pos >= numDigits && *pos != '\\')
+			{
+				uint32_t codeUnit = 0;
+				for (ptrdiff_t ii = 0; ii < numDigits; ++ii)
 				{
-					// we have \\X\\Unicode code points
-
-					char codePoint1 = *(stream_pos + 3);
-					char codePoint2 = *(stream_pos + 4);
-					codePoint1 = convertToHex<char>(codePoint1);
-					codePoint2 = convertToHex<char>(codePoint2);
-
-					// Combine the Unicode values into a single char
-					char combined[2];
-					combined[0] = (codePoint1 << 4) | codePoint2;
-					combined[1] = 0;
-					char16_t* combined16 = reinterpret_cast<char16_t*>(combined);
-					if (combined16[0] >= 0x80 && combined16[0] <= 0x9F)
-					{
-						combined16[0] = checkAndConvertAppleEncoding(combined16[0]);
-					}
-					std::u16string u16str(combined16, 1);
-					std::wstring_convert<std::codecvt_utf8_utf16<char16_t>, char16_t> convert;
-					std::string utf8 = convert.to_bytes(u16str);
-
-					arg_str_new += utf8;
-					stream_pos += 5;
-					continue;
+					codeUnit = (codeUnit << 4) | s_hexDigits.value[uint8_t(pos[ii])];
 				}
-				else if (c2 == '0')
+				pos += numDigits;
+
+				if (pendingHighSurrogate)
 				{
-					if (*(stream_pos + 3) == '\\')
+					if (codeUnit >= 0xDC00 && codeUnit <= 0xDFFF)
 					{
-						stream_pos += 4;
+						appendUtf8(out, 0x10000 + ((pendingHighSurrogate - 0xD800) << 10) + (codeUnit - 0xDC00));
+						pendingHighSurrogate = 0;
 						continue;
 					}
+					appendUtf8(out, 0xFFFD);
+					pendingHighSurrogate = 0;
 				}
-				else if (c2 == '2')
-				{
-					if (*(stream_pos + 3) == '\\')
-					{
-						// we have \X2\Unicode code points
-						// for example  pot\X2\00EA\X0\ncia
-
-						// the following sequence of multiples of four hexadecimal characters shall be interpreted as encoding the 
-						// two-octet representation of characters from the BMP in ISO 10646
-						
-						stream_pos += 4;
-						std::vector<char> utf16Characters;
-						do
-						{
-							char codePoint1 = *(stream_pos + 0);
-
-							if (codePoint1 == '\\')
-							{
-								char c1 = *(stream_pos + 1);
-								char c2 = *(stream_pos + 2);
-								char c3 = *(stream_pos + 3);
-								if (c1 == 'X' && c2 == '0' && c3 == '\\')
-								{
-									stream_pos += 4;
-									break;
-								}
-								else
-								{
-									// unexpected sequence
-									arg_out = argument_str;
-									return;
-								}
-							}
-
-							char codePoint2 = *(stream_pos + 1);
-							char codePoint3 = *(stream_pos + 2);
-							char codePoint4 = *(stream_pos + 3);
-
-							char c1 = (convertToHex<char>(codePoint1) << 4) | convertToHex<char>(codePoint2);
-							char c2 = (convertToHex<char>(codePoint3) << 4) | convertToHex<char>(codePoint4);
-
-							utf16Characters.push_back(c2);
-							utf16Characters.push_back(c1);
-
-							stream_pos += 4;
 
-						} while ((*stream_pos != '\0'));
-
-						std::u16string u16str(reinterpret_cast<char16_t*>(&utf16Characters[0]), utf16Characters.size() / 2);
-						std::wstring_convert<std::codecvt_utf8_utf16<char16_t>, char16_t> convert;
-						std::string utf8 = convert.to_bytes(u16str);
-						arg_str_new += utf8;
-					}
-					continue;
+				if (codeUnit >= 0xD800 && codeUnit <= 0xDBFF && numDigits == 4)
+				{
+					pendingHighSurrogate = codeUnit;
+				}
+				else if ((codeUnit >= 0xD800 && codeUnit <= 0xDFFF) || codeUnit > 0x10FFFF)
+				{
+					appendUtf8(out, 0xFFFD);
+				}
+				else
+				{
+					appendUtf8(out, codeUnit);
 				}
 			}
-			else if (c1 == 'N')
+
+			if (pendingHighSurrogate)
+			{
+				appendUtf8(out, 0xFFFD);
+			}
+
+			if (pos != end && *pos == '\\')
 			{
-				if (*(stream_pos + 2) == '\\')
+				if (!isEndOfHexRun(pos, end))
 				{
-					arg_str_new.append("\n");
-					stream_pos += 3;
-					continue;
+					// unexpected sequence
+					return false;
 				}
+				pos += 4;
 			}
 		}
+		else if (c1 == 'N' && c2 == '\\')
+		{
+			*out++ = '\n';
+			pos += 3;
+		}
+		else if (c1 == 'P' && c2 >= 'A' && c2 <= 'I' && remaining > 3 && pos[3] == '\\')
+		{
+			// \PA\ to \PI\ select the part of ISO 8859 for following \S\ sequences. Only ISO 8859-1 is supported, so the directive is skipped
+			pos += 4;
+		}
+		else
+		{
+			*out++ = '\\';
+			++pos;
+		}
 
-		char current_char = *stream_pos;
-		arg_str_new += current_char;
-		++stream_pos;
+		backslash = static_cast<const char*>(memchr(pos, '\\', end - pos));
+	}
+
+	memcpy(out, pos, end - pos);
+	out += end - pos;
+	buffer.resize(out - out_begin);
+	return true;
+}
+
+void decodeArgumentString(const std::string& argument_str, std::string& arg_out)
+{
+	if (argument_str.empty())
+	{
+		return;
 	}
 
-	arg_out = arg_str_new;
+	const char* begin = argument_str.data();
+	if (!decodeStepEscapes(begin, begin + argument_str.size(), arg_out))
+	{
+		arg_out = argument_str;
+	}
 }
 
 void decodeArgumentStrings( const std::vector<std::string>& entity_arguments, std::vector<std::string>& args_out)
@@ -1273,12 +1275,39 @@ void decodeArgumentStrings( const std::vector<std::string>& entity_arguments, st
 			continue;
 		}
 
-		std::string decoded;
-		decodeArgumentString(argument_str, decoded);
-		args_out.push_back(decoded);
+		args_out.emplace_back();
+		decodeArgumentString(argument_str, args_out.back());
 	}
 }
 
+void decodeArgumentStrings( std::vector<std::string>& entity_arguments )
+{
+	std::string buffer;
+	size_t numKept = 0;
+	for (size_t ii = 0; ii < entity_arguments.size(); ++ii)
+	{
+		std::string& argument_str = entity_arguments[ii];
+		if (argument_str.empty())
+		{
+			continue;
+		}
+
+		const char* begin = argument_str.data();
+		if (decodeStepEscapes(begin, begin + argument_str.size(), buffer))
+		{
+			// the previous string is kept as buffer for the next argument
+			argument_str.swap(buffer);
+		}
+
+		if (numKept != ii)
+		{
+			entity_arguments[numKept].swap(argument_str);
+		}
+		++numKept;
+	}
+	entity_arguments.resize(numKept);
+}
+
 void readBool(const std::string& attribute_value, bool& target)
 {
 	if (std_iequal(attribute_value, ".F."))
@@ -1345,6 +1374,19 @@ void readString(const std::string& attribute_value, std::string& target)
 	}
 }
 
+void readString(const std::string& attribute_value, SharedString& target)
+{
+	std::string value;
+	readString(attribute_value, value);
+	StringPool* string_pool = StringPool::current();
+	if (string_pool)
+	{
+		target = string_pool->intern(std::move(value));
+		return;
+	}
+	target = std::move(value);
+}
+
 void addArgument(const char* stream_pos, const char*& last_token, std::vector<std::string>& entity_arguments)
 {
 	if (*last_token == ',')
@@ -83,6 +83,9 @@ inline std::string getFileExtension(std::string path)
 IFCQUERY_EXPORT void decodeArgumentString(const std::string& argument_str, std::string& arg_out);
 IFCQUERY_EXPORT void decodeArgumentStrings( const std::vector<std::string>& entity_arguments, std::vector<std::string>& args_out );
 
+/// Decodes the arguments in place and removes empty ones. Arguments without escape sequences are not copied.
+IFCQUERY_EXPORT void decodeArgumentStrings( std::vector<std::string>& entity_arguments );
+
 void readBool(const std::string& attribute_value, bool& target);
 void readLogical(const std::string& attribute_value, LogicalEnum& target);
 inline int readInteger(const std::string& str)
@@ -113,6 +116,9 @@ void readIntegerValue(const std::string& str, int& int_value);
 void readReal(const std::string& attribute_value, double& target);
 void readString(const std::string& attribute_value, std::string& target);
 
+///@brief Reads a string value. While a StringPool is active in the calling thread, target refers to the pooled storage of the value
+void readString(const std::string& attribute_value, SharedString& target);
+
 template<typename T>
 void readTypeOfIntegerList( const std::string& str, std::vector<shared_ptr<T> >& target_vec )
 {
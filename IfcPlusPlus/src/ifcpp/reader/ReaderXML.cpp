@@ -0,0 +1,982 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <ifcpp/model/BasicTypes.h>
+#include <ifcpp/model/BuildingModel.h>
+#include <ifcpp/model/BuildingException.h>
+#include <ifcpp/IFC4X3/EntityFactory.h>
+#include <ifcpp/writer/WriterUtil.h>
+
+#include "ReaderEntityArguments.h"
+#include "ReaderUtil.h"
+#include "ReaderXML.h"
+
+using namespace IFC4X3;
+
+namespace
+{
+	void appendUtf8(std::string& out, uint32_t code_point)
+	{
+		if (code_point < 0x80)
+		{
+			out += char(code_point);
+		}
+		else if (code_point < 0x800)
+		{
+			out += char(0xC0 | (code_point >> 6));
+			out += char(0x80 | (code_point & 0x3F));
+		}
+		else if (code_point < 0x10000)
+		{
+			out += char(0xE0 | (code_point >> 12));
+			out += char(0x80 | ((code_point >> 6) & 0x3F));
+			out += char(0x80 | (code_point & 0x3F));
+		}
+		else
+		{
+			out += char(0xF0 | (code_point >> 18));
+			out += char(0x80 | ((code_point >> 12) & 0x3F));
+			out += char(0x80 | ((code_point >> 6) & 0x3F));
+			out += char(0x80 | (code_point & 0x3F));
+		}
+	}
+
+	const char* localName(const std::string& name)
+	{
+		const size_t colon = name.find(':');
+		return colon == std::string::npos ? name.c_str() : name.c_str() + colon + 1;
+	}
+
+	/// Pull parser for the part of XML that occurs in ifcXML files: elements, attributes, character data, CDATA sections, comments,
+	/// processing instructions and DOCTYPE declarations. The input is read in blocks, so the size of the file does not matter.
+	/// Namespace prefixes are removed from element names, attribute names keep them.
+	class XmlPullParser
+	{
+	public:
+		enum EventType { START_ELEMENT, END_ELEMENT, TEXT, END_OF_FILE };
+
+		explicit XmlPullParser(std::istream& in) : m_in(in), m_buffer(1 << 20) {}
+
+		EventType next()
+		{
+			if (m_pending_end_element)
+			{
+				m_pending_end_element = false;
+				return END_ELEMENT;
+			}
+
+			while (true)
+			{
+				int c = peek();
+				if (c == EOF)
+				{
+					return END_OF_FILE;
+				}
+
+				if (c != '<')
+				{
+					m_text.clear();
+					bool only_whitespace = true;
+					while ((c = peek()) != EOF && c != '<')
+					{
+						get();
+						if (c == '&')
+						{
+							decodeReference(m_text);
+							only_whitespace = false;
+							continue;
+						}
+						if (!isspace(c))
+						{
+							only_whitespace = false;
+						}
+						m_text += char(c);
+					}
+					if (only_whitespace)
+					{
+						continue;
+					}
+					return TEXT;
+				}
+
+				get();
+				c = peek();
+				if (c == '?')
+				{
+					skipUntil("?>");
+					continue;
+				}
+
+				if (c == '!')
+				{
+					get();
+					if (peek() == '-')
+					{
+						skipUntil("-->");
+						continue;
+					}
+					if (peek() == '[')
+					{
+						// <![CDATA[ ... ]]>
+						skipUntil("[CDATA[");
+						m_text.clear();
+						readUntil("]]>", m_text);
+						return TEXT;
+					}
+
+					// DOCTYPE, possibly with internal subset in []
+					int depth = 0;
+					while ((c = get()) != EOF)
+					{
+						if (c == '[') { ++depth; }
+						else if (c == ']') { --depth; }
+						else if (c == '>' && depth <= 0) { break; }
+					}
+					continue;
+				}
+
+				if (c == '/')
+				{
+					get();
+					readName(m_name);
+					while ((c = get()) != EOF && c != '>') {}
+					return END_ELEMENT;
+				}
+
+				readName(m_name);
+				m_num_attributes = 0;
+				while (true)
+				{
+					c = get();
+					if (c == EOF)
+					{
+						return END_OF_FILE;
+					}
+					if (isspace(c))
+					{
+						continue;
+					}
+					if (c == '/')
+					{
+						while ((c = get()) != EOF && c != '>') {}
+						m_pending_end_element = true;
+						break;
+					}
+					if (c == '>')
+					{
+						break;
+					}
+
+					if (m_num_attributes == m_attributes.size())
+					{
+						m_attributes.emplace_back();
+					}
+					std::pair<std::string, std::string>& attribute = m_attributes[m_num_attributes++];
+					attribute.first.assign(1, char(c));
+					attribute.second.clear();
+					while ((c = peek()) != EOF && c != '=' && !isspace(c))
+					{
+						attribute.first += char(get());
+					}
+					while ((c = get()) != EOF && c != '"' && c != '\'') {}
+					const int quote = c;
+					while ((c = get()) != EOF && c != quote)
+					{
+						if (c == '&')
+						{
+							decodeReference(attribute.second);
+							continue;
+						}
+						attribute.second += char(c);
+					}
+				}
+				return START_ELEMENT;
+			}
+		}
+
+		/// local name of the current element, without namespace prefix
+		const std::string& name() const { return m_name; }
+		const std::string& text() const { return m_text; }
+		size_t numAttributes() const { return m_num_attributes; }
+		const std::pair<std::string, std::string>& attribute(size_t index) const { return m_attributes[index]; }
+
+		/// returns the value of the attribute with the given local name, or nullptr
+		const std::string* findAttribute(const char* local_name) const
+		{
+			for (size_t ii = 0; ii < m_num_attributes; ++ii)
+			{
+				if (strcmp(localName(m_attributes[ii].first), local_name) == 0)
+				{
+					return &m_attributes[ii].second;
+				}
+			}
+			return nullptr;
+		}
+
+		size_t bytesRead() const { return m_bytes_read; }
+
+	private:
+		bool fill()
+		{
+			if (!m_in)
+			{
+				return false;
+			}
+			m_in.read(m_buffer.data(), m_buffer.size());
+			m_pos = 0;
+			m_end = size_t(m_in.gcount());
+			m_bytes_read += m_end;
+			return m_end > 0;
+		}
+
+		int get()
+		{
+			if (m_pos == m_end && !fill())
+			{
+				return EOF;
+			}
+			return (unsigned char)m_buffer[m_pos++];
+		}
+
+		int peek()
+		{
+			if (m_pos == m_end && !fill())
+			{
+				return EOF;
+			}
+			return (unsigned char)m_buffer[m_pos];
+		}
+
+		void readName(std::string& name)
+		{
+			name.clear();
+			int c;
+			while ((c = peek()) != EOF && !isspace(c) && c != '>' && c != '/')
+			{
+				get();
+				if (c == ':')
+				{
+					// remove namespace prefix
+					name.clear();
+					continue;
+				}
+				name += char(c);
+			}
+		}
+
+		void readUntil(const char* terminator, std::string& content)
+		{
+			const size_t length = strlen(terminator);
+			int c;
+			while ((c = get()) != EOF)
+			{
+				content += char(c);
+				if (content.size() >= length && content.compare(content.size() - length, length, terminator) == 0)
+				{
+					content.resize(content.size() - length);
+					return;
+				}
+			}
+		}
+
+		void skipUntil(const char* terminator)
+		{
+			// compare the last characters that were read, since terminators like "-->" can overlap with the content before them
+			const size_t length = strlen(terminator);
+			char window[8] = {};
+			int c;
+			while ((c = get()) != EOF)
+			{
+				memmove(window, window + 1, length - 1);
+				window[length - 1] = char(c);
+				if (memcmp(window, terminator, length) == 0)
+				{
+					return;
+				}
+			}
+		}
+
+		// decodes a character or entity reference, after the '&'
+		void decodeReference(std::string& out)
+		{
+			char reference[16];
+			size_t length = 0;
+			int c;
+			while ((c = peek()) != EOF && c != ';' && length < sizeof(reference) - 1 && !isspace(c) && c != '<')
+			{
+				reference[length++] = char(get());
+			}
+			reference[length] = '\0';
+			if (c != ';')
+			{
+				out += '&';
+				out.append(reference, length);
+				return;
+			}
+			get();
+
+			if (reference[0] == '#')
+			{
+				const bool hex = reference[1] == 'x' || reference[1] == 'X';
+				const uint32_t code_point = uint32_t(strtoul(reference + (hex ? 2 : 1), nullptr, hex ? 16 : 10));
+				appendUtf8(out, code_point);
+			}
+			else if (strcmp(reference, "lt") == 0) { out += '<'; }
+			else if (strcmp(reference, "gt") == 0) { out += '>'; }
+			else if (strcmp(reference, "amp") == 0) { out += '&'; }
+			else if (strcmp(reference, "quot") == 0) { out += '"'; }
+			else if (strcmp(reference, "apos") == 0) { out += '\''; }
+			else
+			{
+				out += '&';
+				out.append(reference, length);
+				out += ';';
+			}
+		}
+
+		std::istream& m_in;
+		std::vector<char> m_buffer;
+		size_t m_pos = 0;
+		size_t m_end = 0;
+		size_t m_bytes_read = 0;
+		bool m_pending_end_element = false;
+		std::string m_name;
+		std::string m_text;
+		std::vector<std::pair<std::string, std::string> > m_attributes;	// reused, only the first m_num_attributes are valid
+		size_t m_num_attributes = 0;
+	};
+
+	void trim(std::string& str)
+	{
+		size_t begin = 0;
+		while (begin < str.size() && isspace((unsigned char)str[begin])) { ++begin; }
+		size_t end = str.size();
+		while (end > begin && isspace((unsigned char)str[end - 1])) { --end; }
+		str = str.substr(begin, end - begin);
+	}
+
+	void splitAtWhitespace(const std::string& str, std::vector<std::string>& tokens)
+	{
+		size_t ii = 0;
+		while (ii < str.size())
+		{
+			while (ii < str.size() && isspace((unsigned char)str[ii])) { ++ii; }
+			const size_t begin = ii;
+			while (ii < str.size() && !isspace((unsigned char)str[ii])) { ++ii; }
+			if (ii > begin)
+			{
+				tokens.emplace_back(str, begin, ii - begin);
+			}
+		}
+	}
+
+	/// converts the text of an XML attribute or attribute element into a STEP argument
+	std::string formatValue(std::string value, const ValueInfo& info)
+	{
+		trim(value);
+		if (value.empty() && info.kind != VALUE_STRING)
+		{
+			return "$";
+		}
+		if (info.list_depth == 0)
+		{
+			return formatLiteral(value, info.kind);
+		}
+
+		// lists of simple values are separated by whitespace. Strings can contain whitespace, so they are taken as one value
+		std::vector<std::string> tokens;
+		if (info.kind == VALUE_STRING)
+		{
+			tokens.push_back(value);
+		}
+		else
+		{
+			splitAtWhitespace(value, tokens);
+		}
+
+		std::string result = info.list_depth > 1 ? "((" : "(";
+		for (size_t ii = 0; ii < tokens.size(); ++ii)
+		{
+			if (ii > 0)
+			{
+				result += ',';
+			}
+			result += formatLiteral(tokens[ii], info.kind);
+		}
+		result += info.list_depth > 1 ? "))" : ")";
+		return result;
+	}
+
+	/// First pass: streams the XML elements and creates the entities with their STEP arguments
+	class IfcXmlReadPass
+	{
+	public:
+		IfcXmlReadPass(StatusCallback* status, shared_ptr<BuildingModel>& model, std::streampos file_size) : m_status(status), m_model(model), m_file_size(file_size) {}
+
+		std::vector<EntityReadObject> m_entities;
+		std::map<std::string, std::string> m_header_fields;
+		BuildingModel::SchemaVersionEnum m_schema_version = BuildingModel::IFC_VERSION_UNDEFINED;
+		std::stringstream m_err;
+		std::stringstream m_err_unknown_entity;
+
+		void read(std::istream& in)
+		{
+			XmlPullParser parser(in);
+			double last_progress = 0;
+			size_t num_events = 0;
+			while (true)
+			{
+				const XmlPullParser::EventType event = parser.next();
+				if (event == XmlPullParser::END_OF_FILE)
+				{
+					break;
+				}
+
+				if (event == XmlPullParser::START_ELEMENT)
+				{
+					startElement(parser);
+				}
+				else if (event == XmlPullParser::END_ELEMENT)
+				{
+					endElement();
+				}
+				else if (event == XmlPullParser::TEXT)
+				{
+					if (!m_stack.empty())
+					{
+						Frame& frame = m_stack.back();
+						if (frame.type == FRAME_ATTRIBUTE || frame.type == FRAME_VALUE || frame.type == FRAME_HEADER_FIELD)
+						{
+							frame.text += parser.text();
+						}
+					}
+				}
+
+				if (++num_events % 10000 == 0)
+				{
+					if (m_model->isLoadingCancelled())
+					{
+						m_entities.clear();
+						return;
+					}
+					const double progress = 0.05 + 0.25 * double(parser.bytesRead()) / double(std::max(std::streamoff(1), std::streamoff(m_file_size)));
+					if (progress - last_progress > 0.01)
+					{
+						m_status->progressValueCallback(progress, "parse");
+						last_progress = progress;
+					}
+				}
+			}
+
+			if (!m_stack.empty())
+			{
+				m_err << "Unexpected end of file, " << m_stack.size() << " elements are not closed" << std::endl;
+			}
+			m_type_cache.resolveBackReferences(m_entities, m_back_references);
+		}
+
+	private:
+		enum FrameType { FRAME_CONTAINER, FRAME_HEADER, FRAME_HEADER_FIELD, FRAME_ENTITY, FRAME_ATTRIBUTE, FRAME_VALUE, FRAME_IGNORE };
+
+		struct AttributeItem
+		{
+			int entity_tag = -1;				// >= 0 for entity references
+			std::string type_name_upper;		// type of wrapped values, for example IFCLABEL for <IfcLabel-wrapper>
+			std::string text;
+		};
+
+		struct Frame
+		{
+			FrameType type = FRAME_IGNORE;
+			size_t entity_index = 0;			// FRAME_ENTITY: index in m_entities. FRAME_ATTRIBUTE: index of the entity that has the attribute
+			int attribute_index = -1;			// FRAME_ATTRIBUTE: -1 for inverse or unknown attributes
+			bool closes_parent = false;			// FRAME_ENTITY: the attribute element is the entity element as well, for example <ObjectPlacement xsi:type="IfcLocalPlacement" id="i5">
+			std::vector<AttributeItem> items;
+			std::string text;
+			std::string name;
+		};
+
+		const ClassInfo* getEntityClass(const std::string& name)
+		{
+			return m_type_cache.getEntityClass(name);
+		}
+
+		int newTag()
+		{
+			while (m_used_tags.find(m_next_free_tag) != m_used_tags.end())
+			{
+				++m_next_free_tag;
+			}
+			m_used_tags.insert(m_next_free_tag);
+			return m_next_free_tag++;
+		}
+
+		int getTagForId(const std::string& id)
+		{
+			auto it = m_map_id_tag.find(id);
+			if (it != m_map_id_tag.end())
+			{
+				return it->second;
+			}
+
+			// keep the number of ids like "i123", so that the tags are the same as in the STEP file that the ifcXML file was created from
+			int tag = -1;
+			if (id.size() > 1 && id.size() < 10 && !isdigit((unsigned char)id[0]) && std::all_of(id.begin() + 1, id.end(), [](char c) { return isdigit((unsigned char)c); }))
+			{
+				tag = atoi(id.c_str() + 1);
+				if (!m_used_tags.insert(tag).second)
+				{
+					tag = -1;
+				}
+			}
+			if (tag < 0)
+			{
+				tag = newTag();
+			}
+			m_map_id_tag[id] = tag;
+			return tag;
+		}
+
+		std::string getEntityClassName(const XmlPullParser& parser) const
+		{
+			const std::string* xsi_type = parser.findAttribute("type");
+			if (xsi_type)
+			{
+				return localName(*xsi_type);
+			}
+			return parser.name();
+		}
+
+		void detectSchemaVersion(const XmlPullParser& parser)
+		{
+			for (size_t ii = 0; ii < parser.numAttributes(); ++ii)
+			{
+				std::string value = parser.attribute(ii).second;
+				convertStringToUpperCase(value);
+				if (value.find("IFC4X3") != std::string::npos) { m_schema_version = BuildingModel::IFC4X3; return; }
+				if (value.find("IFC4X1") != std::string::npos) { m_schema_version = BuildingModel::IFC4X1; return; }
+				if (value.find("IFC4") != std::string::npos) { m_schema_version = BuildingModel::IFC4; return; }
+				if (value.find("IFC2X3") != std::string::npos) { m_schema_version = BuildingModel::IFC2X3; return; }
+			}
+		}
+
+		void startElement(const XmlPullParser& parser)
+		{
+			const FrameType parent_type = m_stack.empty() ? FRAME_CONTAINER : m_stack.back().type;
+			switch (parent_type)
+			{
+			case FRAME_CONTAINER:
+				{
+					const std::string& name = parser.name();
+					if (name == "header" || name == "iso_10303_28_header")
+					{
+						pushFrame(FRAME_HEADER);
+						return;
+					}
+
+					const std::string class_name = getEntityClassName(parser);
+					const ClassInfo* class_info = getEntityClass(class_name);
+					if (class_info)
+					{
+						startEntity(parser, *class_info, false);
+						return;
+					}
+
+					if (class_name.size() > 3 && class_name.compare(0, 3, "Ifc") == 0)
+					{
+						if (m_unknown_entities.insert(class_name).second)
+						{
+							m_err_unknown_entity << "unknown IFC entity: " << class_name << std::endl;
+						}
+						pushFrame(FRAME_IGNORE);
+						return;
+					}
+
+					if (m_schema_version == BuildingModel::IFC_VERSION_UNDEFINED)
+					{
+						detectSchemaVersion(parser);
+					}
+					pushFrame(FRAME_CONTAINER);
+					return;
+				}
+			case FRAME_HEADER:
+				pushFrame(FRAME_HEADER_FIELD).name = parser.name();
+				return;
+			case FRAME_ENTITY:
+				startAttribute(parser);
+				return;
+			case FRAME_ATTRIBUTE:
+				{
+					const std::string class_name = getEntityClassName(parser);
+					const ClassInfo* class_info = getEntityClass(class_name);
+					if (class_info)
+					{
+						const std::string* ref = parser.findAttribute("ref");
+						if (ref)
+						{
+							addEntityItem(getTagForId(*ref));
+							pushFrame(FRAME_IGNORE);
+							return;
+						}
+						startEntity(parser, *class_info, false);
+						return;
+					}
+
+					// wrapped simple value, for example <IfcLabel-wrapper>text</IfcLabel-wrapper> for select types
+					std::string type_name = class_name;
+					const size_t wrapper_pos = type_name.find("-wrapper");
+					if (wrapper_pos != std::string::npos)
+					{
+						type_name.erase(wrapper_pos);
+					}
+					convertStringToUpperCase(type_name);
+					pushFrame(FRAME_VALUE).name = type_name;
+					return;
+				}
+			default:
+				pushFrame(FRAME_IGNORE);
+				return;
+			}
+		}
+
+		Frame& pushFrame(FrameType type)
+		{
+			m_stack.emplace_back();
+			Frame& frame = m_stack.back();
+			frame.type = type;
+			return frame;
+		}
+
+		void startEntity(const XmlPullParser& parser, const ClassInfo& class_info, bool closes_parent)
+		{
+			shared_ptr<BuildingEntity> entity(EntityFactory::createEntityObject(class_info.class_name_upper));
+			const std::string* id = parser.findAttribute("id");
+			entity->m_tag = id ? getTagForId(*id) : newTag();
+
+			EntityReadObject read_object;
+			read_object.entity = entity;
+			read_object.class_info = &class_info;
+			read_object.arguments.assign(class_info.num_arguments, "$");
+
+			// simple attributes are given as XML attributes, for example <IfcWall id="i10" GlobalId="..." Name="Wall-001">
+			for (size_t ii = 0; ii < parser.numAttributes(); ++ii)
+			{
+				const std::pair<std::string, std::string>& xml_attribute = parser.attribute(ii);
+				const int attribute_index = class_info.findAttribute(xml_attribute.first);
+				if (attribute_index >= 0)
+				{
+					read_object.arguments[attribute_index] = formatValue(xml_attribute.second, class_info.attributes[attribute_index].value);
+				}
+			}
+
+			Frame& frame = pushFrame(FRAME_ENTITY);
+			frame.entity_index = m_entities.size();
+			frame.closes_parent = closes_parent;
+			m_entities.push_back(std::move(read_object));
+		}
+
+		void startAttribute(const XmlPullParser& parser)
+		{
+			const size_t entity_index = m_stack.back().entity_index;
+			const ClassInfo* class_info = m_entities[entity_index].class_info;
+
+			Frame& frame = pushFrame(FRAME_ATTRIBUTE);
+			frame.entity_index = entity_index;
+			frame.attribute_index = class_info->findAttribute(parser.name());
+
+			// an entity attribute can be the entity element itself: <OwnerHistory ref="i1"/> or <ObjectPlacement xsi:type="IfcLocalPlacement" id="i5">
+			const std::string* ref = parser.findAttribute("ref");
+			if (ref)
+			{
+				addEntityItem(getTagForId(*ref));
+				return;
+			}
+
+			const std::string* nil = parser.findAttribute("nil");
+			if (nil && *nil == "true")
+			{
+				// attribute is not set
+				frame.attribute_index = -1;
+				return;
+			}
+
+			const std::string* xsi_type = parser.findAttribute("type");
+			if (xsi_type)
+			{
+				const ClassInfo* entity_class = getEntityClass(localName(*xsi_type));
+				if (entity_class)
+				{
+					startEntity(parser, *entity_class, true);
+				}
+			}
+		}
+
+		void addEntityItem(int tag)
+		{
+			Frame& attribute_frame = m_stack.back();
+			AttributeItem item;
+			item.entity_tag = tag;
+			attribute_frame.items.push_back(item);
+			if (attribute_frame.attribute_index < 0)
+			{
+				m_back_references.push_back({ tag, attribute_frame.entity_index });
+			}
+		}
+
+		void endElement()
+		{
+			if (m_stack.empty())
+			{
+				return;
+			}
+			Frame frame = std::move(m_stack.back());
+			m_stack.pop_back();
+
+			switch (frame.type)
+			{
+			case FRAME_HEADER_FIELD:
+				m_header_fields[frame.name] += frame.text;
+				break;
+			case FRAME_VALUE:
+				if (!m_stack.empty() && m_stack.back().type == FRAME_ATTRIBUTE)
+				{
+					AttributeItem item;
+					item.type_name_upper = frame.name;
+					item.text = frame.text;
+					m_stack.back().items.push_back(std::move(item));
+				}
+				break;
+			case FRAME_ATTRIBUTE:
+				finishAttribute(frame);
+				break;
+			case FRAME_ENTITY:
+				if (!m_stack.empty() && m_stack.back().type == FRAME_ATTRIBUTE)
+				{
+					addEntityItem(m_entities[frame.entity_index].entity->m_tag);
+					if (frame.closes_parent)
+					{
+						Frame attribute_frame = std::move(m_stack.back());
+						m_stack.pop_back();
+						finishAttribute(attribute_frame);
+					}
+				}
+				break;
+			default:
+				break;
+			}
+		}
+
+		void finishAttribute(const Frame& frame)
+		{
+			if (frame.attribute_index < 0)
+			{
+				return;
+			}
+
+			EntityReadObject& read_object = m_entities[frame.entity_index];
+			const AttributeInfo& attribute = read_object.class_info->attributes[frame.attribute_index];
+			read_object.arguments[frame.attribute_index] = formatAttributeElement(frame, attribute);
+		}
+
+		std::string formatAttributeElement(const Frame& frame, const AttributeInfo& attribute)
+		{
+			const std::vector<AttributeItem>& items = frame.items;
+			if (items.empty())
+			{
+				// <Description>text</Description>
+				return formatValue(frame.text, attribute.value);
+			}
+
+			const ValueInfo& info = attribute.value;
+			if (info.kind != VALUE_OTHER)
+			{
+				// simple values: <Coordinates><IfcLengthMeasure>0.</IfcLengthMeasure>...</Coordinates>, or one wrapper element with whitespace separated values
+				if (info.list_depth == 0)
+				{
+					return formatValue(items[0].text, info);
+				}
+
+				if (info.list_depth == 1 && info.kind != VALUE_STRING)
+				{
+					std::string all_values;
+					for (const AttributeItem& item : items)
+					{
+						all_values += item.text;
+						all_values += ' ';
+					}
+					return formatValue(all_values, info);
+				}
+
+				// each item is one value of the list, or one inner list
+				ValueInfo inner_info = info;
+				inner_info.list_depth = info.list_depth - 1;
+				std::string result = "(";
+				for (size_t ii = 0; ii < items.size(); ++ii)
+				{
+					if (ii > 0)
+					{
+						result += ',';
+					}
+					const std::string value = formatValue(items[ii].text, inner_info);
+					result += (inner_info.list_depth > 0 && value == "$") ? std::string("()") : value;
+				}
+				result += ")";
+				return result;
+			}
+
+			// entity references and select types
+			std::string result;
+			for (size_t ii = 0; ii < items.size(); ++ii)
+			{
+				const AttributeItem& item = items[ii];
+				if (ii > 0)
+				{
+					result += ',';
+				}
+				if (item.entity_tag >= 0)
+				{
+					result += "#" + std::to_string(item.entity_tag);
+				}
+				else
+				{
+					result += item.type_name_upper + "(" + formatValue(item.text, m_type_cache.getTypeInfo(item.type_name_upper)) + ")";
+				}
+
+				if (!attribute.is_list)
+				{
+					break;
+				}
+			}
+			return attribute.is_list ? "(" + result + ")" : result;
+		}
+
+		StatusCallback* m_status;
+		shared_ptr<BuildingModel>& m_model;
+		std::streampos m_file_size;
+		std::vector<Frame> m_stack;
+		AttributeTypeCache m_type_cache;
+		std::unordered_map<std::string, int> m_map_id_tag;
+		std::unordered_set<int> m_used_tags;
+		int m_next_free_tag = 1;
+		std::vector<BackReference> m_back_references;
+		std::unordered_set<std::string> m_unknown_entities;
+	};
+}
+
+ReaderXML::ReaderXML() = default;
+ReaderXML::~ReaderXML() = default;
+
+void ReaderXML::loadModelFromFile(const std::string& filePath, shared_ptr<BuildingModel>& targetModel)
+{
+	std::ifstream infile(filePath.c_str(), std::ifstream::in | std::ifstream::binary);
+	if (!infile.is_open())
+	{
+		std::stringstream strs;
+		strs << "Could not open file: " << filePath.c_str();
+		messageCallback(strs.str().c_str(), StatusCallback::MESSAGE_TYPE_ERROR, __FUNC__);
+		return;
+	}
+
+	infile.seekg(0, std::ios::end);
+	std::streampos file_end_pos = infile.tellg();
+	infile.seekg(0, std::ios::beg);
+
+	loadModelFromStream(infile, file_end_pos, targetModel);
+	infile.close();
+}
+
+void ReaderXML::loadModelFromStream(std::istream& content, std::streampos file_end_pos, shared_ptr<BuildingModel>& targetModel)
+{
+	if (!targetModel)
+	{
+		throw BuildingException("Model not set.", __FUNC__);
+	}
+
+	std::string current_numeric_locale(setlocale(LC_NUMERIC, nullptr));
+	setlocale(LC_NUMERIC, "C");
+
+	std::stringstream err;
+	IfcXmlReadPass read_pass(this, targetModel, file_end_pos);
+	try
+	{
+		read_pass.read(content);
+	}
+	catch (std::exception& e)
+	{
+		err << e.what();
+	}
+	catch (...)
+	{
+		err << __FUNC__ << ": error occurred" << std::endl;
+	}
+
+	if (read_pass.m_err_unknown_entity.tellp() > 0)
+	{
+		messageCallback(read_pass.m_err_unknown_entity.str(), StatusCallback::MESSAGE_TYPE_UNKNOWN_ENTITY, __FUNC__);
+	}
+	err << read_pass.m_err.str();
+
+	// header
+	const std::map<std::string, std::string>& header = read_pass.m_header_fields;
+	auto headerField = [&header](const char* name) -> std::string
+	{
+		auto it = header.find(name);
+		if (it == header.end())
+		{
+			return "";
+		}
+		std::string value = it->second;
+		trim(value);
+		// apostrophes, backslashes and non-ASCII characters would break the STEP header
+		return encodeStepString(value);
+	};
+	targetModel->setFileHeader("");
+	targetModel->setFileDescription("FILE_DESCRIPTION(('" + headerField("documentation") + "'),'2;1')");
+	targetModel->setFileName("FILE_NAME('" + headerField("name") + "','" + headerField("time_stamp") + "',('" + headerField("author") + "'),('" + headerField("organization") + "'),'"
+		+ headerField("preprocessor_version") + "','" + headerField("originating_system") + "','" + headerField("authorization") + "')");
+	targetModel->setIfcSchemaVersionEnumCurrent(read_pass.m_schema_version);
+	messageCallback(std::string("Detected IFC version: ") + targetModel->getIfcSchemaVersionCurrent(), StatusCallback::MESSAGE_TYPE_GENERAL_MESSAGE, __FUNC__);
+
+	// currently generated IFC classes are IFC4X3, files with older versions are converted. So after loading, the schema is always IFC4X3
+	targetModel->setIfcSchemaVersionEnumCurrent(BuildingModel::IFC4X3);
+
+	// second pass: now all entities exist, so the references can be resolved
+	readEntityArguments(read_pass.m_entities, targetModel, this, err);
+
+	setlocale(LC_NUMERIC, current_numeric_locale.c_str());
+	if (err.tellp() > 0)
+	{
+		messageCallback(err.str(), StatusCallback::MESSAGE_TYPE_ERROR, __FUNC__);
+	}
+
+	targetModel->resolveInverseAttributes();
+	targetModel->updateCache();
+	progressValueCallback(1.0, "parse");
+}
@@ -0,0 +1,42 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <string>
+#include "ifcpp/model/BasicTypes.h"
+#include "ifcpp/model/BuildingObject.h"
+#include "ifcpp/model/BuildingModel.h"
+#include "ifcpp/model/StatusCallback.h"
+
+///@brief Reads ifcXML files (ISO 10303-28), as exported for IFC4 and IFC2X3
+///@details The file is read as a stream of XML events, without building a DOM, so the memory needed is about the same as for the STEP file of the model.
+///While reading, each entity element is created with EntityFactory, and its XML attributes and attribute elements are converted into STEP arguments.
+///References (id/ref) are resolved in a second pass, in which all entities are initialized in parallel with readStepArguments, like in ReaderSTEP.
+///Entities that are nested in an inverse attribute (for example IfcRelAggregates in IsDecomposedBy) get the reference back to the enclosing entity.
+class IFCQUERY_EXPORT ReaderXML : public StatusCallback
+{
+public:
+	ReaderXML();
+	~ReaderXML() override;
+
+	/*\brief Opens the given file, reads the content, and puts the entities into target_model.
+	  \param[in] file_path Absolute path of the file to read.
+	**/
+	void loadModelFromFile( const std::string& filePath, shared_ptr<BuildingModel>& targetModel );
+	void loadModelFromStream( std::istream& content, std::streampos file_end_pos, shared_ptr<BuildingModel>& targetModel );
+};
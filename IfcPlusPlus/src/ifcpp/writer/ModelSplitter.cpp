@@ -0,0 +1,524 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <ifcpp/model/BasicTypes.h>
+#include <ifcpp/model/BuildingException.h>
+#include <ifcpp/model/BuildingGuid.h>
+#include <ifcpp/model/BuildingObject.h>
+#include <IfcBuildingStorey.h>
+#include <IfcContext.h>
+#include <IfcElement.h>
+#include <IfcFeatureElementSubtraction.h>
+#include <IfcGloballyUniqueId.h>
+#include <IfcLabel.h>
+#include <IfcObject.h>
+#include <IfcObjectDefinition.h>
+#include <IfcOpeningElement.h>
+#include <IfcRelAggregates.h>
+#include <IfcRelAssociates.h>
+#include <IfcRelAssociatesClassification.h>
+#include <IfcRelAssociatesMaterial.h>
+#include <IfcRelContainedInSpatialStructure.h>
+#include <IfcRelDefinesByProperties.h>
+#include <IfcRelDefinesByType.h>
+#include <IfcRelFillsElement.h>
+#include <IfcRelVoidsElement.h>
+#include <IfcSpatialElement.h>
+
+#include "WriterSTEP.h"
+#include "ModelSplitter.h"
+
+using namespace IFC4X3;
+
+typedef std::unordered_set<BuildingEntity*> EntitySet;
+
+namespace
+{
+	template<typename T>
+	bool isInSet( const shared_ptr<T>& obj, const EntitySet& set_entities )
+	{
+		BuildingEntity* entity = dynamic_cast<BuildingEntity*>( obj.get() );
+		return entity != nullptr && set_entities.find( entity ) != set_entities.end();
+	}
+
+	///@brief Returns rel if all related objects are in the subset, a copy of rel with only the related objects of the subset, or nullptr if none is in the subset
+	template<typename TRel, typename TRelBase, typename TRelated>
+	shared_ptr<BuildingEntity> filterRelatedObjects( const shared_ptr<TRel>& rel, std::vector<shared_ptr<TRelated> > TRelBase::* related_objects, const EntitySet& subset )
+	{
+		const std::vector<shared_ptr<TRelated> >& vec_related = ( *rel ).*related_objects;
+		std::vector<shared_ptr<TRelated> > vec_related_in_subset;
+		for( const shared_ptr<TRelated>& related : vec_related )
+		{
+			if( isInSet( related, subset ) )
+			{
+				vec_related_in_subset.push_back( related );
+			}
+		}
+
+		if( vec_related_in_subset.empty() )
+		{
+			return shared_ptr<BuildingEntity>();
+		}
+		if( vec_related_in_subset.size() == vec_related.size() )
+		{
+			return rel;
+		}
+
+		// same tag and GUID as the original, so that the subset files can be merged again
+		shared_ptr<TRel> rel_copy( new TRel( *rel ) );
+		( *rel_copy ).*related_objects = vec_related_in_subset;
+		return rel_copy;
+	}
+
+	std::string sanitizeFileName( const std::string& name )
+	{
+		std::string result;
+		for( char c : name )
+		{
+			if( std::isalnum( static_cast<unsigned char>( c ) ) || c == '-' || c == '_' || c == '.' )
+			{
+				result += c;
+			}
+			else
+			{
+				result += '_';
+			}
+		}
+		return result;
+	}
+}
+
+std::vector<ModelSplitter::Subset> ModelSplitter::createSubsetsPerStorey( const shared_ptr<BuildingModel>& model )
+{
+	std::vector<shared_ptr<IfcBuildingStorey> > vec_storeys;
+	for( auto& it : model->getMapIfcEntities() )
+	{
+		shared_ptr<IfcBuildingStorey> storey = dynamic_pointer_cast<IfcBuildingStorey>( it.second );
+		if( storey )
+		{
+			vec_storeys.push_back( storey );
+		}
+	}
+	std::sort( vec_storeys.begin(), vec_storeys.end(), []( const shared_ptr<IfcBuildingStorey>& a, const shared_ptr<IfcBuildingStorey>& b ) { return a->m_tag < b->m_tag; } );
+
+	std::vector<Subset> vec_subsets;
+	std::set<std::string> set_names;
+	for( const shared_ptr<IfcBuildingStorey>& storey : vec_storeys )
+	{
+		std::string name = "storey";
+		if( storey->m_Name && !storey->m_Name->m_value.empty() )
+		{
+			name = sanitizeFileName( storey->m_Name->m_value );
+		}
+
+		std::string unique_name = name;
+		for( int i = 2; set_names.find( unique_name ) != set_names.end(); ++i )
+		{
+			unique_name = name + "_" + std::to_string( i );
+		}
+		set_names.insert( unique_name );
+
+		Subset subset;
+		subset.m_name = unique_name;
+		subset.m_roots.push_back( storey );
+		vec_subsets.push_back( subset );
+	}
+	return vec_subsets;
+}
+
+ModelSplitter::Subset ModelSplitter::createSubsetFromGuids( const shared_ptr<BuildingModel>& model, const std::string& name, const std::vector<std::string>& guids )
+{
+	std::unordered_set<BinaryGuid> set_guids;
+	for( const std::string& guid : guids )
+	{
+		set_guids.insert( BinaryGuid( guid ) );
+	}
+
+	std::vector<shared_ptr<IfcObjectDefinition> > vec_roots;
+	for( auto& it : model->getMapIfcEntities() )
+	{
+		shared_ptr<IfcObjectDefinition> object_def = dynamic_pointer_cast<IfcObjectDefinition>( it.second );
+		if( object_def && object_def->m_GlobalId )
+		{
+			if( set_guids.find( BinaryGuid( object_def->m_GlobalId->m_value ) ) != set_guids.end() )
+			{
+				vec_roots.push_back( object_def );
+			}
+		}
+	}
+	std::sort( vec_roots.begin(), vec_roots.end(), []( const shared_ptr<IfcObjectDefinition>& a, const shared_ptr<IfcObjectDefinition>& b ) { return a->m_tag < b->m_tag; } );
+
+	Subset subset;
+	subset.m_name = name;
+	subset.m_roots = vec_roots;
+	return subset;
+}
+
+shared_ptr<BuildingModel> ModelSplitter::createSubsetModel( const Subset& subset )
+{
+	// objects of the subset: roots, their parts, and for spatial roots the contained elements
+	EntitySet set_core;
+	std::vector<shared_ptr<IfcObjectDefinition> > vec_core;
+	std::vector<shared_ptr<IfcObjectDefinition> > stack_objects( subset.m_roots.begin(), subset.m_roots.end() );
+	while( !stack_objects.empty() )
+	{
+		shared_ptr<IfcObjectDefinition> object_def = stack_objects.back();
+		stack_objects.pop_back();
+		if( !object_def || !set_core.insert( object_def.get() ).second )
+		{
+			continue;
+		}
+		vec_core.push_back( object_def );
+
+		for( const weak_ptr<IfcRelAggregates>& rel_aggregates_weak : object_def->m_IsDecomposedBy_inverse )
+		{
+			if( rel_aggregates_weak.expired() )
+			{
+				continue;
+			}
+			shared_ptr<IfcRelAggregates> rel_aggregates( rel_aggregates_weak );
+			std::copy( rel_aggregates->m_RelatedObjects.begin(), rel_aggregates->m_RelatedObjects.end(), std::back_inserter( stack_objects ) );
+		}
+
+		if( m_include_contained_elements )
+		{
+			shared_ptr<IfcSpatialElement> spatial_element = dynamic_pointer_cast<IfcSpatialElement>( object_def );
+			if( spatial_element )
+			{
+				for( const weak_ptr<IfcRelContainedInSpatialStructure>& rel_contained_weak : spatial_element->m_ContainsElements_inverse )
+				{
+					if( rel_contained_weak.expired() )
+					{
+						continue;
+					}
+					shared_ptr<IfcRelContainedInSpatialStructure> rel_contained( rel_contained_weak );
+					std::copy( rel_contained->m_RelatedElements.begin(), rel_contained->m_RelatedElements.end(), std::back_inserter( stack_objects ) );
+				}
+			}
+		}
+
+		// openings are needed for the geometry of the element
+		shared_ptr<IfcElement> element = dynamic_pointer_cast<IfcElement>( object_def );
+		if( element )
+		{
+			for( const weak_ptr<IfcRelVoidsElement>& rel_voids_weak : element->m_HasOpenings_inverse )
+			{
+				if( rel_voids_weak.expired() )
+				{
+					continue;
+				}
+				shared_ptr<IfcRelVoidsElement> rel_voids( rel_voids_weak );
+				if( rel_voids->m_RelatedOpeningElement )
+				{
+					stack_objects.push_back( rel_voids->m_RelatedOpeningElement );
+				}
+			}
+		}
+	}
+
+	// spatial structure above the subset, up to the IfcProject
+	std::vector<shared_ptr<IfcObjectDefinition> > stack_parents = vec_core;
+	EntitySet set_visited_parents;
+	while( !stack_parents.empty() )
+	{
+		shared_ptr<IfcObjectDefinition> object_def = stack_parents.back();
+		stack_parents.pop_back();
+		if( !object_def || !set_visited_parents.insert( object_def.get() ).second )
+		{
+			continue;
+		}
+		if( set_core.insert( object_def.get() ).second )
+		{
+			vec_core.push_back( object_def );
+		}
+
+		for( const weak_ptr<IfcRelAggregates>& rel_aggregates_weak : object_def->m_Decomposes_inverse )
+		{
+			if( rel_aggregates_weak.expired() )
+			{
+				continue;
+			}
+			shared_ptr<IfcRelAggregates> rel_aggregates( rel_aggregates_weak );
+			stack_parents.push_back( rel_aggregates->m_RelatingObject );
+		}
+
+		shared_ptr<IfcElement> element = dynamic_pointer_cast<IfcElement>( object_def );
+		if( element )
+		{
+			for( const weak_ptr<IfcRelContainedInSpatialStructure>& rel_contained_weak : element->m_ContainedInStructure_inverse )
+			{
+				if( rel_contained_weak.expired() )
+				{
+					continue;
+				}
+				shared_ptr<IfcRelContainedInSpatialStructure> rel_contained( rel_contained_weak );
+				stack_parents.push_back( rel_contained->m_RelatingStructure );
+			}
+		}
+	}
+
+	// relationships of the subset objects. Each one is added once, even if several subset objects refer to it
+	std::vector<shared_ptr<BuildingEntity> > vec_roots;
+	std::unordered_set<BuildingEntity*> set_visited_relationships;
+	auto addRelationship = [&]( const shared_ptr<BuildingEntity>& rel, const std::function<shared_ptr<BuildingEntity>()>& filter )
+	{
+		if( !rel || !set_visited_relationships.insert( rel.get() ).second )
+		{
+			return;
+		}
+		shared_ptr<BuildingEntity> rel_in_subset = filter();
+		if( rel_in_subset )
+		{
+			vec_roots.push_back( rel_in_subset );
+		}
+	};
+
+	for( const shared_ptr<IfcObjectDefinition>& object_def_ptr : vec_core )
+	{
+		IfcObjectDefinition* object_def = object_def_ptr.get();
+		for( const weak_ptr<IfcRelAggregates>& rel_weak : object_def->m_IsDecomposedBy_inverse )
+		{
+			if( rel_weak.expired() )
+			{
+				continue;
+			}
+			shared_ptr<IfcRelAggregates> rel( rel_weak );
+			addRelationship( rel, [&]() { return filterRelatedObjects( rel, &IfcRelAggregates::m_RelatedObjects, set_core ); } );
+		}
+
+		IfcSpatialElement* spatial_element = dynamic_cast<IfcSpatialElement*>( object_def );
+		if( spatial_element )
+		{
+			for( const weak_ptr<IfcRelContainedInSpatialStructure>& rel_weak : spatial_element->m_ContainsElements_inverse )
+			{
+				if( rel_weak.expired() )
+				{
+					continue;
+				}
+				shared_ptr<IfcRelContainedInSpatialStructure> rel( rel_weak );
+				addRelationship( rel, [&]() { return filterRelatedObjects( rel, &IfcRelContainedInSpatialStructure::m_RelatedElements, set_core ); } );
+			}
+		}
+
+		if( !m_include_relationships )
+		{
+			continue;
+		}
+
+		std::vector<weak_ptr<IfcRelDefinesByProperties> > vec_defined_by;
+		IfcObject* object = dynamic_cast<IfcObject*>( object_def );
+		if( object )
+		{
+			vec_defined_by = object->m_IsDefinedBy_inverse;
+			for( const weak_ptr<IfcRelDefinesByType>& rel_weak : object->m_IsTypedBy_inverse )
+			{
+				if( rel_weak.expired() )
+				{
+					continue;
+				}
+				shared_ptr<IfcRelDefinesByType> rel( rel_weak );
+				addRelationship( rel, [&]() { return filterRelatedObjects( rel, &IfcRelDefinesByType::m_RelatedObjects, set_core ); } );
+			}
+		}
+		IfcContext* context = dynamic_cast<IfcContext*>( object_def );
+		if( context )
+		{
+			vec_defined_by = context->m_IsDefinedBy_inverse;
+		}
+		for( const weak_ptr<IfcRelDefinesByProperties>& rel_weak : vec_defined_by )
+		{
+			if( rel_weak.expired() )
+			{
+				continue;
+			}
+			shared_ptr<IfcRelDefinesByProperties> rel( rel_weak );
+			addRelationship( rel, [&]() { return filterRelatedObjects( rel, &IfcRelDefinesByProperties::m_RelatedObjects, set_core ); } );
+		}
+
+		for( const weak_ptr<IfcRelAssociates>& rel_weak : object_def->m_HasAssociations_inverse )
+		{
+			if( rel_weak.expired() )
+			{
+				continue;
+			}
+			shared_ptr<IfcRelAssociates> rel( rel_weak );
+			addRelationship( rel, [&]() -> shared_ptr<BuildingEntity>
+			{
+				shared_ptr<IfcRelAssociatesMaterial> rel_material = dynamic_pointer_cast<IfcRelAssociatesMaterial>( rel );
+				if( rel_material )
+				{
+					return filterRelatedObjects( rel_material, &IfcRelAssociates::m_RelatedObjects, set_core );
+				}
+				shared_ptr<IfcRelAssociatesClassification> rel_classification = dynamic_pointer_cast<IfcRelAssociatesClassification>( rel );
+				if( rel_classification )
+				{
+					return filterRelatedObjects( rel_classification, &IfcRelAssociates::m_RelatedObjects, set_core );
+				}
+
+				// other associations (documents, libraries, constraints, ...) only if they do not refer to objects outside of the subset
+				for( const shared_ptr<IfcDefinitionSelect>& related : rel->m_RelatedObjects )
+				{
+					if( !isInSet( related, set_core ) )
+					{
+						return shared_ptr<BuildingEntity>();
+					}
+				}
+				return rel;
+			} );
+		}
+
+		IfcElement* element = dynamic_cast<IfcElement*>( object_def );
+		if( element )
+		{
+			for( const weak_ptr<IfcRelVoidsElement>& rel_weak : element->m_HasOpenings_inverse )
+			{
+				if( rel_weak.expired() )
+				{
+					continue;
+				}
+				shared_ptr<IfcRelVoidsElement> rel( rel_weak );
+				addRelationship( rel, [&]() { return rel; } );
+			}
+			for( const weak_ptr<IfcRelFillsElement>& rel_weak : element->m_FillsVoids_inverse )
+			{
+				if( rel_weak.expired() )
+				{
+					continue;
+				}
+				shared_ptr<IfcRelFillsElement> rel( rel_weak );
+				addRelationship( rel, [&]() -> shared_ptr<BuildingEntity>
+				{
+					if( isInSet( rel->m_RelatingOpeningElement, set_core ) )
+					{
+						return rel;
+					}
+					return shared_ptr<BuildingEntity>();
+				} );
+			}
+		}
+	}
+
+	std::copy( vec_core.begin(), vec_core.end(), std::back_inserter( vec_roots ) );
+
+	// everything that the objects and relationships refer to: placements, representations, property sets, materials, ...
+	std::unordered_map<BuildingEntity*, shared_ptr<BuildingEntity> > map_dependent;
+	BuildingModel::collectDependentEntities( vec_roots, map_dependent );
+
+	// filtered copies of relationships replace the original in the map, since both have the same tag
+	std::unordered_map<int, shared_ptr<BuildingEntity> > map_subset;
+	for( auto& it : map_dependent )
+	{
+		map_subset.insert( { it.second->m_tag, it.second } );
+	}
+	for( const shared_ptr<BuildingEntity>& root : vec_roots )
+	{
+		map_subset[root->m_tag] = root;
+	}
+
+	shared_ptr<BuildingModel> subset_model( new BuildingModel() );
+	subset_model->setMapIfcEntities( map_subset );
+	subset_model->initFileHeader( subset.m_name + ".ifc", "IfcPlusPlus" );
+	return subset_model;
+}
+
+void ModelSplitter::createSubsetModels( const shared_ptr<BuildingModel>& model, const std::vector<Subset>& subsets, std::vector<shared_ptr<BuildingModel> >& subset_models )
+{
+	if( !model )
+	{
+		throw BuildingException( "Model not set.", __FUNC__ );
+	}
+
+	subset_models.clear();
+	subset_models.resize( subsets.size() );
+
+	std::vector<size_t> vec_indices( subsets.size() );
+	for( size_t ii = 0; ii < vec_indices.size(); ++ii )
+	{
+		vec_indices[ii] = ii;
+	}
+
+	std::atomic<size_t> num_done( 0 );
+	std::mutex mutex_progress;
+	FOR_EACH_LOOP vec_indices.begin(), vec_indices.end(), [&]( size_t ii )
+	{
+		try
+		{
+			subset_models[ii] = createSubsetModel( subsets[ii] );
+		}
+		catch( std::exception& e )
+		{
+			messageCallback( "Subset " + subsets[ii].m_name + ": " + e.what(), StatusCallback::MESSAGE_TYPE_ERROR, __FUNC__ );
+		}
+
+		const size_t done = ++num_done;
+		std::lock_guard<std::mutex> lock( mutex_progress );
+		progressValueCallback( double( done ) / double( subsets.size() ), "split" );
+	} );
+}
+
+size_t ModelSplitter::writeSubsetFiles( const shared_ptr<BuildingModel>& model, const std::vector<Subset>& subsets, const std::string& output_directory )
+{
+	std::vector<shared_ptr<BuildingModel> > subset_models;
+	createSubsetModels( model, subsets, subset_models );
+
+	std::error_code ec;
+	std::filesystem::create_directories( output_directory, ec );
+
+	std::vector<size_t> vec_indices( subsets.size() );
+	for( size_t ii = 0; ii < vec_indices.size(); ++ii )
+	{
+		vec_indices[ii] = ii;
+	}
+
+	std::atomic<size_t> num_written( 0 );
+	FOR_EACH_LOOP vec_indices.begin(), vec_indices.end(), [&]( size_t ii )
+	{
+		const shared_ptr<BuildingModel>& subset_model = subset_models[ii];
+		if( !subset_model )
+		{
+			return;
+		}
+
+		std::filesystem::path file_path = std::filesystem::path( output_directory ) / ( subsets[ii].m_name + ".ifc" );
+		std::stringstream stream;
+		WriterSTEP writer;
+		writer.writeModelToStream( stream, subset_model );
+
+		std::ofstream ofs( file_path, std::ofstream::out | std::ofstream::binary );
+		if( !ofs )
+		{
+			messageCallback( "Could not open file for writing: " + file_path.string(), StatusCallback::MESSAGE_TYPE_ERROR, __FUNC__ );
+			return;
+		}
+		ofs << stream.rdbuf();
+		++num_written;
+	} );
+
+	return num_written;
+}
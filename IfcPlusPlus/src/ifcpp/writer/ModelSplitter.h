@@ -0,0 +1,66 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include "ifcpp/model/BasicTypes.h"
+#include "ifcpp/model/BuildingModel.h"
+#include "ifcpp/model/StatusCallback.h"
+
+namespace IFC4X3
+{
+	class IfcObjectDefinition;
+}
+
+///@brief Extracts subsets of a model, for example one file per storey, or the objects of a GUID list
+///@details A subset contains its root objects, their parts, the elements contained in spatial roots, the spatial structure up to the IfcProject, and the relationships
+///that attach property sets, types, materials, classifications and openings. Relationships that also refer to objects outside of the subset are copied, and the copy
+///refers only to objects of the subset. All other entities are shared with the source model, which is not modified.
+///The subsets are computed in parallel.
+class IFCQUERY_EXPORT ModelSplitter : public StatusCallback
+{
+public:
+	struct Subset
+	{
+		std::string m_name;		// also the file name in writeSubsetFiles
+		std::vector<shared_ptr<IFC4X3::IfcObjectDefinition> > m_roots;
+	};
+
+	ModelSplitter() = default;
+	~ModelSplitter() override = default;
+
+	///@brief One subset per IfcBuildingStorey, sorted by tag
+	static std::vector<Subset> createSubsetsPerStorey( const shared_ptr<BuildingModel>& model );
+
+	///@brief Subset with the objects that have one of the given GUIDs
+	static Subset createSubsetFromGuids( const shared_ptr<BuildingModel>& model, const std::string& name, const std::vector<std::string>& guids );
+
+	///@brief Creates one model per subset. The subset models share their entities with model, so the entities must not be modified
+	void createSubsetModels( const shared_ptr<BuildingModel>& model, const std::vector<Subset>& subsets, std::vector<shared_ptr<BuildingModel> >& subset_models );
+
+	///@brief Creates the subset models, and writes them concurrently to output_directory/<name>.ifc
+	///@returns number of files written
+	size_t writeSubsetFiles( const shared_ptr<BuildingModel>& model, const std::vector<Subset>& subsets, const std::string& output_directory );
+
+	bool m_include_contained_elements = true;	// for spatial elements as roots, include the elements contained in them
+	bool m_include_relationships = true;		// property sets, types, materials, classifications and openings
+
+protected:
+	shared_ptr<BuildingModel> createSubsetModel( const Subset& subset );
+};
@@ -0,0 +1,626 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <sstream>
+#include <thread>
+#include <unordered_map>
+
+#include <ifcpp/model/BasicTypes.h>
+#include <ifcpp/model/BuildingException.h>
+#include <ifcpp/model/BuildingObject.h>
+#include <ifcpp/reader/ReaderUtil.h>
+#include <ifcpp/IFC4X3/EntityFactory.h>
+#include <IfcAreaMeasure.h>
+#include <IfcCountMeasure.h>
+#include <IfcElementQuantity.h>
+#include <IfcGloballyUniqueId.h>
+#include <IfcIdentifier.h>
+#include <IfcLabel.h>
+#include <IfcLengthMeasure.h>
+#include <IfcMassMeasure.h>
+#include <IfcNumericMeasure.h>
+#include <IfcPhysicalQuantity.h>
+#include <IfcProduct.h>
+#include <IfcProperty.h>
+#include <IfcPropertyBoundedValue.h>
+#include <IfcPropertyEnumeratedValue.h>
+#include <IfcPropertyListValue.h>
+#include <IfcPropertySet.h>
+#include <IfcPropertySetDefinition.h>
+#include <IfcPropertySetDefinitionSet.h>
+#include <IfcPropertySingleValue.h>
+#include <IfcQuantityArea.h>
+#include <IfcQuantityCount.h>
+#include <IfcQuantityLength.h>
+#include <IfcQuantityNumber.h>
+#include <IfcQuantityTime.h>
+#include <IfcQuantityVolume.h>
+#include <IfcQuantityWeight.h>
+#include <IfcRelDefinesByProperties.h>
+#include <IfcRelDefinesByType.h>
+#include <IfcText.h>
+#include <IfcTimeMeasure.h>
+#include <IfcTypeObject.h>
+#include <IfcValue.h>
+#include <IfcVolumeMeasure.h>
+
+#include "PropertyTable.h"
+
+using namespace IFC4X3;
+
+namespace
+{
+	///@brief String dictionary of one chunk. Index 0 is the empty string
+	class LocalDictionary
+	{
+	public:
+		LocalDictionary()
+		{
+			getIndex( std::string() );
+		}
+
+		uint32_t getIndex( const std::string& str )
+		{
+			auto it = m_map.find( str );
+			if( it != m_map.end() )
+			{
+				return it->second;
+			}
+			const uint32_t index = (uint32_t)m_strings.size();
+			auto inserted = m_map.insert( { str, index } );
+			m_strings.push_back( &inserted.first->first );
+			return index;
+		}
+
+		std::unordered_map<std::string, uint32_t> m_map;
+		std::vector<const std::string*> m_strings;		// points to the keys of m_map, which do not move
+	};
+
+	struct LocalColumn
+	{
+		uint32_t m_set_name = 0;
+		uint32_t m_property_name = 0;
+		std::vector<uint32_t> m_rows;
+		std::vector<uint32_t> m_values;
+	};
+
+	typedef std::vector<std::pair<uint32_t, uint32_t> > CellVector;	// local column index, local value index
+
+	class ChunkExtractor
+	{
+	public:
+		ChunkExtractor( bool include_quantities ) : m_include_quantities( include_quantities )
+		{
+			m_stream.imbue( std::locale::classic() );
+		}
+
+		void appendValueText( const BuildingObject* value, std::string& text )
+		{
+			if( !value )
+			{
+				return;
+			}
+
+			// the most frequent types, without formatting and decoding
+			const IfcLabel* label = dynamic_cast<const IfcLabel*>( value );
+			if( label )
+			{
+				text += label->m_value;
+				return;
+			}
+			const IfcIdentifier* identifier = dynamic_cast<const IfcIdentifier*>( value );
+			if( identifier )
+			{
+				text += identifier->m_value;
+				return;
+			}
+			const IfcText* ifc_text = dynamic_cast<const IfcText*>( value );
+			if( ifc_text )
+			{
+				text += ifc_text->m_value;
+				return;
+			}
+
+			m_stream.str( std::string() );
+			value->getStepParameter( m_stream, false, 15 );
+			const std::string step_value = m_stream.str();
+			if( step_value == ".T." )
+			{
+				text += "TRUE";
+			}
+			else if( step_value == ".F." )
+			{
+				text += "FALSE";
+			}
+			else if( step_value == ".U." )
+			{
+				text += "UNKNOWN";
+			}
+			else if( step_value.size() >= 2 && step_value.front() == '\'' && step_value.back() == '\'' )
+			{
+				std::string decoded;
+				decodeArgumentString( step_value.substr( 1, step_value.size() - 2 ), decoded );
+				text += decoded;
+			}
+			else if( step_value.size() >= 2 && step_value.front() == '.' && step_value.back() == '.' )
+			{
+				text += step_value.substr( 1, step_value.size() - 2 );
+			}
+			else
+			{
+				text += step_value;
+			}
+		}
+
+		void appendValueList( const std::vector<shared_ptr<IfcValue> >& values, std::string& text )
+		{
+			for( size_t ii = 0; ii < values.size(); ++ii )
+			{
+				if( ii > 0 )
+				{
+					text += ';';
+				}
+				appendValueText( values[ii].get(), text );
+			}
+		}
+
+		uint32_t getColumn( uint32_t set_name, uint32_t property_name )
+		{
+			const uint64_t key = ( uint64_t( set_name ) << 32 ) | property_name;
+			auto it = m_map_columns.find( key );
+			if( it != m_map_columns.end() )
+			{
+				return it->second;
+			}
+			const uint32_t column_index = (uint32_t)m_columns.size();
+			m_columns.emplace_back();
+			m_columns.back().m_set_name = set_name;
+			m_columns.back().m_property_name = property_name;
+			m_map_columns.insert( { key, column_index } );
+			return column_index;
+		}
+
+		///@brief Cells of a property set or element quantity, converted once per chunk
+		const CellVector& getCells( const IfcPropertySetDefinition* set_definition )
+		{
+			auto it = m_map_set_cells.find( set_definition );
+			if( it != m_map_set_cells.end() )
+			{
+				return it->second;
+			}
+
+			CellVector& cells = m_map_set_cells[set_definition];
+			const uint32_t set_name = m_dictionary.getIndex( set_definition->m_Name ? set_definition->m_Name->m_value.str() : std::string() );
+			std::string text;
+
+			const IfcPropertySet* property_set = dynamic_cast<const IfcPropertySet*>( set_definition );
+			if( property_set )
+			{
+				for( const shared_ptr<IfcProperty>& property : property_set->m_HasProperties )
+				{
+					if( !property || !property->m_Name )
+					{
+						continue;
+					}
+
+					text.clear();
+					const IfcProperty* property_ptr = property.get();
+					if( const IfcPropertySingleValue* single_value = dynamic_cast<const IfcPropertySingleValue*>( property_ptr ) )
+					{
+						appendValueText( single_value->m_NominalValue.get(), text );
+					}
+					else if( const IfcPropertyEnumeratedValue* enumerated_value = dynamic_cast<const IfcPropertyEnumeratedValue*>( property_ptr ) )
+					{
+						appendValueList( enumerated_value->m_EnumerationValues, text );
+					}
+					else if( const IfcPropertyListValue* list_value = dynamic_cast<const IfcPropertyListValue*>( property_ptr ) )
+					{
+						appendValueList( list_value->m_ListValues, text );
+					}
+					else if( const IfcPropertyBoundedValue* bounded_value = dynamic_cast<const IfcPropertyBoundedValue*>( property_ptr ) )
+					{
+						appendValueText( bounded_value->m_LowerBoundValue.get(), text );
+						text += ';';
+						appendValueText( bounded_value->m_UpperBoundValue.get(), text );
+					}
+					else
+					{
+						// complex, reference and table values have no single text value
+						continue;
+					}
+
+					cells.push_back( { getColumn( set_name, m_dictionary.getIndex( property->m_Name->m_value ) ), m_dictionary.getIndex( text ) } );
+				}
+				return cells;
+			}
+
+			const IfcElementQuantity* element_quantity = dynamic_cast<const IfcElementQuantity*>( set_definition );
+			if( element_quantity && m_include_quantities )
+			{
+				for( const shared_ptr<IfcPhysicalQuantity>& quantity : element_quantity->m_Quantities )
+				{
+					if( !quantity || !quantity->m_Name )
+					{
+						continue;
+					}
+
+					const IfcPhysicalQuantity* quantity_ptr = quantity.get();
+					const BuildingObject* value = nullptr;
+					if( const IfcQuantityLength* length = dynamic_cast<const IfcQuantityLength*>( quantity_ptr ) ) value = length->m_LengthValue.get();
+					else if( const IfcQuantityArea* area = dynamic_cast<const IfcQuantityArea*>( quantity_ptr ) ) value = area->m_AreaValue.get();
+					else if( const IfcQuantityVolume* volume = dynamic_cast<const IfcQuantityVolume*>( quantity_ptr ) ) value = volume->m_VolumeValue.get();
+					else if( const IfcQuantityCount* count = dynamic_cast<const IfcQuantityCount*>( quantity_ptr ) ) value = count->m_CountValue.get();
+					else if( const IfcQuantityWeight* weight = dynamic_cast<const IfcQuantityWeight*>( quantity_ptr ) ) value = weight->m_WeightValue.get();
+					else if( const IfcQuantityTime* time = dynamic_cast<const IfcQuantityTime*>( quantity_ptr ) ) value = time->m_TimeValue.get();
+					else if( const IfcQuantityNumber* number = dynamic_cast<const IfcQuantityNumber*>( quantity_ptr ) ) value = number->m_NumberValue.get();
+					if( !value )
+					{
+						continue;
+					}
+
+					text.clear();
+					appendValueText( value, text );
+					cells.push_back( { getColumn( set_name, m_dictionary.getIndex( quantity->m_Name->m_value ) ), m_dictionary.getIndex( text ) } );
+				}
+			}
+			return cells;
+		}
+
+		void appendSetDefinition( const shared_ptr<IfcPropertySetDefinitionSelect>& definition_select, CellVector& row_cells )
+		{
+			if( !definition_select )
+			{
+				return;
+			}
+			const IfcPropertySetDefinition* set_definition = dynamic_cast<const IfcPropertySetDefinition*>( definition_select.get() );
+			if( set_definition )
+			{
+				const CellVector& cells = getCells( set_definition );
+				row_cells.insert( row_cells.end(), cells.begin(), cells.end() );
+				return;
+			}
+
+			const IfcPropertySetDefinitionSet* definition_set = dynamic_cast<const IfcPropertySetDefinitionSet*>( definition_select.get() );
+			if( definition_set )
+			{
+				for( const shared_ptr<IfcPropertySetDefinition>& set_definition_in_set : definition_set->m_vec )
+				{
+					if( set_definition_in_set )
+					{
+						const CellVector& cells = getCells( set_definition_in_set.get() );
+						row_cells.insert( row_cells.end(), cells.begin(), cells.end() );
+					}
+				}
+			}
+		}
+
+		void addRow( uint32_t row, const IfcProduct* product, bool include_type_properties )
+		{
+			m_row_cells.clear();
+
+			// type properties first, so that properties of the product itself override them
+			if( include_type_properties )
+			{
+				for( const weak_ptr<IfcRelDefinesByType>& rel_type_weak : product->m_IsTypedBy_inverse )
+				{
+					shared_ptr<IfcRelDefinesByType> rel_type = rel_type_weak.lock();
+					if( rel_type && rel_type->m_RelatingType )
+					{
+						for( const shared_ptr<IfcPropertySetDefinition>& set_definition : rel_type->m_RelatingType->m_HasPropertySets )
+						{
+							if( set_definition )
+							{
+								const CellVector& cells = getCells( set_definition.get() );
+								m_row_cells.insert( m_row_cells.end(), cells.begin(), cells.end() );
+							}
+						}
+					}
+				}
+			}
+
+			for( const weak_ptr<IfcRelDefinesByProperties>& rel_properties_weak : product->m_IsDefinedBy_inverse )
+			{
+				shared_ptr<IfcRelDefinesByProperties> rel_properties = rel_properties_weak.lock();
+				if( rel_properties )
+				{
+					appendSetDefinition( rel_properties->m_RelatingPropertyDefinition, m_row_cells );
+				}
+			}
+
+			// keep the last value of each column
+			std::stable_sort( m_row_cells.begin(), m_row_cells.end(), []( const std::pair<uint32_t, uint32_t>& a, const std::pair<uint32_t, uint32_t>& b ) { return a.first < b.first; } );
+			for( size_t ii = 0; ii < m_row_cells.size(); ++ii )
+			{
+				if( ii + 1 < m_row_cells.size() && m_row_cells[ii + 1].first == m_row_cells[ii].first )
+				{
+					continue;
+				}
+				LocalColumn& column = m_columns[m_row_cells[ii].first];
+				column.m_rows.push_back( row );
+				column.m_values.push_back( m_row_cells[ii].second );
+			}
+
+			m_guids.push_back( product->m_GlobalId ? m_dictionary.getIndex( product->m_GlobalId->m_value ) : 0 );
+			m_types.push_back( m_dictionary.getIndex( EntityFactory::getStringForClassID( product->classID() ) ) );
+			m_names.push_back( product->m_Name ? m_dictionary.getIndex( product->m_Name->m_value ) : 0 );
+		}
+
+		LocalDictionary m_dictionary;
+		std::vector<LocalColumn> m_columns;
+		std::vector<uint32_t> m_guids;
+		std::vector<uint32_t> m_types;
+		std::vector<uint32_t> m_names;
+
+	private:
+		bool m_include_quantities;
+		std::unordered_map<uint64_t, uint32_t> m_map_columns;
+		std::unordered_map<const IfcPropertySetDefinition*, CellVector> m_map_set_cells;
+		CellVector m_row_cells;
+		std::stringstream m_stream;
+	};
+
+	void writeUInt32( std::ostream& stream, uint32_t value )
+	{
+		const char bytes[4] = { char( value & 0xff ), char( ( value >> 8 ) & 0xff ), char( ( value >> 16 ) & 0xff ), char( ( value >> 24 ) & 0xff ) };
+		stream.write( bytes, 4 );
+	}
+
+	void writeUInt32Vector( std::ostream& stream, const std::vector<uint32_t>& vec )
+	{
+		for( uint32_t value : vec )
+		{
+			writeUInt32( stream, value );
+		}
+	}
+
+	void writeCSVField( std::ostream& stream, const std::string& value, char separator )
+	{
+		if( value.find_first_of( std::string( "\"\r\n" ) + separator ) == std::string::npos )
+		{
+			stream << value;
+			return;
+		}
+		stream << '"';
+		for( char c : value )
+		{
+			if( c == '"' )
+			{
+				stream << '"';
+			}
+			stream << c;
+		}
+		stream << '"';
+	}
+}
+
+void PropertyTable::clear()
+{
+	m_dictionary.clear();
+	m_guids.clear();
+	m_types.clear();
+	m_names.clear();
+	m_columns.clear();
+}
+
+uint32_t PropertyTable::getValue( size_t column_index, size_t row ) const
+{
+	const Column& column = m_columns[column_index];
+	auto it = std::lower_bound( column.m_rows.begin(), column.m_rows.end(), (uint32_t)row );
+	if( it != column.m_rows.end() && *it == row )
+	{
+		return column.m_values[it - column.m_rows.begin()];
+	}
+	return 0;
+}
+
+void PropertyTable::writeCSV( std::ostream& stream, char separator ) const
+{
+	stream << "GlobalId" << separator << "Type" << separator << "Name";
+	for( const Column& column : m_columns )
+	{
+		stream << separator;
+		writeCSVField( stream, m_dictionary[column.m_set_name] + "." + m_dictionary[column.m_property_name], separator );
+	}
+	stream << "\n";
+
+	// one cursor per column, since the rows of each column are sorted
+	std::vector<size_t> vec_cursors( m_columns.size(), 0 );
+	for( size_t row = 0; row < getNumRows(); ++row )
+	{
+		writeCSVField( stream, m_dictionary[m_guids[row]], separator );
+		stream << separator;
+		writeCSVField( stream, m_dictionary[m_types[row]], separator );
+		stream << separator;
+		writeCSVField( stream, m_dictionary[m_names[row]], separator );
+		for( size_t ii = 0; ii < m_columns.size(); ++ii )
+		{
+			stream << separator;
+			const Column& column = m_columns[ii];
+			size_t& cursor = vec_cursors[ii];
+			if( cursor < column.m_rows.size() && column.m_rows[cursor] == row )
+			{
+				writeCSVField( stream, m_dictionary[column.m_values[cursor]], separator );
+				++cursor;
+			}
+		}
+		stream << "\n";
+	}
+}
+
+void PropertyTable::writeBinary( std::ostream& stream ) const
+{
+	stream.write( "IFCPTBL1", 8 );
+	writeUInt32( stream, (uint32_t)m_dictionary.size() );
+	for( const std::string& str : m_dictionary )
+	{
+		writeUInt32( stream, (uint32_t)str.size() );
+		stream.write( str.data(), str.size() );
+	}
+
+	writeUInt32( stream, (uint32_t)getNumRows() );
+	writeUInt32Vector( stream, m_guids );
+	writeUInt32Vector( stream, m_types );
+	writeUInt32Vector( stream, m_names );
+
+	writeUInt32( stream, (uint32_t)m_columns.size() );
+	for( const Column& column : m_columns )
+	{
+		writeUInt32( stream, column.m_set_name );
+		writeUInt32( stream, column.m_property_name );
+		writeUInt32( stream, (uint32_t)column.m_rows.size() );
+		writeUInt32Vector( stream, column.m_rows );
+		writeUInt32Vector( stream, column.m_values );
+	}
+}
+
+void PropertyTableExtractor::extractProperties( const shared_ptr<BuildingModel>& model, PropertyTable& table )
+{
+	if( !model )
+	{
+		throw BuildingException( "Model not set.", __FUNC__ );
+	}
+
+	table.clear();
+	progressTextCallback( "Extracting properties..." );
+	progressValueCallback( 0, "properties" );
+
+	std::vector<const IfcProduct*> vec_products;
+	for( auto& it : model->getMapIfcEntities() )
+	{
+		const IfcProduct* product = dynamic_cast<const IfcProduct*>( it.second.get() );
+		if( product )
+		{
+			vec_products.push_back( product );
+		}
+	}
+	std::sort( vec_products.begin(), vec_products.end(), []( const IfcProduct* a, const IfcProduct* b ) { return a->m_tag < b->m_tag; } );
+
+	// several chunks per thread for load balancing, but not so many that the per chunk caches do not pay off
+	const size_t num_threads = std::max( 1u, std::thread::hardware_concurrency() );
+	const size_t chunk_size = std::max( size_t( 1024 ), vec_products.size() / ( num_threads * 4 ) + 1 );
+	const size_t num_chunks = ( vec_products.size() + chunk_size - 1 ) / chunk_size;
+	std::vector<std::unique_ptr<ChunkExtractor> > vec_chunks( num_chunks );
+	std::vector<size_t> vec_chunk_indices( num_chunks );
+	for( size_t ii = 0; ii < num_chunks; ++ii )
+	{
+		vec_chunk_indices[ii] = ii;
+	}
+
+	const bool include_type_properties = m_include_type_properties;
+	const bool include_quantities = m_include_quantities;
+	FOR_EACH_LOOP vec_chunk_indices.begin(), vec_chunk_indices.end(), [&]( size_t chunk_index )
+	{
+		std::unique_ptr<ChunkExtractor> chunk( new ChunkExtractor( include_quantities ) );
+		const size_t begin = chunk_index * chunk_size;
+		const size_t end = std::min( begin + chunk_size, vec_products.size() );
+		for( size_t row = begin; row < end; ++row )
+		{
+			chunk->addRow( (uint32_t)row, vec_products[row], include_type_properties );
+		}
+		vec_chunks[chunk_index] = std::move( chunk );
+	} );
+	progressValueCallback( 0.7, "properties" );
+
+	// merge the chunks in order, so that rows of each column stay sorted
+	std::unordered_map<std::string, uint32_t> map_dictionary;
+	std::unordered_map<uint64_t, uint32_t> map_columns;
+	auto getGlobalIndex = [&]( const std::string& str ) -> uint32_t
+	{
+		auto it = map_dictionary.find( str );
+		if( it != map_dictionary.end() )
+		{
+			return it->second;
+		}
+		const uint32_t index = (uint32_t)table.m_dictionary.size();
+		table.m_dictionary.push_back( str );
+		map_dictionary.insert( { str, index } );
+		return index;
+	};
+	getGlobalIndex( std::string() );
+
+	table.m_guids.reserve( vec_products.size() );
+	table.m_types.reserve( vec_products.size() );
+	table.m_names.reserve( vec_products.size() );
+
+	std::vector<uint32_t> vec_remap;
+	for( std::unique_ptr<ChunkExtractor>& chunk : vec_chunks )
+	{
+		vec_remap.resize( chunk->m_dictionary.m_strings.size() );
+		for( size_t ii = 0; ii < vec_remap.size(); ++ii )
+		{
+			vec_remap[ii] = getGlobalIndex( *chunk->m_dictionary.m_strings[ii] );
+		}
+
+		for( uint32_t guid : chunk->m_guids ) table.m_guids.push_back( vec_remap[guid] );
+		for( uint32_t type : chunk->m_types ) table.m_types.push_back( vec_remap[type] );
+		for( uint32_t name : chunk->m_names ) table.m_names.push_back( vec_remap[name] );
+
+		for( LocalColumn& local_column : chunk->m_columns )
+		{
+			const uint32_t set_name = vec_remap[local_column.m_set_name];
+			const uint32_t property_name = vec_remap[local_column.m_property_name];
+			const uint64_t key = ( uint64_t( set_name ) << 32 ) | property_name;
+			auto it_column = map_columns.find( key );
+			if( it_column == map_columns.end() )
+			{
+				it_column = map_columns.insert( { key, (uint32_t)table.m_columns.size() } ).first;
+				table.m_columns.emplace_back();
+				table.m_columns.back().m_set_name = set_name;
+				table.m_columns.back().m_property_name = property_name;
+			}
+
+			PropertyTable::Column& column = table.m_columns[it_column->second];
+			column.m_rows.insert( column.m_rows.end(), local_column.m_rows.begin(), local_column.m_rows.end() );
+			for( uint32_t value : local_column.m_values )
+			{
+				column.m_values.push_back( vec_remap[value] );
+			}
+		}
+
+		// free the memory of the chunk early, large models need it for the merged table
+		chunk.reset();
+	}
+
+	// sorted columns, so that the output does not depend on the order of properties in the file
+	std::vector<size_t> vec_order( table.m_columns.size() );
+	for( size_t ii = 0; ii < vec_order.size(); ++ii )
+	{
+		vec_order[ii] = ii;
+	}
+	std::sort( vec_order.begin(), vec_order.end(), [&]( size_t a, size_t b )
+	{
+		const PropertyTable::Column& column_a = table.m_columns[a];
+		const PropertyTable::Column& column_b = table.m_columns[b];
+		const int compare_set = table.m_dictionary[column_a.m_set_name].compare( table.m_dictionary[column_b.m_set_name] );
+		if( compare_set != 0 )
+		{
+			return compare_set < 0;
+		}
+		return table.m_dictionary[column_a.m_property_name] < table.m_dictionary[column_b.m_property_name];
+	} );
+	std::vector<PropertyTable::Column> vec_sorted_columns( table.m_columns.size() );
+	for( size_t ii = 0; ii < vec_order.size(); ++ii )
+	{
+		vec_sorted_columns[ii] = std::move( table.m_columns[vec_order[ii]] );
+	}
+	table.m_columns = std::move( vec_sorted_columns );
+
+	progressValueCallback( 1.0, "properties" );
+}
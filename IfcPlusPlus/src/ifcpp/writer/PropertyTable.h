@@ -0,0 +1,79 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "ifcpp/model/BasicTypes.h"
+#include "ifcpp/model/BuildingModel.h"
+#include "ifcpp/model/StatusCallback.h"
+
+///@brief Properties and quantities of all products of a model, one row per product and one column per property
+///@details All strings are stored once in a dictionary, and the table contains only indices into it. Index 0 is the empty string, which means "no value".
+///Property columns are sparse, since most properties exist only for some products: a column stores the rows that have a value, in ascending order, and the values.
+///Values are formatted as text: strings without quotes, numbers as in STEP files, booleans and logicals as TRUE, FALSE and UNKNOWN. List values are separated by ';'.
+class IFCQUERY_EXPORT PropertyTable
+{
+public:
+	struct Column
+	{
+		uint32_t				m_set_name = 0;			// name of the IfcPropertySet or IfcElementQuantity
+		uint32_t				m_property_name = 0;	// name of the IfcProperty or IfcPhysicalQuantity
+		std::vector<uint32_t>	m_rows;
+		std::vector<uint32_t>	m_values;
+	};
+
+	void clear();
+	size_t getNumRows() const { return m_guids.size(); }
+	const std::string& getString( uint32_t index ) const { return m_dictionary[index]; }
+
+	///@brief Value of a cell as dictionary index, 0 if the product has no such property. Binary search in the column
+	uint32_t getValue( size_t column, size_t row ) const;
+
+	///@brief Dense table with header line. Columns: GlobalId, Type, Name, and "<set>.<property>" for each property column
+	void writeCSV( std::ostream& stream, char separator = ',' ) const;
+
+	///@brief Simple columnar binary file. All integers are little endian uint32:
+	///"IFCPTBL1", number of strings, for each string its length and the UTF-8 bytes, number of rows, the GlobalId, Type and Name column (one index per row),
+	///number of property columns, for each column: set name, property name, number of values, row indices, value indices
+	void writeBinary( std::ostream& stream ) const;
+
+	std::vector<std::string>	m_dictionary;
+	std::vector<uint32_t>		m_guids;		// one entry per row
+	std::vector<uint32_t>		m_types;		// entity type, for example IfcWall
+	std::vector<uint32_t>		m_names;
+	std::vector<Column>			m_columns;
+};
+
+///@brief Fills a PropertyTable with the properties and quantities of all IfcProduct objects in a model
+///@details Properties of the type object (IfcRelDefinesByType) are included, and overridden by a property with the same set and property name on the product itself.
+///The products are processed in parallel chunks, with a dictionary and columns per chunk. The chunks are then merged in order. Property sets shared by many products
+///are converted to text only once per chunk. Inverse attributes must be resolved, which ReaderSTEP does.
+class IFCQUERY_EXPORT PropertyTableExtractor : public StatusCallback
+{
+public:
+	PropertyTableExtractor() = default;
+	~PropertyTableExtractor() override = default;
+
+	void extractProperties( const shared_ptr<BuildingModel>& model, PropertyTable& table );
+
+	bool m_include_type_properties = true;
+	bool m_include_quantities = true;
+};
@@ -0,0 +1,562 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <external/RapidJSON/filewritestream.h>
+#include <external/RapidJSON/ostreamwrapper.h>
+#include <external/RapidJSON/stringbuffer.h>
+#include <external/RapidJSON/writer.h>
+
+#include "ifcpp/model/AttributeObject.h"
+#include "ifcpp/model/BasicTypes.h"
+#include "ifcpp/model/BuildingObject.h"
+#include "ifcpp/model/BuildingModel.h"
+#include "ifcpp/IFC4X3/EntityFactory.h"
+#include "ifcpp/IFC4X3/SchemaInfo.h"
+#include "ifcpp/reader/ReaderUtil.h"
+#include "ifcpp/writer/WriterJSON.h"
+#include "ifcpp/writer/WriterUtil.h"
+
+using namespace IFC4X3;
+
+namespace
+{
+	const size_t NUM_ENTITIES_PER_SHARD = 256;
+	const size_t NUM_SHARDS_PER_BATCH = 256;
+
+	void appendUtf8(std::string& out, uint32_t code_point)
+	{
+		if (code_point < 0x80)
+		{
+			out += char(code_point);
+		}
+		else if (code_point < 0x800)
+		{
+			out += char(0xC0 | (code_point >> 6));
+			out += char(0x80 | (code_point & 0x3F));
+		}
+		else
+		{
+			out += char(0xE0 | (code_point >> 12));
+			out += char(0x80 | ((code_point >> 6) & 0x3F));
+			out += char(0x80 | (code_point & 0x3F));
+		}
+	}
+
+	int hexValue(char c)
+	{
+		if (c >= '0' && c <= '9') { return c - '0'; }
+		if (c >= 'A' && c <= 'F') { return c - 'A' + 10; }
+		if (c >= 'a' && c <= 'f') { return c - 'a' + 10; }
+		return 0;
+	}
+
+	/// Reverses encodeStepString. Strings are held as UTF-8 in the model, and encodeStepString writes each byte above 127 as \X2\00hh\X0\, so these become bytes again
+	void decodeStepString(const char* begin, const char* end, std::string& out)
+	{
+		out.clear();
+		const char* pos = begin;
+		while (pos < end)
+		{
+			if (*pos != '\\' || pos + 1 >= end)
+			{
+				out += *pos++;
+				continue;
+			}
+
+			if (pos[1] == '\\')
+			{
+				out += '\\';
+				pos += 2;
+			}
+			else if (pos[1] == 'X' && pos + 4 < end && pos[2] == '\\')
+			{
+				// \X\hh
+				out += char((hexValue(pos[3]) << 4) | hexValue(pos[4]));
+				pos += 5;
+			}
+			else if (pos[1] == 'X' && pos + 3 < end && pos[2] == '2' && pos[3] == '\\')
+			{
+				// \X2\hhhhhhhh\X0\ with four hex digits per character
+				pos += 4;
+				while (pos + 3 < end && *pos != '\\')
+				{
+					const uint32_t code = (hexValue(pos[0]) << 12) | (hexValue(pos[1]) << 8) | (hexValue(pos[2]) << 4) | hexValue(pos[3]);
+					if (code < 0x100)
+					{
+						out += char(code);
+					}
+					else
+					{
+						appendUtf8(out, code);
+					}
+					pos += 4;
+				}
+				if (pos + 3 < end && pos[1] == 'X' && pos[2] == '0' && pos[3] == '\\')
+				{
+					pos += 4;
+				}
+			}
+			else if (pos[1] == 'N' && pos + 2 < end && pos[2] == '\\')
+			{
+				out += '\n';
+				pos += 3;
+			}
+			else
+			{
+				out += *pos++;
+			}
+		}
+	}
+
+	/// attribute names of getAttributes in lowerCamelCase, and the declared attribute types, which tell where values of select types need their type name
+	struct ClassAttributes
+	{
+		std::vector<std::string> keys;
+		const SchemaType* schema_type = nullptr;
+	};
+
+	/// Writes entities into a buffer. Each shard of entities has its own, so that shards can be written in parallel
+	class EntityJsonWriter
+	{
+	public:
+		EntityJsonWriter(const std::unordered_map<uint32_t, ClassAttributes>& map_classes, size_t precision)
+			: m_writer(m_buffer), m_map_classes(map_classes), m_precision(precision)
+		{
+			m_step_value.imbue(std::locale("C"));
+		}
+
+		rapidjson::StringBuffer m_buffer;
+		std::vector<size_t> m_entity_end;	// end of each entity in m_buffer
+
+		void writeEntity(const shared_ptr<BuildingEntity>& entity)
+		{
+			const ClassAttributes& class_attributes = m_map_classes.at(entity->classID());
+			m_attributes.clear();
+			entity->getAttributes(m_attributes);
+
+			m_writer.Reset(m_buffer);
+			m_writer.StartObject();
+			m_writer.Key("type");
+			m_writer.String(EntityFactory::getStringForClassID(entity->classID()));
+			m_writer.Key("id");
+			writeId(entity->m_tag);
+
+			const std::vector<std::string>& keys = class_attributes.keys;
+			for (size_t ii = 0; ii < m_attributes.size() && ii < keys.size(); ++ii)
+			{
+				const shared_ptr<BuildingObject>& value = m_attributes[ii].second;
+				if (!value)
+				{
+					// attribute not set
+					continue;
+				}
+				const AttributeObjectVector* list = dynamic_cast<const AttributeObjectVector*>(value.get());
+				if (list && list->m_vec.empty())
+				{
+					// getAttributes gives an empty list for lists that are not set
+					continue;
+				}
+
+				const SchemaType* declared_type = nullptr;
+				if (class_attributes.schema_type && ii < class_attributes.schema_type->attributes.size())
+				{
+					declared_type = class_attributes.schema_type->attributes[ii].type;
+				}
+				m_writer.Key(keys[ii].c_str(), rapidjson::SizeType(keys[ii].size()));
+				writeValue(value, declared_type);
+			}
+			m_writer.EndObject();
+			m_entity_end.push_back(m_buffer.GetSize());
+		}
+
+	private:
+		void writeId(int tag)
+		{
+			char id[16];
+			const int length = snprintf(id, sizeof(id), "i%d", tag);
+			m_writer.String(id, rapidjson::SizeType(length));
+		}
+
+		void writeValue(const shared_ptr<BuildingObject>& value, const SchemaType* declared_type)
+		{
+			if (!value)
+			{
+				m_writer.Null();
+				return;
+			}
+
+			const AttributeObjectVector* list = dynamic_cast<const AttributeObjectVector*>(value.get());
+			if (list)
+			{
+				// the items of a list have the declared type of the list
+				m_writer.StartArray();
+				for (const shared_ptr<BuildingObject>& item : list->m_vec)
+				{
+					writeValue(item, declared_type);
+				}
+				m_writer.EndArray();
+				return;
+			}
+
+			const BuildingEntity* entity = dynamic_cast<const BuildingEntity*>(value.get());
+			if (entity)
+			{
+				// reference: {"type":"IfcOwnerHistory","ref":"i5"}
+				m_writer.StartObject();
+				m_writer.Key("type");
+				m_writer.String(EntityFactory::getStringForClassID(entity->classID()));
+				m_writer.Key("ref");
+				writeId(entity->m_tag);
+				m_writer.EndObject();
+				return;
+			}
+
+			const SchemaType* value_type = getValueType(value->classID());
+			if (declared_type && declared_type->kind == SCHEMA_SELECT && value_type)
+			{
+				// value of a select type: IFCLABEL('text') -> {"type":"IFCLABEL","value":"text"}
+				m_writer.StartObject();
+				m_writer.Key("type");
+				m_writer.String(value_type->name_upper.c_str(), rapidjson::SizeType(value_type->name_upper.size()));
+				m_writer.Key("value");
+				writeSimpleValue(*value, value_type);
+				m_writer.EndObject();
+				return;
+			}
+			writeSimpleValue(*value, value_type);
+		}
+
+		/// the type of a value, from its class. nullptr for the attribute classes RealAttribute, IntegerAttribute and so on
+		const SchemaType* getValueType(uint32_t class_id)
+		{
+			auto it = m_map_value_types.find(class_id);
+			if (it != m_map_value_types.end())
+			{
+				return it->second;
+			}
+			const SchemaType* value_type = nullptr;
+			const char* class_name = EntityFactory::getStringForClassID(class_id);
+			if (class_name)
+			{
+				std::string class_name_upper = class_name;
+				convertStringToUpperCase(class_name_upper);
+				value_type = SchemaInfo::getType(class_name_upper);
+			}
+			m_map_value_types[class_id] = value_type;
+			return value_type;
+		}
+
+		void writeSimpleValue(const BuildingObject& value, const SchemaType* value_type)
+		{
+			if (const RealAttribute* real_attribute = dynamic_cast<const RealAttribute*>(&value))
+			{
+				resetStepValue();
+				appendRealWithoutTrailingZeros(m_step_value, real_attribute->m_value, m_precision);
+				writeNumber(m_step_value.str());
+				return;
+			}
+			if (const IntegerAttribute* integer_attribute = dynamic_cast<const IntegerAttribute*>(&value))
+			{
+				m_writer.Int(integer_attribute->m_value);
+				return;
+			}
+			if (const BoolAttribute* bool_attribute = dynamic_cast<const BoolAttribute*>(&value))
+			{
+				m_writer.Bool(bool_attribute->m_value);
+				return;
+			}
+			if (const LogicalAttribute* logical_attribute = dynamic_cast<const LogicalAttribute*>(&value))
+			{
+				writeLogical(logical_attribute->m_value == LOGICAL_TRUE ? "T" : (logical_attribute->m_value == LOGICAL_FALSE ? "F" : "U"));
+				return;
+			}
+			if (const StringAttribute* string_attribute = dynamic_cast<const StringAttribute*>(&value))
+			{
+				m_writer.String(string_attribute->m_value.c_str(), rapidjson::SizeType(string_attribute->m_value.size()));
+				return;
+			}
+			if (!value_type)
+			{
+				m_writer.Null();
+				return;
+			}
+
+			// the generated types hold their value in members of different types, so it is taken from the STEP parameter of the single value
+			resetStepValue();
+			value.getStepParameter(m_step_value, false, m_precision);
+			const std::string step_value = m_step_value.str();
+			if (value_type->list_depth > 0)
+			{
+				// list types of numbers, like IfcLineIndex: (1,2)
+				writeNumberList(step_value);
+				return;
+			}
+
+			switch (value_type->kind)
+			{
+			case SCHEMA_STRING:
+			case SCHEMA_BINARY:
+				if (step_value.size() >= 2)
+				{
+					// 'text' or "0F"
+					decodeStepString(step_value.c_str() + 1, step_value.c_str() + step_value.size() - 1, m_string);
+					m_writer.String(m_string.c_str(), rapidjson::SizeType(m_string.size()));
+					return;
+				}
+				break;
+			case SCHEMA_ENUM:
+				if (step_value.size() >= 2 && step_value.front() == '.' && step_value.back() == '.')
+				{
+					// enumeration or boolean: .T. .F. .U. .NOTDEFINED.
+					writeLogical(step_value.substr(1, step_value.size() - 2));
+					return;
+				}
+				break;
+			case SCHEMA_NUMBER:
+				writeNumber(step_value);
+				return;
+			default:
+				break;
+			}
+			m_writer.Null();
+		}
+
+		void resetStepValue()
+		{
+			m_step_value.str("");
+			m_step_value.clear();
+		}
+
+		/// T and F become booleans, U becomes "UNKNOWN", other enumerators are written as they are
+		void writeLogical(const std::string& literal)
+		{
+			if (literal == "T")
+			{
+				m_writer.Bool(true);
+			}
+			else if (literal == "F")
+			{
+				m_writer.Bool(false);
+			}
+			else if (literal == "U")
+			{
+				m_writer.String("UNKNOWN");
+			}
+			else
+			{
+				m_writer.String(literal.c_str(), rapidjson::SizeType(literal.size()));
+			}
+		}
+
+		void writeNumberList(const std::string& step_list)
+		{
+			m_writer.StartArray();
+			size_t begin = step_list.find_first_not_of("( ");
+			while (begin != std::string::npos && begin < step_list.size() && step_list[begin] != ')')
+			{
+				const size_t end = std::min(step_list.find_first_of(",)", begin), step_list.size());
+				writeNumber(step_list.substr(begin, end - begin));
+				begin = step_list.find_first_not_of(", ", end);
+			}
+			m_writer.EndArray();
+		}
+
+		/// STEP reals like 1. or -0.5 are written as JSON numbers 1.0 and -0.5
+		void writeNumber(const std::string& step_number)
+		{
+			m_number.clear();
+			const char* pos = step_number.c_str();
+			const char* end = pos + step_number.size();
+			if (pos < end && *pos == '+')
+			{
+				++pos;
+			}
+			while (pos < end && !isspace((unsigned char)*pos))
+			{
+				const char c = *pos++;
+				if (c == '.' && (m_number.empty() || m_number.back() == '-'))
+				{
+					m_number += '0';
+				}
+				m_number += c;
+				if (c == '.' && (pos >= end || !isdigit((unsigned char)*pos)))
+				{
+					m_number += '0';
+				}
+			}
+			if (m_number.empty() || m_number == "$")
+			{
+				m_writer.Null();
+				return;
+			}
+			m_writer.RawValue(m_number.c_str(), m_number.size(), rapidjson::kNumberType);
+		}
+
+		rapidjson::Writer<rapidjson::StringBuffer> m_writer;
+		const std::unordered_map<uint32_t, ClassAttributes>& m_map_classes;
+		size_t m_precision;
+		std::vector<std::pair<std::string, shared_ptr<BuildingObject> > > m_attributes;
+		std::unordered_map<uint32_t, const SchemaType*> m_map_value_types;
+		std::stringstream m_step_value;
+		std::string m_string;
+		std::string m_number;
+	};
+
+	/// attribute names in lowerCamelCase, as used in ifcJSON: GlobalId -> globalId
+	void getClassAttributes(const shared_ptr<BuildingEntity>& entity, ClassAttributes& class_attributes)
+	{
+		std::vector<std::pair<std::string, shared_ptr<BuildingObject> > > vec_attributes;
+		entity->getAttributes(vec_attributes);
+		for (auto& attribute : vec_attributes)
+		{
+			std::string key = attribute.first;
+			if (!key.empty())
+			{
+				key[0] = char(tolower((unsigned char)key[0]));
+			}
+			class_attributes.keys.push_back(key);
+		}
+
+		std::string class_name_upper = EntityFactory::getStringForClassID(entity->classID());
+		convertStringToUpperCase(class_name_upper);
+		class_attributes.schema_type = SchemaInfo::getType(class_name_upper);
+	}
+
+	template<typename OutputStream>
+	void writeModelJSON(OutputStream& os, shared_ptr<BuildingModel>& model, size_t precision, StatusCallback* status)
+	{
+		// ascending ids, like in STEP files
+		const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map_entities = model->getMapIfcEntities();
+		std::vector<shared_ptr<BuildingEntity> > vec_entities;
+		vec_entities.reserve(map_entities.size());
+		for (auto& it : map_entities)
+		{
+			if (it.second)
+			{
+				vec_entities.push_back(it.second);
+			}
+		}
+		std::sort(vec_entities.begin(), vec_entities.end(), [](const shared_ptr<BuildingEntity>& a, const shared_ptr<BuildingEntity>& b) { return a->m_tag < b->m_tag; });
+
+		std::unordered_map<uint32_t, ClassAttributes> map_classes;
+		for (const shared_ptr<BuildingEntity>& entity : vec_entities)
+		{
+			if (map_classes.find(entity->classID()) == map_classes.end())
+			{
+				getClassAttributes(entity, map_classes[entity->classID()]);
+			}
+		}
+
+		char time_stamp[80];
+		time_t rawtime;
+		time(&rawtime);
+		strftime(time_stamp, sizeof(time_stamp), "%Y-%m-%dT%H:%M:%S", localtime(&rawtime));
+
+		rapidjson::Writer<OutputStream> writer(os);
+		writer.StartObject();
+		writer.Key("type");
+		writer.String("ifcJSON");
+		writer.Key("version");
+		writer.String("0.0.1");
+		writer.Key("schemaIdentifier");
+		writer.String(model->getIfcSchemaVersionCurrent().c_str());
+		writer.Key("originatingSystem");
+		writer.String("IfcPlusPlus");
+		writer.Key("preprocessorVersion");
+		writer.String("IfcPlusPlus");
+		writer.Key("timeStamp");
+		writer.String(time_stamp);
+		writer.Key("data");
+		writer.StartArray();
+
+		// shards are written in parallel, then appended in order. Batches of shards keep the memory bounded for large models
+		const size_t num_shards = (vec_entities.size() + NUM_ENTITIES_PER_SHARD - 1) / NUM_ENTITIES_PER_SHARD;
+		for (size_t batch_begin = 0; batch_begin < num_shards; batch_begin += NUM_SHARDS_PER_BATCH)
+		{
+			const size_t batch_end = std::min(num_shards, batch_begin + NUM_SHARDS_PER_BATCH);
+			std::vector<size_t> shard_indices(batch_end - batch_begin);
+			for (size_t ii = 0; ii < shard_indices.size(); ++ii)
+			{
+				shard_indices[ii] = batch_begin + ii;
+			}
+
+			std::vector<shared_ptr<EntityJsonWriter> > shards(shard_indices.size());
+			FOR_EACH_LOOP shard_indices.begin(), shard_indices.end(), [&](size_t shard_index) {
+					shared_ptr<EntityJsonWriter> shard(new EntityJsonWriter(map_classes, precision));
+					const size_t begin = shard_index * NUM_ENTITIES_PER_SHARD;
+					const size_t end = std::min(vec_entities.size(), begin + NUM_ENTITIES_PER_SHARD);
+					for (size_t ii = begin; ii < end; ++ii)
+					{
+						shard->writeEntity(vec_entities[ii]);
+					}
+					shards[shard_index - batch_begin] = shard;
+				});
+
+			for (const shared_ptr<EntityJsonWriter>& shard : shards)
+			{
+				const char* data = shard->m_buffer.GetString();
+				size_t begin = 0;
+				for (size_t end : shard->m_entity_end)
+				{
+					writer.RawValue(data + begin, end - begin, rapidjson::kObjectType);
+					begin = end;
+				}
+			}
+			status->progressValueCallback(double(batch_end) / double(num_shards), "write");
+		}
+
+		writer.EndArray();
+		writer.EndObject();
+		os.Flush();
+	}
+}
+
+void WriterJSON::writeModelToFile( const std::string& filePath, shared_ptr<BuildingModel> model )
+{
+#ifdef _MSC_VER
+	FILE* file = _wfopen(string2wstring(filePath).c_str(), L"wb");
+#else
+	FILE* file = fopen(filePath.c_str(), "wb");
+#endif
+	if( !file )
+	{
+		std::stringstream strs;
+		strs << "Could not open file: " << filePath.c_str();
+		messageCallback(strs.str().c_str(), StatusCallback::MESSAGE_TYPE_ERROR, __FUNC__);
+		return;
+	}
+
+	std::vector<char> buffer(1 << 16);
+	rapidjson::FileWriteStream os(file, buffer.data(), buffer.size());
+	writeModelJSON(os, model, m_writeNumberPrecision, this);
+	fclose(file);
+}
+
+void WriterJSON::writeModelToStream( std::ostream& stream, shared_ptr<BuildingModel> model )
+{
+	rapidjson::OStreamWrapper os(stream);
+	writeModelJSON(os, model, m_writeNumberPrecision, this);
+}
@@ -0,0 +1,38 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <ostream>
+#include <string>
+#include "ifcpp/model/BuildingModel.h"
+#include "ifcpp/model/StatusCallback.h"
+
+///@brief Writes a model as ifcJSON
+///@details Each entity is one object in the "data" array, with "type", "id" and its attributes in lowerCamelCase, as given by getAttributes.
+///References are written as {"type": "IfcOwnerHistory", "ref": "i5"}, values of select types as {"type": "IFCLABEL", "value": "text"}.
+///The entities are written in parallel in shards of ascending ids, which are appended to the output in order, so the whole file is never held in memory.
+class IFCQUERY_EXPORT WriterJSON : public StatusCallback
+{
+public:
+	WriterJSON() = default;
+	~WriterJSON() = default;
+	void writeModelToFile( const std::string& filePath, shared_ptr<BuildingModel> model );
+	void writeModelToStream( std::ostream& stream, shared_ptr<BuildingModel> model );
+
+	size_t m_writeNumberPrecision = 15;
+};
@@ -0,0 +1,167 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+// Converts the primitive solids in data/advanced_brep_primitives.ifc, which are given as IfcAdvancedBrep over analytic
+// surfaces, and checks that each result is closed and that its volume matches the analytic volume.
+// Cylinder: planes and a cylindrical surface with a seam edge. Sphere: two hemispheres bounded by the equator.
+// Cone: IfcSurfaceOfRevolution of a line, closed through the apex. Torus: toroidal surface bounded by a vertex loop.
+// CylinderWithVoid: IfcAdvancedBrepWithVoids with a spherical void, which remains as inner mesh of the result.
+// The inscribed polygons of the tessellation make each volume slightly smaller than the analytic one.
+
+#include <cmath>
+#include <iostream>
+#include <map>
+#include <string>
+
+#include <ifcpp/model/BuildingModel.h>
+#include <ifcpp/reader/ReaderSTEP.h>
+#include <ifcpp/geometry/GeometryConverter.h>
+
+static int num_errors = 0;
+
+static void check( bool condition, const std::string& message )
+{
+	if( !condition )
+	{
+		std::cout << "FAILED: " << message << std::endl;
+		++num_errors;
+	}
+}
+
+struct ShapeResult
+{
+	double volume = 0;
+	size_t num_meshes = 0;
+	size_t num_open_meshes = 0;
+};
+
+// enclosed volume, independent of the orientation and of the cached volume of the mesh
+static double computeMeshVolume( carve::mesh::Mesh<3>* mesh )
+{
+	double volume = 0;
+	for( carve::mesh::Face<3>* face : mesh->faces )
+	{
+		carve::mesh::Edge<3>* first = face->edge;
+		for( carve::mesh::Edge<3>* edge = first->next; edge->next != first; edge = edge->next )
+		{
+			volume += carve::geom3d::tetrahedronVolume( first->vert->v, edge->vert->v, edge->next->vert->v, carve::geom::VECTOR( 0, 0, 0 ) );
+		}
+	}
+	return std::abs( volume );
+}
+
+static void addItemResult( const shared_ptr<ItemShapeData>& item, ShapeResult& result )
+{
+	for( const shared_ptr<carve::mesh::MeshSet<3> >& meshset : item->m_meshsets )
+	{
+		for( carve::mesh::Mesh<3>* mesh : meshset->meshes )
+		{
+			++result.num_meshes;
+			if( !mesh->isClosed() )
+			{
+				++result.num_open_meshes;
+			}
+			result.volume += mesh->is_inner_mesh ? -computeMeshVolume( mesh ) : computeMeshVolume( mesh );
+		}
+	}
+	for( const shared_ptr<carve::mesh::MeshSet<3> >& meshset : item->m_meshsets_open )
+	{
+		result.num_meshes += meshset->meshes.size();
+		result.num_open_meshes += meshset->meshes.size();
+	}
+	for( const shared_ptr<ItemShapeData>& child_item : item->m_child_items )
+	{
+		addItemResult( child_item, result );
+	}
+}
+
+static ShapeResult getShapeResult( const shared_ptr<ProductShapeData>& product_shape )
+{
+	ShapeResult result;
+	for( const shared_ptr<ItemShapeData>& item : product_shape->getGeometricItems() )
+	{
+		addItemResult( item, result );
+	}
+	return result;
+}
+
+int main( int argc, char* argv[] )
+{
+	if( argc < 2 )
+	{
+		std::cout << "usage: AdvancedBrepTest advanced_brep_primitives.ifc" << std::endl;
+		return 1;
+	}
+
+	shared_ptr<BuildingModel> model( new BuildingModel() );
+	shared_ptr<ReaderSTEP> reader( new ReaderSTEP() );
+	reader->loadModelFromFile( argv[1], model );
+
+	shared_ptr<GeometrySettings> geom_settings( new GeometrySettings() );
+	shared_ptr<GeometryConverter> geometry_converter( new GeometryConverter( model, geom_settings ) );
+	geom_settings->setNumVerticesPerCircle( 64 );
+	geometry_converter->convertGeometry();
+
+	const std::map<std::string, double> analytic_volumes = {
+		{ "Cylinder", 2.0 * M_PI },
+		{ "Sphere", 4.0 / 3.0 * M_PI },
+		{ "Cone", 2.0 / 3.0 * M_PI },
+		{ "Torus", 2.0 * M_PI * M_PI * 2.0 * 0.5 * 0.5 },
+		{ "CylinderWithVoid", 2.0 * M_PI - 4.0 / 3.0 * M_PI * 0.125 }
+	};
+
+	std::map<std::string, shared_ptr<ProductShapeData> > map_shapes;
+	for( auto& it : geometry_converter->getShapeInputData() )
+	{
+		shared_ptr<ProductShapeData>& product_shape = it.second;
+		if( !product_shape || product_shape->m_ifc_object_definition.expired() )
+		{
+			continue;
+		}
+		shared_ptr<IfcObjectDefinition> object_def( product_shape->m_ifc_object_definition );
+		if( object_def->m_Name )
+		{
+			map_shapes[object_def->m_Name->m_value] = product_shape;
+		}
+	}
+
+	for( auto& it : analytic_volumes )
+	{
+		const std::string& name = it.first;
+		auto it_shape = map_shapes.find( name );
+		check( it_shape != map_shapes.end(), name + ": no geometry" );
+		if( it_shape == map_shapes.end() )
+		{
+			continue;
+		}
+
+		ShapeResult result = getShapeResult( it_shape->second );
+		check( result.num_meshes > 0, name + ": no meshes" );
+		check( result.num_open_meshes == 0, name + ": " + std::to_string( result.num_open_meshes ) + " of " + std::to_string( result.num_meshes ) + " meshes are open" );
+
+		const double deviation = ( result.volume - it.second ) / it.second;
+		check( std::abs( deviation ) < 0.01, name + ": volume " + std::to_string( result.volume ) + ", analytic " + std::to_string( it.second ) );
+		std::cout << name << ": volume " << result.volume << ", analytic " << it.second << ", deviation " << deviation * 100.0 << "%" << std::endl;
+	}
+
+	if( num_errors > 0 )
+	{
+		std::cout << num_errors << " checks failed" << std::endl;
+		return 1;
+	}
+	return 0;
+}
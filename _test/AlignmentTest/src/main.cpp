@@ -0,0 +1,155 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+// Evaluates the alignment in data/alignment_reference.ifc and compares it with reference values to 0.1 mm.
+// Horizontal: line 100 m, clothoid 120 m from R=inf to R=300 m (A = sqrt(300*120)), circle R=300 m 150 m,
+// sine spiral 80 m with curvature 1/300 + sin(2*pi*s/80)/400.
+// Vertical: +2% from height 10 m, parabola from +2% to -1% between 150 m and 270 m, -1% to the end.
+// Cant: 0 until 100 m, parabola to 0.12 m at 220 m, then constant.
+// The reference points were integrated independently from the curvature of each segment with Simpson's rule
+// (40000 intervals per segment), heights are closed form. The segment placements in the file come from the same integration.
+
+#include <cmath>
+#include <iostream>
+#include <string>
+
+#include <ifcpp/model/BuildingModel.h>
+#include <ifcpp/model/UnitConverter.h>
+#include <ifcpp/reader/ReaderSTEP.h>
+#include <ifcpp/geometry/AlignmentConverter.h>
+#include <IfcGradientCurve.h>
+#include <IfcSegmentedReferenceCurve.h>
+
+static int num_errors = 0;
+
+static void check( bool condition, const std::string& message )
+{
+	if( !condition )
+	{
+		std::cout << "FAILED: " << message << std::endl;
+		++num_errors;
+	}
+}
+
+struct ReferencePoint
+{
+	double distance;
+	double x;
+	double y;
+	double height;			// IfcGradientCurve
+	double height_cant;		// IfcSegmentedReferenceCurve: gradient plus cant
+};
+
+static const ReferencePoint reference_points[] = {
+	{ 0.0, 0.000000000, 0.000000000, 10.000000000, 10.000000000 },
+	{ 50.0, 50.000000000, 0.000000000, 11.000000000, 11.000000000 },
+	{ 100.0, 100.000000000, 0.000000000, 12.000000000, 12.000000000 },
+	{ 130.0, 129.999531253, 0.124998605, 12.600000000, 12.607500000 },
+	{ 160.0, 159.985001736, 0.999821443, 13.187500000, 13.217500000 },
+	{ 220.0, 219.520888069, 7.977171928, 13.787500000, 13.907500000 },
+	{ 260.0, 258.078497869, 18.510061386, 13.687500000, 13.807500000 },
+	{ 300.0, 294.893652997, 34.075259321, 13.300000000, 13.420000000 },
+	{ 370.0, 353.185395002, 72.544489095, 12.600000000, 12.720000000 },
+	{ 400.0, 374.652097544, 93.455088618, 12.300000000, 12.420000000 },
+	{ 420.0, 387.178466154, 109.041583660, 12.100000000, 12.220000000 },
+	{ 450.0, 404.896429824, 133.247962727, 11.800000000, 11.920000000 }
+};
+
+static void checkCurve( const shared_ptr<AlignmentCurve>& curve, const std::string& name, bool with_height, bool with_cant )
+{
+	check( curve != nullptr, name + ": not evaluated as alignment" );
+	if( !curve )
+	{
+		return;
+	}
+	check( std::abs( curve->getLength() - 450.0 ) < 1e-4, name + ": length " + std::to_string( curve->getLength() ) );
+
+	const double tolerance = 1e-4;
+	for( const ReferencePoint& reference : reference_points )
+	{
+		AlignmentCurve::Frame frame;
+		curve->getFrame( reference.distance, frame );
+		const double height = with_cant ? reference.height_cant : ( with_height ? reference.height : 0.0 );
+		const double deviation = ( frame.m_point - carve::geom::VECTOR( reference.x, reference.y, height ) ).length();
+		check( deviation < tolerance, name + " at " + std::to_string( reference.distance ) + ": deviation " + std::to_string( deviation ) );
+	}
+}
+
+int main( int argc, char* argv[] )
+{
+	if( argc < 2 )
+	{
+		std::cout << "usage: AlignmentTest alignment_reference.ifc" << std::endl;
+		return 1;
+	}
+
+	shared_ptr<BuildingModel> model( new BuildingModel() );
+	shared_ptr<ReaderSTEP> reader( new ReaderSTEP() );
+	reader->loadModelFromFile( argv[1], model );
+
+	shared_ptr<IfcSegmentedReferenceCurve> reference_curve;
+	for( auto& it : model->getMapIfcEntities() )
+	{
+		if( dynamic_pointer_cast<IfcSegmentedReferenceCurve>( it.second ) )
+		{
+			reference_curve = dynamic_pointer_cast<IfcSegmentedReferenceCurve>( it.second );
+		}
+	}
+	check( reference_curve != nullptr, "IfcSegmentedReferenceCurve not loaded" );
+	if( !reference_curve )
+	{
+		return 1;
+	}
+	shared_ptr<IfcGradientCurve> gradient_curve = dynamic_pointer_cast<IfcGradientCurve>( reference_curve->m_BaseCurve );
+	check( gradient_curve != nullptr, "IfcGradientCurve not loaded" );
+	if( !gradient_curve )
+	{
+		return 1;
+	}
+
+	shared_ptr<AlignmentConverter> alignment_converter( new AlignmentConverter( model->getUnitConverter() ) );
+	checkCurve( alignment_converter->getAlignmentCurve( gradient_curve->m_BaseCurve ), "horizontal", false, false );
+	checkCurve( alignment_converter->getAlignmentCurve( gradient_curve ), "gradient", true, false );
+	checkCurve( alignment_converter->getAlignmentCurve( reference_curve ), "cant", true, true );
+
+	// points and tangents at the horizontal and vertical segment joints. The cant changes its slope at 220 m, so only points are compared there
+	shared_ptr<AlignmentCurve> curve = alignment_converter->getAlignmentCurve( gradient_curve );
+	shared_ptr<AlignmentCurve> curve_cant = alignment_converter->getAlignmentCurve( reference_curve );
+	if( curve && curve_cant )
+	{
+		for( double joint : { 100.0, 150.0, 220.0, 270.0, 370.0 } )
+		{
+			AlignmentCurve::Frame before, after;
+			curve->getFrame( joint - 1e-7, before );
+			curve->getFrame( joint + 1e-7, after );
+			check( ( before.m_point - after.m_point ).length() < 1e-6, "point jump at " + std::to_string( joint ) );
+			check( ( before.m_tangent - after.m_tangent ).length() < 1e-6, "tangent jump at " + std::to_string( joint ) );
+
+			curve_cant->getFrame( joint - 1e-7, before );
+			curve_cant->getFrame( joint + 1e-7, after );
+			check( ( before.m_point - after.m_point ).length() < 1e-6, "point jump with cant at " + std::to_string( joint ) );
+		}
+	}
+
+	if( num_errors > 0 )
+	{
+		std::cout << num_errors << " checks failed" << std::endl;
+		return 1;
+	}
+	std::cout << "alignment matches the reference values" << std::endl;
+	return 0;
+}
@@ -0,0 +1,45 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <chrono>
+#include <fstream>
+#include <string>
+
+///@returns resident set size of the process in bytes, or 0 if it is not available
+inline size_t getResidentSetSize()
+{
+#if defined(__linux__)
+	std::ifstream status( "/proc/self/status" );
+	std::string line;
+	while( std::getline( status, line ) )
+	{
+		if( line.compare( 0, 6, "VmRSS:" ) == 0 )
+		{
+			return std::stoul( line.substr( 6 ) ) * 1024;
+		}
+	}
+#endif
+	return 0;
+}
+
+///@returns seconds since start
+inline double secondsSince( const std::chrono::steady_clock::time_point& start )
+{
+	return std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count();
+}
@@ -0,0 +1,84 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+// Time and memory for creating num_entities IfcWall entities with a GlobalId and inserting them into a model.
+// "single" creates each entity with make_shared, a GUID from createBase64Uuid and insertEntity, which is how entities are created one at a time.
+// "bulk" uses BulkEntityBuilder with blocks of block_size entities, from num_threads threads.
+// RSS is measured in a separate process for each mode:
+//   BulkEntityBenchmark 1000000 single
+//   BulkEntityBenchmark 1000000 bulk 4 10000
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <ifcpp/model/BuildingGuid.h>
+#include <ifcpp/model/BuildingModel.h>
+#include <ifcpp/model/BulkEntityBuilder.h>
+#include <IfcWall.h>
+
+#include "BenchmarkUtil.h"
+
+int main( int argc, char* argv[] )
+{
+	const size_t num_entities = argc > 1 ? std::stoul( argv[1] ) : 1000000;
+	const bool bulk = argc > 2 && std::string( argv[2] ) == "bulk";
+	const size_t num_threads = argc > 3 ? std::stoul( argv[3] ) : 4;
+	const size_t block_size = argc > 4 ? std::stoul( argv[4] ) : 10000;
+
+	const size_t rss_before = getResidentSetSize();
+	const auto start = std::chrono::steady_clock::now();
+	shared_ptr<BuildingModel> model( new BuildingModel() );
+	if( bulk )
+	{
+		BulkEntityBuilder builder( model );
+		std::vector<std::thread> threads;
+		for( size_t thread_index = 0; thread_index < num_threads; ++thread_index )
+		{
+			threads.emplace_back( [&, thread_index]()
+				{
+					std::vector<shared_ptr<IFC4X3::IfcWall> > walls;
+					for( size_t ii = thread_index * block_size; ii < num_entities; ii += num_threads * block_size )
+					{
+						builder.createEntities( std::min( block_size, num_entities - ii ), walls );
+					}
+				} );
+		}
+		for( std::thread& thread : threads )
+		{
+			thread.join();
+		}
+		builder.insertIntoModel();
+	}
+	else
+	{
+		for( size_t ii = 0; ii < num_entities; ++ii )
+		{
+			shared_ptr<IFC4X3::IfcWall> wall = std::make_shared<IFC4X3::IfcWall>();
+			wall->m_GlobalId = std::make_shared<IFC4X3::IfcGloballyUniqueId>( createBase64Uuid() );
+			model->insertEntity( wall );
+		}
+	}
+	const double seconds = secondsSince( start );
+	const size_t rss_after = getResidentSetSize();
+
+	std::cout << ( bulk ? "bulk, " + std::to_string( num_threads ) + " threads: " : "single: " ) << model->getMapIfcEntities().size() << " entities in " << seconds << " s, RSS +" << ( rss_after - rss_before ) / ( 1024 * 1024 ) << " MB" << std::endl;
+	return 0;
+}
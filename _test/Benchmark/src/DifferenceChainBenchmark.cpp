@@ -0,0 +1,143 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+// Conversion time of a wall with many cut-outs, given as nested differences ((A - B1) - B2) - ... - Bn.
+// Each configuration is run with the tools subtracted one after the other, and as one union of all tools (GeometrySettings::m_unionSubtractionOperands).
+// In the second model, every 50th tool is a half-space. The chains end at the half-spaces, which are clipped by planes.
+//   DifferenceChainBenchmark 200
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include <ifcpp/model/BuildingModel.h>
+#include <ifcpp/reader/ReaderSTEP.h>
+#include <ifcpp/geometry/GeometryConverter.h>
+
+#include "BenchmarkUtil.h"
+
+static void writeWallWithOpenings( const std::string& file_path, int num_openings, bool with_half_spaces )
+{
+	std::ofstream stream( file_path );
+	stream << "ISO-10303-21;\nHEADER;\nFILE_DESCRIPTION((''),'2;1');\nFILE_NAME('','',(''),(''),'','','');\nFILE_SCHEMA(('IFC4X3_ADD2'));\nENDSEC;\nDATA;\n";
+	stream << "#1=IFCSIUNIT(*,.LENGTHUNIT.,$,.METRE.);\n#2=IFCUNITASSIGNMENT((#1));\n";
+	stream << "#3=IFCCARTESIANPOINT((0.,0.,0.));\n#4=IFCAXIS2PLACEMENT3D(#3,$,$);\n";
+	stream << "#5=IFCGEOMETRICREPRESENTATIONCONTEXT($,'Model',3,1.E-05,#4,$);\n";
+	stream << "#6=IFCPROJECT('0YvctVUKr0kugbFTf53O9L',$,'Difference chain',$,$,$,$,(#5),#2);\n";
+	stream << "#7=IFCDIRECTION((0.,0.,1.));\n";
+
+	// wall of 0.2 m per opening, 0.3 m thick and 3 m high
+	const double wall_length = 0.2 * num_openings + 0.2;
+	stream << "#10=IFCCARTESIANPOINT((" << wall_length * 0.5 << ",0.));\n#11=IFCAXIS2PLACEMENT2D(#10,$);\n";
+	stream << "#12=IFCRECTANGLEPROFILEDEF(.AREA.,$,#11," << wall_length << ",0.3);\n";
+	stream << "#13=IFCEXTRUDEDAREASOLID(#12,$,#7,3.);\n";
+
+	int tag = 20;
+	int current_result = 13;
+	for( int ii = 0; ii < num_openings; ++ii )
+	{
+		int tool = 0;
+		if( with_half_spaces && ii % 50 == 49 )
+		{
+			// slightly inclined plane below the top of the wall
+			stream << "#" << tag << "=IFCCARTESIANPOINT((0.,0.," << 2.9 - 0.01 * ii / 50 << "));\n";
+			stream << "#" << tag + 1 << "=IFCDIRECTION((0.01,0.,1.));\n";
+			stream << "#" << tag + 2 << "=IFCAXIS2PLACEMENT3D(#" << tag << ",#" << tag + 1 << ",$);\n";
+			stream << "#" << tag + 3 << "=IFCPLANE(#" << tag + 2 << ");\n";
+			stream << "#" << tag + 4 << "=IFCHALFSPACESOLID(#" << tag + 3 << ",.F.);\n";
+			tool = tag + 4;
+			tag += 5;
+		}
+		else
+		{
+			// opening of 0.1 x 0.5 x 1.2 m through the wall
+			stream << "#" << tag << "=IFCCARTESIANPOINT((" << 0.2 + 0.2 * ii << ",0.," << 0.5 + 0.1 * ( ii % 5 ) << "));\n";
+			stream << "#" << tag + 1 << "=IFCAXIS2PLACEMENT3D(#" << tag << ",$,$);\n";
+			stream << "#" << tag + 2 << "=IFCRECTANGLEPROFILEDEF(.AREA.,$,$,0.1,0.5);\n";
+			stream << "#" << tag + 3 << "=IFCEXTRUDEDAREASOLID(#" << tag + 2 << ",#" << tag + 1 << ",#7,1.2);\n";
+			tool = tag + 3;
+			tag += 4;
+		}
+		stream << "#" << tag << "=IFCBOOLEANRESULT(.DIFFERENCE.,#" << current_result << ",#" << tool << ");\n";
+		current_result = tag++;
+	}
+
+	stream << "#" << tag << "=IFCSHAPEREPRESENTATION(#5,'Body','CSG',(#" << current_result << "));\n";
+	stream << "#" << tag + 1 << "=IFCPRODUCTDEFINITIONSHAPE($,$,(#" << tag << "));\n";
+	stream << "#" << tag + 2 << "=IFCLOCALPLACEMENT($,#4);\n";
+	stream << "#" << tag + 3 << "=IFCWALL('1cE9mZ2P59ZQLVHHW5X6Ne',$,'Wall',$,$,#" << tag + 2 << ",#" << tag + 1 << ",$,$);\n";
+	stream << "ENDSEC;\nEND-ISO-10303-21;\n";
+}
+
+static size_t countFaces( const shared_ptr<ItemShapeData>& item )
+{
+	size_t num_faces = 0;
+	for( const shared_ptr<carve::mesh::MeshSet<3> >& meshset : item->m_meshsets )
+	{
+		for( carve::mesh::Mesh<3>* mesh : meshset->meshes )
+		{
+			num_faces += mesh->faces.size();
+		}
+	}
+	for( const shared_ptr<ItemShapeData>& child_item : item->m_child_items )
+	{
+		num_faces += countFaces( child_item );
+	}
+	return num_faces;
+}
+
+static void runConversion( const std::string& file_path, bool union_tools, const std::string& label )
+{
+	shared_ptr<BuildingModel> model( new BuildingModel() );
+	shared_ptr<ReaderSTEP> reader( new ReaderSTEP() );
+	reader->loadModelFromFile( file_path, model );
+
+	shared_ptr<GeometrySettings> geom_settings( new GeometrySettings() );
+	geom_settings->m_unionSubtractionOperands = union_tools;
+	shared_ptr<GeometryConverter> geometry_converter( new GeometryConverter( model, geom_settings ) );
+
+	const auto start = std::chrono::steady_clock::now();
+	geometry_converter->convertGeometry();
+	const double seconds = secondsSince( start );
+
+	size_t num_faces = 0;
+	for( auto& it : geometry_converter->getShapeInputData() )
+	{
+		for( const shared_ptr<ItemShapeData>& item : it.second->getGeometricItems() )
+		{
+			num_faces += countFaces( item );
+		}
+	}
+	std::cout << label << ( union_tools ? ", union of tools: " : ", one after the other: " ) << seconds << " s, " << num_faces << " faces" << std::endl;
+}
+
+int main( int argc, char* argv[] )
+{
+	const int num_openings = argc > 1 ? std::stoi( argv[1] ) : 200;
+
+	for( bool with_half_spaces : { false, true } )
+	{
+		const std::string file_path = ( std::filesystem::temp_directory_path() / ( "DifferenceChainBenchmark_" + std::to_string( num_openings ) + ( with_half_spaces ? "_half_spaces" : "" ) + ".ifc" ) ).string();
+		writeWallWithOpenings( file_path, num_openings, with_half_spaces );
+		const std::string label = std::to_string( num_openings ) + ( with_half_spaces ? " tools with half-spaces" : " tools" );
+		runConversion( file_path, false, label );
+		runConversion( file_path, true, label );
+	}
+	return 0;
+}
@@ -0,0 +1,109 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+// Stitching of a sheet of 2 x num_cells x num_cells triangles into meshes by FaceStitcher, with the triangles in grid order and shuffled.
+// The time of Mesh::create is measured on faces that are already built, and the time of the MeshSet constructor from point and index
+// lists, which also builds the vertices and faces. 708 cells give 1002528 triangles.
+//   FaceStitchBenchmark 708
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <carve/carve.hpp>
+#include <carve/mesh.hpp>
+
+#include "BenchmarkUtil.h"
+
+typedef carve::mesh::MeshSet<3> meshset_t;
+typedef carve::mesh::Mesh<3> mesh_t;
+typedef carve::mesh::Face<3> face_t;
+typedef carve::mesh::Vertex<3> vertex_t;
+
+static void runStitching( const std::vector<carve::geom::vector<3> >& points, const std::vector<int>& face_indices, size_t num_triangles, const std::string& label )
+{
+	const double epsilon = 1e-9;
+
+	// faces on vertices of their own, so that only the stitching is measured
+	std::vector<vertex_t> vertices( points.begin(), points.end() );
+	std::vector<face_t*> faces;
+	faces.reserve( num_triangles );
+	for( size_t ii = 0; ii < num_triangles; ++ii )
+	{
+		faces.push_back( new face_t( &vertices[face_indices[4 * ii + 1]], &vertices[face_indices[4 * ii + 2]], &vertices[face_indices[4 * ii + 3]], epsilon ) );
+	}
+	std::vector<mesh_t*> meshes;
+	auto start = std::chrono::steady_clock::now();
+	mesh_t::create( faces.begin(), faces.end(), meshes, carve::mesh::MeshOptions() );
+	const double seconds_create = secondsSince( start );
+	const size_t num_meshes = meshes.size();
+	for( mesh_t* mesh : meshes )
+	{
+		delete mesh;
+	}
+
+	start = std::chrono::steady_clock::now();
+	meshset_t meshset( points, num_triangles, face_indices, epsilon );
+	const double seconds_meshset = secondsSince( start );
+
+	std::cout << label << ": Mesh::create " << seconds_create << " s, MeshSet " << seconds_meshset << " s, " << num_meshes << " mesh(es), "
+		<< getResidentSetSize() / ( 1024 * 1024 ) << " MB resident" << std::endl;
+}
+
+int main( int argc, char* argv[] )
+{
+	const int num_cells = argc > 1 ? std::stoi( argv[1] ) : 708;
+
+	std::vector<carve::geom::vector<3> > points;
+	for( int ii = 0; ii <= num_cells; ++ii )
+	{
+		for( int jj = 0; jj <= num_cells; ++jj )
+		{
+			points.push_back( carve::geom::VECTOR( ii, jj, 0.0 ) );
+		}
+	}
+
+	std::vector<int> face_indices;
+	for( int ii = 0; ii < num_cells; ++ii )
+	{
+		for( int jj = 0; jj < num_cells; ++jj )
+		{
+			const int v0 = ii * ( num_cells + 1 ) + jj;
+			const int v1 = v0 + num_cells + 1;
+			face_indices.insert( face_indices.end(), { 3, v0, v1, v1 + 1, 3, v0, v1 + 1, v0 + 1 } );
+		}
+	}
+	const size_t num_triangles = face_indices.size() / 4;
+	runStitching( points, face_indices, num_triangles, std::to_string( num_triangles ) + " triangles in grid order" );
+
+	std::vector<size_t> order( num_triangles );
+	for( size_t ii = 0; ii < num_triangles; ++ii )
+	{
+		order[ii] = ii;
+	}
+	std::shuffle( order.begin(), order.end(), std::mt19937( 1234567 ) );
+	std::vector<int> shuffled_indices;
+	shuffled_indices.reserve( face_indices.size() );
+	for( size_t triangle : order )
+	{
+		shuffled_indices.insert( shuffled_indices.end(), face_indices.begin() + 4 * triangle, face_indices.begin() + 4 * triangle + 4 );
+	}
+	runStitching( points, shuffled_indices, num_triangles, std::to_string( num_triangles ) + " triangles shuffled" );
+	return 0;
+}
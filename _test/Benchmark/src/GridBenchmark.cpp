@@ -0,0 +1,179 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+// Placement of num_axes x num_axes proxies on a straight grid and on a curved grid of quarter circles and radial lines, each proxy on its own
+// intersection with an offset. The placements are computed on num_threads threads, first with an empty grid cache, then from the cache.
+//   GridBenchmark 300 4
+
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#include <ifcpp/model/BuildingGuid.h>
+#include <ifcpp/model/BuildingModel.h>
+#include <ifcpp/reader/ReaderSTEP.h>
+#include <ifcpp/geometry/GeometryConverter.h>
+
+#include "BenchmarkUtil.h"
+
+static void writeGridModel( const std::string& file_path, int num_axes )
+{
+	std::ofstream stream( file_path );
+	stream << "ISO-10303-21;\nHEADER;\nFILE_DESCRIPTION((''),'2;1');\nFILE_NAME('','',(''),(''),'','','');\nFILE_SCHEMA(('IFC4X3_ADD2'));\nENDSEC;\nDATA;\n";
+	stream << "#1=IFCSIUNIT(*,.LENGTHUNIT.,$,.METRE.);\n#2=IFCSIUNIT(*,.PLANEANGLEUNIT.,$,.RADIAN.);\n#3=IFCUNITASSIGNMENT((#1,#2));\n";
+	stream << "#4=IFCPROJECT('" << createBase64Uuid() << "',$,'Project',$,$,$,$,$,#3);\n";
+	stream << "#5=IFCCARTESIANPOINT((0.,0.,0.));\n#6=IFCAXIS2PLACEMENT3D(#5,$,$);\n#7=IFCLOCALPLACEMENT($,#6);\n";
+	stream << "#8=IFCCARTESIANPOINT((0.,0.));\n#9=IFCAXIS2PLACEMENT2D(#8,$);\n";
+
+	int tag = 10;
+	const double length = 10.0 * num_axes;
+	auto writeLineAxis = [&]( double x0, double y0, double x1, double y1 )
+	{
+		const int first = tag;
+		stream << "#" << tag++ << "=IFCCARTESIANPOINT((" << x0 << "," << y0 << "));\n";
+		stream << "#" << tag++ << "=IFCCARTESIANPOINT((" << x1 << "," << y1 << "));\n";
+		stream << "#" << tag++ << "=IFCPOLYLINE((#" << first << ",#" << first + 1 << "));\n";
+		stream << "#" << tag << "=IFCGRIDAXIS('',#" << tag - 1 << ",.T.);\n";
+		return tag++;
+	};
+	auto writeArcAxis = [&]( double radius )
+	{
+		stream << "#" << tag++ << "=IFCCIRCLE(#9," << radius << ");\n";
+		stream << "#" << tag++ << "=IFCTRIMMEDCURVE(#" << tag - 2 << ",(IFCPARAMETERVALUE(0.)),(IFCPARAMETERVALUE(1.5707963267948966)),.T.,.PARAMETER.);\n";
+		stream << "#" << tag << "=IFCGRIDAXIS('',#" << tag - 1 << ",.T.);\n";
+		return tag++;
+	};
+	auto writeAxisList = []( const std::vector<int>& axes )
+	{
+		std::string list;
+		for( int axis : axes )
+		{
+			list += ( list.empty() ? "#" : ",#" ) + std::to_string( axis );
+		}
+		return list;
+	};
+	auto writeProxies = [&]( const std::vector<int>& u_axes, const std::vector<int>& v_axes )
+	{
+		for( int u_axis : u_axes )
+		{
+			for( int v_axis : v_axes )
+			{
+				stream << "#" << tag++ << "=IFCVIRTUALGRIDINTERSECTION((#" << u_axis << ",#" << v_axis << "),(0.5,0.25));\n";
+				stream << "#" << tag++ << "=IFCGRIDPLACEMENT($,#" << tag - 2 << ",$);\n";
+				stream << "#" << tag++ << "=IFCBUILDINGELEMENTPROXY('" << createBase64Uuid() << "',$,'Proxy',$,$,#" << tag - 2 << ",$,$,$);\n";
+			}
+		}
+	};
+
+	std::vector<int> u_axes, v_axes;
+	for( int ii = 0; ii < num_axes; ++ii )
+	{
+		u_axes.push_back( writeLineAxis( 10.0 * ii, 0.0, 10.0 * ii, length ) );
+		v_axes.push_back( writeLineAxis( 0.0, 10.0 * ii, length, 10.0 * ii ) );
+	}
+	stream << "#" << tag++ << "=IFCGRID('" << createBase64Uuid() << "',$,'Straight',$,$,#7,$,(" << writeAxisList( u_axes ) << "),(" << writeAxisList( v_axes ) << "),$,$);\n";
+	writeProxies( u_axes, v_axes );
+
+	std::vector<int> arc_axes, radial_axes;
+	for( int ii = 0; ii < num_axes; ++ii )
+	{
+		const double angle = 0.5 * M_PI * ( ii + 0.5 ) / num_axes;
+		arc_axes.push_back( writeArcAxis( 10.0 * ( ii + 1 ) ) );
+		radial_axes.push_back( writeLineAxis( 0.0, 0.0, ( length + 10.0 ) * std::cos( angle ), ( length + 10.0 ) * std::sin( angle ) ) );
+	}
+	stream << "#" << tag++ << "=IFCGRID('" << createBase64Uuid() << "',$,'Curved',$,$,#7,$,(" << writeAxisList( arc_axes ) << "),(" << writeAxisList( radial_axes ) << "),$,$);\n";
+	writeProxies( arc_axes, radial_axes );
+	stream << "ENDSEC;\nEND-ISO-10303-21;\n";
+}
+
+static double placeProducts( const shared_ptr<PlacementConverter>& placement_converter, const std::vector<shared_ptr<IfcProduct> >& products, int num_threads, double& checksum )
+{
+	std::vector<double> thread_sums( num_threads, 0.0 );
+	std::vector<std::thread> threads;
+	const auto start = std::chrono::steady_clock::now();
+	for( int thread_index = 0; thread_index < num_threads; ++thread_index )
+	{
+		threads.emplace_back( [&, thread_index]()
+			{
+				for( size_t ii = thread_index; ii < products.size(); ii += num_threads )
+				{
+					shared_ptr<ProductShapeData> product_data( new ProductShapeData() );
+					std::unordered_set<IfcObjectPlacement*> placement_already_applied;
+					placement_converter->convertIfcObjectPlacement( products[ii]->m_ObjectPlacement, product_data, placement_already_applied, false );
+					const vec3 position = product_data->getTransform() * carve::geom::VECTOR( 0.0, 0.0, 0.0 );
+					thread_sums[thread_index] += position.x + position.y;
+				}
+			} );
+	}
+	for( std::thread& thread : threads )
+	{
+		thread.join();
+	}
+	const double seconds = secondsSince( start );
+	checksum = 0;
+	for( double sum : thread_sums )
+	{
+		checksum += sum;
+	}
+	return seconds;
+}
+
+int main( int argc, char* argv[] )
+{
+	const int num_axes = argc > 1 ? std::stoi( argv[1] ) : 300;
+	const int num_threads = argc > 2 ? std::stoi( argv[2] ) : 4;
+
+	const std::string file_path = ( std::filesystem::temp_directory_path() / ( "GridBenchmark_" + std::to_string( num_axes ) + ".ifc" ) ).string();
+	if( !std::filesystem::exists( file_path ) )
+	{
+		writeGridModel( file_path, num_axes );
+	}
+
+	shared_ptr<BuildingModel> model( new BuildingModel() );
+	shared_ptr<ReaderSTEP> reader( new ReaderSTEP() );
+	auto start = std::chrono::steady_clock::now();
+	reader->loadModelFromFile( file_path, model );
+	const double read_seconds = secondsSince( start );
+
+	std::vector<shared_ptr<IfcProduct> > products;
+	for( auto& it : model->getMapIfcEntities() )
+	{
+		shared_ptr<IfcProduct> product = dynamic_pointer_cast<IfcProduct>( it.second );
+		if( product && dynamic_pointer_cast<IfcGridPlacement>( product->m_ObjectPlacement ) )
+		{
+			products.push_back( product );
+		}
+	}
+
+	shared_ptr<GeometrySettings> geom_settings( new GeometrySettings() );
+	shared_ptr<RepresentationConverter> representation_converter( new RepresentationConverter( geom_settings, model->getUnitConverter() ) );
+	shared_ptr<PlacementConverter> placement_converter = representation_converter->getPlacementConverter();
+
+	double checksum_first = 0, checksum_cached = 0;
+	const double first_seconds = placeProducts( placement_converter, products, num_threads, checksum_first );
+	const double cached_seconds = placeProducts( placement_converter, products, num_threads, checksum_cached );
+
+	std::cout << products.size() << " grid placements on " << num_threads << " threads, read in " << read_seconds << " s, first pass " << first_seconds
+		<< " s, cached " << cached_seconds << " s, checksum " << checksum_first << ( checksum_first == checksum_cached ? "" : " differs from the cached one" ) << std::endl;
+	return 0;
+}
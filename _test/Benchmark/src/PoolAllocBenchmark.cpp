@@ -0,0 +1,130 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+// Allocation and freeing of small objects with the Carve pool (carve::PoolAllocated) and with operator new, the way mesh edges are used.
+// "local": each thread allocates batches of objects and frees them again.
+// "cross-thread": worker threads allocate, the main thread frees, as in the geometry conversion.
+// Times are per allocation and free, for 1, 2, 4 ... max_threads threads:
+//   PoolAllocBenchmark 8 2000000
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <carve/pool_alloc.hpp>
+
+#include "BenchmarkUtil.h"
+
+// the size of a mesh edge
+struct PlainObject
+{
+	void* pointers[6];
+	double value;
+};
+
+struct PooledObject : public carve::PoolAllocated
+{
+	void* pointers[6];
+	double value;
+};
+
+const size_t BATCH_SIZE = 1000;
+
+template<typename T>
+static void allocateAndFree( size_t num_objects )
+{
+	std::vector<T*> objects( BATCH_SIZE );
+	for( size_t done = 0; done < num_objects; done += BATCH_SIZE )
+	{
+		for( T*& object : objects )
+		{
+			object = new T();
+		}
+		for( T* object : objects )
+		{
+			delete object;
+		}
+	}
+}
+
+template<typename T>
+static double runLocal( int num_threads, size_t num_objects_per_thread )
+{
+	const auto start = std::chrono::steady_clock::now();
+	std::vector<std::thread> threads;
+	for( int ii = 0; ii < num_threads; ++ii )
+	{
+		threads.emplace_back( [num_objects_per_thread]() { allocateAndFree<T>( num_objects_per_thread ); } );
+	}
+	for( std::thread& thread : threads )
+	{
+		thread.join();
+	}
+	return secondsSince( start ) * 1e9 / double( num_threads * num_objects_per_thread );
+}
+
+template<typename T>
+static double runCrossThread( int num_threads, size_t num_objects_per_thread )
+{
+	const auto start = std::chrono::steady_clock::now();
+	std::vector<std::vector<T*> > objects_per_thread( num_threads );
+	std::vector<std::thread> threads;
+	for( int ii = 0; ii < num_threads; ++ii )
+	{
+		threads.emplace_back( [&objects_per_thread, ii, num_objects_per_thread]()
+		{
+			objects_per_thread[ii].reserve( num_objects_per_thread );
+			for( size_t jj = 0; jj < num_objects_per_thread; ++jj )
+			{
+				objects_per_thread[ii].push_back( new T() );
+			}
+		} );
+	}
+	for( std::thread& thread : threads )
+	{
+		thread.join();
+	}
+	for( std::vector<T*>& objects : objects_per_thread )
+	{
+		for( T* object : objects )
+		{
+			delete object;
+		}
+	}
+	return secondsSince( start ) * 1e9 / double( num_threads * num_objects_per_thread );
+}
+
+int main( int argc, char* argv[] )
+{
+	const int max_threads = argc > 1 ? std::stoi( argv[1] ) : 8;
+	const size_t num_objects = argc > 2 ? std::stoul( argv[2] ) : 2000000;
+
+	std::cout << "object size " << sizeof( PooledObject ) << " bytes, " << num_objects << " objects per thread, hardware threads: " << std::thread::hardware_concurrency() << std::endl;
+	for( int num_threads = 1; num_threads <= max_threads; num_threads *= 2 )
+	{
+		std::cout << num_threads << " threads, ns per object:"
+			<< " local: pool " << runLocal<PooledObject>( num_threads, num_objects ) << ", new " << runLocal<PlainObject>( num_threads, num_objects )
+			<< "; cross-thread: pool " << runCrossThread<PooledObject>( num_threads, num_objects ) << ", new " << runCrossThread<PlainObject>( num_threads, num_objects ) << std::endl;
+	}
+
+	carve::poolRelease();
+	const carve::PoolStatistics stats = carve::poolStatistics();
+	std::cout << "after release: " << stats.num_chunks << " chunks, " << stats.num_blocks_in_use << " blocks in use" << std::endl;
+	return 0;
+}
@@ -0,0 +1,168 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+// Geometry conversion of a model with num_elements proxies without representation in 10 storeys, and an assembly chain of 20000 levels.
+// convertGeometry is timed as a whole, then the project structure is reset and GeometryConverter::resolveProjectStructure is timed alone.
+//   ProjectStructureBenchmark 1000000
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include <ifcpp/model/BuildingGuid.h>
+#include <ifcpp/model/BuildingModel.h>
+#include <ifcpp/reader/ReaderSTEP.h>
+#include <ifcpp/geometry/GeometryConverter.h>
+
+#include "BenchmarkUtil.h"
+
+static void writeStructureModel( const std::string& file_path, int num_elements )
+{
+	const int num_storeys = 10;
+	const int chain_length = 20000;
+
+	std::ofstream stream( file_path );
+	stream << "ISO-10303-21;\nHEADER;\nFILE_DESCRIPTION((''),'2;1');\nFILE_NAME('','',(''),(''),'','','');\nFILE_SCHEMA(('IFC4X3_ADD2'));\nENDSEC;\nDATA;\n";
+	stream << "#1=IFCSIUNIT(*,.LENGTHUNIT.,$,.METRE.);\n#2=IFCUNITASSIGNMENT((#1));\n";
+	stream << "#3=IFCPROJECT('" << createBase64Uuid() << "',$,'Project',$,$,$,$,$,#2);\n";
+	stream << "#4=IFCSITE('" << createBase64Uuid() << "',$,'Site',$,$,$,$,$,.ELEMENT.,$,$,$,$,$);\n";
+	stream << "#5=IFCBUILDING('" << createBase64Uuid() << "',$,'Building',$,$,$,$,$,.ELEMENT.,$,$,$);\n";
+	stream << "#6=IFCRELAGGREGATES('" << createBase64Uuid() << "',$,$,$,#3,(#4));\n";
+	stream << "#7=IFCRELAGGREGATES('" << createBase64Uuid() << "',$,$,$,#4,(#5));\n";
+
+	int tag = 10;
+	std::string storeys;
+	const int first_storey = tag;
+	for( int ii = 0; ii < num_storeys; ++ii )
+	{
+		storeys += ( ii > 0 ? ",#" : "#" ) + std::to_string( tag );
+		stream << "#" << tag++ << "=IFCBUILDINGSTOREY('" << createBase64Uuid() << "',$,'Storey " << ii << "',$,$,$,$,$,.ELEMENT.,$);\n";
+	}
+	stream << "#" << tag++ << "=IFCRELAGGREGATES('" << createBase64Uuid() << "',$,$,$,#5,(" << storeys << "));\n";
+
+	const int num_per_storey = num_elements / num_storeys;
+	for( int ii = 0; ii < num_storeys; ++ii )
+	{
+		const int first_element = tag;
+		for( int jj = 0; jj < num_per_storey; ++jj )
+		{
+			stream << "#" << tag++ << "=IFCBUILDINGELEMENTPROXY('" << createBase64Uuid() << "',$,'Proxy',$,$,$,$,$,$);\n";
+		}
+		stream << "#" << tag++ << "=IFCRELCONTAINEDINSPATIALSTRUCTURE('" << createBase64Uuid() << "',$,$,$,(";
+		for( int jj = 0; jj < num_per_storey; ++jj )
+		{
+			stream << ( jj > 0 ? ",#" : "#" ) << first_element + jj;
+		}
+		stream << "),#" << first_storey + ii << ");\n";
+	}
+
+	int parent_assembly = tag++;
+	stream << "#" << parent_assembly << "=IFCELEMENTASSEMBLY('" << createBase64Uuid() << "',$,'Assembly',$,$,$,$,$,$,$);\n";
+	stream << "#" << tag++ << "=IFCRELCONTAINEDINSPATIALSTRUCTURE('" << createBase64Uuid() << "',$,$,$,(#" << parent_assembly << "),#" << first_storey << ");\n";
+	for( int ii = 0; ii < chain_length; ++ii )
+	{
+		const int assembly = tag++;
+		stream << "#" << assembly << "=IFCELEMENTASSEMBLY('" << createBase64Uuid() << "',$,'Assembly',$,$,$,$,$,$,$);\n";
+		stream << "#" << tag++ << "=IFCRELAGGREGATES('" << createBase64Uuid() << "',$,$,$,#" << parent_assembly << ",(#" << assembly << "));\n";
+		parent_assembly = assembly;
+	}
+	stream << "ENDSEC;\nEND-ISO-10303-21;\n";
+}
+
+// gives access to the resolved project structure, so that it can be reset and resolved again
+class StructureGeometryConverter : public GeometryConverter
+{
+public:
+	StructureGeometryConverter( shared_ptr<BuildingModel>& model, shared_ptr<GeometrySettings>& geom_settings ) : GeometryConverter( model, geom_settings )
+	{
+	}
+
+	shared_ptr<ProductShapeData> resetProjectStructure()
+	{
+		shared_ptr<ProductShapeData> project_data;
+		for( auto& it : m_product_shape_data )
+		{
+			shared_ptr<IfcObjectDefinition> object_def = it.second ? it.second->m_ifc_object_definition.lock() : nullptr;
+			if( !object_def )
+			{
+				continue;
+			}
+			// fresh product data without children and without geometry, which the structure does not need
+			it.second = make_shared<ProductShapeData>( it.second->m_entity_guid );
+			it.second->m_ifc_object_definition = object_def;
+			if( object_def->classID() == IFCPROJECT )
+			{
+				project_data = it.second;
+			}
+		}
+		m_setResolvedProjectStructure.clear();
+		return project_data;
+	}
+};
+
+static size_t countProducts( const shared_ptr<ProductShapeData>& product_data )
+{
+	size_t num_products = 1;
+	for( const shared_ptr<ProductShapeData>& child : product_data->getChildElements() )
+	{
+		num_products += countProducts( child );
+	}
+	return num_products;
+}
+
+int main( int argc, char* argv[] )
+{
+	const int num_elements = argc > 1 ? std::stoi( argv[1] ) : 1000000;
+
+	const std::string file_path = ( std::filesystem::temp_directory_path() / ( "ProjectStructureBenchmark_" + std::to_string( num_elements ) + ".ifc" ) ).string();
+	if( !std::filesystem::exists( file_path ) )
+	{
+		writeStructureModel( file_path, num_elements );
+	}
+
+	shared_ptr<BuildingModel> model( new BuildingModel() );
+	shared_ptr<ReaderSTEP> reader( new ReaderSTEP() );
+	auto start = std::chrono::steady_clock::now();
+	reader->loadModelFromFile( file_path, model );
+	const double read_seconds = secondsSince( start );
+
+	shared_ptr<GeometrySettings> geom_settings( new GeometrySettings() );
+	shared_ptr<StructureGeometryConverter> geometry_converter( new StructureGeometryConverter( model, geom_settings ) );
+	start = std::chrono::steady_clock::now();
+	geometry_converter->convertGeometry();
+	const double convert_seconds = secondsSince( start );
+
+	shared_ptr<ProductShapeData> project_data = geometry_converter->resetProjectStructure();
+	if( !project_data )
+	{
+		std::cout << "no project" << std::endl;
+		return 1;
+	}
+	start = std::chrono::steady_clock::now();
+	geometry_converter->resolveProjectStructure( project_data, false );
+	geometry_converter->resolveProjectStructure( project_data, true );
+	const double structure_seconds = secondsSince( start );
+
+	// the chain of assemblies is as deep as the counting recursion, which is fine for 20000 levels
+	const size_t num_in_structure = countProducts( project_data );
+
+	std::cout << model->getMapIfcEntities().size() << " entities, read in " << read_seconds << " s, convertGeometry " << convert_seconds << " s, "
+		<< "resolveProjectStructure " << structure_seconds << " s, " << num_in_structure << " products in the project structure" << std::endl;
+	return 0;
+}
@@ -0,0 +1,72 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+// Decodes num_strings STEP strings with decodeArgumentString, for three kinds of strings: plain names without escape sequences,
+// German and French names with \S\, \X\ and a short \X2\ run, and Chinese names in \X2\ runs. Prints the time and the throughput of each.
+//   StepStringBenchmark 2000000
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <ifcpp/reader/ReaderUtil.h>
+
+#include "BenchmarkUtil.h"
+
+static void runBenchmark( const std::string& name, const std::vector<std::string>& strings )
+{
+	size_t num_bytes = 0;
+	for( const std::string& str : strings )
+	{
+		num_bytes += str.size();
+	}
+
+	size_t num_decoded_bytes = 0;
+	std::string decoded;
+	const auto start = std::chrono::steady_clock::now();
+	for( const std::string& str : strings )
+	{
+		decodeArgumentString( str, decoded );
+		num_decoded_bytes += decoded.size();
+	}
+	const double seconds = secondsSince( start );
+	std::cout << name << ": " << strings.size() << " strings, " << num_bytes / 1000000.0 << " MB in " << seconds << " s, "
+		<< num_bytes / 1000000.0 / seconds << " MB/s, " << num_decoded_bytes << " bytes decoded" << std::endl;
+}
+
+int main( int argc, char* argv[] )
+{
+	const size_t num_strings = argc > 1 ? std::stoul( argv[1] ) : 2000000;
+
+	std::vector<std::string> plain, latin, chinese;
+	plain.reserve( num_strings );
+	latin.reserve( num_strings );
+	chinese.reserve( num_strings );
+	for( size_t ii = 0; ii < num_strings; ++ii )
+	{
+		const std::string number = std::to_string( ii );
+		plain.push_back( "'Basic Wall:Interior - 138mm Partition (1-hr):" + number + "'" );
+		latin.push_back( "'Heizk\\S\\vrper Stra\\X\\DFe " + number + " - pot\\X2\\00EA\\X0\\ncia \\X\\E9l\\X\\E9ment'" );
+		chinese.push_back( "'\\X2\\5899\\X0\\-" + number + "-\\X2\\5BA4518596D458C100200031003300386BEB7C73\\X0\\'" );
+	}
+
+	runBenchmark( "plain", plain );
+	runBenchmark( "\\S\\ and \\X\\", latin );
+	runBenchmark( "\\X2\\", chinese );
+	return 0;
+}
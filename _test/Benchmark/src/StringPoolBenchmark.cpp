@@ -0,0 +1,109 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+// Memory of a property-heavy model with and without the string pool of BuildingModel.
+// Writes a model with num_walls walls, each with a property set of repeated property names and values, and reads it.
+// RSS is measured in a separate process for each mode, since freed memory is not always given back to the system:
+//   StringPoolBenchmark 100000 off
+//   StringPoolBenchmark 100000 on
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <ifcpp/model/BuildingGuid.h>
+#include <ifcpp/model/BuildingModel.h>
+#include <ifcpp/model/StringPool.h>
+#include <ifcpp/reader/ReaderSTEP.h>
+
+#include "BenchmarkUtil.h"
+
+static void writePropertyModel( const std::string& file_path, int num_walls )
+{
+	const std::vector<std::pair<std::string, std::string> > properties = {
+		{ "IsExternal", "IFCBOOLEAN(.T.)" },
+		{ "LoadBearing", "IFCBOOLEAN(.F.)" },
+		{ "FireRating", "IFCLABEL('REI 90')" },
+		{ "Reference", "IFCIDENTIFIER('Basic Wall:Interior - 138mm Partition (1-hr)')" },
+		{ "AcousticRating", "IFCLABEL('Rw 52 dB')" },
+		{ "Status", "IFCLABEL('New')" },
+		{ "Manufacturer", "IFCLABEL('Generic concrete supplier')" },
+		{ "Description", "IFCTEXT('Reinforced concrete wall, cast in place, exposed surface class 2')" }
+	};
+
+	std::ofstream stream( file_path );
+	stream << "ISO-10303-21;\nHEADER;\nFILE_DESCRIPTION((''),'2;1');\nFILE_NAME('','',(''),(''),'','','');\nFILE_SCHEMA(('IFC4X3_ADD2'));\nENDSEC;\nDATA;\n";
+	stream << "#1=IFCSIUNIT(*,.LENGTHUNIT.,$,.METRE.);\n#2=IFCUNITASSIGNMENT((#1));\n";
+	stream << "#3=IFCPROJECT('0YvctVUKr0kugbFTf53O9L',$,'Property model',$,$,$,$,$,#2);\n";
+
+	int tag = 10;
+	for( int ii = 0; ii < num_walls; ++ii )
+	{
+		const int wall_tag = tag++;
+		stream << "#" << wall_tag << "=IFCWALL('" << createBase64Uuid() << "',$,'Basic Wall:Interior - 138mm Partition (1-hr)',$,'Basic Wall:Interior - 138mm Partition (1-hr):" << ( 100000 + ii ) << "',$,$,$,$);\n";
+		std::vector<int> property_tags;
+		for( const std::pair<std::string, std::string>& property : properties )
+		{
+			property_tags.push_back( tag );
+			stream << "#" << tag++ << "=IFCPROPERTYSINGLEVALUE('" << property.first << "',$," << property.second << ",$);\n";
+		}
+		const int set_tag = tag++;
+		stream << "#" << set_tag << "=IFCPROPERTYSET('" << createBase64Uuid() << "',$,'Pset_WallCommon',$,(";
+		for( size_t jj = 0; jj < property_tags.size(); ++jj )
+		{
+			stream << ( jj > 0 ? "," : "" ) << "#" << property_tags[jj];
+		}
+		stream << "));\n";
+		stream << "#" << tag++ << "=IFCRELDEFINESBYPROPERTIES('" << createBase64Uuid() << "',$,$,$,(#" << wall_tag << "),#" << set_tag << ");\n";
+	}
+	stream << "ENDSEC;\nEND-ISO-10303-21;\n";
+}
+
+int main( int argc, char* argv[] )
+{
+	const int num_walls = argc > 1 ? std::stoi( argv[1] ) : 100000;
+	const bool use_pool = argc > 2 && std::string( argv[2] ) == "on";
+
+	const std::string file_path = ( std::filesystem::temp_directory_path() / ( "StringPoolBenchmark_" + std::to_string( num_walls ) + ".ifc" ) ).string();
+	if( !std::filesystem::exists( file_path ) )
+	{
+		writePropertyModel( file_path, num_walls );
+	}
+
+	const size_t rss_before = getResidentSetSize();
+	const auto start = std::chrono::steady_clock::now();
+
+	shared_ptr<BuildingModel> model( new BuildingModel() );
+	model->setStringPoolEnabled( use_pool );
+	shared_ptr<ReaderSTEP> reader( new ReaderSTEP() );
+	reader->loadModelFromFile( file_path, model );
+
+	const double seconds = secondsSince( start );
+	const size_t rss_after = getResidentSetSize();
+
+	std::cout << "string pool " << ( use_pool ? "on" : "off" ) << ": " << model->getMapIfcEntities().size() << " entities, read in " << seconds << " s, RSS +"
+		<< ( rss_after - rss_before ) / ( 1024 * 1024 ) << " MB" << std::endl;
+	if( model->getStringPool() )
+	{
+		const shared_ptr<StringPool>& pool = model->getStringPool();
+		std::cout << "  " << pool->getNumDistinctValues() << " distinct values, " << pool->getNumSharedValues() << " of " << pool->getNumLookups() << " values shared" << std::endl;
+	}
+	return 0;
+}
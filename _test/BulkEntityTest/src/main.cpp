@@ -0,0 +1,197 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+// Creates entities with BulkEntityBuilder from several threads at once and checks that each entity has its own tag,
+// and that the GlobalIds are unique, valid version 4 GUIDs that survive a round trip through BinaryGuid.
+// Also checks that tags reserved by reserveEntityTags are not given out again by the other tag functions of BuildingModel
+// before the reserved entities are inserted.
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#include <ifcpp/model/BuildingGuid.h>
+#include <ifcpp/model/BuildingModel.h>
+#include <ifcpp/model/BulkEntityBuilder.h>
+#include <IfcWall.h>
+#include <IfcCartesianPoint.h>
+
+static int num_errors = 0;
+
+static void check( bool condition, const std::string& message )
+{
+	if( !condition )
+	{
+		std::cout << "FAILED: " << message << std::endl;
+		++num_errors;
+	}
+}
+
+static bool isValidGuid( const std::string& ifc_guid )
+{
+	BinaryGuid binary_guid;
+	if( ifc_guid.size() != 22 || !binary_guid.fromBase64( ifc_guid ) || binary_guid.toBase64() != ifc_guid )
+	{
+		return false;
+	}
+
+	// BinaryGuid holds the bits in the order of the uncompressed GUID xxxxxxxx-xxxx-Vxxx-Wxxx-xxxxxxxxxxxx: version V is 4, the top bits of W are 10
+	const uint64_t version = ( binary_guid.m_high >> 12 ) & 0xF;
+	const uint64_t variant = binary_guid.m_low >> 62;
+	return version == 4 && variant == 2;
+}
+
+static void checkBulkCreation( bool deterministic_guids )
+{
+	const size_t num_threads = 8;
+	const size_t num_blocks_per_thread = 20;
+	const size_t block_size = 500;
+	const std::string label = deterministic_guids ? "deterministic GUIDs: " : "random GUIDs: ";
+
+	shared_ptr<BuildingModel> model( new BuildingModel() );
+	BulkEntityBuilder builder( model );
+	if( deterministic_guids )
+	{
+		builder.setDeterministicGuids( 42 );
+	}
+
+	std::vector<std::vector<shared_ptr<IFC4X3::IfcWall> > > walls_per_thread( num_threads );
+	std::vector<std::vector<shared_ptr<IFC4X3::IfcCartesianPoint> > > points_per_thread( num_threads );
+	std::vector<std::thread> threads;
+	for( size_t thread_index = 0; thread_index < num_threads; ++thread_index )
+	{
+		threads.emplace_back( [&, thread_index]()
+			{
+				for( size_t ii = 0; ii < num_blocks_per_thread; ++ii )
+				{
+					builder.createEntities( block_size, walls_per_thread[thread_index] );
+					builder.createEntities( block_size / 2, points_per_thread[thread_index] );
+				}
+			} );
+	}
+	for( std::thread& thread : threads )
+	{
+		thread.join();
+	}
+	builder.insertIntoModel();
+
+	const size_t num_walls = num_threads * num_blocks_per_thread * block_size;
+	const size_t num_entities = num_walls + num_threads * num_blocks_per_thread * ( block_size / 2 );
+	check( model->getMapIfcEntities().size() == num_entities, label + "all entities are in the model" );
+
+	std::unordered_set<int> tags;
+	std::unordered_set<BinaryGuid> guids;
+	size_t num_invalid_guids = 0;
+	for( size_t thread_index = 0; thread_index < num_threads; ++thread_index )
+	{
+		for( const shared_ptr<IFC4X3::IfcWall>& wall : walls_per_thread[thread_index] )
+		{
+			tags.insert( wall->m_tag );
+			if( !wall->m_GlobalId || !isValidGuid( wall->m_GlobalId->m_value ) )
+			{
+				++num_invalid_guids;
+				continue;
+			}
+			guids.insert( BinaryGuid( wall->m_GlobalId->m_value ) );
+		}
+		for( const shared_ptr<IFC4X3::IfcCartesianPoint>& point : points_per_thread[thread_index] )
+		{
+			tags.insert( point->m_tag );
+		}
+	}
+	check( tags.size() == num_entities, label + "each entity has its own tag" );
+	check( tags.count( 0 ) == 0 && tags.count( (int)num_entities ) == 1 && tags.count( (int)num_entities + 1 ) == 0, label + "the tags are 1 to the number of entities" );
+	check( num_invalid_guids == 0, label + std::to_string( num_invalid_guids ) + " GlobalIds are not valid version 4 GUIDs" );
+	check( guids.size() == num_walls, label + "each wall has its own GlobalId" );
+}
+
+static void checkDeterministicGuidsFromOneThread()
+{
+	std::vector<std::string> guids[2];
+	for( std::vector<std::string>& guids_of_run : guids )
+	{
+		shared_ptr<BuildingModel> model( new BuildingModel() );
+		BulkEntityBuilder builder( model );
+		builder.setDeterministicGuids( 7 );
+		std::vector<shared_ptr<IFC4X3::IfcWall> > walls;
+		for( size_t ii = 0; ii < 10; ++ii )
+		{
+			builder.createEntities( 100, walls );
+		}
+		for( const shared_ptr<IFC4X3::IfcWall>& wall : walls )
+		{
+			guids_of_run.push_back( wall->m_GlobalId->m_value );
+		}
+	}
+	check( guids[0] == guids[1], "blocks reserved in the same order get the same GUIDs" );
+}
+
+static void checkReservedTags()
+{
+	shared_ptr<BuildingModel> model( new BuildingModel() );
+	std::vector<shared_ptr<BuildingEntity> > points;
+	for( int ii = 0; ii < 10; ++ii )
+	{
+		shared_ptr<IFC4X3::IfcCartesianPoint> point( new IFC4X3::IfcCartesianPoint() );
+		model->insertEntity( point );
+		points.push_back( point );
+	}
+	check( points.back()->m_tag == 10, "tags of inserted entities" );
+
+	const int first_reserved = model->reserveEntityTags( 5 );
+	check( first_reserved == 11, "reserved tags start above the model" );
+
+	// one of the reserved entities is inserted and removed again. The maximum tag must not drop into the reserved range
+	shared_ptr<IFC4X3::IfcCartesianPoint> reserved_point( new IFC4X3::IfcCartesianPoint() );
+	reserved_point->m_tag = 15;
+	model->insertEntity( reserved_point );
+	model->removeEntity( reserved_point );
+	check( model->getNextUnusedEntityTagFast() == 16, "getNextUnusedEntityTagFast after removeEntity skips the reserved tags" );
+	check( model->getLowestUnusedEntityTagSlow() == 16, "getLowestUnusedEntityTagSlow skips the reserved tags" );
+
+	shared_ptr<IFC4X3::IfcCartesianPoint> point( new IFC4X3::IfcCartesianPoint() );
+	model->insertEntity( point );
+	check( point->m_tag > 15, "insertEntity does not use a reserved tag" );
+	check( model->reserveEntityTags( 1 ) > point->m_tag, "the next reservation starts above the model" );
+
+	// reserved tags of an empty model
+	shared_ptr<BuildingModel> empty_model( new BuildingModel() );
+	const int first_reserved_empty = empty_model->reserveEntityTags( 3 );
+	check( first_reserved_empty == 1, "reserved tags of an empty model start at 1" );
+	check( empty_model->getLowestUnusedEntityTagSlow() == 4, "getLowestUnusedEntityTagSlow of an empty model skips the reserved tags" );
+
+	empty_model->clearIfcModel();
+	check( empty_model->reserveEntityTags( 1 ) == 1, "clearIfcModel releases the reserved tags" );
+}
+
+int main( int argc, char* argv[] )
+{
+	checkBulkCreation( false );
+	checkBulkCreation( true );
+	checkDeterministicGuidsFromOneThread();
+	checkReservedTags();
+
+	if( num_errors > 0 )
+	{
+		std::cout << num_errors << " checks failed" << std::endl;
+		return 1;
+	}
+	return 0;
+}
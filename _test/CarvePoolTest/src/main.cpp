@@ -0,0 +1,189 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+// Meshes are created by worker threads and freed by the main thread, as in the geometry conversion.
+// Checks that the pool reuses the freed edges and faces instead of growing with each round, and that
+// it gives its chunks back when all meshes are freed, also while other threads create meshes.
+// To check the meshes themselves, build with -fsanitize=address, or with CARVE_NO_POOL_ALLOCATION
+// and run with valgrind.
+
+#include <atomic>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <carve/carve.hpp>
+#include <carve/mesh.hpp>
+#include <carve/pool_alloc.hpp>
+
+typedef carve::mesh::MeshSet<3> meshset_t;
+
+static int num_errors = 0;
+
+static void check( bool condition, const std::string& message )
+{
+	if( !condition )
+	{
+		std::cout << "FAILED: " << message << std::endl;
+		++num_errors;
+	}
+}
+
+// open grid of num_cells x num_cells quads
+static meshset_t* createGrid( int num_cells, double offset )
+{
+	std::vector<carve::geom::vector<3> > points;
+	for( int ii = 0; ii <= num_cells; ++ii )
+	{
+		for( int jj = 0; jj <= num_cells; ++jj )
+		{
+			points.push_back( carve::geom::VECTOR( ii, jj, offset ) );
+		}
+	}
+
+	std::vector<int> face_indices;
+	for( int ii = 0; ii < num_cells; ++ii )
+	{
+		for( int jj = 0; jj < num_cells; ++jj )
+		{
+			const int v0 = ii * ( num_cells + 1 ) + jj;
+			const int v1 = v0 + num_cells + 1;
+			face_indices.push_back( 4 );
+			face_indices.push_back( v0 );
+			face_indices.push_back( v1 );
+			face_indices.push_back( v1 + 1 );
+			face_indices.push_back( v0 + 1 );
+		}
+	}
+	return new meshset_t( points, num_cells * num_cells, face_indices, 1e-9 );
+}
+
+int main()
+{
+	const int num_rounds = 30;
+	const int num_threads = 4;
+	const int num_meshes_per_thread = 8;
+	const int num_cells = 40;
+
+	// kept alive during the rounds, so that the pool does not drain in between
+	std::unique_ptr<meshset_t> anchor( createGrid( 2, 0 ) );
+
+	size_t num_chunks_after_first_round = 0;
+	for( int round = 0; round < num_rounds; ++round )
+	{
+		std::vector<std::vector<meshset_t*> > meshes_per_thread( num_threads );
+		std::vector<std::thread> threads;
+		for( int ii = 0; ii < num_threads; ++ii )
+		{
+			threads.emplace_back( [&meshes_per_thread, ii]()
+			{
+				for( int jj = 0; jj < num_meshes_per_thread; ++jj )
+				{
+					meshes_per_thread[ii].push_back( createGrid( num_cells, jj ) );
+				}
+			} );
+		}
+		for( std::thread& thread : threads )
+		{
+			thread.join();
+		}
+
+		for( std::vector<meshset_t*>& meshes : meshes_per_thread )
+		{
+			for( meshset_t* meshset : meshes )
+			{
+				std::unique_ptr<meshset_t> cloned( meshset->clone() );
+				check( cloned->meshes.size() == 1 && cloned->meshes[0]->faces.size() == size_t( num_cells * num_cells ), "clone has all faces" );
+				check( cloned->meshes[0]->open_edges.size() == size_t( 4 * num_cells ), "clone has all open edges" );
+				delete meshset;
+			}
+		}
+
+#if !defined(CARVE_NO_POOL_ALLOCATION)
+		const carve::PoolStatistics stats = carve::poolStatistics();
+		if( round == 0 )
+		{
+			num_chunks_after_first_round = stats.num_chunks;
+		}
+		// the blocks freed by the main thread are reused by the next round. Only the free lists of the threads differ
+		check( stats.num_chunks <= num_chunks_after_first_round * 2, "round " + std::to_string( round ) + ": " + std::to_string( stats.num_chunks ) + " chunks, first round: " + std::to_string( num_chunks_after_first_round ) );
+#endif
+	}
+
+	// nothing is released while blocks are in use
+#if !defined(CARVE_NO_POOL_ALLOCATION)
+	const size_t num_chunks_before_release = carve::poolStatistics().num_chunks;
+	carve::poolRelease();
+	check( carve::poolStatistics().num_chunks == num_chunks_before_release, "chunks kept while blocks are in use" );
+#endif
+	check( anchor->meshes.size() == 1 && anchor->meshes[0]->faces.size() == 4, "anchor intact" );
+
+	// Meshes are created and freed while another thread releases the pool again and again. Without the anchor,
+	// the pool drains whenever the threads happen to hold no mesh
+	anchor.reset();
+	std::atomic<bool> done( false );
+	std::thread releasing_thread( [&done]()
+	{
+		while( !done.load() )
+		{
+			carve::poolRelease();
+		}
+	} );
+	std::vector<std::thread> threads;
+	std::vector<int> num_wrong_meshes( num_threads, 0 );
+	for( int ii = 0; ii < num_threads; ++ii )
+	{
+		threads.emplace_back( [&num_wrong_meshes, ii]()
+		{
+			for( int jj = 0; jj < 200; ++jj )
+			{
+				std::unique_ptr<meshset_t> meshset( createGrid( 4, jj ) );
+				std::unique_ptr<meshset_t> cloned( meshset->clone() );
+				if( cloned->meshes.size() != 1 || cloned->meshes[0]->faces.size() != 16 || cloned->meshes[0]->open_edges.size() != 16 )
+				{
+					++num_wrong_meshes[ii];
+				}
+			}
+		} );
+	}
+	for( std::thread& thread : threads )
+	{
+		thread.join();
+	}
+	done.store( true );
+	releasing_thread.join();
+	for( int ii = 0; ii < num_threads; ++ii )
+	{
+		check( num_wrong_meshes[ii] == 0, "meshes intact while the pool is released concurrently, thread " + std::to_string( ii ) );
+	}
+
+	carve::poolRelease();
+
+#if !defined(CARVE_NO_POOL_ALLOCATION)
+	const carve::PoolStatistics stats = carve::poolStatistics();
+	check( stats.num_blocks_in_use == 0, "all blocks freed" );
+	check( stats.num_chunks <= 16, "chunks given back after the pool drained: " + std::to_string( stats.num_chunks ) );
+#endif
+
+	if( num_errors > 0 )
+	{
+		std::cout << num_errors << " checks failed" << std::endl;
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,252 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+// Tags of Carve objects on 128 threads. Each thread starts its own passes with tagable::tag_begin and must never see
+// objects as tagged that another thread, or an earlier pass, has tagged. The objects are handed on to the next thread
+// between the rounds. Then unions, differences and intersections of boxes, which use tags to walk the meshes, are
+// computed on 128 threads and must give the same results as on one thread.
+// Build with -fsanitize=thread to check for data races.
+
+#include <condition_variable>
+#include <iostream>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <carve/carve.hpp>
+#include <carve/csg.hpp>
+#include <carve/mesh.hpp>
+#include <carve/tag.hpp>
+
+typedef carve::mesh::MeshSet<3> meshset_t;
+
+static const int num_threads = 128;
+static int num_errors = 0;
+static std::mutex check_mutex;
+
+static void check( bool condition, const std::string& message )
+{
+	if( !condition )
+	{
+		std::lock_guard<std::mutex> lock( check_mutex );
+		std::cout << "FAILED: " << message << std::endl;
+		++num_errors;
+	}
+}
+
+struct TagTestObject : public carve::tagable
+{
+	uint64_t tagValue() const { return __tag; }
+};
+
+// all threads wait until the last one arrives
+class Barrier
+{
+public:
+	explicit Barrier( int num_threads ) : m_num_threads( num_threads ) {}
+
+	void wait()
+	{
+		std::unique_lock<std::mutex> lock( m_mutex );
+		const int round = m_round;
+		if( ++m_num_waiting == m_num_threads )
+		{
+			m_num_waiting = 0;
+			++m_round;
+			m_condition.notify_all();
+			return;
+		}
+		m_condition.wait( lock, [&]() { return m_round != round; } );
+	}
+
+private:
+	std::mutex m_mutex;
+	std::condition_variable m_condition;
+	const int m_num_threads;
+	int m_num_waiting = 0;
+	int m_round = 0;
+};
+
+static void checkTagsOnThreads()
+{
+	const int num_rounds = 50;
+	const int num_objects = 200;
+	std::vector<std::vector<TagTestObject> > objects( num_threads, std::vector<TagTestObject>( num_objects ) );
+	std::vector<std::vector<uint64_t> > epochs( num_threads );
+	Barrier barrier( num_threads );
+
+	std::vector<std::thread> threads;
+	for( int thread_index = 0; thread_index < num_threads; ++thread_index )
+	{
+		threads.emplace_back( [&, thread_index]()
+		{
+			const std::string name = "thread " + std::to_string( thread_index );
+			for( int round = 0; round < num_rounds; ++round )
+			{
+				// objects that another thread tagged in the last round
+				std::vector<TagTestObject>& own_objects = objects[( thread_index + round ) % num_threads];
+				carve::tagable::tag_begin();
+				bool tags_ok = true;
+				for( size_t ii = 0; ii < own_objects.size(); ++ii )
+				{
+					const TagTestObject& object = own_objects[ii];
+					tags_ok = tags_ok && !object.is_tagged();
+					if( ii % 2 )
+					{
+						object.tag();
+					}
+					else
+					{
+						tags_ok = tags_ok && object.tag_once() && !object.tag_once();
+					}
+					tags_ok = tags_ok && object.is_tagged();
+				}
+				own_objects.back().untag();
+				tags_ok = tags_ok && !own_objects.back().is_tagged() && own_objects.front().is_tagged();
+				check( tags_ok, name + ": tag, tag_once or untag failed, round " + std::to_string( round ) );
+				epochs[thread_index].push_back( own_objects.front().tagValue() );
+
+				// a new pass on this thread does not see the tags of the last one
+				carve::tagable::tag_begin();
+				check( !own_objects.front().is_tagged(), name + ": object of the last pass is tagged, round " + std::to_string( round ) );
+				carve::tagable::tag_begin();
+				for( const TagTestObject& object : own_objects )
+				{
+					object.tag();
+				}
+
+				// no thread starts a pass until all have looked at the objects of the next thread
+				barrier.wait();
+				for( const TagTestObject& object : objects[( thread_index + round + 1 ) % num_threads] )
+				{
+					if( object.is_tagged() )
+					{
+						check( false, name + ": object tagged by another thread is tagged, round " + std::to_string( round ) );
+						break;
+					}
+				}
+				barrier.wait();
+			}
+		} );
+	}
+	for( std::thread& thread : threads )
+	{
+		thread.join();
+	}
+
+	std::set<uint64_t> all_epochs;
+	for( const std::vector<uint64_t>& thread_epochs : epochs )
+	{
+		all_epochs.insert( thread_epochs.begin(), thread_epochs.end() );
+	}
+	check( all_epochs.size() == size_t( num_threads * num_rounds ), "epochs are not unique over all threads" );
+	check( all_epochs.find( 0 ) == all_epochs.end(), "epoch 0, which marks untagged objects, was used" );
+}
+
+static meshset_t* createBox( const carve::geom::vector<3>& min, const carve::geom::vector<3>& max )
+{
+	std::vector<carve::geom::vector<3> > points;
+	for( int ii = 0; ii < 8; ++ii )
+	{
+		points.push_back( carve::geom::VECTOR( ii & 1 ? max.x : min.x, ii & 2 ? max.y : min.y, ii & 4 ? max.z : min.z ) );
+	}
+	const std::vector<int> face_indices = { 4, 0, 2, 3, 1, 4, 4, 5, 7, 6, 4, 0, 1, 5, 4, 4, 2, 6, 7, 3, 4, 0, 4, 6, 2, 4, 1, 3, 7, 5 };
+	return new meshset_t( points, 6, face_indices, 1e-9 );
+}
+
+struct CsgResult
+{
+	size_t num_vertices = 0;
+	size_t num_faces = 0;
+	double volume = 0;
+};
+
+// union, difference and intersection of the unit cube with a box that depends on the configuration
+static std::vector<CsgResult> computeCsg( int configuration )
+{
+	std::vector<CsgResult> results;
+	const double offset = 0.1 + 0.1 * ( configuration % 8 );
+	for( carve::csg::CSG::OP op : { carve::csg::CSG::UNION, carve::csg::CSG::A_MINUS_B, carve::csg::CSG::INTERSECTION } )
+	{
+		std::unique_ptr<meshset_t> box_a( createBox( carve::geom::VECTOR( 0, 0, 0 ), carve::geom::VECTOR( 1, 1, 1 ) ) );
+		std::unique_ptr<meshset_t> box_b( createBox( carve::geom::VECTOR( offset, 0.5 * offset, -0.5 ), carve::geom::VECTOR( offset + 0.35, 1.5, 0.5 + offset ) ) );
+		carve::csg::CSG csg( 1e-9 );
+		std::unique_ptr<meshset_t> result( csg.compute( box_a.get(), box_b.get(), op, nullptr, carve::csg::CSG::CLASSIFY_EDGE ) );
+
+		CsgResult csg_result;
+		if( result )
+		{
+			csg_result.num_vertices = result->vertex_storage.size();
+			for( carve::mesh::Mesh<3>* mesh : result->meshes )
+			{
+				csg_result.num_faces += mesh->faces.size();
+				csg_result.volume += mesh->volume();
+			}
+		}
+		results.push_back( csg_result );
+	}
+	return results;
+}
+
+static void checkCsgOnThreads()
+{
+	const int num_configurations = 8;
+	const int num_rounds = 4;
+	std::vector<std::vector<CsgResult> > sequential_results;
+	for( int configuration = 0; configuration < num_configurations; ++configuration )
+	{
+		sequential_results.push_back( computeCsg( configuration ) );
+		check( sequential_results.back()[0].num_faces > 6 && sequential_results.back()[2].volume > 0, "configuration " + std::to_string( configuration ) + ": CSG has no result" );
+	}
+
+	std::vector<std::thread> threads;
+	for( int thread_index = 0; thread_index < num_threads; ++thread_index )
+	{
+		threads.emplace_back( [&, thread_index]()
+		{
+			for( int round = 0; round < num_rounds; ++round )
+			{
+				const int configuration = ( thread_index + round ) % num_configurations;
+				const std::vector<CsgResult> results = computeCsg( configuration );
+				for( size_t ii = 0; ii < results.size(); ++ii )
+				{
+					const CsgResult& expected = sequential_results[configuration][ii];
+					check( results[ii].num_vertices == expected.num_vertices && results[ii].num_faces == expected.num_faces && std::abs( results[ii].volume - expected.volume ) < 1e-9,
+						"thread " + std::to_string( thread_index ) + ", configuration " + std::to_string( configuration ) + ", operation " + std::to_string( ii ) + ": result differs from one thread" );
+				}
+			}
+		} );
+	}
+	for( std::thread& thread : threads )
+	{
+		thread.join();
+	}
+}
+
+int main()
+{
+	checkTagsOnThreads();
+	checkCsgOnThreads();
+
+	if( num_errors > 0 )
+	{
+		std::cout << num_errors << " checks failed" << std::endl;
+		return 1;
+	}
+	return 0;
+}
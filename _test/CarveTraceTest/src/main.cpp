@@ -0,0 +1,151 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+// Records trace events with names from temporary strings, which are freed or overwritten before the trace is written.
+// Each event must keep the name it had when it was recorded, also when the name is too long and truncated, and when
+// several threads record at the same time. Scopes must write one begin and one end event, and nothing is recorded
+// while tracing is off.
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <carve/carve.hpp>
+#include <carve/trace.hpp>
+
+static int num_errors = 0;
+
+static void check( bool condition, const std::string& message )
+{
+	if( !condition )
+	{
+		std::cout << "FAILED: " << message << std::endl;
+		++num_errors;
+	}
+}
+
+static size_t countOccurrences( const std::string& text, const std::string& pattern )
+{
+	size_t count = 0;
+	for( size_t pos = text.find( pattern ); pos != std::string::npos; pos = text.find( pattern, pos + pattern.size() ) )
+	{
+		++count;
+	}
+	return count;
+}
+
+static std::string writeTrace()
+{
+	std::stringstream stream;
+	carve::trace::writeChromeTrace( stream );
+	return stream.str();
+}
+
+int main()
+{
+	check( sizeof( carve::trace::Event ) == 64, "an event has " + std::to_string( sizeof( carve::trace::Event ) ) + " bytes instead of 64" );
+
+	// nothing is recorded while tracing is off
+	carve::trace::setEnabled( false );
+	carve::trace::clear();
+	{
+		std::string name = "disabled_event";
+		CARVE_TRACE_EVENT( name.c_str(), 1 );
+		CARVE_TRACE_SCOPE( name.c_str(), 1 );
+		printToDebugLog( name.c_str(), "details" );
+	}
+	check( writeTrace().find( "disabled_event" ) == std::string::npos, "events recorded while tracing is off" );
+
+	carve::trace::setEnabled( true );
+	carve::trace::clear();
+
+	// names from strings that are overwritten and freed after each event
+	const int num_events = 100;
+	std::string reused_name;
+	for( int ii = 0; ii < num_events; ++ii )
+	{
+		reused_name = "reused_name_" + std::to_string( ii ) + "_";
+		CARVE_TRACE_EVENT( reused_name.c_str(), ii );
+		std::string* temporary_name = new std::string( "temporary_name_" + std::to_string( ii ) + "_" );
+		CARVE_TRACE_COUNTER( temporary_name->c_str(), ii );
+		printToDebugLog( std::string( "debug_log_name_" + std::to_string( ii ) + "_" ).c_str(), "details" );
+		delete temporary_name;
+	}
+
+	// the scope name is a temporary that is gone before the end event
+	{
+		CARVE_TRACE_SCOPE( std::string( "temporary_scope_name" ).c_str(), 1 );
+		CARVE_TRACE_SCOPE( "nested_scope", 2 );
+	}
+
+	// truncated name
+	const std::string long_name = "long_name_" + std::string( 100, 'x' );
+	CARVE_TRACE_EVENT( long_name.c_str(), 0 );
+
+	// threads with their own buffers
+	const int num_threads = 8;
+	std::vector<std::thread> threads;
+	for( int thread_index = 0; thread_index < num_threads; ++thread_index )
+	{
+		threads.emplace_back( [thread_index]() {
+			for( int ii = 0; ii < num_events; ++ii )
+			{
+				std::string name = "thread_" + std::to_string( thread_index ) + "_event_" + std::to_string( ii ) + "_";
+				CARVE_TRACE_SCOPE( name.c_str(), ii );
+				name.assign( name.size(), '#' );
+			}
+		} );
+	}
+	for( std::thread& thread : threads )
+	{
+		thread.join();
+	}
+	carve::trace::setEnabled( false );
+
+	const std::string trace = writeTrace();
+	for( int ii = 0; ii < num_events; ++ii )
+	{
+		check( countOccurrences( trace, "\"reused_name_" + std::to_string( ii ) + "_\"" ) == 1, "event reused_name_" + std::to_string( ii ) + " is missing" );
+		check( countOccurrences( trace, "\"temporary_name_" + std::to_string( ii ) + "_\"" ) == 1, "counter temporary_name_" + std::to_string( ii ) + " is missing" );
+		check( countOccurrences( trace, "\"debug_log_name_" + std::to_string( ii ) + "_\"" ) == 1, "event debug_log_name_" + std::to_string( ii ) + " is missing" );
+	}
+	for( int thread_index = 0; thread_index < num_threads; ++thread_index )
+	{
+		size_t num_found = 0;
+		for( int ii = 0; ii < num_events; ++ii )
+		{
+			num_found += countOccurrences( trace, "\"thread_" + std::to_string( thread_index ) + "_event_" + std::to_string( ii ) + "_\"" );
+		}
+		check( num_found == num_events, "thread " + std::to_string( thread_index ) + ": " + std::to_string( num_found ) + " of " + std::to_string( num_events ) + " scopes found" );
+	}
+	check( countOccurrences( trace, "\"temporary_scope_name\"" ) == 1, "scope temporary_scope_name is missing" );
+	check( countOccurrences( trace, "\"nested_scope\"" ) == 1, "scope nested_scope is missing" );
+	check( countOccurrences( trace, "\"" + long_name.substr( 0, carve::trace::MAX_NAME_LENGTH ) + "\"" ) == 1, "long name is not truncated to " + std::to_string( carve::trace::MAX_NAME_LENGTH ) + " characters" );
+	check( trace.find( '#' ) == std::string::npos, "a name was changed after recording" );
+
+	const size_t num_begin = countOccurrences( trace, "\"ph\":\"B\"" );
+	const size_t num_end = countOccurrences( trace, "\"ph\":\"E\"" );
+	check( num_begin == num_threads * num_events + 2 && num_end == num_begin, std::to_string( num_begin ) + " begin and " + std::to_string( num_end ) + " end events" );
+
+	if( num_errors > 0 )
+	{
+		std::cout << num_errors << " checks failed" << std::endl;
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,316 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+// Stitches random triangle sets into meshes and compares the result with the previous FaceStitcher, which paired half-edges through
+// an unordered_map from vertex pair to edge list. The triangles come from a grid, with some left out, some flipped, and some fins
+// that put three or more faces on one edge.
+// Without such complex edges, FaceStitcher is done after pairing the simple edges. The reference below is that pairing, so the rev
+// links and the meshes, with their order and the order of their faces, must be the same. With complex edges, the simple edges must
+// still be paired the same way, and the meshes must be the edge-connected parts of the result.
+
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <list>
+#include <map>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <carve/carve.hpp>
+#include <carve/mesh.hpp>
+
+typedef carve::mesh::MeshSet<3> meshset_t;
+
+static int num_errors = 0;
+
+static void check( bool condition, const std::string& message )
+{
+	if( !condition )
+	{
+		std::cout << "FAILED: " << message << std::endl;
+		++num_errors;
+	}
+}
+
+struct Triangle
+{
+	int v[3];
+};
+
+// a half-edge, as face index and index of its start vertex
+typedef std::pair<int, int> HalfEdge;
+const HalfEdge no_half_edge( -1, -1 );
+
+struct VertexPairHash
+{
+	size_t operator()( const std::pair<int, int>& pair ) const
+	{
+		return std::hash<long long>()( ( (long long)pair.first << 32 ) ^ pair.second );
+	}
+};
+
+// matchSimpleEdges of the previous FaceStitcher, on vertex indices
+struct ReferenceStitching
+{
+	std::map<HalfEdge, HalfEdge> rev;
+	std::vector<std::vector<int> > meshes;
+	bool has_complex_edges = false;
+
+	ReferenceStitching( const std::vector<Triangle>& triangles )
+	{
+		std::unordered_map<std::pair<int, int>, std::list<HalfEdge>, VertexPairHash> edges;
+		for( size_t ii = 0; ii < triangles.size(); ++ii )
+		{
+			for( int jj = 0; jj < 3; ++jj )
+			{
+				const Triangle& triangle = triangles[ii];
+				edges[std::make_pair( triangle.v[jj], triangle.v[( jj + 1 ) % 3] )].push_back( HalfEdge( int( ii ), triangle.v[jj] ) );
+			}
+		}
+
+		std::vector<size_t> face_group( triangles.size() );
+		for( size_t ii = 0; ii < face_group.size(); ++ii )
+		{
+			face_group[ii] = ii;
+		}
+		std::function<size_t( size_t )> findGroup = [&]( size_t face ) { return face_group[face] == face ? face : face_group[face] = findGroup( face_group[face] ); };
+
+		for( auto& it : edges )
+		{
+			auto it_reverse = edges.find( std::make_pair( it.first.second, it.first.first ) );
+			if( it_reverse == edges.end() )
+			{
+				continue;
+			}
+			if( it.second.size() != 1 || it_reverse->second.size() != 1 )
+			{
+				has_complex_edges = true;
+				continue;
+			}
+			const HalfEdge a = it.second.front();
+			const HalfEdge b = it_reverse->second.front();
+			rev[a] = b;
+			rev[b] = a;
+			face_group[findGroup( a.first )] = findGroup( b.first );
+		}
+
+		// meshes in the order of their first face, each with its faces in input order
+		std::map<size_t, size_t> mesh_of_group;
+		for( size_t ii = 0; ii < triangles.size(); ++ii )
+		{
+			const size_t group = findGroup( ii );
+			if( mesh_of_group.find( group ) == mesh_of_group.end() )
+			{
+				mesh_of_group[group] = meshes.size();
+				meshes.emplace_back();
+			}
+			meshes[mesh_of_group[group]].push_back( int( ii ) );
+		}
+	}
+};
+
+struct Stitching
+{
+	std::map<HalfEdge, HalfEdge> rev;
+	std::vector<std::vector<int> > meshes;
+	std::vector<bool> mesh_closed;
+	bool consistent = true;
+
+	Stitching( const std::vector<carve::geom::vector<3> >& points, const std::vector<Triangle>& triangles )
+	{
+		std::vector<int> face_indices;
+		for( const Triangle& triangle : triangles )
+		{
+			face_indices.push_back( 3 );
+			face_indices.insert( face_indices.end(), triangle.v, triangle.v + 3 );
+		}
+		meshset_t meshset( points, triangles.size(), face_indices, 1e-9 );
+		const carve::mesh::Vertex<3>* first_vertex = &meshset.vertex_storage[0];
+
+		for( carve::mesh::Mesh<3>* mesh : meshset.meshes )
+		{
+			meshes.emplace_back();
+			mesh_closed.push_back( mesh->isClosed() );
+			for( carve::mesh::Face<3>* face : mesh->faces )
+			{
+				meshes.back().push_back( int( face->id ) );
+				carve::mesh::Edge<3>* edge = face->edge;
+				do
+				{
+					if( edge->rev )
+					{
+						consistent = consistent && edge->rev->rev == edge && edge->rev->v1() == edge->v2() && edge->rev->v2() == edge->v1();
+						rev[HalfEdge( int( face->id ), int( edge->v1() - first_vertex ) )] = HalfEdge( int( edge->rev->face->id ), int( edge->rev->v1() - first_vertex ) );
+					}
+					edge = edge->next;
+				} while( edge != face->edge );
+			}
+		}
+	}
+};
+
+// each mesh must be one part that is connected through the rev links, and it is closed if all of its edges have a rev link
+static bool meshesAreConnectedParts( const Stitching& stitching, size_t num_triangles )
+{
+	std::vector<size_t> mesh_of_face( num_triangles, SIZE_MAX );
+	for( size_t ii = 0; ii < stitching.meshes.size(); ++ii )
+	{
+		for( int face : stitching.meshes[ii] )
+		{
+			if( mesh_of_face[face] != SIZE_MAX )
+			{
+				return false;
+			}
+			mesh_of_face[face] = ii;
+		}
+	}
+	std::vector<size_t> num_rev_links( stitching.meshes.size(), 0 );
+	for( auto& it : stitching.rev )
+	{
+		if( mesh_of_face[it.first.first] != mesh_of_face[it.second.first] )
+		{
+			return false;
+		}
+		++num_rev_links[mesh_of_face[it.first.first]];
+	}
+
+	for( size_t ii = 0; ii < stitching.meshes.size(); ++ii )
+	{
+		// connected: a search along the rev links from the first face reaches all faces of the mesh
+		std::vector<int> stack( 1, stitching.meshes[ii].front() );
+		std::vector<bool> reached( num_triangles, false );
+		reached[stack.front()] = true;
+		size_t num_reached = 1;
+		while( !stack.empty() )
+		{
+			const int face = stack.back();
+			stack.pop_back();
+			for( auto it = stitching.rev.lower_bound( HalfEdge( face, -1 ) ); it != stitching.rev.end() && it->first.first == face; ++it )
+			{
+				if( !reached[it->second.first] )
+				{
+					reached[it->second.first] = true;
+					++num_reached;
+					stack.push_back( it->second.first );
+				}
+			}
+		}
+		if( num_reached != stitching.meshes[ii].size() || stitching.mesh_closed[ii] != ( num_rev_links[ii] == 3 * stitching.meshes[ii].size() ) )
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+// triangles of a grid of num_cells x num_cells points at z = 0. Some cells are left out or flipped, and some edges get a fin to a point at z = 1
+static void createTriangles( std::mt19937& random, int num_cells, double fin_probability, std::vector<carve::geom::vector<3> >& points, std::vector<Triangle>& triangles )
+{
+	std::uniform_real_distribution<double> uniform( 0.0, 1.0 );
+	points.clear();
+	triangles.clear();
+	for( int ii = 0; ii <= num_cells; ++ii )
+	{
+		for( int jj = 0; jj <= num_cells; ++jj )
+		{
+			points.push_back( carve::geom::VECTOR( ii, jj, 0.0 ) );
+		}
+	}
+	const int apex = int( points.size() );
+	points.push_back( carve::geom::VECTOR( 0.5 * num_cells, 0.5 * num_cells, 1.0 ) );
+
+	for( int ii = 0; ii < num_cells; ++ii )
+	{
+		for( int jj = 0; jj < num_cells; ++jj )
+		{
+			const int v0 = ii * ( num_cells + 1 ) + jj;
+			const int v1 = v0 + num_cells + 1;
+			for( Triangle triangle : { Triangle{ { v0, v1, v1 + 1 } }, Triangle{ { v0, v1 + 1, v0 + 1 } } } )
+			{
+				const double r = uniform( random );
+				if( r < 0.1 )
+				{
+					continue;
+				}
+				if( r < 0.15 )
+				{
+					std::swap( triangle.v[1], triangle.v[2] );
+				}
+				triangles.push_back( triangle );
+				if( uniform( random ) < fin_probability )
+				{
+					triangles.push_back( Triangle{ { triangle.v[1], triangle.v[0], apex } } );
+				}
+			}
+		}
+	}
+	std::shuffle( triangles.begin(), triangles.end(), random );
+}
+
+int main()
+{
+	std::mt19937 random( 20240607 );
+	std::vector<carve::geom::vector<3> > points;
+	std::vector<Triangle> triangles;
+	int num_simple = 0;
+	int num_complex = 0;
+
+	for( int round = 0; round < 400; ++round )
+	{
+		const int num_cells = 2 + round % 15;
+		const double fin_probability = round % 2 ? 0.0 : 0.02;
+		createTriangles( random, num_cells, fin_probability, points, triangles );
+		if( triangles.empty() )
+		{
+			continue;
+		}
+
+		const ReferenceStitching reference( triangles );
+		const Stitching stitching( points, triangles );
+		const std::string name = "round " + std::to_string( round ) + ", " + std::to_string( triangles.size() ) + " triangles";
+		check( stitching.consistent, name + ": rev links do not point back, or not along the same edge" );
+		check( meshesAreConnectedParts( stitching, triangles.size() ), name + ": meshes are not the connected parts" );
+
+		if( !reference.has_complex_edges )
+		{
+			++num_simple;
+			check( stitching.rev == reference.rev, name + ": rev links differ from the previous stitching" );
+			check( stitching.meshes == reference.meshes, name + ": meshes differ from the previous stitching" );
+			continue;
+		}
+
+		++num_complex;
+		for( auto& it : reference.rev )
+		{
+			auto it_rev = stitching.rev.find( it.first );
+			if( it_rev == stitching.rev.end() || it_rev->second != it.second )
+			{
+				check( false, name + ": simple edge not paired as in the previous stitching" );
+				break;
+			}
+		}
+	}
+	check( num_simple > 150 && num_complex > 150, std::to_string( num_simple ) + " rounds without and " + std::to_string( num_complex ) + " with complex edges" );
+
+	if( num_errors > 0 )
+	{
+		std::cout << num_errors << " checks failed" << std::endl;
+		return 1;
+	}
+	return 0;
+}
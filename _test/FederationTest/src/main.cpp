@@ -0,0 +1,175 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+// Federates data/walls_millimetre.ifc and data/walls_metre.ifc, which describe the same two walls, once in millimetre
+// and once in metre, and checks that the vertices of each wall line up after the geometry conversion.
+// Wall: IfcPolyline profile, so the coordinates are IfcCartesianPoint, in a rotated IfcLocalPlacement.
+// IndexedWall: IfcIndexedPolyCurve profile over an IfcCartesianPointList2D.
+// Both orders of the files are checked, so that each file is converted once to the units of the other.
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <ifcpp/model/BuildingModel.h>
+#include <ifcpp/reader/FederatedModelReader.h>
+#include <ifcpp/geometry/GeometryConverter.h>
+#include <IfcDirection.h>
+#include <IfcReal.h>
+
+static int num_errors = 0;
+
+static void check( bool condition, const std::string& message )
+{
+	if( !condition )
+	{
+		std::cout << "FAILED: " << message << std::endl;
+		++num_errors;
+	}
+}
+
+static void collectVertices( const shared_ptr<ItemShapeData>& item, const carve::math::Matrix& transform, std::vector<vec3>& vertices )
+{
+	for( const shared_ptr<carve::mesh::MeshSet<3> >& meshset : item->m_meshsets )
+	{
+		for( carve::mesh::Vertex<3>& vertex : meshset->vertex_storage )
+		{
+			vertices.push_back( transform * vertex.v );
+		}
+	}
+	for( const shared_ptr<ItemShapeData>& child_item : item->m_child_items )
+	{
+		collectVertices( child_item, transform, vertices );
+	}
+}
+
+// sorted global vertex coordinates of each wall, per file index and wall name
+static std::map<std::pair<int, std::string>, std::vector<vec3> > loadWalls( const std::vector<std::string>& file_paths )
+{
+	shared_ptr<BuildingModel> model( new BuildingModel() );
+	shared_ptr<FederatedModelReader> reader( new FederatedModelReader() );
+	reader->loadModelsFromFiles( file_paths, model );
+
+	check( reader->getSourceFiles().size() == 2 && !reader->getSourceFiles()[1].m_units_match, "units of the second file are converted" );
+
+	// direction ratios have no unit
+	for( auto& it : model->getMapIfcEntities() )
+	{
+		shared_ptr<IfcDirection> direction = dynamic_pointer_cast<IfcDirection>( it.second );
+		if( !direction )
+		{
+			continue;
+		}
+		for( const shared_ptr<IfcReal>& ratio : direction->m_DirectionRatios )
+		{
+			check( ratio && std::abs( ratio->m_value ) <= 1.0, "IfcDirection #" + std::to_string( direction->m_tag ) + " is not scaled" );
+		}
+	}
+
+	shared_ptr<GeometrySettings> geom_settings( new GeometrySettings() );
+	shared_ptr<GeometryConverter> geometry_converter( new GeometryConverter( model, geom_settings ) );
+	geometry_converter->convertGeometry();
+
+	std::map<std::pair<int, std::string>, std::vector<vec3> > map_walls;
+	for( auto& it : geometry_converter->getShapeInputData() )
+	{
+		shared_ptr<ProductShapeData>& product_shape = it.second;
+		if( !product_shape || product_shape->m_ifc_object_definition.expired() )
+		{
+			continue;
+		}
+		shared_ptr<IfcObjectDefinition> object_def( product_shape->m_ifc_object_definition );
+		if( !object_def->m_Name )
+		{
+			continue;
+		}
+
+		std::vector<vec3>& vertices = map_walls[std::make_pair( reader->getSourceFileIndex( object_def->m_tag ), object_def->m_Name->m_value )];
+		const carve::math::Matrix transform = product_shape->getTransform();
+		for( const shared_ptr<ItemShapeData>& item : product_shape->getGeometricItems() )
+		{
+			collectVertices( item, transform, vertices );
+		}
+		std::sort( vertices.begin(), vertices.end(), []( const vec3& a, const vec3& b ) { return std::lexicographical_compare( a.v, a.v + 3, b.v, b.v + 3 ); } );
+	}
+	return map_walls;
+}
+
+static void checkWalls( const std::vector<std::string>& file_paths )
+{
+	const std::string files = file_paths[0] + ", " + file_paths[1];
+	std::map<std::pair<int, std::string>, std::vector<vec3> > map_walls = loadWalls( file_paths );
+
+	// global bounding boxes in metre
+	const std::map<std::string, std::pair<vec3, vec3> > expected_bounds = {
+		{ "Wall", { carve::geom::VECTOR( 0.8, 2.0, 0.0 ), carve::geom::VECTOR( 1.0, 6.0, 3.0 ) } },
+		{ "IndexedWall", { carve::geom::VECTOR( 3.0, 2.0, 0.0 ), carve::geom::VECTOR( 5.0, 2.3, 2.5 ) } }
+	};
+
+	for( auto& it : expected_bounds )
+	{
+		const std::string& name = it.first;
+		const std::vector<vec3>& vertices0 = map_walls[std::make_pair( 0, name )];
+		const std::vector<vec3>& vertices1 = map_walls[std::make_pair( 1, name )];
+		check( !vertices0.empty() && !vertices1.empty(), files + ": " + name + ": no geometry" );
+		check( vertices0.size() == vertices1.size(), files + ": " + name + ": " + std::to_string( vertices0.size() ) + " and " + std::to_string( vertices1.size() ) + " vertices" );
+		if( vertices0.empty() || vertices0.size() != vertices1.size() )
+		{
+			continue;
+		}
+
+		double max_distance = 0;
+		for( size_t ii = 0; ii < vertices0.size(); ++ii )
+		{
+			max_distance = std::max( max_distance, ( vertices0[ii] - vertices1[ii] ).length() );
+		}
+		check( max_distance < 1e-6, files + ": " + name + ": vertices differ by " + std::to_string( max_distance ) );
+
+		for( const std::vector<vec3>* vertices : { &vertices0, &vertices1 } )
+		{
+			carve::geom::aabb<3> bbox( vertices->begin(), vertices->end() );
+			const vec3 min_corner = bbox.minPoint();
+			const vec3 max_corner = bbox.maxPoint();
+			check( ( min_corner - it.second.first ).length() < 1e-6 && ( max_corner - it.second.second ).length() < 1e-6, files + ": " + name + ": bounding box ("
+				+ std::to_string( min_corner.x ) + ", " + std::to_string( min_corner.y ) + ", " + std::to_string( min_corner.z ) + ") - ("
+				+ std::to_string( max_corner.x ) + ", " + std::to_string( max_corner.y ) + ", " + std::to_string( max_corner.z ) + ")" );
+		}
+		std::cout << files << ": " << name << ": " << vertices0.size() << " vertices, max distance " << max_distance << std::endl;
+	}
+}
+
+int main( int argc, char* argv[] )
+{
+	if( argc < 3 )
+	{
+		std::cout << "usage: FederationTest walls_millimetre.ifc walls_metre.ifc" << std::endl;
+		return 1;
+	}
+
+	checkWalls( { argv[1], argv[2] } );
+	checkWalls( { argv[2], argv[1] } );
+
+	if( num_errors > 0 )
+	{
+		std::cout << num_errors << " checks failed" << std::endl;
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,188 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+// Places the proxies of data/grid_reference.ifc on their grid intersections and compares position and x axis with values computed by hand.
+// Straight: placed at (100,50,0), U axes x = 0, 10, 20 from y = 0 to 30, V axes y = 0, 15, 40 from x = -5 to 25, and V4 at y = 20 drawn from
+// right to left with SameSense false. V3 is beyond the ends of the U axes, so its intersections are virtual.
+// Curved: placed at (-50,0,0) and rotated by 90 degrees, quarter circles with radius 10 and 20 from 0 to 90 degrees, and radial lines of
+// length 30 at 0, 30 and 60 degrees. Offsets move an axis to its left, which is towards the centre for the counter-clockwise circles.
+// Each placement is computed again from the cache, after clearing the cache, and from several threads, and must not change.
+
+#include <cmath>
+#include <iostream>
+#include <map>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#include <ifcpp/model/BuildingModel.h>
+#include <ifcpp/reader/ReaderSTEP.h>
+#include <ifcpp/geometry/GeometryConverter.h>
+#include <IfcBuildingElementProxy.h>
+#include <IfcLabel.h>
+
+static int num_errors = 0;
+
+static void check( bool condition, const std::string& message )
+{
+	if( !condition )
+	{
+		std::cout << "FAILED: " << message << std::endl;
+		++num_errors;
+	}
+}
+
+struct ExpectedPlacement
+{
+	std::string name;
+	vec3 position;
+	vec3 x_axis;
+};
+
+struct Placement
+{
+	vec3 position;
+	vec3 x_axis;
+};
+
+static Placement getPlacement( const shared_ptr<PlacementConverter>& placement_converter, const shared_ptr<IfcProduct>& product )
+{
+	shared_ptr<ProductShapeData> product_data( new ProductShapeData() );
+	std::unordered_set<IfcObjectPlacement*> placement_already_applied;
+	placement_converter->convertIfcObjectPlacement( product->m_ObjectPlacement, product_data, placement_already_applied, false );
+	const carve::math::Matrix transform = product_data->getTransform();
+	Placement placement;
+	placement.position = transform * carve::geom::VECTOR( 0.0, 0.0, 0.0 );
+	placement.x_axis = transform * carve::geom::VECTOR( 1.0, 0.0, 0.0 ) - placement.position;
+	return placement;
+}
+
+static std::map<std::string, Placement> getPlacements( const shared_ptr<PlacementConverter>& placement_converter, const std::map<std::string, shared_ptr<IfcProduct> >& products )
+{
+	std::map<std::string, Placement> placements;
+	for( auto& it : products )
+	{
+		placements[it.first] = getPlacement( placement_converter, it.second );
+	}
+	return placements;
+}
+
+static void checkSamePlacements( const std::map<std::string, Placement>& placements, const std::map<std::string, Placement>& reference, const std::string& context )
+{
+	for( auto& it : reference )
+	{
+		auto it_placement = placements.find( it.first );
+		const bool same = it_placement != placements.end() && ( it_placement->second.position - it.second.position ).length() < 1e-12
+			&& ( it_placement->second.x_axis - it.second.x_axis ).length() < 1e-12;
+		check( same, it.first + ": placement differs " + context );
+	}
+}
+
+int main( int argc, char* argv[] )
+{
+	if( argc < 2 )
+	{
+		std::cout << "usage: GridTest grid_reference.ifc" << std::endl;
+		return 1;
+	}
+
+	shared_ptr<BuildingModel> model( new BuildingModel() );
+	shared_ptr<ReaderSTEP> reader( new ReaderSTEP() );
+	reader->loadModelFromFile( argv[1], model );
+
+	std::map<std::string, shared_ptr<IfcProduct> > products;
+	for( auto& it : model->getMapIfcEntities() )
+	{
+		shared_ptr<IfcBuildingElementProxy> proxy = dynamic_pointer_cast<IfcBuildingElementProxy>( it.second );
+		if( proxy && proxy->m_Name )
+		{
+			products[proxy->m_Name->m_value] = proxy;
+		}
+	}
+
+	// curved grid: local (x,y) is at world (-50 - y, x), and the local x axis is the world y axis
+	auto curved = []( double x, double y ) { return carve::geom::VECTOR( -50.0 - y, x, 0.0 ); };
+	const vec3 curved_x_axis = carve::geom::VECTOR( 0.0, 1.0, 0.0 );
+	const vec3 straight_x_axis = carve::geom::VECTOR( 1.0, 0.0, 0.0 );
+
+	// circle with radius 20 - 2 and the line at 60 degrees moved by 1 to its left: the line is at distance 1 from the centre
+	const double along_offset_line = std::sqrt( 18.0 * 18.0 - 1.0 );
+	const double cos60 = 0.5;
+	const double sin60 = std::sqrt( 3.0 ) * 0.5;
+
+	const std::vector<ExpectedPlacement> expected_placements = {
+		{ "StraightU2V2", carve::geom::VECTOR( 110.0, 65.0, 0.0 ), straight_x_axis },
+		{ "StraightOffset", carve::geom::VECTOR( 109.0, 52.0, 3.0 ), straight_x_axis },
+		{ "StraightVirtual", carve::geom::VECTOR( 120.0, 90.0, 0.0 ), straight_x_axis },
+		{ "StraightReversed", carve::geom::VECTOR( 100.0, 71.0, 0.0 ), straight_x_axis },
+		{ "StraightRefIntersection", carve::geom::VECTOR( 100.0, 50.0, 0.0 ), carve::geom::VECTOR( 10.0, 15.0, 0.0 ).normalized() },
+		{ "StraightRefDirection", carve::geom::VECTOR( 100.0, 50.0, 0.0 ), carve::geom::VECTOR( 0.0, 1.0, 0.0 ) },
+		{ "StraightRelativeTo", carve::geom::VECTOR( 10.0, 15.0, 5.0 ), straight_x_axis },
+		{ "CurvedR20A30", curved( 20.0 * std::sqrt( 3.0 ) * 0.5, 10.0 ), curved_x_axis },
+		{ "CurvedOffset", curved( along_offset_line * cos60 - sin60, along_offset_line * sin60 + cos60 ), curved_x_axis },
+		{ "CurvedR10A0", curved( 10.0, 0.0 ), curved_x_axis },
+		{ "CurvedOutward", curved( 13.0, 0.0 ), curved_x_axis }
+	};
+
+	shared_ptr<GeometrySettings> geom_settings( new GeometrySettings() );
+	shared_ptr<RepresentationConverter> representation_converter( new RepresentationConverter( geom_settings, model->getUnitConverter() ) );
+	shared_ptr<PlacementConverter> placement_converter = representation_converter->getPlacementConverter();
+
+	const std::map<std::string, Placement> placements = getPlacements( placement_converter, products );
+	for( const ExpectedPlacement& expected : expected_placements )
+	{
+		auto it = placements.find( expected.name );
+		check( it != placements.end(), expected.name + ": not loaded" );
+		if( it == placements.end() )
+		{
+			continue;
+		}
+		const double deviation = ( it->second.position - expected.position ).length();
+		const double axis_deviation = ( it->second.x_axis - expected.x_axis ).length();
+		check( deviation < 1e-9, expected.name + ": position deviation " + std::to_string( deviation ) );
+		check( axis_deviation < 1e-9, expected.name + ": x axis deviation " + std::to_string( axis_deviation ) );
+	}
+
+	// cached, recomputed, and concurrently computed on a cleared cache
+	checkSamePlacements( getPlacements( placement_converter, products ), placements, "from the cache" );
+	placement_converter->getGridConverter()->clearGridCache();
+	checkSamePlacements( getPlacements( placement_converter, products ), placements, "after clearing the cache" );
+
+	placement_converter->getGridConverter()->clearGridCache();
+	std::vector<std::map<std::string, Placement> > thread_placements( 8 );
+	std::vector<std::thread> threads;
+	for( size_t ii = 0; ii < thread_placements.size(); ++ii )
+	{
+		threads.emplace_back( [&, ii]() { thread_placements[ii] = getPlacements( placement_converter, products ); } );
+	}
+	for( std::thread& thread : threads )
+	{
+		thread.join();
+	}
+	for( size_t ii = 0; ii < thread_placements.size(); ++ii )
+	{
+		checkSamePlacements( thread_placements[ii], placements, "in thread " + std::to_string( ii ) );
+	}
+
+	if( num_errors > 0 )
+	{
+		std::cout << num_errors << " checks failed" << std::endl;
+		return 1;
+	}
+	std::cout << "grid placements match the reference values" << std::endl;
+	return 0;
+}
@@ -0,0 +1,118 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+// Reads a STEP file, writes it with WriterJSON, reads the ifcJSON file with ReaderJSON and checks that each entity gives the same STEP line as before.
+// A few strings with apostrophes, quotes, a backslash and non-ASCII characters are set before writing, to check the escaping on both sides.
+
+#include <filesystem>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <ifcpp/model/BuildingModel.h>
+#include <ifcpp/reader/ReaderJSON.h>
+#include <ifcpp/reader/ReaderSTEP.h>
+#include <ifcpp/writer/WriterJSON.h>
+#include <IfcLabel.h>
+#include <IfcRoot.h>
+#include <IfcText.h>
+
+using namespace IFC4X3;
+
+static int num_errors = 0;
+
+static void check( bool condition, const std::string& message )
+{
+	if( !condition )
+	{
+		std::cout << "FAILED: " << message << std::endl;
+		++num_errors;
+	}
+}
+
+static std::string getStepLine( const shared_ptr<BuildingEntity>& entity )
+{
+	std::stringstream stream;
+	entity->getStepLine( stream, 15 );
+	return stream.str();
+}
+
+int main( int argc, char* argv[] )
+{
+	if( argc < 2 )
+	{
+		std::cout << "usage: JsonRoundTripTest IfcOpenHouse.ifc" << std::endl;
+		return 1;
+	}
+
+	shared_ptr<BuildingModel> model( new BuildingModel() );
+	shared_ptr<ReaderSTEP> reader( new ReaderSTEP() );
+	reader->loadModelFromFile( argv[1], model );
+	check( model->getMapIfcEntities().size() > 3000, "STEP file read" );
+
+	// strings that need escaping in STEP and JSON
+	const std::vector<std::string> names = { "Wall 'A' \"B\"\n2", "Gr\xC3\xB6\xC3\x9F" "e \xE2\x80\x93 1", "back\\slash" };
+	size_t name_index = 0;
+	for( auto& it : model->getMapIfcEntities() )
+	{
+		shared_ptr<IfcRoot> root = dynamic_pointer_cast<IfcRoot>( it.second );
+		if( root && name_index < names.size() )
+		{
+			root->m_Name = shared_ptr<IfcLabel>( new IfcLabel( names[name_index] ) );
+			root->m_Description = shared_ptr<IfcText>( new IfcText( names[name_index] ) );
+			++name_index;
+		}
+	}
+
+	const std::string json_path = ( std::filesystem::temp_directory_path() / "JsonRoundTripTest.json" ).string();
+	shared_ptr<WriterJSON> writer( new WriterJSON() );
+	writer->writeModelToFile( json_path, model );
+
+	shared_ptr<BuildingModel> model_json( new BuildingModel() );
+	shared_ptr<ReaderJSON> reader_json( new ReaderJSON() );
+	reader_json->loadModelFromFile( json_path, model_json );
+
+	const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map_json = model_json->getMapIfcEntities();
+	check( map_json.size() == model->getMapIfcEntities().size(), "same number of entities: " + std::to_string( model->getMapIfcEntities().size() ) + " and " + std::to_string( map_json.size() ) );
+
+	size_t num_different = 0;
+	for( auto& it : model->getMapIfcEntities() )
+	{
+		auto it_json = map_json.find( it.first );
+		if( it_json == map_json.end() )
+		{
+			check( false, "entity #" + std::to_string( it.first ) + " is missing" );
+			continue;
+		}
+		const std::string line = getStepLine( it.second );
+		const std::string line_json = getStepLine( it_json->second );
+		if( line != line_json && ++num_different <= 10 )
+		{
+			check( false, "different entity:\n  " + line + "\n  " + line_json );
+		}
+	}
+	check( num_different == 0, std::to_string( num_different ) + " entities are different" );
+
+	std::filesystem::remove( json_path );
+	if( num_errors > 0 )
+	{
+		std::cout << num_errors << " checks failed" << std::endl;
+		return 1;
+	}
+	return 0;
+}
@@ -306,7 +306,7 @@ private:
 		try
 		{
 			// 获取所有带几何的实体
-			const std::unordered_map<std::string, shared_ptr<ProductShapeData>>& map_entities =
+			const std::unordered_map<BinaryGuid, shared_ptr<ProductShapeData>>& map_entities =
 				m_geometryConverter->getShapeInputData();
 
 			LogInfo("Found " + std::to_string(map_entities.size()) + " entities with geometry");
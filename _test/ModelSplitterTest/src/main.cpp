@@ -0,0 +1,442 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+// Checks the entity reference table against getAttributes, the dependency closure of BuildingModel::collectDependentEntities, and the
+// subsets of ModelSplitter.
+// For every entity of the given model and of a generated one, IFC4X3::EntityReferences must give the entities of getAttributes and
+// getAttributesInverse, in the same order. The closure of each object must be the one found through getAttributes.
+// The generated model has three storeys with walls, an opening with a window, and an element assembly. A property set, a wall type
+// and a material are shared by the walls of all storeys. Each storey subset must contain its own objects and the spatial structure
+// above it, but no objects of other storeys. Shared relationships must be copies that refer only to the subset. Every entity that a
+// subset entity refers to must be in the subset. The subsets are written to files and read back.
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <ifcpp/IFC4X3/EntityReferences.h>
+#include <ifcpp/IFC4X3/include/IfcElementAssembly.h>
+#include <ifcpp/IFC4X3/include/IfcGloballyUniqueId.h>
+#include <ifcpp/IFC4X3/include/IfcLabel.h>
+#include <ifcpp/IFC4X3/include/IfcObjectDefinition.h>
+#include <ifcpp/IFC4X3/include/IfcRelAggregates.h>
+#include <ifcpp/IFC4X3/include/IfcRelDefinesByProperties.h>
+#include <ifcpp/IFC4X3/include/IfcRoot.h>
+#include <ifcpp/model/AttributeObject.h>
+#include <ifcpp/model/BuildingGuid.h>
+#include <ifcpp/model/BuildingModel.h>
+#include <ifcpp/reader/ReaderSTEP.h>
+#include <ifcpp/writer/ModelSplitter.h>
+
+static int num_errors = 0;
+
+static void check( bool condition, const std::string& message )
+{
+	if( !condition )
+	{
+		std::cout << "FAILED: " << message << std::endl;
+		++num_errors;
+	}
+}
+
+// entities in an attribute value, also in nested lists, as collectDependentEntities found them before the reference table
+static void addAttributeEntities( const shared_ptr<BuildingObject>& attribute, std::vector<BuildingEntity*>& entities )
+{
+	shared_ptr<AttributeObjectVector> attribute_vector = dynamic_pointer_cast<AttributeObjectVector>( attribute );
+	if( attribute_vector )
+	{
+		for( const shared_ptr<BuildingObject>& item : attribute_vector->m_vec )
+		{
+			addAttributeEntities( item, entities );
+		}
+		return;
+	}
+	BuildingEntity* entity = dynamic_cast<BuildingEntity*>( attribute.get() );
+	if( entity )
+	{
+		entities.push_back( entity );
+	}
+}
+
+static std::vector<BuildingEntity*> getAttributeEntities( const shared_ptr<BuildingEntity>& entity, bool inverse )
+{
+	std::vector<std::pair<std::string, shared_ptr<BuildingObject> > > vec_attributes;
+	if( inverse )
+	{
+		entity->getAttributesInverse( vec_attributes );
+	}
+	else
+	{
+		entity->getAttributes( vec_attributes );
+	}
+	std::vector<BuildingEntity*> entities;
+	for( auto& it : vec_attributes )
+	{
+		addAttributeEntities( it.second, entities );
+	}
+	return entities;
+}
+
+class ReferenceList : public IFC4X3::EntityReferenceVisitor
+{
+public:
+	bool visitReference( BuildingEntity* entity ) override
+	{
+		m_entities.push_back( entity );
+		return false;
+	}
+
+	void keepReference( const shared_ptr<BuildingEntity>& ) override
+	{
+	}
+
+	std::vector<BuildingEntity*> m_entities;
+};
+
+static void checkReferenceTable( const shared_ptr<BuildingModel>& model, const std::string& name )
+{
+	std::set<uint32_t> class_ids;
+	size_t num_references = 0;
+	size_t num_different = 0;
+	for( auto& it : model->getMapIfcEntities() )
+	{
+		const shared_ptr<BuildingEntity>& entity = it.second;
+		class_ids.insert( entity->classID() );
+		for( bool inverse : { false, true } )
+		{
+			ReferenceList references;
+			const bool in_table = inverse ? IFC4X3::EntityReferences::forEachInverseReference( entity.get(), references ) : IFC4X3::EntityReferences::forEachReference( entity.get(), references );
+			const std::vector<BuildingEntity*> expected = getAttributeEntities( entity, inverse );
+			num_references += expected.size();
+			if( ( !in_table || references.m_entities != expected ) && ++num_different <= 5 )
+			{
+				check( false, name + ": " + std::string( inverse ? "inverse " : "" ) + "references of #" + std::to_string( entity->m_tag ) + " differ from getAttributes" );
+			}
+		}
+	}
+	check( num_different == 0, name + ": " + std::to_string( num_different ) + " entities with different references" );
+	std::cout << name << ": references of " << model->getMapIfcEntities().size() << " entities of " << class_ids.size() << " classes, " << num_references << " references" << std::endl;
+}
+
+// closure through getAttributes, and through the decomposition of element assemblies, which collectDependentEntities also follows
+static std::unordered_set<BuildingEntity*> getReferenceClosure( const shared_ptr<BuildingEntity>& root )
+{
+	std::unordered_set<BuildingEntity*> closure = { root.get() };
+	std::vector<BuildingEntity*> stack = { root.get() };
+	while( !stack.empty() )
+	{
+		BuildingEntity* entity = stack.back();
+		stack.pop_back();
+		std::vector<std::pair<std::string, shared_ptr<BuildingObject> > > vec_attributes;
+		entity->getAttributes( vec_attributes );
+		std::vector<BuildingEntity*> references;
+		for( auto& it : vec_attributes )
+		{
+			addAttributeEntities( it.second, references );
+		}
+		IFC4X3::IfcElementAssembly* assembly = dynamic_cast<IFC4X3::IfcElementAssembly*>( entity );
+		if( assembly )
+		{
+			for( const weak_ptr<IFC4X3::IfcRelAggregates>& is_decomposed_by : assembly->m_IsDecomposedBy_inverse )
+			{
+				shared_ptr<IFC4X3::IfcRelAggregates> rel_aggregates = is_decomposed_by.lock();
+				if( rel_aggregates )
+				{
+					references.push_back( rel_aggregates.get() );
+				}
+			}
+		}
+		for( BuildingEntity* reference : references )
+		{
+			if( closure.insert( reference ).second )
+			{
+				stack.push_back( reference );
+			}
+		}
+	}
+	return closure;
+}
+
+static void checkClosures( const shared_ptr<BuildingModel>& model, const std::string& name )
+{
+	size_t num_different = 0;
+	for( auto& it : model->getMapIfcEntities() )
+	{
+		std::unordered_map<BuildingEntity*, shared_ptr<BuildingEntity> > map_closure;
+		BuildingModel::collectDependentEntities( { it.second }, map_closure );
+		std::unordered_set<BuildingEntity*> closure;
+		for( auto& it_closure : map_closure )
+		{
+			closure.insert( it_closure.first );
+		}
+		if( closure != getReferenceClosure( it.second ) && ++num_different <= 5 )
+		{
+			check( false, name + ": closure of #" + std::to_string( it.second->m_tag ) + " differs" );
+		}
+	}
+	check( num_different == 0, name + ": " + std::to_string( num_different ) + " closures differ" );
+}
+
+static void writeStoreyModel( const std::string& file_path )
+{
+	std::ofstream stream( file_path );
+	stream << "ISO-10303-21;\nHEADER;\nFILE_DESCRIPTION((''),'2;1');\nFILE_NAME('','',(''),(''),'','','');\nFILE_SCHEMA(('IFC4X3_ADD2'));\nENDSEC;\nDATA;\n";
+	stream << "#1=IFCSIUNIT(*,.LENGTHUNIT.,$,.METRE.);\n#2=IFCUNITASSIGNMENT((#1));\n";
+	stream << "#3=IFCCARTESIANPOINT((0.,0.,0.));\n#4=IFCAXIS2PLACEMENT3D(#3,$,$);\n";
+	stream << "#5=IFCGEOMETRICREPRESENTATIONCONTEXT($,'Model',3,1.E-05,#4,$);\n";
+	stream << "#6=IFCPROJECT('" << createBase64Uuid() << "',$,'Project',$,$,$,$,(#5),#2);\n";
+	stream << "#7=IFCLOCALPLACEMENT($,#4);\n";
+	stream << "#8=IFCSITE('" << createBase64Uuid() << "',$,'Site',$,$,#7,$,$,$,$,$,$,$,$);\n";
+	stream << "#9=IFCBUILDING('" << createBase64Uuid() << "',$,'Building',$,$,#7,$,$,$,$,$,$);\n";
+	stream << "#10=IFCRELAGGREGATES('" << createBase64Uuid() << "',$,$,$,#6,(#8));\n";
+	stream << "#11=IFCRELAGGREGATES('" << createBase64Uuid() << "',$,$,$,#8,(#9));\n";
+	stream << "#12=IFCRECTANGLEPROFILEDEF(.AREA.,$,$,4.,0.2);\n#13=IFCDIRECTION((0.,0.,1.));\n#14=IFCEXTRUDEDAREASOLID(#12,$,#13,3.);\n";
+	stream << "#15=IFCSHAPEREPRESENTATION(#5,'Body','SweptSolid',(#14));\n";
+	stream << "#16=IFCPROPERTYSINGLEVALUE('FireRating',$,IFCLABEL('F90'),$);\n";
+	stream << "#17=IFCPROPERTYSET('" << createBase64Uuid() << "',$,'Pset_WallCommon',$,(#16));\n";
+	stream << "#18=IFCWALLTYPE('" << createBase64Uuid() << "',$,'Wall type',$,$,$,$,$,$,.STANDARD.);\n";
+	stream << "#19=IFCMATERIAL('Concrete',$,$);\n";
+
+	int tag = 100;
+	std::vector<int> storeys;
+	std::vector<int> all_walls;
+	for( int storey_index = 0; storey_index < 3; ++storey_index )
+	{
+		const std::string storey_name = std::to_string( storey_index );
+		const int storey_point = tag++;
+		stream << "#" << storey_point << "=IFCCARTESIANPOINT((0.,0.," << 3.0 * storey_index << "));\n";
+		stream << "#" << tag << "=IFCAXIS2PLACEMENT3D(#" << storey_point << ",$,$);\n";
+		stream << "#" << tag + 1 << "=IFCLOCALPLACEMENT(#7,#" << tag << ");\n";
+		const int storey_placement = tag + 1;
+		const int storey = tag + 2;
+		stream << "#" << storey << "=IFCBUILDINGSTOREY('" << createBase64Uuid() << "',$,'Storey " << storey_name << "',$,$,#" << storey_placement << ",$,$,$,$);\n";
+		storeys.push_back( storey );
+		tag += 3;
+
+		std::vector<int> contained;
+		for( int wall_index = 0; wall_index < 4; ++wall_index )
+		{
+			stream << "#" << tag << "=IFCCARTESIANPOINT((" << 5.0 * wall_index << ",0.,0.));\n";
+			stream << "#" << tag + 1 << "=IFCAXIS2PLACEMENT3D(#" << tag << ",$,$);\n";
+			stream << "#" << tag + 2 << "=IFCLOCALPLACEMENT(#" << storey_placement << ",#" << tag + 1 << ");\n";
+			stream << "#" << tag + 3 << "=IFCPRODUCTDEFINITIONSHAPE($,$,(#15));\n";
+			stream << "#" << tag + 4 << "=IFCWALL('" << createBase64Uuid() << "',$,'Wall " << storey_name << "-" << wall_index << "',$,$,#" << tag + 2 << ",#" << tag + 3 << ",$,$);\n";
+			contained.push_back( tag + 4 );
+			all_walls.push_back( tag + 4 );
+			tag += 5;
+		}
+
+		// opening in the first wall, filled by a window
+		const int first_wall = contained.front();
+		stream << "#" << tag << "=IFCLOCALPLACEMENT(#" << first_wall - 2 << ",#4);\n";
+		stream << "#" << tag + 1 << "=IFCOPENINGELEMENT('" << createBase64Uuid() << "',$,'Opening " << storey_name << "',$,$,#" << tag << ",$,$,$);\n";
+		stream << "#" << tag + 2 << "=IFCRELVOIDSELEMENT('" << createBase64Uuid() << "',$,$,$,#" << first_wall << ",#" << tag + 1 << ");\n";
+		stream << "#" << tag + 3 << "=IFCWINDOW('" << createBase64Uuid() << "',$,'Window " << storey_name << "',$,$,#" << tag << ",$,$,1.,1.,$,$,$);\n";
+		stream << "#" << tag + 4 << "=IFCRELFILLSELEMENT('" << createBase64Uuid() << "',$,$,$,#" << tag + 1 << ",#" << tag + 3 << ");\n";
+		contained.push_back( tag + 3 );
+		tag += 5;
+
+		// element assembly of two beams
+		stream << "#" << tag << "=IFCELEMENTASSEMBLY('" << createBase64Uuid() << "',$,'Assembly " << storey_name << "',$,$,#" << storey_placement << ",$,$,$,$);\n";
+		stream << "#" << tag + 1 << "=IFCBEAM('" << createBase64Uuid() << "',$,'Beam " << storey_name << "-0',$,$,#" << storey_placement << ",$,$,$);\n";
+		stream << "#" << tag + 2 << "=IFCBEAM('" << createBase64Uuid() << "',$,'Beam " << storey_name << "-1',$,$,#" << storey_placement << ",$,$,$);\n";
+		stream << "#" << tag + 3 << "=IFCRELAGGREGATES('" << createBase64Uuid() << "',$,$,$,#" << tag << ",(#" << tag + 1 << ",#" << tag + 2 << "));\n";
+		contained.push_back( tag );
+		tag += 4;
+
+		std::string contained_list;
+		for( int element : contained )
+		{
+			contained_list += ( contained_list.empty() ? "#" : ",#" ) + std::to_string( element );
+		}
+		stream << "#" << tag++ << "=IFCRELCONTAINEDINSPATIALSTRUCTURE('" << createBase64Uuid() << "',$,$,$,(" << contained_list << "),#" << storey << ");\n";
+	}
+
+	std::string storey_list;
+	for( int storey : storeys )
+	{
+		storey_list += ( storey_list.empty() ? "#" : ",#" ) + std::to_string( storey );
+	}
+	std::string wall_list;
+	for( int wall : all_walls )
+	{
+		wall_list += ( wall_list.empty() ? "#" : ",#" ) + std::to_string( wall );
+	}
+	stream << "#" << tag++ << "=IFCRELAGGREGATES('" << createBase64Uuid() << "',$,$,$,#9,(" << storey_list << "));\n";
+	stream << "#" << tag++ << "=IFCRELDEFINESBYPROPERTIES('" << createBase64Uuid() << "',$,$,$,(" << wall_list << "),#17);\n";
+	stream << "#" << tag++ << "=IFCRELDEFINESBYTYPE('" << createBase64Uuid() << "',$,$,$,(" << wall_list << "),#18);\n";
+	stream << "#" << tag++ << "=IFCRELASSOCIATESMATERIAL('" << createBase64Uuid() << "',$,$,$,(" << wall_list << "),#19);\n";
+	stream << "ENDSEC;\nEND-ISO-10303-21;\n";
+}
+
+static std::set<std::string> getObjectNames( const shared_ptr<BuildingModel>& model )
+{
+	std::set<std::string> names;
+	for( auto& it : model->getMapIfcEntities() )
+	{
+		shared_ptr<IFC4X3::IfcRoot> root = dynamic_pointer_cast<IFC4X3::IfcRoot>( it.second );
+		if( root && root->m_Name && dynamic_pointer_cast<IFC4X3::IfcObjectDefinition>( root ) )
+		{
+			names.insert( root->m_Name->m_value );
+		}
+	}
+	return names;
+}
+
+// every entity that a subset entity refers to is in the subset, as the same object or as a copy with the same tag
+static bool isClosed( const shared_ptr<BuildingModel>& subset_model )
+{
+	const auto& map_entities = subset_model->getMapIfcEntities();
+	for( auto& it : map_entities )
+	{
+		for( BuildingEntity* reference : getAttributeEntities( it.second, false ) )
+		{
+			if( map_entities.find( reference->m_tag ) == map_entities.end() )
+			{
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+static void checkStoreySubsets( const std::string& file_path, const std::string& output_directory )
+{
+	shared_ptr<BuildingModel> model( new BuildingModel() );
+	shared_ptr<ReaderSTEP> reader( new ReaderSTEP() );
+	reader->loadModelFromFile( file_path, model );
+	checkReferenceTable( model, "generated" );
+	checkClosures( model, "generated" );
+
+	ModelSplitter splitter;
+	const std::vector<ModelSplitter::Subset> subsets = ModelSplitter::createSubsetsPerStorey( model );
+	check( subsets.size() == 3, "3 storey subsets, got " + std::to_string( subsets.size() ) );
+	std::vector<shared_ptr<BuildingModel> > subset_models;
+	splitter.createSubsetModels( model, subsets, subset_models );
+	check( subset_models.size() == subsets.size(), "one model per subset" );
+
+	for( size_t ii = 0; ii < subset_models.size() && ii < 3; ++ii )
+	{
+		const shared_ptr<BuildingModel>& subset_model = subset_models[ii];
+		const std::string label = "subset " + subsets[ii].m_name;
+		const std::string storey = subsets[ii].m_name.substr( subsets[ii].m_name.size() - 1 );
+		check( subsets[ii].m_name == "Storey_" + storey, label + ": name" );
+
+		std::set<std::string> expected_names = { "Project", "Site", "Building", "Storey " + storey, "Opening " + storey, "Window " + storey, "Assembly " + storey, "Beam " + storey + "-0",
+			"Beam " + storey + "-1", "Wall type" };
+		for( int wall_index = 0; wall_index < 4; ++wall_index )
+		{
+			expected_names.insert( "Wall " + storey + "-" + std::to_string( wall_index ) );
+		}
+		const std::set<std::string> names = getObjectNames( subset_model );
+		check( names == expected_names, label + ": " + std::to_string( names.size() ) + " objects, expected " + std::to_string( expected_names.size() ) );
+		check( isClosed( subset_model ), label + ": refers to entities outside of the subset" );
+
+		// the property relationship is a copy with the walls of this storey only
+		size_t num_property_relationships = 0;
+		for( auto& it : subset_model->getMapIfcEntities() )
+		{
+			shared_ptr<IFC4X3::IfcRelDefinesByProperties> rel = dynamic_pointer_cast<IFC4X3::IfcRelDefinesByProperties>( it.second );
+			if( rel )
+			{
+				++num_property_relationships;
+				check( rel->m_RelatedObjects.size() == 4 && rel != model->getMapIfcEntities().at( rel->m_tag ), label + ": property relationship is not filtered" );
+			}
+		}
+		check( num_property_relationships == 1, label + ": " + std::to_string( num_property_relationships ) + " property relationships" );
+	}
+
+	// written and read back, with the same entities
+	const size_t num_written = splitter.writeSubsetFiles( model, subsets, output_directory );
+	check( num_written == subsets.size(), std::to_string( num_written ) + " subset files written" );
+	for( size_t ii = 0; ii < subset_models.size(); ++ii )
+	{
+		shared_ptr<BuildingModel> model_read( new BuildingModel() );
+		shared_ptr<ReaderSTEP> reader_subset( new ReaderSTEP() );
+		size_t num_reader_errors = 0;
+		reader_subset->setMessageCallBack( [&]( shared_ptr<StatusCallback::Message> message ) {
+				if( message->m_message_type == StatusCallback::MESSAGE_TYPE_ERROR || message->m_message_type == StatusCallback::MESSAGE_TYPE_WARNING )
+				{
+					++num_reader_errors;
+				}
+			} );
+		reader_subset->loadModelFromFile( ( std::filesystem::path( output_directory ) / ( subsets[ii].m_name + ".ifc" ) ).string(), model_read );
+		const std::string label = "file " + subsets[ii].m_name;
+		check( num_reader_errors == 0, label + ": " + std::to_string( num_reader_errors ) + " errors while reading" );
+		check( model_read->getMapIfcEntities().size() == subset_models[ii]->getMapIfcEntities().size(), label + ": " + std::to_string( model_read->getMapIfcEntities().size() ) + " entities read, "
+			+ std::to_string( subset_models[ii]->getMapIfcEntities().size() ) + " written" );
+		check( getObjectNames( model_read ) == getObjectNames( subset_models[ii] ), label + ": objects differ after reading" );
+	}
+
+	// walls of two storeys, with the spatial structure of both
+	std::vector<std::string> guids;
+	for( auto& it : model->getMapIfcEntities() )
+	{
+		shared_ptr<IFC4X3::IfcRoot> root = dynamic_pointer_cast<IFC4X3::IfcRoot>( it.second );
+		if( root && root->m_Name && ( root->m_Name->m_value == "Wall 0-1" || root->m_Name->m_value == "Wall 2-3" ) )
+		{
+			guids.push_back( root->m_GlobalId->m_value );
+		}
+	}
+	const ModelSplitter::Subset guid_subset = ModelSplitter::createSubsetFromGuids( model, "walls", guids );
+	check( guid_subset.m_roots.size() == 2, "GUID subset has " + std::to_string( guid_subset.m_roots.size() ) + " roots" );
+	splitter.createSubsetModels( model, { guid_subset }, subset_models );
+	if( subset_models.size() == 1 && subset_models[0] )
+	{
+		const std::set<std::string> expected_names = { "Project", "Site", "Building", "Storey 0", "Storey 2", "Wall 0-1", "Wall 2-3", "Wall type" };
+		check( getObjectNames( subset_models[0] ) == expected_names, "GUID subset: objects" );
+		check( isClosed( subset_models[0] ), "GUID subset: refers to entities outside of the subset" );
+	}
+	else
+	{
+		check( false, "GUID subset: no model" );
+	}
+}
+
+int main( int argc, char* argv[] )
+{
+	if( argc < 2 )
+	{
+		std::cout << "usage: ModelSplitterTest IfcOpenHouse.ifc" << std::endl;
+		return 1;
+	}
+
+	shared_ptr<BuildingModel> model( new BuildingModel() );
+	shared_ptr<ReaderSTEP> reader( new ReaderSTEP() );
+	reader->loadModelFromFile( argv[1], model );
+	checkReferenceTable( model, "IfcOpenHouse" );
+	checkClosures( model, "IfcOpenHouse" );
+
+	const std::filesystem::path directory = std::filesystem::temp_directory_path() / "ModelSplitterTest";
+	std::filesystem::create_directories( directory );
+	const std::string file_path = ( directory / "storeys.ifc" ).string();
+	writeStoreyModel( file_path );
+	checkStoreySubsets( file_path, ( directory / "subsets" ).string() );
+	std::filesystem::remove_all( directory );
+
+	if( num_errors > 0 )
+	{
+		std::cout << num_errors << " checks failed" << std::endl;
+		return 1;
+	}
+	return 0;
+}
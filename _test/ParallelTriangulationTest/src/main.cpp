@@ -0,0 +1,367 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+// Converts models with the face lists triangulated in one sequential loop, and in parallel chunks of several sizes
+// (GeometrySettings::m_minNumFacesParallelTriangulation and m_numFacesPerTriangulationChunk). The chunks are welded in face order,
+// so all meshes must be identical: the same vertices in the same order, and the same faces with the same vertices.
+// Models: the given file, and a generated one with a faceted brep of a subdivided cube, where some faces have their own points,
+// slightly moved, and an open terrain with non-planar quads, triangles, faces with holes and degenerate faces.
+
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <ifcpp/model/BuildingGuid.h>
+#include <ifcpp/model/BuildingModel.h>
+#include <ifcpp/reader/ReaderSTEP.h>
+#include <ifcpp/geometry/GeometryConverter.h>
+
+static int num_errors = 0;
+
+static void check( bool condition, const std::string& message )
+{
+	if( !condition )
+	{
+		std::cout << "FAILED: " << message << std::endl;
+		++num_errors;
+	}
+}
+
+class FaceWriter
+{
+public:
+	FaceWriter( std::ofstream& stream, int first_tag ) : m_stream( stream ), m_tag( first_tag ) {}
+
+	int writePoint( double x, double y, double z )
+	{
+		m_stream << "#" << m_tag << "=IFCCARTESIANPOINT((" << x << "," << y << "," << z << "));\n";
+		return m_tag++;
+	}
+
+	// face with an outer loop and optional inner loops, all given as point tags
+	int writeFace( const std::vector<std::vector<int> >& loops )
+	{
+		std::vector<int> bounds;
+		for( size_t ii = 0; ii < loops.size(); ++ii )
+		{
+			m_stream << "#" << m_tag << "=IFCPOLYLOOP(" << tagList( loops[ii] ) << ");\n";
+			m_stream << "#" << m_tag + 1 << ( ii == 0 ? "=IFCFACEOUTERBOUND(#" : "=IFCFACEBOUND(#" ) << m_tag << ",.T.);\n";
+			bounds.push_back( m_tag + 1 );
+			m_tag += 2;
+		}
+		m_stream << "#" << m_tag << "=IFCFACE(" << tagList( bounds ) << ");\n";
+		return m_tag++;
+	}
+
+	// product with one body item, which is written by the caller with the returned tag
+	int writeProduct( const std::string& name, const std::string& item_type, const std::string& item_arguments )
+	{
+		const int item = m_tag++;
+		m_stream << "#" << item << "=" << item_type << "(" << item_arguments << ");\n";
+		m_stream << "#" << m_tag << "=IFCSHAPEREPRESENTATION(#5,'Body','Brep',(#" << item << "));\n";
+		m_stream << "#" << m_tag + 1 << "=IFCPRODUCTDEFINITIONSHAPE($,$,(#" << m_tag << "));\n";
+		m_stream << "#" << m_tag + 2 << "=IFCBUILDINGELEMENTPROXY('" << createBase64Uuid() << "',$,'" << name << "',$,$,#8,#" << m_tag + 1 << ",$,$);\n";
+		m_tag += 3;
+		return item;
+	}
+
+	int nextTag() { return m_tag++; }
+
+	static std::string tagList( const std::vector<int>& tags )
+	{
+		std::string list = "(";
+		for( size_t ii = 0; ii < tags.size(); ++ii )
+		{
+			list += ( ii > 0 ? ",#" : "#" ) + std::to_string( tags[ii] );
+		}
+		return list + ")";
+	}
+
+private:
+	std::ofstream& m_stream;
+	int m_tag;
+};
+
+static void writeFaceListModel( const std::string& file_path )
+{
+	std::ofstream stream( file_path );
+	stream << std::setprecision( 17 );
+	stream << "ISO-10303-21;\nHEADER;\nFILE_DESCRIPTION((''),'2;1');\nFILE_NAME('','',(''),(''),'','','');\nFILE_SCHEMA(('IFC4X3_ADD2'));\nENDSEC;\nDATA;\n";
+	stream << "#1=IFCSIUNIT(*,.LENGTHUNIT.,$,.METRE.);\n#2=IFCUNITASSIGNMENT((#1));\n";
+	stream << "#3=IFCCARTESIANPOINT((0.,0.,0.));\n#4=IFCAXIS2PLACEMENT3D(#3,$,$);\n";
+	stream << "#5=IFCGEOMETRICREPRESENTATIONCONTEXT($,'Model',3,1.E-05,#4,$);\n";
+	stream << "#6=IFCPROJECT('" << createBase64Uuid() << "',$,'Face lists',$,$,$,$,(#5),#2);\n";
+	stream << "#8=IFCLOCALPLACEMENT($,#4);\n";
+
+	std::mt19937 random( 5220 );
+	std::uniform_real_distribution<double> jitter( -1e-7, 1e-7 );
+	FaceWriter writer( stream, 10 );
+
+	// cube of num_cells x num_cells quads per side. Every 5th face has its own points, moved by less than the welding distance
+	const int num_cells = 20;
+	std::map<std::vector<int>, int> cube_points;
+	auto cubePoint = [&]( int x, int y, int z, bool own_point )
+	{
+		if( own_point )
+		{
+			return writer.writePoint( x + jitter( random ), y + jitter( random ), z + jitter( random ) );
+		}
+		auto it = cube_points.find( { x, y, z } );
+		if( it != cube_points.end() )
+		{
+			return it->second;
+		}
+		return cube_points[{ x, y, z }] = writer.writePoint( x, y, z );
+	};
+	std::vector<int> cube_faces;
+	for( int axis = 0; axis < 3; ++axis )
+	{
+		for( int side = 0; side < 2; ++side )
+		{
+			for( int ii = 0; ii < num_cells; ++ii )
+			{
+				for( int jj = 0; jj < num_cells; ++jj )
+				{
+					const bool own_points = cube_faces.size() % 5 == 0;
+					std::vector<int> loop;
+					for( int corner : { 0, 1, 3, 2 } )
+					{
+						int coordinates[3];
+						coordinates[axis] = side * num_cells;
+						coordinates[( axis + 1 ) % 3] = ii + ( corner & 1 );
+						coordinates[( axis + 2 ) % 3] = jj + ( corner >> 1 );
+						loop.push_back( cubePoint( coordinates[0], coordinates[1], coordinates[2], own_points ) );
+					}
+					if( side == 0 )
+					{
+						std::reverse( loop.begin(), loop.end() );
+					}
+					cube_faces.push_back( writer.writeFace( { loop } ) );
+				}
+			}
+		}
+	}
+	const int closed_shell = writer.nextTag();
+	stream << "#" << closed_shell << "=IFCCLOSEDSHELL(" << FaceWriter::tagList( cube_faces ) << ");\n";
+	writer.writeProduct( "Cube", "IFCFACETEDBREP", "#" + std::to_string( closed_shell ) );
+
+	// terrain of num_terrain_cells x num_terrain_cells cells
+	const int num_terrain_cells = 100;
+	std::vector<int> terrain_points;
+	for( int ii = 0; ii <= num_terrain_cells; ++ii )
+	{
+		for( int jj = 0; jj <= num_terrain_cells; ++jj )
+		{
+			terrain_points.push_back( writer.writePoint( ii, jj, std::sin( 0.13 * ii ) * std::cos( 0.07 * jj ) * 5.0 ) );
+		}
+	}
+	std::vector<int> terrain_faces;
+	for( int ii = 0; ii < num_terrain_cells; ++ii )
+	{
+		for( int jj = 0; jj < num_terrain_cells; ++jj )
+		{
+			const int p0 = terrain_points[ii * ( num_terrain_cells + 1 ) + jj];
+			const int p1 = terrain_points[( ii + 1 ) * ( num_terrain_cells + 1 ) + jj];
+			const int p2 = terrain_points[( ii + 1 ) * ( num_terrain_cells + 1 ) + jj + 1];
+			const int p3 = terrain_points[ii * ( num_terrain_cells + 1 ) + jj + 1];
+			const int cell = ii * num_terrain_cells + jj;
+			if( cell % 97 == 0 )
+			{
+				// degenerate: a point in the middle of an edge
+				const int middle = writer.writePoint( ii + 0.5, jj, std::sin( 0.13 * ii ) * std::cos( 0.07 * jj ) * 5.0 );
+				terrain_faces.push_back( writer.writeFace( { { p0, middle, p1 } } ) );
+				terrain_faces.push_back( writer.writeFace( { { p0, p1, p2, p3 } } ) );
+			}
+			else if( cell % 7 == 3 )
+			{
+				// hole in the middle of the cell, in the plane of its first three corners
+				std::vector<int> hole;
+				for( const std::pair<double, double>& corner : { std::make_pair( 0.3, 0.3 ), std::make_pair( 0.3, 0.7 ), std::make_pair( 0.7, 0.7 ), std::make_pair( 0.7, 0.3 ) } )
+				{
+					const double z0 = std::sin( 0.13 * ii ) * std::cos( 0.07 * jj ) * 5.0;
+					const double z1 = std::sin( 0.13 * ( ii + 1 ) ) * std::cos( 0.07 * jj ) * 5.0;
+					const double z2 = std::sin( 0.13 * ( ii + 1 ) ) * std::cos( 0.07 * ( jj + 1 ) ) * 5.0;
+					hole.push_back( writer.writePoint( ii + corner.first, jj + corner.second, z0 + corner.first * ( z1 - z0 ) + corner.second * ( z2 - z1 ) ) );
+				}
+				terrain_faces.push_back( writer.writeFace( { { p0, p1, p2, p3 }, hole } ) );
+			}
+			else if( cell % 3 == 0 )
+			{
+				terrain_faces.push_back( writer.writeFace( { { p0, p1, p2 } } ) );
+				terrain_faces.push_back( writer.writeFace( { { p0, p2, p3 } } ) );
+			}
+			else
+			{
+				terrain_faces.push_back( writer.writeFace( { { p0, p1, p2, p3 } } ) );
+			}
+		}
+	}
+	const int open_shell = writer.nextTag();
+	stream << "#" << open_shell << "=IFCOPENSHELL(" << FaceWriter::tagList( terrain_faces ) << ");\n";
+	writer.writeProduct( "Terrain", "IFCSHELLBASEDSURFACEMODEL", "(#" + std::to_string( open_shell ) + ")" );
+	stream << "ENDSEC;\nEND-ISO-10303-21;\n";
+}
+
+// vertices of the meshes in storage order, and the vertex indices of each face, of all items of a product
+struct MeshData
+{
+	std::vector<double> vertices;
+	std::vector<size_t> faces;
+
+	bool equals( const MeshData& other, double tolerance ) const
+	{
+		if( vertices.size() != other.vertices.size() || faces != other.faces )
+		{
+			return false;
+		}
+		for( size_t ii = 0; ii < vertices.size(); ++ii )
+		{
+			if( std::abs( vertices[ii] - other.vertices[ii] ) > tolerance )
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+};
+
+static void addMeshSet( const shared_ptr<carve::mesh::MeshSet<3> >& meshset, MeshData& data )
+{
+	const size_t first_vertex = data.vertices.size() / 3;
+	for( const carve::mesh::Vertex<3>& vertex : meshset->vertex_storage )
+	{
+		data.vertices.insert( data.vertices.end(), { vertex.v.x, vertex.v.y, vertex.v.z } );
+	}
+	for( carve::mesh::Mesh<3>* mesh : meshset->meshes )
+	{
+		for( carve::mesh::Face<3>* face : mesh->faces )
+		{
+			data.faces.push_back( face->n_edges );
+			carve::mesh::Edge<3>* edge = face->edge;
+			do
+			{
+				data.faces.push_back( first_vertex + ( edge->vert - &meshset->vertex_storage[0] ) );
+				edge = edge->next;
+			} while( edge != face->edge );
+		}
+	}
+}
+
+static void addItem( const shared_ptr<ItemShapeData>& item, MeshData& data )
+{
+	for( const shared_ptr<carve::mesh::MeshSet<3> >& meshset : item->m_meshsets )
+	{
+		addMeshSet( meshset, data );
+	}
+	for( const shared_ptr<carve::mesh::MeshSet<3> >& meshset : item->m_meshsets_open )
+	{
+		addMeshSet( meshset, data );
+	}
+	for( const shared_ptr<ItemShapeData>& child_item : item->m_child_items )
+	{
+		addItem( child_item, data );
+	}
+}
+
+// meshes of all products, by GUID
+static std::map<std::string, MeshData> convertModel( const std::string& file_path, size_t min_num_faces_parallel, size_t num_faces_per_chunk )
+{
+	shared_ptr<BuildingModel> model( new BuildingModel() );
+	shared_ptr<ReaderSTEP> reader( new ReaderSTEP() );
+	reader->loadModelFromFile( file_path, model );
+
+	shared_ptr<GeometrySettings> geom_settings( new GeometrySettings() );
+	geom_settings->m_minNumFacesParallelTriangulation = min_num_faces_parallel;
+	geom_settings->m_numFacesPerTriangulationChunk = num_faces_per_chunk;
+	shared_ptr<GeometryConverter> geometry_converter( new GeometryConverter( model, geom_settings ) );
+	geometry_converter->convertGeometry();
+
+	std::map<std::string, MeshData> meshes;
+	for( auto& it : geometry_converter->getShapeInputData() )
+	{
+		if( !it.second )
+		{
+			continue;
+		}
+		MeshData& data = meshes[it.second->m_entity_guid];
+		for( const shared_ptr<ItemShapeData>& item : it.second->getGeometricItems() )
+		{
+			addItem( item, data );
+		}
+	}
+	return meshes;
+}
+
+static void checkModel( const std::string& file_path, const std::string& name, size_t min_num_faces, double tolerance )
+{
+	const std::map<std::string, MeshData> sequential = convertModel( file_path, std::numeric_limits<size_t>::max(), 4000 );
+	size_t num_faces = 0;
+	for( auto& it : sequential )
+	{
+		num_faces += it.second.faces.size() / 4;
+	}
+	check( num_faces >= min_num_faces, name + ": " + std::to_string( num_faces ) + " faces" );
+
+	for( size_t num_faces_per_chunk : { 1, 7, 1000 } )
+	{
+		const std::map<std::string, MeshData> chunked = convertModel( file_path, 0, num_faces_per_chunk );
+		const std::string label = name + ", chunks of " + std::to_string( num_faces_per_chunk ) + " faces";
+		check( chunked.size() == sequential.size(), label + ": different products" );
+		size_t num_different = 0;
+		for( auto& it : sequential )
+		{
+			auto it_chunked = chunked.find( it.first );
+			if( ( it_chunked == chunked.end() || !it_chunked->second.equals( it.second, tolerance ) ) && ++num_different <= 5 )
+			{
+				check( false, label + ": meshes of product " + it.first + " differ from the sequential loop" );
+			}
+		}
+		check( num_different == 0, label + ": " + std::to_string( num_different ) + " products differ" );
+	}
+}
+
+int main( int argc, char* argv[] )
+{
+	if( argc < 2 )
+	{
+		std::cout << "usage: ParallelTriangulationTest IfcOpenHouse.ifc" << std::endl;
+		return 1;
+	}
+
+	// the vertices of walls with openings can differ in the last bit from one conversion to the next, also with the sequential loop
+	checkModel( argv[1], "IfcOpenHouse", 100, 1e-12 );
+
+	const std::string file_path = ( std::filesystem::temp_directory_path() / "ParallelTriangulationTest.ifc" ).string();
+	writeFaceListModel( file_path );
+	// the faces are triangulated, so there are more triangles than faces: 2400 of the cube, more than 10000 of the terrain
+	checkModel( file_path, "generated", 2400 * 2 + 10000, 0.0 );
+	std::filesystem::remove( file_path );
+
+	if( num_errors > 0 )
+	{
+		std::cout << num_errors << " checks failed" << std::endl;
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,331 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+// Checks the project structure of GeometryConverter::convertGeometry against a reference resolution, which follows the relationships
+// recursively and finds the geometry input data of each related object through its GUID, as resolveProjectStructure did before it
+// kept its products by object definition.
+// Models: the given file, and a generated one with objects contained in two storeys, a nested assembly chain, objects that are only
+// reached through a system serving the building, and a port of a flow segment.
+
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <ifcpp/model/BuildingGuid.h>
+#include <ifcpp/model/BuildingModel.h>
+#include <ifcpp/reader/ReaderSTEP.h>
+#include <ifcpp/geometry/GeometryConverter.h>
+
+static int num_errors = 0;
+
+static void check( bool condition, const std::string& message )
+{
+	if( !condition )
+	{
+		std::cout << "FAILED: " << message << std::endl;
+		++num_errors;
+	}
+}
+
+/// parent and children of each product, as ProductShapeData::addChildProduct would set them
+struct ReferenceStructure
+{
+	std::unordered_map<ProductShapeData*, std::vector<ProductShapeData*> > children;
+	std::unordered_map<ProductShapeData*, ProductShapeData*> parents;
+	std::unordered_set<ProductShapeData*> added;
+	std::unordered_set<int> resolved_tags;
+
+	void addChild( ProductShapeData* parent, ProductShapeData* child )
+	{
+		auto it_grand_parent = parents.find( parent );
+		if( it_grand_parent != parents.end() && it_grand_parent->second == child )
+		{
+			return;
+		}
+		auto it_parent = parents.find( child );
+		if( it_parent != parents.end() && it_parent->second == parent )
+		{
+			return;
+		}
+		children[parent].push_back( child );
+		parents[child] = parent;
+	}
+};
+
+class ReferenceResolver
+{
+public:
+	ReferenceResolver( std::unordered_map<BinaryGuid, shared_ptr<ProductShapeData> >& shape_data ) : m_shape_data( shape_data ) {}
+
+	ReferenceStructure m_structure;
+
+	void resolve( const shared_ptr<ProductShapeData>& product_data, bool resolve_secondary_structure )
+	{
+		m_structure.added.insert( product_data.get() );
+		shared_ptr<IfcObjectDefinition> object_def = product_data->m_ifc_object_definition.lock();
+		if( !object_def )
+		{
+			return;
+		}
+
+		for( const weak_ptr<IfcRelAggregates>& rel_aggregates_weak : object_def->m_IsDecomposedBy_inverse )
+		{
+			shared_ptr<IfcRelAggregates> rel_aggregates = rel_aggregates_weak.lock();
+			if( rel_aggregates )
+			{
+				for( const shared_ptr<IfcObjectDefinition>& related : rel_aggregates->m_RelatedObjects )
+				{
+					attach( product_data, related, resolve_secondary_structure );
+				}
+			}
+		}
+
+		shared_ptr<IfcSpatialElement> spatial_ele = dynamic_pointer_cast<IfcSpatialElement>( object_def );
+		if( spatial_ele )
+		{
+			for( const weak_ptr<IfcRelContainedInSpatialStructure>& rel_contained_weak : spatial_ele->m_ContainsElements_inverse )
+			{
+				shared_ptr<IfcRelContainedInSpatialStructure> rel_contained = rel_contained_weak.lock();
+				if( rel_contained )
+				{
+					for( const shared_ptr<IfcProduct>& related : rel_contained->m_RelatedElements )
+					{
+						attach( product_data, related, resolve_secondary_structure );
+					}
+				}
+			}
+		}
+
+		if( !resolve_secondary_structure )
+		{
+			return;
+		}
+
+		if( spatial_ele )
+		{
+			for( const weak_ptr<IfcRelServicesBuildings>& serviced_by_weak : spatial_ele->m_ServicedBySystems_inverse )
+			{
+				shared_ptr<IfcRelServicesBuildings> serviced_by = serviced_by_weak.lock();
+				if( !serviced_by || !serviced_by->m_RelatingSystem )
+				{
+					continue;
+				}
+				for( const weak_ptr<IfcRelAssignsToGroup>& grouped_by_weak : serviced_by->m_RelatingSystem->m_IsGroupedBy_inverse )
+				{
+					shared_ptr<IfcRelAssignsToGroup> grouped_by = grouped_by_weak.lock();
+					if( grouped_by )
+					{
+						for( const shared_ptr<IfcObjectDefinition>& related : grouped_by->m_RelatedObjects )
+						{
+							attach( product_data, related, resolve_secondary_structure );
+						}
+					}
+				}
+			}
+		}
+
+		shared_ptr<IfcDistributionElement> distribution_element = dynamic_pointer_cast<IfcDistributionElement>( object_def );
+		if( distribution_element )
+		{
+			for( const weak_ptr<IfcRelConnectsPortToElement>& rel_port_weak : distribution_element->m_HasPorts_inverse )
+			{
+				shared_ptr<IfcRelConnectsPortToElement> rel_port = rel_port_weak.lock();
+				if( rel_port && rel_port->m_RelatingPort )
+				{
+					attach( product_data, rel_port->m_RelatingPort, resolve_secondary_structure );
+				}
+			}
+		}
+	}
+
+private:
+	void attach( const shared_ptr<ProductShapeData>& parent, const shared_ptr<IfcObjectDefinition>& related, bool resolve_secondary_structure )
+	{
+		if( !related || related->m_tag < 0 || !m_structure.resolved_tags.insert( related->m_tag ).second )
+		{
+			return;
+		}
+		if( !related->m_GlobalId )
+		{
+			return;
+		}
+		auto it_product = m_shape_data.find( BinaryGuid( related->m_GlobalId->m_value ) );
+		if( it_product != m_shape_data.end() && it_product->second )
+		{
+			m_structure.addChild( parent.get(), it_product->second.get() );
+			resolve( it_product->second, resolve_secondary_structure );
+		}
+	}
+
+	std::unordered_map<BinaryGuid, shared_ptr<ProductShapeData> >& m_shape_data;
+};
+
+static void writeStructureModel( const std::string& file_path )
+{
+	std::ofstream stream( file_path );
+	stream << "ISO-10303-21;\nHEADER;\nFILE_DESCRIPTION((''),'2;1');\nFILE_NAME('','',(''),(''),'','','');\nFILE_SCHEMA(('IFC4X3_ADD2'));\nENDSEC;\nDATA;\n";
+	stream << "#1=IFCSIUNIT(*,.LENGTHUNIT.,$,.METRE.);\n#2=IFCUNITASSIGNMENT((#1));\n";
+	stream << "#3=IFCPROJECT('" << createBase64Uuid() << "',$,'Project',$,$,$,$,$,#2);\n";
+	stream << "#4=IFCSITE('" << createBase64Uuid() << "',$,'Site',$,$,$,$,$,.ELEMENT.,$,$,$,$,$);\n";
+	stream << "#5=IFCBUILDING('" << createBase64Uuid() << "',$,'Building',$,$,$,$,$,.ELEMENT.,$,$,$);\n";
+	stream << "#6=IFCRELAGGREGATES('" << createBase64Uuid() << "',$,$,$,#3,(#4));\n";
+	stream << "#7=IFCRELAGGREGATES('" << createBase64Uuid() << "',$,$,$,#4,(#5));\n";
+
+	// three storeys with ten proxies each. The first proxy of each storey is also contained in the next storey
+	int tag = 10;
+	std::vector<int> storeys;
+	std::vector<int> first_proxies;
+	for( int ii = 0; ii < 3; ++ii )
+	{
+		storeys.push_back( tag );
+		stream << "#" << tag++ << "=IFCBUILDINGSTOREY('" << createBase64Uuid() << "',$,'Storey " << ii << "',$,$,$,$,$,.ELEMENT.,$);\n";
+	}
+	stream << "#" << tag++ << "=IFCRELAGGREGATES('" << createBase64Uuid() << "',$,$,$,#5,(#" << storeys[0] << ",#" << storeys[1] << ",#" << storeys[2] << "));\n";
+	for( int ii = 0; ii < 3; ++ii )
+	{
+		std::string contained;
+		if( ii > 0 )
+		{
+			contained = "#" + std::to_string( first_proxies.back() );
+		}
+		first_proxies.push_back( tag );
+		for( int jj = 0; jj < 10; ++jj )
+		{
+			contained += ( contained.empty() ? "#" : ",#" ) + std::to_string( tag );
+			stream << "#" << tag++ << "=IFCBUILDINGELEMENTPROXY('" << createBase64Uuid() << "',$,'Proxy',$,$,$,$,$,$);\n";
+		}
+		stream << "#" << tag++ << "=IFCRELCONTAINEDINSPATIALSTRUCTURE('" << createBase64Uuid() << "',$,$,$,(" << contained << "),#" << storeys[ii] << ");\n";
+	}
+
+	// assembly chain of depth 50 in the first storey, each assembly with a proxy
+	int parent_assembly = tag++;
+	stream << "#" << parent_assembly << "=IFCELEMENTASSEMBLY('" << createBase64Uuid() << "',$,'Assembly',$,$,$,$,$,$,$);\n";
+	stream << "#" << tag++ << "=IFCRELCONTAINEDINSPATIALSTRUCTURE('" << createBase64Uuid() << "',$,$,$,(#" << parent_assembly << "),#" << storeys[0] << ");\n";
+	for( int ii = 0; ii < 50; ++ii )
+	{
+		const int assembly = tag++;
+		const int proxy = tag++;
+		stream << "#" << assembly << "=IFCELEMENTASSEMBLY('" << createBase64Uuid() << "',$,'Assembly',$,$,$,$,$,$,$);\n";
+		stream << "#" << proxy << "=IFCBUILDINGELEMENTPROXY('" << createBase64Uuid() << "',$,'Part',$,$,$,$,$,$);\n";
+		stream << "#" << tag++ << "=IFCRELAGGREGATES('" << createBase64Uuid() << "',$,$,$,#" << parent_assembly << ",(#" << assembly << ",#" << proxy << "));\n";
+		parent_assembly = assembly;
+	}
+
+	// a system serving the building, with a flow segment in the second storey, which has a port, and two proxies that are in no storey
+	const int segment = tag++;
+	const int port = tag++;
+	const int system = tag++;
+	const int loose_proxy_1 = tag++;
+	const int loose_proxy_2 = tag++;
+	stream << "#" << segment << "=IFCFLOWSEGMENT('" << createBase64Uuid() << "',$,'Segment',$,$,$,$,$);\n";
+	stream << "#" << port << "=IFCDISTRIBUTIONPORT('" << createBase64Uuid() << "',$,'Port',$,$,$,$,.SOURCE.,$,$);\n";
+	stream << "#" << tag++ << "=IFCRELCONNECTSPORTTOELEMENT('" << createBase64Uuid() << "',$,$,$,#" << port << ",#" << segment << ");\n";
+	stream << "#" << tag++ << "=IFCRELCONTAINEDINSPATIALSTRUCTURE('" << createBase64Uuid() << "',$,$,$,(#" << segment << "),#" << storeys[1] << ");\n";
+	stream << "#" << system << "=IFCDISTRIBUTIONSYSTEM('" << createBase64Uuid() << "',$,'System',$,$,$,$);\n";
+	stream << "#" << loose_proxy_1 << "=IFCBUILDINGELEMENTPROXY('" << createBase64Uuid() << "',$,'Loose',$,$,$,$,$,$);\n";
+	stream << "#" << loose_proxy_2 << "=IFCBUILDINGELEMENTPROXY('" << createBase64Uuid() << "',$,'Loose',$,$,$,$,$,$);\n";
+	stream << "#" << tag++ << "=IFCRELASSIGNSTOGROUP('" << createBase64Uuid() << "',$,$,$,(#" << segment << ",#" << loose_proxy_1 << ",#" << loose_proxy_2 << "),$,#" << system << ");\n";
+	stream << "#" << tag++ << "=IFCRELSERVICESBUILDINGS('" << createBase64Uuid() << "',$,$,$,#" << system << ",(#5));\n";
+	stream << "ENDSEC;\nEND-ISO-10303-21;\n";
+}
+
+static void checkStructure( const std::string& file_path, const std::string& name, size_t min_num_attached )
+{
+	shared_ptr<BuildingModel> model( new BuildingModel() );
+	shared_ptr<ReaderSTEP> reader( new ReaderSTEP() );
+	reader->loadModelFromFile( file_path, model );
+
+	shared_ptr<GeometrySettings> geom_settings( new GeometrySettings() );
+	shared_ptr<GeometryConverter> geometry_converter( new GeometryConverter( model, geom_settings ) );
+	geometry_converter->convertGeometry();
+
+	std::unordered_map<BinaryGuid, shared_ptr<ProductShapeData> >& shape_data = geometry_converter->getShapeInputData();
+	shared_ptr<ProductShapeData> project_data;
+	for( auto& it : shape_data )
+	{
+		shared_ptr<IfcObjectDefinition> object_def = it.second ? it.second->m_ifc_object_definition.lock() : nullptr;
+		if( object_def && object_def->classID() == IFCPROJECT )
+		{
+			project_data = it.second;
+		}
+	}
+	check( project_data != nullptr, name + ": project found" );
+	if( !project_data )
+	{
+		return;
+	}
+
+	// the model is not changed by the resolution, so the reference can run on the same relationships and the same geometry input data
+	ReferenceResolver reference( shape_data );
+	reference.resolve( project_data, false );
+	reference.resolve( project_data, true );
+
+	size_t num_attached = 0;
+	size_t num_different = 0;
+	for( auto& it : shape_data )
+	{
+		ProductShapeData* product = it.second.get();
+		if( !product )
+		{
+			continue;
+		}
+		std::vector<ProductShapeData*> children;
+		for( const shared_ptr<ProductShapeData>& child : product->getChildElements() )
+		{
+			children.push_back( child.get() );
+		}
+		auto it_expected = reference.m_structure.children.find( product );
+		const std::vector<ProductShapeData*> expected_children = it_expected != reference.m_structure.children.end() ? it_expected->second : std::vector<ProductShapeData*>();
+		const bool expected_added = reference.m_structure.added.count( product ) > 0;
+		num_attached += children.size();
+		if( ( children != expected_children || product->m_added_to_spatial_structure != expected_added ) && ++num_different <= 5 )
+		{
+			check( false, name + ": product " + product->m_entity_guid + " has " + std::to_string( children.size() ) + " children, expected " + std::to_string( expected_children.size() ) );
+		}
+	}
+	check( num_different == 0, name + ": " + std::to_string( num_different ) + " products differ from the reference" );
+	check( num_attached >= min_num_attached, name + ": " + std::to_string( num_attached ) + " products attached" );
+}
+
+int main( int argc, char* argv[] )
+{
+	if( argc < 2 )
+	{
+		std::cout << "usage: ProjectStructureTest IfcOpenHouse.ifc" << std::endl;
+		return 1;
+	}
+
+	checkStructure( argv[1], "IfcOpenHouse", 10 );
+
+	const std::string file_path = ( std::filesystem::temp_directory_path() / "ProjectStructureTest.ifc" ).string();
+	writeStructureModel( file_path );
+	// site, building, 3 storeys, 30 proxies, 51 assemblies and 50 parts, segment. The second pass starts at the project again and does not
+	// descend into objects attached in the first, so the port and the loose proxies are not required
+	checkStructure( file_path, "generated", 1 + 1 + 3 + 30 + 51 + 50 + 1 );
+	std::filesystem::remove( file_path );
+
+	if( num_errors > 0 )
+	{
+		std::cout << num_errors << " checks failed" << std::endl;
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,363 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+// Decodes random STEP strings with decodeArgumentString and compares the result with a copy of the previous decoder, which
+// converted each escape sequence through std::wstring_convert. The random strings combine plain text, \S\, \S\..\S\, \X\hh, \X0\, \N\,
+// terminated and unterminated \X2\ runs with surrogate pairs, and backslashes that do not start an escape sequence.
+// The previous decoder read past the end of truncated escapes, looped forever on \X2 without its backslash, threw on lone surrogates
+// and did not know \X4\ and \P.\, so these cases are checked against expected strings instead.
+
+#include <codecvt>
+#include <cstdint>
+#include <iostream>
+#include <locale>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <ifcpp/reader/ReaderUtil.h>
+
+static int num_errors = 0;
+
+static void check( bool condition, const std::string& message )
+{
+	if( !condition )
+	{
+		std::cout << "FAILED: " << message << std::endl;
+		++num_errors;
+	}
+}
+
+static std::string printable( const std::string& str )
+{
+	std::string result;
+	const char* hex = "0123456789ABCDEF";
+	for( unsigned char c : str )
+	{
+		if( c >= 0x20 && c < 0x7F )
+		{
+			result += char( c );
+		}
+		else
+		{
+			result += std::string( "<" ) + hex[c >> 4] + hex[c & 15] + ">";
+		}
+	}
+	return result;
+}
+
+namespace reference
+{
+	static char convertToHex( unsigned char mc )
+	{
+		if( mc >= '0' && mc <= '9' ) return char( mc - '0' );
+		if( mc >= 'A' && mc <= 'F' ) return char( 10 + mc - 'A' );
+		if( mc >= 'a' && mc <= 'f' ) return char( 10 + mc - 'a' );
+		return 0;
+	}
+
+	// the part of checkAndConvertAppleEncoding that \X\ used, for 0x80 to 0x9F
+	static const char16_t apple_encoding[32] = { 196, 197, 199, 201, 209, 214, 220, 225, 224, 226, 228, 227, 229, 231, 233, 232,
+		234, 235, 237, 236, 238, 239, 241, 243, 242, 244, 246, 245, 250, 249, 251, 252 };
+
+	static std::string toUtf8( const std::u16string& u16str )
+	{
+		std::wstring_convert<std::codecvt_utf8_utf16<char16_t>, char16_t> convert;
+		return convert.to_bytes( u16str );
+	}
+
+	// decodeArgumentString before the decoder was rewritten, with the same control flow
+	static std::string decodeArgumentString( const std::string& argument_str )
+	{
+		std::string arg_str_new;
+		const char* stream_pos = argument_str.c_str();
+		while( *stream_pos != '\0' )
+		{
+			if( *stream_pos == '\\' )
+			{
+				const char c1 = stream_pos[1];
+				if( c1 == 'S' && stream_pos[2] == '\\' && stream_pos[3] != '\0' )
+				{
+					const char first = stream_pos[3];
+					if( stream_pos[4] == '\\' )
+					{
+						if( ( stream_pos[5] == 'S' || stream_pos[5] == 'Q' ) && stream_pos[6] == '\\' && stream_pos[7] != '\0' )
+						{
+							arg_str_new += char( 125 + first + stream_pos[7] );
+							stream_pos += 8;
+							continue;
+						}
+					}
+					else
+					{
+						const uint8_t charAsUint = uint8_t( char( 128 + first ) );
+						arg_str_new.push_back( char( 0xc0 | charAsUint >> 6 ) );
+						arg_str_new.push_back( char( 0x80 | ( charAsUint & 0x3f ) ) );
+						stream_pos += 4;
+						continue;
+					}
+				}
+				else if( c1 == 'X' )
+				{
+					const char c2 = stream_pos[2];
+					if( c2 == '\\' )
+					{
+						char16_t code_unit = char16_t( uint8_t( ( convertToHex( stream_pos[3] ) << 4 ) | convertToHex( stream_pos[4] ) ) );
+						if( code_unit >= 0x80 && code_unit <= 0x9F )
+						{
+							code_unit = apple_encoding[code_unit - 0x80];
+						}
+						arg_str_new += toUtf8( std::u16string( 1, code_unit ) );
+						stream_pos += 5;
+						continue;
+					}
+					else if( c2 == '0' && stream_pos[3] == '\\' )
+					{
+						stream_pos += 4;
+						continue;
+					}
+					else if( c2 == '2' && stream_pos[3] == '\\' )
+					{
+						stream_pos += 4;
+						std::u16string u16str;
+						do
+						{
+							if( stream_pos[0] == '\\' )
+							{
+								if( stream_pos[1] == 'X' && stream_pos[2] == '0' && stream_pos[3] == '\\' )
+								{
+									stream_pos += 4;
+									break;
+								}
+								// unexpected sequence
+								return argument_str;
+							}
+							const char high = char( ( convertToHex( stream_pos[0] ) << 4 ) | convertToHex( stream_pos[1] ) );
+							const char low = char( ( convertToHex( stream_pos[2] ) << 4 ) | convertToHex( stream_pos[3] ) );
+							u16str.push_back( char16_t( ( uint8_t( high ) << 8 ) | uint8_t( low ) ) );
+							stream_pos += 4;
+						} while( *stream_pos != '\0' );
+						arg_str_new += toUtf8( u16str );
+						continue;
+					}
+				}
+				else if( c1 == 'N' && stream_pos[2] == '\\' )
+				{
+					arg_str_new.append( "\n" );
+					stream_pos += 3;
+					continue;
+				}
+			}
+			arg_str_new += *stream_pos;
+			++stream_pos;
+		}
+		return arg_str_new;
+	}
+}
+
+// random STEP string from pieces on which the previous decoder was well defined
+class StepStringGenerator
+{
+public:
+	std::mt19937 m_random;
+
+	StepStringGenerator( uint32_t seed ) : m_random( seed )
+	{
+	}
+
+	int randomInt( int min, int max )
+	{
+		return std::uniform_int_distribution<int>( min, max )( m_random );
+	}
+
+	char randomPrintable()
+	{
+		// without the backslash
+		const char c = char( randomInt( 0x20, 0x7D ) );
+		return c == '\\' ? '~' : c;
+	}
+
+	std::string hex( uint32_t value, int num_digits )
+	{
+		const char* digits = randomInt( 0, 1 ) ? "0123456789ABCDEF" : "0123456789abcdef";
+		std::string result;
+		for( int ii = num_digits - 1; ii >= 0; --ii )
+		{
+			result += digits[( value >> ( 4 * ii ) ) & 15];
+		}
+		return result;
+	}
+
+	std::string codeUnits( int min_characters )
+	{
+		std::string units;
+		const int num_characters = randomInt( min_characters, 4 );
+		for( int ii = 0; ii < num_characters; ++ii )
+		{
+			if( randomInt( 0, 4 ) == 0 )
+			{
+				const uint32_t code_point = uint32_t( randomInt( 0x10000, 0x10FFFF ) ) - 0x10000;
+				units += hex( 0xD800 + ( code_point >> 10 ), 4 ) + hex( 0xDC00 + ( code_point & 0x3FF ), 4 );
+			}
+			else
+			{
+				uint32_t code_unit = uint32_t( randomInt( 0, 0xF7FF ) );
+				if( code_unit >= 0xD800 )
+				{
+					code_unit += 0x800;
+				}
+				units += hex( code_unit, 4 );
+			}
+		}
+		return units;
+	}
+
+	std::string next()
+	{
+		std::string result;
+		const int num_pieces = randomInt( 0, 8 );
+		for( int ii = 0; ii < num_pieces; ++ii )
+		{
+			switch( randomInt( 0, 9 ) )
+			{
+			case 0:
+			case 1:
+				for( int jj = randomInt( 1, 8 ); jj > 0; --jj )
+				{
+					result += randomPrintable();
+				}
+				break;
+			case 2:
+				// followed by a plain character, otherwise a following backslash would make it the first half of \S\..\S\.
+				result += std::string( "\\S\\" ) + randomPrintable() + randomPrintable();
+				break;
+			case 3:
+				result += std::string( "\\S\\" ) + randomPrintable() + ( randomInt( 0, 1 ) ? "\\S\\" : "\\Q\\" ) + randomPrintable();
+				break;
+			case 4:
+				result += "\\X\\" + hex( uint32_t( randomInt( 0, 255 ) ), 2 );
+				break;
+			case 5:
+				result += "\\X2\\" + codeUnits( 0 ) + "\\X0\\";
+				break;
+			case 6:
+				result += "\\X0\\";
+				break;
+			case 7:
+				result += "\\N\\";
+				break;
+			case 8:
+				// a backslash that does not start an escape sequence
+				result += std::string( "\\" ) + "ABCDEFGHIJKLMOQRTUVWYZabcz019 '"[randomInt( 0, 29 )];
+				break;
+			case 9:
+				// unterminated \X2\ run, at the end of the string only. The previous decoder read past the end of an empty one
+				result += "\\X2\\" + codeUnits( 1 );
+				ii = num_pieces;
+				break;
+			}
+		}
+		return result;
+	}
+};
+
+static std::string decode( const std::string& input )
+{
+	std::string decoded;
+	decodeArgumentString( input, decoded );
+	return decoded;
+}
+
+static void checkDecoded( const std::string& input, const std::string& expected )
+{
+	const std::string decoded = decode( input );
+	check( decoded == expected, "'" + input + "' decoded to '" + printable( decoded ) + "', expected '" + printable( expected ) + "'" );
+}
+
+int main( int /*argc*/, char* /*argv*/[] )
+{
+	StepStringGenerator generator( 1234567 );
+	size_t num_different = 0;
+	size_t num_escaped = 0;
+	std::vector<std::string> batch, batch_decoded;
+	for( size_t ii = 0; ii < 200000; ++ii )
+	{
+		const std::string input = generator.next();
+		const std::string decoded = decode( input );
+		const std::string expected = input.empty() ? std::string() : reference::decodeArgumentString( input );
+		if( decoded != input )
+		{
+			++num_escaped;
+		}
+		if( decoded != expected && ++num_different <= 10 )
+		{
+			check( false, "'" + input + "' decoded to '" + printable( decoded ) + "', previous decoder '" + printable( expected ) + "'" );
+		}
+
+		// the in-place overload for a whole entity gives the same strings and drops empty ones
+		batch.push_back( input );
+		if( !input.empty() )
+		{
+			batch_decoded.push_back( decoded );
+		}
+		if( batch.size() == 16 )
+		{
+			decodeArgumentStrings( batch );
+			check( batch == batch_decoded, "in-place decodeArgumentStrings differs from decodeArgumentString" );
+			batch.clear();
+			batch_decoded.clear();
+		}
+	}
+	check( num_different == 0, std::to_string( num_different ) + " strings differ from the previous decoder" );
+	check( num_escaped > 100000, std::to_string( num_escaped ) + " strings changed by decoding" );
+
+	// \X4\ runs of code points
+	checkDecoded( "\\X4\\0001F600\\X0\\", "\xF0\x9F\x98\x80" );
+	checkDecoded( "a\\X4\\000000E90001F600\\X0\\b", "a\xC3\xA9\xF0\x9F\x98\x80" "b" );
+	checkDecoded( "\\X4\\00110000\\X0\\", "\xEF\xBF\xBD" );
+
+	// \PA\ to \PI\ are skipped, \S\ stays ISO 8859-1
+	checkDecoded( "\\PA\\caf\\S\\i", "caf\xC3\xA9" );
+	checkDecoded( "\\PI\\x\\PJ\\", "x\\PJ\\" );
+
+	// lone surrogates become U+FFFD
+	checkDecoded( "\\X2\\D83D\\X0\\", "\xEF\xBF\xBD" );
+	checkDecoded( "\\X2\\DE00\\X0\\", "\xEF\xBF\xBD" );
+	checkDecoded( "\\X2\\D83D0041\\X0\\", "\xEF\xBF\xBD" "A" );
+	checkDecoded( "\\X2\\D83DDE00\\X0\\", "\xF0\x9F\x98\x80" );
+
+	// truncated and unterminated escapes. An incomplete group of hexadecimal digits is kept as text
+	checkDecoded( "\\", "\\" );
+	checkDecoded( "ab\\", "ab\\" );
+	checkDecoded( "\\S", "\\S" );
+	checkDecoded( "\\S\\", "\\S\\" );
+	checkDecoded( "\\S\\a\\S\\", "\\S\\a\\S\\" );
+	checkDecoded( "ab\\X\\4", "ab\\X\\4" );
+	checkDecoded( "\\X2", "\\X2" );
+	checkDecoded( "\\X2x", "\\X2x" );
+	checkDecoded( "\\X2\\00E", "00E" );
+	checkDecoded( "\\X2\\00E9\\X0", "\\X2\\00E9\\X0" );
+	checkDecoded( "\\X2\\00E9\\Q", "\\X2\\00E9\\Q" );
+	checkDecoded( "\\X4\\0001F6", "0001F6" );
+	checkDecoded( "\\X2\\00E9", "\xC3\xA9" );
+
+	if( num_errors > 0 )
+	{
+		std::cout << num_errors << " checks failed" << std::endl;
+		return 1;
+	}
+	return 0;
+}
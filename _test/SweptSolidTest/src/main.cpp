@@ -0,0 +1,171 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+// Converts the swept solids in data/swept_solids.ifc and checks that each result is closed and that its volume matches
+// the analytic volume, which is the area of the profile times the length of the directrix (theorem of Pappus).
+// The profile is a rectangle of 0.2 x 0.1, centred on the directrix. Plane angles are in degrees.
+// ArcFixedReference: IfcFixedReferenceSweptAreaSolid along a circle with radius 2, trimmed from 0 to 90 by parameters.
+// ArcSurfaceCurve: IfcSurfaceCurveSweptAreaSolid along the same circle on a plane, without StartParam, ending at 180.
+// HelixFixedReference, HelixSurfaceCurve: a polyline helix with radius 1 and pitch 0.5 over two turns, with a fixed
+// reference and on a cylindrical surface. HelixTrimmed: the same helix from parameter 32 to 96, which is one turn.
+// The inscribed polygons of the tessellation make each volume slightly smaller than the analytic one.
+
+#include <cmath>
+#include <iostream>
+#include <map>
+#include <string>
+
+#include <ifcpp/model/BuildingModel.h>
+#include <ifcpp/reader/ReaderSTEP.h>
+#include <ifcpp/geometry/GeometryConverter.h>
+
+static int num_errors = 0;
+
+static void check( bool condition, const std::string& message )
+{
+	if( !condition )
+	{
+		std::cout << "FAILED: " << message << std::endl;
+		++num_errors;
+	}
+}
+
+struct ShapeResult
+{
+	double volume = 0;
+	size_t num_meshes = 0;
+	size_t num_open_meshes = 0;
+};
+
+// enclosed volume, independent of the orientation and of the cached volume of the mesh
+static double computeMeshVolume( carve::mesh::Mesh<3>* mesh )
+{
+	double volume = 0;
+	for( carve::mesh::Face<3>* face : mesh->faces )
+	{
+		carve::mesh::Edge<3>* first = face->edge;
+		for( carve::mesh::Edge<3>* edge = first->next; edge->next != first; edge = edge->next )
+		{
+			volume += carve::geom3d::tetrahedronVolume( first->vert->v, edge->vert->v, edge->next->vert->v, carve::geom::VECTOR( 0, 0, 0 ) );
+		}
+	}
+	return std::abs( volume );
+}
+
+static void addItemResult( const shared_ptr<ItemShapeData>& item, ShapeResult& result )
+{
+	for( const shared_ptr<carve::mesh::MeshSet<3> >& meshset : item->m_meshsets )
+	{
+		for( carve::mesh::Mesh<3>* mesh : meshset->meshes )
+		{
+			++result.num_meshes;
+			if( !mesh->isClosed() )
+			{
+				++result.num_open_meshes;
+			}
+			result.volume += mesh->is_inner_mesh ? -computeMeshVolume( mesh ) : computeMeshVolume( mesh );
+		}
+	}
+	for( const shared_ptr<carve::mesh::MeshSet<3> >& meshset : item->m_meshsets_open )
+	{
+		result.num_meshes += meshset->meshes.size();
+		result.num_open_meshes += meshset->meshes.size();
+	}
+	for( const shared_ptr<ItemShapeData>& child_item : item->m_child_items )
+	{
+		addItemResult( child_item, result );
+	}
+}
+
+static ShapeResult getShapeResult( const shared_ptr<ProductShapeData>& product_shape )
+{
+	ShapeResult result;
+	for( const shared_ptr<ItemShapeData>& item : product_shape->getGeometricItems() )
+	{
+		addItemResult( item, result );
+	}
+	return result;
+}
+
+int main( int argc, char* argv[] )
+{
+	if( argc < 2 )
+	{
+		std::cout << "usage: SweptSolidTest swept_solids.ifc" << std::endl;
+		return 1;
+	}
+
+	shared_ptr<BuildingModel> model( new BuildingModel() );
+	shared_ptr<ReaderSTEP> reader( new ReaderSTEP() );
+	reader->loadModelFromFile( argv[1], model );
+
+	shared_ptr<GeometrySettings> geom_settings( new GeometrySettings() );
+	shared_ptr<GeometryConverter> geometry_converter( new GeometryConverter( model, geom_settings ) );
+	geom_settings->setNumVerticesPerCircle( 64 );
+	geometry_converter->convertGeometry();
+
+	const double profile_area = 0.2 * 0.1;
+	const double helix_turn_length = std::sqrt( 2.0 * M_PI * 2.0 * M_PI + 0.5 * 0.5 );
+	const std::map<std::string, double> analytic_volumes = {
+		{ "ArcFixedReference", profile_area * 2.0 * M_PI * 0.5 },
+		{ "ArcSurfaceCurve", profile_area * 2.0 * M_PI },
+		{ "HelixFixedReference", profile_area * helix_turn_length * 2.0 },
+		{ "HelixSurfaceCurve", profile_area * helix_turn_length * 2.0 },
+		{ "HelixTrimmed", profile_area * helix_turn_length }
+	};
+
+	std::map<std::string, shared_ptr<ProductShapeData> > map_shapes;
+	for( auto& it : geometry_converter->getShapeInputData() )
+	{
+		shared_ptr<ProductShapeData>& product_shape = it.second;
+		if( !product_shape || product_shape->m_ifc_object_definition.expired() )
+		{
+			continue;
+		}
+		shared_ptr<IfcObjectDefinition> object_def( product_shape->m_ifc_object_definition );
+		if( object_def->m_Name )
+		{
+			map_shapes[object_def->m_Name->m_value] = product_shape;
+		}
+	}
+
+	for( auto& it : analytic_volumes )
+	{
+		const std::string& name = it.first;
+		auto it_shape = map_shapes.find( name );
+		check( it_shape != map_shapes.end(), name + ": no geometry" );
+		if( it_shape == map_shapes.end() )
+		{
+			continue;
+		}
+
+		ShapeResult result = getShapeResult( it_shape->second );
+		check( result.num_meshes > 0, name + ": no meshes" );
+		check( result.num_open_meshes == 0, name + ": " + std::to_string( result.num_open_meshes ) + " of " + std::to_string( result.num_meshes ) + " meshes are open" );
+
+		const double deviation = ( result.volume - it.second ) / it.second;
+		check( std::abs( deviation ) < 0.01, name + ": volume " + std::to_string( result.volume ) + ", analytic " + std::to_string( it.second ) );
+		std::cout << name << ": volume " << result.volume << ", analytic " << it.second << ", deviation " << deviation * 100.0 << "%" << std::endl;
+	}
+
+	if( num_errors > 0 )
+	{
+		std::cout << num_errors << " checks failed" << std::endl;
+		return 1;
+	}
+	return 0;
+}
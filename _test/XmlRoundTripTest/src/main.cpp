@@ -0,0 +1,313 @@
+/* -*-c++-*- IfcQuery www.ifcquery.com
+*
+MIT License
+
+Copyright (c) 2017 Fabian Gerold
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+// Reads a STEP file, writes it as ifcXML, reads the ifcXML file with ReaderXML and checks that each entity gives the same STEP line as before.
+// There is no ifcXML writer in the library, so the file is written here, from getAttributes and the declared attribute types of IFC4X3::SchemaInfo:
+// simple values as XML attributes, entity references as <Attribute ref="i12"/>, values of select types as <IfcLabel-wrapper>text</IfcLabel-wrapper>.
+// A few strings with apostrophes, markup characters and non-ASCII characters are set before writing, to check the escaping on both sides.
+
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <ifcpp/model/AttributeObject.h>
+#include <ifcpp/model/BuildingModel.h>
+#include <ifcpp/reader/ReaderSTEP.h>
+#include <ifcpp/reader/ReaderUtil.h>
+#include <ifcpp/reader/ReaderXML.h>
+#include <ifcpp/IFC4X3/EntityFactory.h>
+#include <ifcpp/IFC4X3/SchemaInfo.h>
+#include <IfcLabel.h>
+#include <IfcRoot.h>
+#include <IfcText.h>
+
+using namespace IFC4X3;
+
+static int num_errors = 0;
+
+static void check( bool condition, const std::string& message )
+{
+	if( !condition )
+	{
+		std::cout << "FAILED: " << message << std::endl;
+		++num_errors;
+	}
+}
+
+static std::string escapeXml( const std::string& text )
+{
+	std::string result;
+	for( char c : text )
+	{
+		switch( c )
+		{
+		case '&': result += "&amp;"; break;
+		case '<': result += "&lt;"; break;
+		case '>': result += "&gt;"; break;
+		case '"': result += "&quot;"; break;
+		case '\n': result += "&#10;"; break;
+		default: result += c;
+		}
+	}
+	return result;
+}
+
+/// reverses encodeStepString, which writes apostrophes as \X\27, doubles backslashes and writes each byte of a UTF-8 character in a \X2\ run
+static std::string decodeStepString( const std::string& encoded )
+{
+	std::string result;
+	for( size_t ii = 0; ii < encoded.size(); )
+	{
+		if( encoded.compare( ii, 2, "\\\\" ) == 0 )
+		{
+			result += '\\';
+			ii += 2;
+		}
+		else if( encoded.compare( ii, 3, "\\X\\" ) == 0 )
+		{
+			result += char( std::stoi( encoded.substr( ii + 3, 2 ), nullptr, 16 ) );
+			ii += 5;
+		}
+		else if( encoded.compare( ii, 4, "\\X2\\" ) == 0 )
+		{
+			for( ii += 4; encoded.compare( ii, 4, "\\X0\\" ) != 0; ii += 4 )
+			{
+				result += char( std::stoi( encoded.substr( ii, 4 ), nullptr, 16 ) );
+			}
+			ii += 4;
+		}
+		else
+		{
+			result += encoded[ii++];
+		}
+	}
+	return result;
+}
+
+/// text of a simple value as in ifcXML: strings without quotes, enumerations without dots, booleans as true and false
+static std::string getValueText( const shared_ptr<BuildingObject>& value )
+{
+	std::stringstream stream;
+	stream.imbue( std::locale( "C" ) );
+	stream.precision( 15 );
+	if( auto real_value = dynamic_pointer_cast<RealAttribute>( value ) ) { stream << real_value->m_value; return stream.str(); }
+	if( auto int_value = dynamic_pointer_cast<IntegerAttribute>( value ) ) { stream << int_value->m_value; return stream.str(); }
+	if( auto bool_value = dynamic_pointer_cast<BoolAttribute>( value ) ) { return bool_value->m_value ? "true" : "false"; }
+
+	value->getStepParameter( stream, false, 15 );
+	const std::string step_value = stream.str();
+	if( step_value.size() > 1 && step_value.front() == '\'' )
+	{
+		return decodeStepString( step_value.substr( 1, step_value.size() - 2 ) );
+	}
+	if( step_value.size() > 2 && step_value.front() == '.' )
+	{
+		const std::string literal = step_value.substr( 1, step_value.size() - 2 );
+		if( literal == "T" ) { return "true"; }
+		if( literal == "F" ) { return "false"; }
+		if( literal == "U" ) { return "unknown"; }
+		return literal;
+	}
+	return step_value;
+}
+
+static std::string getClassName( const shared_ptr<BuildingObject>& value )
+{
+	return EntityFactory::getStringForClassID( value->classID() );
+}
+
+static bool isSimpleKind( const SchemaType* type )
+{
+	return type && type->kind != SCHEMA_ENTITY && type->kind != SCHEMA_SELECT;
+}
+
+/// whitespace separated values of a list of simple values
+static std::string getListText( const shared_ptr<AttributeObjectVector>& list )
+{
+	std::string text;
+	for( const shared_ptr<BuildingObject>& item : list->m_vec )
+	{
+		if( item )
+		{
+			text += ( text.empty() ? "" : " " ) + getValueText( item );
+		}
+	}
+	return text;
+}
+
+/// an element of a list of entities or selects: entity reference or wrapped value
+static void writeItem( std::ostream& out, const shared_ptr<BuildingObject>& item )
+{
+	shared_ptr<BuildingEntity> entity = dynamic_pointer_cast<BuildingEntity>( item );
+	if( entity )
+	{
+		out << "<" << getClassName( entity ) << " ref=\"i" << entity->m_tag << "\"/>";
+		return;
+	}
+	out << "<" << getClassName( item ) << "-wrapper>" << escapeXml( getValueText( item ) ) << "</" << getClassName( item ) << "-wrapper>";
+}
+
+static void writeEntity( std::ostream& out, const shared_ptr<BuildingEntity>& entity )
+{
+	std::string class_name_upper = getClassName( entity );
+	convertStringToUpperCase( class_name_upper );
+	const SchemaType* schema_type = SchemaInfo::getType( class_name_upper );
+	std::vector<std::pair<std::string, shared_ptr<BuildingObject> > > attributes;
+	entity->getAttributes( attributes );
+
+	std::stringstream elements;
+	out << "<" << getClassName( entity ) << " id=\"i" << entity->m_tag << "\"";
+	for( size_t ii = 0; ii < attributes.size() && ii < schema_type->attributes.size(); ++ii )
+	{
+		const std::string& name = attributes[ii].first;
+		const shared_ptr<BuildingObject>& value = attributes[ii].second;
+		const SchemaAttribute& schema_attribute = schema_type->attributes[ii];
+		if( !value )
+		{
+			continue;
+		}
+		shared_ptr<AttributeObjectVector> list = dynamic_pointer_cast<AttributeObjectVector>( value );
+		if( list && list->m_vec.empty() )
+		{
+			continue;
+		}
+
+		const int list_depth = schema_attribute.list_depth + schema_attribute.type->list_depth;
+		if( isSimpleKind( schema_attribute.type ) && ( list_depth == 0 || ( list_depth == 1 && schema_attribute.type->kind != SCHEMA_STRING ) ) )
+		{
+			// Name="text" or Coordinates="0. 1. 2."
+			out << " " << name << "=\"" << escapeXml( list ? getListText( list ) : getValueText( value ) ) << "\"";
+			continue;
+		}
+
+		elements << "<" << name << ">";
+		if( isSimpleKind( schema_attribute.type ) )
+		{
+			// one wrapper per string, or per inner list of a list of lists
+			const std::string wrapper = getClassName( list->m_vec.front() ) + "-wrapper";
+			for( const shared_ptr<BuildingObject>& item : list->m_vec )
+			{
+				shared_ptr<AttributeObjectVector> inner_list = dynamic_pointer_cast<AttributeObjectVector>( item );
+				const std::string text = inner_list ? getListText( inner_list ) : getValueText( item );
+				elements << "<" << ( inner_list && !inner_list->m_vec.empty() ? getClassName( inner_list->m_vec.front() ) + "-wrapper" : wrapper ) << ">" << escapeXml( text )
+					<< "</" << ( inner_list && !inner_list->m_vec.empty() ? getClassName( inner_list->m_vec.front() ) + "-wrapper" : wrapper ) << ">";
+			}
+		}
+		else if( list )
+		{
+			for( const shared_ptr<BuildingObject>& item : list->m_vec )
+			{
+				writeItem( elements, item );
+			}
+		}
+		else
+		{
+			writeItem( elements, value );
+		}
+		elements << "</" << name << ">\n";
+	}
+	out << ">\n" << elements.str() << "</" << getClassName( entity ) << ">\n";
+}
+
+static void writeIfcXml( const std::string& file_path, const shared_ptr<BuildingModel>& model )
+{
+	std::ofstream out( file_path, std::ios::binary );
+	out << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
+	out << "<ifcXML xmlns=\"https://standards.buildingsmart.org/IFC/RELEASE/IFC4_3\" xmlns:xsi=\"http://www.w3.org/2001/XMLSchema-instance\">\n";
+	for( auto& it : model->getMapIfcEntities() )
+	{
+		if( it.second )
+		{
+			writeEntity( out, it.second );
+		}
+	}
+	out << "</ifcXML>\n";
+}
+
+static std::string getStepLine( const shared_ptr<BuildingEntity>& entity )
+{
+	std::stringstream stream;
+	entity->getStepLine( stream, 15 );
+	return stream.str();
+}
+
+int main( int argc, char* argv[] )
+{
+	if( argc < 2 )
+	{
+		std::cout << "usage: XmlRoundTripTest IfcOpenHouse.ifc" << std::endl;
+		return 1;
+	}
+
+	shared_ptr<BuildingModel> model( new BuildingModel() );
+	shared_ptr<ReaderSTEP> reader( new ReaderSTEP() );
+	reader->loadModelFromFile( argv[1], model );
+	check( model->getMapIfcEntities().size() > 3000, "STEP file read" );
+
+	// strings that need escaping in STEP and XML
+	const std::vector<std::string> names = { "Wall 'A' & <b>\"B\"</b>", "Gr\xC3\xB6\xC3\x9F" "e \xE2\x80\x93 1", "back\\slash" };
+	size_t name_index = 0;
+	for( auto& it : model->getMapIfcEntities() )
+	{
+		shared_ptr<IfcRoot> root = dynamic_pointer_cast<IfcRoot>( it.second );
+		if( root && name_index < names.size() )
+		{
+			root->m_Name = shared_ptr<IfcLabel>( new IfcLabel( names[name_index] ) );
+			root->m_Description = shared_ptr<IfcText>( new IfcText( names[name_index] ) );
+			++name_index;
+		}
+	}
+
+	const std::string xml_path = ( std::filesystem::temp_directory_path() / "XmlRoundTripTest.ifcxml" ).string();
+	writeIfcXml( xml_path, model );
+
+	shared_ptr<BuildingModel> model_xml( new BuildingModel() );
+	shared_ptr<ReaderXML> reader_xml( new ReaderXML() );
+	reader_xml->loadModelFromFile( xml_path, model_xml );
+
+	const BuildingModelMapType<int, shared_ptr<BuildingEntity> >& map_xml = model_xml->getMapIfcEntities();
+	check( map_xml.size() == model->getMapIfcEntities().size(), "same number of entities: " + std::to_string( model->getMapIfcEntities().size() ) + " and " + std::to_string( map_xml.size() ) );
+
+	size_t num_different = 0;
+	for( auto& it : model->getMapIfcEntities() )
+	{
+		auto it_xml = map_xml.find( it.first );
+		if( it_xml == map_xml.end() )
+		{
+			check( false, "entity #" + std::to_string( it.first ) + " is missing" );
+			continue;
+		}
+		const std::string line = getStepLine( it.second );
+		const std::string line_xml = getStepLine( it_xml->second );
+		if( line != line_xml && ++num_different <= 10 )
+		{
+			check( false, "different entity:\n  " + line + "\n  " + line_xml );
+		}
+	}
+	check( num_different == 0, std::to_string( num_different ) + " entities are different" );
+
+	std::filesystem::remove( xml_path );
+	if( num_errors > 0 )
+	{
+		std::cout << num_errors << " checks failed" << std::endl;
+		return 1;
+	}
+	return 0;
+}
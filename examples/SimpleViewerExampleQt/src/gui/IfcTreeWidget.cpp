@@ -329,7 +329,7 @@ void IfcTreeWidget::slotModelLoadingDone()
 		}
 	}
 
-	std::unordered_map<std::string, shared_ptr<BuildingObject> >&	map_outside = m_system->getGeometryConverter()->getObjectsOutsideSpatialStructure();
+	std::unordered_map<BinaryGuid, shared_ptr<BuildingObject> >&	map_outside = m_system->getGeometryConverter()->getObjectsOutsideSpatialStructure();
 	
 	if( map_outside.size() > 0 )
 	{